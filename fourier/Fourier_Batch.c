@@ -0,0 +1,161 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#if defined(__AVX__) || defined(__FMA__)
+# include <immintrin.h>
+#endif
+#if defined(__SSE__)
+# include <xmmintrin.h>
+#endif
+/**************************************/
+#include "Fourier.h"
+/**************************************/
+#if FOURIER_BATCH_LANES > 1
+/**************************************/
+
+//! One vector per coefficient, holding that coefficient of
+//! each transform in its lanes
+//! NOTE: AVX-512 builds stay on 256-bit vectors, for the same
+//! reasons as for the single-transform codelets (see Makefile).
+#if defined(__AVX__)
+typedef __m256 Fourier_Lanes_t;
+#else
+typedef __m128 Fourier_Lanes_t;
+#endif
+#define FOURIER_CODELETS_DCT4_LANES
+#define FOURIER_CODELETS_DCT4T_LANES
+#include "Fourier_Codelets.h"
+
+/**************************************/
+
+//! Transpose a square block of vectors
+#if defined(__AVX__)
+static inline __attribute__((always_inline)) void Lanes_Transpose(__m256 *x) {
+	__m256 t0 = _mm256_unpacklo_ps(x[0], x[1]);
+	__m256 t1 = _mm256_unpackhi_ps(x[0], x[1]);
+	__m256 t2 = _mm256_unpacklo_ps(x[2], x[3]);
+	__m256 t3 = _mm256_unpackhi_ps(x[2], x[3]);
+	__m256 t4 = _mm256_unpacklo_ps(x[4], x[5]);
+	__m256 t5 = _mm256_unpackhi_ps(x[4], x[5]);
+	__m256 t6 = _mm256_unpacklo_ps(x[6], x[7]);
+	__m256 t7 = _mm256_unpackhi_ps(x[6], x[7]);
+	__m256 u0 = _mm256_shuffle_ps(t0, t2, 0x44);
+	__m256 u1 = _mm256_shuffle_ps(t0, t2, 0xEE);
+	__m256 u2 = _mm256_shuffle_ps(t1, t3, 0x44);
+	__m256 u3 = _mm256_shuffle_ps(t1, t3, 0xEE);
+	__m256 u4 = _mm256_shuffle_ps(t4, t6, 0x44);
+	__m256 u5 = _mm256_shuffle_ps(t4, t6, 0xEE);
+	__m256 u6 = _mm256_shuffle_ps(t5, t7, 0x44);
+	__m256 u7 = _mm256_shuffle_ps(t5, t7, 0xEE);
+	x[0] = _mm256_permute2f128_ps(u0, u4, 0x20);
+	x[1] = _mm256_permute2f128_ps(u1, u5, 0x20);
+	x[2] = _mm256_permute2f128_ps(u2, u6, 0x20);
+	x[3] = _mm256_permute2f128_ps(u3, u7, 0x20);
+	x[4] = _mm256_permute2f128_ps(u0, u4, 0x31);
+	x[5] = _mm256_permute2f128_ps(u1, u5, 0x31);
+	x[6] = _mm256_permute2f128_ps(u2, u6, 0x31);
+	x[7] = _mm256_permute2f128_ps(u3, u7, 0x31);
+}
+#else
+static inline __attribute__((always_inline)) void Lanes_Transpose(__m128 *x) {
+	_MM_TRANSPOSE4_PS(x[0], x[1], x[2], x[3]);
+}
+#endif
+
+//! Gather Src[l][0..N-1] into the lanes of x[0..N-1]
+//! NOTE: Unused lanes are cleared, so that they can't hold
+//! denormals or NaNs that would slow down the arithmetic.
+static inline __attribute__((always_inline)) void Lanes_Load(Fourier_Lanes_t *x, const float *const *Src, int N, int nLanes) {
+	int n, l;
+	for(n=0;n<N;n+=FOURIER_BATCH_LANES) {
+		Fourier_Lanes_t *y = x + n;
+#if defined(__AVX__)
+		for(l=0;l<nLanes;l++)            y[l] = _mm256_loadu_ps(Src[l] + n);
+		for(   ;l<FOURIER_BATCH_LANES;l++) y[l] = _mm256_setzero_ps();
+#else
+		for(l=0;l<nLanes;l++)            y[l] = _mm_loadu_ps(Src[l] + n);
+		for(   ;l<FOURIER_BATCH_LANES;l++) y[l] = _mm_setzero_ps();
+#endif
+		Lanes_Transpose(y);
+	}
+}
+
+//! Scatter the lanes of x[0..N-1] to Dst[l][0..N-1]
+//! NOTE: Lanes with their bit set in RevMask are stored in
+//! reverse order. x[] is trashed.
+static inline __attribute__((always_inline)) void Lanes_Store(float *const *Dst, Fourier_Lanes_t *x, int N, int nLanes, int RevMask) {
+	int n, l;
+	for(n=0;n<N;n+=FOURIER_BATCH_LANES) {
+		Fourier_Lanes_t *y = x + n;
+		Lanes_Transpose(y);
+		for(l=0;l<nLanes;l++) {
+#if defined(__AVX__)
+			if(RevMask & (1<<l)) {
+				__m256 v = _mm256_shuffle_ps(y[l], y[l], 0x1B);
+				v = _mm256_permute2f128_ps(v, v, 0x01);
+				_mm256_storeu_ps(Dst[l] + N-8 - n, v);
+			} else _mm256_storeu_ps(Dst[l] + n, y[l]);
+#else
+			if(RevMask & (1<<l)) {
+				_mm_storeu_ps(Dst[l] + N-4 - n, _mm_shuffle_ps(y[l], y[l], 0x1B));
+			} else _mm_storeu_ps(Dst[l] + n, y[l]);
+#endif
+		}
+	}
+}
+
+/**************************************/
+
+//! Lane-parallel DCT-IV
+void Fourier_DCT4_Lanes(float *const *Dst, const float *const *Src, int N, int nLanes) {
+	Fourier_Lanes_t x[FOURIER_BATCH_MAX_N];
+	Lanes_Load(x, Src, N, nLanes);
+	switch(N) {
+		case 16: DCT4_Lanes_16(x); break;
+		case 32: DCT4_Lanes_32(x); break;
+		case 64: DCT4_Lanes_64(x); break;
+	}
+	Lanes_Store(Dst, x, N, nLanes, 0);
+}
+
+//! Lane-parallel DCT-IV (transposed)
+void Fourier_DCT4T_Lanes(float *const *Dst, const float *const *Src, int N, int nLanes, int RevMask) {
+	Fourier_Lanes_t x[FOURIER_BATCH_MAX_N];
+	Lanes_Load(x, Src, N, nLanes);
+	switch(N) {
+		case 16: DCT4T_Lanes_16(x); break;
+		case 32: DCT4T_Lanes_32(x); break;
+		case 64: DCT4T_Lanes_64(x); break;
+	}
+	Lanes_Store(Dst, x, N, nLanes, RevMask);
+}
+
+/**************************************/
+#endif
+/**************************************/
+
+void Fourier_DCT4_Batch(float *Buf, float *Tmp, int N, int nBatch, int Stride) {
+#if FOURIER_BATCH_LANES > 1
+	if(N <= FOURIER_BATCH_MAX_N) {
+		int l;
+		float *Ptr[FOURIER_BATCH_LANES];
+		while(nBatch > 0) {
+			int nLanes = (nBatch < FOURIER_BATCH_LANES) ? nBatch : FOURIER_BATCH_LANES;
+			for(l=0;l<nLanes;l++) Ptr[l] = Buf, Buf += Stride;
+			Fourier_DCT4_Lanes(Ptr, (const float *const*)Ptr, N, nLanes);
+			nBatch -= nLanes;
+		}
+		return;
+	}
+#endif
+	for(;nBatch>0;nBatch--) {
+		Fourier_DCT4(Buf, Tmp, N);
+		Buf += Stride;
+	}
+}
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -0,0 +1,5667 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#pragma once
+/**************************************/
+
+//! Auto-generated by tools/GenFourierCodelets.py; do not modify
+//! Straight-line DCT kernels for N={16,32,64}.
+//! Each transform file defines FOURIER_CODELETS_<Type> before
+//! including this file to get only its own codelets.
+//! The _LANES variants operate on one transform per vector lane,
+//! and need Fourier_Lanes_t to be defined by the includer.
+//! NOTE: Built for AVX-512, GCC spreads the temporaries over
+//! xmm16..31 (EVEX encodings) and merges the outputs into
+//! unaligned 512-bit stores, which ran 20-40% slower than the
+//! AVX2 build. So the AVX-512 kernels compile the codelets as
+//! AVX2 code, kept out of line so that it isn't inlined back.
+#if defined(__AVX512F__)
+# define FOURIER_CODELET static __attribute__((noinline, target("no-avx512f")))
+#else
+# define FOURIER_CODELET static
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT2)
+/**************************************/
+
+//! DCT-II (N=16)
+FOURIER_CODELET void DCT2_16(float *x) {
+	float t0 = x[0] + x[15];
+	float t1 = x[1] + x[14];
+	float t2 = x[2] + x[13];
+	float t3 = x[3] + x[12];
+	float t4 = x[4] + x[11];
+	float t5 = x[5] + x[10];
+	float t6 = x[6] + x[9];
+	float t7 = x[7] + x[8];
+	float t8 = x[0] - x[15];
+	float t9 = x[1] - x[14];
+	float t10 = x[2] - x[13];
+	float t11 = x[3] - x[12];
+	float t12 = x[4] - x[11];
+	float t13 = x[5] - x[10];
+	float t14 = x[6] - x[9];
+	float t15 = x[7] - x[8];
+	float t16 = t0 + t7;
+	float t17 = t0 - t7;
+	float t18 = t1 + t6;
+	float t19 = t1 - t6;
+	float t20 = t2 + t5;
+	float t21 = t2 - t5;
+	float t22 = t3 + t4;
+	float t23 = t3 - t4;
+	float t24 = t16 + t22;
+	float t25 = t16 - t22;
+	float t26 = t18 + t20;
+	float t27 = t18 - t20;
+	float t28 = 0x1.A9B664p-1f*t23 + 0x1.1C73B4p-1f*t17;
+	float t29 = -0x1.1C73B4p-1f*t23 + 0x1.A9B664p-1f*t17;
+	float t30 = 0x1.F6297Cp-1f*t21 + 0x1.8F8B84p-3f*t19;
+	float t31 = -0x1.8F8B84p-3f*t21 + 0x1.F6297Cp-1f*t19;
+	float t32 = t24 + t26;
+	float t33 = t24 - t26;
+	float t34 = 0x1.87DE2Ap-2f*t27 + 0x1.D906BCp-1f*t25;
+	float t35 = -0x1.D906BCp-1f*t27 + 0x1.87DE2Ap-2f*t25;
+	float t36 = t29 + t30;
+	float t37 = t29 - t30;
+	float t38 = t28 + t31;
+	float t39 = t28 - t31;
+	float t40 = t33 * 0x1.6A09E6p-1f;
+	float t41 = t36 + t38;
+	float t42 = t41 * 0x1.6A09E6p-1f;
+	float t43 = t36 - t38;
+	float t44 = t43 * 0x1.6A09E6p-1f;
+	float t45 = 0x1.FD88DAp-1f*t8 + 0x1.917A6Cp-4f*t15;
+	float t46 = 0x1.917A6Cp-4f*t8 - 0x1.FD88DAp-1f*t15;
+	float t47 = 0x1.E9F414p-1f*t9 + 0x1.294064p-2f*t14;
+	float t48 = -0x1.294064p-2f*t9 + 0x1.E9F414p-1f*t14;
+	float t49 = 0x1.C38B3p-1f*t10 + 0x1.E2B5D4p-2f*t13;
+	float t50 = 0x1.E2B5D4p-2f*t10 - 0x1.C38B3p-1f*t13;
+	float t51 = 0x1.8BC808p-1f*t11 + 0x1.44CF32p-1f*t12;
+	float t52 = -0x1.44CF32p-1f*t11 + 0x1.8BC808p-1f*t12;
+	float t53 = t45 + t51;
+	float t54 = t45 - t51;
+	float t55 = t47 + t49;
+	float t56 = t47 - t49;
+	float t57 = t52 + t46;
+	float t58 = t52 - t46;
+	float t59 = t50 + t48;
+	float t60 = t50 - t48;
+	float t61 = t53 + t55;
+	float t62 = t53 - t55;
+	float t63 = 0x1.D906BCp-1f*t54 + 0x1.87DE2Ap-2f*t56;
+	float t64 = 0x1.87DE2Ap-2f*t54 - 0x1.D906BCp-1f*t56;
+	float t65 = t57 + t59;
+	float t66 = t57 - t59;
+	float t67 = 0x1.D906BCp-1f*t58 + 0x1.87DE2Ap-2f*t60;
+	float t68 = 0x1.87DE2Ap-2f*t58 - 0x1.D906BCp-1f*t60;
+	float t69 = t63 - t68;
+	float t70 = t63 + t68;
+	float t71 = t62 + t66;
+	float t72 = t71 * 0x1.6A09E6p-1f;
+	float t73 = t62 - t66;
+	float t74 = t73 * 0x1.6A09E6p-1f;
+	float t75 = t64 - t67;
+	float t76 = t64 + t67;
+	x[0] = t32;
+	x[1] = t61;
+	x[2] = t42;
+	x[3] = t69;
+	x[4] = t34;
+	x[5] = t70;
+	x[6] = t37;
+	x[7] = t72;
+	x[8] = t40;
+	x[9] = t74;
+	x[10] = t39;
+	x[11] = t75;
+	x[12] = t35;
+	x[13] = t76;
+	x[14] = t44;
+	x[15] = t65;
+}
+
+//! DCT-II (N=32)
+FOURIER_CODELET void DCT2_32(float *x) {
+	float t0 = x[0] + x[31];
+	float t1 = x[1] + x[30];
+	float t2 = x[2] + x[29];
+	float t3 = x[3] + x[28];
+	float t4 = x[4] + x[27];
+	float t5 = x[5] + x[26];
+	float t6 = x[6] + x[25];
+	float t7 = x[7] + x[24];
+	float t8 = x[8] + x[23];
+	float t9 = x[9] + x[22];
+	float t10 = x[10] + x[21];
+	float t11 = x[11] + x[20];
+	float t12 = x[12] + x[19];
+	float t13 = x[13] + x[18];
+	float t14 = x[14] + x[17];
+	float t15 = x[15] + x[16];
+	float t16 = x[0] - x[31];
+	float t17 = x[1] - x[30];
+	float t18 = x[2] - x[29];
+	float t19 = x[3] - x[28];
+	float t20 = x[4] - x[27];
+	float t21 = x[5] - x[26];
+	float t22 = x[6] - x[25];
+	float t23 = x[7] - x[24];
+	float t24 = x[8] - x[23];
+	float t25 = x[9] - x[22];
+	float t26 = x[10] - x[21];
+	float t27 = x[11] - x[20];
+	float t28 = x[12] - x[19];
+	float t29 = x[13] - x[18];
+	float t30 = x[14] - x[17];
+	float t31 = x[15] - x[16];
+	float t32 = t0 + t15;
+	float t33 = t1 + t14;
+	float t34 = t2 + t13;
+	float t35 = t3 + t12;
+	float t36 = t4 + t11;
+	float t37 = t5 + t10;
+	float t38 = t6 + t9;
+	float t39 = t7 + t8;
+	float t40 = t0 - t15;
+	float t41 = t1 - t14;
+	float t42 = t2 - t13;
+	float t43 = t3 - t12;
+	float t44 = t4 - t11;
+	float t45 = t5 - t10;
+	float t46 = t6 - t9;
+	float t47 = t7 - t8;
+	float t48 = t32 + t39;
+	float t49 = t32 - t39;
+	float t50 = t33 + t38;
+	float t51 = t33 - t38;
+	float t52 = t34 + t37;
+	float t53 = t34 - t37;
+	float t54 = t35 + t36;
+	float t55 = t35 - t36;
+	float t56 = t48 + t54;
+	float t57 = t48 - t54;
+	float t58 = t50 + t52;
+	float t59 = t50 - t52;
+	float t60 = 0x1.A9B664p-1f*t55 + 0x1.1C73B4p-1f*t49;
+	float t61 = -0x1.1C73B4p-1f*t55 + 0x1.A9B664p-1f*t49;
+	float t62 = 0x1.F6297Cp-1f*t53 + 0x1.8F8B84p-3f*t51;
+	float t63 = -0x1.8F8B84p-3f*t53 + 0x1.F6297Cp-1f*t51;
+	float t64 = t56 + t58;
+	float t65 = t56 - t58;
+	float t66 = 0x1.87DE2Ap-2f*t59 + 0x1.D906BCp-1f*t57;
+	float t67 = -0x1.D906BCp-1f*t59 + 0x1.87DE2Ap-2f*t57;
+	float t68 = t61 + t62;
+	float t69 = t61 - t62;
+	float t70 = t60 + t63;
+	float t71 = t60 - t63;
+	float t72 = t65 * 0x1.6A09E6p-1f;
+	float t73 = t68 + t70;
+	float t74 = t73 * 0x1.6A09E6p-1f;
+	float t75 = t68 - t70;
+	float t76 = t75 * 0x1.6A09E6p-1f;
+	float t77 = 0x1.FD88DAp-1f*t40 + 0x1.917A6Cp-4f*t47;
+	float t78 = 0x1.917A6Cp-4f*t40 - 0x1.FD88DAp-1f*t47;
+	float t79 = 0x1.E9F414p-1f*t41 + 0x1.294064p-2f*t46;
+	float t80 = -0x1.294064p-2f*t41 + 0x1.E9F414p-1f*t46;
+	float t81 = 0x1.C38B3p-1f*t42 + 0x1.E2B5D4p-2f*t45;
+	float t82 = 0x1.E2B5D4p-2f*t42 - 0x1.C38B3p-1f*t45;
+	float t83 = 0x1.8BC808p-1f*t43 + 0x1.44CF32p-1f*t44;
+	float t84 = -0x1.44CF32p-1f*t43 + 0x1.8BC808p-1f*t44;
+	float t85 = t77 + t83;
+	float t86 = t77 - t83;
+	float t87 = t79 + t81;
+	float t88 = t79 - t81;
+	float t89 = t84 + t78;
+	float t90 = t84 - t78;
+	float t91 = t82 + t80;
+	float t92 = t82 - t80;
+	float t93 = t85 + t87;
+	float t94 = t85 - t87;
+	float t95 = 0x1.D906BCp-1f*t86 + 0x1.87DE2Ap-2f*t88;
+	float t96 = 0x1.87DE2Ap-2f*t86 - 0x1.D906BCp-1f*t88;
+	float t97 = t89 + t91;
+	float t98 = t89 - t91;
+	float t99 = 0x1.D906BCp-1f*t90 + 0x1.87DE2Ap-2f*t92;
+	float t100 = 0x1.87DE2Ap-2f*t90 - 0x1.D906BCp-1f*t92;
+	float t101 = t95 - t100;
+	float t102 = t95 + t100;
+	float t103 = t94 + t98;
+	float t104 = t103 * 0x1.6A09E6p-1f;
+	float t105 = t94 - t98;
+	float t106 = t105 * 0x1.6A09E6p-1f;
+	float t107 = t96 - t99;
+	float t108 = t96 + t99;
+	float t109 = 0x1.FF621Ep-1f*t16 + 0x1.91F66p-5f*t31;
+	float t110 = 0x1.91F66p-5f*t16 - 0x1.FF621Ep-1f*t31;
+	float t111 = 0x1.FA7558p-1f*t17 + 0x1.2C8106p-3f*t30;
+	float t112 = -0x1.2C8106p-3f*t17 + 0x1.FA7558p-1f*t30;
+	float t113 = 0x1.F0A7Fp-1f*t18 + 0x1.F19F98p-3f*t29;
+	float t114 = 0x1.F19F98p-3f*t18 - 0x1.F0A7Fp-1f*t29;
+	float t115 = 0x1.E2121p-1f*t19 + 0x1.58F9A8p-2f*t28;
+	float t116 = -0x1.58F9A8p-2f*t19 + 0x1.E2121p-1f*t28;
+	float t117 = 0x1.CED7Bp-1f*t20 + 0x1.B5D1p-2f*t27;
+	float t118 = 0x1.B5D1p-2f*t20 - 0x1.CED7Bp-1f*t27;
+	float t119 = 0x1.B72834p-1f*t21 + 0x1.07387Ap-1f*t26;
+	float t120 = -0x1.07387Ap-1f*t21 + 0x1.B72834p-1f*t26;
+	float t121 = 0x1.9B3E04p-1f*t22 + 0x1.30FF8p-1f*t25;
+	float t122 = 0x1.30FF8p-1f*t22 - 0x1.9B3E04p-1f*t25;
+	float t123 = 0x1.7B5DF2p-1f*t23 + 0x1.57D694p-1f*t24;
+	float t124 = -0x1.57D694p-1f*t23 + 0x1.7B5DF2p-1f*t24;
+	float t125 = t109 + t123;
+	float t126 = t109 - t123;
+	float t127 = t111 + t121;
+	float t128 = t111 - t121;
+	float t129 = t113 + t119;
+	float t130 = t113 - t119;
+	float t131 = t115 + t117;
+	float t132 = t115 - t117;
+	float t133 = t125 + t131;
+	float t134 = t125 - t131;
+	float t135 = t127 + t129;
+	float t136 = t127 - t129;
+	float t137 = 0x1.A9B664p-1f*t132 + 0x1.1C73B4p-1f*t126;
+	float t138 = -0x1.1C73B4p-1f*t132 + 0x1.A9B664p-1f*t126;
+	float t139 = 0x1.F6297Cp-1f*t130 + 0x1.8F8B84p-3f*t128;
+	float t140 = -0x1.8F8B84p-3f*t130 + 0x1.F6297Cp-1f*t128;
+	float t141 = t133 + t135;
+	float t142 = t133 - t135;
+	float t143 = 0x1.87DE2Ap-2f*t136 + 0x1.D906BCp-1f*t134;
+	float t144 = -0x1.D906BCp-1f*t136 + 0x1.87DE2Ap-2f*t134;
+	float t145 = t138 + t139;
+	float t146 = t138 - t139;
+	float t147 = t137 + t140;
+	float t148 = t137 - t140;
+	float t149 = t142 * 0x1.6A09E6p-1f;
+	float t150 = t145 + t147;
+	float t151 = t150 * 0x1.6A09E6p-1f;
+	float t152 = t145 - t147;
+	float t153 = t152 * 0x1.6A09E6p-1f;
+	float t154 = t110 + t124;
+	float t155 = t110 - t124;
+	float t156 = t112 + t122;
+	float t157 = t112 - t122;
+	float t158 = t114 + t120;
+	float t159 = t114 - t120;
+	float t160 = t116 + t118;
+	float t161 = t116 - t118;
+	float t162 = t154 + t160;
+	float t163 = t154 - t160;
+	float t164 = t156 + t158;
+	float t165 = t156 - t158;
+	float t166 = 0x1.A9B664p-1f*t161 + 0x1.1C73B4p-1f*t155;
+	float t167 = -0x1.1C73B4p-1f*t161 + 0x1.A9B664p-1f*t155;
+	float t168 = 0x1.F6297Cp-1f*t159 + 0x1.8F8B84p-3f*t157;
+	float t169 = -0x1.8F8B84p-3f*t159 + 0x1.F6297Cp-1f*t157;
+	float t170 = t162 + t164;
+	float t171 = t162 - t164;
+	float t172 = 0x1.87DE2Ap-2f*t165 + 0x1.D906BCp-1f*t163;
+	float t173 = -0x1.D906BCp-1f*t165 + 0x1.87DE2Ap-2f*t163;
+	float t174 = t167 + t168;
+	float t175 = t167 - t168;
+	float t176 = t166 + t169;
+	float t177 = t166 - t169;
+	float t178 = t171 * 0x1.6A09E6p-1f;
+	float t179 = t174 + t176;
+	float t180 = t179 * 0x1.6A09E6p-1f;
+	float t181 = t174 - t176;
+	float t182 = t181 * 0x1.6A09E6p-1f;
+	float t183 = t151 + t182;
+	float t184 = t151 - t182;
+	float t185 = t143 + t173;
+	float t186 = t143 - t173;
+	float t187 = t146 + t177;
+	float t188 = t146 - t177;
+	float t189 = t149 + t178;
+	float t190 = t149 - t178;
+	float t191 = t148 + t175;
+	float t192 = t148 - t175;
+	float t193 = t144 + t172;
+	float t194 = t144 - t172;
+	float t195 = t153 + t180;
+	float t196 = t153 - t180;
+	x[0] = t64;
+	x[1] = t141;
+	x[2] = t93;
+	x[3] = t183;
+	x[4] = t74;
+	x[5] = t184;
+	x[6] = t101;
+	x[7] = t185;
+	x[8] = t66;
+	x[9] = t186;
+	x[10] = t102;
+	x[11] = t187;
+	x[12] = t69;
+	x[13] = t188;
+	x[14] = t104;
+	x[15] = t189;
+	x[16] = t72;
+	x[17] = t190;
+	x[18] = t106;
+	x[19] = t191;
+	x[20] = t71;
+	x[21] = t192;
+	x[22] = t107;
+	x[23] = t193;
+	x[24] = t67;
+	x[25] = t194;
+	x[26] = t108;
+	x[27] = t195;
+	x[28] = t76;
+	x[29] = t196;
+	x[30] = t97;
+	x[31] = t170;
+}
+
+//! DCT-II (N=64)
+FOURIER_CODELET void DCT2_64(float *x) {
+	float t0 = x[0] + x[63];
+	float t1 = x[1] + x[62];
+	float t2 = x[2] + x[61];
+	float t3 = x[3] + x[60];
+	float t4 = x[4] + x[59];
+	float t5 = x[5] + x[58];
+	float t6 = x[6] + x[57];
+	float t7 = x[7] + x[56];
+	float t8 = x[8] + x[55];
+	float t9 = x[9] + x[54];
+	float t10 = x[10] + x[53];
+	float t11 = x[11] + x[52];
+	float t12 = x[12] + x[51];
+	float t13 = x[13] + x[50];
+	float t14 = x[14] + x[49];
+	float t15 = x[15] + x[48];
+	float t16 = x[16] + x[47];
+	float t17 = x[17] + x[46];
+	float t18 = x[18] + x[45];
+	float t19 = x[19] + x[44];
+	float t20 = x[20] + x[43];
+	float t21 = x[21] + x[42];
+	float t22 = x[22] + x[41];
+	float t23 = x[23] + x[40];
+	float t24 = x[24] + x[39];
+	float t25 = x[25] + x[38];
+	float t26 = x[26] + x[37];
+	float t27 = x[27] + x[36];
+	float t28 = x[28] + x[35];
+	float t29 = x[29] + x[34];
+	float t30 = x[30] + x[33];
+	float t31 = x[31] + x[32];
+	float t32 = x[0] - x[63];
+	float t33 = x[1] - x[62];
+	float t34 = x[2] - x[61];
+	float t35 = x[3] - x[60];
+	float t36 = x[4] - x[59];
+	float t37 = x[5] - x[58];
+	float t38 = x[6] - x[57];
+	float t39 = x[7] - x[56];
+	float t40 = x[8] - x[55];
+	float t41 = x[9] - x[54];
+	float t42 = x[10] - x[53];
+	float t43 = x[11] - x[52];
+	float t44 = x[12] - x[51];
+	float t45 = x[13] - x[50];
+	float t46 = x[14] - x[49];
+	float t47 = x[15] - x[48];
+	float t48 = x[16] - x[47];
+	float t49 = x[17] - x[46];
+	float t50 = x[18] - x[45];
+	float t51 = x[19] - x[44];
+	float t52 = x[20] - x[43];
+	float t53 = x[21] - x[42];
+	float t54 = x[22] - x[41];
+	float t55 = x[23] - x[40];
+	float t56 = x[24] - x[39];
+	float t57 = x[25] - x[38];
+	float t58 = x[26] - x[37];
+	float t59 = x[27] - x[36];
+	float t60 = x[28] - x[35];
+	float t61 = x[29] - x[34];
+	float t62 = x[30] - x[33];
+	float t63 = x[31] - x[32];
+	float t64 = t0 + t31;
+	float t65 = t1 + t30;
+	float t66 = t2 + t29;
+	float t67 = t3 + t28;
+	float t68 = t4 + t27;
+	float t69 = t5 + t26;
+	float t70 = t6 + t25;
+	float t71 = t7 + t24;
+	float t72 = t8 + t23;
+	float t73 = t9 + t22;
+	float t74 = t10 + t21;
+	float t75 = t11 + t20;
+	float t76 = t12 + t19;
+	float t77 = t13 + t18;
+	float t78 = t14 + t17;
+	float t79 = t15 + t16;
+	float t80 = t0 - t31;
+	float t81 = t1 - t30;
+	float t82 = t2 - t29;
+	float t83 = t3 - t28;
+	float t84 = t4 - t27;
+	float t85 = t5 - t26;
+	float t86 = t6 - t25;
+	float t87 = t7 - t24;
+	float t88 = t8 - t23;
+	float t89 = t9 - t22;
+	float t90 = t10 - t21;
+	float t91 = t11 - t20;
+	float t92 = t12 - t19;
+	float t93 = t13 - t18;
+	float t94 = t14 - t17;
+	float t95 = t15 - t16;
+	float t96 = t64 + t79;
+	float t97 = t65 + t78;
+	float t98 = t66 + t77;
+	float t99 = t67 + t76;
+	float t100 = t68 + t75;
+	float t101 = t69 + t74;
+	float t102 = t70 + t73;
+	float t103 = t71 + t72;
+	float t104 = t64 - t79;
+	float t105 = t65 - t78;
+	float t106 = t66 - t77;
+	float t107 = t67 - t76;
+	float t108 = t68 - t75;
+	float t109 = t69 - t74;
+	float t110 = t70 - t73;
+	float t111 = t71 - t72;
+	float t112 = t96 + t103;
+	float t113 = t96 - t103;
+	float t114 = t97 + t102;
+	float t115 = t97 - t102;
+	float t116 = t98 + t101;
+	float t117 = t98 - t101;
+	float t118 = t99 + t100;
+	float t119 = t99 - t100;
+	float t120 = t112 + t118;
+	float t121 = t112 - t118;
+	float t122 = t114 + t116;
+	float t123 = t114 - t116;
+	float t124 = 0x1.A9B664p-1f*t119 + 0x1.1C73B4p-1f*t113;
+	float t125 = -0x1.1C73B4p-1f*t119 + 0x1.A9B664p-1f*t113;
+	float t126 = 0x1.F6297Cp-1f*t117 + 0x1.8F8B84p-3f*t115;
+	float t127 = -0x1.8F8B84p-3f*t117 + 0x1.F6297Cp-1f*t115;
+	float t128 = t120 + t122;
+	float t129 = t120 - t122;
+	float t130 = 0x1.87DE2Ap-2f*t123 + 0x1.D906BCp-1f*t121;
+	float t131 = -0x1.D906BCp-1f*t123 + 0x1.87DE2Ap-2f*t121;
+	float t132 = t125 + t126;
+	float t133 = t125 - t126;
+	float t134 = t124 + t127;
+	float t135 = t124 - t127;
+	float t136 = t129 * 0x1.6A09E6p-1f;
+	float t137 = t132 + t134;
+	float t138 = t137 * 0x1.6A09E6p-1f;
+	float t139 = t132 - t134;
+	float t140 = t139 * 0x1.6A09E6p-1f;
+	float t141 = 0x1.FD88DAp-1f*t104 + 0x1.917A6Cp-4f*t111;
+	float t142 = 0x1.917A6Cp-4f*t104 - 0x1.FD88DAp-1f*t111;
+	float t143 = 0x1.E9F414p-1f*t105 + 0x1.294064p-2f*t110;
+	float t144 = -0x1.294064p-2f*t105 + 0x1.E9F414p-1f*t110;
+	float t145 = 0x1.C38B3p-1f*t106 + 0x1.E2B5D4p-2f*t109;
+	float t146 = 0x1.E2B5D4p-2f*t106 - 0x1.C38B3p-1f*t109;
+	float t147 = 0x1.8BC808p-1f*t107 + 0x1.44CF32p-1f*t108;
+	float t148 = -0x1.44CF32p-1f*t107 + 0x1.8BC808p-1f*t108;
+	float t149 = t141 + t147;
+	float t150 = t141 - t147;
+	float t151 = t143 + t145;
+	float t152 = t143 - t145;
+	float t153 = t148 + t142;
+	float t154 = t148 - t142;
+	float t155 = t146 + t144;
+	float t156 = t146 - t144;
+	float t157 = t149 + t151;
+	float t158 = t149 - t151;
+	float t159 = 0x1.D906BCp-1f*t150 + 0x1.87DE2Ap-2f*t152;
+	float t160 = 0x1.87DE2Ap-2f*t150 - 0x1.D906BCp-1f*t152;
+	float t161 = t153 + t155;
+	float t162 = t153 - t155;
+	float t163 = 0x1.D906BCp-1f*t154 + 0x1.87DE2Ap-2f*t156;
+	float t164 = 0x1.87DE2Ap-2f*t154 - 0x1.D906BCp-1f*t156;
+	float t165 = t159 - t164;
+	float t166 = t159 + t164;
+	float t167 = t158 + t162;
+	float t168 = t167 * 0x1.6A09E6p-1f;
+	float t169 = t158 - t162;
+	float t170 = t169 * 0x1.6A09E6p-1f;
+	float t171 = t160 - t163;
+	float t172 = t160 + t163;
+	float t173 = 0x1.FF621Ep-1f*t80 + 0x1.91F66p-5f*t95;
+	float t174 = 0x1.91F66p-5f*t80 - 0x1.FF621Ep-1f*t95;
+	float t175 = 0x1.FA7558p-1f*t81 + 0x1.2C8106p-3f*t94;
+	float t176 = -0x1.2C8106p-3f*t81 + 0x1.FA7558p-1f*t94;
+	float t177 = 0x1.F0A7Fp-1f*t82 + 0x1.F19F98p-3f*t93;
+	float t178 = 0x1.F19F98p-3f*t82 - 0x1.F0A7Fp-1f*t93;
+	float t179 = 0x1.E2121p-1f*t83 + 0x1.58F9A8p-2f*t92;
+	float t180 = -0x1.58F9A8p-2f*t83 + 0x1.E2121p-1f*t92;
+	float t181 = 0x1.CED7Bp-1f*t84 + 0x1.B5D1p-2f*t91;
+	float t182 = 0x1.B5D1p-2f*t84 - 0x1.CED7Bp-1f*t91;
+	float t183 = 0x1.B72834p-1f*t85 + 0x1.07387Ap-1f*t90;
+	float t184 = -0x1.07387Ap-1f*t85 + 0x1.B72834p-1f*t90;
+	float t185 = 0x1.9B3E04p-1f*t86 + 0x1.30FF8p-1f*t89;
+	float t186 = 0x1.30FF8p-1f*t86 - 0x1.9B3E04p-1f*t89;
+	float t187 = 0x1.7B5DF2p-1f*t87 + 0x1.57D694p-1f*t88;
+	float t188 = -0x1.57D694p-1f*t87 + 0x1.7B5DF2p-1f*t88;
+	float t189 = t173 + t187;
+	float t190 = t173 - t187;
+	float t191 = t175 + t185;
+	float t192 = t175 - t185;
+	float t193 = t177 + t183;
+	float t194 = t177 - t183;
+	float t195 = t179 + t181;
+	float t196 = t179 - t181;
+	float t197 = t189 + t195;
+	float t198 = t189 - t195;
+	float t199 = t191 + t193;
+	float t200 = t191 - t193;
+	float t201 = 0x1.A9B664p-1f*t196 + 0x1.1C73B4p-1f*t190;
+	float t202 = -0x1.1C73B4p-1f*t196 + 0x1.A9B664p-1f*t190;
+	float t203 = 0x1.F6297Cp-1f*t194 + 0x1.8F8B84p-3f*t192;
+	float t204 = -0x1.8F8B84p-3f*t194 + 0x1.F6297Cp-1f*t192;
+	float t205 = t197 + t199;
+	float t206 = t197 - t199;
+	float t207 = 0x1.87DE2Ap-2f*t200 + 0x1.D906BCp-1f*t198;
+	float t208 = -0x1.D906BCp-1f*t200 + 0x1.87DE2Ap-2f*t198;
+	float t209 = t202 + t203;
+	float t210 = t202 - t203;
+	float t211 = t201 + t204;
+	float t212 = t201 - t204;
+	float t213 = t206 * 0x1.6A09E6p-1f;
+	float t214 = t209 + t211;
+	float t215 = t214 * 0x1.6A09E6p-1f;
+	float t216 = t209 - t211;
+	float t217 = t216 * 0x1.6A09E6p-1f;
+	float t218 = t174 + t188;
+	float t219 = t174 - t188;
+	float t220 = t176 + t186;
+	float t221 = t176 - t186;
+	float t222 = t178 + t184;
+	float t223 = t178 - t184;
+	float t224 = t180 + t182;
+	float t225 = t180 - t182;
+	float t226 = t218 + t224;
+	float t227 = t218 - t224;
+	float t228 = t220 + t222;
+	float t229 = t220 - t222;
+	float t230 = 0x1.A9B664p-1f*t225 + 0x1.1C73B4p-1f*t219;
+	float t231 = -0x1.1C73B4p-1f*t225 + 0x1.A9B664p-1f*t219;
+	float t232 = 0x1.F6297Cp-1f*t223 + 0x1.8F8B84p-3f*t221;
+	float t233 = -0x1.8F8B84p-3f*t223 + 0x1.F6297Cp-1f*t221;
+	float t234 = t226 + t228;
+	float t235 = t226 - t228;
+	float t236 = 0x1.87DE2Ap-2f*t229 + 0x1.D906BCp-1f*t227;
+	float t237 = -0x1.D906BCp-1f*t229 + 0x1.87DE2Ap-2f*t227;
+	float t238 = t231 + t232;
+	float t239 = t231 - t232;
+	float t240 = t230 + t233;
+	float t241 = t230 - t233;
+	float t242 = t235 * 0x1.6A09E6p-1f;
+	float t243 = t238 + t240;
+	float t244 = t243 * 0x1.6A09E6p-1f;
+	float t245 = t238 - t240;
+	float t246 = t245 * 0x1.6A09E6p-1f;
+	float t247 = t215 + t246;
+	float t248 = t215 - t246;
+	float t249 = t207 + t237;
+	float t250 = t207 - t237;
+	float t251 = t210 + t241;
+	float t252 = t210 - t241;
+	float t253 = t213 + t242;
+	float t254 = t213 - t242;
+	float t255 = t212 + t239;
+	float t256 = t212 - t239;
+	float t257 = t208 + t236;
+	float t258 = t208 - t236;
+	float t259 = t217 + t244;
+	float t260 = t217 - t244;
+	float t261 = 0x1.FFD886p-1f*t32 + 0x1.92156p-6f*t63;
+	float t262 = 0x1.92156p-6f*t32 - 0x1.FFD886p-1f*t63;
+	float t263 = 0x1.FE9CDAp-1f*t33 + 0x1.2D520Ap-4f*t62;
+	float t264 = -0x1.2D520Ap-4f*t33 + 0x1.FE9CDAp-1f*t62;
+	float t265 = 0x1.FC2648p-1f*t34 + 0x1.F564E6p-4f*t61;
+	float t266 = 0x1.F564E6p-4f*t34 - 0x1.FC2648p-1f*t61;
+	float t267 = 0x1.F8765p-1f*t35 + 0x1.5E2144p-3f*t60;
+	float t268 = -0x1.5E2144p-3f*t35 + 0x1.F8765p-1f*t60;
+	float t269 = 0x1.F38F3Ap-1f*t36 + 0x1.C0B826p-3f*t59;
+	float t270 = 0x1.C0B826p-3f*t36 - 0x1.F38F3Ap-1f*t59;
+	float t271 = 0x1.ED740Ep-1f*t37 + 0x1.111D26p-2f*t58;
+	float t272 = -0x1.111D26p-2f*t37 + 0x1.ED740Ep-1f*t58;
+	float t273 = 0x1.E6288Ep-1f*t38 + 0x1.4135CAp-2f*t57;
+	float t274 = 0x1.4135CAp-2f*t38 - 0x1.E6288Ep-1f*t57;
+	float t275 = 0x1.DDB13Cp-1f*t39 + 0x1.708854p-2f*t56;
+	float t276 = -0x1.708854p-2f*t39 + 0x1.DDB13Cp-1f*t56;
+	float t277 = 0x1.D4134Ep-1f*t40 + 0x1.9EF794p-2f*t55;
+	float t278 = 0x1.9EF794p-2f*t40 - 0x1.D4134Ep-1f*t55;
+	float t279 = 0x1.C954B2p-1f*t41 + 0x1.CC66EAp-2f*t54;
+	float t280 = -0x1.CC66EAp-2f*t41 + 0x1.C954B2p-1f*t54;
+	float t281 = 0x1.BD7C0Ap-1f*t42 + 0x1.F8BA4Ep-2f*t53;
+	float t282 = 0x1.F8BA4Ep-2f*t42 - 0x1.BD7C0Ap-1f*t53;
+	float t283 = 0x1.B090A6p-1f*t43 + 0x1.11EB36p-1f*t52;
+	float t284 = -0x1.11EB36p-1f*t43 + 0x1.B090A6p-1f*t52;
+	float t285 = 0x1.A29A7Ap-1f*t44 + 0x1.26D054p-1f*t51;
+	float t286 = 0x1.26D054p-1f*t44 - 0x1.A29A7Ap-1f*t51;
+	float t287 = 0x1.93A224p-1f*t45 + 0x1.3AFFA2p-1f*t50;
+	float t288 = -0x1.3AFFA2p-1f*t45 + 0x1.93A224p-1f*t50;
+	float t289 = 0x1.83B0Ep-1f*t46 + 0x1.4E6CACp-1f*t49;
+	float t290 = 0x1.4E6CACp-1f*t46 - 0x1.83B0Ep-1f*t49;
+	float t291 = 0x1.72D084p-1f*t47 + 0x1.610B76p-1f*t48;
+	float t292 = -0x1.610B76p-1f*t47 + 0x1.72D084p-1f*t48;
+	float t293 = t261 + t291;
+	float t294 = t263 + t289;
+	float t295 = t265 + t287;
+	float t296 = t267 + t285;
+	float t297 = t269 + t283;
+	float t298 = t271 + t281;
+	float t299 = t273 + t279;
+	float t300 = t275 + t277;
+	float t301 = t261 - t291;
+	float t302 = t263 - t289;
+	float t303 = t265 - t287;
+	float t304 = t267 - t285;
+	float t305 = t269 - t283;
+	float t306 = t271 - t281;
+	float t307 = t273 - t279;
+	float t308 = t275 - t277;
+	float t309 = t293 + t300;
+	float t310 = t293 - t300;
+	float t311 = t294 + t299;
+	float t312 = t294 - t299;
+	float t313 = t295 + t298;
+	float t314 = t295 - t298;
+	float t315 = t296 + t297;
+	float t316 = t296 - t297;
+	float t317 = t309 + t315;
+	float t318 = t309 - t315;
+	float t319 = t311 + t313;
+	float t320 = t311 - t313;
+	float t321 = 0x1.A9B664p-1f*t316 + 0x1.1C73B4p-1f*t310;
+	float t322 = -0x1.1C73B4p-1f*t316 + 0x1.A9B664p-1f*t310;
+	float t323 = 0x1.F6297Cp-1f*t314 + 0x1.8F8B84p-3f*t312;
+	float t324 = -0x1.8F8B84p-3f*t314 + 0x1.F6297Cp-1f*t312;
+	float t325 = t317 + t319;
+	float t326 = t317 - t319;
+	float t327 = 0x1.87DE2Ap-2f*t320 + 0x1.D906BCp-1f*t318;
+	float t328 = -0x1.D906BCp-1f*t320 + 0x1.87DE2Ap-2f*t318;
+	float t329 = t322 + t323;
+	float t330 = t322 - t323;
+	float t331 = t321 + t324;
+	float t332 = t321 - t324;
+	float t333 = t326 * 0x1.6A09E6p-1f;
+	float t334 = t329 + t331;
+	float t335 = t334 * 0x1.6A09E6p-1f;
+	float t336 = t329 - t331;
+	float t337 = t336 * 0x1.6A09E6p-1f;
+	float t338 = 0x1.FD88DAp-1f*t301 + 0x1.917A6Cp-4f*t308;
+	float t339 = 0x1.917A6Cp-4f*t301 - 0x1.FD88DAp-1f*t308;
+	float t340 = 0x1.E9F414p-1f*t302 + 0x1.294064p-2f*t307;
+	float t341 = -0x1.294064p-2f*t302 + 0x1.E9F414p-1f*t307;
+	float t342 = 0x1.C38B3p-1f*t303 + 0x1.E2B5D4p-2f*t306;
+	float t343 = 0x1.E2B5D4p-2f*t303 - 0x1.C38B3p-1f*t306;
+	float t344 = 0x1.8BC808p-1f*t304 + 0x1.44CF32p-1f*t305;
+	float t345 = -0x1.44CF32p-1f*t304 + 0x1.8BC808p-1f*t305;
+	float t346 = t338 + t344;
+	float t347 = t338 - t344;
+	float t348 = t340 + t342;
+	float t349 = t340 - t342;
+	float t350 = t345 + t339;
+	float t351 = t345 - t339;
+	float t352 = t343 + t341;
+	float t353 = t343 - t341;
+	float t354 = t346 + t348;
+	float t355 = t346 - t348;
+	float t356 = 0x1.D906BCp-1f*t347 + 0x1.87DE2Ap-2f*t349;
+	float t357 = 0x1.87DE2Ap-2f*t347 - 0x1.D906BCp-1f*t349;
+	float t358 = t350 + t352;
+	float t359 = t350 - t352;
+	float t360 = 0x1.D906BCp-1f*t351 + 0x1.87DE2Ap-2f*t353;
+	float t361 = 0x1.87DE2Ap-2f*t351 - 0x1.D906BCp-1f*t353;
+	float t362 = t356 - t361;
+	float t363 = t356 + t361;
+	float t364 = t355 + t359;
+	float t365 = t364 * 0x1.6A09E6p-1f;
+	float t366 = t355 - t359;
+	float t367 = t366 * 0x1.6A09E6p-1f;
+	float t368 = t357 - t360;
+	float t369 = t357 + t360;
+	float t370 = t262 + t292;
+	float t371 = t264 + t290;
+	float t372 = t266 + t288;
+	float t373 = t268 + t286;
+	float t374 = t270 + t284;
+	float t375 = t272 + t282;
+	float t376 = t274 + t280;
+	float t377 = t276 + t278;
+	float t378 = t262 - t292;
+	float t379 = t264 - t290;
+	float t380 = t266 - t288;
+	float t381 = t268 - t286;
+	float t382 = t270 - t284;
+	float t383 = t272 - t282;
+	float t384 = t274 - t280;
+	float t385 = t276 - t278;
+	float t386 = t370 + t377;
+	float t387 = t370 - t377;
+	float t388 = t371 + t376;
+	float t389 = t371 - t376;
+	float t390 = t372 + t375;
+	float t391 = t372 - t375;
+	float t392 = t373 + t374;
+	float t393 = t373 - t374;
+	float t394 = t386 + t392;
+	float t395 = t386 - t392;
+	float t396 = t388 + t390;
+	float t397 = t388 - t390;
+	float t398 = 0x1.A9B664p-1f*t393 + 0x1.1C73B4p-1f*t387;
+	float t399 = -0x1.1C73B4p-1f*t393 + 0x1.A9B664p-1f*t387;
+	float t400 = 0x1.F6297Cp-1f*t391 + 0x1.8F8B84p-3f*t389;
+	float t401 = -0x1.8F8B84p-3f*t391 + 0x1.F6297Cp-1f*t389;
+	float t402 = t394 + t396;
+	float t403 = t394 - t396;
+	float t404 = 0x1.87DE2Ap-2f*t397 + 0x1.D906BCp-1f*t395;
+	float t405 = -0x1.D906BCp-1f*t397 + 0x1.87DE2Ap-2f*t395;
+	float t406 = t399 + t400;
+	float t407 = t399 - t400;
+	float t408 = t398 + t401;
+	float t409 = t398 - t401;
+	float t410 = t403 * 0x1.6A09E6p-1f;
+	float t411 = t406 + t408;
+	float t412 = t411 * 0x1.6A09E6p-1f;
+	float t413 = t406 - t408;
+	float t414 = t413 * 0x1.6A09E6p-1f;
+	float t415 = 0x1.FD88DAp-1f*t378 + 0x1.917A6Cp-4f*t385;
+	float t416 = 0x1.917A6Cp-4f*t378 - 0x1.FD88DAp-1f*t385;
+	float t417 = 0x1.E9F414p-1f*t379 + 0x1.294064p-2f*t384;
+	float t418 = -0x1.294064p-2f*t379 + 0x1.E9F414p-1f*t384;
+	float t419 = 0x1.C38B3p-1f*t380 + 0x1.E2B5D4p-2f*t383;
+	float t420 = 0x1.E2B5D4p-2f*t380 - 0x1.C38B3p-1f*t383;
+	float t421 = 0x1.8BC808p-1f*t381 + 0x1.44CF32p-1f*t382;
+	float t422 = -0x1.44CF32p-1f*t381 + 0x1.8BC808p-1f*t382;
+	float t423 = t415 + t421;
+	float t424 = t415 - t421;
+	float t425 = t417 + t419;
+	float t426 = t417 - t419;
+	float t427 = t422 + t416;
+	float t428 = t422 - t416;
+	float t429 = t420 + t418;
+	float t430 = t420 - t418;
+	float t431 = t423 + t425;
+	float t432 = t423 - t425;
+	float t433 = 0x1.D906BCp-1f*t424 + 0x1.87DE2Ap-2f*t426;
+	float t434 = 0x1.87DE2Ap-2f*t424 - 0x1.D906BCp-1f*t426;
+	float t435 = t427 + t429;
+	float t436 = t427 - t429;
+	float t437 = 0x1.D906BCp-1f*t428 + 0x1.87DE2Ap-2f*t430;
+	float t438 = 0x1.87DE2Ap-2f*t428 - 0x1.D906BCp-1f*t430;
+	float t439 = t433 - t438;
+	float t440 = t433 + t438;
+	float t441 = t432 + t436;
+	float t442 = t441 * 0x1.6A09E6p-1f;
+	float t443 = t432 - t436;
+	float t444 = t443 * 0x1.6A09E6p-1f;
+	float t445 = t434 - t437;
+	float t446 = t434 + t437;
+	float t447 = t354 + t435;
+	float t448 = t354 - t435;
+	float t449 = t335 + t414;
+	float t450 = t335 - t414;
+	float t451 = t362 + t446;
+	float t452 = t362 - t446;
+	float t453 = t327 + t405;
+	float t454 = t327 - t405;
+	float t455 = t363 + t445;
+	float t456 = t363 - t445;
+	float t457 = t330 + t409;
+	float t458 = t330 - t409;
+	float t459 = t365 + t444;
+	float t460 = t365 - t444;
+	float t461 = t333 + t410;
+	float t462 = t333 - t410;
+	float t463 = t367 + t442;
+	float t464 = t367 - t442;
+	float t465 = t332 + t407;
+	float t466 = t332 - t407;
+	float t467 = t368 + t440;
+	float t468 = t368 - t440;
+	float t469 = t328 + t404;
+	float t470 = t328 - t404;
+	float t471 = t369 + t439;
+	float t472 = t369 - t439;
+	float t473 = t337 + t412;
+	float t474 = t337 - t412;
+	float t475 = t358 + t431;
+	float t476 = t358 - t431;
+	x[0] = t128;
+	x[1] = t325;
+	x[2] = t205;
+	x[3] = t447;
+	x[4] = t157;
+	x[5] = t448;
+	x[6] = t247;
+	x[7] = t449;
+	x[8] = t138;
+	x[9] = t450;
+	x[10] = t248;
+	x[11] = t451;
+	x[12] = t165;
+	x[13] = t452;
+	x[14] = t249;
+	x[15] = t453;
+	x[16] = t130;
+	x[17] = t454;
+	x[18] = t250;
+	x[19] = t455;
+	x[20] = t166;
+	x[21] = t456;
+	x[22] = t251;
+	x[23] = t457;
+	x[24] = t133;
+	x[25] = t458;
+	x[26] = t252;
+	x[27] = t459;
+	x[28] = t168;
+	x[29] = t460;
+	x[30] = t253;
+	x[31] = t461;
+	x[32] = t136;
+	x[33] = t462;
+	x[34] = t254;
+	x[35] = t463;
+	x[36] = t170;
+	x[37] = t464;
+	x[38] = t255;
+	x[39] = t465;
+	x[40] = t135;
+	x[41] = t466;
+	x[42] = t256;
+	x[43] = t467;
+	x[44] = t171;
+	x[45] = t468;
+	x[46] = t257;
+	x[47] = t469;
+	x[48] = t131;
+	x[49] = t470;
+	x[50] = t258;
+	x[51] = t471;
+	x[52] = t172;
+	x[53] = t472;
+	x[54] = t259;
+	x[55] = t473;
+	x[56] = t140;
+	x[57] = t474;
+	x[58] = t260;
+	x[59] = t475;
+	x[60] = t161;
+	x[61] = t476;
+	x[62] = t234;
+	x[63] = t402;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT3)
+/**************************************/
+
+//! DCT-III (N=16)
+FOURIER_CODELET void DCT3_16(float *x) {
+	float t0 = x[8] * 0x1.6A09E6p-1f;
+	float t1 = x[2] + x[14];
+	float t2 = t1 * 0x1.6A09E6p-1f;
+	float t3 = x[2] - x[14];
+	float t4 = t3 * 0x1.6A09E6p-1f;
+	float t5 = x[0] * 0.5f;
+	float t6 = t5 + t0;
+	float t7 = t5 - t0;
+	float t8 = 0x1.87DE2Ap-2f*x[4] - 0x1.D906BCp-1f*x[12];
+	float t9 = 0x1.D906BCp-1f*x[4] + 0x1.87DE2Ap-2f*x[12];
+	float t10 = t2 + x[6];
+	float t11 = t2 - x[6];
+	float t12 = t4 + x[10];
+	float t13 = t4 - x[10];
+	float t14 = t6 + t9;
+	float t15 = t6 - t9;
+	float t16 = t7 + t8;
+	float t17 = t7 - t8;
+	float t18 = 0x1.A9B664p-1f*t12 - 0x1.1C73B4p-1f*t10;
+	float t19 = 0x1.1C73B4p-1f*t12 + 0x1.A9B664p-1f*t10;
+	float t20 = 0x1.F6297Cp-1f*t11 - 0x1.8F8B84p-3f*t13;
+	float t21 = 0x1.8F8B84p-3f*t11 + 0x1.F6297Cp-1f*t13;
+	float t22 = t14 + t19;
+	float t23 = t14 - t19;
+	float t24 = t16 + t21;
+	float t25 = t16 - t21;
+	float t26 = t17 + t20;
+	float t27 = t17 - t20;
+	float t28 = t15 + t18;
+	float t29 = t15 - t18;
+	float t30 = x[5] + x[3];
+	float t31 = x[5] - x[3];
+	float t32 = x[7] + x[9];
+	float t33 = t32 * 0x1.6A09E6p-1f;
+	float t34 = x[7] - x[9];
+	float t35 = t34 * 0x1.6A09E6p-1f;
+	float t36 = x[13] + x[11];
+	float t37 = x[13] - x[11];
+	float t38 = x[1] + t33;
+	float t39 = x[1] - t33;
+	float t40 = 0x1.D906BCp-1f*t30 + 0x1.87DE2Ap-2f*t36;
+	float t41 = 0x1.87DE2Ap-2f*t30 - 0x1.D906BCp-1f*t36;
+	float t42 = x[15] + t35;
+	float t43 = x[15] - t35;
+	float t44 = 0x1.D906BCp-1f*t37 + 0x1.87DE2Ap-2f*t31;
+	float t45 = 0x1.87DE2Ap-2f*t37 - 0x1.D906BCp-1f*t31;
+	float t46 = t38 + t40;
+	float t47 = t38 - t40;
+	float t48 = t39 + t41;
+	float t49 = t39 - t41;
+	float t50 = t42 + t44;
+	float t51 = t42 - t44;
+	float t52 = t43 + t45;
+	float t53 = t43 - t45;
+	float t54 = 0x1.FD88DAp-1f*t46 + 0x1.917A6Cp-4f*t51;
+	float t55 = 0x1.917A6Cp-4f*t46 - 0x1.FD88DAp-1f*t51;
+	float t56 = 0x1.E9F414p-1f*t48 - 0x1.294064p-2f*t53;
+	float t57 = 0x1.294064p-2f*t48 + 0x1.E9F414p-1f*t53;
+	float t58 = 0x1.C38B3p-1f*t49 + 0x1.E2B5D4p-2f*t52;
+	float t59 = 0x1.E2B5D4p-2f*t49 - 0x1.C38B3p-1f*t52;
+	float t60 = 0x1.8BC808p-1f*t47 - 0x1.44CF32p-1f*t50;
+	float t61 = 0x1.44CF32p-1f*t47 + 0x1.8BC808p-1f*t50;
+	float t62 = t22 + t54;
+	float t63 = t22 - t54;
+	float t64 = t24 + t56;
+	float t65 = t24 - t56;
+	float t66 = t26 + t58;
+	float t67 = t26 - t58;
+	float t68 = t28 + t60;
+	float t69 = t28 - t60;
+	float t70 = t29 + t61;
+	float t71 = t29 - t61;
+	float t72 = t27 + t59;
+	float t73 = t27 - t59;
+	float t74 = t25 + t57;
+	float t75 = t25 - t57;
+	float t76 = t23 + t55;
+	float t77 = t23 - t55;
+	x[0] = t62;
+	x[1] = t64;
+	x[2] = t66;
+	x[3] = t68;
+	x[4] = t70;
+	x[5] = t72;
+	x[6] = t74;
+	x[7] = t76;
+	x[8] = t77;
+	x[9] = t75;
+	x[10] = t73;
+	x[11] = t71;
+	x[12] = t69;
+	x[13] = t67;
+	x[14] = t65;
+	x[15] = t63;
+}
+
+//! DCT-III (N=32)
+FOURIER_CODELET void DCT3_32(float *x) {
+	float t0 = x[16] * 0x1.6A09E6p-1f;
+	float t1 = x[4] + x[28];
+	float t2 = t1 * 0x1.6A09E6p-1f;
+	float t3 = x[4] - x[28];
+	float t4 = t3 * 0x1.6A09E6p-1f;
+	float t5 = x[0] * 0.5f;
+	float t6 = t5 + t0;
+	float t7 = t5 - t0;
+	float t8 = 0x1.87DE2Ap-2f*x[8] - 0x1.D906BCp-1f*x[24];
+	float t9 = 0x1.D906BCp-1f*x[8] + 0x1.87DE2Ap-2f*x[24];
+	float t10 = t2 + x[12];
+	float t11 = t2 - x[12];
+	float t12 = t4 + x[20];
+	float t13 = t4 - x[20];
+	float t14 = t6 + t9;
+	float t15 = t6 - t9;
+	float t16 = t7 + t8;
+	float t17 = t7 - t8;
+	float t18 = 0x1.A9B664p-1f*t12 - 0x1.1C73B4p-1f*t10;
+	float t19 = 0x1.1C73B4p-1f*t12 + 0x1.A9B664p-1f*t10;
+	float t20 = 0x1.F6297Cp-1f*t11 - 0x1.8F8B84p-3f*t13;
+	float t21 = 0x1.8F8B84p-3f*t11 + 0x1.F6297Cp-1f*t13;
+	float t22 = t14 + t19;
+	float t23 = t14 - t19;
+	float t24 = t16 + t21;
+	float t25 = t16 - t21;
+	float t26 = t17 + t20;
+	float t27 = t17 - t20;
+	float t28 = t15 + t18;
+	float t29 = t15 - t18;
+	float t30 = x[10] + x[6];
+	float t31 = x[10] - x[6];
+	float t32 = x[14] + x[18];
+	float t33 = t32 * 0x1.6A09E6p-1f;
+	float t34 = x[14] - x[18];
+	float t35 = t34 * 0x1.6A09E6p-1f;
+	float t36 = x[26] + x[22];
+	float t37 = x[26] - x[22];
+	float t38 = x[2] + t33;
+	float t39 = x[2] - t33;
+	float t40 = 0x1.D906BCp-1f*t30 + 0x1.87DE2Ap-2f*t36;
+	float t41 = 0x1.87DE2Ap-2f*t30 - 0x1.D906BCp-1f*t36;
+	float t42 = x[30] + t35;
+	float t43 = x[30] - t35;
+	float t44 = 0x1.D906BCp-1f*t37 + 0x1.87DE2Ap-2f*t31;
+	float t45 = 0x1.87DE2Ap-2f*t37 - 0x1.D906BCp-1f*t31;
+	float t46 = t38 + t40;
+	float t47 = t38 - t40;
+	float t48 = t39 + t41;
+	float t49 = t39 - t41;
+	float t50 = t42 + t44;
+	float t51 = t42 - t44;
+	float t52 = t43 + t45;
+	float t53 = t43 - t45;
+	float t54 = 0x1.FD88DAp-1f*t46 + 0x1.917A6Cp-4f*t51;
+	float t55 = 0x1.917A6Cp-4f*t46 - 0x1.FD88DAp-1f*t51;
+	float t56 = 0x1.E9F414p-1f*t48 - 0x1.294064p-2f*t53;
+	float t57 = 0x1.294064p-2f*t48 + 0x1.E9F414p-1f*t53;
+	float t58 = 0x1.C38B3p-1f*t49 + 0x1.E2B5D4p-2f*t52;
+	float t59 = 0x1.E2B5D4p-2f*t49 - 0x1.C38B3p-1f*t52;
+	float t60 = 0x1.8BC808p-1f*t47 - 0x1.44CF32p-1f*t50;
+	float t61 = 0x1.44CF32p-1f*t47 + 0x1.8BC808p-1f*t50;
+	float t62 = t22 + t54;
+	float t63 = t22 - t54;
+	float t64 = t24 + t56;
+	float t65 = t24 - t56;
+	float t66 = t26 + t58;
+	float t67 = t26 - t58;
+	float t68 = t28 + t60;
+	float t69 = t28 - t60;
+	float t70 = t29 + t61;
+	float t71 = t29 - t61;
+	float t72 = t27 + t59;
+	float t73 = t27 - t59;
+	float t74 = t25 + t57;
+	float t75 = t25 - t57;
+	float t76 = t23 + t55;
+	float t77 = t23 - t55;
+	float t78 = x[1] * 2.0f;
+	float t79 = x[3] + x[5];
+	float t80 = x[3] - x[5];
+	float t81 = x[7] + x[9];
+	float t82 = x[7] - x[9];
+	float t83 = x[11] + x[13];
+	float t84 = x[11] - x[13];
+	float t85 = x[15] + x[17];
+	float t86 = x[15] - x[17];
+	float t87 = x[19] + x[21];
+	float t88 = x[19] - x[21];
+	float t89 = x[23] + x[25];
+	float t90 = x[23] - x[25];
+	float t91 = x[27] + x[29];
+	float t92 = x[27] - x[29];
+	float t93 = x[31] * 2.0f;
+	float t94 = t85 * 0x1.6A09E6p-1f;
+	float t95 = t79 + t91;
+	float t96 = t95 * 0x1.6A09E6p-1f;
+	float t97 = t79 - t91;
+	float t98 = t97 * 0x1.6A09E6p-1f;
+	float t99 = t78 * 0.5f;
+	float t100 = t99 + t94;
+	float t101 = t99 - t94;
+	float t102 = 0x1.87DE2Ap-2f*t81 - 0x1.D906BCp-1f*t89;
+	float t103 = 0x1.D906BCp-1f*t81 + 0x1.87DE2Ap-2f*t89;
+	float t104 = t96 + t83;
+	float t105 = t96 - t83;
+	float t106 = t98 + t87;
+	float t107 = t98 - t87;
+	float t108 = t100 + t103;
+	float t109 = t100 - t103;
+	float t110 = t101 + t102;
+	float t111 = t101 - t102;
+	float t112 = 0x1.A9B664p-1f*t106 - 0x1.1C73B4p-1f*t104;
+	float t113 = 0x1.1C73B4p-1f*t106 + 0x1.A9B664p-1f*t104;
+	float t114 = 0x1.F6297Cp-1f*t105 - 0x1.8F8B84p-3f*t107;
+	float t115 = 0x1.8F8B84p-3f*t105 + 0x1.F6297Cp-1f*t107;
+	float t116 = t108 + t113;
+	float t117 = t108 - t113;
+	float t118 = t110 + t115;
+	float t119 = t110 - t115;
+	float t120 = t111 + t114;
+	float t121 = t111 - t114;
+	float t122 = t109 + t112;
+	float t123 = t109 - t112;
+	float t124 = t86 * 0x1.6A09E6p-1f;
+	float t125 = t92 + t80;
+	float t126 = t125 * 0x1.6A09E6p-1f;
+	float t127 = t92 - t80;
+	float t128 = t127 * 0x1.6A09E6p-1f;
+	float t129 = t93 * 0.5f;
+	float t130 = t129 + t124;
+	float t131 = t129 - t124;
+	float t132 = 0x1.87DE2Ap-2f*t90 - 0x1.D906BCp-1f*t82;
+	float t133 = 0x1.D906BCp-1f*t90 + 0x1.87DE2Ap-2f*t82;
+	float t134 = t126 + t88;
+	float t135 = t126 - t88;
+	float t136 = t128 + t84;
+	float t137 = t128 - t84;
+	float t138 = t130 + t133;
+	float t139 = t130 - t133;
+	float t140 = t131 + t132;
+	float t141 = t131 - t132;
+	float t142 = 0x1.A9B664p-1f*t136 - 0x1.1C73B4p-1f*t134;
+	float t143 = 0x1.1C73B4p-1f*t136 + 0x1.A9B664p-1f*t134;
+	float t144 = 0x1.F6297Cp-1f*t135 - 0x1.8F8B84p-3f*t137;
+	float t145 = 0x1.8F8B84p-3f*t135 + 0x1.F6297Cp-1f*t137;
+	float t146 = t138 + t143;
+	float t147 = t138 - t143;
+	float t148 = t140 + t145;
+	float t149 = t140 - t145;
+	float t150 = t141 + t144;
+	float t151 = t141 - t144;
+	float t152 = t139 + t142;
+	float t153 = t139 - t142;
+	float t154 = 0x1.FF621Ep-1f*t116 + 0x1.91F66p-5f*t146;
+	float t155 = 0x1.91F66p-5f*t116 - 0x1.FF621Ep-1f*t146;
+	float t156 = 0x1.FA7558p-1f*t118 - 0x1.2C8106p-3f*t148;
+	float t157 = 0x1.2C8106p-3f*t118 + 0x1.FA7558p-1f*t148;
+	float t158 = 0x1.F0A7Fp-1f*t120 + 0x1.F19F98p-3f*t150;
+	float t159 = 0x1.F19F98p-3f*t120 - 0x1.F0A7Fp-1f*t150;
+	float t160 = 0x1.E2121p-1f*t122 - 0x1.58F9A8p-2f*t152;
+	float t161 = 0x1.58F9A8p-2f*t122 + 0x1.E2121p-1f*t152;
+	float t162 = 0x1.CED7Bp-1f*t123 + 0x1.B5D1p-2f*t153;
+	float t163 = 0x1.B5D1p-2f*t123 - 0x1.CED7Bp-1f*t153;
+	float t164 = 0x1.B72834p-1f*t121 - 0x1.07387Ap-1f*t151;
+	float t165 = 0x1.07387Ap-1f*t121 + 0x1.B72834p-1f*t151;
+	float t166 = 0x1.9B3E04p-1f*t119 + 0x1.30FF8p-1f*t149;
+	float t167 = 0x1.30FF8p-1f*t119 - 0x1.9B3E04p-1f*t149;
+	float t168 = 0x1.7B5DF2p-1f*t117 - 0x1.57D694p-1f*t147;
+	float t169 = 0x1.57D694p-1f*t117 + 0x1.7B5DF2p-1f*t147;
+	float t170 = t62 + t154;
+	float t171 = t62 - t154;
+	float t172 = t64 + t156;
+	float t173 = t64 - t156;
+	float t174 = t66 + t158;
+	float t175 = t66 - t158;
+	float t176 = t68 + t160;
+	float t177 = t68 - t160;
+	float t178 = t70 + t162;
+	float t179 = t70 - t162;
+	float t180 = t72 + t164;
+	float t181 = t72 - t164;
+	float t182 = t74 + t166;
+	float t183 = t74 - t166;
+	float t184 = t76 + t168;
+	float t185 = t76 - t168;
+	float t186 = t77 + t169;
+	float t187 = t77 - t169;
+	float t188 = t75 + t167;
+	float t189 = t75 - t167;
+	float t190 = t73 + t165;
+	float t191 = t73 - t165;
+	float t192 = t71 + t163;
+	float t193 = t71 - t163;
+	float t194 = t69 + t161;
+	float t195 = t69 - t161;
+	float t196 = t67 + t159;
+	float t197 = t67 - t159;
+	float t198 = t65 + t157;
+	float t199 = t65 - t157;
+	float t200 = t63 + t155;
+	float t201 = t63 - t155;
+	x[0] = t170;
+	x[1] = t172;
+	x[2] = t174;
+	x[3] = t176;
+	x[4] = t178;
+	x[5] = t180;
+	x[6] = t182;
+	x[7] = t184;
+	x[8] = t186;
+	x[9] = t188;
+	x[10] = t190;
+	x[11] = t192;
+	x[12] = t194;
+	x[13] = t196;
+	x[14] = t198;
+	x[15] = t200;
+	x[16] = t201;
+	x[17] = t199;
+	x[18] = t197;
+	x[19] = t195;
+	x[20] = t193;
+	x[21] = t191;
+	x[22] = t189;
+	x[23] = t187;
+	x[24] = t185;
+	x[25] = t183;
+	x[26] = t181;
+	x[27] = t179;
+	x[28] = t177;
+	x[29] = t175;
+	x[30] = t173;
+	x[31] = t171;
+}
+
+//! DCT-III (N=64)
+FOURIER_CODELET void DCT3_64(float *x) {
+	float t0 = x[32] * 0x1.6A09E6p-1f;
+	float t1 = x[8] + x[56];
+	float t2 = t1 * 0x1.6A09E6p-1f;
+	float t3 = x[8] - x[56];
+	float t4 = t3 * 0x1.6A09E6p-1f;
+	float t5 = x[0] * 0.5f;
+	float t6 = t5 + t0;
+	float t7 = t5 - t0;
+	float t8 = 0x1.87DE2Ap-2f*x[16] - 0x1.D906BCp-1f*x[48];
+	float t9 = 0x1.D906BCp-1f*x[16] + 0x1.87DE2Ap-2f*x[48];
+	float t10 = t2 + x[24];
+	float t11 = t2 - x[24];
+	float t12 = t4 + x[40];
+	float t13 = t4 - x[40];
+	float t14 = t6 + t9;
+	float t15 = t6 - t9;
+	float t16 = t7 + t8;
+	float t17 = t7 - t8;
+	float t18 = 0x1.A9B664p-1f*t12 - 0x1.1C73B4p-1f*t10;
+	float t19 = 0x1.1C73B4p-1f*t12 + 0x1.A9B664p-1f*t10;
+	float t20 = 0x1.F6297Cp-1f*t11 - 0x1.8F8B84p-3f*t13;
+	float t21 = 0x1.8F8B84p-3f*t11 + 0x1.F6297Cp-1f*t13;
+	float t22 = t14 + t19;
+	float t23 = t14 - t19;
+	float t24 = t16 + t21;
+	float t25 = t16 - t21;
+	float t26 = t17 + t20;
+	float t27 = t17 - t20;
+	float t28 = t15 + t18;
+	float t29 = t15 - t18;
+	float t30 = x[20] + x[12];
+	float t31 = x[20] - x[12];
+	float t32 = x[28] + x[36];
+	float t33 = t32 * 0x1.6A09E6p-1f;
+	float t34 = x[28] - x[36];
+	float t35 = t34 * 0x1.6A09E6p-1f;
+	float t36 = x[52] + x[44];
+	float t37 = x[52] - x[44];
+	float t38 = x[4] + t33;
+	float t39 = x[4] - t33;
+	float t40 = 0x1.D906BCp-1f*t30 + 0x1.87DE2Ap-2f*t36;
+	float t41 = 0x1.87DE2Ap-2f*t30 - 0x1.D906BCp-1f*t36;
+	float t42 = x[60] + t35;
+	float t43 = x[60] - t35;
+	float t44 = 0x1.D906BCp-1f*t37 + 0x1.87DE2Ap-2f*t31;
+	float t45 = 0x1.87DE2Ap-2f*t37 - 0x1.D906BCp-1f*t31;
+	float t46 = t38 + t40;
+	float t47 = t38 - t40;
+	float t48 = t39 + t41;
+	float t49 = t39 - t41;
+	float t50 = t42 + t44;
+	float t51 = t42 - t44;
+	float t52 = t43 + t45;
+	float t53 = t43 - t45;
+	float t54 = 0x1.FD88DAp-1f*t46 + 0x1.917A6Cp-4f*t51;
+	float t55 = 0x1.917A6Cp-4f*t46 - 0x1.FD88DAp-1f*t51;
+	float t56 = 0x1.E9F414p-1f*t48 - 0x1.294064p-2f*t53;
+	float t57 = 0x1.294064p-2f*t48 + 0x1.E9F414p-1f*t53;
+	float t58 = 0x1.C38B3p-1f*t49 + 0x1.E2B5D4p-2f*t52;
+	float t59 = 0x1.E2B5D4p-2f*t49 - 0x1.C38B3p-1f*t52;
+	float t60 = 0x1.8BC808p-1f*t47 - 0x1.44CF32p-1f*t50;
+	float t61 = 0x1.44CF32p-1f*t47 + 0x1.8BC808p-1f*t50;
+	float t62 = t22 + t54;
+	float t63 = t22 - t54;
+	float t64 = t24 + t56;
+	float t65 = t24 - t56;
+	float t66 = t26 + t58;
+	float t67 = t26 - t58;
+	float t68 = t28 + t60;
+	float t69 = t28 - t60;
+	float t70 = t29 + t61;
+	float t71 = t29 - t61;
+	float t72 = t27 + t59;
+	float t73 = t27 - t59;
+	float t74 = t25 + t57;
+	float t75 = t25 - t57;
+	float t76 = t23 + t55;
+	float t77 = t23 - t55;
+	float t78 = x[2] * 2.0f;
+	float t79 = x[6] + x[10];
+	float t80 = x[6] - x[10];
+	float t81 = x[14] + x[18];
+	float t82 = x[14] - x[18];
+	float t83 = x[22] + x[26];
+	float t84 = x[22] - x[26];
+	float t85 = x[30] + x[34];
+	float t86 = x[30] - x[34];
+	float t87 = x[38] + x[42];
+	float t88 = x[38] - x[42];
+	float t89 = x[46] + x[50];
+	float t90 = x[46] - x[50];
+	float t91 = x[54] + x[58];
+	float t92 = x[54] - x[58];
+	float t93 = x[62] * 2.0f;
+	float t94 = t85 * 0x1.6A09E6p-1f;
+	float t95 = t79 + t91;
+	float t96 = t95 * 0x1.6A09E6p-1f;
+	float t97 = t79 - t91;
+	float t98 = t97 * 0x1.6A09E6p-1f;
+	float t99 = t78 * 0.5f;
+	float t100 = t99 + t94;
+	float t101 = t99 - t94;
+	float t102 = 0x1.87DE2Ap-2f*t81 - 0x1.D906BCp-1f*t89;
+	float t103 = 0x1.D906BCp-1f*t81 + 0x1.87DE2Ap-2f*t89;
+	float t104 = t96 + t83;
+	float t105 = t96 - t83;
+	float t106 = t98 + t87;
+	float t107 = t98 - t87;
+	float t108 = t100 + t103;
+	float t109 = t100 - t103;
+	float t110 = t101 + t102;
+	float t111 = t101 - t102;
+	float t112 = 0x1.A9B664p-1f*t106 - 0x1.1C73B4p-1f*t104;
+	float t113 = 0x1.1C73B4p-1f*t106 + 0x1.A9B664p-1f*t104;
+	float t114 = 0x1.F6297Cp-1f*t105 - 0x1.8F8B84p-3f*t107;
+	float t115 = 0x1.8F8B84p-3f*t105 + 0x1.F6297Cp-1f*t107;
+	float t116 = t108 + t113;
+	float t117 = t108 - t113;
+	float t118 = t110 + t115;
+	float t119 = t110 - t115;
+	float t120 = t111 + t114;
+	float t121 = t111 - t114;
+	float t122 = t109 + t112;
+	float t123 = t109 - t112;
+	float t124 = t86 * 0x1.6A09E6p-1f;
+	float t125 = t92 + t80;
+	float t126 = t125 * 0x1.6A09E6p-1f;
+	float t127 = t92 - t80;
+	float t128 = t127 * 0x1.6A09E6p-1f;
+	float t129 = t93 * 0.5f;
+	float t130 = t129 + t124;
+	float t131 = t129 - t124;
+	float t132 = 0x1.87DE2Ap-2f*t90 - 0x1.D906BCp-1f*t82;
+	float t133 = 0x1.D906BCp-1f*t90 + 0x1.87DE2Ap-2f*t82;
+	float t134 = t126 + t88;
+	float t135 = t126 - t88;
+	float t136 = t128 + t84;
+	float t137 = t128 - t84;
+	float t138 = t130 + t133;
+	float t139 = t130 - t133;
+	float t140 = t131 + t132;
+	float t141 = t131 - t132;
+	float t142 = 0x1.A9B664p-1f*t136 - 0x1.1C73B4p-1f*t134;
+	float t143 = 0x1.1C73B4p-1f*t136 + 0x1.A9B664p-1f*t134;
+	float t144 = 0x1.F6297Cp-1f*t135 - 0x1.8F8B84p-3f*t137;
+	float t145 = 0x1.8F8B84p-3f*t135 + 0x1.F6297Cp-1f*t137;
+	float t146 = t138 + t143;
+	float t147 = t138 - t143;
+	float t148 = t140 + t145;
+	float t149 = t140 - t145;
+	float t150 = t141 + t144;
+	float t151 = t141 - t144;
+	float t152 = t139 + t142;
+	float t153 = t139 - t142;
+	float t154 = 0x1.FF621Ep-1f*t116 + 0x1.91F66p-5f*t146;
+	float t155 = 0x1.91F66p-5f*t116 - 0x1.FF621Ep-1f*t146;
+	float t156 = 0x1.FA7558p-1f*t118 - 0x1.2C8106p-3f*t148;
+	float t157 = 0x1.2C8106p-3f*t118 + 0x1.FA7558p-1f*t148;
+	float t158 = 0x1.F0A7Fp-1f*t120 + 0x1.F19F98p-3f*t150;
+	float t159 = 0x1.F19F98p-3f*t120 - 0x1.F0A7Fp-1f*t150;
+	float t160 = 0x1.E2121p-1f*t122 - 0x1.58F9A8p-2f*t152;
+	float t161 = 0x1.58F9A8p-2f*t122 + 0x1.E2121p-1f*t152;
+	float t162 = 0x1.CED7Bp-1f*t123 + 0x1.B5D1p-2f*t153;
+	float t163 = 0x1.B5D1p-2f*t123 - 0x1.CED7Bp-1f*t153;
+	float t164 = 0x1.B72834p-1f*t121 - 0x1.07387Ap-1f*t151;
+	float t165 = 0x1.07387Ap-1f*t121 + 0x1.B72834p-1f*t151;
+	float t166 = 0x1.9B3E04p-1f*t119 + 0x1.30FF8p-1f*t149;
+	float t167 = 0x1.30FF8p-1f*t119 - 0x1.9B3E04p-1f*t149;
+	float t168 = 0x1.7B5DF2p-1f*t117 - 0x1.57D694p-1f*t147;
+	float t169 = 0x1.57D694p-1f*t117 + 0x1.7B5DF2p-1f*t147;
+	float t170 = t62 + t154;
+	float t171 = t62 - t154;
+	float t172 = t64 + t156;
+	float t173 = t64 - t156;
+	float t174 = t66 + t158;
+	float t175 = t66 - t158;
+	float t176 = t68 + t160;
+	float t177 = t68 - t160;
+	float t178 = t70 + t162;
+	float t179 = t70 - t162;
+	float t180 = t72 + t164;
+	float t181 = t72 - t164;
+	float t182 = t74 + t166;
+	float t183 = t74 - t166;
+	float t184 = t76 + t168;
+	float t185 = t76 - t168;
+	float t186 = t77 + t169;
+	float t187 = t77 - t169;
+	float t188 = t75 + t167;
+	float t189 = t75 - t167;
+	float t190 = t73 + t165;
+	float t191 = t73 - t165;
+	float t192 = t71 + t163;
+	float t193 = t71 - t163;
+	float t194 = t69 + t161;
+	float t195 = t69 - t161;
+	float t196 = t67 + t159;
+	float t197 = t67 - t159;
+	float t198 = t65 + t157;
+	float t199 = t65 - t157;
+	float t200 = t63 + t155;
+	float t201 = t63 - t155;
+	float t202 = x[1] * 2.0f;
+	float t203 = x[3] + x[5];
+	float t204 = x[3] - x[5];
+	float t205 = x[7] + x[9];
+	float t206 = x[7] - x[9];
+	float t207 = x[11] + x[13];
+	float t208 = x[11] - x[13];
+	float t209 = x[15] + x[17];
+	float t210 = x[15] - x[17];
+	float t211 = x[19] + x[21];
+	float t212 = x[19] - x[21];
+	float t213 = x[23] + x[25];
+	float t214 = x[23] - x[25];
+	float t215 = x[27] + x[29];
+	float t216 = x[27] - x[29];
+	float t217 = x[31] + x[33];
+	float t218 = x[31] - x[33];
+	float t219 = x[35] + x[37];
+	float t220 = x[35] - x[37];
+	float t221 = x[39] + x[41];
+	float t222 = x[39] - x[41];
+	float t223 = x[43] + x[45];
+	float t224 = x[43] - x[45];
+	float t225 = x[47] + x[49];
+	float t226 = x[47] - x[49];
+	float t227 = x[51] + x[53];
+	float t228 = x[51] - x[53];
+	float t229 = x[55] + x[57];
+	float t230 = x[55] - x[57];
+	float t231 = x[59] + x[61];
+	float t232 = x[59] - x[61];
+	float t233 = x[63] * 2.0f;
+	float t234 = t217 * 0x1.6A09E6p-1f;
+	float t235 = t205 + t229;
+	float t236 = t235 * 0x1.6A09E6p-1f;
+	float t237 = t205 - t229;
+	float t238 = t237 * 0x1.6A09E6p-1f;
+	float t239 = t202 * 0.5f;
+	float t240 = t239 + t234;
+	float t241 = t239 - t234;
+	float t242 = 0x1.87DE2Ap-2f*t209 - 0x1.D906BCp-1f*t225;
+	float t243 = 0x1.D906BCp-1f*t209 + 0x1.87DE2Ap-2f*t225;
+	float t244 = t236 + t213;
+	float t245 = t236 - t213;
+	float t246 = t238 + t221;
+	float t247 = t238 - t221;
+	float t248 = t240 + t243;
+	float t249 = t240 - t243;
+	float t250 = t241 + t242;
+	float t251 = t241 - t242;
+	float t252 = 0x1.A9B664p-1f*t246 - 0x1.1C73B4p-1f*t244;
+	float t253 = 0x1.1C73B4p-1f*t246 + 0x1.A9B664p-1f*t244;
+	float t254 = 0x1.F6297Cp-1f*t245 - 0x1.8F8B84p-3f*t247;
+	float t255 = 0x1.8F8B84p-3f*t245 + 0x1.F6297Cp-1f*t247;
+	float t256 = t248 + t253;
+	float t257 = t248 - t253;
+	float t258 = t250 + t255;
+	float t259 = t250 - t255;
+	float t260 = t251 + t254;
+	float t261 = t251 - t254;
+	float t262 = t249 + t252;
+	float t263 = t249 - t252;
+	float t264 = t211 + t207;
+	float t265 = t211 - t207;
+	float t266 = t215 + t219;
+	float t267 = t266 * 0x1.6A09E6p-1f;
+	float t268 = t215 - t219;
+	float t269 = t268 * 0x1.6A09E6p-1f;
+	float t270 = t227 + t223;
+	float t271 = t227 - t223;
+	float t272 = t203 + t267;
+	float t273 = t203 - t267;
+	float t274 = 0x1.D906BCp-1f*t264 + 0x1.87DE2Ap-2f*t270;
+	float t275 = 0x1.87DE2Ap-2f*t264 - 0x1.D906BCp-1f*t270;
+	float t276 = t231 + t269;
+	float t277 = t231 - t269;
+	float t278 = 0x1.D906BCp-1f*t271 + 0x1.87DE2Ap-2f*t265;
+	float t279 = 0x1.87DE2Ap-2f*t271 - 0x1.D906BCp-1f*t265;
+	float t280 = t272 + t274;
+	float t281 = t272 - t274;
+	float t282 = t273 + t275;
+	float t283 = t273 - t275;
+	float t284 = t276 + t278;
+	float t285 = t276 - t278;
+	float t286 = t277 + t279;
+	float t287 = t277 - t279;
+	float t288 = 0x1.FD88DAp-1f*t280 + 0x1.917A6Cp-4f*t285;
+	float t289 = 0x1.917A6Cp-4f*t280 - 0x1.FD88DAp-1f*t285;
+	float t290 = 0x1.E9F414p-1f*t282 - 0x1.294064p-2f*t287;
+	float t291 = 0x1.294064p-2f*t282 + 0x1.E9F414p-1f*t287;
+	float t292 = 0x1.C38B3p-1f*t283 + 0x1.E2B5D4p-2f*t286;
+	float t293 = 0x1.E2B5D4p-2f*t283 - 0x1.C38B3p-1f*t286;
+	float t294 = 0x1.8BC808p-1f*t281 - 0x1.44CF32p-1f*t284;
+	float t295 = 0x1.44CF32p-1f*t281 + 0x1.8BC808p-1f*t284;
+	float t296 = t256 + t288;
+	float t297 = t256 - t288;
+	float t298 = t258 + t290;
+	float t299 = t258 - t290;
+	float t300 = t260 + t292;
+	float t301 = t260 - t292;
+	float t302 = t262 + t294;
+	float t303 = t262 - t294;
+	float t304 = t263 + t295;
+	float t305 = t263 - t295;
+	float t306 = t261 + t293;
+	float t307 = t261 - t293;
+	float t308 = t259 + t291;
+	float t309 = t259 - t291;
+	float t310 = t257 + t289;
+	float t311 = t257 - t289;
+	float t312 = t218 * 0x1.6A09E6p-1f;
+	float t313 = t230 + t206;
+	float t314 = t313 * 0x1.6A09E6p-1f;
+	float t315 = t230 - t206;
+	float t316 = t315 * 0x1.6A09E6p-1f;
+	float t317 = t233 * 0.5f;
+	float t318 = t317 + t312;
+	float t319 = t317 - t312;
+	float t320 = 0x1.87DE2Ap-2f*t226 - 0x1.D906BCp-1f*t210;
+	float t321 = 0x1.D906BCp-1f*t226 + 0x1.87DE2Ap-2f*t210;
+	float t322 = t314 + t222;
+	float t323 = t314 - t222;
+	float t324 = t316 + t214;
+	float t325 = t316 - t214;
+	float t326 = t318 + t321;
+	float t327 = t318 - t321;
+	float t328 = t319 + t320;
+	float t329 = t319 - t320;
+	float t330 = 0x1.A9B664p-1f*t324 - 0x1.1C73B4p-1f*t322;
+	float t331 = 0x1.1C73B4p-1f*t324 + 0x1.A9B664p-1f*t322;
+	float t332 = 0x1.F6297Cp-1f*t323 - 0x1.8F8B84p-3f*t325;
+	float t333 = 0x1.8F8B84p-3f*t323 + 0x1.F6297Cp-1f*t325;
+	float t334 = t326 + t331;
+	float t335 = t326 - t331;
+	float t336 = t328 + t333;
+	float t337 = t328 - t333;
+	float t338 = t329 + t332;
+	float t339 = t329 - t332;
+	float t340 = t327 + t330;
+	float t341 = t327 - t330;
+	float t342 = t224 + t228;
+	float t343 = t224 - t228;
+	float t344 = t220 + t216;
+	float t345 = t344 * 0x1.6A09E6p-1f;
+	float t346 = t220 - t216;
+	float t347 = t346 * 0x1.6A09E6p-1f;
+	float t348 = t208 + t212;
+	float t349 = t208 - t212;
+	float t350 = t232 + t345;
+	float t351 = t232 - t345;
+	float t352 = 0x1.D906BCp-1f*t342 + 0x1.87DE2Ap-2f*t348;
+	float t353 = 0x1.87DE2Ap-2f*t342 - 0x1.D906BCp-1f*t348;
+	float t354 = t204 + t347;
+	float t355 = t204 - t347;
+	float t356 = 0x1.D906BCp-1f*t349 + 0x1.87DE2Ap-2f*t343;
+	float t357 = 0x1.87DE2Ap-2f*t349 - 0x1.D906BCp-1f*t343;
+	float t358 = t350 + t352;
+	float t359 = t350 - t352;
+	float t360 = t351 + t353;
+	float t361 = t351 - t353;
+	float t362 = t354 + t356;
+	float t363 = t354 - t356;
+	float t364 = t355 + t357;
+	float t365 = t355 - t357;
+	float t366 = 0x1.FD88DAp-1f*t358 + 0x1.917A6Cp-4f*t363;
+	float t367 = 0x1.917A6Cp-4f*t358 - 0x1.FD88DAp-1f*t363;
+	float t368 = 0x1.E9F414p-1f*t360 - 0x1.294064p-2f*t365;
+	float t369 = 0x1.294064p-2f*t360 + 0x1.E9F414p-1f*t365;
+	float t370 = 0x1.C38B3p-1f*t361 + 0x1.E2B5D4p-2f*t364;
+	float t371 = 0x1.E2B5D4p-2f*t361 - 0x1.C38B3p-1f*t364;
+	float t372 = 0x1.8BC808p-1f*t359 - 0x1.44CF32p-1f*t362;
+	float t373 = 0x1.44CF32p-1f*t359 + 0x1.8BC808p-1f*t362;
+	float t374 = t334 + t366;
+	float t375 = t334 - t366;
+	float t376 = t336 + t368;
+	float t377 = t336 - t368;
+	float t378 = t338 + t370;
+	float t379 = t338 - t370;
+	float t380 = t340 + t372;
+	float t381 = t340 - t372;
+	float t382 = t341 + t373;
+	float t383 = t341 - t373;
+	float t384 = t339 + t371;
+	float t385 = t339 - t371;
+	float t386 = t337 + t369;
+	float t387 = t337 - t369;
+	float t388 = t335 + t367;
+	float t389 = t335 - t367;
+	float t390 = 0x1.FFD886p-1f*t296 + 0x1.92156p-6f*t374;
+	float t391 = 0x1.92156p-6f*t296 - 0x1.FFD886p-1f*t374;
+	float t392 = 0x1.FE9CDAp-1f*t298 - 0x1.2D520Ap-4f*t376;
+	float t393 = 0x1.2D520Ap-4f*t298 + 0x1.FE9CDAp-1f*t376;
+	float t394 = 0x1.FC2648p-1f*t300 + 0x1.F564E6p-4f*t378;
+	float t395 = 0x1.F564E6p-4f*t300 - 0x1.FC2648p-1f*t378;
+	float t396 = 0x1.F8765p-1f*t302 - 0x1.5E2144p-3f*t380;
+	float t397 = 0x1.5E2144p-3f*t302 + 0x1.F8765p-1f*t380;
+	float t398 = 0x1.F38F3Ap-1f*t304 + 0x1.C0B826p-3f*t382;
+	float t399 = 0x1.C0B826p-3f*t304 - 0x1.F38F3Ap-1f*t382;
+	float t400 = 0x1.ED740Ep-1f*t306 - 0x1.111D26p-2f*t384;
+	float t401 = 0x1.111D26p-2f*t306 + 0x1.ED740Ep-1f*t384;
+	float t402 = 0x1.E6288Ep-1f*t308 + 0x1.4135CAp-2f*t386;
+	float t403 = 0x1.4135CAp-2f*t308 - 0x1.E6288Ep-1f*t386;
+	float t404 = 0x1.DDB13Cp-1f*t310 - 0x1.708854p-2f*t388;
+	float t405 = 0x1.708854p-2f*t310 + 0x1.DDB13Cp-1f*t388;
+	float t406 = 0x1.D4134Ep-1f*t311 + 0x1.9EF794p-2f*t389;
+	float t407 = 0x1.9EF794p-2f*t311 - 0x1.D4134Ep-1f*t389;
+	float t408 = 0x1.C954B2p-1f*t309 - 0x1.CC66EAp-2f*t387;
+	float t409 = 0x1.CC66EAp-2f*t309 + 0x1.C954B2p-1f*t387;
+	float t410 = 0x1.BD7C0Ap-1f*t307 + 0x1.F8BA4Ep-2f*t385;
+	float t411 = 0x1.F8BA4Ep-2f*t307 - 0x1.BD7C0Ap-1f*t385;
+	float t412 = 0x1.B090A6p-1f*t305 - 0x1.11EB36p-1f*t383;
+	float t413 = 0x1.11EB36p-1f*t305 + 0x1.B090A6p-1f*t383;
+	float t414 = 0x1.A29A7Ap-1f*t303 + 0x1.26D054p-1f*t381;
+	float t415 = 0x1.26D054p-1f*t303 - 0x1.A29A7Ap-1f*t381;
+	float t416 = 0x1.93A224p-1f*t301 - 0x1.3AFFA2p-1f*t379;
+	float t417 = 0x1.3AFFA2p-1f*t301 + 0x1.93A224p-1f*t379;
+	float t418 = 0x1.83B0Ep-1f*t299 + 0x1.4E6CACp-1f*t377;
+	float t419 = 0x1.4E6CACp-1f*t299 - 0x1.83B0Ep-1f*t377;
+	float t420 = 0x1.72D084p-1f*t297 - 0x1.610B76p-1f*t375;
+	float t421 = 0x1.610B76p-1f*t297 + 0x1.72D084p-1f*t375;
+	float t422 = t170 + t390;
+	float t423 = t170 - t390;
+	float t424 = t172 + t392;
+	float t425 = t172 - t392;
+	float t426 = t174 + t394;
+	float t427 = t174 - t394;
+	float t428 = t176 + t396;
+	float t429 = t176 - t396;
+	float t430 = t178 + t398;
+	float t431 = t178 - t398;
+	float t432 = t180 + t400;
+	float t433 = t180 - t400;
+	float t434 = t182 + t402;
+	float t435 = t182 - t402;
+	float t436 = t184 + t404;
+	float t437 = t184 - t404;
+	float t438 = t186 + t406;
+	float t439 = t186 - t406;
+	float t440 = t188 + t408;
+	float t441 = t188 - t408;
+	float t442 = t190 + t410;
+	float t443 = t190 - t410;
+	float t444 = t192 + t412;
+	float t445 = t192 - t412;
+	float t446 = t194 + t414;
+	float t447 = t194 - t414;
+	float t448 = t196 + t416;
+	float t449 = t196 - t416;
+	float t450 = t198 + t418;
+	float t451 = t198 - t418;
+	float t452 = t200 + t420;
+	float t453 = t200 - t420;
+	float t454 = t201 + t421;
+	float t455 = t201 - t421;
+	float t456 = t199 + t419;
+	float t457 = t199 - t419;
+	float t458 = t197 + t417;
+	float t459 = t197 - t417;
+	float t460 = t195 + t415;
+	float t461 = t195 - t415;
+	float t462 = t193 + t413;
+	float t463 = t193 - t413;
+	float t464 = t191 + t411;
+	float t465 = t191 - t411;
+	float t466 = t189 + t409;
+	float t467 = t189 - t409;
+	float t468 = t187 + t407;
+	float t469 = t187 - t407;
+	float t470 = t185 + t405;
+	float t471 = t185 - t405;
+	float t472 = t183 + t403;
+	float t473 = t183 - t403;
+	float t474 = t181 + t401;
+	float t475 = t181 - t401;
+	float t476 = t179 + t399;
+	float t477 = t179 - t399;
+	float t478 = t177 + t397;
+	float t479 = t177 - t397;
+	float t480 = t175 + t395;
+	float t481 = t175 - t395;
+	float t482 = t173 + t393;
+	float t483 = t173 - t393;
+	float t484 = t171 + t391;
+	float t485 = t171 - t391;
+	x[0] = t422;
+	x[1] = t424;
+	x[2] = t426;
+	x[3] = t428;
+	x[4] = t430;
+	x[5] = t432;
+	x[6] = t434;
+	x[7] = t436;
+	x[8] = t438;
+	x[9] = t440;
+	x[10] = t442;
+	x[11] = t444;
+	x[12] = t446;
+	x[13] = t448;
+	x[14] = t450;
+	x[15] = t452;
+	x[16] = t454;
+	x[17] = t456;
+	x[18] = t458;
+	x[19] = t460;
+	x[20] = t462;
+	x[21] = t464;
+	x[22] = t466;
+	x[23] = t468;
+	x[24] = t470;
+	x[25] = t472;
+	x[26] = t474;
+	x[27] = t476;
+	x[28] = t478;
+	x[29] = t480;
+	x[30] = t482;
+	x[31] = t484;
+	x[32] = t485;
+	x[33] = t483;
+	x[34] = t481;
+	x[35] = t479;
+	x[36] = t477;
+	x[37] = t475;
+	x[38] = t473;
+	x[39] = t471;
+	x[40] = t469;
+	x[41] = t467;
+	x[42] = t465;
+	x[43] = t463;
+	x[44] = t461;
+	x[45] = t459;
+	x[46] = t457;
+	x[47] = t455;
+	x[48] = t453;
+	x[49] = t451;
+	x[50] = t449;
+	x[51] = t447;
+	x[52] = t445;
+	x[53] = t443;
+	x[54] = t441;
+	x[55] = t439;
+	x[56] = t437;
+	x[57] = t435;
+	x[58] = t433;
+	x[59] = t431;
+	x[60] = t429;
+	x[61] = t427;
+	x[62] = t425;
+	x[63] = t423;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT4)
+/**************************************/
+
+//! DCT-IV (N=16)
+FOURIER_CODELET void DCT4_16(float *x) {
+	float t0 = 0x1.FF621Ep-1f*x[0] + 0x1.91F66p-5f*x[15];
+	float t1 = 0x1.91F66p-5f*x[0] - 0x1.FF621Ep-1f*x[15];
+	float t2 = 0x1.FA7558p-1f*x[1] + 0x1.2C8106p-3f*x[14];
+	float t3 = -0x1.2C8106p-3f*x[1] + 0x1.FA7558p-1f*x[14];
+	float t4 = 0x1.F0A7Fp-1f*x[2] + 0x1.F19F98p-3f*x[13];
+	float t5 = 0x1.F19F98p-3f*x[2] - 0x1.F0A7Fp-1f*x[13];
+	float t6 = 0x1.E2121p-1f*x[3] + 0x1.58F9A8p-2f*x[12];
+	float t7 = -0x1.58F9A8p-2f*x[3] + 0x1.E2121p-1f*x[12];
+	float t8 = 0x1.CED7Bp-1f*x[4] + 0x1.B5D1p-2f*x[11];
+	float t9 = 0x1.B5D1p-2f*x[4] - 0x1.CED7Bp-1f*x[11];
+	float t10 = 0x1.B72834p-1f*x[5] + 0x1.07387Ap-1f*x[10];
+	float t11 = -0x1.07387Ap-1f*x[5] + 0x1.B72834p-1f*x[10];
+	float t12 = 0x1.9B3E04p-1f*x[6] + 0x1.30FF8p-1f*x[9];
+	float t13 = 0x1.30FF8p-1f*x[6] - 0x1.9B3E04p-1f*x[9];
+	float t14 = 0x1.7B5DF2p-1f*x[7] + 0x1.57D694p-1f*x[8];
+	float t15 = -0x1.57D694p-1f*x[7] + 0x1.7B5DF2p-1f*x[8];
+	float t16 = t0 + t14;
+	float t17 = t0 - t14;
+	float t18 = t2 + t12;
+	float t19 = t2 - t12;
+	float t20 = t4 + t10;
+	float t21 = t4 - t10;
+	float t22 = t6 + t8;
+	float t23 = t6 - t8;
+	float t24 = t16 + t22;
+	float t25 = t16 - t22;
+	float t26 = t18 + t20;
+	float t27 = t18 - t20;
+	float t28 = 0x1.A9B664p-1f*t23 + 0x1.1C73B4p-1f*t17;
+	float t29 = -0x1.1C73B4p-1f*t23 + 0x1.A9B664p-1f*t17;
+	float t30 = 0x1.F6297Cp-1f*t21 + 0x1.8F8B84p-3f*t19;
+	float t31 = -0x1.8F8B84p-3f*t21 + 0x1.F6297Cp-1f*t19;
+	float t32 = t24 + t26;
+	float t33 = t24 - t26;
+	float t34 = 0x1.87DE2Ap-2f*t27 + 0x1.D906BCp-1f*t25;
+	float t35 = -0x1.D906BCp-1f*t27 + 0x1.87DE2Ap-2f*t25;
+	float t36 = t29 + t30;
+	float t37 = t29 - t30;
+	float t38 = t28 + t31;
+	float t39 = t28 - t31;
+	float t40 = t33 * 0x1.6A09E6p-1f;
+	float t41 = t36 + t38;
+	float t42 = t41 * 0x1.6A09E6p-1f;
+	float t43 = t36 - t38;
+	float t44 = t43 * 0x1.6A09E6p-1f;
+	float t45 = t1 + t15;
+	float t46 = t1 - t15;
+	float t47 = t3 + t13;
+	float t48 = t3 - t13;
+	float t49 = t5 + t11;
+	float t50 = t5 - t11;
+	float t51 = t7 + t9;
+	float t52 = t7 - t9;
+	float t53 = t45 + t51;
+	float t54 = t45 - t51;
+	float t55 = t47 + t49;
+	float t56 = t47 - t49;
+	float t57 = 0x1.A9B664p-1f*t52 + 0x1.1C73B4p-1f*t46;
+	float t58 = -0x1.1C73B4p-1f*t52 + 0x1.A9B664p-1f*t46;
+	float t59 = 0x1.F6297Cp-1f*t50 + 0x1.8F8B84p-3f*t48;
+	float t60 = -0x1.8F8B84p-3f*t50 + 0x1.F6297Cp-1f*t48;
+	float t61 = t53 + t55;
+	float t62 = t53 - t55;
+	float t63 = 0x1.87DE2Ap-2f*t56 + 0x1.D906BCp-1f*t54;
+	float t64 = -0x1.D906BCp-1f*t56 + 0x1.87DE2Ap-2f*t54;
+	float t65 = t58 + t59;
+	float t66 = t58 - t59;
+	float t67 = t57 + t60;
+	float t68 = t57 - t60;
+	float t69 = t62 * 0x1.6A09E6p-1f;
+	float t70 = t65 + t67;
+	float t71 = t70 * 0x1.6A09E6p-1f;
+	float t72 = t65 - t67;
+	float t73 = t72 * 0x1.6A09E6p-1f;
+	float t74 = t42 + t73;
+	float t75 = t42 - t73;
+	float t76 = t34 + t64;
+	float t77 = t34 - t64;
+	float t78 = t37 + t68;
+	float t79 = t37 - t68;
+	float t80 = t40 + t69;
+	float t81 = t40 - t69;
+	float t82 = t39 + t66;
+	float t83 = t39 - t66;
+	float t84 = t35 + t63;
+	float t85 = t35 - t63;
+	float t86 = t44 + t71;
+	float t87 = t44 - t71;
+	x[0] = t32;
+	x[1] = t74;
+	x[2] = t75;
+	x[3] = t76;
+	x[4] = t77;
+	x[5] = t78;
+	x[6] = t79;
+	x[7] = t80;
+	x[8] = t81;
+	x[9] = t82;
+	x[10] = t83;
+	x[11] = t84;
+	x[12] = t85;
+	x[13] = t86;
+	x[14] = t87;
+	x[15] = t61;
+}
+
+//! DCT-IV (N=32)
+FOURIER_CODELET void DCT4_32(float *x) {
+	float t0 = 0x1.FFD886p-1f*x[0] + 0x1.92156p-6f*x[31];
+	float t1 = 0x1.92156p-6f*x[0] - 0x1.FFD886p-1f*x[31];
+	float t2 = 0x1.FE9CDAp-1f*x[1] + 0x1.2D520Ap-4f*x[30];
+	float t3 = -0x1.2D520Ap-4f*x[1] + 0x1.FE9CDAp-1f*x[30];
+	float t4 = 0x1.FC2648p-1f*x[2] + 0x1.F564E6p-4f*x[29];
+	float t5 = 0x1.F564E6p-4f*x[2] - 0x1.FC2648p-1f*x[29];
+	float t6 = 0x1.F8765p-1f*x[3] + 0x1.5E2144p-3f*x[28];
+	float t7 = -0x1.5E2144p-3f*x[3] + 0x1.F8765p-1f*x[28];
+	float t8 = 0x1.F38F3Ap-1f*x[4] + 0x1.C0B826p-3f*x[27];
+	float t9 = 0x1.C0B826p-3f*x[4] - 0x1.F38F3Ap-1f*x[27];
+	float t10 = 0x1.ED740Ep-1f*x[5] + 0x1.111D26p-2f*x[26];
+	float t11 = -0x1.111D26p-2f*x[5] + 0x1.ED740Ep-1f*x[26];
+	float t12 = 0x1.E6288Ep-1f*x[6] + 0x1.4135CAp-2f*x[25];
+	float t13 = 0x1.4135CAp-2f*x[6] - 0x1.E6288Ep-1f*x[25];
+	float t14 = 0x1.DDB13Cp-1f*x[7] + 0x1.708854p-2f*x[24];
+	float t15 = -0x1.708854p-2f*x[7] + 0x1.DDB13Cp-1f*x[24];
+	float t16 = 0x1.D4134Ep-1f*x[8] + 0x1.9EF794p-2f*x[23];
+	float t17 = 0x1.9EF794p-2f*x[8] - 0x1.D4134Ep-1f*x[23];
+	float t18 = 0x1.C954B2p-1f*x[9] + 0x1.CC66EAp-2f*x[22];
+	float t19 = -0x1.CC66EAp-2f*x[9] + 0x1.C954B2p-1f*x[22];
+	float t20 = 0x1.BD7C0Ap-1f*x[10] + 0x1.F8BA4Ep-2f*x[21];
+	float t21 = 0x1.F8BA4Ep-2f*x[10] - 0x1.BD7C0Ap-1f*x[21];
+	float t22 = 0x1.B090A6p-1f*x[11] + 0x1.11EB36p-1f*x[20];
+	float t23 = -0x1.11EB36p-1f*x[11] + 0x1.B090A6p-1f*x[20];
+	float t24 = 0x1.A29A7Ap-1f*x[12] + 0x1.26D054p-1f*x[19];
+	float t25 = 0x1.26D054p-1f*x[12] - 0x1.A29A7Ap-1f*x[19];
+	float t26 = 0x1.93A224p-1f*x[13] + 0x1.3AFFA2p-1f*x[18];
+	float t27 = -0x1.3AFFA2p-1f*x[13] + 0x1.93A224p-1f*x[18];
+	float t28 = 0x1.83B0Ep-1f*x[14] + 0x1.4E6CACp-1f*x[17];
+	float t29 = 0x1.4E6CACp-1f*x[14] - 0x1.83B0Ep-1f*x[17];
+	float t30 = 0x1.72D084p-1f*x[15] + 0x1.610B76p-1f*x[16];
+	float t31 = -0x1.610B76p-1f*x[15] + 0x1.72D084p-1f*x[16];
+	float t32 = t0 + t30;
+	float t33 = t2 + t28;
+	float t34 = t4 + t26;
+	float t35 = t6 + t24;
+	float t36 = t8 + t22;
+	float t37 = t10 + t20;
+	float t38 = t12 + t18;
+	float t39 = t14 + t16;
+	float t40 = t0 - t30;
+	float t41 = t2 - t28;
+	float t42 = t4 - t26;
+	float t43 = t6 - t24;
+	float t44 = t8 - t22;
+	float t45 = t10 - t20;
+	float t46 = t12 - t18;
+	float t47 = t14 - t16;
+	float t48 = t32 + t39;
+	float t49 = t32 - t39;
+	float t50 = t33 + t38;
+	float t51 = t33 - t38;
+	float t52 = t34 + t37;
+	float t53 = t34 - t37;
+	float t54 = t35 + t36;
+	float t55 = t35 - t36;
+	float t56 = t48 + t54;
+	float t57 = t48 - t54;
+	float t58 = t50 + t52;
+	float t59 = t50 - t52;
+	float t60 = 0x1.A9B664p-1f*t55 + 0x1.1C73B4p-1f*t49;
+	float t61 = -0x1.1C73B4p-1f*t55 + 0x1.A9B664p-1f*t49;
+	float t62 = 0x1.F6297Cp-1f*t53 + 0x1.8F8B84p-3f*t51;
+	float t63 = -0x1.8F8B84p-3f*t53 + 0x1.F6297Cp-1f*t51;
+	float t64 = t56 + t58;
+	float t65 = t56 - t58;
+	float t66 = 0x1.87DE2Ap-2f*t59 + 0x1.D906BCp-1f*t57;
+	float t67 = -0x1.D906BCp-1f*t59 + 0x1.87DE2Ap-2f*t57;
+	float t68 = t61 + t62;
+	float t69 = t61 - t62;
+	float t70 = t60 + t63;
+	float t71 = t60 - t63;
+	float t72 = t65 * 0x1.6A09E6p-1f;
+	float t73 = t68 + t70;
+	float t74 = t73 * 0x1.6A09E6p-1f;
+	float t75 = t68 - t70;
+	float t76 = t75 * 0x1.6A09E6p-1f;
+	float t77 = 0x1.FD88DAp-1f*t40 + 0x1.917A6Cp-4f*t47;
+	float t78 = 0x1.917A6Cp-4f*t40 - 0x1.FD88DAp-1f*t47;
+	float t79 = 0x1.E9F414p-1f*t41 + 0x1.294064p-2f*t46;
+	float t80 = -0x1.294064p-2f*t41 + 0x1.E9F414p-1f*t46;
+	float t81 = 0x1.C38B3p-1f*t42 + 0x1.E2B5D4p-2f*t45;
+	float t82 = 0x1.E2B5D4p-2f*t42 - 0x1.C38B3p-1f*t45;
+	float t83 = 0x1.8BC808p-1f*t43 + 0x1.44CF32p-1f*t44;
+	float t84 = -0x1.44CF32p-1f*t43 + 0x1.8BC808p-1f*t44;
+	float t85 = t77 + t83;
+	float t86 = t77 - t83;
+	float t87 = t79 + t81;
+	float t88 = t79 - t81;
+	float t89 = t84 + t78;
+	float t90 = t84 - t78;
+	float t91 = t82 + t80;
+	float t92 = t82 - t80;
+	float t93 = t85 + t87;
+	float t94 = t85 - t87;
+	float t95 = 0x1.D906BCp-1f*t86 + 0x1.87DE2Ap-2f*t88;
+	float t96 = 0x1.87DE2Ap-2f*t86 - 0x1.D906BCp-1f*t88;
+	float t97 = t89 + t91;
+	float t98 = t89 - t91;
+	float t99 = 0x1.D906BCp-1f*t90 + 0x1.87DE2Ap-2f*t92;
+	float t100 = 0x1.87DE2Ap-2f*t90 - 0x1.D906BCp-1f*t92;
+	float t101 = t95 - t100;
+	float t102 = t95 + t100;
+	float t103 = t94 + t98;
+	float t104 = t103 * 0x1.6A09E6p-1f;
+	float t105 = t94 - t98;
+	float t106 = t105 * 0x1.6A09E6p-1f;
+	float t107 = t96 - t99;
+	float t108 = t96 + t99;
+	float t109 = t1 + t31;
+	float t110 = t3 + t29;
+	float t111 = t5 + t27;
+	float t112 = t7 + t25;
+	float t113 = t9 + t23;
+	float t114 = t11 + t21;
+	float t115 = t13 + t19;
+	float t116 = t15 + t17;
+	float t117 = t1 - t31;
+	float t118 = t3 - t29;
+	float t119 = t5 - t27;
+	float t120 = t7 - t25;
+	float t121 = t9 - t23;
+	float t122 = t11 - t21;
+	float t123 = t13 - t19;
+	float t124 = t15 - t17;
+	float t125 = t109 + t116;
+	float t126 = t109 - t116;
+	float t127 = t110 + t115;
+	float t128 = t110 - t115;
+	float t129 = t111 + t114;
+	float t130 = t111 - t114;
+	float t131 = t112 + t113;
+	float t132 = t112 - t113;
+	float t133 = t125 + t131;
+	float t134 = t125 - t131;
+	float t135 = t127 + t129;
+	float t136 = t127 - t129;
+	float t137 = 0x1.A9B664p-1f*t132 + 0x1.1C73B4p-1f*t126;
+	float t138 = -0x1.1C73B4p-1f*t132 + 0x1.A9B664p-1f*t126;
+	float t139 = 0x1.F6297Cp-1f*t130 + 0x1.8F8B84p-3f*t128;
+	float t140 = -0x1.8F8B84p-3f*t130 + 0x1.F6297Cp-1f*t128;
+	float t141 = t133 + t135;
+	float t142 = t133 - t135;
+	float t143 = 0x1.87DE2Ap-2f*t136 + 0x1.D906BCp-1f*t134;
+	float t144 = -0x1.D906BCp-1f*t136 + 0x1.87DE2Ap-2f*t134;
+	float t145 = t138 + t139;
+	float t146 = t138 - t139;
+	float t147 = t137 + t140;
+	float t148 = t137 - t140;
+	float t149 = t142 * 0x1.6A09E6p-1f;
+	float t150 = t145 + t147;
+	float t151 = t150 * 0x1.6A09E6p-1f;
+	float t152 = t145 - t147;
+	float t153 = t152 * 0x1.6A09E6p-1f;
+	float t154 = 0x1.FD88DAp-1f*t117 + 0x1.917A6Cp-4f*t124;
+	float t155 = 0x1.917A6Cp-4f*t117 - 0x1.FD88DAp-1f*t124;
+	float t156 = 0x1.E9F414p-1f*t118 + 0x1.294064p-2f*t123;
+	float t157 = -0x1.294064p-2f*t118 + 0x1.E9F414p-1f*t123;
+	float t158 = 0x1.C38B3p-1f*t119 + 0x1.E2B5D4p-2f*t122;
+	float t159 = 0x1.E2B5D4p-2f*t119 - 0x1.C38B3p-1f*t122;
+	float t160 = 0x1.8BC808p-1f*t120 + 0x1.44CF32p-1f*t121;
+	float t161 = -0x1.44CF32p-1f*t120 + 0x1.8BC808p-1f*t121;
+	float t162 = t154 + t160;
+	float t163 = t154 - t160;
+	float t164 = t156 + t158;
+	float t165 = t156 - t158;
+	float t166 = t161 + t155;
+	float t167 = t161 - t155;
+	float t168 = t159 + t157;
+	float t169 = t159 - t157;
+	float t170 = t162 + t164;
+	float t171 = t162 - t164;
+	float t172 = 0x1.D906BCp-1f*t163 + 0x1.87DE2Ap-2f*t165;
+	float t173 = 0x1.87DE2Ap-2f*t163 - 0x1.D906BCp-1f*t165;
+	float t174 = t166 + t168;
+	float t175 = t166 - t168;
+	float t176 = 0x1.D906BCp-1f*t167 + 0x1.87DE2Ap-2f*t169;
+	float t177 = 0x1.87DE2Ap-2f*t167 - 0x1.D906BCp-1f*t169;
+	float t178 = t172 - t177;
+	float t179 = t172 + t177;
+	float t180 = t171 + t175;
+	float t181 = t180 * 0x1.6A09E6p-1f;
+	float t182 = t171 - t175;
+	float t183 = t182 * 0x1.6A09E6p-1f;
+	float t184 = t173 - t176;
+	float t185 = t173 + t176;
+	float t186 = t93 + t174;
+	float t187 = t93 - t174;
+	float t188 = t74 + t153;
+	float t189 = t74 - t153;
+	float t190 = t101 + t185;
+	float t191 = t101 - t185;
+	float t192 = t66 + t144;
+	float t193 = t66 - t144;
+	float t194 = t102 + t184;
+	float t195 = t102 - t184;
+	float t196 = t69 + t148;
+	float t197 = t69 - t148;
+	float t198 = t104 + t183;
+	float t199 = t104 - t183;
+	float t200 = t72 + t149;
+	float t201 = t72 - t149;
+	float t202 = t106 + t181;
+	float t203 = t106 - t181;
+	float t204 = t71 + t146;
+	float t205 = t71 - t146;
+	float t206 = t107 + t179;
+	float t207 = t107 - t179;
+	float t208 = t67 + t143;
+	float t209 = t67 - t143;
+	float t210 = t108 + t178;
+	float t211 = t108 - t178;
+	float t212 = t76 + t151;
+	float t213 = t76 - t151;
+	float t214 = t97 + t170;
+	float t215 = t97 - t170;
+	x[0] = t64;
+	x[1] = t186;
+	x[2] = t187;
+	x[3] = t188;
+	x[4] = t189;
+	x[5] = t190;
+	x[6] = t191;
+	x[7] = t192;
+	x[8] = t193;
+	x[9] = t194;
+	x[10] = t195;
+	x[11] = t196;
+	x[12] = t197;
+	x[13] = t198;
+	x[14] = t199;
+	x[15] = t200;
+	x[16] = t201;
+	x[17] = t202;
+	x[18] = t203;
+	x[19] = t204;
+	x[20] = t205;
+	x[21] = t206;
+	x[22] = t207;
+	x[23] = t208;
+	x[24] = t209;
+	x[25] = t210;
+	x[26] = t211;
+	x[27] = t212;
+	x[28] = t213;
+	x[29] = t214;
+	x[30] = t215;
+	x[31] = t141;
+}
+
+//! DCT-IV (N=64)
+FOURIER_CODELET void DCT4_64(float *x) {
+	float t0 = 0x1.FFF622p-1f*x[0] + 0x1.921D2p-7f*x[63];
+	float t1 = 0x1.921D2p-7f*x[0] - 0x1.FFF622p-1f*x[63];
+	float t2 = 0x1.FFA72Ep-1f*x[1] + 0x1.2D8658p-5f*x[62];
+	float t3 = -0x1.2D8658p-5f*x[1] + 0x1.FFA72Ep-1f*x[62];
+	float t4 = 0x1.FF0956p-1f*x[2] + 0x1.F656E8p-5f*x[61];
+	float t5 = 0x1.F656E8p-5f*x[2] - 0x1.FF0956p-1f*x[61];
+	float t6 = 0x1.FE1CBp-1f*x[3] + 0x1.5F6Dp-4f*x[60];
+	float t7 = -0x1.5F6Dp-4f*x[3] + 0x1.FE1CBp-1f*x[60];
+	float t8 = 0x1.FCE16p-1f*x[4] + 0x1.C3785Cp-4f*x[59];
+	float t9 = 0x1.C3785Cp-4f*x[4] - 0x1.FCE16p-1f*x[59];
+	float t10 = 0x1.FB5798p-1f*x[5] + 0x1.139F0Cp-3f*x[58];
+	float t11 = -0x1.139F0Cp-3f*x[5] + 0x1.FB5798p-1f*x[58];
+	float t12 = 0x1.F97F92p-1f*x[6] + 0x1.45576Cp-3f*x[57];
+	float t13 = 0x1.45576Cp-3f*x[6] - 0x1.F97F92p-1f*x[57];
+	float t14 = 0x1.F7599Ap-1f*x[7] + 0x1.76DD9Ep-3f*x[56];
+	float t15 = -0x1.76DD9Ep-3f*x[7] + 0x1.F7599Ap-1f*x[56];
+	float t16 = 0x1.F4E604p-1f*x[8] + 0x1.A82A02p-3f*x[55];
+	float t17 = 0x1.A82A02p-3f*x[8] - 0x1.F4E604p-1f*x[55];
+	float t18 = 0x1.F2253p-1f*x[9] + 0x1.D934FEp-3f*x[54];
+	float t19 = -0x1.D934FEp-3f*x[9] + 0x1.F2253p-1f*x[54];
+	float t20 = 0x1.EF178Ap-1f*x[10] + 0x1.04FB8p-2f*x[53];
+	float t21 = 0x1.04FB8p-2f*x[10] - 0x1.EF178Ap-1f*x[53];
+	float t22 = 0x1.EBBD8Cp-1f*x[11] + 0x1.1D3444p-2f*x[52];
+	float t23 = -0x1.1D3444p-2f*x[11] + 0x1.EBBD8Cp-1f*x[52];
+	float t24 = 0x1.E817BAp-1f*x[12] + 0x1.35410Cp-2f*x[51];
+	float t25 = 0x1.35410Cp-2f*x[12] - 0x1.E817BAp-1f*x[51];
+	float t26 = 0x1.E426A4p-1f*x[13] + 0x1.4D1E24p-2f*x[50];
+	float t27 = -0x1.4D1E24p-2f*x[13] + 0x1.E426A4p-1f*x[50];
+	float t28 = 0x1.DFEAE6p-1f*x[14] + 0x1.64C7DEp-2f*x[49];
+	float t29 = 0x1.64C7DEp-2f*x[14] - 0x1.DFEAE6p-1f*x[49];
+	float t30 = 0x1.DB6526p-1f*x[15] + 0x1.7C3A94p-2f*x[48];
+	float t31 = -0x1.7C3A94p-2f*x[15] + 0x1.DB6526p-1f*x[48];
+	float t32 = 0x1.D69618p-1f*x[16] + 0x1.9372A6p-2f*x[47];
+	float t33 = 0x1.9372A6p-2f*x[16] - 0x1.D69618p-1f*x[47];
+	float t34 = 0x1.D17E78p-1f*x[17] + 0x1.AA6C82p-2f*x[46];
+	float t35 = -0x1.AA6C82p-2f*x[17] + 0x1.D17E78p-1f*x[46];
+	float t36 = 0x1.CC1F1p-1f*x[18] + 0x1.C1249Ep-2f*x[45];
+	float t37 = 0x1.C1249Ep-2f*x[18] - 0x1.CC1F1p-1f*x[45];
+	float t38 = 0x1.C678B4p-1f*x[19] + 0x1.D79776p-2f*x[44];
+	float t39 = -0x1.D79776p-2f*x[19] + 0x1.C678B4p-1f*x[44];
+	float t40 = 0x1.C08C42p-1f*x[20] + 0x1.EDC196p-2f*x[43];
+	float t41 = 0x1.EDC196p-2f*x[20] - 0x1.C08C42p-1f*x[43];
+	float t42 = 0x1.BA5AA6p-1f*x[21] + 0x1.01CFC8p-1f*x[42];
+	float t43 = -0x1.01CFC8p-1f*x[21] + 0x1.BA5AA6p-1f*x[42];
+	float t44 = 0x1.B3E4D4p-1f*x[22] + 0x1.0C9704p-1f*x[41];
+	float t45 = 0x1.0C9704p-1f*x[22] - 0x1.B3E4D4p-1f*x[41];
+	float t46 = 0x1.AD2BCAp-1f*x[23] + 0x1.1734D6p-1f*x[40];
+	float t47 = -0x1.1734D6p-1f*x[23] + 0x1.AD2BCAp-1f*x[40];
+	float t48 = 0x1.A63092p-1f*x[24] + 0x1.21A79Ap-1f*x[39];
+	float t49 = 0x1.21A79Ap-1f*x[24] - 0x1.A63092p-1f*x[39];
+	float t50 = 0x1.9EF43Ep-1f*x[25] + 0x1.2BEDB2p-1f*x[38];
+	float t51 = -0x1.2BEDB2p-1f*x[25] + 0x1.9EF43Ep-1f*x[38];
+	float t52 = 0x1.9777Fp-1f*x[26] + 0x1.36058Cp-1f*x[37];
+	float t53 = 0x1.36058Cp-1f*x[26] - 0x1.9777Fp-1f*x[37];
+	float t54 = 0x1.8FBCCAp-1f*x[27] + 0x1.3FED96p-1f*x[36];
+	float t55 = -0x1.3FED96p-1f*x[27] + 0x1.8FBCCAp-1f*x[36];
+	float t56 = 0x1.87C4p-1f*x[28] + 0x1.49A44Ap-1f*x[35];
+	float t57 = 0x1.49A44Ap-1f*x[28] - 0x1.87C4p-1f*x[35];
+	float t58 = 0x1.7F8ECEp-1f*x[29] + 0x1.53282Ap-1f*x[34];
+	float t59 = -0x1.53282Ap-1f*x[29] + 0x1.7F8ECEp-1f*x[34];
+	float t60 = 0x1.771E76p-1f*x[30] + 0x1.5C77BCp-1f*x[33];
+	float t61 = 0x1.5C77BCp-1f*x[30] - 0x1.771E76p-1f*x[33];
+	float t62 = 0x1.6E7446p-1f*x[31] + 0x1.659192p-1f*x[32];
+	float t63 = -0x1.659192p-1f*x[31] + 0x1.6E7446p-1f*x[32];
+	float t64 = t0 + t62;
+	float t65 = t2 + t60;
+	float t66 = t4 + t58;
+	float t67 = t6 + t56;
+	float t68 = t8 + t54;
+	float t69 = t10 + t52;
+	float t70 = t12 + t50;
+	float t71 = t14 + t48;
+	float t72 = t16 + t46;
+	float t73 = t18 + t44;
+	float t74 = t20 + t42;
+	float t75 = t22 + t40;
+	float t76 = t24 + t38;
+	float t77 = t26 + t36;
+	float t78 = t28 + t34;
+	float t79 = t30 + t32;
+	float t80 = t0 - t62;
+	float t81 = t2 - t60;
+	float t82 = t4 - t58;
+	float t83 = t6 - t56;
+	float t84 = t8 - t54;
+	float t85 = t10 - t52;
+	float t86 = t12 - t50;
+	float t87 = t14 - t48;
+	float t88 = t16 - t46;
+	float t89 = t18 - t44;
+	float t90 = t20 - t42;
+	float t91 = t22 - t40;
+	float t92 = t24 - t38;
+	float t93 = t26 - t36;
+	float t94 = t28 - t34;
+	float t95 = t30 - t32;
+	float t96 = t64 + t79;
+	float t97 = t65 + t78;
+	float t98 = t66 + t77;
+	float t99 = t67 + t76;
+	float t100 = t68 + t75;
+	float t101 = t69 + t74;
+	float t102 = t70 + t73;
+	float t103 = t71 + t72;
+	float t104 = t64 - t79;
+	float t105 = t65 - t78;
+	float t106 = t66 - t77;
+	float t107 = t67 - t76;
+	float t108 = t68 - t75;
+	float t109 = t69 - t74;
+	float t110 = t70 - t73;
+	float t111 = t71 - t72;
+	float t112 = t96 + t103;
+	float t113 = t96 - t103;
+	float t114 = t97 + t102;
+	float t115 = t97 - t102;
+	float t116 = t98 + t101;
+	float t117 = t98 - t101;
+	float t118 = t99 + t100;
+	float t119 = t99 - t100;
+	float t120 = t112 + t118;
+	float t121 = t112 - t118;
+	float t122 = t114 + t116;
+	float t123 = t114 - t116;
+	float t124 = 0x1.A9B664p-1f*t119 + 0x1.1C73B4p-1f*t113;
+	float t125 = -0x1.1C73B4p-1f*t119 + 0x1.A9B664p-1f*t113;
+	float t126 = 0x1.F6297Cp-1f*t117 + 0x1.8F8B84p-3f*t115;
+	float t127 = -0x1.8F8B84p-3f*t117 + 0x1.F6297Cp-1f*t115;
+	float t128 = t120 + t122;
+	float t129 = t120 - t122;
+	float t130 = 0x1.87DE2Ap-2f*t123 + 0x1.D906BCp-1f*t121;
+	float t131 = -0x1.D906BCp-1f*t123 + 0x1.87DE2Ap-2f*t121;
+	float t132 = t125 + t126;
+	float t133 = t125 - t126;
+	float t134 = t124 + t127;
+	float t135 = t124 - t127;
+	float t136 = t129 * 0x1.6A09E6p-1f;
+	float t137 = t132 + t134;
+	float t138 = t137 * 0x1.6A09E6p-1f;
+	float t139 = t132 - t134;
+	float t140 = t139 * 0x1.6A09E6p-1f;
+	float t141 = 0x1.FD88DAp-1f*t104 + 0x1.917A6Cp-4f*t111;
+	float t142 = 0x1.917A6Cp-4f*t104 - 0x1.FD88DAp-1f*t111;
+	float t143 = 0x1.E9F414p-1f*t105 + 0x1.294064p-2f*t110;
+	float t144 = -0x1.294064p-2f*t105 + 0x1.E9F414p-1f*t110;
+	float t145 = 0x1.C38B3p-1f*t106 + 0x1.E2B5D4p-2f*t109;
+	float t146 = 0x1.E2B5D4p-2f*t106 - 0x1.C38B3p-1f*t109;
+	float t147 = 0x1.8BC808p-1f*t107 + 0x1.44CF32p-1f*t108;
+	float t148 = -0x1.44CF32p-1f*t107 + 0x1.8BC808p-1f*t108;
+	float t149 = t141 + t147;
+	float t150 = t141 - t147;
+	float t151 = t143 + t145;
+	float t152 = t143 - t145;
+	float t153 = t148 + t142;
+	float t154 = t148 - t142;
+	float t155 = t146 + t144;
+	float t156 = t146 - t144;
+	float t157 = t149 + t151;
+	float t158 = t149 - t151;
+	float t159 = 0x1.D906BCp-1f*t150 + 0x1.87DE2Ap-2f*t152;
+	float t160 = 0x1.87DE2Ap-2f*t150 - 0x1.D906BCp-1f*t152;
+	float t161 = t153 + t155;
+	float t162 = t153 - t155;
+	float t163 = 0x1.D906BCp-1f*t154 + 0x1.87DE2Ap-2f*t156;
+	float t164 = 0x1.87DE2Ap-2f*t154 - 0x1.D906BCp-1f*t156;
+	float t165 = t159 - t164;
+	float t166 = t159 + t164;
+	float t167 = t158 + t162;
+	float t168 = t167 * 0x1.6A09E6p-1f;
+	float t169 = t158 - t162;
+	float t170 = t169 * 0x1.6A09E6p-1f;
+	float t171 = t160 - t163;
+	float t172 = t160 + t163;
+	float t173 = 0x1.FF621Ep-1f*t80 + 0x1.91F66p-5f*t95;
+	float t174 = 0x1.91F66p-5f*t80 - 0x1.FF621Ep-1f*t95;
+	float t175 = 0x1.FA7558p-1f*t81 + 0x1.2C8106p-3f*t94;
+	float t176 = -0x1.2C8106p-3f*t81 + 0x1.FA7558p-1f*t94;
+	float t177 = 0x1.F0A7Fp-1f*t82 + 0x1.F19F98p-3f*t93;
+	float t178 = 0x1.F19F98p-3f*t82 - 0x1.F0A7Fp-1f*t93;
+	float t179 = 0x1.E2121p-1f*t83 + 0x1.58F9A8p-2f*t92;
+	float t180 = -0x1.58F9A8p-2f*t83 + 0x1.E2121p-1f*t92;
+	float t181 = 0x1.CED7Bp-1f*t84 + 0x1.B5D1p-2f*t91;
+	float t182 = 0x1.B5D1p-2f*t84 - 0x1.CED7Bp-1f*t91;
+	float t183 = 0x1.B72834p-1f*t85 + 0x1.07387Ap-1f*t90;
+	float t184 = -0x1.07387Ap-1f*t85 + 0x1.B72834p-1f*t90;
+	float t185 = 0x1.9B3E04p-1f*t86 + 0x1.30FF8p-1f*t89;
+	float t186 = 0x1.30FF8p-1f*t86 - 0x1.9B3E04p-1f*t89;
+	float t187 = 0x1.7B5DF2p-1f*t87 + 0x1.57D694p-1f*t88;
+	float t188 = -0x1.57D694p-1f*t87 + 0x1.7B5DF2p-1f*t88;
+	float t189 = t173 + t187;
+	float t190 = t173 - t187;
+	float t191 = t175 + t185;
+	float t192 = t175 - t185;
+	float t193 = t177 + t183;
+	float t194 = t177 - t183;
+	float t195 = t179 + t181;
+	float t196 = t179 - t181;
+	float t197 = t189 + t195;
+	float t198 = t189 - t195;
+	float t199 = t191 + t193;
+	float t200 = t191 - t193;
+	float t201 = 0x1.A9B664p-1f*t196 + 0x1.1C73B4p-1f*t190;
+	float t202 = -0x1.1C73B4p-1f*t196 + 0x1.A9B664p-1f*t190;
+	float t203 = 0x1.F6297Cp-1f*t194 + 0x1.8F8B84p-3f*t192;
+	float t204 = -0x1.8F8B84p-3f*t194 + 0x1.F6297Cp-1f*t192;
+	float t205 = t197 + t199;
+	float t206 = t197 - t199;
+	float t207 = 0x1.87DE2Ap-2f*t200 + 0x1.D906BCp-1f*t198;
+	float t208 = -0x1.D906BCp-1f*t200 + 0x1.87DE2Ap-2f*t198;
+	float t209 = t202 + t203;
+	float t210 = t202 - t203;
+	float t211 = t201 + t204;
+	float t212 = t201 - t204;
+	float t213 = t206 * 0x1.6A09E6p-1f;
+	float t214 = t209 + t211;
+	float t215 = t214 * 0x1.6A09E6p-1f;
+	float t216 = t209 - t211;
+	float t217 = t216 * 0x1.6A09E6p-1f;
+	float t218 = t174 + t188;
+	float t219 = t174 - t188;
+	float t220 = t176 + t186;
+	float t221 = t176 - t186;
+	float t222 = t178 + t184;
+	float t223 = t178 - t184;
+	float t224 = t180 + t182;
+	float t225 = t180 - t182;
+	float t226 = t218 + t224;
+	float t227 = t218 - t224;
+	float t228 = t220 + t222;
+	float t229 = t220 - t222;
+	float t230 = 0x1.A9B664p-1f*t225 + 0x1.1C73B4p-1f*t219;
+	float t231 = -0x1.1C73B4p-1f*t225 + 0x1.A9B664p-1f*t219;
+	float t232 = 0x1.F6297Cp-1f*t223 + 0x1.8F8B84p-3f*t221;
+	float t233 = -0x1.8F8B84p-3f*t223 + 0x1.F6297Cp-1f*t221;
+	float t234 = t226 + t228;
+	float t235 = t226 - t228;
+	float t236 = 0x1.87DE2Ap-2f*t229 + 0x1.D906BCp-1f*t227;
+	float t237 = -0x1.D906BCp-1f*t229 + 0x1.87DE2Ap-2f*t227;
+	float t238 = t231 + t232;
+	float t239 = t231 - t232;
+	float t240 = t230 + t233;
+	float t241 = t230 - t233;
+	float t242 = t235 * 0x1.6A09E6p-1f;
+	float t243 = t238 + t240;
+	float t244 = t243 * 0x1.6A09E6p-1f;
+	float t245 = t238 - t240;
+	float t246 = t245 * 0x1.6A09E6p-1f;
+	float t247 = t215 + t246;
+	float t248 = t215 - t246;
+	float t249 = t207 + t237;
+	float t250 = t207 - t237;
+	float t251 = t210 + t241;
+	float t252 = t210 - t241;
+	float t253 = t213 + t242;
+	float t254 = t213 - t242;
+	float t255 = t212 + t239;
+	float t256 = t212 - t239;
+	float t257 = t208 + t236;
+	float t258 = t208 - t236;
+	float t259 = t217 + t244;
+	float t260 = t217 - t244;
+	float t261 = t1 + t63;
+	float t262 = t3 + t61;
+	float t263 = t5 + t59;
+	float t264 = t7 + t57;
+	float t265 = t9 + t55;
+	float t266 = t11 + t53;
+	float t267 = t13 + t51;
+	float t268 = t15 + t49;
+	float t269 = t17 + t47;
+	float t270 = t19 + t45;
+	float t271 = t21 + t43;
+	float t272 = t23 + t41;
+	float t273 = t25 + t39;
+	float t274 = t27 + t37;
+	float t275 = t29 + t35;
+	float t276 = t31 + t33;
+	float t277 = t1 - t63;
+	float t278 = t3 - t61;
+	float t279 = t5 - t59;
+	float t280 = t7 - t57;
+	float t281 = t9 - t55;
+	float t282 = t11 - t53;
+	float t283 = t13 - t51;
+	float t284 = t15 - t49;
+	float t285 = t17 - t47;
+	float t286 = t19 - t45;
+	float t287 = t21 - t43;
+	float t288 = t23 - t41;
+	float t289 = t25 - t39;
+	float t290 = t27 - t37;
+	float t291 = t29 - t35;
+	float t292 = t31 - t33;
+	float t293 = t261 + t276;
+	float t294 = t262 + t275;
+	float t295 = t263 + t274;
+	float t296 = t264 + t273;
+	float t297 = t265 + t272;
+	float t298 = t266 + t271;
+	float t299 = t267 + t270;
+	float t300 = t268 + t269;
+	float t301 = t261 - t276;
+	float t302 = t262 - t275;
+	float t303 = t263 - t274;
+	float t304 = t264 - t273;
+	float t305 = t265 - t272;
+	float t306 = t266 - t271;
+	float t307 = t267 - t270;
+	float t308 = t268 - t269;
+	float t309 = t293 + t300;
+	float t310 = t293 - t300;
+	float t311 = t294 + t299;
+	float t312 = t294 - t299;
+	float t313 = t295 + t298;
+	float t314 = t295 - t298;
+	float t315 = t296 + t297;
+	float t316 = t296 - t297;
+	float t317 = t309 + t315;
+	float t318 = t309 - t315;
+	float t319 = t311 + t313;
+	float t320 = t311 - t313;
+	float t321 = 0x1.A9B664p-1f*t316 + 0x1.1C73B4p-1f*t310;
+	float t322 = -0x1.1C73B4p-1f*t316 + 0x1.A9B664p-1f*t310;
+	float t323 = 0x1.F6297Cp-1f*t314 + 0x1.8F8B84p-3f*t312;
+	float t324 = -0x1.8F8B84p-3f*t314 + 0x1.F6297Cp-1f*t312;
+	float t325 = t317 + t319;
+	float t326 = t317 - t319;
+	float t327 = 0x1.87DE2Ap-2f*t320 + 0x1.D906BCp-1f*t318;
+	float t328 = -0x1.D906BCp-1f*t320 + 0x1.87DE2Ap-2f*t318;
+	float t329 = t322 + t323;
+	float t330 = t322 - t323;
+	float t331 = t321 + t324;
+	float t332 = t321 - t324;
+	float t333 = t326 * 0x1.6A09E6p-1f;
+	float t334 = t329 + t331;
+	float t335 = t334 * 0x1.6A09E6p-1f;
+	float t336 = t329 - t331;
+	float t337 = t336 * 0x1.6A09E6p-1f;
+	float t338 = 0x1.FD88DAp-1f*t301 + 0x1.917A6Cp-4f*t308;
+	float t339 = 0x1.917A6Cp-4f*t301 - 0x1.FD88DAp-1f*t308;
+	float t340 = 0x1.E9F414p-1f*t302 + 0x1.294064p-2f*t307;
+	float t341 = -0x1.294064p-2f*t302 + 0x1.E9F414p-1f*t307;
+	float t342 = 0x1.C38B3p-1f*t303 + 0x1.E2B5D4p-2f*t306;
+	float t343 = 0x1.E2B5D4p-2f*t303 - 0x1.C38B3p-1f*t306;
+	float t344 = 0x1.8BC808p-1f*t304 + 0x1.44CF32p-1f*t305;
+	float t345 = -0x1.44CF32p-1f*t304 + 0x1.8BC808p-1f*t305;
+	float t346 = t338 + t344;
+	float t347 = t338 - t344;
+	float t348 = t340 + t342;
+	float t349 = t340 - t342;
+	float t350 = t345 + t339;
+	float t351 = t345 - t339;
+	float t352 = t343 + t341;
+	float t353 = t343 - t341;
+	float t354 = t346 + t348;
+	float t355 = t346 - t348;
+	float t356 = 0x1.D906BCp-1f*t347 + 0x1.87DE2Ap-2f*t349;
+	float t357 = 0x1.87DE2Ap-2f*t347 - 0x1.D906BCp-1f*t349;
+	float t358 = t350 + t352;
+	float t359 = t350 - t352;
+	float t360 = 0x1.D906BCp-1f*t351 + 0x1.87DE2Ap-2f*t353;
+	float t361 = 0x1.87DE2Ap-2f*t351 - 0x1.D906BCp-1f*t353;
+	float t362 = t356 - t361;
+	float t363 = t356 + t361;
+	float t364 = t355 + t359;
+	float t365 = t364 * 0x1.6A09E6p-1f;
+	float t366 = t355 - t359;
+	float t367 = t366 * 0x1.6A09E6p-1f;
+	float t368 = t357 - t360;
+	float t369 = t357 + t360;
+	float t370 = 0x1.FF621Ep-1f*t277 + 0x1.91F66p-5f*t292;
+	float t371 = 0x1.91F66p-5f*t277 - 0x1.FF621Ep-1f*t292;
+	float t372 = 0x1.FA7558p-1f*t278 + 0x1.2C8106p-3f*t291;
+	float t373 = -0x1.2C8106p-3f*t278 + 0x1.FA7558p-1f*t291;
+	float t374 = 0x1.F0A7Fp-1f*t279 + 0x1.F19F98p-3f*t290;
+	float t375 = 0x1.F19F98p-3f*t279 - 0x1.F0A7Fp-1f*t290;
+	float t376 = 0x1.E2121p-1f*t280 + 0x1.58F9A8p-2f*t289;
+	float t377 = -0x1.58F9A8p-2f*t280 + 0x1.E2121p-1f*t289;
+	float t378 = 0x1.CED7Bp-1f*t281 + 0x1.B5D1p-2f*t288;
+	float t379 = 0x1.B5D1p-2f*t281 - 0x1.CED7Bp-1f*t288;
+	float t380 = 0x1.B72834p-1f*t282 + 0x1.07387Ap-1f*t287;
+	float t381 = -0x1.07387Ap-1f*t282 + 0x1.B72834p-1f*t287;
+	float t382 = 0x1.9B3E04p-1f*t283 + 0x1.30FF8p-1f*t286;
+	float t383 = 0x1.30FF8p-1f*t283 - 0x1.9B3E04p-1f*t286;
+	float t384 = 0x1.7B5DF2p-1f*t284 + 0x1.57D694p-1f*t285;
+	float t385 = -0x1.57D694p-1f*t284 + 0x1.7B5DF2p-1f*t285;
+	float t386 = t370 + t384;
+	float t387 = t370 - t384;
+	float t388 = t372 + t382;
+	float t389 = t372 - t382;
+	float t390 = t374 + t380;
+	float t391 = t374 - t380;
+	float t392 = t376 + t378;
+	float t393 = t376 - t378;
+	float t394 = t386 + t392;
+	float t395 = t386 - t392;
+	float t396 = t388 + t390;
+	float t397 = t388 - t390;
+	float t398 = 0x1.A9B664p-1f*t393 + 0x1.1C73B4p-1f*t387;
+	float t399 = -0x1.1C73B4p-1f*t393 + 0x1.A9B664p-1f*t387;
+	float t400 = 0x1.F6297Cp-1f*t391 + 0x1.8F8B84p-3f*t389;
+	float t401 = -0x1.8F8B84p-3f*t391 + 0x1.F6297Cp-1f*t389;
+	float t402 = t394 + t396;
+	float t403 = t394 - t396;
+	float t404 = 0x1.87DE2Ap-2f*t397 + 0x1.D906BCp-1f*t395;
+	float t405 = -0x1.D906BCp-1f*t397 + 0x1.87DE2Ap-2f*t395;
+	float t406 = t399 + t400;
+	float t407 = t399 - t400;
+	float t408 = t398 + t401;
+	float t409 = t398 - t401;
+	float t410 = t403 * 0x1.6A09E6p-1f;
+	float t411 = t406 + t408;
+	float t412 = t411 * 0x1.6A09E6p-1f;
+	float t413 = t406 - t408;
+	float t414 = t413 * 0x1.6A09E6p-1f;
+	float t415 = t371 + t385;
+	float t416 = t371 - t385;
+	float t417 = t373 + t383;
+	float t418 = t373 - t383;
+	float t419 = t375 + t381;
+	float t420 = t375 - t381;
+	float t421 = t377 + t379;
+	float t422 = t377 - t379;
+	float t423 = t415 + t421;
+	float t424 = t415 - t421;
+	float t425 = t417 + t419;
+	float t426 = t417 - t419;
+	float t427 = 0x1.A9B664p-1f*t422 + 0x1.1C73B4p-1f*t416;
+	float t428 = -0x1.1C73B4p-1f*t422 + 0x1.A9B664p-1f*t416;
+	float t429 = 0x1.F6297Cp-1f*t420 + 0x1.8F8B84p-3f*t418;
+	float t430 = -0x1.8F8B84p-3f*t420 + 0x1.F6297Cp-1f*t418;
+	float t431 = t423 + t425;
+	float t432 = t423 - t425;
+	float t433 = 0x1.87DE2Ap-2f*t426 + 0x1.D906BCp-1f*t424;
+	float t434 = -0x1.D906BCp-1f*t426 + 0x1.87DE2Ap-2f*t424;
+	float t435 = t428 + t429;
+	float t436 = t428 - t429;
+	float t437 = t427 + t430;
+	float t438 = t427 - t430;
+	float t439 = t432 * 0x1.6A09E6p-1f;
+	float t440 = t435 + t437;
+	float t441 = t440 * 0x1.6A09E6p-1f;
+	float t442 = t435 - t437;
+	float t443 = t442 * 0x1.6A09E6p-1f;
+	float t444 = t412 + t443;
+	float t445 = t412 - t443;
+	float t446 = t404 + t434;
+	float t447 = t404 - t434;
+	float t448 = t407 + t438;
+	float t449 = t407 - t438;
+	float t450 = t410 + t439;
+	float t451 = t410 - t439;
+	float t452 = t409 + t436;
+	float t453 = t409 - t436;
+	float t454 = t405 + t433;
+	float t455 = t405 - t433;
+	float t456 = t414 + t441;
+	float t457 = t414 - t441;
+	float t458 = t205 + t431;
+	float t459 = t205 - t431;
+	float t460 = t157 + t358;
+	float t461 = t157 - t358;
+	float t462 = t247 + t457;
+	float t463 = t247 - t457;
+	float t464 = t138 + t337;
+	float t465 = t138 - t337;
+	float t466 = t248 + t456;
+	float t467 = t248 - t456;
+	float t468 = t165 + t369;
+	float t469 = t165 - t369;
+	float t470 = t249 + t455;
+	float t471 = t249 - t455;
+	float t472 = t130 + t328;
+	float t473 = t130 - t328;
+	float t474 = t250 + t454;
+	float t475 = t250 - t454;
+	float t476 = t166 + t368;
+	float t477 = t166 - t368;
+	float t478 = t251 + t453;
+	float t479 = t251 - t453;
+	float t480 = t133 + t332;
+	float t481 = t133 - t332;
+	float t482 = t252 + t452;
+	float t483 = t252 - t452;
+	float t484 = t168 + t367;
+	float t485 = t168 - t367;
+	float t486 = t253 + t451;
+	float t487 = t253 - t451;
+	float t488 = t136 + t333;
+	float t489 = t136 - t333;
+	float t490 = t254 + t450;
+	float t491 = t254 - t450;
+	float t492 = t170 + t365;
+	float t493 = t170 - t365;
+	float t494 = t255 + t449;
+	float t495 = t255 - t449;
+	float t496 = t135 + t330;
+	float t497 = t135 - t330;
+	float t498 = t256 + t448;
+	float t499 = t256 - t448;
+	float t500 = t171 + t363;
+	float t501 = t171 - t363;
+	float t502 = t257 + t447;
+	float t503 = t257 - t447;
+	float t504 = t131 + t327;
+	float t505 = t131 - t327;
+	float t506 = t258 + t446;
+	float t507 = t258 - t446;
+	float t508 = t172 + t362;
+	float t509 = t172 - t362;
+	float t510 = t259 + t445;
+	float t511 = t259 - t445;
+	float t512 = t140 + t335;
+	float t513 = t140 - t335;
+	float t514 = t260 + t444;
+	float t515 = t260 - t444;
+	float t516 = t161 + t354;
+	float t517 = t161 - t354;
+	float t518 = t234 + t402;
+	float t519 = t234 - t402;
+	x[0] = t128;
+	x[1] = t458;
+	x[2] = t459;
+	x[3] = t460;
+	x[4] = t461;
+	x[5] = t462;
+	x[6] = t463;
+	x[7] = t464;
+	x[8] = t465;
+	x[9] = t466;
+	x[10] = t467;
+	x[11] = t468;
+	x[12] = t469;
+	x[13] = t470;
+	x[14] = t471;
+	x[15] = t472;
+	x[16] = t473;
+	x[17] = t474;
+	x[18] = t475;
+	x[19] = t476;
+	x[20] = t477;
+	x[21] = t478;
+	x[22] = t479;
+	x[23] = t480;
+	x[24] = t481;
+	x[25] = t482;
+	x[26] = t483;
+	x[27] = t484;
+	x[28] = t485;
+	x[29] = t486;
+	x[30] = t487;
+	x[31] = t488;
+	x[32] = t489;
+	x[33] = t490;
+	x[34] = t491;
+	x[35] = t492;
+	x[36] = t493;
+	x[37] = t494;
+	x[38] = t495;
+	x[39] = t496;
+	x[40] = t497;
+	x[41] = t498;
+	x[42] = t499;
+	x[43] = t500;
+	x[44] = t501;
+	x[45] = t502;
+	x[46] = t503;
+	x[47] = t504;
+	x[48] = t505;
+	x[49] = t506;
+	x[50] = t507;
+	x[51] = t508;
+	x[52] = t509;
+	x[53] = t510;
+	x[54] = t511;
+	x[55] = t512;
+	x[56] = t513;
+	x[57] = t514;
+	x[58] = t515;
+	x[59] = t516;
+	x[60] = t517;
+	x[61] = t518;
+	x[62] = t519;
+	x[63] = t325;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT4T)
+/**************************************/
+
+//! DCT-IV (transposed) (N=16)
+FOURIER_CODELET void DCT4T_16(float *x) {
+	float t0 = x[0] * 2.0f;
+	float t1 = x[1] + x[2];
+	float t2 = x[1] - x[2];
+	float t3 = x[3] + x[4];
+	float t4 = x[3] - x[4];
+	float t5 = x[5] + x[6];
+	float t6 = x[5] - x[6];
+	float t7 = x[7] + x[8];
+	float t8 = x[7] - x[8];
+	float t9 = x[9] + x[10];
+	float t10 = x[9] - x[10];
+	float t11 = x[11] + x[12];
+	float t12 = x[11] - x[12];
+	float t13 = x[13] + x[14];
+	float t14 = x[13] - x[14];
+	float t15 = x[15] * 2.0f;
+	float t16 = t7 * 0x1.6A09E6p-1f;
+	float t17 = t1 + t13;
+	float t18 = t17 * 0x1.6A09E6p-1f;
+	float t19 = t1 - t13;
+	float t20 = t19 * 0x1.6A09E6p-1f;
+	float t21 = t0 * 0.5f;
+	float t22 = t21 + t16;
+	float t23 = t21 - t16;
+	float t24 = 0x1.87DE2Ap-2f*t3 - 0x1.D906BCp-1f*t11;
+	float t25 = 0x1.D906BCp-1f*t3 + 0x1.87DE2Ap-2f*t11;
+	float t26 = t18 + t5;
+	float t27 = t18 - t5;
+	float t28 = t20 + t9;
+	float t29 = t20 - t9;
+	float t30 = t22 + t25;
+	float t31 = t22 - t25;
+	float t32 = t23 + t24;
+	float t33 = t23 - t24;
+	float t34 = 0x1.A9B664p-1f*t28 - 0x1.1C73B4p-1f*t26;
+	float t35 = 0x1.1C73B4p-1f*t28 + 0x1.A9B664p-1f*t26;
+	float t36 = 0x1.F6297Cp-1f*t27 - 0x1.8F8B84p-3f*t29;
+	float t37 = 0x1.8F8B84p-3f*t27 + 0x1.F6297Cp-1f*t29;
+	float t38 = t30 + t35;
+	float t39 = t30 - t35;
+	float t40 = t32 + t37;
+	float t41 = t32 - t37;
+	float t42 = t33 + t36;
+	float t43 = t33 - t36;
+	float t44 = t31 + t34;
+	float t45 = t31 - t34;
+	float t46 = t8 * 0x1.6A09E6p-1f;
+	float t47 = t14 + t2;
+	float t48 = t47 * 0x1.6A09E6p-1f;
+	float t49 = t14 - t2;
+	float t50 = t49 * 0x1.6A09E6p-1f;
+	float t51 = t15 * 0.5f;
+	float t52 = t51 + t46;
+	float t53 = t51 - t46;
+	float t54 = 0x1.87DE2Ap-2f*t12 - 0x1.D906BCp-1f*t4;
+	float t55 = 0x1.D906BCp-1f*t12 + 0x1.87DE2Ap-2f*t4;
+	float t56 = t48 + t10;
+	float t57 = t48 - t10;
+	float t58 = t50 + t6;
+	float t59 = t50 - t6;
+	float t60 = t52 + t55;
+	float t61 = t52 - t55;
+	float t62 = t53 + t54;
+	float t63 = t53 - t54;
+	float t64 = 0x1.A9B664p-1f*t58 - 0x1.1C73B4p-1f*t56;
+	float t65 = 0x1.1C73B4p-1f*t58 + 0x1.A9B664p-1f*t56;
+	float t66 = 0x1.F6297Cp-1f*t57 - 0x1.8F8B84p-3f*t59;
+	float t67 = 0x1.8F8B84p-3f*t57 + 0x1.F6297Cp-1f*t59;
+	float t68 = t60 + t65;
+	float t69 = t60 - t65;
+	float t70 = t62 + t67;
+	float t71 = t62 - t67;
+	float t72 = t63 + t66;
+	float t73 = t63 - t66;
+	float t74 = t61 + t64;
+	float t75 = t61 - t64;
+	float t76 = 0x1.FF621Ep-1f*t38 + 0x1.91F66p-5f*t68;
+	float t77 = 0x1.91F66p-5f*t38 - 0x1.FF621Ep-1f*t68;
+	float t78 = 0x1.FA7558p-1f*t40 - 0x1.2C8106p-3f*t70;
+	float t79 = 0x1.2C8106p-3f*t40 + 0x1.FA7558p-1f*t70;
+	float t80 = 0x1.F0A7Fp-1f*t42 + 0x1.F19F98p-3f*t72;
+	float t81 = 0x1.F19F98p-3f*t42 - 0x1.F0A7Fp-1f*t72;
+	float t82 = 0x1.E2121p-1f*t44 - 0x1.58F9A8p-2f*t74;
+	float t83 = 0x1.58F9A8p-2f*t44 + 0x1.E2121p-1f*t74;
+	float t84 = 0x1.CED7Bp-1f*t45 + 0x1.B5D1p-2f*t75;
+	float t85 = 0x1.B5D1p-2f*t45 - 0x1.CED7Bp-1f*t75;
+	float t86 = 0x1.B72834p-1f*t43 - 0x1.07387Ap-1f*t73;
+	float t87 = 0x1.07387Ap-1f*t43 + 0x1.B72834p-1f*t73;
+	float t88 = 0x1.9B3E04p-1f*t41 + 0x1.30FF8p-1f*t71;
+	float t89 = 0x1.30FF8p-1f*t41 - 0x1.9B3E04p-1f*t71;
+	float t90 = 0x1.7B5DF2p-1f*t39 - 0x1.57D694p-1f*t69;
+	float t91 = 0x1.57D694p-1f*t39 + 0x1.7B5DF2p-1f*t69;
+	x[0] = t76;
+	x[1] = t78;
+	x[2] = t80;
+	x[3] = t82;
+	x[4] = t84;
+	x[5] = t86;
+	x[6] = t88;
+	x[7] = t90;
+	x[8] = t91;
+	x[9] = t89;
+	x[10] = t87;
+	x[11] = t85;
+	x[12] = t83;
+	x[13] = t81;
+	x[14] = t79;
+	x[15] = t77;
+}
+
+//! DCT-IV (transposed) (N=32)
+FOURIER_CODELET void DCT4T_32(float *x) {
+	float t0 = x[0] * 2.0f;
+	float t1 = x[1] + x[2];
+	float t2 = x[1] - x[2];
+	float t3 = x[3] + x[4];
+	float t4 = x[3] - x[4];
+	float t5 = x[5] + x[6];
+	float t6 = x[5] - x[6];
+	float t7 = x[7] + x[8];
+	float t8 = x[7] - x[8];
+	float t9 = x[9] + x[10];
+	float t10 = x[9] - x[10];
+	float t11 = x[11] + x[12];
+	float t12 = x[11] - x[12];
+	float t13 = x[13] + x[14];
+	float t14 = x[13] - x[14];
+	float t15 = x[15] + x[16];
+	float t16 = x[15] - x[16];
+	float t17 = x[17] + x[18];
+	float t18 = x[17] - x[18];
+	float t19 = x[19] + x[20];
+	float t20 = x[19] - x[20];
+	float t21 = x[21] + x[22];
+	float t22 = x[21] - x[22];
+	float t23 = x[23] + x[24];
+	float t24 = x[23] - x[24];
+	float t25 = x[25] + x[26];
+	float t26 = x[25] - x[26];
+	float t27 = x[27] + x[28];
+	float t28 = x[27] - x[28];
+	float t29 = x[29] + x[30];
+	float t30 = x[29] - x[30];
+	float t31 = x[31] * 2.0f;
+	float t32 = t15 * 0x1.6A09E6p-1f;
+	float t33 = t3 + t27;
+	float t34 = t33 * 0x1.6A09E6p-1f;
+	float t35 = t3 - t27;
+	float t36 = t35 * 0x1.6A09E6p-1f;
+	float t37 = t0 * 0.5f;
+	float t38 = t37 + t32;
+	float t39 = t37 - t32;
+	float t40 = 0x1.87DE2Ap-2f*t7 - 0x1.D906BCp-1f*t23;
+	float t41 = 0x1.D906BCp-1f*t7 + 0x1.87DE2Ap-2f*t23;
+	float t42 = t34 + t11;
+	float t43 = t34 - t11;
+	float t44 = t36 + t19;
+	float t45 = t36 - t19;
+	float t46 = t38 + t41;
+	float t47 = t38 - t41;
+	float t48 = t39 + t40;
+	float t49 = t39 - t40;
+	float t50 = 0x1.A9B664p-1f*t44 - 0x1.1C73B4p-1f*t42;
+	float t51 = 0x1.1C73B4p-1f*t44 + 0x1.A9B664p-1f*t42;
+	float t52 = 0x1.F6297Cp-1f*t43 - 0x1.8F8B84p-3f*t45;
+	float t53 = 0x1.8F8B84p-3f*t43 + 0x1.F6297Cp-1f*t45;
+	float t54 = t46 + t51;
+	float t55 = t46 - t51;
+	float t56 = t48 + t53;
+	float t57 = t48 - t53;
+	float t58 = t49 + t52;
+	float t59 = t49 - t52;
+	float t60 = t47 + t50;
+	float t61 = t47 - t50;
+	float t62 = t9 + t5;
+	float t63 = t9 - t5;
+	float t64 = t13 + t17;
+	float t65 = t64 * 0x1.6A09E6p-1f;
+	float t66 = t13 - t17;
+	float t67 = t66 * 0x1.6A09E6p-1f;
+	float t68 = t25 + t21;
+	float t69 = t25 - t21;
+	float t70 = t1 + t65;
+	float t71 = t1 - t65;
+	float t72 = 0x1.D906BCp-1f*t62 + 0x1.87DE2Ap-2f*t68;
+	float t73 = 0x1.87DE2Ap-2f*t62 - 0x1.D906BCp-1f*t68;
+	float t74 = t29 + t67;
+	float t75 = t29 - t67;
+	float t76 = 0x1.D906BCp-1f*t69 + 0x1.87DE2Ap-2f*t63;
+	float t77 = 0x1.87DE2Ap-2f*t69 - 0x1.D906BCp-1f*t63;
+	float t78 = t70 + t72;
+	float t79 = t70 - t72;
+	float t80 = t71 + t73;
+	float t81 = t71 - t73;
+	float t82 = t74 + t76;
+	float t83 = t74 - t76;
+	float t84 = t75 + t77;
+	float t85 = t75 - t77;
+	float t86 = 0x1.FD88DAp-1f*t78 + 0x1.917A6Cp-4f*t83;
+	float t87 = 0x1.917A6Cp-4f*t78 - 0x1.FD88DAp-1f*t83;
+	float t88 = 0x1.E9F414p-1f*t80 - 0x1.294064p-2f*t85;
+	float t89 = 0x1.294064p-2f*t80 + 0x1.E9F414p-1f*t85;
+	float t90 = 0x1.C38B3p-1f*t81 + 0x1.E2B5D4p-2f*t84;
+	float t91 = 0x1.E2B5D4p-2f*t81 - 0x1.C38B3p-1f*t84;
+	float t92 = 0x1.8BC808p-1f*t79 - 0x1.44CF32p-1f*t82;
+	float t93 = 0x1.44CF32p-1f*t79 + 0x1.8BC808p-1f*t82;
+	float t94 = t54 + t86;
+	float t95 = t54 - t86;
+	float t96 = t56 + t88;
+	float t97 = t56 - t88;
+	float t98 = t58 + t90;
+	float t99 = t58 - t90;
+	float t100 = t60 + t92;
+	float t101 = t60 - t92;
+	float t102 = t61 + t93;
+	float t103 = t61 - t93;
+	float t104 = t59 + t91;
+	float t105 = t59 - t91;
+	float t106 = t57 + t89;
+	float t107 = t57 - t89;
+	float t108 = t55 + t87;
+	float t109 = t55 - t87;
+	float t110 = t16 * 0x1.6A09E6p-1f;
+	float t111 = t28 + t4;
+	float t112 = t111 * 0x1.6A09E6p-1f;
+	float t113 = t28 - t4;
+	float t114 = t113 * 0x1.6A09E6p-1f;
+	float t115 = t31 * 0.5f;
+	float t116 = t115 + t110;
+	float t117 = t115 - t110;
+	float t118 = 0x1.87DE2Ap-2f*t24 - 0x1.D906BCp-1f*t8;
+	float t119 = 0x1.D906BCp-1f*t24 + 0x1.87DE2Ap-2f*t8;
+	float t120 = t112 + t20;
+	float t121 = t112 - t20;
+	float t122 = t114 + t12;
+	float t123 = t114 - t12;
+	float t124 = t116 + t119;
+	float t125 = t116 - t119;
+	float t126 = t117 + t118;
+	float t127 = t117 - t118;
+	float t128 = 0x1.A9B664p-1f*t122 - 0x1.1C73B4p-1f*t120;
+	float t129 = 0x1.1C73B4p-1f*t122 + 0x1.A9B664p-1f*t120;
+	float t130 = 0x1.F6297Cp-1f*t121 - 0x1.8F8B84p-3f*t123;
+	float t131 = 0x1.8F8B84p-3f*t121 + 0x1.F6297Cp-1f*t123;
+	float t132 = t124 + t129;
+	float t133 = t124 - t129;
+	float t134 = t126 + t131;
+	float t135 = t126 - t131;
+	float t136 = t127 + t130;
+	float t137 = t127 - t130;
+	float t138 = t125 + t128;
+	float t139 = t125 - t128;
+	float t140 = t22 + t26;
+	float t141 = t22 - t26;
+	float t142 = t18 + t14;
+	float t143 = t142 * 0x1.6A09E6p-1f;
+	float t144 = t18 - t14;
+	float t145 = t144 * 0x1.6A09E6p-1f;
+	float t146 = t6 + t10;
+	float t147 = t6 - t10;
+	float t148 = t30 + t143;
+	float t149 = t30 - t143;
+	float t150 = 0x1.D906BCp-1f*t140 + 0x1.87DE2Ap-2f*t146;
+	float t151 = 0x1.87DE2Ap-2f*t140 - 0x1.D906BCp-1f*t146;
+	float t152 = t2 + t145;
+	float t153 = t2 - t145;
+	float t154 = 0x1.D906BCp-1f*t147 + 0x1.87DE2Ap-2f*t141;
+	float t155 = 0x1.87DE2Ap-2f*t147 - 0x1.D906BCp-1f*t141;
+	float t156 = t148 + t150;
+	float t157 = t148 - t150;
+	float t158 = t149 + t151;
+	float t159 = t149 - t151;
+	float t160 = t152 + t154;
+	float t161 = t152 - t154;
+	float t162 = t153 + t155;
+	float t163 = t153 - t155;
+	float t164 = 0x1.FD88DAp-1f*t156 + 0x1.917A6Cp-4f*t161;
+	float t165 = 0x1.917A6Cp-4f*t156 - 0x1.FD88DAp-1f*t161;
+	float t166 = 0x1.E9F414p-1f*t158 - 0x1.294064p-2f*t163;
+	float t167 = 0x1.294064p-2f*t158 + 0x1.E9F414p-1f*t163;
+	float t168 = 0x1.C38B3p-1f*t159 + 0x1.E2B5D4p-2f*t162;
+	float t169 = 0x1.E2B5D4p-2f*t159 - 0x1.C38B3p-1f*t162;
+	float t170 = 0x1.8BC808p-1f*t157 - 0x1.44CF32p-1f*t160;
+	float t171 = 0x1.44CF32p-1f*t157 + 0x1.8BC808p-1f*t160;
+	float t172 = t132 + t164;
+	float t173 = t132 - t164;
+	float t174 = t134 + t166;
+	float t175 = t134 - t166;
+	float t176 = t136 + t168;
+	float t177 = t136 - t168;
+	float t178 = t138 + t170;
+	float t179 = t138 - t170;
+	float t180 = t139 + t171;
+	float t181 = t139 - t171;
+	float t182 = t137 + t169;
+	float t183 = t137 - t169;
+	float t184 = t135 + t167;
+	float t185 = t135 - t167;
+	float t186 = t133 + t165;
+	float t187 = t133 - t165;
+	float t188 = 0x1.FFD886p-1f*t94 + 0x1.92156p-6f*t172;
+	float t189 = 0x1.92156p-6f*t94 - 0x1.FFD886p-1f*t172;
+	float t190 = 0x1.FE9CDAp-1f*t96 - 0x1.2D520Ap-4f*t174;
+	float t191 = 0x1.2D520Ap-4f*t96 + 0x1.FE9CDAp-1f*t174;
+	float t192 = 0x1.FC2648p-1f*t98 + 0x1.F564E6p-4f*t176;
+	float t193 = 0x1.F564E6p-4f*t98 - 0x1.FC2648p-1f*t176;
+	float t194 = 0x1.F8765p-1f*t100 - 0x1.5E2144p-3f*t178;
+	float t195 = 0x1.5E2144p-3f*t100 + 0x1.F8765p-1f*t178;
+	float t196 = 0x1.F38F3Ap-1f*t102 + 0x1.C0B826p-3f*t180;
+	float t197 = 0x1.C0B826p-3f*t102 - 0x1.F38F3Ap-1f*t180;
+	float t198 = 0x1.ED740Ep-1f*t104 - 0x1.111D26p-2f*t182;
+	float t199 = 0x1.111D26p-2f*t104 + 0x1.ED740Ep-1f*t182;
+	float t200 = 0x1.E6288Ep-1f*t106 + 0x1.4135CAp-2f*t184;
+	float t201 = 0x1.4135CAp-2f*t106 - 0x1.E6288Ep-1f*t184;
+	float t202 = 0x1.DDB13Cp-1f*t108 - 0x1.708854p-2f*t186;
+	float t203 = 0x1.708854p-2f*t108 + 0x1.DDB13Cp-1f*t186;
+	float t204 = 0x1.D4134Ep-1f*t109 + 0x1.9EF794p-2f*t187;
+	float t205 = 0x1.9EF794p-2f*t109 - 0x1.D4134Ep-1f*t187;
+	float t206 = 0x1.C954B2p-1f*t107 - 0x1.CC66EAp-2f*t185;
+	float t207 = 0x1.CC66EAp-2f*t107 + 0x1.C954B2p-1f*t185;
+	float t208 = 0x1.BD7C0Ap-1f*t105 + 0x1.F8BA4Ep-2f*t183;
+	float t209 = 0x1.F8BA4Ep-2f*t105 - 0x1.BD7C0Ap-1f*t183;
+	float t210 = 0x1.B090A6p-1f*t103 - 0x1.11EB36p-1f*t181;
+	float t211 = 0x1.11EB36p-1f*t103 + 0x1.B090A6p-1f*t181;
+	float t212 = 0x1.A29A7Ap-1f*t101 + 0x1.26D054p-1f*t179;
+	float t213 = 0x1.26D054p-1f*t101 - 0x1.A29A7Ap-1f*t179;
+	float t214 = 0x1.93A224p-1f*t99 - 0x1.3AFFA2p-1f*t177;
+	float t215 = 0x1.3AFFA2p-1f*t99 + 0x1.93A224p-1f*t177;
+	float t216 = 0x1.83B0Ep-1f*t97 + 0x1.4E6CACp-1f*t175;
+	float t217 = 0x1.4E6CACp-1f*t97 - 0x1.83B0Ep-1f*t175;
+	float t218 = 0x1.72D084p-1f*t95 - 0x1.610B76p-1f*t173;
+	float t219 = 0x1.610B76p-1f*t95 + 0x1.72D084p-1f*t173;
+	x[0] = t188;
+	x[1] = t190;
+	x[2] = t192;
+	x[3] = t194;
+	x[4] = t196;
+	x[5] = t198;
+	x[6] = t200;
+	x[7] = t202;
+	x[8] = t204;
+	x[9] = t206;
+	x[10] = t208;
+	x[11] = t210;
+	x[12] = t212;
+	x[13] = t214;
+	x[14] = t216;
+	x[15] = t218;
+	x[16] = t219;
+	x[17] = t217;
+	x[18] = t215;
+	x[19] = t213;
+	x[20] = t211;
+	x[21] = t209;
+	x[22] = t207;
+	x[23] = t205;
+	x[24] = t203;
+	x[25] = t201;
+	x[26] = t199;
+	x[27] = t197;
+	x[28] = t195;
+	x[29] = t193;
+	x[30] = t191;
+	x[31] = t189;
+}
+
+//! DCT-IV (transposed) (N=64)
+FOURIER_CODELET void DCT4T_64(float *x) {
+	float t0 = x[0] * 2.0f;
+	float t1 = x[1] + x[2];
+	float t2 = x[1] - x[2];
+	float t3 = x[3] + x[4];
+	float t4 = x[3] - x[4];
+	float t5 = x[5] + x[6];
+	float t6 = x[5] - x[6];
+	float t7 = x[7] + x[8];
+	float t8 = x[7] - x[8];
+	float t9 = x[9] + x[10];
+	float t10 = x[9] - x[10];
+	float t11 = x[11] + x[12];
+	float t12 = x[11] - x[12];
+	float t13 = x[13] + x[14];
+	float t14 = x[13] - x[14];
+	float t15 = x[15] + x[16];
+	float t16 = x[15] - x[16];
+	float t17 = x[17] + x[18];
+	float t18 = x[17] - x[18];
+	float t19 = x[19] + x[20];
+	float t20 = x[19] - x[20];
+	float t21 = x[21] + x[22];
+	float t22 = x[21] - x[22];
+	float t23 = x[23] + x[24];
+	float t24 = x[23] - x[24];
+	float t25 = x[25] + x[26];
+	float t26 = x[25] - x[26];
+	float t27 = x[27] + x[28];
+	float t28 = x[27] - x[28];
+	float t29 = x[29] + x[30];
+	float t30 = x[29] - x[30];
+	float t31 = x[31] + x[32];
+	float t32 = x[31] - x[32];
+	float t33 = x[33] + x[34];
+	float t34 = x[33] - x[34];
+	float t35 = x[35] + x[36];
+	float t36 = x[35] - x[36];
+	float t37 = x[37] + x[38];
+	float t38 = x[37] - x[38];
+	float t39 = x[39] + x[40];
+	float t40 = x[39] - x[40];
+	float t41 = x[41] + x[42];
+	float t42 = x[41] - x[42];
+	float t43 = x[43] + x[44];
+	float t44 = x[43] - x[44];
+	float t45 = x[45] + x[46];
+	float t46 = x[45] - x[46];
+	float t47 = x[47] + x[48];
+	float t48 = x[47] - x[48];
+	float t49 = x[49] + x[50];
+	float t50 = x[49] - x[50];
+	float t51 = x[51] + x[52];
+	float t52 = x[51] - x[52];
+	float t53 = x[53] + x[54];
+	float t54 = x[53] - x[54];
+	float t55 = x[55] + x[56];
+	float t56 = x[55] - x[56];
+	float t57 = x[57] + x[58];
+	float t58 = x[57] - x[58];
+	float t59 = x[59] + x[60];
+	float t60 = x[59] - x[60];
+	float t61 = x[61] + x[62];
+	float t62 = x[61] - x[62];
+	float t63 = x[63] * 2.0f;
+	float t64 = t31 * 0x1.6A09E6p-1f;
+	float t65 = t7 + t55;
+	float t66 = t65 * 0x1.6A09E6p-1f;
+	float t67 = t7 - t55;
+	float t68 = t67 * 0x1.6A09E6p-1f;
+	float t69 = t0 * 0.5f;
+	float t70 = t69 + t64;
+	float t71 = t69 - t64;
+	float t72 = 0x1.87DE2Ap-2f*t15 - 0x1.D906BCp-1f*t47;
+	float t73 = 0x1.D906BCp-1f*t15 + 0x1.87DE2Ap-2f*t47;
+	float t74 = t66 + t23;
+	float t75 = t66 - t23;
+	float t76 = t68 + t39;
+	float t77 = t68 - t39;
+	float t78 = t70 + t73;
+	float t79 = t70 - t73;
+	float t80 = t71 + t72;
+	float t81 = t71 - t72;
+	float t82 = 0x1.A9B664p-1f*t76 - 0x1.1C73B4p-1f*t74;
+	float t83 = 0x1.1C73B4p-1f*t76 + 0x1.A9B664p-1f*t74;
+	float t84 = 0x1.F6297Cp-1f*t75 - 0x1.8F8B84p-3f*t77;
+	float t85 = 0x1.8F8B84p-3f*t75 + 0x1.F6297Cp-1f*t77;
+	float t86 = t78 + t83;
+	float t87 = t78 - t83;
+	float t88 = t80 + t85;
+	float t89 = t80 - t85;
+	float t90 = t81 + t84;
+	float t91 = t81 - t84;
+	float t92 = t79 + t82;
+	float t93 = t79 - t82;
+	float t94 = t19 + t11;
+	float t95 = t19 - t11;
+	float t96 = t27 + t35;
+	float t97 = t96 * 0x1.6A09E6p-1f;
+	float t98 = t27 - t35;
+	float t99 = t98 * 0x1.6A09E6p-1f;
+	float t100 = t51 + t43;
+	float t101 = t51 - t43;
+	float t102 = t3 + t97;
+	float t103 = t3 - t97;
+	float t104 = 0x1.D906BCp-1f*t94 + 0x1.87DE2Ap-2f*t100;
+	float t105 = 0x1.87DE2Ap-2f*t94 - 0x1.D906BCp-1f*t100;
+	float t106 = t59 + t99;
+	float t107 = t59 - t99;
+	float t108 = 0x1.D906BCp-1f*t101 + 0x1.87DE2Ap-2f*t95;
+	float t109 = 0x1.87DE2Ap-2f*t101 - 0x1.D906BCp-1f*t95;
+	float t110 = t102 + t104;
+	float t111 = t102 - t104;
+	float t112 = t103 + t105;
+	float t113 = t103 - t105;
+	float t114 = t106 + t108;
+	float t115 = t106 - t108;
+	float t116 = t107 + t109;
+	float t117 = t107 - t109;
+	float t118 = 0x1.FD88DAp-1f*t110 + 0x1.917A6Cp-4f*t115;
+	float t119 = 0x1.917A6Cp-4f*t110 - 0x1.FD88DAp-1f*t115;
+	float t120 = 0x1.E9F414p-1f*t112 - 0x1.294064p-2f*t117;
+	float t121 = 0x1.294064p-2f*t112 + 0x1.E9F414p-1f*t117;
+	float t122 = 0x1.C38B3p-1f*t113 + 0x1.E2B5D4p-2f*t116;
+	float t123 = 0x1.E2B5D4p-2f*t113 - 0x1.C38B3p-1f*t116;
+	float t124 = 0x1.8BC808p-1f*t111 - 0x1.44CF32p-1f*t114;
+	float t125 = 0x1.44CF32p-1f*t111 + 0x1.8BC808p-1f*t114;
+	float t126 = t86 + t118;
+	float t127 = t86 - t118;
+	float t128 = t88 + t120;
+	float t129 = t88 - t120;
+	float t130 = t90 + t122;
+	float t131 = t90 - t122;
+	float t132 = t92 + t124;
+	float t133 = t92 - t124;
+	float t134 = t93 + t125;
+	float t135 = t93 - t125;
+	float t136 = t91 + t123;
+	float t137 = t91 - t123;
+	float t138 = t89 + t121;
+	float t139 = t89 - t121;
+	float t140 = t87 + t119;
+	float t141 = t87 - t119;
+	float t142 = t1 * 2.0f;
+	float t143 = t5 + t9;
+	float t144 = t5 - t9;
+	float t145 = t13 + t17;
+	float t146 = t13 - t17;
+	float t147 = t21 + t25;
+	float t148 = t21 - t25;
+	float t149 = t29 + t33;
+	float t150 = t29 - t33;
+	float t151 = t37 + t41;
+	float t152 = t37 - t41;
+	float t153 = t45 + t49;
+	float t154 = t45 - t49;
+	float t155 = t53 + t57;
+	float t156 = t53 - t57;
+	float t157 = t61 * 2.0f;
+	float t158 = t149 * 0x1.6A09E6p-1f;
+	float t159 = t143 + t155;
+	float t160 = t159 * 0x1.6A09E6p-1f;
+	float t161 = t143 - t155;
+	float t162 = t161 * 0x1.6A09E6p-1f;
+	float t163 = t142 * 0.5f;
+	float t164 = t163 + t158;
+	float t165 = t163 - t158;
+	float t166 = 0x1.87DE2Ap-2f*t145 - 0x1.D906BCp-1f*t153;
+	float t167 = 0x1.D906BCp-1f*t145 + 0x1.87DE2Ap-2f*t153;
+	float t168 = t160 + t147;
+	float t169 = t160 - t147;
+	float t170 = t162 + t151;
+	float t171 = t162 - t151;
+	float t172 = t164 + t167;
+	float t173 = t164 - t167;
+	float t174 = t165 + t166;
+	float t175 = t165 - t166;
+	float t176 = 0x1.A9B664p-1f*t170 - 0x1.1C73B4p-1f*t168;
+	float t177 = 0x1.1C73B4p-1f*t170 + 0x1.A9B664p-1f*t168;
+	float t178 = 0x1.F6297Cp-1f*t169 - 0x1.8F8B84p-3f*t171;
+	float t179 = 0x1.8F8B84p-3f*t169 + 0x1.F6297Cp-1f*t171;
+	float t180 = t172 + t177;
+	float t181 = t172 - t177;
+	float t182 = t174 + t179;
+	float t183 = t174 - t179;
+	float t184 = t175 + t178;
+	float t185 = t175 - t178;
+	float t186 = t173 + t176;
+	float t187 = t173 - t176;
+	float t188 = t150 * 0x1.6A09E6p-1f;
+	float t189 = t156 + t144;
+	float t190 = t189 * 0x1.6A09E6p-1f;
+	float t191 = t156 - t144;
+	float t192 = t191 * 0x1.6A09E6p-1f;
+	float t193 = t157 * 0.5f;
+	float t194 = t193 + t188;
+	float t195 = t193 - t188;
+	float t196 = 0x1.87DE2Ap-2f*t154 - 0x1.D906BCp-1f*t146;
+	float t197 = 0x1.D906BCp-1f*t154 + 0x1.87DE2Ap-2f*t146;
+	float t198 = t190 + t152;
+	float t199 = t190 - t152;
+	float t200 = t192 + t148;
+	float t201 = t192 - t148;
+	float t202 = t194 + t197;
+	float t203 = t194 - t197;
+	float t204 = t195 + t196;
+	float t205 = t195 - t196;
+	float t206 = 0x1.A9B664p-1f*t200 - 0x1.1C73B4p-1f*t198;
+	float t207 = 0x1.1C73B4p-1f*t200 + 0x1.A9B664p-1f*t198;
+	float t208 = 0x1.F6297Cp-1f*t199 - 0x1.8F8B84p-3f*t201;
+	float t209 = 0x1.8F8B84p-3f*t199 + 0x1.F6297Cp-1f*t201;
+	float t210 = t202 + t207;
+	float t211 = t202 - t207;
+	float t212 = t204 + t209;
+	float t213 = t204 - t209;
+	float t214 = t205 + t208;
+	float t215 = t205 - t208;
+	float t216 = t203 + t206;
+	float t217 = t203 - t206;
+	float t218 = 0x1.FF621Ep-1f*t180 + 0x1.91F66p-5f*t210;
+	float t219 = 0x1.91F66p-5f*t180 - 0x1.FF621Ep-1f*t210;
+	float t220 = 0x1.FA7558p-1f*t182 - 0x1.2C8106p-3f*t212;
+	float t221 = 0x1.2C8106p-3f*t182 + 0x1.FA7558p-1f*t212;
+	float t222 = 0x1.F0A7Fp-1f*t184 + 0x1.F19F98p-3f*t214;
+	float t223 = 0x1.F19F98p-3f*t184 - 0x1.F0A7Fp-1f*t214;
+	float t224 = 0x1.E2121p-1f*t186 - 0x1.58F9A8p-2f*t216;
+	float t225 = 0x1.58F9A8p-2f*t186 + 0x1.E2121p-1f*t216;
+	float t226 = 0x1.CED7Bp-1f*t187 + 0x1.B5D1p-2f*t217;
+	float t227 = 0x1.B5D1p-2f*t187 - 0x1.CED7Bp-1f*t217;
+	float t228 = 0x1.B72834p-1f*t185 - 0x1.07387Ap-1f*t215;
+	float t229 = 0x1.07387Ap-1f*t185 + 0x1.B72834p-1f*t215;
+	float t230 = 0x1.9B3E04p-1f*t183 + 0x1.30FF8p-1f*t213;
+	float t231 = 0x1.30FF8p-1f*t183 - 0x1.9B3E04p-1f*t213;
+	float t232 = 0x1.7B5DF2p-1f*t181 - 0x1.57D694p-1f*t211;
+	float t233 = 0x1.57D694p-1f*t181 + 0x1.7B5DF2p-1f*t211;
+	float t234 = t126 + t218;
+	float t235 = t126 - t218;
+	float t236 = t128 + t220;
+	float t237 = t128 - t220;
+	float t238 = t130 + t222;
+	float t239 = t130 - t222;
+	float t240 = t132 + t224;
+	float t241 = t132 - t224;
+	float t242 = t134 + t226;
+	float t243 = t134 - t226;
+	float t244 = t136 + t228;
+	float t245 = t136 - t228;
+	float t246 = t138 + t230;
+	float t247 = t138 - t230;
+	float t248 = t140 + t232;
+	float t249 = t140 - t232;
+	float t250 = t141 + t233;
+	float t251 = t141 - t233;
+	float t252 = t139 + t231;
+	float t253 = t139 - t231;
+	float t254 = t137 + t229;
+	float t255 = t137 - t229;
+	float t256 = t135 + t227;
+	float t257 = t135 - t227;
+	float t258 = t133 + t225;
+	float t259 = t133 - t225;
+	float t260 = t131 + t223;
+	float t261 = t131 - t223;
+	float t262 = t129 + t221;
+	float t263 = t129 - t221;
+	float t264 = t127 + t219;
+	float t265 = t127 - t219;
+	float t266 = t32 * 0x1.6A09E6p-1f;
+	float t267 = t56 + t8;
+	float t268 = t267 * 0x1.6A09E6p-1f;
+	float t269 = t56 - t8;
+	float t270 = t269 * 0x1.6A09E6p-1f;
+	float t271 = t63 * 0.5f;
+	float t272 = t271 + t266;
+	float t273 = t271 - t266;
+	float t274 = 0x1.87DE2Ap-2f*t48 - 0x1.D906BCp-1f*t16;
+	float t275 = 0x1.D906BCp-1f*t48 + 0x1.87DE2Ap-2f*t16;
+	float t276 = t268 + t40;
+	float t277 = t268 - t40;
+	float t278 = t270 + t24;
+	float t279 = t270 - t24;
+	float t280 = t272 + t275;
+	float t281 = t272 - t275;
+	float t282 = t273 + t274;
+	float t283 = t273 - t274;
+	float t284 = 0x1.A9B664p-1f*t278 - 0x1.1C73B4p-1f*t276;
+	float t285 = 0x1.1C73B4p-1f*t278 + 0x1.A9B664p-1f*t276;
+	float t286 = 0x1.F6297Cp-1f*t277 - 0x1.8F8B84p-3f*t279;
+	float t287 = 0x1.8F8B84p-3f*t277 + 0x1.F6297Cp-1f*t279;
+	float t288 = t280 + t285;
+	float t289 = t280 - t285;
+	float t290 = t282 + t287;
+	float t291 = t282 - t287;
+	float t292 = t283 + t286;
+	float t293 = t283 - t286;
+	float t294 = t281 + t284;
+	float t295 = t281 - t284;
+	float t296 = t44 + t52;
+	float t297 = t44 - t52;
+	float t298 = t36 + t28;
+	float t299 = t298 * 0x1.6A09E6p-1f;
+	float t300 = t36 - t28;
+	float t301 = t300 * 0x1.6A09E6p-1f;
+	float t302 = t12 + t20;
+	float t303 = t12 - t20;
+	float t304 = t60 + t299;
+	float t305 = t60 - t299;
+	float t306 = 0x1.D906BCp-1f*t296 + 0x1.87DE2Ap-2f*t302;
+	float t307 = 0x1.87DE2Ap-2f*t296 - 0x1.D906BCp-1f*t302;
+	float t308 = t4 + t301;
+	float t309 = t4 - t301;
+	float t310 = 0x1.D906BCp-1f*t303 + 0x1.87DE2Ap-2f*t297;
+	float t311 = 0x1.87DE2Ap-2f*t303 - 0x1.D906BCp-1f*t297;
+	float t312 = t304 + t306;
+	float t313 = t304 - t306;
+	float t314 = t305 + t307;
+	float t315 = t305 - t307;
+	float t316 = t308 + t310;
+	float t317 = t308 - t310;
+	float t318 = t309 + t311;
+	float t319 = t309 - t311;
+	float t320 = 0x1.FD88DAp-1f*t312 + 0x1.917A6Cp-4f*t317;
+	float t321 = 0x1.917A6Cp-4f*t312 - 0x1.FD88DAp-1f*t317;
+	float t322 = 0x1.E9F414p-1f*t314 - 0x1.294064p-2f*t319;
+	float t323 = 0x1.294064p-2f*t314 + 0x1.E9F414p-1f*t319;
+	float t324 = 0x1.C38B3p-1f*t315 + 0x1.E2B5D4p-2f*t318;
+	float t325 = 0x1.E2B5D4p-2f*t315 - 0x1.C38B3p-1f*t318;
+	float t326 = 0x1.8BC808p-1f*t313 - 0x1.44CF32p-1f*t316;
+	float t327 = 0x1.44CF32p-1f*t313 + 0x1.8BC808p-1f*t316;
+	float t328 = t288 + t320;
+	float t329 = t288 - t320;
+	float t330 = t290 + t322;
+	float t331 = t290 - t322;
+	float t332 = t292 + t324;
+	float t333 = t292 - t324;
+	float t334 = t294 + t326;
+	float t335 = t294 - t326;
+	float t336 = t295 + t327;
+	float t337 = t295 - t327;
+	float t338 = t293 + t325;
+	float t339 = t293 - t325;
+	float t340 = t291 + t323;
+	float t341 = t291 - t323;
+	float t342 = t289 + t321;
+	float t343 = t289 - t321;
+	float t344 = t62 * 2.0f;
+	float t345 = t58 + t54;
+	float t346 = t58 - t54;
+	float t347 = t50 + t46;
+	float t348 = t50 - t46;
+	float t349 = t42 + t38;
+	float t350 = t42 - t38;
+	float t351 = t34 + t30;
+	float t352 = t34 - t30;
+	float t353 = t26 + t22;
+	float t354 = t26 - t22;
+	float t355 = t18 + t14;
+	float t356 = t18 - t14;
+	float t357 = t10 + t6;
+	float t358 = t10 - t6;
+	float t359 = t2 * 2.0f;
+	float t360 = t351 * 0x1.6A09E6p-1f;
+	float t361 = t345 + t357;
+	float t362 = t361 * 0x1.6A09E6p-1f;
+	float t363 = t345 - t357;
+	float t364 = t363 * 0x1.6A09E6p-1f;
+	float t365 = t344 * 0.5f;
+	float t366 = t365 + t360;
+	float t367 = t365 - t360;
+	float t368 = 0x1.87DE2Ap-2f*t347 - 0x1.D906BCp-1f*t355;
+	float t369 = 0x1.D906BCp-1f*t347 + 0x1.87DE2Ap-2f*t355;
+	float t370 = t362 + t349;
+	float t371 = t362 - t349;
+	float t372 = t364 + t353;
+	float t373 = t364 - t353;
+	float t374 = t366 + t369;
+	float t375 = t366 - t369;
+	float t376 = t367 + t368;
+	float t377 = t367 - t368;
+	float t378 = 0x1.A9B664p-1f*t372 - 0x1.1C73B4p-1f*t370;
+	float t379 = 0x1.1C73B4p-1f*t372 + 0x1.A9B664p-1f*t370;
+	float t380 = 0x1.F6297Cp-1f*t371 - 0x1.8F8B84p-3f*t373;
+	float t381 = 0x1.8F8B84p-3f*t371 + 0x1.F6297Cp-1f*t373;
+	float t382 = t374 + t379;
+	float t383 = t374 - t379;
+	float t384 = t376 + t381;
+	float t385 = t376 - t381;
+	float t386 = t377 + t380;
+	float t387 = t377 - t380;
+	float t388 = t375 + t378;
+	float t389 = t375 - t378;
+	float t390 = t352 * 0x1.6A09E6p-1f;
+	float t391 = t358 + t346;
+	float t392 = t391 * 0x1.6A09E6p-1f;
+	float t393 = t358 - t346;
+	float t394 = t393 * 0x1.6A09E6p-1f;
+	float t395 = t359 * 0.5f;
+	float t396 = t395 + t390;
+	float t397 = t395 - t390;
+	float t398 = 0x1.87DE2Ap-2f*t356 - 0x1.D906BCp-1f*t348;
+	float t399 = 0x1.D906BCp-1f*t356 + 0x1.87DE2Ap-2f*t348;
+	float t400 = t392 + t354;
+	float t401 = t392 - t354;
+	float t402 = t394 + t350;
+	float t403 = t394 - t350;
+	float t404 = t396 + t399;
+	float t405 = t396 - t399;
+	float t406 = t397 + t398;
+	float t407 = t397 - t398;
+	float t408 = 0x1.A9B664p-1f*t402 - 0x1.1C73B4p-1f*t400;
+	float t409 = 0x1.1C73B4p-1f*t402 + 0x1.A9B664p-1f*t400;
+	float t410 = 0x1.F6297Cp-1f*t401 - 0x1.8F8B84p-3f*t403;
+	float t411 = 0x1.8F8B84p-3f*t401 + 0x1.F6297Cp-1f*t403;
+	float t412 = t404 + t409;
+	float t413 = t404 - t409;
+	float t414 = t406 + t411;
+	float t415 = t406 - t411;
+	float t416 = t407 + t410;
+	float t417 = t407 - t410;
+	float t418 = t405 + t408;
+	float t419 = t405 - t408;
+	float t420 = 0x1.FF621Ep-1f*t382 + 0x1.91F66p-5f*t412;
+	float t421 = 0x1.91F66p-5f*t382 - 0x1.FF621Ep-1f*t412;
+	float t422 = 0x1.FA7558p-1f*t384 - 0x1.2C8106p-3f*t414;
+	float t423 = 0x1.2C8106p-3f*t384 + 0x1.FA7558p-1f*t414;
+	float t424 = 0x1.F0A7Fp-1f*t386 + 0x1.F19F98p-3f*t416;
+	float t425 = 0x1.F19F98p-3f*t386 - 0x1.F0A7Fp-1f*t416;
+	float t426 = 0x1.E2121p-1f*t388 - 0x1.58F9A8p-2f*t418;
+	float t427 = 0x1.58F9A8p-2f*t388 + 0x1.E2121p-1f*t418;
+	float t428 = 0x1.CED7Bp-1f*t389 + 0x1.B5D1p-2f*t419;
+	float t429 = 0x1.B5D1p-2f*t389 - 0x1.CED7Bp-1f*t419;
+	float t430 = 0x1.B72834p-1f*t387 - 0x1.07387Ap-1f*t417;
+	float t431 = 0x1.07387Ap-1f*t387 + 0x1.B72834p-1f*t417;
+	float t432 = 0x1.9B3E04p-1f*t385 + 0x1.30FF8p-1f*t415;
+	float t433 = 0x1.30FF8p-1f*t385 - 0x1.9B3E04p-1f*t415;
+	float t434 = 0x1.7B5DF2p-1f*t383 - 0x1.57D694p-1f*t413;
+	float t435 = 0x1.57D694p-1f*t383 + 0x1.7B5DF2p-1f*t413;
+	float t436 = t328 + t420;
+	float t437 = t328 - t420;
+	float t438 = t330 + t422;
+	float t439 = t330 - t422;
+	float t440 = t332 + t424;
+	float t441 = t332 - t424;
+	float t442 = t334 + t426;
+	float t443 = t334 - t426;
+	float t444 = t336 + t428;
+	float t445 = t336 - t428;
+	float t446 = t338 + t430;
+	float t447 = t338 - t430;
+	float t448 = t340 + t432;
+	float t449 = t340 - t432;
+	float t450 = t342 + t434;
+	float t451 = t342 - t434;
+	float t452 = t343 + t435;
+	float t453 = t343 - t435;
+	float t454 = t341 + t433;
+	float t455 = t341 - t433;
+	float t456 = t339 + t431;
+	float t457 = t339 - t431;
+	float t458 = t337 + t429;
+	float t459 = t337 - t429;
+	float t460 = t335 + t427;
+	float t461 = t335 - t427;
+	float t462 = t333 + t425;
+	float t463 = t333 - t425;
+	float t464 = t331 + t423;
+	float t465 = t331 - t423;
+	float t466 = t329 + t421;
+	float t467 = t329 - t421;
+	float t468 = 0x1.FFF622p-1f*t234 + 0x1.921D2p-7f*t436;
+	float t469 = 0x1.921D2p-7f*t234 - 0x1.FFF622p-1f*t436;
+	float t470 = 0x1.FFA72Ep-1f*t236 - 0x1.2D8658p-5f*t438;
+	float t471 = 0x1.2D8658p-5f*t236 + 0x1.FFA72Ep-1f*t438;
+	float t472 = 0x1.FF0956p-1f*t238 + 0x1.F656E8p-5f*t440;
+	float t473 = 0x1.F656E8p-5f*t238 - 0x1.FF0956p-1f*t440;
+	float t474 = 0x1.FE1CBp-1f*t240 - 0x1.5F6Dp-4f*t442;
+	float t475 = 0x1.5F6Dp-4f*t240 + 0x1.FE1CBp-1f*t442;
+	float t476 = 0x1.FCE16p-1f*t242 + 0x1.C3785Cp-4f*t444;
+	float t477 = 0x1.C3785Cp-4f*t242 - 0x1.FCE16p-1f*t444;
+	float t478 = 0x1.FB5798p-1f*t244 - 0x1.139F0Cp-3f*t446;
+	float t479 = 0x1.139F0Cp-3f*t244 + 0x1.FB5798p-1f*t446;
+	float t480 = 0x1.F97F92p-1f*t246 + 0x1.45576Cp-3f*t448;
+	float t481 = 0x1.45576Cp-3f*t246 - 0x1.F97F92p-1f*t448;
+	float t482 = 0x1.F7599Ap-1f*t248 - 0x1.76DD9Ep-3f*t450;
+	float t483 = 0x1.76DD9Ep-3f*t248 + 0x1.F7599Ap-1f*t450;
+	float t484 = 0x1.F4E604p-1f*t250 + 0x1.A82A02p-3f*t452;
+	float t485 = 0x1.A82A02p-3f*t250 - 0x1.F4E604p-1f*t452;
+	float t486 = 0x1.F2253p-1f*t252 - 0x1.D934FEp-3f*t454;
+	float t487 = 0x1.D934FEp-3f*t252 + 0x1.F2253p-1f*t454;
+	float t488 = 0x1.EF178Ap-1f*t254 + 0x1.04FB8p-2f*t456;
+	float t489 = 0x1.04FB8p-2f*t254 - 0x1.EF178Ap-1f*t456;
+	float t490 = 0x1.EBBD8Cp-1f*t256 - 0x1.1D3444p-2f*t458;
+	float t491 = 0x1.1D3444p-2f*t256 + 0x1.EBBD8Cp-1f*t458;
+	float t492 = 0x1.E817BAp-1f*t258 + 0x1.35410Cp-2f*t460;
+	float t493 = 0x1.35410Cp-2f*t258 - 0x1.E817BAp-1f*t460;
+	float t494 = 0x1.E426A4p-1f*t260 - 0x1.4D1E24p-2f*t462;
+	float t495 = 0x1.4D1E24p-2f*t260 + 0x1.E426A4p-1f*t462;
+	float t496 = 0x1.DFEAE6p-1f*t262 + 0x1.64C7DEp-2f*t464;
+	float t497 = 0x1.64C7DEp-2f*t262 - 0x1.DFEAE6p-1f*t464;
+	float t498 = 0x1.DB6526p-1f*t264 - 0x1.7C3A94p-2f*t466;
+	float t499 = 0x1.7C3A94p-2f*t264 + 0x1.DB6526p-1f*t466;
+	float t500 = 0x1.D69618p-1f*t265 + 0x1.9372A6p-2f*t467;
+	float t501 = 0x1.9372A6p-2f*t265 - 0x1.D69618p-1f*t467;
+	float t502 = 0x1.D17E78p-1f*t263 - 0x1.AA6C82p-2f*t465;
+	float t503 = 0x1.AA6C82p-2f*t263 + 0x1.D17E78p-1f*t465;
+	float t504 = 0x1.CC1F1p-1f*t261 + 0x1.C1249Ep-2f*t463;
+	float t505 = 0x1.C1249Ep-2f*t261 - 0x1.CC1F1p-1f*t463;
+	float t506 = 0x1.C678B4p-1f*t259 - 0x1.D79776p-2f*t461;
+	float t507 = 0x1.D79776p-2f*t259 + 0x1.C678B4p-1f*t461;
+	float t508 = 0x1.C08C42p-1f*t257 + 0x1.EDC196p-2f*t459;
+	float t509 = 0x1.EDC196p-2f*t257 - 0x1.C08C42p-1f*t459;
+	float t510 = 0x1.BA5AA6p-1f*t255 - 0x1.01CFC8p-1f*t457;
+	float t511 = 0x1.01CFC8p-1f*t255 + 0x1.BA5AA6p-1f*t457;
+	float t512 = 0x1.B3E4D4p-1f*t253 + 0x1.0C9704p-1f*t455;
+	float t513 = 0x1.0C9704p-1f*t253 - 0x1.B3E4D4p-1f*t455;
+	float t514 = 0x1.AD2BCAp-1f*t251 - 0x1.1734D6p-1f*t453;
+	float t515 = 0x1.1734D6p-1f*t251 + 0x1.AD2BCAp-1f*t453;
+	float t516 = 0x1.A63092p-1f*t249 + 0x1.21A79Ap-1f*t451;
+	float t517 = 0x1.21A79Ap-1f*t249 - 0x1.A63092p-1f*t451;
+	float t518 = 0x1.9EF43Ep-1f*t247 - 0x1.2BEDB2p-1f*t449;
+	float t519 = 0x1.2BEDB2p-1f*t247 + 0x1.9EF43Ep-1f*t449;
+	float t520 = 0x1.9777Fp-1f*t245 + 0x1.36058Cp-1f*t447;
+	float t521 = 0x1.36058Cp-1f*t245 - 0x1.9777Fp-1f*t447;
+	float t522 = 0x1.8FBCCAp-1f*t243 - 0x1.3FED96p-1f*t445;
+	float t523 = 0x1.3FED96p-1f*t243 + 0x1.8FBCCAp-1f*t445;
+	float t524 = 0x1.87C4p-1f*t241 + 0x1.49A44Ap-1f*t443;
+	float t525 = 0x1.49A44Ap-1f*t241 - 0x1.87C4p-1f*t443;
+	float t526 = 0x1.7F8ECEp-1f*t239 - 0x1.53282Ap-1f*t441;
+	float t527 = 0x1.53282Ap-1f*t239 + 0x1.7F8ECEp-1f*t441;
+	float t528 = 0x1.771E76p-1f*t237 + 0x1.5C77BCp-1f*t439;
+	float t529 = 0x1.5C77BCp-1f*t237 - 0x1.771E76p-1f*t439;
+	float t530 = 0x1.6E7446p-1f*t235 - 0x1.659192p-1f*t437;
+	float t531 = 0x1.659192p-1f*t235 + 0x1.6E7446p-1f*t437;
+	x[0] = t468;
+	x[1] = t470;
+	x[2] = t472;
+	x[3] = t474;
+	x[4] = t476;
+	x[5] = t478;
+	x[6] = t480;
+	x[7] = t482;
+	x[8] = t484;
+	x[9] = t486;
+	x[10] = t488;
+	x[11] = t490;
+	x[12] = t492;
+	x[13] = t494;
+	x[14] = t496;
+	x[15] = t498;
+	x[16] = t500;
+	x[17] = t502;
+	x[18] = t504;
+	x[19] = t506;
+	x[20] = t508;
+	x[21] = t510;
+	x[22] = t512;
+	x[23] = t514;
+	x[24] = t516;
+	x[25] = t518;
+	x[26] = t520;
+	x[27] = t522;
+	x[28] = t524;
+	x[29] = t526;
+	x[30] = t528;
+	x[31] = t530;
+	x[32] = t531;
+	x[33] = t529;
+	x[34] = t527;
+	x[35] = t525;
+	x[36] = t523;
+	x[37] = t521;
+	x[38] = t519;
+	x[39] = t517;
+	x[40] = t515;
+	x[41] = t513;
+	x[42] = t511;
+	x[43] = t509;
+	x[44] = t507;
+	x[45] = t505;
+	x[46] = t503;
+	x[47] = t501;
+	x[48] = t499;
+	x[49] = t497;
+	x[50] = t495;
+	x[51] = t493;
+	x[52] = t491;
+	x[53] = t489;
+	x[54] = t487;
+	x[55] = t485;
+	x[56] = t483;
+	x[57] = t481;
+	x[58] = t479;
+	x[59] = t477;
+	x[60] = t475;
+	x[61] = t473;
+	x[62] = t471;
+	x[63] = t469;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT4_LANES)
+/**************************************/
+
+//! DCT-IV, lane-parallel (N=16)
+FOURIER_CODELET void DCT4_Lanes_16(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = 0x1.FF621Ep-1f*x[0] + 0x1.91F66p-5f*x[15];
+	Fourier_Lanes_t t1 = 0x1.91F66p-5f*x[0] - 0x1.FF621Ep-1f*x[15];
+	Fourier_Lanes_t t2 = 0x1.FA7558p-1f*x[1] + 0x1.2C8106p-3f*x[14];
+	Fourier_Lanes_t t3 = -0x1.2C8106p-3f*x[1] + 0x1.FA7558p-1f*x[14];
+	Fourier_Lanes_t t4 = 0x1.F0A7Fp-1f*x[2] + 0x1.F19F98p-3f*x[13];
+	Fourier_Lanes_t t5 = 0x1.F19F98p-3f*x[2] - 0x1.F0A7Fp-1f*x[13];
+	Fourier_Lanes_t t6 = 0x1.E2121p-1f*x[3] + 0x1.58F9A8p-2f*x[12];
+	Fourier_Lanes_t t7 = -0x1.58F9A8p-2f*x[3] + 0x1.E2121p-1f*x[12];
+	Fourier_Lanes_t t8 = 0x1.CED7Bp-1f*x[4] + 0x1.B5D1p-2f*x[11];
+	Fourier_Lanes_t t9 = 0x1.B5D1p-2f*x[4] - 0x1.CED7Bp-1f*x[11];
+	Fourier_Lanes_t t10 = 0x1.B72834p-1f*x[5] + 0x1.07387Ap-1f*x[10];
+	Fourier_Lanes_t t11 = -0x1.07387Ap-1f*x[5] + 0x1.B72834p-1f*x[10];
+	Fourier_Lanes_t t12 = 0x1.9B3E04p-1f*x[6] + 0x1.30FF8p-1f*x[9];
+	Fourier_Lanes_t t13 = 0x1.30FF8p-1f*x[6] - 0x1.9B3E04p-1f*x[9];
+	Fourier_Lanes_t t14 = 0x1.7B5DF2p-1f*x[7] + 0x1.57D694p-1f*x[8];
+	Fourier_Lanes_t t15 = -0x1.57D694p-1f*x[7] + 0x1.7B5DF2p-1f*x[8];
+	Fourier_Lanes_t t16 = t0 + t14;
+	Fourier_Lanes_t t17 = t0 - t14;
+	Fourier_Lanes_t t18 = t2 + t12;
+	Fourier_Lanes_t t19 = t2 - t12;
+	Fourier_Lanes_t t20 = t4 + t10;
+	Fourier_Lanes_t t21 = t4 - t10;
+	Fourier_Lanes_t t22 = t6 + t8;
+	Fourier_Lanes_t t23 = t6 - t8;
+	Fourier_Lanes_t t24 = t16 + t22;
+	Fourier_Lanes_t t25 = t16 - t22;
+	Fourier_Lanes_t t26 = t18 + t20;
+	Fourier_Lanes_t t27 = t18 - t20;
+	Fourier_Lanes_t t28 = 0x1.A9B664p-1f*t23 + 0x1.1C73B4p-1f*t17;
+	Fourier_Lanes_t t29 = -0x1.1C73B4p-1f*t23 + 0x1.A9B664p-1f*t17;
+	Fourier_Lanes_t t30 = 0x1.F6297Cp-1f*t21 + 0x1.8F8B84p-3f*t19;
+	Fourier_Lanes_t t31 = -0x1.8F8B84p-3f*t21 + 0x1.F6297Cp-1f*t19;
+	Fourier_Lanes_t t32 = t24 + t26;
+	Fourier_Lanes_t t33 = t24 - t26;
+	Fourier_Lanes_t t34 = 0x1.87DE2Ap-2f*t27 + 0x1.D906BCp-1f*t25;
+	Fourier_Lanes_t t35 = -0x1.D906BCp-1f*t27 + 0x1.87DE2Ap-2f*t25;
+	Fourier_Lanes_t t36 = t29 + t30;
+	Fourier_Lanes_t t37 = t29 - t30;
+	Fourier_Lanes_t t38 = t28 + t31;
+	Fourier_Lanes_t t39 = t28 - t31;
+	Fourier_Lanes_t t40 = t33 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t41 = t36 + t38;
+	Fourier_Lanes_t t42 = t41 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t43 = t36 - t38;
+	Fourier_Lanes_t t44 = t43 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t45 = t1 + t15;
+	Fourier_Lanes_t t46 = t1 - t15;
+	Fourier_Lanes_t t47 = t3 + t13;
+	Fourier_Lanes_t t48 = t3 - t13;
+	Fourier_Lanes_t t49 = t5 + t11;
+	Fourier_Lanes_t t50 = t5 - t11;
+	Fourier_Lanes_t t51 = t7 + t9;
+	Fourier_Lanes_t t52 = t7 - t9;
+	Fourier_Lanes_t t53 = t45 + t51;
+	Fourier_Lanes_t t54 = t45 - t51;
+	Fourier_Lanes_t t55 = t47 + t49;
+	Fourier_Lanes_t t56 = t47 - t49;
+	Fourier_Lanes_t t57 = 0x1.A9B664p-1f*t52 + 0x1.1C73B4p-1f*t46;
+	Fourier_Lanes_t t58 = -0x1.1C73B4p-1f*t52 + 0x1.A9B664p-1f*t46;
+	Fourier_Lanes_t t59 = 0x1.F6297Cp-1f*t50 + 0x1.8F8B84p-3f*t48;
+	Fourier_Lanes_t t60 = -0x1.8F8B84p-3f*t50 + 0x1.F6297Cp-1f*t48;
+	Fourier_Lanes_t t61 = t53 + t55;
+	Fourier_Lanes_t t62 = t53 - t55;
+	Fourier_Lanes_t t63 = 0x1.87DE2Ap-2f*t56 + 0x1.D906BCp-1f*t54;
+	Fourier_Lanes_t t64 = -0x1.D906BCp-1f*t56 + 0x1.87DE2Ap-2f*t54;
+	Fourier_Lanes_t t65 = t58 + t59;
+	Fourier_Lanes_t t66 = t58 - t59;
+	Fourier_Lanes_t t67 = t57 + t60;
+	Fourier_Lanes_t t68 = t57 - t60;
+	Fourier_Lanes_t t69 = t62 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t70 = t65 + t67;
+	Fourier_Lanes_t t71 = t70 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t72 = t65 - t67;
+	Fourier_Lanes_t t73 = t72 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t74 = t42 + t73;
+	Fourier_Lanes_t t75 = t42 - t73;
+	Fourier_Lanes_t t76 = t34 + t64;
+	Fourier_Lanes_t t77 = t34 - t64;
+	Fourier_Lanes_t t78 = t37 + t68;
+	Fourier_Lanes_t t79 = t37 - t68;
+	Fourier_Lanes_t t80 = t40 + t69;
+	Fourier_Lanes_t t81 = t40 - t69;
+	Fourier_Lanes_t t82 = t39 + t66;
+	Fourier_Lanes_t t83 = t39 - t66;
+	Fourier_Lanes_t t84 = t35 + t63;
+	Fourier_Lanes_t t85 = t35 - t63;
+	Fourier_Lanes_t t86 = t44 + t71;
+	Fourier_Lanes_t t87 = t44 - t71;
+	x[0] = t32;
+	x[1] = t74;
+	x[2] = t75;
+	x[3] = t76;
+	x[4] = t77;
+	x[5] = t78;
+	x[6] = t79;
+	x[7] = t80;
+	x[8] = t81;
+	x[9] = t82;
+	x[10] = t83;
+	x[11] = t84;
+	x[12] = t85;
+	x[13] = t86;
+	x[14] = t87;
+	x[15] = t61;
+}
+
+//! DCT-IV, lane-parallel (N=32)
+FOURIER_CODELET void DCT4_Lanes_32(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = 0x1.FFD886p-1f*x[0] + 0x1.92156p-6f*x[31];
+	Fourier_Lanes_t t1 = 0x1.92156p-6f*x[0] - 0x1.FFD886p-1f*x[31];
+	Fourier_Lanes_t t2 = 0x1.FE9CDAp-1f*x[1] + 0x1.2D520Ap-4f*x[30];
+	Fourier_Lanes_t t3 = -0x1.2D520Ap-4f*x[1] + 0x1.FE9CDAp-1f*x[30];
+	Fourier_Lanes_t t4 = 0x1.FC2648p-1f*x[2] + 0x1.F564E6p-4f*x[29];
+	Fourier_Lanes_t t5 = 0x1.F564E6p-4f*x[2] - 0x1.FC2648p-1f*x[29];
+	Fourier_Lanes_t t6 = 0x1.F8765p-1f*x[3] + 0x1.5E2144p-3f*x[28];
+	Fourier_Lanes_t t7 = -0x1.5E2144p-3f*x[3] + 0x1.F8765p-1f*x[28];
+	Fourier_Lanes_t t8 = 0x1.F38F3Ap-1f*x[4] + 0x1.C0B826p-3f*x[27];
+	Fourier_Lanes_t t9 = 0x1.C0B826p-3f*x[4] - 0x1.F38F3Ap-1f*x[27];
+	Fourier_Lanes_t t10 = 0x1.ED740Ep-1f*x[5] + 0x1.111D26p-2f*x[26];
+	Fourier_Lanes_t t11 = -0x1.111D26p-2f*x[5] + 0x1.ED740Ep-1f*x[26];
+	Fourier_Lanes_t t12 = 0x1.E6288Ep-1f*x[6] + 0x1.4135CAp-2f*x[25];
+	Fourier_Lanes_t t13 = 0x1.4135CAp-2f*x[6] - 0x1.E6288Ep-1f*x[25];
+	Fourier_Lanes_t t14 = 0x1.DDB13Cp-1f*x[7] + 0x1.708854p-2f*x[24];
+	Fourier_Lanes_t t15 = -0x1.708854p-2f*x[7] + 0x1.DDB13Cp-1f*x[24];
+	Fourier_Lanes_t t16 = 0x1.D4134Ep-1f*x[8] + 0x1.9EF794p-2f*x[23];
+	Fourier_Lanes_t t17 = 0x1.9EF794p-2f*x[8] - 0x1.D4134Ep-1f*x[23];
+	Fourier_Lanes_t t18 = 0x1.C954B2p-1f*x[9] + 0x1.CC66EAp-2f*x[22];
+	Fourier_Lanes_t t19 = -0x1.CC66EAp-2f*x[9] + 0x1.C954B2p-1f*x[22];
+	Fourier_Lanes_t t20 = 0x1.BD7C0Ap-1f*x[10] + 0x1.F8BA4Ep-2f*x[21];
+	Fourier_Lanes_t t21 = 0x1.F8BA4Ep-2f*x[10] - 0x1.BD7C0Ap-1f*x[21];
+	Fourier_Lanes_t t22 = 0x1.B090A6p-1f*x[11] + 0x1.11EB36p-1f*x[20];
+	Fourier_Lanes_t t23 = -0x1.11EB36p-1f*x[11] + 0x1.B090A6p-1f*x[20];
+	Fourier_Lanes_t t24 = 0x1.A29A7Ap-1f*x[12] + 0x1.26D054p-1f*x[19];
+	Fourier_Lanes_t t25 = 0x1.26D054p-1f*x[12] - 0x1.A29A7Ap-1f*x[19];
+	Fourier_Lanes_t t26 = 0x1.93A224p-1f*x[13] + 0x1.3AFFA2p-1f*x[18];
+	Fourier_Lanes_t t27 = -0x1.3AFFA2p-1f*x[13] + 0x1.93A224p-1f*x[18];
+	Fourier_Lanes_t t28 = 0x1.83B0Ep-1f*x[14] + 0x1.4E6CACp-1f*x[17];
+	Fourier_Lanes_t t29 = 0x1.4E6CACp-1f*x[14] - 0x1.83B0Ep-1f*x[17];
+	Fourier_Lanes_t t30 = 0x1.72D084p-1f*x[15] + 0x1.610B76p-1f*x[16];
+	Fourier_Lanes_t t31 = -0x1.610B76p-1f*x[15] + 0x1.72D084p-1f*x[16];
+	Fourier_Lanes_t t32 = t0 + t30;
+	Fourier_Lanes_t t33 = t2 + t28;
+	Fourier_Lanes_t t34 = t4 + t26;
+	Fourier_Lanes_t t35 = t6 + t24;
+	Fourier_Lanes_t t36 = t8 + t22;
+	Fourier_Lanes_t t37 = t10 + t20;
+	Fourier_Lanes_t t38 = t12 + t18;
+	Fourier_Lanes_t t39 = t14 + t16;
+	Fourier_Lanes_t t40 = t0 - t30;
+	Fourier_Lanes_t t41 = t2 - t28;
+	Fourier_Lanes_t t42 = t4 - t26;
+	Fourier_Lanes_t t43 = t6 - t24;
+	Fourier_Lanes_t t44 = t8 - t22;
+	Fourier_Lanes_t t45 = t10 - t20;
+	Fourier_Lanes_t t46 = t12 - t18;
+	Fourier_Lanes_t t47 = t14 - t16;
+	Fourier_Lanes_t t48 = t32 + t39;
+	Fourier_Lanes_t t49 = t32 - t39;
+	Fourier_Lanes_t t50 = t33 + t38;
+	Fourier_Lanes_t t51 = t33 - t38;
+	Fourier_Lanes_t t52 = t34 + t37;
+	Fourier_Lanes_t t53 = t34 - t37;
+	Fourier_Lanes_t t54 = t35 + t36;
+	Fourier_Lanes_t t55 = t35 - t36;
+	Fourier_Lanes_t t56 = t48 + t54;
+	Fourier_Lanes_t t57 = t48 - t54;
+	Fourier_Lanes_t t58 = t50 + t52;
+	Fourier_Lanes_t t59 = t50 - t52;
+	Fourier_Lanes_t t60 = 0x1.A9B664p-1f*t55 + 0x1.1C73B4p-1f*t49;
+	Fourier_Lanes_t t61 = -0x1.1C73B4p-1f*t55 + 0x1.A9B664p-1f*t49;
+	Fourier_Lanes_t t62 = 0x1.F6297Cp-1f*t53 + 0x1.8F8B84p-3f*t51;
+	Fourier_Lanes_t t63 = -0x1.8F8B84p-3f*t53 + 0x1.F6297Cp-1f*t51;
+	Fourier_Lanes_t t64 = t56 + t58;
+	Fourier_Lanes_t t65 = t56 - t58;
+	Fourier_Lanes_t t66 = 0x1.87DE2Ap-2f*t59 + 0x1.D906BCp-1f*t57;
+	Fourier_Lanes_t t67 = -0x1.D906BCp-1f*t59 + 0x1.87DE2Ap-2f*t57;
+	Fourier_Lanes_t t68 = t61 + t62;
+	Fourier_Lanes_t t69 = t61 - t62;
+	Fourier_Lanes_t t70 = t60 + t63;
+	Fourier_Lanes_t t71 = t60 - t63;
+	Fourier_Lanes_t t72 = t65 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t73 = t68 + t70;
+	Fourier_Lanes_t t74 = t73 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t75 = t68 - t70;
+	Fourier_Lanes_t t76 = t75 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t77 = 0x1.FD88DAp-1f*t40 + 0x1.917A6Cp-4f*t47;
+	Fourier_Lanes_t t78 = 0x1.917A6Cp-4f*t40 - 0x1.FD88DAp-1f*t47;
+	Fourier_Lanes_t t79 = 0x1.E9F414p-1f*t41 + 0x1.294064p-2f*t46;
+	Fourier_Lanes_t t80 = -0x1.294064p-2f*t41 + 0x1.E9F414p-1f*t46;
+	Fourier_Lanes_t t81 = 0x1.C38B3p-1f*t42 + 0x1.E2B5D4p-2f*t45;
+	Fourier_Lanes_t t82 = 0x1.E2B5D4p-2f*t42 - 0x1.C38B3p-1f*t45;
+	Fourier_Lanes_t t83 = 0x1.8BC808p-1f*t43 + 0x1.44CF32p-1f*t44;
+	Fourier_Lanes_t t84 = -0x1.44CF32p-1f*t43 + 0x1.8BC808p-1f*t44;
+	Fourier_Lanes_t t85 = t77 + t83;
+	Fourier_Lanes_t t86 = t77 - t83;
+	Fourier_Lanes_t t87 = t79 + t81;
+	Fourier_Lanes_t t88 = t79 - t81;
+	Fourier_Lanes_t t89 = t84 + t78;
+	Fourier_Lanes_t t90 = t84 - t78;
+	Fourier_Lanes_t t91 = t82 + t80;
+	Fourier_Lanes_t t92 = t82 - t80;
+	Fourier_Lanes_t t93 = t85 + t87;
+	Fourier_Lanes_t t94 = t85 - t87;
+	Fourier_Lanes_t t95 = 0x1.D906BCp-1f*t86 + 0x1.87DE2Ap-2f*t88;
+	Fourier_Lanes_t t96 = 0x1.87DE2Ap-2f*t86 - 0x1.D906BCp-1f*t88;
+	Fourier_Lanes_t t97 = t89 + t91;
+	Fourier_Lanes_t t98 = t89 - t91;
+	Fourier_Lanes_t t99 = 0x1.D906BCp-1f*t90 + 0x1.87DE2Ap-2f*t92;
+	Fourier_Lanes_t t100 = 0x1.87DE2Ap-2f*t90 - 0x1.D906BCp-1f*t92;
+	Fourier_Lanes_t t101 = t95 - t100;
+	Fourier_Lanes_t t102 = t95 + t100;
+	Fourier_Lanes_t t103 = t94 + t98;
+	Fourier_Lanes_t t104 = t103 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t105 = t94 - t98;
+	Fourier_Lanes_t t106 = t105 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t107 = t96 - t99;
+	Fourier_Lanes_t t108 = t96 + t99;
+	Fourier_Lanes_t t109 = t1 + t31;
+	Fourier_Lanes_t t110 = t3 + t29;
+	Fourier_Lanes_t t111 = t5 + t27;
+	Fourier_Lanes_t t112 = t7 + t25;
+	Fourier_Lanes_t t113 = t9 + t23;
+	Fourier_Lanes_t t114 = t11 + t21;
+	Fourier_Lanes_t t115 = t13 + t19;
+	Fourier_Lanes_t t116 = t15 + t17;
+	Fourier_Lanes_t t117 = t1 - t31;
+	Fourier_Lanes_t t118 = t3 - t29;
+	Fourier_Lanes_t t119 = t5 - t27;
+	Fourier_Lanes_t t120 = t7 - t25;
+	Fourier_Lanes_t t121 = t9 - t23;
+	Fourier_Lanes_t t122 = t11 - t21;
+	Fourier_Lanes_t t123 = t13 - t19;
+	Fourier_Lanes_t t124 = t15 - t17;
+	Fourier_Lanes_t t125 = t109 + t116;
+	Fourier_Lanes_t t126 = t109 - t116;
+	Fourier_Lanes_t t127 = t110 + t115;
+	Fourier_Lanes_t t128 = t110 - t115;
+	Fourier_Lanes_t t129 = t111 + t114;
+	Fourier_Lanes_t t130 = t111 - t114;
+	Fourier_Lanes_t t131 = t112 + t113;
+	Fourier_Lanes_t t132 = t112 - t113;
+	Fourier_Lanes_t t133 = t125 + t131;
+	Fourier_Lanes_t t134 = t125 - t131;
+	Fourier_Lanes_t t135 = t127 + t129;
+	Fourier_Lanes_t t136 = t127 - t129;
+	Fourier_Lanes_t t137 = 0x1.A9B664p-1f*t132 + 0x1.1C73B4p-1f*t126;
+	Fourier_Lanes_t t138 = -0x1.1C73B4p-1f*t132 + 0x1.A9B664p-1f*t126;
+	Fourier_Lanes_t t139 = 0x1.F6297Cp-1f*t130 + 0x1.8F8B84p-3f*t128;
+	Fourier_Lanes_t t140 = -0x1.8F8B84p-3f*t130 + 0x1.F6297Cp-1f*t128;
+	Fourier_Lanes_t t141 = t133 + t135;
+	Fourier_Lanes_t t142 = t133 - t135;
+	Fourier_Lanes_t t143 = 0x1.87DE2Ap-2f*t136 + 0x1.D906BCp-1f*t134;
+	Fourier_Lanes_t t144 = -0x1.D906BCp-1f*t136 + 0x1.87DE2Ap-2f*t134;
+	Fourier_Lanes_t t145 = t138 + t139;
+	Fourier_Lanes_t t146 = t138 - t139;
+	Fourier_Lanes_t t147 = t137 + t140;
+	Fourier_Lanes_t t148 = t137 - t140;
+	Fourier_Lanes_t t149 = t142 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t150 = t145 + t147;
+	Fourier_Lanes_t t151 = t150 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t152 = t145 - t147;
+	Fourier_Lanes_t t153 = t152 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t154 = 0x1.FD88DAp-1f*t117 + 0x1.917A6Cp-4f*t124;
+	Fourier_Lanes_t t155 = 0x1.917A6Cp-4f*t117 - 0x1.FD88DAp-1f*t124;
+	Fourier_Lanes_t t156 = 0x1.E9F414p-1f*t118 + 0x1.294064p-2f*t123;
+	Fourier_Lanes_t t157 = -0x1.294064p-2f*t118 + 0x1.E9F414p-1f*t123;
+	Fourier_Lanes_t t158 = 0x1.C38B3p-1f*t119 + 0x1.E2B5D4p-2f*t122;
+	Fourier_Lanes_t t159 = 0x1.E2B5D4p-2f*t119 - 0x1.C38B3p-1f*t122;
+	Fourier_Lanes_t t160 = 0x1.8BC808p-1f*t120 + 0x1.44CF32p-1f*t121;
+	Fourier_Lanes_t t161 = -0x1.44CF32p-1f*t120 + 0x1.8BC808p-1f*t121;
+	Fourier_Lanes_t t162 = t154 + t160;
+	Fourier_Lanes_t t163 = t154 - t160;
+	Fourier_Lanes_t t164 = t156 + t158;
+	Fourier_Lanes_t t165 = t156 - t158;
+	Fourier_Lanes_t t166 = t161 + t155;
+	Fourier_Lanes_t t167 = t161 - t155;
+	Fourier_Lanes_t t168 = t159 + t157;
+	Fourier_Lanes_t t169 = t159 - t157;
+	Fourier_Lanes_t t170 = t162 + t164;
+	Fourier_Lanes_t t171 = t162 - t164;
+	Fourier_Lanes_t t172 = 0x1.D906BCp-1f*t163 + 0x1.87DE2Ap-2f*t165;
+	Fourier_Lanes_t t173 = 0x1.87DE2Ap-2f*t163 - 0x1.D906BCp-1f*t165;
+	Fourier_Lanes_t t174 = t166 + t168;
+	Fourier_Lanes_t t175 = t166 - t168;
+	Fourier_Lanes_t t176 = 0x1.D906BCp-1f*t167 + 0x1.87DE2Ap-2f*t169;
+	Fourier_Lanes_t t177 = 0x1.87DE2Ap-2f*t167 - 0x1.D906BCp-1f*t169;
+	Fourier_Lanes_t t178 = t172 - t177;
+	Fourier_Lanes_t t179 = t172 + t177;
+	Fourier_Lanes_t t180 = t171 + t175;
+	Fourier_Lanes_t t181 = t180 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t182 = t171 - t175;
+	Fourier_Lanes_t t183 = t182 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t184 = t173 - t176;
+	Fourier_Lanes_t t185 = t173 + t176;
+	Fourier_Lanes_t t186 = t93 + t174;
+	Fourier_Lanes_t t187 = t93 - t174;
+	Fourier_Lanes_t t188 = t74 + t153;
+	Fourier_Lanes_t t189 = t74 - t153;
+	Fourier_Lanes_t t190 = t101 + t185;
+	Fourier_Lanes_t t191 = t101 - t185;
+	Fourier_Lanes_t t192 = t66 + t144;
+	Fourier_Lanes_t t193 = t66 - t144;
+	Fourier_Lanes_t t194 = t102 + t184;
+	Fourier_Lanes_t t195 = t102 - t184;
+	Fourier_Lanes_t t196 = t69 + t148;
+	Fourier_Lanes_t t197 = t69 - t148;
+	Fourier_Lanes_t t198 = t104 + t183;
+	Fourier_Lanes_t t199 = t104 - t183;
+	Fourier_Lanes_t t200 = t72 + t149;
+	Fourier_Lanes_t t201 = t72 - t149;
+	Fourier_Lanes_t t202 = t106 + t181;
+	Fourier_Lanes_t t203 = t106 - t181;
+	Fourier_Lanes_t t204 = t71 + t146;
+	Fourier_Lanes_t t205 = t71 - t146;
+	Fourier_Lanes_t t206 = t107 + t179;
+	Fourier_Lanes_t t207 = t107 - t179;
+	Fourier_Lanes_t t208 = t67 + t143;
+	Fourier_Lanes_t t209 = t67 - t143;
+	Fourier_Lanes_t t210 = t108 + t178;
+	Fourier_Lanes_t t211 = t108 - t178;
+	Fourier_Lanes_t t212 = t76 + t151;
+	Fourier_Lanes_t t213 = t76 - t151;
+	Fourier_Lanes_t t214 = t97 + t170;
+	Fourier_Lanes_t t215 = t97 - t170;
+	x[0] = t64;
+	x[1] = t186;
+	x[2] = t187;
+	x[3] = t188;
+	x[4] = t189;
+	x[5] = t190;
+	x[6] = t191;
+	x[7] = t192;
+	x[8] = t193;
+	x[9] = t194;
+	x[10] = t195;
+	x[11] = t196;
+	x[12] = t197;
+	x[13] = t198;
+	x[14] = t199;
+	x[15] = t200;
+	x[16] = t201;
+	x[17] = t202;
+	x[18] = t203;
+	x[19] = t204;
+	x[20] = t205;
+	x[21] = t206;
+	x[22] = t207;
+	x[23] = t208;
+	x[24] = t209;
+	x[25] = t210;
+	x[26] = t211;
+	x[27] = t212;
+	x[28] = t213;
+	x[29] = t214;
+	x[30] = t215;
+	x[31] = t141;
+}
+
+//! DCT-IV, lane-parallel (N=64)
+FOURIER_CODELET void DCT4_Lanes_64(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = 0x1.FFF622p-1f*x[0] + 0x1.921D2p-7f*x[63];
+	Fourier_Lanes_t t1 = 0x1.921D2p-7f*x[0] - 0x1.FFF622p-1f*x[63];
+	Fourier_Lanes_t t2 = 0x1.FFA72Ep-1f*x[1] + 0x1.2D8658p-5f*x[62];
+	Fourier_Lanes_t t3 = -0x1.2D8658p-5f*x[1] + 0x1.FFA72Ep-1f*x[62];
+	Fourier_Lanes_t t4 = 0x1.FF0956p-1f*x[2] + 0x1.F656E8p-5f*x[61];
+	Fourier_Lanes_t t5 = 0x1.F656E8p-5f*x[2] - 0x1.FF0956p-1f*x[61];
+	Fourier_Lanes_t t6 = 0x1.FE1CBp-1f*x[3] + 0x1.5F6Dp-4f*x[60];
+	Fourier_Lanes_t t7 = -0x1.5F6Dp-4f*x[3] + 0x1.FE1CBp-1f*x[60];
+	Fourier_Lanes_t t8 = 0x1.FCE16p-1f*x[4] + 0x1.C3785Cp-4f*x[59];
+	Fourier_Lanes_t t9 = 0x1.C3785Cp-4f*x[4] - 0x1.FCE16p-1f*x[59];
+	Fourier_Lanes_t t10 = 0x1.FB5798p-1f*x[5] + 0x1.139F0Cp-3f*x[58];
+	Fourier_Lanes_t t11 = -0x1.139F0Cp-3f*x[5] + 0x1.FB5798p-1f*x[58];
+	Fourier_Lanes_t t12 = 0x1.F97F92p-1f*x[6] + 0x1.45576Cp-3f*x[57];
+	Fourier_Lanes_t t13 = 0x1.45576Cp-3f*x[6] - 0x1.F97F92p-1f*x[57];
+	Fourier_Lanes_t t14 = 0x1.F7599Ap-1f*x[7] + 0x1.76DD9Ep-3f*x[56];
+	Fourier_Lanes_t t15 = -0x1.76DD9Ep-3f*x[7] + 0x1.F7599Ap-1f*x[56];
+	Fourier_Lanes_t t16 = 0x1.F4E604p-1f*x[8] + 0x1.A82A02p-3f*x[55];
+	Fourier_Lanes_t t17 = 0x1.A82A02p-3f*x[8] - 0x1.F4E604p-1f*x[55];
+	Fourier_Lanes_t t18 = 0x1.F2253p-1f*x[9] + 0x1.D934FEp-3f*x[54];
+	Fourier_Lanes_t t19 = -0x1.D934FEp-3f*x[9] + 0x1.F2253p-1f*x[54];
+	Fourier_Lanes_t t20 = 0x1.EF178Ap-1f*x[10] + 0x1.04FB8p-2f*x[53];
+	Fourier_Lanes_t t21 = 0x1.04FB8p-2f*x[10] - 0x1.EF178Ap-1f*x[53];
+	Fourier_Lanes_t t22 = 0x1.EBBD8Cp-1f*x[11] + 0x1.1D3444p-2f*x[52];
+	Fourier_Lanes_t t23 = -0x1.1D3444p-2f*x[11] + 0x1.EBBD8Cp-1f*x[52];
+	Fourier_Lanes_t t24 = 0x1.E817BAp-1f*x[12] + 0x1.35410Cp-2f*x[51];
+	Fourier_Lanes_t t25 = 0x1.35410Cp-2f*x[12] - 0x1.E817BAp-1f*x[51];
+	Fourier_Lanes_t t26 = 0x1.E426A4p-1f*x[13] + 0x1.4D1E24p-2f*x[50];
+	Fourier_Lanes_t t27 = -0x1.4D1E24p-2f*x[13] + 0x1.E426A4p-1f*x[50];
+	Fourier_Lanes_t t28 = 0x1.DFEAE6p-1f*x[14] + 0x1.64C7DEp-2f*x[49];
+	Fourier_Lanes_t t29 = 0x1.64C7DEp-2f*x[14] - 0x1.DFEAE6p-1f*x[49];
+	Fourier_Lanes_t t30 = 0x1.DB6526p-1f*x[15] + 0x1.7C3A94p-2f*x[48];
+	Fourier_Lanes_t t31 = -0x1.7C3A94p-2f*x[15] + 0x1.DB6526p-1f*x[48];
+	Fourier_Lanes_t t32 = 0x1.D69618p-1f*x[16] + 0x1.9372A6p-2f*x[47];
+	Fourier_Lanes_t t33 = 0x1.9372A6p-2f*x[16] - 0x1.D69618p-1f*x[47];
+	Fourier_Lanes_t t34 = 0x1.D17E78p-1f*x[17] + 0x1.AA6C82p-2f*x[46];
+	Fourier_Lanes_t t35 = -0x1.AA6C82p-2f*x[17] + 0x1.D17E78p-1f*x[46];
+	Fourier_Lanes_t t36 = 0x1.CC1F1p-1f*x[18] + 0x1.C1249Ep-2f*x[45];
+	Fourier_Lanes_t t37 = 0x1.C1249Ep-2f*x[18] - 0x1.CC1F1p-1f*x[45];
+	Fourier_Lanes_t t38 = 0x1.C678B4p-1f*x[19] + 0x1.D79776p-2f*x[44];
+	Fourier_Lanes_t t39 = -0x1.D79776p-2f*x[19] + 0x1.C678B4p-1f*x[44];
+	Fourier_Lanes_t t40 = 0x1.C08C42p-1f*x[20] + 0x1.EDC196p-2f*x[43];
+	Fourier_Lanes_t t41 = 0x1.EDC196p-2f*x[20] - 0x1.C08C42p-1f*x[43];
+	Fourier_Lanes_t t42 = 0x1.BA5AA6p-1f*x[21] + 0x1.01CFC8p-1f*x[42];
+	Fourier_Lanes_t t43 = -0x1.01CFC8p-1f*x[21] + 0x1.BA5AA6p-1f*x[42];
+	Fourier_Lanes_t t44 = 0x1.B3E4D4p-1f*x[22] + 0x1.0C9704p-1f*x[41];
+	Fourier_Lanes_t t45 = 0x1.0C9704p-1f*x[22] - 0x1.B3E4D4p-1f*x[41];
+	Fourier_Lanes_t t46 = 0x1.AD2BCAp-1f*x[23] + 0x1.1734D6p-1f*x[40];
+	Fourier_Lanes_t t47 = -0x1.1734D6p-1f*x[23] + 0x1.AD2BCAp-1f*x[40];
+	Fourier_Lanes_t t48 = 0x1.A63092p-1f*x[24] + 0x1.21A79Ap-1f*x[39];
+	Fourier_Lanes_t t49 = 0x1.21A79Ap-1f*x[24] - 0x1.A63092p-1f*x[39];
+	Fourier_Lanes_t t50 = 0x1.9EF43Ep-1f*x[25] + 0x1.2BEDB2p-1f*x[38];
+	Fourier_Lanes_t t51 = -0x1.2BEDB2p-1f*x[25] + 0x1.9EF43Ep-1f*x[38];
+	Fourier_Lanes_t t52 = 0x1.9777Fp-1f*x[26] + 0x1.36058Cp-1f*x[37];
+	Fourier_Lanes_t t53 = 0x1.36058Cp-1f*x[26] - 0x1.9777Fp-1f*x[37];
+	Fourier_Lanes_t t54 = 0x1.8FBCCAp-1f*x[27] + 0x1.3FED96p-1f*x[36];
+	Fourier_Lanes_t t55 = -0x1.3FED96p-1f*x[27] + 0x1.8FBCCAp-1f*x[36];
+	Fourier_Lanes_t t56 = 0x1.87C4p-1f*x[28] + 0x1.49A44Ap-1f*x[35];
+	Fourier_Lanes_t t57 = 0x1.49A44Ap-1f*x[28] - 0x1.87C4p-1f*x[35];
+	Fourier_Lanes_t t58 = 0x1.7F8ECEp-1f*x[29] + 0x1.53282Ap-1f*x[34];
+	Fourier_Lanes_t t59 = -0x1.53282Ap-1f*x[29] + 0x1.7F8ECEp-1f*x[34];
+	Fourier_Lanes_t t60 = 0x1.771E76p-1f*x[30] + 0x1.5C77BCp-1f*x[33];
+	Fourier_Lanes_t t61 = 0x1.5C77BCp-1f*x[30] - 0x1.771E76p-1f*x[33];
+	Fourier_Lanes_t t62 = 0x1.6E7446p-1f*x[31] + 0x1.659192p-1f*x[32];
+	Fourier_Lanes_t t63 = -0x1.659192p-1f*x[31] + 0x1.6E7446p-1f*x[32];
+	Fourier_Lanes_t t64 = t0 + t62;
+	Fourier_Lanes_t t65 = t2 + t60;
+	Fourier_Lanes_t t66 = t4 + t58;
+	Fourier_Lanes_t t67 = t6 + t56;
+	Fourier_Lanes_t t68 = t8 + t54;
+	Fourier_Lanes_t t69 = t10 + t52;
+	Fourier_Lanes_t t70 = t12 + t50;
+	Fourier_Lanes_t t71 = t14 + t48;
+	Fourier_Lanes_t t72 = t16 + t46;
+	Fourier_Lanes_t t73 = t18 + t44;
+	Fourier_Lanes_t t74 = t20 + t42;
+	Fourier_Lanes_t t75 = t22 + t40;
+	Fourier_Lanes_t t76 = t24 + t38;
+	Fourier_Lanes_t t77 = t26 + t36;
+	Fourier_Lanes_t t78 = t28 + t34;
+	Fourier_Lanes_t t79 = t30 + t32;
+	Fourier_Lanes_t t80 = t0 - t62;
+	Fourier_Lanes_t t81 = t2 - t60;
+	Fourier_Lanes_t t82 = t4 - t58;
+	Fourier_Lanes_t t83 = t6 - t56;
+	Fourier_Lanes_t t84 = t8 - t54;
+	Fourier_Lanes_t t85 = t10 - t52;
+	Fourier_Lanes_t t86 = t12 - t50;
+	Fourier_Lanes_t t87 = t14 - t48;
+	Fourier_Lanes_t t88 = t16 - t46;
+	Fourier_Lanes_t t89 = t18 - t44;
+	Fourier_Lanes_t t90 = t20 - t42;
+	Fourier_Lanes_t t91 = t22 - t40;
+	Fourier_Lanes_t t92 = t24 - t38;
+	Fourier_Lanes_t t93 = t26 - t36;
+	Fourier_Lanes_t t94 = t28 - t34;
+	Fourier_Lanes_t t95 = t30 - t32;
+	Fourier_Lanes_t t96 = t64 + t79;
+	Fourier_Lanes_t t97 = t65 + t78;
+	Fourier_Lanes_t t98 = t66 + t77;
+	Fourier_Lanes_t t99 = t67 + t76;
+	Fourier_Lanes_t t100 = t68 + t75;
+	Fourier_Lanes_t t101 = t69 + t74;
+	Fourier_Lanes_t t102 = t70 + t73;
+	Fourier_Lanes_t t103 = t71 + t72;
+	Fourier_Lanes_t t104 = t64 - t79;
+	Fourier_Lanes_t t105 = t65 - t78;
+	Fourier_Lanes_t t106 = t66 - t77;
+	Fourier_Lanes_t t107 = t67 - t76;
+	Fourier_Lanes_t t108 = t68 - t75;
+	Fourier_Lanes_t t109 = t69 - t74;
+	Fourier_Lanes_t t110 = t70 - t73;
+	Fourier_Lanes_t t111 = t71 - t72;
+	Fourier_Lanes_t t112 = t96 + t103;
+	Fourier_Lanes_t t113 = t96 - t103;
+	Fourier_Lanes_t t114 = t97 + t102;
+	Fourier_Lanes_t t115 = t97 - t102;
+	Fourier_Lanes_t t116 = t98 + t101;
+	Fourier_Lanes_t t117 = t98 - t101;
+	Fourier_Lanes_t t118 = t99 + t100;
+	Fourier_Lanes_t t119 = t99 - t100;
+	Fourier_Lanes_t t120 = t112 + t118;
+	Fourier_Lanes_t t121 = t112 - t118;
+	Fourier_Lanes_t t122 = t114 + t116;
+	Fourier_Lanes_t t123 = t114 - t116;
+	Fourier_Lanes_t t124 = 0x1.A9B664p-1f*t119 + 0x1.1C73B4p-1f*t113;
+	Fourier_Lanes_t t125 = -0x1.1C73B4p-1f*t119 + 0x1.A9B664p-1f*t113;
+	Fourier_Lanes_t t126 = 0x1.F6297Cp-1f*t117 + 0x1.8F8B84p-3f*t115;
+	Fourier_Lanes_t t127 = -0x1.8F8B84p-3f*t117 + 0x1.F6297Cp-1f*t115;
+	Fourier_Lanes_t t128 = t120 + t122;
+	Fourier_Lanes_t t129 = t120 - t122;
+	Fourier_Lanes_t t130 = 0x1.87DE2Ap-2f*t123 + 0x1.D906BCp-1f*t121;
+	Fourier_Lanes_t t131 = -0x1.D906BCp-1f*t123 + 0x1.87DE2Ap-2f*t121;
+	Fourier_Lanes_t t132 = t125 + t126;
+	Fourier_Lanes_t t133 = t125 - t126;
+	Fourier_Lanes_t t134 = t124 + t127;
+	Fourier_Lanes_t t135 = t124 - t127;
+	Fourier_Lanes_t t136 = t129 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t137 = t132 + t134;
+	Fourier_Lanes_t t138 = t137 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t139 = t132 - t134;
+	Fourier_Lanes_t t140 = t139 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t141 = 0x1.FD88DAp-1f*t104 + 0x1.917A6Cp-4f*t111;
+	Fourier_Lanes_t t142 = 0x1.917A6Cp-4f*t104 - 0x1.FD88DAp-1f*t111;
+	Fourier_Lanes_t t143 = 0x1.E9F414p-1f*t105 + 0x1.294064p-2f*t110;
+	Fourier_Lanes_t t144 = -0x1.294064p-2f*t105 + 0x1.E9F414p-1f*t110;
+	Fourier_Lanes_t t145 = 0x1.C38B3p-1f*t106 + 0x1.E2B5D4p-2f*t109;
+	Fourier_Lanes_t t146 = 0x1.E2B5D4p-2f*t106 - 0x1.C38B3p-1f*t109;
+	Fourier_Lanes_t t147 = 0x1.8BC808p-1f*t107 + 0x1.44CF32p-1f*t108;
+	Fourier_Lanes_t t148 = -0x1.44CF32p-1f*t107 + 0x1.8BC808p-1f*t108;
+	Fourier_Lanes_t t149 = t141 + t147;
+	Fourier_Lanes_t t150 = t141 - t147;
+	Fourier_Lanes_t t151 = t143 + t145;
+	Fourier_Lanes_t t152 = t143 - t145;
+	Fourier_Lanes_t t153 = t148 + t142;
+	Fourier_Lanes_t t154 = t148 - t142;
+	Fourier_Lanes_t t155 = t146 + t144;
+	Fourier_Lanes_t t156 = t146 - t144;
+	Fourier_Lanes_t t157 = t149 + t151;
+	Fourier_Lanes_t t158 = t149 - t151;
+	Fourier_Lanes_t t159 = 0x1.D906BCp-1f*t150 + 0x1.87DE2Ap-2f*t152;
+	Fourier_Lanes_t t160 = 0x1.87DE2Ap-2f*t150 - 0x1.D906BCp-1f*t152;
+	Fourier_Lanes_t t161 = t153 + t155;
+	Fourier_Lanes_t t162 = t153 - t155;
+	Fourier_Lanes_t t163 = 0x1.D906BCp-1f*t154 + 0x1.87DE2Ap-2f*t156;
+	Fourier_Lanes_t t164 = 0x1.87DE2Ap-2f*t154 - 0x1.D906BCp-1f*t156;
+	Fourier_Lanes_t t165 = t159 - t164;
+	Fourier_Lanes_t t166 = t159 + t164;
+	Fourier_Lanes_t t167 = t158 + t162;
+	Fourier_Lanes_t t168 = t167 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t169 = t158 - t162;
+	Fourier_Lanes_t t170 = t169 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t171 = t160 - t163;
+	Fourier_Lanes_t t172 = t160 + t163;
+	Fourier_Lanes_t t173 = 0x1.FF621Ep-1f*t80 + 0x1.91F66p-5f*t95;
+	Fourier_Lanes_t t174 = 0x1.91F66p-5f*t80 - 0x1.FF621Ep-1f*t95;
+	Fourier_Lanes_t t175 = 0x1.FA7558p-1f*t81 + 0x1.2C8106p-3f*t94;
+	Fourier_Lanes_t t176 = -0x1.2C8106p-3f*t81 + 0x1.FA7558p-1f*t94;
+	Fourier_Lanes_t t177 = 0x1.F0A7Fp-1f*t82 + 0x1.F19F98p-3f*t93;
+	Fourier_Lanes_t t178 = 0x1.F19F98p-3f*t82 - 0x1.F0A7Fp-1f*t93;
+	Fourier_Lanes_t t179 = 0x1.E2121p-1f*t83 + 0x1.58F9A8p-2f*t92;
+	Fourier_Lanes_t t180 = -0x1.58F9A8p-2f*t83 + 0x1.E2121p-1f*t92;
+	Fourier_Lanes_t t181 = 0x1.CED7Bp-1f*t84 + 0x1.B5D1p-2f*t91;
+	Fourier_Lanes_t t182 = 0x1.B5D1p-2f*t84 - 0x1.CED7Bp-1f*t91;
+	Fourier_Lanes_t t183 = 0x1.B72834p-1f*t85 + 0x1.07387Ap-1f*t90;
+	Fourier_Lanes_t t184 = -0x1.07387Ap-1f*t85 + 0x1.B72834p-1f*t90;
+	Fourier_Lanes_t t185 = 0x1.9B3E04p-1f*t86 + 0x1.30FF8p-1f*t89;
+	Fourier_Lanes_t t186 = 0x1.30FF8p-1f*t86 - 0x1.9B3E04p-1f*t89;
+	Fourier_Lanes_t t187 = 0x1.7B5DF2p-1f*t87 + 0x1.57D694p-1f*t88;
+	Fourier_Lanes_t t188 = -0x1.57D694p-1f*t87 + 0x1.7B5DF2p-1f*t88;
+	Fourier_Lanes_t t189 = t173 + t187;
+	Fourier_Lanes_t t190 = t173 - t187;
+	Fourier_Lanes_t t191 = t175 + t185;
+	Fourier_Lanes_t t192 = t175 - t185;
+	Fourier_Lanes_t t193 = t177 + t183;
+	Fourier_Lanes_t t194 = t177 - t183;
+	Fourier_Lanes_t t195 = t179 + t181;
+	Fourier_Lanes_t t196 = t179 - t181;
+	Fourier_Lanes_t t197 = t189 + t195;
+	Fourier_Lanes_t t198 = t189 - t195;
+	Fourier_Lanes_t t199 = t191 + t193;
+	Fourier_Lanes_t t200 = t191 - t193;
+	Fourier_Lanes_t t201 = 0x1.A9B664p-1f*t196 + 0x1.1C73B4p-1f*t190;
+	Fourier_Lanes_t t202 = -0x1.1C73B4p-1f*t196 + 0x1.A9B664p-1f*t190;
+	Fourier_Lanes_t t203 = 0x1.F6297Cp-1f*t194 + 0x1.8F8B84p-3f*t192;
+	Fourier_Lanes_t t204 = -0x1.8F8B84p-3f*t194 + 0x1.F6297Cp-1f*t192;
+	Fourier_Lanes_t t205 = t197 + t199;
+	Fourier_Lanes_t t206 = t197 - t199;
+	Fourier_Lanes_t t207 = 0x1.87DE2Ap-2f*t200 + 0x1.D906BCp-1f*t198;
+	Fourier_Lanes_t t208 = -0x1.D906BCp-1f*t200 + 0x1.87DE2Ap-2f*t198;
+	Fourier_Lanes_t t209 = t202 + t203;
+	Fourier_Lanes_t t210 = t202 - t203;
+	Fourier_Lanes_t t211 = t201 + t204;
+	Fourier_Lanes_t t212 = t201 - t204;
+	Fourier_Lanes_t t213 = t206 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t214 = t209 + t211;
+	Fourier_Lanes_t t215 = t214 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t216 = t209 - t211;
+	Fourier_Lanes_t t217 = t216 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t218 = t174 + t188;
+	Fourier_Lanes_t t219 = t174 - t188;
+	Fourier_Lanes_t t220 = t176 + t186;
+	Fourier_Lanes_t t221 = t176 - t186;
+	Fourier_Lanes_t t222 = t178 + t184;
+	Fourier_Lanes_t t223 = t178 - t184;
+	Fourier_Lanes_t t224 = t180 + t182;
+	Fourier_Lanes_t t225 = t180 - t182;
+	Fourier_Lanes_t t226 = t218 + t224;
+	Fourier_Lanes_t t227 = t218 - t224;
+	Fourier_Lanes_t t228 = t220 + t222;
+	Fourier_Lanes_t t229 = t220 - t222;
+	Fourier_Lanes_t t230 = 0x1.A9B664p-1f*t225 + 0x1.1C73B4p-1f*t219;
+	Fourier_Lanes_t t231 = -0x1.1C73B4p-1f*t225 + 0x1.A9B664p-1f*t219;
+	Fourier_Lanes_t t232 = 0x1.F6297Cp-1f*t223 + 0x1.8F8B84p-3f*t221;
+	Fourier_Lanes_t t233 = -0x1.8F8B84p-3f*t223 + 0x1.F6297Cp-1f*t221;
+	Fourier_Lanes_t t234 = t226 + t228;
+	Fourier_Lanes_t t235 = t226 - t228;
+	Fourier_Lanes_t t236 = 0x1.87DE2Ap-2f*t229 + 0x1.D906BCp-1f*t227;
+	Fourier_Lanes_t t237 = -0x1.D906BCp-1f*t229 + 0x1.87DE2Ap-2f*t227;
+	Fourier_Lanes_t t238 = t231 + t232;
+	Fourier_Lanes_t t239 = t231 - t232;
+	Fourier_Lanes_t t240 = t230 + t233;
+	Fourier_Lanes_t t241 = t230 - t233;
+	Fourier_Lanes_t t242 = t235 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t243 = t238 + t240;
+	Fourier_Lanes_t t244 = t243 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t245 = t238 - t240;
+	Fourier_Lanes_t t246 = t245 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t247 = t215 + t246;
+	Fourier_Lanes_t t248 = t215 - t246;
+	Fourier_Lanes_t t249 = t207 + t237;
+	Fourier_Lanes_t t250 = t207 - t237;
+	Fourier_Lanes_t t251 = t210 + t241;
+	Fourier_Lanes_t t252 = t210 - t241;
+	Fourier_Lanes_t t253 = t213 + t242;
+	Fourier_Lanes_t t254 = t213 - t242;
+	Fourier_Lanes_t t255 = t212 + t239;
+	Fourier_Lanes_t t256 = t212 - t239;
+	Fourier_Lanes_t t257 = t208 + t236;
+	Fourier_Lanes_t t258 = t208 - t236;
+	Fourier_Lanes_t t259 = t217 + t244;
+	Fourier_Lanes_t t260 = t217 - t244;
+	Fourier_Lanes_t t261 = t1 + t63;
+	Fourier_Lanes_t t262 = t3 + t61;
+	Fourier_Lanes_t t263 = t5 + t59;
+	Fourier_Lanes_t t264 = t7 + t57;
+	Fourier_Lanes_t t265 = t9 + t55;
+	Fourier_Lanes_t t266 = t11 + t53;
+	Fourier_Lanes_t t267 = t13 + t51;
+	Fourier_Lanes_t t268 = t15 + t49;
+	Fourier_Lanes_t t269 = t17 + t47;
+	Fourier_Lanes_t t270 = t19 + t45;
+	Fourier_Lanes_t t271 = t21 + t43;
+	Fourier_Lanes_t t272 = t23 + t41;
+	Fourier_Lanes_t t273 = t25 + t39;
+	Fourier_Lanes_t t274 = t27 + t37;
+	Fourier_Lanes_t t275 = t29 + t35;
+	Fourier_Lanes_t t276 = t31 + t33;
+	Fourier_Lanes_t t277 = t1 - t63;
+	Fourier_Lanes_t t278 = t3 - t61;
+	Fourier_Lanes_t t279 = t5 - t59;
+	Fourier_Lanes_t t280 = t7 - t57;
+	Fourier_Lanes_t t281 = t9 - t55;
+	Fourier_Lanes_t t282 = t11 - t53;
+	Fourier_Lanes_t t283 = t13 - t51;
+	Fourier_Lanes_t t284 = t15 - t49;
+	Fourier_Lanes_t t285 = t17 - t47;
+	Fourier_Lanes_t t286 = t19 - t45;
+	Fourier_Lanes_t t287 = t21 - t43;
+	Fourier_Lanes_t t288 = t23 - t41;
+	Fourier_Lanes_t t289 = t25 - t39;
+	Fourier_Lanes_t t290 = t27 - t37;
+	Fourier_Lanes_t t291 = t29 - t35;
+	Fourier_Lanes_t t292 = t31 - t33;
+	Fourier_Lanes_t t293 = t261 + t276;
+	Fourier_Lanes_t t294 = t262 + t275;
+	Fourier_Lanes_t t295 = t263 + t274;
+	Fourier_Lanes_t t296 = t264 + t273;
+	Fourier_Lanes_t t297 = t265 + t272;
+	Fourier_Lanes_t t298 = t266 + t271;
+	Fourier_Lanes_t t299 = t267 + t270;
+	Fourier_Lanes_t t300 = t268 + t269;
+	Fourier_Lanes_t t301 = t261 - t276;
+	Fourier_Lanes_t t302 = t262 - t275;
+	Fourier_Lanes_t t303 = t263 - t274;
+	Fourier_Lanes_t t304 = t264 - t273;
+	Fourier_Lanes_t t305 = t265 - t272;
+	Fourier_Lanes_t t306 = t266 - t271;
+	Fourier_Lanes_t t307 = t267 - t270;
+	Fourier_Lanes_t t308 = t268 - t269;
+	Fourier_Lanes_t t309 = t293 + t300;
+	Fourier_Lanes_t t310 = t293 - t300;
+	Fourier_Lanes_t t311 = t294 + t299;
+	Fourier_Lanes_t t312 = t294 - t299;
+	Fourier_Lanes_t t313 = t295 + t298;
+	Fourier_Lanes_t t314 = t295 - t298;
+	Fourier_Lanes_t t315 = t296 + t297;
+	Fourier_Lanes_t t316 = t296 - t297;
+	Fourier_Lanes_t t317 = t309 + t315;
+	Fourier_Lanes_t t318 = t309 - t315;
+	Fourier_Lanes_t t319 = t311 + t313;
+	Fourier_Lanes_t t320 = t311 - t313;
+	Fourier_Lanes_t t321 = 0x1.A9B664p-1f*t316 + 0x1.1C73B4p-1f*t310;
+	Fourier_Lanes_t t322 = -0x1.1C73B4p-1f*t316 + 0x1.A9B664p-1f*t310;
+	Fourier_Lanes_t t323 = 0x1.F6297Cp-1f*t314 + 0x1.8F8B84p-3f*t312;
+	Fourier_Lanes_t t324 = -0x1.8F8B84p-3f*t314 + 0x1.F6297Cp-1f*t312;
+	Fourier_Lanes_t t325 = t317 + t319;
+	Fourier_Lanes_t t326 = t317 - t319;
+	Fourier_Lanes_t t327 = 0x1.87DE2Ap-2f*t320 + 0x1.D906BCp-1f*t318;
+	Fourier_Lanes_t t328 = -0x1.D906BCp-1f*t320 + 0x1.87DE2Ap-2f*t318;
+	Fourier_Lanes_t t329 = t322 + t323;
+	Fourier_Lanes_t t330 = t322 - t323;
+	Fourier_Lanes_t t331 = t321 + t324;
+	Fourier_Lanes_t t332 = t321 - t324;
+	Fourier_Lanes_t t333 = t326 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t334 = t329 + t331;
+	Fourier_Lanes_t t335 = t334 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t336 = t329 - t331;
+	Fourier_Lanes_t t337 = t336 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t338 = 0x1.FD88DAp-1f*t301 + 0x1.917A6Cp-4f*t308;
+	Fourier_Lanes_t t339 = 0x1.917A6Cp-4f*t301 - 0x1.FD88DAp-1f*t308;
+	Fourier_Lanes_t t340 = 0x1.E9F414p-1f*t302 + 0x1.294064p-2f*t307;
+	Fourier_Lanes_t t341 = -0x1.294064p-2f*t302 + 0x1.E9F414p-1f*t307;
+	Fourier_Lanes_t t342 = 0x1.C38B3p-1f*t303 + 0x1.E2B5D4p-2f*t306;
+	Fourier_Lanes_t t343 = 0x1.E2B5D4p-2f*t303 - 0x1.C38B3p-1f*t306;
+	Fourier_Lanes_t t344 = 0x1.8BC808p-1f*t304 + 0x1.44CF32p-1f*t305;
+	Fourier_Lanes_t t345 = -0x1.44CF32p-1f*t304 + 0x1.8BC808p-1f*t305;
+	Fourier_Lanes_t t346 = t338 + t344;
+	Fourier_Lanes_t t347 = t338 - t344;
+	Fourier_Lanes_t t348 = t340 + t342;
+	Fourier_Lanes_t t349 = t340 - t342;
+	Fourier_Lanes_t t350 = t345 + t339;
+	Fourier_Lanes_t t351 = t345 - t339;
+	Fourier_Lanes_t t352 = t343 + t341;
+	Fourier_Lanes_t t353 = t343 - t341;
+	Fourier_Lanes_t t354 = t346 + t348;
+	Fourier_Lanes_t t355 = t346 - t348;
+	Fourier_Lanes_t t356 = 0x1.D906BCp-1f*t347 + 0x1.87DE2Ap-2f*t349;
+	Fourier_Lanes_t t357 = 0x1.87DE2Ap-2f*t347 - 0x1.D906BCp-1f*t349;
+	Fourier_Lanes_t t358 = t350 + t352;
+	Fourier_Lanes_t t359 = t350 - t352;
+	Fourier_Lanes_t t360 = 0x1.D906BCp-1f*t351 + 0x1.87DE2Ap-2f*t353;
+	Fourier_Lanes_t t361 = 0x1.87DE2Ap-2f*t351 - 0x1.D906BCp-1f*t353;
+	Fourier_Lanes_t t362 = t356 - t361;
+	Fourier_Lanes_t t363 = t356 + t361;
+	Fourier_Lanes_t t364 = t355 + t359;
+	Fourier_Lanes_t t365 = t364 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t366 = t355 - t359;
+	Fourier_Lanes_t t367 = t366 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t368 = t357 - t360;
+	Fourier_Lanes_t t369 = t357 + t360;
+	Fourier_Lanes_t t370 = 0x1.FF621Ep-1f*t277 + 0x1.91F66p-5f*t292;
+	Fourier_Lanes_t t371 = 0x1.91F66p-5f*t277 - 0x1.FF621Ep-1f*t292;
+	Fourier_Lanes_t t372 = 0x1.FA7558p-1f*t278 + 0x1.2C8106p-3f*t291;
+	Fourier_Lanes_t t373 = -0x1.2C8106p-3f*t278 + 0x1.FA7558p-1f*t291;
+	Fourier_Lanes_t t374 = 0x1.F0A7Fp-1f*t279 + 0x1.F19F98p-3f*t290;
+	Fourier_Lanes_t t375 = 0x1.F19F98p-3f*t279 - 0x1.F0A7Fp-1f*t290;
+	Fourier_Lanes_t t376 = 0x1.E2121p-1f*t280 + 0x1.58F9A8p-2f*t289;
+	Fourier_Lanes_t t377 = -0x1.58F9A8p-2f*t280 + 0x1.E2121p-1f*t289;
+	Fourier_Lanes_t t378 = 0x1.CED7Bp-1f*t281 + 0x1.B5D1p-2f*t288;
+	Fourier_Lanes_t t379 = 0x1.B5D1p-2f*t281 - 0x1.CED7Bp-1f*t288;
+	Fourier_Lanes_t t380 = 0x1.B72834p-1f*t282 + 0x1.07387Ap-1f*t287;
+	Fourier_Lanes_t t381 = -0x1.07387Ap-1f*t282 + 0x1.B72834p-1f*t287;
+	Fourier_Lanes_t t382 = 0x1.9B3E04p-1f*t283 + 0x1.30FF8p-1f*t286;
+	Fourier_Lanes_t t383 = 0x1.30FF8p-1f*t283 - 0x1.9B3E04p-1f*t286;
+	Fourier_Lanes_t t384 = 0x1.7B5DF2p-1f*t284 + 0x1.57D694p-1f*t285;
+	Fourier_Lanes_t t385 = -0x1.57D694p-1f*t284 + 0x1.7B5DF2p-1f*t285;
+	Fourier_Lanes_t t386 = t370 + t384;
+	Fourier_Lanes_t t387 = t370 - t384;
+	Fourier_Lanes_t t388 = t372 + t382;
+	Fourier_Lanes_t t389 = t372 - t382;
+	Fourier_Lanes_t t390 = t374 + t380;
+	Fourier_Lanes_t t391 = t374 - t380;
+	Fourier_Lanes_t t392 = t376 + t378;
+	Fourier_Lanes_t t393 = t376 - t378;
+	Fourier_Lanes_t t394 = t386 + t392;
+	Fourier_Lanes_t t395 = t386 - t392;
+	Fourier_Lanes_t t396 = t388 + t390;
+	Fourier_Lanes_t t397 = t388 - t390;
+	Fourier_Lanes_t t398 = 0x1.A9B664p-1f*t393 + 0x1.1C73B4p-1f*t387;
+	Fourier_Lanes_t t399 = -0x1.1C73B4p-1f*t393 + 0x1.A9B664p-1f*t387;
+	Fourier_Lanes_t t400 = 0x1.F6297Cp-1f*t391 + 0x1.8F8B84p-3f*t389;
+	Fourier_Lanes_t t401 = -0x1.8F8B84p-3f*t391 + 0x1.F6297Cp-1f*t389;
+	Fourier_Lanes_t t402 = t394 + t396;
+	Fourier_Lanes_t t403 = t394 - t396;
+	Fourier_Lanes_t t404 = 0x1.87DE2Ap-2f*t397 + 0x1.D906BCp-1f*t395;
+	Fourier_Lanes_t t405 = -0x1.D906BCp-1f*t397 + 0x1.87DE2Ap-2f*t395;
+	Fourier_Lanes_t t406 = t399 + t400;
+	Fourier_Lanes_t t407 = t399 - t400;
+	Fourier_Lanes_t t408 = t398 + t401;
+	Fourier_Lanes_t t409 = t398 - t401;
+	Fourier_Lanes_t t410 = t403 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t411 = t406 + t408;
+	Fourier_Lanes_t t412 = t411 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t413 = t406 - t408;
+	Fourier_Lanes_t t414 = t413 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t415 = t371 + t385;
+	Fourier_Lanes_t t416 = t371 - t385;
+	Fourier_Lanes_t t417 = t373 + t383;
+	Fourier_Lanes_t t418 = t373 - t383;
+	Fourier_Lanes_t t419 = t375 + t381;
+	Fourier_Lanes_t t420 = t375 - t381;
+	Fourier_Lanes_t t421 = t377 + t379;
+	Fourier_Lanes_t t422 = t377 - t379;
+	Fourier_Lanes_t t423 = t415 + t421;
+	Fourier_Lanes_t t424 = t415 - t421;
+	Fourier_Lanes_t t425 = t417 + t419;
+	Fourier_Lanes_t t426 = t417 - t419;
+	Fourier_Lanes_t t427 = 0x1.A9B664p-1f*t422 + 0x1.1C73B4p-1f*t416;
+	Fourier_Lanes_t t428 = -0x1.1C73B4p-1f*t422 + 0x1.A9B664p-1f*t416;
+	Fourier_Lanes_t t429 = 0x1.F6297Cp-1f*t420 + 0x1.8F8B84p-3f*t418;
+	Fourier_Lanes_t t430 = -0x1.8F8B84p-3f*t420 + 0x1.F6297Cp-1f*t418;
+	Fourier_Lanes_t t431 = t423 + t425;
+	Fourier_Lanes_t t432 = t423 - t425;
+	Fourier_Lanes_t t433 = 0x1.87DE2Ap-2f*t426 + 0x1.D906BCp-1f*t424;
+	Fourier_Lanes_t t434 = -0x1.D906BCp-1f*t426 + 0x1.87DE2Ap-2f*t424;
+	Fourier_Lanes_t t435 = t428 + t429;
+	Fourier_Lanes_t t436 = t428 - t429;
+	Fourier_Lanes_t t437 = t427 + t430;
+	Fourier_Lanes_t t438 = t427 - t430;
+	Fourier_Lanes_t t439 = t432 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t440 = t435 + t437;
+	Fourier_Lanes_t t441 = t440 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t442 = t435 - t437;
+	Fourier_Lanes_t t443 = t442 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t444 = t412 + t443;
+	Fourier_Lanes_t t445 = t412 - t443;
+	Fourier_Lanes_t t446 = t404 + t434;
+	Fourier_Lanes_t t447 = t404 - t434;
+	Fourier_Lanes_t t448 = t407 + t438;
+	Fourier_Lanes_t t449 = t407 - t438;
+	Fourier_Lanes_t t450 = t410 + t439;
+	Fourier_Lanes_t t451 = t410 - t439;
+	Fourier_Lanes_t t452 = t409 + t436;
+	Fourier_Lanes_t t453 = t409 - t436;
+	Fourier_Lanes_t t454 = t405 + t433;
+	Fourier_Lanes_t t455 = t405 - t433;
+	Fourier_Lanes_t t456 = t414 + t441;
+	Fourier_Lanes_t t457 = t414 - t441;
+	Fourier_Lanes_t t458 = t205 + t431;
+	Fourier_Lanes_t t459 = t205 - t431;
+	Fourier_Lanes_t t460 = t157 + t358;
+	Fourier_Lanes_t t461 = t157 - t358;
+	Fourier_Lanes_t t462 = t247 + t457;
+	Fourier_Lanes_t t463 = t247 - t457;
+	Fourier_Lanes_t t464 = t138 + t337;
+	Fourier_Lanes_t t465 = t138 - t337;
+	Fourier_Lanes_t t466 = t248 + t456;
+	Fourier_Lanes_t t467 = t248 - t456;
+	Fourier_Lanes_t t468 = t165 + t369;
+	Fourier_Lanes_t t469 = t165 - t369;
+	Fourier_Lanes_t t470 = t249 + t455;
+	Fourier_Lanes_t t471 = t249 - t455;
+	Fourier_Lanes_t t472 = t130 + t328;
+	Fourier_Lanes_t t473 = t130 - t328;
+	Fourier_Lanes_t t474 = t250 + t454;
+	Fourier_Lanes_t t475 = t250 - t454;
+	Fourier_Lanes_t t476 = t166 + t368;
+	Fourier_Lanes_t t477 = t166 - t368;
+	Fourier_Lanes_t t478 = t251 + t453;
+	Fourier_Lanes_t t479 = t251 - t453;
+	Fourier_Lanes_t t480 = t133 + t332;
+	Fourier_Lanes_t t481 = t133 - t332;
+	Fourier_Lanes_t t482 = t252 + t452;
+	Fourier_Lanes_t t483 = t252 - t452;
+	Fourier_Lanes_t t484 = t168 + t367;
+	Fourier_Lanes_t t485 = t168 - t367;
+	Fourier_Lanes_t t486 = t253 + t451;
+	Fourier_Lanes_t t487 = t253 - t451;
+	Fourier_Lanes_t t488 = t136 + t333;
+	Fourier_Lanes_t t489 = t136 - t333;
+	Fourier_Lanes_t t490 = t254 + t450;
+	Fourier_Lanes_t t491 = t254 - t450;
+	Fourier_Lanes_t t492 = t170 + t365;
+	Fourier_Lanes_t t493 = t170 - t365;
+	Fourier_Lanes_t t494 = t255 + t449;
+	Fourier_Lanes_t t495 = t255 - t449;
+	Fourier_Lanes_t t496 = t135 + t330;
+	Fourier_Lanes_t t497 = t135 - t330;
+	Fourier_Lanes_t t498 = t256 + t448;
+	Fourier_Lanes_t t499 = t256 - t448;
+	Fourier_Lanes_t t500 = t171 + t363;
+	Fourier_Lanes_t t501 = t171 - t363;
+	Fourier_Lanes_t t502 = t257 + t447;
+	Fourier_Lanes_t t503 = t257 - t447;
+	Fourier_Lanes_t t504 = t131 + t327;
+	Fourier_Lanes_t t505 = t131 - t327;
+	Fourier_Lanes_t t506 = t258 + t446;
+	Fourier_Lanes_t t507 = t258 - t446;
+	Fourier_Lanes_t t508 = t172 + t362;
+	Fourier_Lanes_t t509 = t172 - t362;
+	Fourier_Lanes_t t510 = t259 + t445;
+	Fourier_Lanes_t t511 = t259 - t445;
+	Fourier_Lanes_t t512 = t140 + t335;
+	Fourier_Lanes_t t513 = t140 - t335;
+	Fourier_Lanes_t t514 = t260 + t444;
+	Fourier_Lanes_t t515 = t260 - t444;
+	Fourier_Lanes_t t516 = t161 + t354;
+	Fourier_Lanes_t t517 = t161 - t354;
+	Fourier_Lanes_t t518 = t234 + t402;
+	Fourier_Lanes_t t519 = t234 - t402;
+	x[0] = t128;
+	x[1] = t458;
+	x[2] = t459;
+	x[3] = t460;
+	x[4] = t461;
+	x[5] = t462;
+	x[6] = t463;
+	x[7] = t464;
+	x[8] = t465;
+	x[9] = t466;
+	x[10] = t467;
+	x[11] = t468;
+	x[12] = t469;
+	x[13] = t470;
+	x[14] = t471;
+	x[15] = t472;
+	x[16] = t473;
+	x[17] = t474;
+	x[18] = t475;
+	x[19] = t476;
+	x[20] = t477;
+	x[21] = t478;
+	x[22] = t479;
+	x[23] = t480;
+	x[24] = t481;
+	x[25] = t482;
+	x[26] = t483;
+	x[27] = t484;
+	x[28] = t485;
+	x[29] = t486;
+	x[30] = t487;
+	x[31] = t488;
+	x[32] = t489;
+	x[33] = t490;
+	x[34] = t491;
+	x[35] = t492;
+	x[36] = t493;
+	x[37] = t494;
+	x[38] = t495;
+	x[39] = t496;
+	x[40] = t497;
+	x[41] = t498;
+	x[42] = t499;
+	x[43] = t500;
+	x[44] = t501;
+	x[45] = t502;
+	x[46] = t503;
+	x[47] = t504;
+	x[48] = t505;
+	x[49] = t506;
+	x[50] = t507;
+	x[51] = t508;
+	x[52] = t509;
+	x[53] = t510;
+	x[54] = t511;
+	x[55] = t512;
+	x[56] = t513;
+	x[57] = t514;
+	x[58] = t515;
+	x[59] = t516;
+	x[60] = t517;
+	x[61] = t518;
+	x[62] = t519;
+	x[63] = t325;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+#if defined(FOURIER_CODELETS_DCT4T_LANES)
+/**************************************/
+
+//! DCT-IV (transposed), lane-parallel (N=16)
+FOURIER_CODELET void DCT4T_Lanes_16(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = x[0] * 2.0f;
+	Fourier_Lanes_t t1 = x[1] + x[2];
+	Fourier_Lanes_t t2 = x[1] - x[2];
+	Fourier_Lanes_t t3 = x[3] + x[4];
+	Fourier_Lanes_t t4 = x[3] - x[4];
+	Fourier_Lanes_t t5 = x[5] + x[6];
+	Fourier_Lanes_t t6 = x[5] - x[6];
+	Fourier_Lanes_t t7 = x[7] + x[8];
+	Fourier_Lanes_t t8 = x[7] - x[8];
+	Fourier_Lanes_t t9 = x[9] + x[10];
+	Fourier_Lanes_t t10 = x[9] - x[10];
+	Fourier_Lanes_t t11 = x[11] + x[12];
+	Fourier_Lanes_t t12 = x[11] - x[12];
+	Fourier_Lanes_t t13 = x[13] + x[14];
+	Fourier_Lanes_t t14 = x[13] - x[14];
+	Fourier_Lanes_t t15 = x[15] * 2.0f;
+	Fourier_Lanes_t t16 = t7 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t17 = t1 + t13;
+	Fourier_Lanes_t t18 = t17 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t19 = t1 - t13;
+	Fourier_Lanes_t t20 = t19 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t21 = t0 * 0.5f;
+	Fourier_Lanes_t t22 = t21 + t16;
+	Fourier_Lanes_t t23 = t21 - t16;
+	Fourier_Lanes_t t24 = 0x1.87DE2Ap-2f*t3 - 0x1.D906BCp-1f*t11;
+	Fourier_Lanes_t t25 = 0x1.D906BCp-1f*t3 + 0x1.87DE2Ap-2f*t11;
+	Fourier_Lanes_t t26 = t18 + t5;
+	Fourier_Lanes_t t27 = t18 - t5;
+	Fourier_Lanes_t t28 = t20 + t9;
+	Fourier_Lanes_t t29 = t20 - t9;
+	Fourier_Lanes_t t30 = t22 + t25;
+	Fourier_Lanes_t t31 = t22 - t25;
+	Fourier_Lanes_t t32 = t23 + t24;
+	Fourier_Lanes_t t33 = t23 - t24;
+	Fourier_Lanes_t t34 = 0x1.A9B664p-1f*t28 - 0x1.1C73B4p-1f*t26;
+	Fourier_Lanes_t t35 = 0x1.1C73B4p-1f*t28 + 0x1.A9B664p-1f*t26;
+	Fourier_Lanes_t t36 = 0x1.F6297Cp-1f*t27 - 0x1.8F8B84p-3f*t29;
+	Fourier_Lanes_t t37 = 0x1.8F8B84p-3f*t27 + 0x1.F6297Cp-1f*t29;
+	Fourier_Lanes_t t38 = t30 + t35;
+	Fourier_Lanes_t t39 = t30 - t35;
+	Fourier_Lanes_t t40 = t32 + t37;
+	Fourier_Lanes_t t41 = t32 - t37;
+	Fourier_Lanes_t t42 = t33 + t36;
+	Fourier_Lanes_t t43 = t33 - t36;
+	Fourier_Lanes_t t44 = t31 + t34;
+	Fourier_Lanes_t t45 = t31 - t34;
+	Fourier_Lanes_t t46 = t8 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t47 = t14 + t2;
+	Fourier_Lanes_t t48 = t47 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t49 = t14 - t2;
+	Fourier_Lanes_t t50 = t49 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t51 = t15 * 0.5f;
+	Fourier_Lanes_t t52 = t51 + t46;
+	Fourier_Lanes_t t53 = t51 - t46;
+	Fourier_Lanes_t t54 = 0x1.87DE2Ap-2f*t12 - 0x1.D906BCp-1f*t4;
+	Fourier_Lanes_t t55 = 0x1.D906BCp-1f*t12 + 0x1.87DE2Ap-2f*t4;
+	Fourier_Lanes_t t56 = t48 + t10;
+	Fourier_Lanes_t t57 = t48 - t10;
+	Fourier_Lanes_t t58 = t50 + t6;
+	Fourier_Lanes_t t59 = t50 - t6;
+	Fourier_Lanes_t t60 = t52 + t55;
+	Fourier_Lanes_t t61 = t52 - t55;
+	Fourier_Lanes_t t62 = t53 + t54;
+	Fourier_Lanes_t t63 = t53 - t54;
+	Fourier_Lanes_t t64 = 0x1.A9B664p-1f*t58 - 0x1.1C73B4p-1f*t56;
+	Fourier_Lanes_t t65 = 0x1.1C73B4p-1f*t58 + 0x1.A9B664p-1f*t56;
+	Fourier_Lanes_t t66 = 0x1.F6297Cp-1f*t57 - 0x1.8F8B84p-3f*t59;
+	Fourier_Lanes_t t67 = 0x1.8F8B84p-3f*t57 + 0x1.F6297Cp-1f*t59;
+	Fourier_Lanes_t t68 = t60 + t65;
+	Fourier_Lanes_t t69 = t60 - t65;
+	Fourier_Lanes_t t70 = t62 + t67;
+	Fourier_Lanes_t t71 = t62 - t67;
+	Fourier_Lanes_t t72 = t63 + t66;
+	Fourier_Lanes_t t73 = t63 - t66;
+	Fourier_Lanes_t t74 = t61 + t64;
+	Fourier_Lanes_t t75 = t61 - t64;
+	Fourier_Lanes_t t76 = 0x1.FF621Ep-1f*t38 + 0x1.91F66p-5f*t68;
+	Fourier_Lanes_t t77 = 0x1.91F66p-5f*t38 - 0x1.FF621Ep-1f*t68;
+	Fourier_Lanes_t t78 = 0x1.FA7558p-1f*t40 - 0x1.2C8106p-3f*t70;
+	Fourier_Lanes_t t79 = 0x1.2C8106p-3f*t40 + 0x1.FA7558p-1f*t70;
+	Fourier_Lanes_t t80 = 0x1.F0A7Fp-1f*t42 + 0x1.F19F98p-3f*t72;
+	Fourier_Lanes_t t81 = 0x1.F19F98p-3f*t42 - 0x1.F0A7Fp-1f*t72;
+	Fourier_Lanes_t t82 = 0x1.E2121p-1f*t44 - 0x1.58F9A8p-2f*t74;
+	Fourier_Lanes_t t83 = 0x1.58F9A8p-2f*t44 + 0x1.E2121p-1f*t74;
+	Fourier_Lanes_t t84 = 0x1.CED7Bp-1f*t45 + 0x1.B5D1p-2f*t75;
+	Fourier_Lanes_t t85 = 0x1.B5D1p-2f*t45 - 0x1.CED7Bp-1f*t75;
+	Fourier_Lanes_t t86 = 0x1.B72834p-1f*t43 - 0x1.07387Ap-1f*t73;
+	Fourier_Lanes_t t87 = 0x1.07387Ap-1f*t43 + 0x1.B72834p-1f*t73;
+	Fourier_Lanes_t t88 = 0x1.9B3E04p-1f*t41 + 0x1.30FF8p-1f*t71;
+	Fourier_Lanes_t t89 = 0x1.30FF8p-1f*t41 - 0x1.9B3E04p-1f*t71;
+	Fourier_Lanes_t t90 = 0x1.7B5DF2p-1f*t39 - 0x1.57D694p-1f*t69;
+	Fourier_Lanes_t t91 = 0x1.57D694p-1f*t39 + 0x1.7B5DF2p-1f*t69;
+	x[0] = t76;
+	x[1] = t78;
+	x[2] = t80;
+	x[3] = t82;
+	x[4] = t84;
+	x[5] = t86;
+	x[6] = t88;
+	x[7] = t90;
+	x[8] = t91;
+	x[9] = t89;
+	x[10] = t87;
+	x[11] = t85;
+	x[12] = t83;
+	x[13] = t81;
+	x[14] = t79;
+	x[15] = t77;
+}
+
+//! DCT-IV (transposed), lane-parallel (N=32)
+FOURIER_CODELET void DCT4T_Lanes_32(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = x[0] * 2.0f;
+	Fourier_Lanes_t t1 = x[1] + x[2];
+	Fourier_Lanes_t t2 = x[1] - x[2];
+	Fourier_Lanes_t t3 = x[3] + x[4];
+	Fourier_Lanes_t t4 = x[3] - x[4];
+	Fourier_Lanes_t t5 = x[5] + x[6];
+	Fourier_Lanes_t t6 = x[5] - x[6];
+	Fourier_Lanes_t t7 = x[7] + x[8];
+	Fourier_Lanes_t t8 = x[7] - x[8];
+	Fourier_Lanes_t t9 = x[9] + x[10];
+	Fourier_Lanes_t t10 = x[9] - x[10];
+	Fourier_Lanes_t t11 = x[11] + x[12];
+	Fourier_Lanes_t t12 = x[11] - x[12];
+	Fourier_Lanes_t t13 = x[13] + x[14];
+	Fourier_Lanes_t t14 = x[13] - x[14];
+	Fourier_Lanes_t t15 = x[15] + x[16];
+	Fourier_Lanes_t t16 = x[15] - x[16];
+	Fourier_Lanes_t t17 = x[17] + x[18];
+	Fourier_Lanes_t t18 = x[17] - x[18];
+	Fourier_Lanes_t t19 = x[19] + x[20];
+	Fourier_Lanes_t t20 = x[19] - x[20];
+	Fourier_Lanes_t t21 = x[21] + x[22];
+	Fourier_Lanes_t t22 = x[21] - x[22];
+	Fourier_Lanes_t t23 = x[23] + x[24];
+	Fourier_Lanes_t t24 = x[23] - x[24];
+	Fourier_Lanes_t t25 = x[25] + x[26];
+	Fourier_Lanes_t t26 = x[25] - x[26];
+	Fourier_Lanes_t t27 = x[27] + x[28];
+	Fourier_Lanes_t t28 = x[27] - x[28];
+	Fourier_Lanes_t t29 = x[29] + x[30];
+	Fourier_Lanes_t t30 = x[29] - x[30];
+	Fourier_Lanes_t t31 = x[31] * 2.0f;
+	Fourier_Lanes_t t32 = t15 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t33 = t3 + t27;
+	Fourier_Lanes_t t34 = t33 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t35 = t3 - t27;
+	Fourier_Lanes_t t36 = t35 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t37 = t0 * 0.5f;
+	Fourier_Lanes_t t38 = t37 + t32;
+	Fourier_Lanes_t t39 = t37 - t32;
+	Fourier_Lanes_t t40 = 0x1.87DE2Ap-2f*t7 - 0x1.D906BCp-1f*t23;
+	Fourier_Lanes_t t41 = 0x1.D906BCp-1f*t7 + 0x1.87DE2Ap-2f*t23;
+	Fourier_Lanes_t t42 = t34 + t11;
+	Fourier_Lanes_t t43 = t34 - t11;
+	Fourier_Lanes_t t44 = t36 + t19;
+	Fourier_Lanes_t t45 = t36 - t19;
+	Fourier_Lanes_t t46 = t38 + t41;
+	Fourier_Lanes_t t47 = t38 - t41;
+	Fourier_Lanes_t t48 = t39 + t40;
+	Fourier_Lanes_t t49 = t39 - t40;
+	Fourier_Lanes_t t50 = 0x1.A9B664p-1f*t44 - 0x1.1C73B4p-1f*t42;
+	Fourier_Lanes_t t51 = 0x1.1C73B4p-1f*t44 + 0x1.A9B664p-1f*t42;
+	Fourier_Lanes_t t52 = 0x1.F6297Cp-1f*t43 - 0x1.8F8B84p-3f*t45;
+	Fourier_Lanes_t t53 = 0x1.8F8B84p-3f*t43 + 0x1.F6297Cp-1f*t45;
+	Fourier_Lanes_t t54 = t46 + t51;
+	Fourier_Lanes_t t55 = t46 - t51;
+	Fourier_Lanes_t t56 = t48 + t53;
+	Fourier_Lanes_t t57 = t48 - t53;
+	Fourier_Lanes_t t58 = t49 + t52;
+	Fourier_Lanes_t t59 = t49 - t52;
+	Fourier_Lanes_t t60 = t47 + t50;
+	Fourier_Lanes_t t61 = t47 - t50;
+	Fourier_Lanes_t t62 = t9 + t5;
+	Fourier_Lanes_t t63 = t9 - t5;
+	Fourier_Lanes_t t64 = t13 + t17;
+	Fourier_Lanes_t t65 = t64 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t66 = t13 - t17;
+	Fourier_Lanes_t t67 = t66 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t68 = t25 + t21;
+	Fourier_Lanes_t t69 = t25 - t21;
+	Fourier_Lanes_t t70 = t1 + t65;
+	Fourier_Lanes_t t71 = t1 - t65;
+	Fourier_Lanes_t t72 = 0x1.D906BCp-1f*t62 + 0x1.87DE2Ap-2f*t68;
+	Fourier_Lanes_t t73 = 0x1.87DE2Ap-2f*t62 - 0x1.D906BCp-1f*t68;
+	Fourier_Lanes_t t74 = t29 + t67;
+	Fourier_Lanes_t t75 = t29 - t67;
+	Fourier_Lanes_t t76 = 0x1.D906BCp-1f*t69 + 0x1.87DE2Ap-2f*t63;
+	Fourier_Lanes_t t77 = 0x1.87DE2Ap-2f*t69 - 0x1.D906BCp-1f*t63;
+	Fourier_Lanes_t t78 = t70 + t72;
+	Fourier_Lanes_t t79 = t70 - t72;
+	Fourier_Lanes_t t80 = t71 + t73;
+	Fourier_Lanes_t t81 = t71 - t73;
+	Fourier_Lanes_t t82 = t74 + t76;
+	Fourier_Lanes_t t83 = t74 - t76;
+	Fourier_Lanes_t t84 = t75 + t77;
+	Fourier_Lanes_t t85 = t75 - t77;
+	Fourier_Lanes_t t86 = 0x1.FD88DAp-1f*t78 + 0x1.917A6Cp-4f*t83;
+	Fourier_Lanes_t t87 = 0x1.917A6Cp-4f*t78 - 0x1.FD88DAp-1f*t83;
+	Fourier_Lanes_t t88 = 0x1.E9F414p-1f*t80 - 0x1.294064p-2f*t85;
+	Fourier_Lanes_t t89 = 0x1.294064p-2f*t80 + 0x1.E9F414p-1f*t85;
+	Fourier_Lanes_t t90 = 0x1.C38B3p-1f*t81 + 0x1.E2B5D4p-2f*t84;
+	Fourier_Lanes_t t91 = 0x1.E2B5D4p-2f*t81 - 0x1.C38B3p-1f*t84;
+	Fourier_Lanes_t t92 = 0x1.8BC808p-1f*t79 - 0x1.44CF32p-1f*t82;
+	Fourier_Lanes_t t93 = 0x1.44CF32p-1f*t79 + 0x1.8BC808p-1f*t82;
+	Fourier_Lanes_t t94 = t54 + t86;
+	Fourier_Lanes_t t95 = t54 - t86;
+	Fourier_Lanes_t t96 = t56 + t88;
+	Fourier_Lanes_t t97 = t56 - t88;
+	Fourier_Lanes_t t98 = t58 + t90;
+	Fourier_Lanes_t t99 = t58 - t90;
+	Fourier_Lanes_t t100 = t60 + t92;
+	Fourier_Lanes_t t101 = t60 - t92;
+	Fourier_Lanes_t t102 = t61 + t93;
+	Fourier_Lanes_t t103 = t61 - t93;
+	Fourier_Lanes_t t104 = t59 + t91;
+	Fourier_Lanes_t t105 = t59 - t91;
+	Fourier_Lanes_t t106 = t57 + t89;
+	Fourier_Lanes_t t107 = t57 - t89;
+	Fourier_Lanes_t t108 = t55 + t87;
+	Fourier_Lanes_t t109 = t55 - t87;
+	Fourier_Lanes_t t110 = t16 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t111 = t28 + t4;
+	Fourier_Lanes_t t112 = t111 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t113 = t28 - t4;
+	Fourier_Lanes_t t114 = t113 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t115 = t31 * 0.5f;
+	Fourier_Lanes_t t116 = t115 + t110;
+	Fourier_Lanes_t t117 = t115 - t110;
+	Fourier_Lanes_t t118 = 0x1.87DE2Ap-2f*t24 - 0x1.D906BCp-1f*t8;
+	Fourier_Lanes_t t119 = 0x1.D906BCp-1f*t24 + 0x1.87DE2Ap-2f*t8;
+	Fourier_Lanes_t t120 = t112 + t20;
+	Fourier_Lanes_t t121 = t112 - t20;
+	Fourier_Lanes_t t122 = t114 + t12;
+	Fourier_Lanes_t t123 = t114 - t12;
+	Fourier_Lanes_t t124 = t116 + t119;
+	Fourier_Lanes_t t125 = t116 - t119;
+	Fourier_Lanes_t t126 = t117 + t118;
+	Fourier_Lanes_t t127 = t117 - t118;
+	Fourier_Lanes_t t128 = 0x1.A9B664p-1f*t122 - 0x1.1C73B4p-1f*t120;
+	Fourier_Lanes_t t129 = 0x1.1C73B4p-1f*t122 + 0x1.A9B664p-1f*t120;
+	Fourier_Lanes_t t130 = 0x1.F6297Cp-1f*t121 - 0x1.8F8B84p-3f*t123;
+	Fourier_Lanes_t t131 = 0x1.8F8B84p-3f*t121 + 0x1.F6297Cp-1f*t123;
+	Fourier_Lanes_t t132 = t124 + t129;
+	Fourier_Lanes_t t133 = t124 - t129;
+	Fourier_Lanes_t t134 = t126 + t131;
+	Fourier_Lanes_t t135 = t126 - t131;
+	Fourier_Lanes_t t136 = t127 + t130;
+	Fourier_Lanes_t t137 = t127 - t130;
+	Fourier_Lanes_t t138 = t125 + t128;
+	Fourier_Lanes_t t139 = t125 - t128;
+	Fourier_Lanes_t t140 = t22 + t26;
+	Fourier_Lanes_t t141 = t22 - t26;
+	Fourier_Lanes_t t142 = t18 + t14;
+	Fourier_Lanes_t t143 = t142 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t144 = t18 - t14;
+	Fourier_Lanes_t t145 = t144 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t146 = t6 + t10;
+	Fourier_Lanes_t t147 = t6 - t10;
+	Fourier_Lanes_t t148 = t30 + t143;
+	Fourier_Lanes_t t149 = t30 - t143;
+	Fourier_Lanes_t t150 = 0x1.D906BCp-1f*t140 + 0x1.87DE2Ap-2f*t146;
+	Fourier_Lanes_t t151 = 0x1.87DE2Ap-2f*t140 - 0x1.D906BCp-1f*t146;
+	Fourier_Lanes_t t152 = t2 + t145;
+	Fourier_Lanes_t t153 = t2 - t145;
+	Fourier_Lanes_t t154 = 0x1.D906BCp-1f*t147 + 0x1.87DE2Ap-2f*t141;
+	Fourier_Lanes_t t155 = 0x1.87DE2Ap-2f*t147 - 0x1.D906BCp-1f*t141;
+	Fourier_Lanes_t t156 = t148 + t150;
+	Fourier_Lanes_t t157 = t148 - t150;
+	Fourier_Lanes_t t158 = t149 + t151;
+	Fourier_Lanes_t t159 = t149 - t151;
+	Fourier_Lanes_t t160 = t152 + t154;
+	Fourier_Lanes_t t161 = t152 - t154;
+	Fourier_Lanes_t t162 = t153 + t155;
+	Fourier_Lanes_t t163 = t153 - t155;
+	Fourier_Lanes_t t164 = 0x1.FD88DAp-1f*t156 + 0x1.917A6Cp-4f*t161;
+	Fourier_Lanes_t t165 = 0x1.917A6Cp-4f*t156 - 0x1.FD88DAp-1f*t161;
+	Fourier_Lanes_t t166 = 0x1.E9F414p-1f*t158 - 0x1.294064p-2f*t163;
+	Fourier_Lanes_t t167 = 0x1.294064p-2f*t158 + 0x1.E9F414p-1f*t163;
+	Fourier_Lanes_t t168 = 0x1.C38B3p-1f*t159 + 0x1.E2B5D4p-2f*t162;
+	Fourier_Lanes_t t169 = 0x1.E2B5D4p-2f*t159 - 0x1.C38B3p-1f*t162;
+	Fourier_Lanes_t t170 = 0x1.8BC808p-1f*t157 - 0x1.44CF32p-1f*t160;
+	Fourier_Lanes_t t171 = 0x1.44CF32p-1f*t157 + 0x1.8BC808p-1f*t160;
+	Fourier_Lanes_t t172 = t132 + t164;
+	Fourier_Lanes_t t173 = t132 - t164;
+	Fourier_Lanes_t t174 = t134 + t166;
+	Fourier_Lanes_t t175 = t134 - t166;
+	Fourier_Lanes_t t176 = t136 + t168;
+	Fourier_Lanes_t t177 = t136 - t168;
+	Fourier_Lanes_t t178 = t138 + t170;
+	Fourier_Lanes_t t179 = t138 - t170;
+	Fourier_Lanes_t t180 = t139 + t171;
+	Fourier_Lanes_t t181 = t139 - t171;
+	Fourier_Lanes_t t182 = t137 + t169;
+	Fourier_Lanes_t t183 = t137 - t169;
+	Fourier_Lanes_t t184 = t135 + t167;
+	Fourier_Lanes_t t185 = t135 - t167;
+	Fourier_Lanes_t t186 = t133 + t165;
+	Fourier_Lanes_t t187 = t133 - t165;
+	Fourier_Lanes_t t188 = 0x1.FFD886p-1f*t94 + 0x1.92156p-6f*t172;
+	Fourier_Lanes_t t189 = 0x1.92156p-6f*t94 - 0x1.FFD886p-1f*t172;
+	Fourier_Lanes_t t190 = 0x1.FE9CDAp-1f*t96 - 0x1.2D520Ap-4f*t174;
+	Fourier_Lanes_t t191 = 0x1.2D520Ap-4f*t96 + 0x1.FE9CDAp-1f*t174;
+	Fourier_Lanes_t t192 = 0x1.FC2648p-1f*t98 + 0x1.F564E6p-4f*t176;
+	Fourier_Lanes_t t193 = 0x1.F564E6p-4f*t98 - 0x1.FC2648p-1f*t176;
+	Fourier_Lanes_t t194 = 0x1.F8765p-1f*t100 - 0x1.5E2144p-3f*t178;
+	Fourier_Lanes_t t195 = 0x1.5E2144p-3f*t100 + 0x1.F8765p-1f*t178;
+	Fourier_Lanes_t t196 = 0x1.F38F3Ap-1f*t102 + 0x1.C0B826p-3f*t180;
+	Fourier_Lanes_t t197 = 0x1.C0B826p-3f*t102 - 0x1.F38F3Ap-1f*t180;
+	Fourier_Lanes_t t198 = 0x1.ED740Ep-1f*t104 - 0x1.111D26p-2f*t182;
+	Fourier_Lanes_t t199 = 0x1.111D26p-2f*t104 + 0x1.ED740Ep-1f*t182;
+	Fourier_Lanes_t t200 = 0x1.E6288Ep-1f*t106 + 0x1.4135CAp-2f*t184;
+	Fourier_Lanes_t t201 = 0x1.4135CAp-2f*t106 - 0x1.E6288Ep-1f*t184;
+	Fourier_Lanes_t t202 = 0x1.DDB13Cp-1f*t108 - 0x1.708854p-2f*t186;
+	Fourier_Lanes_t t203 = 0x1.708854p-2f*t108 + 0x1.DDB13Cp-1f*t186;
+	Fourier_Lanes_t t204 = 0x1.D4134Ep-1f*t109 + 0x1.9EF794p-2f*t187;
+	Fourier_Lanes_t t205 = 0x1.9EF794p-2f*t109 - 0x1.D4134Ep-1f*t187;
+	Fourier_Lanes_t t206 = 0x1.C954B2p-1f*t107 - 0x1.CC66EAp-2f*t185;
+	Fourier_Lanes_t t207 = 0x1.CC66EAp-2f*t107 + 0x1.C954B2p-1f*t185;
+	Fourier_Lanes_t t208 = 0x1.BD7C0Ap-1f*t105 + 0x1.F8BA4Ep-2f*t183;
+	Fourier_Lanes_t t209 = 0x1.F8BA4Ep-2f*t105 - 0x1.BD7C0Ap-1f*t183;
+	Fourier_Lanes_t t210 = 0x1.B090A6p-1f*t103 - 0x1.11EB36p-1f*t181;
+	Fourier_Lanes_t t211 = 0x1.11EB36p-1f*t103 + 0x1.B090A6p-1f*t181;
+	Fourier_Lanes_t t212 = 0x1.A29A7Ap-1f*t101 + 0x1.26D054p-1f*t179;
+	Fourier_Lanes_t t213 = 0x1.26D054p-1f*t101 - 0x1.A29A7Ap-1f*t179;
+	Fourier_Lanes_t t214 = 0x1.93A224p-1f*t99 - 0x1.3AFFA2p-1f*t177;
+	Fourier_Lanes_t t215 = 0x1.3AFFA2p-1f*t99 + 0x1.93A224p-1f*t177;
+	Fourier_Lanes_t t216 = 0x1.83B0Ep-1f*t97 + 0x1.4E6CACp-1f*t175;
+	Fourier_Lanes_t t217 = 0x1.4E6CACp-1f*t97 - 0x1.83B0Ep-1f*t175;
+	Fourier_Lanes_t t218 = 0x1.72D084p-1f*t95 - 0x1.610B76p-1f*t173;
+	Fourier_Lanes_t t219 = 0x1.610B76p-1f*t95 + 0x1.72D084p-1f*t173;
+	x[0] = t188;
+	x[1] = t190;
+	x[2] = t192;
+	x[3] = t194;
+	x[4] = t196;
+	x[5] = t198;
+	x[6] = t200;
+	x[7] = t202;
+	x[8] = t204;
+	x[9] = t206;
+	x[10] = t208;
+	x[11] = t210;
+	x[12] = t212;
+	x[13] = t214;
+	x[14] = t216;
+	x[15] = t218;
+	x[16] = t219;
+	x[17] = t217;
+	x[18] = t215;
+	x[19] = t213;
+	x[20] = t211;
+	x[21] = t209;
+	x[22] = t207;
+	x[23] = t205;
+	x[24] = t203;
+	x[25] = t201;
+	x[26] = t199;
+	x[27] = t197;
+	x[28] = t195;
+	x[29] = t193;
+	x[30] = t191;
+	x[31] = t189;
+}
+
+//! DCT-IV (transposed), lane-parallel (N=64)
+FOURIER_CODELET void DCT4T_Lanes_64(Fourier_Lanes_t *x) {
+	Fourier_Lanes_t t0 = x[0] * 2.0f;
+	Fourier_Lanes_t t1 = x[1] + x[2];
+	Fourier_Lanes_t t2 = x[1] - x[2];
+	Fourier_Lanes_t t3 = x[3] + x[4];
+	Fourier_Lanes_t t4 = x[3] - x[4];
+	Fourier_Lanes_t t5 = x[5] + x[6];
+	Fourier_Lanes_t t6 = x[5] - x[6];
+	Fourier_Lanes_t t7 = x[7] + x[8];
+	Fourier_Lanes_t t8 = x[7] - x[8];
+	Fourier_Lanes_t t9 = x[9] + x[10];
+	Fourier_Lanes_t t10 = x[9] - x[10];
+	Fourier_Lanes_t t11 = x[11] + x[12];
+	Fourier_Lanes_t t12 = x[11] - x[12];
+	Fourier_Lanes_t t13 = x[13] + x[14];
+	Fourier_Lanes_t t14 = x[13] - x[14];
+	Fourier_Lanes_t t15 = x[15] + x[16];
+	Fourier_Lanes_t t16 = x[15] - x[16];
+	Fourier_Lanes_t t17 = x[17] + x[18];
+	Fourier_Lanes_t t18 = x[17] - x[18];
+	Fourier_Lanes_t t19 = x[19] + x[20];
+	Fourier_Lanes_t t20 = x[19] - x[20];
+	Fourier_Lanes_t t21 = x[21] + x[22];
+	Fourier_Lanes_t t22 = x[21] - x[22];
+	Fourier_Lanes_t t23 = x[23] + x[24];
+	Fourier_Lanes_t t24 = x[23] - x[24];
+	Fourier_Lanes_t t25 = x[25] + x[26];
+	Fourier_Lanes_t t26 = x[25] - x[26];
+	Fourier_Lanes_t t27 = x[27] + x[28];
+	Fourier_Lanes_t t28 = x[27] - x[28];
+	Fourier_Lanes_t t29 = x[29] + x[30];
+	Fourier_Lanes_t t30 = x[29] - x[30];
+	Fourier_Lanes_t t31 = x[31] + x[32];
+	Fourier_Lanes_t t32 = x[31] - x[32];
+	Fourier_Lanes_t t33 = x[33] + x[34];
+	Fourier_Lanes_t t34 = x[33] - x[34];
+	Fourier_Lanes_t t35 = x[35] + x[36];
+	Fourier_Lanes_t t36 = x[35] - x[36];
+	Fourier_Lanes_t t37 = x[37] + x[38];
+	Fourier_Lanes_t t38 = x[37] - x[38];
+	Fourier_Lanes_t t39 = x[39] + x[40];
+	Fourier_Lanes_t t40 = x[39] - x[40];
+	Fourier_Lanes_t t41 = x[41] + x[42];
+	Fourier_Lanes_t t42 = x[41] - x[42];
+	Fourier_Lanes_t t43 = x[43] + x[44];
+	Fourier_Lanes_t t44 = x[43] - x[44];
+	Fourier_Lanes_t t45 = x[45] + x[46];
+	Fourier_Lanes_t t46 = x[45] - x[46];
+	Fourier_Lanes_t t47 = x[47] + x[48];
+	Fourier_Lanes_t t48 = x[47] - x[48];
+	Fourier_Lanes_t t49 = x[49] + x[50];
+	Fourier_Lanes_t t50 = x[49] - x[50];
+	Fourier_Lanes_t t51 = x[51] + x[52];
+	Fourier_Lanes_t t52 = x[51] - x[52];
+	Fourier_Lanes_t t53 = x[53] + x[54];
+	Fourier_Lanes_t t54 = x[53] - x[54];
+	Fourier_Lanes_t t55 = x[55] + x[56];
+	Fourier_Lanes_t t56 = x[55] - x[56];
+	Fourier_Lanes_t t57 = x[57] + x[58];
+	Fourier_Lanes_t t58 = x[57] - x[58];
+	Fourier_Lanes_t t59 = x[59] + x[60];
+	Fourier_Lanes_t t60 = x[59] - x[60];
+	Fourier_Lanes_t t61 = x[61] + x[62];
+	Fourier_Lanes_t t62 = x[61] - x[62];
+	Fourier_Lanes_t t63 = x[63] * 2.0f;
+	Fourier_Lanes_t t64 = t31 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t65 = t7 + t55;
+	Fourier_Lanes_t t66 = t65 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t67 = t7 - t55;
+	Fourier_Lanes_t t68 = t67 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t69 = t0 * 0.5f;
+	Fourier_Lanes_t t70 = t69 + t64;
+	Fourier_Lanes_t t71 = t69 - t64;
+	Fourier_Lanes_t t72 = 0x1.87DE2Ap-2f*t15 - 0x1.D906BCp-1f*t47;
+	Fourier_Lanes_t t73 = 0x1.D906BCp-1f*t15 + 0x1.87DE2Ap-2f*t47;
+	Fourier_Lanes_t t74 = t66 + t23;
+	Fourier_Lanes_t t75 = t66 - t23;
+	Fourier_Lanes_t t76 = t68 + t39;
+	Fourier_Lanes_t t77 = t68 - t39;
+	Fourier_Lanes_t t78 = t70 + t73;
+	Fourier_Lanes_t t79 = t70 - t73;
+	Fourier_Lanes_t t80 = t71 + t72;
+	Fourier_Lanes_t t81 = t71 - t72;
+	Fourier_Lanes_t t82 = 0x1.A9B664p-1f*t76 - 0x1.1C73B4p-1f*t74;
+	Fourier_Lanes_t t83 = 0x1.1C73B4p-1f*t76 + 0x1.A9B664p-1f*t74;
+	Fourier_Lanes_t t84 = 0x1.F6297Cp-1f*t75 - 0x1.8F8B84p-3f*t77;
+	Fourier_Lanes_t t85 = 0x1.8F8B84p-3f*t75 + 0x1.F6297Cp-1f*t77;
+	Fourier_Lanes_t t86 = t78 + t83;
+	Fourier_Lanes_t t87 = t78 - t83;
+	Fourier_Lanes_t t88 = t80 + t85;
+	Fourier_Lanes_t t89 = t80 - t85;
+	Fourier_Lanes_t t90 = t81 + t84;
+	Fourier_Lanes_t t91 = t81 - t84;
+	Fourier_Lanes_t t92 = t79 + t82;
+	Fourier_Lanes_t t93 = t79 - t82;
+	Fourier_Lanes_t t94 = t19 + t11;
+	Fourier_Lanes_t t95 = t19 - t11;
+	Fourier_Lanes_t t96 = t27 + t35;
+	Fourier_Lanes_t t97 = t96 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t98 = t27 - t35;
+	Fourier_Lanes_t t99 = t98 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t100 = t51 + t43;
+	Fourier_Lanes_t t101 = t51 - t43;
+	Fourier_Lanes_t t102 = t3 + t97;
+	Fourier_Lanes_t t103 = t3 - t97;
+	Fourier_Lanes_t t104 = 0x1.D906BCp-1f*t94 + 0x1.87DE2Ap-2f*t100;
+	Fourier_Lanes_t t105 = 0x1.87DE2Ap-2f*t94 - 0x1.D906BCp-1f*t100;
+	Fourier_Lanes_t t106 = t59 + t99;
+	Fourier_Lanes_t t107 = t59 - t99;
+	Fourier_Lanes_t t108 = 0x1.D906BCp-1f*t101 + 0x1.87DE2Ap-2f*t95;
+	Fourier_Lanes_t t109 = 0x1.87DE2Ap-2f*t101 - 0x1.D906BCp-1f*t95;
+	Fourier_Lanes_t t110 = t102 + t104;
+	Fourier_Lanes_t t111 = t102 - t104;
+	Fourier_Lanes_t t112 = t103 + t105;
+	Fourier_Lanes_t t113 = t103 - t105;
+	Fourier_Lanes_t t114 = t106 + t108;
+	Fourier_Lanes_t t115 = t106 - t108;
+	Fourier_Lanes_t t116 = t107 + t109;
+	Fourier_Lanes_t t117 = t107 - t109;
+	Fourier_Lanes_t t118 = 0x1.FD88DAp-1f*t110 + 0x1.917A6Cp-4f*t115;
+	Fourier_Lanes_t t119 = 0x1.917A6Cp-4f*t110 - 0x1.FD88DAp-1f*t115;
+	Fourier_Lanes_t t120 = 0x1.E9F414p-1f*t112 - 0x1.294064p-2f*t117;
+	Fourier_Lanes_t t121 = 0x1.294064p-2f*t112 + 0x1.E9F414p-1f*t117;
+	Fourier_Lanes_t t122 = 0x1.C38B3p-1f*t113 + 0x1.E2B5D4p-2f*t116;
+	Fourier_Lanes_t t123 = 0x1.E2B5D4p-2f*t113 - 0x1.C38B3p-1f*t116;
+	Fourier_Lanes_t t124 = 0x1.8BC808p-1f*t111 - 0x1.44CF32p-1f*t114;
+	Fourier_Lanes_t t125 = 0x1.44CF32p-1f*t111 + 0x1.8BC808p-1f*t114;
+	Fourier_Lanes_t t126 = t86 + t118;
+	Fourier_Lanes_t t127 = t86 - t118;
+	Fourier_Lanes_t t128 = t88 + t120;
+	Fourier_Lanes_t t129 = t88 - t120;
+	Fourier_Lanes_t t130 = t90 + t122;
+	Fourier_Lanes_t t131 = t90 - t122;
+	Fourier_Lanes_t t132 = t92 + t124;
+	Fourier_Lanes_t t133 = t92 - t124;
+	Fourier_Lanes_t t134 = t93 + t125;
+	Fourier_Lanes_t t135 = t93 - t125;
+	Fourier_Lanes_t t136 = t91 + t123;
+	Fourier_Lanes_t t137 = t91 - t123;
+	Fourier_Lanes_t t138 = t89 + t121;
+	Fourier_Lanes_t t139 = t89 - t121;
+	Fourier_Lanes_t t140 = t87 + t119;
+	Fourier_Lanes_t t141 = t87 - t119;
+	Fourier_Lanes_t t142 = t1 * 2.0f;
+	Fourier_Lanes_t t143 = t5 + t9;
+	Fourier_Lanes_t t144 = t5 - t9;
+	Fourier_Lanes_t t145 = t13 + t17;
+	Fourier_Lanes_t t146 = t13 - t17;
+	Fourier_Lanes_t t147 = t21 + t25;
+	Fourier_Lanes_t t148 = t21 - t25;
+	Fourier_Lanes_t t149 = t29 + t33;
+	Fourier_Lanes_t t150 = t29 - t33;
+	Fourier_Lanes_t t151 = t37 + t41;
+	Fourier_Lanes_t t152 = t37 - t41;
+	Fourier_Lanes_t t153 = t45 + t49;
+	Fourier_Lanes_t t154 = t45 - t49;
+	Fourier_Lanes_t t155 = t53 + t57;
+	Fourier_Lanes_t t156 = t53 - t57;
+	Fourier_Lanes_t t157 = t61 * 2.0f;
+	Fourier_Lanes_t t158 = t149 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t159 = t143 + t155;
+	Fourier_Lanes_t t160 = t159 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t161 = t143 - t155;
+	Fourier_Lanes_t t162 = t161 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t163 = t142 * 0.5f;
+	Fourier_Lanes_t t164 = t163 + t158;
+	Fourier_Lanes_t t165 = t163 - t158;
+	Fourier_Lanes_t t166 = 0x1.87DE2Ap-2f*t145 - 0x1.D906BCp-1f*t153;
+	Fourier_Lanes_t t167 = 0x1.D906BCp-1f*t145 + 0x1.87DE2Ap-2f*t153;
+	Fourier_Lanes_t t168 = t160 + t147;
+	Fourier_Lanes_t t169 = t160 - t147;
+	Fourier_Lanes_t t170 = t162 + t151;
+	Fourier_Lanes_t t171 = t162 - t151;
+	Fourier_Lanes_t t172 = t164 + t167;
+	Fourier_Lanes_t t173 = t164 - t167;
+	Fourier_Lanes_t t174 = t165 + t166;
+	Fourier_Lanes_t t175 = t165 - t166;
+	Fourier_Lanes_t t176 = 0x1.A9B664p-1f*t170 - 0x1.1C73B4p-1f*t168;
+	Fourier_Lanes_t t177 = 0x1.1C73B4p-1f*t170 + 0x1.A9B664p-1f*t168;
+	Fourier_Lanes_t t178 = 0x1.F6297Cp-1f*t169 - 0x1.8F8B84p-3f*t171;
+	Fourier_Lanes_t t179 = 0x1.8F8B84p-3f*t169 + 0x1.F6297Cp-1f*t171;
+	Fourier_Lanes_t t180 = t172 + t177;
+	Fourier_Lanes_t t181 = t172 - t177;
+	Fourier_Lanes_t t182 = t174 + t179;
+	Fourier_Lanes_t t183 = t174 - t179;
+	Fourier_Lanes_t t184 = t175 + t178;
+	Fourier_Lanes_t t185 = t175 - t178;
+	Fourier_Lanes_t t186 = t173 + t176;
+	Fourier_Lanes_t t187 = t173 - t176;
+	Fourier_Lanes_t t188 = t150 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t189 = t156 + t144;
+	Fourier_Lanes_t t190 = t189 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t191 = t156 - t144;
+	Fourier_Lanes_t t192 = t191 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t193 = t157 * 0.5f;
+	Fourier_Lanes_t t194 = t193 + t188;
+	Fourier_Lanes_t t195 = t193 - t188;
+	Fourier_Lanes_t t196 = 0x1.87DE2Ap-2f*t154 - 0x1.D906BCp-1f*t146;
+	Fourier_Lanes_t t197 = 0x1.D906BCp-1f*t154 + 0x1.87DE2Ap-2f*t146;
+	Fourier_Lanes_t t198 = t190 + t152;
+	Fourier_Lanes_t t199 = t190 - t152;
+	Fourier_Lanes_t t200 = t192 + t148;
+	Fourier_Lanes_t t201 = t192 - t148;
+	Fourier_Lanes_t t202 = t194 + t197;
+	Fourier_Lanes_t t203 = t194 - t197;
+	Fourier_Lanes_t t204 = t195 + t196;
+	Fourier_Lanes_t t205 = t195 - t196;
+	Fourier_Lanes_t t206 = 0x1.A9B664p-1f*t200 - 0x1.1C73B4p-1f*t198;
+	Fourier_Lanes_t t207 = 0x1.1C73B4p-1f*t200 + 0x1.A9B664p-1f*t198;
+	Fourier_Lanes_t t208 = 0x1.F6297Cp-1f*t199 - 0x1.8F8B84p-3f*t201;
+	Fourier_Lanes_t t209 = 0x1.8F8B84p-3f*t199 + 0x1.F6297Cp-1f*t201;
+	Fourier_Lanes_t t210 = t202 + t207;
+	Fourier_Lanes_t t211 = t202 - t207;
+	Fourier_Lanes_t t212 = t204 + t209;
+	Fourier_Lanes_t t213 = t204 - t209;
+	Fourier_Lanes_t t214 = t205 + t208;
+	Fourier_Lanes_t t215 = t205 - t208;
+	Fourier_Lanes_t t216 = t203 + t206;
+	Fourier_Lanes_t t217 = t203 - t206;
+	Fourier_Lanes_t t218 = 0x1.FF621Ep-1f*t180 + 0x1.91F66p-5f*t210;
+	Fourier_Lanes_t t219 = 0x1.91F66p-5f*t180 - 0x1.FF621Ep-1f*t210;
+	Fourier_Lanes_t t220 = 0x1.FA7558p-1f*t182 - 0x1.2C8106p-3f*t212;
+	Fourier_Lanes_t t221 = 0x1.2C8106p-3f*t182 + 0x1.FA7558p-1f*t212;
+	Fourier_Lanes_t t222 = 0x1.F0A7Fp-1f*t184 + 0x1.F19F98p-3f*t214;
+	Fourier_Lanes_t t223 = 0x1.F19F98p-3f*t184 - 0x1.F0A7Fp-1f*t214;
+	Fourier_Lanes_t t224 = 0x1.E2121p-1f*t186 - 0x1.58F9A8p-2f*t216;
+	Fourier_Lanes_t t225 = 0x1.58F9A8p-2f*t186 + 0x1.E2121p-1f*t216;
+	Fourier_Lanes_t t226 = 0x1.CED7Bp-1f*t187 + 0x1.B5D1p-2f*t217;
+	Fourier_Lanes_t t227 = 0x1.B5D1p-2f*t187 - 0x1.CED7Bp-1f*t217;
+	Fourier_Lanes_t t228 = 0x1.B72834p-1f*t185 - 0x1.07387Ap-1f*t215;
+	Fourier_Lanes_t t229 = 0x1.07387Ap-1f*t185 + 0x1.B72834p-1f*t215;
+	Fourier_Lanes_t t230 = 0x1.9B3E04p-1f*t183 + 0x1.30FF8p-1f*t213;
+	Fourier_Lanes_t t231 = 0x1.30FF8p-1f*t183 - 0x1.9B3E04p-1f*t213;
+	Fourier_Lanes_t t232 = 0x1.7B5DF2p-1f*t181 - 0x1.57D694p-1f*t211;
+	Fourier_Lanes_t t233 = 0x1.57D694p-1f*t181 + 0x1.7B5DF2p-1f*t211;
+	Fourier_Lanes_t t234 = t126 + t218;
+	Fourier_Lanes_t t235 = t126 - t218;
+	Fourier_Lanes_t t236 = t128 + t220;
+	Fourier_Lanes_t t237 = t128 - t220;
+	Fourier_Lanes_t t238 = t130 + t222;
+	Fourier_Lanes_t t239 = t130 - t222;
+	Fourier_Lanes_t t240 = t132 + t224;
+	Fourier_Lanes_t t241 = t132 - t224;
+	Fourier_Lanes_t t242 = t134 + t226;
+	Fourier_Lanes_t t243 = t134 - t226;
+	Fourier_Lanes_t t244 = t136 + t228;
+	Fourier_Lanes_t t245 = t136 - t228;
+	Fourier_Lanes_t t246 = t138 + t230;
+	Fourier_Lanes_t t247 = t138 - t230;
+	Fourier_Lanes_t t248 = t140 + t232;
+	Fourier_Lanes_t t249 = t140 - t232;
+	Fourier_Lanes_t t250 = t141 + t233;
+	Fourier_Lanes_t t251 = t141 - t233;
+	Fourier_Lanes_t t252 = t139 + t231;
+	Fourier_Lanes_t t253 = t139 - t231;
+	Fourier_Lanes_t t254 = t137 + t229;
+	Fourier_Lanes_t t255 = t137 - t229;
+	Fourier_Lanes_t t256 = t135 + t227;
+	Fourier_Lanes_t t257 = t135 - t227;
+	Fourier_Lanes_t t258 = t133 + t225;
+	Fourier_Lanes_t t259 = t133 - t225;
+	Fourier_Lanes_t t260 = t131 + t223;
+	Fourier_Lanes_t t261 = t131 - t223;
+	Fourier_Lanes_t t262 = t129 + t221;
+	Fourier_Lanes_t t263 = t129 - t221;
+	Fourier_Lanes_t t264 = t127 + t219;
+	Fourier_Lanes_t t265 = t127 - t219;
+	Fourier_Lanes_t t266 = t32 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t267 = t56 + t8;
+	Fourier_Lanes_t t268 = t267 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t269 = t56 - t8;
+	Fourier_Lanes_t t270 = t269 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t271 = t63 * 0.5f;
+	Fourier_Lanes_t t272 = t271 + t266;
+	Fourier_Lanes_t t273 = t271 - t266;
+	Fourier_Lanes_t t274 = 0x1.87DE2Ap-2f*t48 - 0x1.D906BCp-1f*t16;
+	Fourier_Lanes_t t275 = 0x1.D906BCp-1f*t48 + 0x1.87DE2Ap-2f*t16;
+	Fourier_Lanes_t t276 = t268 + t40;
+	Fourier_Lanes_t t277 = t268 - t40;
+	Fourier_Lanes_t t278 = t270 + t24;
+	Fourier_Lanes_t t279 = t270 - t24;
+	Fourier_Lanes_t t280 = t272 + t275;
+	Fourier_Lanes_t t281 = t272 - t275;
+	Fourier_Lanes_t t282 = t273 + t274;
+	Fourier_Lanes_t t283 = t273 - t274;
+	Fourier_Lanes_t t284 = 0x1.A9B664p-1f*t278 - 0x1.1C73B4p-1f*t276;
+	Fourier_Lanes_t t285 = 0x1.1C73B4p-1f*t278 + 0x1.A9B664p-1f*t276;
+	Fourier_Lanes_t t286 = 0x1.F6297Cp-1f*t277 - 0x1.8F8B84p-3f*t279;
+	Fourier_Lanes_t t287 = 0x1.8F8B84p-3f*t277 + 0x1.F6297Cp-1f*t279;
+	Fourier_Lanes_t t288 = t280 + t285;
+	Fourier_Lanes_t t289 = t280 - t285;
+	Fourier_Lanes_t t290 = t282 + t287;
+	Fourier_Lanes_t t291 = t282 - t287;
+	Fourier_Lanes_t t292 = t283 + t286;
+	Fourier_Lanes_t t293 = t283 - t286;
+	Fourier_Lanes_t t294 = t281 + t284;
+	Fourier_Lanes_t t295 = t281 - t284;
+	Fourier_Lanes_t t296 = t44 + t52;
+	Fourier_Lanes_t t297 = t44 - t52;
+	Fourier_Lanes_t t298 = t36 + t28;
+	Fourier_Lanes_t t299 = t298 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t300 = t36 - t28;
+	Fourier_Lanes_t t301 = t300 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t302 = t12 + t20;
+	Fourier_Lanes_t t303 = t12 - t20;
+	Fourier_Lanes_t t304 = t60 + t299;
+	Fourier_Lanes_t t305 = t60 - t299;
+	Fourier_Lanes_t t306 = 0x1.D906BCp-1f*t296 + 0x1.87DE2Ap-2f*t302;
+	Fourier_Lanes_t t307 = 0x1.87DE2Ap-2f*t296 - 0x1.D906BCp-1f*t302;
+	Fourier_Lanes_t t308 = t4 + t301;
+	Fourier_Lanes_t t309 = t4 - t301;
+	Fourier_Lanes_t t310 = 0x1.D906BCp-1f*t303 + 0x1.87DE2Ap-2f*t297;
+	Fourier_Lanes_t t311 = 0x1.87DE2Ap-2f*t303 - 0x1.D906BCp-1f*t297;
+	Fourier_Lanes_t t312 = t304 + t306;
+	Fourier_Lanes_t t313 = t304 - t306;
+	Fourier_Lanes_t t314 = t305 + t307;
+	Fourier_Lanes_t t315 = t305 - t307;
+	Fourier_Lanes_t t316 = t308 + t310;
+	Fourier_Lanes_t t317 = t308 - t310;
+	Fourier_Lanes_t t318 = t309 + t311;
+	Fourier_Lanes_t t319 = t309 - t311;
+	Fourier_Lanes_t t320 = 0x1.FD88DAp-1f*t312 + 0x1.917A6Cp-4f*t317;
+	Fourier_Lanes_t t321 = 0x1.917A6Cp-4f*t312 - 0x1.FD88DAp-1f*t317;
+	Fourier_Lanes_t t322 = 0x1.E9F414p-1f*t314 - 0x1.294064p-2f*t319;
+	Fourier_Lanes_t t323 = 0x1.294064p-2f*t314 + 0x1.E9F414p-1f*t319;
+	Fourier_Lanes_t t324 = 0x1.C38B3p-1f*t315 + 0x1.E2B5D4p-2f*t318;
+	Fourier_Lanes_t t325 = 0x1.E2B5D4p-2f*t315 - 0x1.C38B3p-1f*t318;
+	Fourier_Lanes_t t326 = 0x1.8BC808p-1f*t313 - 0x1.44CF32p-1f*t316;
+	Fourier_Lanes_t t327 = 0x1.44CF32p-1f*t313 + 0x1.8BC808p-1f*t316;
+	Fourier_Lanes_t t328 = t288 + t320;
+	Fourier_Lanes_t t329 = t288 - t320;
+	Fourier_Lanes_t t330 = t290 + t322;
+	Fourier_Lanes_t t331 = t290 - t322;
+	Fourier_Lanes_t t332 = t292 + t324;
+	Fourier_Lanes_t t333 = t292 - t324;
+	Fourier_Lanes_t t334 = t294 + t326;
+	Fourier_Lanes_t t335 = t294 - t326;
+	Fourier_Lanes_t t336 = t295 + t327;
+	Fourier_Lanes_t t337 = t295 - t327;
+	Fourier_Lanes_t t338 = t293 + t325;
+	Fourier_Lanes_t t339 = t293 - t325;
+	Fourier_Lanes_t t340 = t291 + t323;
+	Fourier_Lanes_t t341 = t291 - t323;
+	Fourier_Lanes_t t342 = t289 + t321;
+	Fourier_Lanes_t t343 = t289 - t321;
+	Fourier_Lanes_t t344 = t62 * 2.0f;
+	Fourier_Lanes_t t345 = t58 + t54;
+	Fourier_Lanes_t t346 = t58 - t54;
+	Fourier_Lanes_t t347 = t50 + t46;
+	Fourier_Lanes_t t348 = t50 - t46;
+	Fourier_Lanes_t t349 = t42 + t38;
+	Fourier_Lanes_t t350 = t42 - t38;
+	Fourier_Lanes_t t351 = t34 + t30;
+	Fourier_Lanes_t t352 = t34 - t30;
+	Fourier_Lanes_t t353 = t26 + t22;
+	Fourier_Lanes_t t354 = t26 - t22;
+	Fourier_Lanes_t t355 = t18 + t14;
+	Fourier_Lanes_t t356 = t18 - t14;
+	Fourier_Lanes_t t357 = t10 + t6;
+	Fourier_Lanes_t t358 = t10 - t6;
+	Fourier_Lanes_t t359 = t2 * 2.0f;
+	Fourier_Lanes_t t360 = t351 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t361 = t345 + t357;
+	Fourier_Lanes_t t362 = t361 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t363 = t345 - t357;
+	Fourier_Lanes_t t364 = t363 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t365 = t344 * 0.5f;
+	Fourier_Lanes_t t366 = t365 + t360;
+	Fourier_Lanes_t t367 = t365 - t360;
+	Fourier_Lanes_t t368 = 0x1.87DE2Ap-2f*t347 - 0x1.D906BCp-1f*t355;
+	Fourier_Lanes_t t369 = 0x1.D906BCp-1f*t347 + 0x1.87DE2Ap-2f*t355;
+	Fourier_Lanes_t t370 = t362 + t349;
+	Fourier_Lanes_t t371 = t362 - t349;
+	Fourier_Lanes_t t372 = t364 + t353;
+	Fourier_Lanes_t t373 = t364 - t353;
+	Fourier_Lanes_t t374 = t366 + t369;
+	Fourier_Lanes_t t375 = t366 - t369;
+	Fourier_Lanes_t t376 = t367 + t368;
+	Fourier_Lanes_t t377 = t367 - t368;
+	Fourier_Lanes_t t378 = 0x1.A9B664p-1f*t372 - 0x1.1C73B4p-1f*t370;
+	Fourier_Lanes_t t379 = 0x1.1C73B4p-1f*t372 + 0x1.A9B664p-1f*t370;
+	Fourier_Lanes_t t380 = 0x1.F6297Cp-1f*t371 - 0x1.8F8B84p-3f*t373;
+	Fourier_Lanes_t t381 = 0x1.8F8B84p-3f*t371 + 0x1.F6297Cp-1f*t373;
+	Fourier_Lanes_t t382 = t374 + t379;
+	Fourier_Lanes_t t383 = t374 - t379;
+	Fourier_Lanes_t t384 = t376 + t381;
+	Fourier_Lanes_t t385 = t376 - t381;
+	Fourier_Lanes_t t386 = t377 + t380;
+	Fourier_Lanes_t t387 = t377 - t380;
+	Fourier_Lanes_t t388 = t375 + t378;
+	Fourier_Lanes_t t389 = t375 - t378;
+	Fourier_Lanes_t t390 = t352 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t391 = t358 + t346;
+	Fourier_Lanes_t t392 = t391 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t393 = t358 - t346;
+	Fourier_Lanes_t t394 = t393 * 0x1.6A09E6p-1f;
+	Fourier_Lanes_t t395 = t359 * 0.5f;
+	Fourier_Lanes_t t396 = t395 + t390;
+	Fourier_Lanes_t t397 = t395 - t390;
+	Fourier_Lanes_t t398 = 0x1.87DE2Ap-2f*t356 - 0x1.D906BCp-1f*t348;
+	Fourier_Lanes_t t399 = 0x1.D906BCp-1f*t356 + 0x1.87DE2Ap-2f*t348;
+	Fourier_Lanes_t t400 = t392 + t354;
+	Fourier_Lanes_t t401 = t392 - t354;
+	Fourier_Lanes_t t402 = t394 + t350;
+	Fourier_Lanes_t t403 = t394 - t350;
+	Fourier_Lanes_t t404 = t396 + t399;
+	Fourier_Lanes_t t405 = t396 - t399;
+	Fourier_Lanes_t t406 = t397 + t398;
+	Fourier_Lanes_t t407 = t397 - t398;
+	Fourier_Lanes_t t408 = 0x1.A9B664p-1f*t402 - 0x1.1C73B4p-1f*t400;
+	Fourier_Lanes_t t409 = 0x1.1C73B4p-1f*t402 + 0x1.A9B664p-1f*t400;
+	Fourier_Lanes_t t410 = 0x1.F6297Cp-1f*t401 - 0x1.8F8B84p-3f*t403;
+	Fourier_Lanes_t t411 = 0x1.8F8B84p-3f*t401 + 0x1.F6297Cp-1f*t403;
+	Fourier_Lanes_t t412 = t404 + t409;
+	Fourier_Lanes_t t413 = t404 - t409;
+	Fourier_Lanes_t t414 = t406 + t411;
+	Fourier_Lanes_t t415 = t406 - t411;
+	Fourier_Lanes_t t416 = t407 + t410;
+	Fourier_Lanes_t t417 = t407 - t410;
+	Fourier_Lanes_t t418 = t405 + t408;
+	Fourier_Lanes_t t419 = t405 - t408;
+	Fourier_Lanes_t t420 = 0x1.FF621Ep-1f*t382 + 0x1.91F66p-5f*t412;
+	Fourier_Lanes_t t421 = 0x1.91F66p-5f*t382 - 0x1.FF621Ep-1f*t412;
+	Fourier_Lanes_t t422 = 0x1.FA7558p-1f*t384 - 0x1.2C8106p-3f*t414;
+	Fourier_Lanes_t t423 = 0x1.2C8106p-3f*t384 + 0x1.FA7558p-1f*t414;
+	Fourier_Lanes_t t424 = 0x1.F0A7Fp-1f*t386 + 0x1.F19F98p-3f*t416;
+	Fourier_Lanes_t t425 = 0x1.F19F98p-3f*t386 - 0x1.F0A7Fp-1f*t416;
+	Fourier_Lanes_t t426 = 0x1.E2121p-1f*t388 - 0x1.58F9A8p-2f*t418;
+	Fourier_Lanes_t t427 = 0x1.58F9A8p-2f*t388 + 0x1.E2121p-1f*t418;
+	Fourier_Lanes_t t428 = 0x1.CED7Bp-1f*t389 + 0x1.B5D1p-2f*t419;
+	Fourier_Lanes_t t429 = 0x1.B5D1p-2f*t389 - 0x1.CED7Bp-1f*t419;
+	Fourier_Lanes_t t430 = 0x1.B72834p-1f*t387 - 0x1.07387Ap-1f*t417;
+	Fourier_Lanes_t t431 = 0x1.07387Ap-1f*t387 + 0x1.B72834p-1f*t417;
+	Fourier_Lanes_t t432 = 0x1.9B3E04p-1f*t385 + 0x1.30FF8p-1f*t415;
+	Fourier_Lanes_t t433 = 0x1.30FF8p-1f*t385 - 0x1.9B3E04p-1f*t415;
+	Fourier_Lanes_t t434 = 0x1.7B5DF2p-1f*t383 - 0x1.57D694p-1f*t413;
+	Fourier_Lanes_t t435 = 0x1.57D694p-1f*t383 + 0x1.7B5DF2p-1f*t413;
+	Fourier_Lanes_t t436 = t328 + t420;
+	Fourier_Lanes_t t437 = t328 - t420;
+	Fourier_Lanes_t t438 = t330 + t422;
+	Fourier_Lanes_t t439 = t330 - t422;
+	Fourier_Lanes_t t440 = t332 + t424;
+	Fourier_Lanes_t t441 = t332 - t424;
+	Fourier_Lanes_t t442 = t334 + t426;
+	Fourier_Lanes_t t443 = t334 - t426;
+	Fourier_Lanes_t t444 = t336 + t428;
+	Fourier_Lanes_t t445 = t336 - t428;
+	Fourier_Lanes_t t446 = t338 + t430;
+	Fourier_Lanes_t t447 = t338 - t430;
+	Fourier_Lanes_t t448 = t340 + t432;
+	Fourier_Lanes_t t449 = t340 - t432;
+	Fourier_Lanes_t t450 = t342 + t434;
+	Fourier_Lanes_t t451 = t342 - t434;
+	Fourier_Lanes_t t452 = t343 + t435;
+	Fourier_Lanes_t t453 = t343 - t435;
+	Fourier_Lanes_t t454 = t341 + t433;
+	Fourier_Lanes_t t455 = t341 - t433;
+	Fourier_Lanes_t t456 = t339 + t431;
+	Fourier_Lanes_t t457 = t339 - t431;
+	Fourier_Lanes_t t458 = t337 + t429;
+	Fourier_Lanes_t t459 = t337 - t429;
+	Fourier_Lanes_t t460 = t335 + t427;
+	Fourier_Lanes_t t461 = t335 - t427;
+	Fourier_Lanes_t t462 = t333 + t425;
+	Fourier_Lanes_t t463 = t333 - t425;
+	Fourier_Lanes_t t464 = t331 + t423;
+	Fourier_Lanes_t t465 = t331 - t423;
+	Fourier_Lanes_t t466 = t329 + t421;
+	Fourier_Lanes_t t467 = t329 - t421;
+	Fourier_Lanes_t t468 = 0x1.FFF622p-1f*t234 + 0x1.921D2p-7f*t436;
+	Fourier_Lanes_t t469 = 0x1.921D2p-7f*t234 - 0x1.FFF622p-1f*t436;
+	Fourier_Lanes_t t470 = 0x1.FFA72Ep-1f*t236 - 0x1.2D8658p-5f*t438;
+	Fourier_Lanes_t t471 = 0x1.2D8658p-5f*t236 + 0x1.FFA72Ep-1f*t438;
+	Fourier_Lanes_t t472 = 0x1.FF0956p-1f*t238 + 0x1.F656E8p-5f*t440;
+	Fourier_Lanes_t t473 = 0x1.F656E8p-5f*t238 - 0x1.FF0956p-1f*t440;
+	Fourier_Lanes_t t474 = 0x1.FE1CBp-1f*t240 - 0x1.5F6Dp-4f*t442;
+	Fourier_Lanes_t t475 = 0x1.5F6Dp-4f*t240 + 0x1.FE1CBp-1f*t442;
+	Fourier_Lanes_t t476 = 0x1.FCE16p-1f*t242 + 0x1.C3785Cp-4f*t444;
+	Fourier_Lanes_t t477 = 0x1.C3785Cp-4f*t242 - 0x1.FCE16p-1f*t444;
+	Fourier_Lanes_t t478 = 0x1.FB5798p-1f*t244 - 0x1.139F0Cp-3f*t446;
+	Fourier_Lanes_t t479 = 0x1.139F0Cp-3f*t244 + 0x1.FB5798p-1f*t446;
+	Fourier_Lanes_t t480 = 0x1.F97F92p-1f*t246 + 0x1.45576Cp-3f*t448;
+	Fourier_Lanes_t t481 = 0x1.45576Cp-3f*t246 - 0x1.F97F92p-1f*t448;
+	Fourier_Lanes_t t482 = 0x1.F7599Ap-1f*t248 - 0x1.76DD9Ep-3f*t450;
+	Fourier_Lanes_t t483 = 0x1.76DD9Ep-3f*t248 + 0x1.F7599Ap-1f*t450;
+	Fourier_Lanes_t t484 = 0x1.F4E604p-1f*t250 + 0x1.A82A02p-3f*t452;
+	Fourier_Lanes_t t485 = 0x1.A82A02p-3f*t250 - 0x1.F4E604p-1f*t452;
+	Fourier_Lanes_t t486 = 0x1.F2253p-1f*t252 - 0x1.D934FEp-3f*t454;
+	Fourier_Lanes_t t487 = 0x1.D934FEp-3f*t252 + 0x1.F2253p-1f*t454;
+	Fourier_Lanes_t t488 = 0x1.EF178Ap-1f*t254 + 0x1.04FB8p-2f*t456;
+	Fourier_Lanes_t t489 = 0x1.04FB8p-2f*t254 - 0x1.EF178Ap-1f*t456;
+	Fourier_Lanes_t t490 = 0x1.EBBD8Cp-1f*t256 - 0x1.1D3444p-2f*t458;
+	Fourier_Lanes_t t491 = 0x1.1D3444p-2f*t256 + 0x1.EBBD8Cp-1f*t458;
+	Fourier_Lanes_t t492 = 0x1.E817BAp-1f*t258 + 0x1.35410Cp-2f*t460;
+	Fourier_Lanes_t t493 = 0x1.35410Cp-2f*t258 - 0x1.E817BAp-1f*t460;
+	Fourier_Lanes_t t494 = 0x1.E426A4p-1f*t260 - 0x1.4D1E24p-2f*t462;
+	Fourier_Lanes_t t495 = 0x1.4D1E24p-2f*t260 + 0x1.E426A4p-1f*t462;
+	Fourier_Lanes_t t496 = 0x1.DFEAE6p-1f*t262 + 0x1.64C7DEp-2f*t464;
+	Fourier_Lanes_t t497 = 0x1.64C7DEp-2f*t262 - 0x1.DFEAE6p-1f*t464;
+	Fourier_Lanes_t t498 = 0x1.DB6526p-1f*t264 - 0x1.7C3A94p-2f*t466;
+	Fourier_Lanes_t t499 = 0x1.7C3A94p-2f*t264 + 0x1.DB6526p-1f*t466;
+	Fourier_Lanes_t t500 = 0x1.D69618p-1f*t265 + 0x1.9372A6p-2f*t467;
+	Fourier_Lanes_t t501 = 0x1.9372A6p-2f*t265 - 0x1.D69618p-1f*t467;
+	Fourier_Lanes_t t502 = 0x1.D17E78p-1f*t263 - 0x1.AA6C82p-2f*t465;
+	Fourier_Lanes_t t503 = 0x1.AA6C82p-2f*t263 + 0x1.D17E78p-1f*t465;
+	Fourier_Lanes_t t504 = 0x1.CC1F1p-1f*t261 + 0x1.C1249Ep-2f*t463;
+	Fourier_Lanes_t t505 = 0x1.C1249Ep-2f*t261 - 0x1.CC1F1p-1f*t463;
+	Fourier_Lanes_t t506 = 0x1.C678B4p-1f*t259 - 0x1.D79776p-2f*t461;
+	Fourier_Lanes_t t507 = 0x1.D79776p-2f*t259 + 0x1.C678B4p-1f*t461;
+	Fourier_Lanes_t t508 = 0x1.C08C42p-1f*t257 + 0x1.EDC196p-2f*t459;
+	Fourier_Lanes_t t509 = 0x1.EDC196p-2f*t257 - 0x1.C08C42p-1f*t459;
+	Fourier_Lanes_t t510 = 0x1.BA5AA6p-1f*t255 - 0x1.01CFC8p-1f*t457;
+	Fourier_Lanes_t t511 = 0x1.01CFC8p-1f*t255 + 0x1.BA5AA6p-1f*t457;
+	Fourier_Lanes_t t512 = 0x1.B3E4D4p-1f*t253 + 0x1.0C9704p-1f*t455;
+	Fourier_Lanes_t t513 = 0x1.0C9704p-1f*t253 - 0x1.B3E4D4p-1f*t455;
+	Fourier_Lanes_t t514 = 0x1.AD2BCAp-1f*t251 - 0x1.1734D6p-1f*t453;
+	Fourier_Lanes_t t515 = 0x1.1734D6p-1f*t251 + 0x1.AD2BCAp-1f*t453;
+	Fourier_Lanes_t t516 = 0x1.A63092p-1f*t249 + 0x1.21A79Ap-1f*t451;
+	Fourier_Lanes_t t517 = 0x1.21A79Ap-1f*t249 - 0x1.A63092p-1f*t451;
+	Fourier_Lanes_t t518 = 0x1.9EF43Ep-1f*t247 - 0x1.2BEDB2p-1f*t449;
+	Fourier_Lanes_t t519 = 0x1.2BEDB2p-1f*t247 + 0x1.9EF43Ep-1f*t449;
+	Fourier_Lanes_t t520 = 0x1.9777Fp-1f*t245 + 0x1.36058Cp-1f*t447;
+	Fourier_Lanes_t t521 = 0x1.36058Cp-1f*t245 - 0x1.9777Fp-1f*t447;
+	Fourier_Lanes_t t522 = 0x1.8FBCCAp-1f*t243 - 0x1.3FED96p-1f*t445;
+	Fourier_Lanes_t t523 = 0x1.3FED96p-1f*t243 + 0x1.8FBCCAp-1f*t445;
+	Fourier_Lanes_t t524 = 0x1.87C4p-1f*t241 + 0x1.49A44Ap-1f*t443;
+	Fourier_Lanes_t t525 = 0x1.49A44Ap-1f*t241 - 0x1.87C4p-1f*t443;
+	Fourier_Lanes_t t526 = 0x1.7F8ECEp-1f*t239 - 0x1.53282Ap-1f*t441;
+	Fourier_Lanes_t t527 = 0x1.53282Ap-1f*t239 + 0x1.7F8ECEp-1f*t441;
+	Fourier_Lanes_t t528 = 0x1.771E76p-1f*t237 + 0x1.5C77BCp-1f*t439;
+	Fourier_Lanes_t t529 = 0x1.5C77BCp-1f*t237 - 0x1.771E76p-1f*t439;
+	Fourier_Lanes_t t530 = 0x1.6E7446p-1f*t235 - 0x1.659192p-1f*t437;
+	Fourier_Lanes_t t531 = 0x1.659192p-1f*t235 + 0x1.6E7446p-1f*t437;
+	x[0] = t468;
+	x[1] = t470;
+	x[2] = t472;
+	x[3] = t474;
+	x[4] = t476;
+	x[5] = t478;
+	x[6] = t480;
+	x[7] = t482;
+	x[8] = t484;
+	x[9] = t486;
+	x[10] = t488;
+	x[11] = t490;
+	x[12] = t492;
+	x[13] = t494;
+	x[14] = t496;
+	x[15] = t498;
+	x[16] = t500;
+	x[17] = t502;
+	x[18] = t504;
+	x[19] = t506;
+	x[20] = t508;
+	x[21] = t510;
+	x[22] = t512;
+	x[23] = t514;
+	x[24] = t516;
+	x[25] = t518;
+	x[26] = t520;
+	x[27] = t522;
+	x[28] = t524;
+	x[29] = t526;
+	x[30] = t528;
+	x[31] = t530;
+	x[32] = t531;
+	x[33] = t529;
+	x[34] = t527;
+	x[35] = t525;
+	x[36] = t523;
+	x[37] = t521;
+	x[38] = t519;
+	x[39] = t517;
+	x[40] = t515;
+	x[41] = t513;
+	x[42] = t511;
+	x[43] = t509;
+	x[44] = t507;
+	x[45] = t505;
+	x[46] = t503;
+	x[47] = t501;
+	x[48] = t499;
+	x[49] = t497;
+	x[50] = t495;
+	x[51] = t493;
+	x[52] = t491;
+	x[53] = t489;
+	x[54] = t487;
+	x[55] = t485;
+	x[56] = t483;
+	x[57] = t481;
+	x[58] = t479;
+	x[59] = t477;
+	x[60] = t475;
+	x[61] = t473;
+	x[62] = t471;
+	x[63] = t469;
+}
+
+/**************************************/
+#endif
+
+/**************************************/
+//! EOF
+/**************************************/
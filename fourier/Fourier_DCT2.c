@@ -12,6 +12,9 @@
 /**************************************/
 #include "Fourier.h"
 /**************************************/
+#define FOURIER_CODELETS_DCT2
+#include "Fourier_Codelets.h"
+/**************************************/
 
 //! DCT-II (N=8)
 static void DCT2_8(float *x) {
@@ -67,9 +70,13 @@ void Fourier_DCT2(float *Buf, float *Tmp, int N) {
 	int i;
 
 	//! Stop condition
-	if(N == 8) {
-		DCT2_8(Buf);
-		return;
+	//! NOTE: Sizes up to 64 use straight-line codelets, as the
+	//! recursion overhead dominates at these sizes.
+	switch(N) {
+		case  8: DCT2_8 (Buf); return;
+		case 16: DCT2_16(Buf); return;
+		case 32: DCT2_32(Buf); return;
+		case 64: DCT2_64(Buf); return;
 	}
 
 	//! Perform butterflies
@@ -82,7 +89,22 @@ void Fourier_DCT2(float *Buf, float *Tmp, int N) {
 #if defined(__AVX__)
 		__m256 a, b;
 		__m256 s, d;
-		for(i=0;i<N/2;i+=8) {
+		i = 0;
+#if defined(__AVX512F__)
+		__m512i Rev = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+		if(N >= FOURIER_AVX512_MIN_N) for(;i<N/2-15;i+=16) {
+			__m512 a, b;
+			__m512 s, d;
+			SrcHi -= 16; b = _mm512_loadu_ps(SrcHi);
+			a = _mm512_loadu_ps(SrcLo); SrcLo += 16;
+			b = _mm512_permutexvar_ps(Rev, b);
+			s = _mm512_add_ps(a, b);
+			d = _mm512_sub_ps(a, b);
+			_mm512_storeu_ps(DstLo, s); DstLo += 16;
+			_mm512_storeu_ps(DstHi, d); DstHi += 16;
+		}
+#endif
+		for(;i<N/2;i+=8) {
 			SrcHi -= 8; b = _mm256_load_ps(SrcHi);
 			a = _mm256_load_ps(SrcLo); SrcLo += 8;
 			b = _mm256_shuffle_ps(b, b, 0x1B);
@@ -140,7 +162,22 @@ void Fourier_DCT2(float *Buf, float *Tmp, int N) {
 		__m256 a, b;
 		__m256 a0, b0;
 		__m256 t0, t1;
-		for(i=0;i<N/2;i+=8) {
+		i = 0;
+#if defined(__AVX512F__)
+		__m512i ZipLo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+		__m512i ZipHi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+		if(N >= FOURIER_AVX512_MIN_N) for(;i<N/2-15;i+=16) {
+			__m512 a, b;
+			__m512 a0, b0;
+			a0 = _mm512_loadu_ps(SrcLo); SrcLo += 16;
+			b0 = _mm512_loadu_ps(SrcHi); SrcHi += 16;
+			a  = _mm512_permutex2var_ps(a0, ZipLo, b0);
+			b  = _mm512_permutex2var_ps(a0, ZipHi, b0);
+			_mm512_storeu_ps(Dst +  0, a);
+			_mm512_storeu_ps(Dst + 16, b); Dst += 32;
+		}
+#endif
+		for(;i<N/2;i+=8) {
 			a0 = _mm256_load_ps(SrcLo); SrcLo += 8;
 			b0 = _mm256_load_ps(SrcHi); SrcHi += 8;
 			t0 = _mm256_unpacklo_ps(a0, b0);
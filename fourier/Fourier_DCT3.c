@@ -12,6 +12,9 @@
 /**************************************/
 #include "Fourier.h"
 /**************************************/
+#define FOURIER_CODELETS_DCT3
+#include "Fourier_Codelets.h"
+/**************************************/
 
 //! DCT-III (N=8)
 static void DCT3_8(float *x) {
@@ -63,9 +66,13 @@ void Fourier_DCT3(float *Buf, float *Tmp, int N) {
 	int i;
 
 	//! Stop condition
-	if(N == 8) {
-		DCT3_8(Buf);
-		return;
+	//! NOTE: Sizes up to 64 use straight-line codelets, as the
+	//! recursion overhead dominates at these sizes.
+	switch(N) {
+		case  8: DCT3_8 (Buf); return;
+		case 16: DCT3_16(Buf); return;
+		case 32: DCT3_32(Buf); return;
+		case 64: DCT3_64(Buf); return;
 	}
 
 	{
@@ -75,7 +82,22 @@ void Fourier_DCT3(float *Buf, float *Tmp, int N) {
 #if defined(__AVX__)
 		__m256 a0, b0;
 		__m256 a1, b1;
-		for(i=0;i<N/2;i+=8) {
+		i = 0;
+#if defined(__AVX512F__)
+		__m512i Even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+		__m512i Odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+		if(N >= FOURIER_AVX512_MIN_N) for(;i<N/2-15;i+=16) {
+			__m512 a0, b0;
+			__m512 a1, b1;
+			a0 = _mm512_loadu_ps(Src); Src += 16;
+			b0 = _mm512_loadu_ps(Src); Src += 16;
+			a1 = _mm512_permutex2var_ps(a0, Even, b0);
+			b1 = _mm512_permutex2var_ps(a0, Odd,  b0);
+			_mm512_storeu_ps(DstLo, a1); DstLo += 16;
+			_mm512_storeu_ps(DstHi, b1); DstHi += 16;
+		}
+#endif
+		for(;i<N/2;i+=8) {
 			a0 = _mm256_load_ps(Src); Src += 8;
 			b0 = _mm256_load_ps(Src); Src += 8;
 			a1 = _mm256_permute2f128_ps(a0, b0, 0x20);
@@ -118,7 +140,22 @@ void Fourier_DCT3(float *Buf, float *Tmp, int N) {
 #if defined(__AVX__)
 		__m256 a, b;
 		__m256 s, d;
-		for(i=0;i<N/2;i+=8) {
+		i = 0;
+#if defined(__AVX512F__)
+		__m512i Rev = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+		if(N >= FOURIER_AVX512_MIN_N) for(;i<N/2-15;i+=16) {
+			__m512 a, b;
+			__m512 s, d;
+			a = _mm512_loadu_ps(SrcLo); SrcLo += 16;
+			b = _mm512_loadu_ps(SrcHi); SrcHi += 16;
+			s = _mm512_add_ps(a, b);
+			d = _mm512_sub_ps(a, b);
+			d = _mm512_permutexvar_ps(Rev, d);
+			_mm512_storeu_ps(DstLo, s); DstLo += 16;
+			DstHi -= 16; _mm512_storeu_ps(DstHi, d);
+		}
+#endif
+		for(;i<N/2;i+=8) {
 			a = _mm256_load_ps(SrcLo); SrcLo += 8;
 			b = _mm256_load_ps(SrcHi); SrcHi += 8;
 			s = _mm256_add_ps(a, b);
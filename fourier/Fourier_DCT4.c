@@ -12,6 +12,9 @@
 /**************************************/
 #include "Fourier.h"
 /**************************************/
+#define FOURIER_CODELETS_DCT4
+#include "Fourier_Codelets.h"
+/**************************************/
 
 //! DCT-IV (N=8)
 static void DCT4_8(float *x) {
@@ -65,12 +68,335 @@ static void DCT4_8(float *x) {
 
 /**************************************/
 
+//! DCT-IV (N >= FOURIER_DCT4_FUSE_MIN_N), up to the final stage
+//! This reads the input from Src[] (which may be Buf[]), and
+//! leaves the four quarter-size transforms {z1,z2,z3,z4} in
+//! Tmp[] for DCT4_Fused() (or Fourier_IMDCT()) to interleave.
+static inline __attribute__((always_inline)) void DCT4_Head(const float *Src, float *Buf, float *Tmp, int N) {
+	int i;
+
+	//! Perform rotation butterflies and first DCT-II stage
+	//!  u = R_n.x
+	//!  v = (H_{n/2}.[u_j][j=0..n/2-1], H_{n/2}.[u_j][j=n/2..n-1])
+	//! NOTE: u_j and u_{n/2-1-j} are always of opposite sign
+	//! in the upper half, so the sign masks are swapped.
+	{
+		const float *WinS0  = Fourier_SinTableN(N);
+		const float *WinC0  = WinS0 + N;
+		const float *WinS1  = WinS0 + N/2;
+		const float *WinC1  = WinS0 + N/2;
+		const float *SrcLo0 = Src;
+		const float *SrcHi0 = Src + N;
+		const float *SrcLo1 = Src + N/2;
+		const float *SrcHi1 = Src + N/2;
+		      float *Dst    = Tmp;
+#if defined(__AVX__)
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a0, b0, c0, s0;
+			__m512 a1, b1, c1, s1;
+			__m512 l0, h0;
+			__m512 l1, h1;
+			__m512i Rev      = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i XorMask0 = _mm512_set1_epi64(0x8000000000000000ull);
+			__m512i XorMask1 = _mm512_set1_epi64(0x0000000080000000ull);
+			for(;i<N/4;i+=16) {
+				a0 = _mm512_loadu_ps(SrcLo0); SrcLo0 += 16;
+				SrcHi0 -= 16; b0 = _mm512_loadu_ps(SrcHi0);
+				SrcLo1 -= 16; a1 = _mm512_loadu_ps(SrcLo1);
+				b1 = _mm512_loadu_ps(SrcHi1); SrcHi1 += 16;
+				b0 = _mm512_permutexvar_ps(Rev, b0);
+				a1 = _mm512_permutexvar_ps(Rev, a1);
+				s0 = _mm512_loadu_ps(WinS0); WinS0 += 16;
+				WinC0 -= 16; c0 = _mm512_loadu_ps(WinC0);
+				WinS1 -= 16; s1 = _mm512_loadu_ps(WinS1);
+				c1 = _mm512_loadu_ps(WinC1); WinC1 += 16;
+				c0 = _mm512_permutexvar_ps(Rev, c0);
+				s1 = _mm512_permutexvar_ps(Rev, s1);
+				h0 = _mm512_mul_ps(s0, a0);
+				l0 = _mm512_mul_ps(c0, a0);
+				h1 = _mm512_mul_ps(s1, a1);
+				l1 = _mm512_mul_ps(c1, a1);
+				h0 = _mm512_fnmadd_ps(c0, b0, h0);
+				l0 = _mm512_fmadd_ps (s0, b0, l0);
+				h1 = _mm512_fnmadd_ps(c1, b1, h1);
+				l1 = _mm512_fmadd_ps (s1, b1, l1);
+				h0 = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(h0), XorMask0));
+				h1 = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(h1), XorMask1));
+				_mm512_storeu_ps(Dst,           _mm512_add_ps(l0, l1));
+				_mm512_storeu_ps(Dst + N/4,     _mm512_sub_ps(l0, l1));
+				_mm512_storeu_ps(Dst + N/2,     _mm512_add_ps(h0, h1));
+				_mm512_storeu_ps(Dst + N/2+N/4, _mm512_sub_ps(h0, h1)); Dst += 16;
+			}
+		}
+#endif
+		__m256 a0, b0, c0, s0;
+		__m256 a1, b1, c1, s1;
+		__m256 l0, h0;
+		__m256 l1, h1;
+		for(;i<N/4;i+=8) {
+			a0 = _mm256_load_ps(SrcLo0); SrcLo0 += 8;
+			SrcHi0 -= 8; b0 = _mm256_load_ps(SrcHi0);
+			SrcLo1 -= 8; a1 = _mm256_load_ps(SrcLo1);
+			b1 = _mm256_load_ps(SrcHi1); SrcHi1 += 8;
+			b0 = _mm256_shuffle_ps(b0, b0, 0x1B);
+			a1 = _mm256_shuffle_ps(a1, a1, 0x1B);
+			b0 = _mm256_permute2f128_ps(b0, b0, 0x01);
+			a1 = _mm256_permute2f128_ps(a1, a1, 0x01);
+			s0 = _mm256_load_ps(WinS0); WinS0 += 8;
+			WinC0 -= 8; c0 = _mm256_load_ps(WinC0);
+			WinS1 -= 8; s1 = _mm256_load_ps(WinS1);
+			c1 = _mm256_load_ps(WinC1); WinC1 += 8;
+			c0 = _mm256_shuffle_ps(c0, c0, 0x1B);
+			s1 = _mm256_shuffle_ps(s1, s1, 0x1B);
+			c0 = _mm256_permute2f128_ps(c0, c0, 0x01);
+			s1 = _mm256_permute2f128_ps(s1, s1, 0x01);
+#if defined(__FMA__)
+			h0 = _mm256_mul_ps(s0, a0);
+			l0 = _mm256_mul_ps(c0, a0);
+			h1 = _mm256_mul_ps(s1, a1);
+			l1 = _mm256_mul_ps(c1, a1);
+			h0 = _mm256_fnmadd_ps(c0, b0, h0);
+			l0 = _mm256_fmadd_ps (s0, b0, l0);
+			h1 = _mm256_fnmadd_ps(c1, b1, h1);
+			l1 = _mm256_fmadd_ps (s1, b1, l1);
+#else
+			h0 = _mm256_sub_ps(_mm256_mul_ps(s0, a0), _mm256_mul_ps(c0, b0));
+			l0 = _mm256_add_ps(_mm256_mul_ps(c0, a0), _mm256_mul_ps(s0, b0));
+			h1 = _mm256_sub_ps(_mm256_mul_ps(s1, a1), _mm256_mul_ps(c1, b1));
+			l1 = _mm256_add_ps(_mm256_mul_ps(c1, a1), _mm256_mul_ps(s1, b1));
+#endif
+			h0 = _mm256_xor_ps(h0, _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f));
+			h1 = _mm256_xor_ps(h1, _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f));
+			_mm256_store_ps(Dst,           _mm256_add_ps(l0, l1));
+			_mm256_store_ps(Dst + N/4,     _mm256_sub_ps(l0, l1));
+			_mm256_store_ps(Dst + N/2,     _mm256_add_ps(h0, h1));
+			_mm256_store_ps(Dst + N/2+N/4, _mm256_sub_ps(h0, h1)); Dst += 8;
+		}
+#elif defined(__SSE__)
+		__m128 a0, b0, c0, s0;
+		__m128 a1, b1, c1, s1;
+		__m128 l0, h0;
+		__m128 l1, h1;
+		for(i=0;i<N/4;i+=4) {
+			a0 = _mm_load_ps(SrcLo0); SrcLo0 += 4;
+			SrcHi0 -= 4; b0 = _mm_loadr_ps(SrcHi0);
+			SrcLo1 -= 4; a1 = _mm_loadr_ps(SrcLo1);
+			b1 = _mm_load_ps(SrcHi1); SrcHi1 += 4;
+			s0 = _mm_load_ps(WinS0); WinS0 += 4;
+			WinC0 -= 4; c0 = _mm_loadr_ps(WinC0);
+			WinS1 -= 4; s1 = _mm_loadr_ps(WinS1);
+			c1 = _mm_load_ps(WinC1); WinC1 += 4;
+#if defined(__FMA__)
+			h0 = _mm_mul_ps(s0, a0);
+			l0 = _mm_mul_ps(c0, a0);
+			h1 = _mm_mul_ps(s1, a1);
+			l1 = _mm_mul_ps(c1, a1);
+			h0 = _mm_fnmadd_ps(c0, b0, h0);
+			l0 = _mm_fmadd_ps (s0, b0, l0);
+			h1 = _mm_fnmadd_ps(c1, b1, h1);
+			l1 = _mm_fmadd_ps (s1, b1, l1);
+#else
+			h0 = _mm_sub_ps(_mm_mul_ps(s0, a0), _mm_mul_ps(c0, b0));
+			l0 = _mm_add_ps(_mm_mul_ps(c0, a0), _mm_mul_ps(s0, b0));
+			h1 = _mm_sub_ps(_mm_mul_ps(s1, a1), _mm_mul_ps(c1, b1));
+			l1 = _mm_add_ps(_mm_mul_ps(c1, a1), _mm_mul_ps(s1, b1));
+#endif
+			h0 = _mm_xor_ps(h0, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+			h1 = _mm_xor_ps(h1, _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f));
+			_mm_store_ps(Dst,           _mm_add_ps(l0, l1));
+			_mm_store_ps(Dst + N/4,     _mm_sub_ps(l0, l1));
+			_mm_store_ps(Dst + N/2,     _mm_add_ps(h0, h1));
+			_mm_store_ps(Dst + N/2+N/4, _mm_sub_ps(h0, h1)); Dst += 4;
+		}
+#else
+		float a0, b0, c0, s0, l0, h0;
+		float a1, b1, c1, s1, l1, h1;
+		for(i=0;i<N/4;i++) {
+			a0 = *SrcLo0++;
+			b0 = *--SrcHi0;
+			c0 = *--WinC0;
+			s0 = *WinS0++;
+			a1 = *--SrcLo1;
+			b1 = *SrcHi1++;
+			c1 = *WinC1++;
+			s1 = *--WinS1;
+			l0 = c0*a0 + s0*b0;
+			h0 = s0*a0 - c0*b0;
+			l1 = c1*a1 + s1*b1;
+			h1 = s1*a1 - c1*b1;
+			if(i&1) h0 = -h0;
+			else    h1 = -h1;
+			Dst[0]       = l0 + l1;
+			Dst[N/4]     = l0 - l1;
+			Dst[N/2]     = h0 + h1;
+			Dst[N/2+N/4] = h0 - h1; Dst++;
+		}
+#endif
+	}
+
+	//! Perform recursion
+	//!  z1 = cos2([v_j][j=0..n/4-1],n/4)
+	//!  z2 = cos4([v_j][j=n/4..n/2-1],n/4)
+	//!  z3 = cos2([v_j][j=n/2..3n/4-1],n/4)
+	//!  z4 = cos4([v_j][j=3n/4..n-1],n/4)
+	Fourier_DCT2(Tmp,           Buf,           N/4);
+	Fourier_DCT4(Tmp + N/4,     Buf + N/4,     N/4);
+	Fourier_DCT2(Tmp + N/2,     Buf + N/2,     N/4);
+	Fourier_DCT4(Tmp + N/2+N/4, Buf + N/2+N/4, N/4);
+}
+
+//! DCT-IV (N >= FOURIER_DCT4_FUSE_MIN_N)
+//! This performs the same operations as the generic path, but
+//! the rotation butterflies are merged with the first stage of
+//! both DCT-II halves, and the interleaving at the end of both
+//! DCT-II halves is merged with the final butterflies. This way,
+//! the outer levels only sweep the full buffers twice.
+static void DCT4_Fused(float *Buf, float *Tmp, int N) {
+	int i;
+	DCT4_Head(Buf, Buf, Tmp, N);
+
+	//! Interleave DCT-II outputs and combine
+	//!  w = U_n.((P_{n/2})^T.(z1^T, z2^T)^T, (P_{n/2})^T.(z3^T, z4^T)^T)
+	//!  y = (P_n)^T.w
+	//! After interleaving, the odd outputs pair z2 with z4
+	//! (reversed), and the even outputs pair z1 (offset by
+	//! one) with z3 (reversed).
+	{
+		const float *Src1 = Tmp + 1;
+		const float *Src2 = Tmp + N/4;
+		const float *Src3 = Tmp + N/2+N/4;
+		const float *Src4 = Tmp + N;
+		      float *Dst  = Buf;
+		*Dst++ = Tmp[0];
+#if defined(__AVX__)
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a, b, c, d;
+			__m512 t0, t1, t2, t3;
+			__m512i Rev   = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i ZipLo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+			__m512i ZipHi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+			__m512i Zip2Lo = _mm512_setr_epi64(0, 8, 1, 9, 2, 10, 3, 11);
+			__m512i Zip2Hi = _mm512_setr_epi64(4, 12, 5, 13, 6, 14, 7, 15);
+			for(;i<N/4-16;i+=16) {
+				a = _mm512_loadu_ps(Src2); Src2 += 16;
+				Src4 -= 16; b = _mm512_loadu_ps(Src4);
+				c = _mm512_loadu_ps(Src1); Src1 += 16;
+				Src3 -= 16; d = _mm512_loadu_ps(Src3);
+				b = _mm512_permutexvar_ps(Rev, b);
+				d = _mm512_permutexvar_ps(Rev, d);
+
+				t0 = _mm512_add_ps(a, b);
+				t1 = _mm512_sub_ps(a, b);
+				t2 = _mm512_add_ps(c, d);
+				t3 = _mm512_sub_ps(c, d);
+				a  = _mm512_permutex2var_ps(t0, ZipLo, t1);
+				b  = _mm512_permutex2var_ps(t0, ZipHi, t1);
+				c  = _mm512_permutex2var_ps(t2, ZipLo, t3);
+				d  = _mm512_permutex2var_ps(t2, ZipHi, t3);
+				t0 = _mm512_castpd_ps(_mm512_permutex2var_pd(_mm512_castps_pd(a), Zip2Lo, _mm512_castps_pd(c)));
+				t1 = _mm512_castpd_ps(_mm512_permutex2var_pd(_mm512_castps_pd(a), Zip2Hi, _mm512_castps_pd(c)));
+				t2 = _mm512_castpd_ps(_mm512_permutex2var_pd(_mm512_castps_pd(b), Zip2Lo, _mm512_castps_pd(d)));
+				t3 = _mm512_castpd_ps(_mm512_permutex2var_pd(_mm512_castps_pd(b), Zip2Hi, _mm512_castps_pd(d)));
+				_mm512_storeu_ps(Dst +  0, t0);
+				_mm512_storeu_ps(Dst + 16, t1);
+				_mm512_storeu_ps(Dst + 32, t2);
+				_mm512_storeu_ps(Dst + 48, t3); Dst += 64;
+			}
+		}
+#endif
+		__m256 a, b, c, d;
+		__m256 t0, t1, t2, t3;
+		for(;i<N/4-8;i+=8) {
+			a = _mm256_load_ps(Src2); Src2 += 8;
+			Src4 -= 8; b = _mm256_load_ps(Src4);
+			c = _mm256_loadu_ps(Src1); Src1 += 8;
+			Src3 -= 8; d = _mm256_load_ps(Src3);
+			b = _mm256_shuffle_ps(b, b, 0x1B);
+			d = _mm256_shuffle_ps(d, d, 0x1B);
+			b = _mm256_permute2f128_ps(b, b, 0x01);
+			d = _mm256_permute2f128_ps(d, d, 0x01);
+
+			t0 = _mm256_add_ps(a, b);
+			t1 = _mm256_sub_ps(a, b);
+			t2 = _mm256_add_ps(c, d);
+			t3 = _mm256_sub_ps(c, d);
+			a  = _mm256_unpacklo_ps(t0, t1);
+			b  = _mm256_unpackhi_ps(t0, t1);
+			c  = _mm256_unpacklo_ps(t2, t3);
+			d  = _mm256_unpackhi_ps(t2, t3);
+			t0 = _mm256_shuffle_ps(a, c, 0x44);
+			t1 = _mm256_shuffle_ps(a, c, 0xEE);
+			t2 = _mm256_shuffle_ps(b, d, 0x44);
+			t3 = _mm256_shuffle_ps(b, d, 0xEE);
+			_mm256_storeu_ps(Dst +  0, _mm256_permute2f128_ps(t0, t1, 0x20));
+			_mm256_storeu_ps(Dst +  8, _mm256_permute2f128_ps(t2, t3, 0x20));
+			_mm256_storeu_ps(Dst + 16, _mm256_permute2f128_ps(t0, t1, 0x31));
+			_mm256_storeu_ps(Dst + 24, _mm256_permute2f128_ps(t2, t3, 0x31)); Dst += 32;
+		}
+#elif defined(__SSE__)
+		__m128 a, b, c, d;
+		__m128 t0, t1, t2, t3;
+		for(i=0;i<N/4-4;i+=4) {
+			a = _mm_load_ps(Src2); Src2 += 4;
+			Src4 -= 4; b = _mm_loadr_ps(Src4);
+			c = _mm_loadu_ps(Src1); Src1 += 4;
+			Src3 -= 4; d = _mm_loadr_ps(Src3);
+
+			t0 = _mm_add_ps(a, b);
+			t1 = _mm_sub_ps(a, b);
+			t2 = _mm_add_ps(c, d);
+			t3 = _mm_sub_ps(c, d);
+			a  = _mm_unpacklo_ps(t0, t1);
+			b  = _mm_unpackhi_ps(t0, t1);
+			c  = _mm_unpacklo_ps(t2, t3);
+			d  = _mm_unpackhi_ps(t2, t3);
+			_mm_storeu_ps(Dst +  0, _mm_shuffle_ps(a, c, 0x44));
+			_mm_storeu_ps(Dst +  4, _mm_shuffle_ps(a, c, 0xEE));
+			_mm_storeu_ps(Dst +  8, _mm_shuffle_ps(b, d, 0x44));
+			_mm_storeu_ps(Dst + 12, _mm_shuffle_ps(b, d, 0xEE)); Dst += 16;
+		}
+#else
+		i = 0;
+#endif
+		float x, y;
+		for(;i<N/4-1;i++) {
+			x = *Src2++;
+			y = *--Src4;
+			*Dst++ = x + y;
+			*Dst++ = x - y;
+			x = *Src1++;
+			y = *--Src3;
+			*Dst++ = x + y;
+			*Dst++ = x - y;
+		}
+		x = *Src2++;
+		y = *--Src4;
+		*Dst++ = x + y;
+		*Dst++ = x - y;
+		*Dst++ = *--Src3;
+	}
+}
+
+/**************************************/
+
 void Fourier_DCT4(float *Buf, float *Tmp, int N) {
 	int i;
 
 	//! Stop condition
-	if(N == 8) {
-		DCT4_8(Buf);
+	//! NOTE: Sizes up to 64 use straight-line codelets, as the
+	//! recursion overhead dominates at these sizes.
+	switch(N) {
+		case  8: DCT4_8 (Buf); return;
+		case 16: DCT4_16(Buf); return;
+		case 32: DCT4_32(Buf); return;
+		case 64: DCT4_64(Buf); return;
+	}
+	if(N >= FOURIER_DCT4_FUSE_MIN_N) {
+		DCT4_Fused(Buf, Tmp, N);
 		return;
 	}
 
@@ -84,10 +410,39 @@ void Fourier_DCT4(float *Buf, float *Tmp, int N) {
 		      float *DstLo = Tmp;
 		      float *DstHi = Tmp + N/2;
 #if defined(__AVX__)
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a, b;
+			__m512 t0, t1;
+			__m512 c, s;
+			__m512i Rev     = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i XorMask = _mm512_set1_epi64(0x8000000000000000ull);
+			for(;i<N/2-15;i+=16) {
+				SrcHi -= 16;
+				b = _mm512_loadu_ps(SrcHi);
+				a = _mm512_loadu_ps(SrcLo);
+				SrcLo += 16;
+				b = _mm512_permutexvar_ps(Rev, b);
+				WinC -= 16;
+				c = _mm512_loadu_ps(WinC);
+				s = _mm512_loadu_ps(WinS);
+				WinS += 16;
+				c = _mm512_permutexvar_ps(Rev, c);
+				t1 = _mm512_mul_ps(s, a);
+				t0 = _mm512_mul_ps(c, a);
+				t1 = _mm512_fnmadd_ps(c, b, t1);
+				t0 = _mm512_fmadd_ps (s, b, t0);
+				t1 = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(t1), XorMask));
+				_mm512_storeu_ps(DstLo, t0); DstLo += 16;
+				_mm512_storeu_ps(DstHi, t1); DstHi += 16;
+			}
+		}
+#endif
 		__m256 a, b;
 		__m256 t0, t1;
 		__m256 c, s;
-		for(i=0;i<N/2;i+=8) {
+		for(;i<N/2;i+=8) {
 			SrcHi -= 8;
 			b = _mm256_load_ps(SrcHi);
 			a = _mm256_load_ps(SrcLo);
@@ -176,11 +531,32 @@ void Fourier_DCT4(float *Buf, float *Tmp, int N) {
 		const float *TmpHi = Tmp + N;
 		      float *Dst   = Buf;
 #if defined(__AVX__)
+		*Dst++ = *TmpLo++;
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a, b;
+			__m512 t0, t1;
+			__m512i Rev   = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i ZipLo = _mm512_setr_epi32(0, 16, 1, 17, 2, 18, 3, 19, 4, 20, 5, 21, 6, 22, 7, 23);
+			__m512i ZipHi = _mm512_setr_epi32(8, 24, 9, 25, 10, 26, 11, 27, 12, 28, 13, 29, 14, 30, 15, 31);
+			for(;i<N/2-8-15;i+=16) {
+				TmpHi -= 16; b = _mm512_loadu_ps(TmpHi);
+				a = _mm512_loadu_ps(TmpLo); TmpLo += 16;
+				b = _mm512_permutexvar_ps(Rev, b);
+
+				t0 = _mm512_add_ps(a, b);
+				t1 = _mm512_sub_ps(a, b);
+				a  = _mm512_permutex2var_ps(t0, ZipLo, t1);
+				b  = _mm512_permutex2var_ps(t0, ZipHi, t1);
+				_mm512_storeu_ps(Dst, a); Dst += 16;
+				_mm512_storeu_ps(Dst, b); Dst += 16;
+			}
+		}
+#endif
 		__m256 a, b;
 		__m256 t0, t1;
-
-		*Dst++ = *TmpLo++;
-		for(i=0;i<N/2-8;i+=8) {
+		for(;i<N/2-8;i+=8) {
 			TmpHi -= 8; b = _mm256_load_ps(TmpHi);
 			a = _mm256_loadu_ps(TmpLo); TmpLo += 8;
 			b = _mm256_shuffle_ps(b, b, 0x1B);
@@ -257,6 +633,10 @@ void Fourier_DCT4(float *Buf, float *Tmp, int N) {
 	}
 }
 
+void Fourier_DCT4_Head(const float *Src, float *Buf, float *Tmp, int N) {
+	DCT4_Head(Src, Buf, Tmp, N);
+}
+
 /**************************************/
 //! EOF
 /**************************************/
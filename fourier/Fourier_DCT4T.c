@@ -12,6 +12,9 @@
 /**************************************/
 #include "Fourier.h"
 /**************************************/
+#define FOURIER_CODELETS_DCT4T
+#include "Fourier_Codelets.h"
+/**************************************/
 
 //! DCT-IV (N=8)
 static void DCT4T_8(float *x) {
@@ -61,12 +64,153 @@ static void DCT4T_8(float *x) {
 
 /**************************************/
 
-void Fourier_DCT4T(float *Buf, float *Tmp, int N) {
+//! DCT-IV (transposed), following its first butterfly stage
+//! Tmp[] holds the output of the first stage; the result is
+//! stored to Buf[], which is also used as scratch.
+static inline __attribute__((always_inline)) void DCT4T_Tail(float *Buf, float *Tmp, int N, int Reversed) {
+	int i;
+
+	Fourier_DCT3(Tmp,       Buf,       N/2);
+	Fourier_DCT3(Tmp + N/2, Buf + N/2, N/2);
+
+	{
+		const float *WinS  = Fourier_SinTableN(N);
+		const float *WinC  = WinS + N;
+		const float *SrcLo = Tmp;
+		const float *SrcHi = Tmp + N/2;
+		      float *DstLo = Buf;
+		      float *DstHi = Buf + N;
+#if defined(__AVX__)
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a, b;
+			__m512 t0, t1;
+			__m512 c, s;
+			__m512i Rev     = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i XorMask = _mm512_set1_epi32(0x80000000);
+			for(;i<N/2-15;i+=16) {
+				a = _mm512_loadu_ps(SrcLo); SrcLo += 16;
+				b = _mm512_loadu_ps(SrcHi); SrcHi += 16;
+				WinC -= 16; c = _mm512_loadu_ps(WinC);
+				s = _mm512_loadu_ps(WinS); WinS += 16;
+				c = _mm512_permutexvar_ps(Rev, c);
+				t0 = _mm512_mul_ps(s, b);
+				t1 = _mm512_mul_ps(c, b);
+				t0 = _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(t0), XorMask));
+				t0 = _mm512_fmaddsub_ps(c, a, t0);
+				t1 = _mm512_fmaddsub_ps(s, a, t1);
+				if(Reversed) { __m512 t = t0; t0 = t1; t1 = t; }
+				t1 = _mm512_permutexvar_ps(Rev, t1);
+				_mm512_storeu_ps(DstLo, t0); DstLo += 16;
+				DstHi -= 16; _mm512_storeu_ps(DstHi, t1);
+			}
+		}
+#endif
+		__m256 a, b;
+		__m256 t0, t1;
+		__m256 c, s;
+		for(;i<N/2;i+=8) {
+			a = _mm256_load_ps(SrcLo); SrcLo += 8;
+			b = _mm256_load_ps(SrcHi); SrcHi += 8;
+			WinC -= 8; c = _mm256_load_ps(WinC);
+			s = _mm256_load_ps(WinS); WinS += 8;
+			c = _mm256_shuffle_ps(c, c, 0x1B);
+			c = _mm256_permute2f128_ps(c, c, 0x01);
+			t0 = _mm256_mul_ps(s, b);
+			t1 = _mm256_mul_ps(c, b);
+			t0 = _mm256_xor_ps(t0, _mm256_set1_ps(-0.0f));
+#if defined(__FMA__)
+			t0 = _mm256_fmaddsub_ps(c, a, t0);
+			t1 = _mm256_fmaddsub_ps(s, a, t1);
+#else
+			t0 = _mm256_addsub_ps(_mm256_mul_ps(c, a), t0);
+			t1 = _mm256_addsub_ps(_mm256_mul_ps(s, a), t1);
+#endif
+			if(Reversed) { __m256 t = t0; t0 = t1; t1 = t; }
+			t1 = _mm256_shuffle_ps(t1, t1, 0x1B);
+			t1 = _mm256_permute2f128_ps(t1, t1, 0x01);
+			_mm256_store_ps(DstLo, t0); DstLo += 8;
+			DstHi -= 8; _mm256_store_ps(DstHi, t1);
+		}
+#elif defined(__SSE__)
+		__m128 a, b;
+		__m128 t0, t1;
+		__m128 c, s;
+		for(i=0;i<N/2;i+=4) {
+			a = _mm_load_ps(SrcLo); SrcLo += 4;
+			b = _mm_load_ps(SrcHi); SrcHi += 4;
+			WinC -= 4; c = _mm_loadr_ps(WinC);
+			s = _mm_load_ps(WinS); WinS += 4;
+			t0 = _mm_mul_ps(s, b);
+			t1 = _mm_mul_ps(c, b);
+#if defined(__FMA__)
+			t0 = _mm_xor_ps(t0, _mm_set1_ps(-0.0f));
+			t0 = _mm_fmaddsub_ps(c, a, t0);
+			t1 = _mm_fmaddsub_ps(s, a, t1);
+#else
+			t0 = _mm_xor_ps(t0, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+			t1 = _mm_xor_ps(t1, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
+			t0 = _mm_add_ps(_mm_mul_ps(c, a), t0);
+			t1 = _mm_sub_ps(_mm_mul_ps(s, a), t1);
+#endif
+			if(Reversed) { __m128 t = t0; t0 = t1; t1 = t; }
+			_mm_store_ps(DstLo, t0); DstLo += 4;
+			DstHi -= 4; _mm_storer_ps(DstHi, t1);
+		}
+#else
+		float a, b;
+		float c, s;
+		float t0, t1;
+		for(i=0;i<N/2;i+=2) {
+			a = *SrcLo++;
+			b = *SrcHi++;
+			c = *--WinC;
+			s = *WinS++;
+			t0 = c*a + s*b;
+			t1 = s*a - c*b;
+			if(Reversed) { float t = t0; t0 = t1; t1 = t; }
+			*DstLo++ = t0;
+			*--DstHi = t1;
+
+			a = *SrcLo++;
+			b = *SrcHi++;
+			c = *--WinC;
+			s = *WinS++;
+			t0 = c*a - s*b;
+			t1 = s*a + c*b;
+			if(Reversed) { float t = t0; t0 = t1; t1 = t; }
+			*DstLo++ = t0;
+			*--DstHi = t1;
+		}
+#endif
+	}
+}
+
+/**************************************/
+
+//! DCT-IV (transposed), with output in normal or reversed order
+//! Reversing the output is free in the final rotation stage, as
+//! it already writes both ends of the output at once; the two
+//! outputs of each rotation simply swap ends.
+static inline __attribute__((always_inline)) void DCT4T(float *Buf, float *Tmp, int N, int Reversed) {
 	int i;
 
 	//! Stop condition
-	if(N == 8) {
-		DCT4T_8(Buf);
+	//! NOTE: Sizes up to 64 use straight-line codelets, as the
+	//! recursion overhead dominates at these sizes.
+	if(N <= 64) {
+		switch(N) {
+			case  8: DCT4T_8 (Buf); break;
+			case 16: DCT4T_16(Buf); break;
+			case 32: DCT4T_32(Buf); break;
+			case 64: DCT4T_64(Buf); break;
+		}
+		if(Reversed) for(i=0;i<N/2;i++) {
+			float t = Buf[i];
+			Buf[i] = Buf[N-1-i];
+			Buf[N-1-i] = t;
+		}
 		return;
 	}
 
@@ -77,9 +221,30 @@ void Fourier_DCT4T(float *Buf, float *Tmp, int N) {
 
 		*DstLo++ = *Src++ * 2.0f;
 #if defined(__AVX__)
+		i = 0;
+#if defined(__AVX512F__)
+		if(N >= FOURIER_AVX512_MIN_N) {
+			__m512 a, b;
+			__m512 t0, t1;
+			__m512i Rev  = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+			__m512i Even = _mm512_setr_epi32(0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30);
+			__m512i Odd  = _mm512_setr_epi32(1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31);
+			for(;i<N/2-8-15;i+=16) {
+				t0 = _mm512_loadu_ps(Src); Src += 16;
+				t1 = _mm512_loadu_ps(Src); Src += 16;
+				a  = _mm512_permutex2var_ps(t0, Even, t1);
+				b  = _mm512_permutex2var_ps(t0, Odd,  t1);
+				t0 = _mm512_add_ps(a, b);
+				t1 = _mm512_sub_ps(a, b);
+				t1 = _mm512_permutexvar_ps(Rev, t1);
+				_mm512_storeu_ps(DstLo, t0); DstLo += 16;
+				DstHi -= 16; _mm512_storeu_ps(DstHi, t1);
+			}
+		}
+#endif
 		__m256 a, b;
 		__m256 t0, t1;
-		for(i=0;i<N/2-8;i+=8) {
+		for(;i<N/2-8;i+=8) {
 			a  = _mm256_loadu_ps(Src); Src += 8;
 			b  = _mm256_loadu_ps(Src); Src += 8;
 			t0 = _mm256_permute2f128_ps(a, b, 0x20);
@@ -143,86 +308,25 @@ void Fourier_DCT4T(float *Buf, float *Tmp, int N) {
 #endif
 	}
 
-	Fourier_DCT3(Tmp,       Buf,       N/2);
-	Fourier_DCT3(Tmp + N/2, Buf + N/2, N/2);
+	DCT4T_Tail(Buf, Tmp, N, Reversed);
+}
 
-	{
-		const float *WinS  = Fourier_SinTableN(N);
-		const float *WinC  = WinS + N;
-		const float *SrcLo = Tmp;
-		const float *SrcHi = Tmp + N/2;
-		      float *DstLo = Buf;
-		      float *DstHi = Buf + N;
-#if defined(__AVX__)
-		__m256 a, b;
-		__m256 t0, t1;
-		__m256 c, s;
-		for(i=0;i<N/2;i+=8) {
-			a = _mm256_load_ps(SrcLo); SrcLo += 8;
-			b = _mm256_load_ps(SrcHi); SrcHi += 8;
-			WinC -= 8; c = _mm256_load_ps(WinC);
-			s = _mm256_load_ps(WinS); WinS += 8;
-			c = _mm256_shuffle_ps(c, c, 0x1B);
-			c = _mm256_permute2f128_ps(c, c, 0x01);
-			t0 = _mm256_mul_ps(s, b);
-			t1 = _mm256_mul_ps(c, b);
-			t0 = _mm256_xor_ps(t0, _mm256_set1_ps(-0.0f));
-#if defined(__FMA__)
-			t0 = _mm256_fmaddsub_ps(c, a, t0);
-			t1 = _mm256_fmaddsub_ps(s, a, t1);
-#else
-			t0 = _mm256_addsub_ps(_mm256_mul_ps(c, a), t0);
-			t1 = _mm256_addsub_ps(_mm256_mul_ps(s, a), t1);
-#endif
-			t1 = _mm256_shuffle_ps(t1, t1, 0x1B);
-			t1 = _mm256_permute2f128_ps(t1, t1, 0x01);
-			_mm256_store_ps(DstLo, t0); DstLo += 8;
-			DstHi -= 8; _mm256_store_ps(DstHi, t1);
-		}
-#elif defined(__SSE__)
-		__m128 a, b;
-		__m128 t0, t1;
-		__m128 c, s;
-		for(i=0;i<N/2;i+=4) {
-			a = _mm_load_ps(SrcLo); SrcLo += 4;
-			b = _mm_load_ps(SrcHi); SrcHi += 4;
-			WinC -= 4; c = _mm_loadr_ps(WinC);
-			s = _mm_load_ps(WinS); WinS += 4;
-			t0 = _mm_mul_ps(s, b);
-			t1 = _mm_mul_ps(c, b);
-#if defined(__FMA__)
-			t0 = _mm_xor_ps(t0, _mm_set1_ps(-0.0f));
-			t0 = _mm_fmaddsub_ps(c, a, t0);
-			t1 = _mm_fmaddsub_ps(s, a, t1);
-#else
-			t0 = _mm_xor_ps(t0, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
-			t1 = _mm_xor_ps(t1, _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f));
-			t0 = _mm_add_ps(_mm_mul_ps(c, a), t0);
-			t1 = _mm_sub_ps(_mm_mul_ps(s, a), t1);
-#endif
-			_mm_store_ps(DstLo, t0); DstLo += 4;
-			DstHi -= 4; _mm_storer_ps(DstHi, t1);
-		}
-#else
-		float a, b;
-		float c, s;
-		for(i=0;i<N/2;i+=2) {
-			a = *SrcLo++;
-			b = *SrcHi++;
-			c = *--WinC;
-			s = *WinS++;
-			*DstLo++ =  c*a + s*b;
-			*--DstHi =  s*a - c*b;
+/**************************************/
 
-			a = *SrcLo++;
-			b = *SrcHi++;
-			c = *--WinC;
-			s = *WinS++;
-			*DstLo++ =  c*a - s*b;
-			*--DstHi =  s*a + c*b;
-		}
-#endif
-	}
+void Fourier_DCT4T(float *Buf, float *Tmp, int N) {
+	DCT4T(Buf, Tmp, N, 0);
+}
+
+void Fourier_DCT4TR(float *Buf, float *Tmp, int N) {
+	DCT4T(Buf, Tmp, N, 1);
+}
+
+void Fourier_DCT4T_Tail(float *Buf, float *Tmp, int N) {
+	DCT4T_Tail(Buf, Tmp, N, 0);
+}
+
+void Fourier_DCT4TR_Tail(float *Buf, float *Tmp, int N) {
+	DCT4T_Tail(Buf, Tmp, N, 1);
 }
 
 /**************************************/
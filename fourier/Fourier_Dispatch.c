@@ -0,0 +1,137 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#include "Fourier.h"
+/**************************************/
+
+//! Declare the kernels of an ISA level and create its table
+//! NOTE: FOURIER_HAVE_<Isa> is defined for each level that was
+//! built (see KERNEL_ISAS in the Makefile).
+#define DECLARE_KERNELS(Isa) \
+	void Fourier_DCT2_##Isa  (float *Buf, float *Tmp, int N); \
+	void Fourier_DCT3_##Isa  (float *Buf, float *Tmp, int N); \
+	void Fourier_DCT4_##Isa  (float *Buf, float *Tmp, int N); \
+	void Fourier_DCT4T_##Isa (float *Buf, float *Tmp, int N); \
+	void Fourier_DCT4TR_##Isa(float *Buf, float *Tmp, int N); \
+	void Fourier_MDCT_##Isa(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow); \
+	void Fourier_MDCT_MDST_##Isa(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow); \
+	void Fourier_IMDCT_##Isa(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow); \
+	void Fourier_DCT4_Batch_##Isa(float *Buf, float *Tmp, int N, int nBatch, int Stride); \
+	void Fourier_MDCT_Batch_##Isa(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride); \
+	void Fourier_MDCT_MDST_Batch_##Isa(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride); \
+	void Fourier_IMDCT_Batch_##Isa(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride); \
+	static const struct Fourier_Kernels_t Fourier_Kernels_##Isa = { \
+		.Name      = #Isa, \
+		.DCT2      = Fourier_DCT2_##Isa, \
+		.DCT3      = Fourier_DCT3_##Isa, \
+		.DCT4      = Fourier_DCT4_##Isa, \
+		.DCT4T     = Fourier_DCT4T_##Isa, \
+		.DCT4TR    = Fourier_DCT4TR_##Isa, \
+		.MDCT      = Fourier_MDCT_##Isa, \
+		.MDCT_MDST = Fourier_MDCT_MDST_##Isa, \
+		.IMDCT     = Fourier_IMDCT_##Isa, \
+		.DCT4_Batch      = Fourier_DCT4_Batch_##Isa, \
+		.MDCT_Batch      = Fourier_MDCT_Batch_##Isa, \
+		.MDCT_MDST_Batch = Fourier_MDCT_MDST_Batch_##Isa, \
+		.IMDCT_Batch     = Fourier_IMDCT_Batch_##Isa, \
+	}
+#if defined(FOURIER_HAVE_Scalar)
+DECLARE_KERNELS(Scalar);
+#endif
+#if defined(FOURIER_HAVE_SSE2)
+DECLARE_KERNELS(SSE2);
+#endif
+#if defined(FOURIER_HAVE_AVX2)
+DECLARE_KERNELS(AVX2);
+#endif
+#if defined(FOURIER_HAVE_AVX512)
+DECLARE_KERNELS(AVX512);
+#endif
+#undef DECLARE_KERNELS
+
+/**************************************/
+
+//! Get the best supported ISA level
+//! NOTE: Multiple threads may race to fill the cache, but
+//! they will all store the same value, so this is harmless.
+int Fourier_GetISALevel(void) {
+	static int Level = -1;
+	if(Level >= 0) return Level;
+
+	//! Pick the highest level that the CPU supports,
+	//! falling back to the lowest level that was built
+	int l = -1;
+#if defined(__i386__) || defined(__x86_64__)
+	__builtin_cpu_init();
+# if defined(FOURIER_HAVE_AVX512)
+	if(l < 0 && __builtin_cpu_supports("avx512f")) l = FOURIER_ISA_LEVEL_AVX512;
+# endif
+# if defined(FOURIER_HAVE_AVX2)
+	if(l < 0 && __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma")) l = FOURIER_ISA_LEVEL_AVX2;
+# endif
+# if defined(FOURIER_HAVE_SSE2)
+	if(l < 0 && __builtin_cpu_supports("sse2")) l = FOURIER_ISA_LEVEL_SSE2;
+# endif
+#endif
+#if defined(FOURIER_HAVE_Scalar)
+	if(l < 0) l = FOURIER_ISA_LEVEL_Scalar;
+#elif defined(FOURIER_HAVE_SSE2)
+	if(l < 0) l = FOURIER_ISA_LEVEL_SSE2;
+#endif
+	return Level = l;
+}
+
+//! Get the kernels for the best supported ISA level
+const struct Fourier_Kernels_t *Fourier_GetKernels(void) {
+	static const struct Fourier_Kernels_t *const Kernels[FOURIER_ISA_LEVEL_COUNT] = {
+#if defined(FOURIER_HAVE_Scalar)
+		[FOURIER_ISA_LEVEL_Scalar] = &Fourier_Kernels_Scalar,
+#endif
+#if defined(FOURIER_HAVE_SSE2)
+		[FOURIER_ISA_LEVEL_SSE2]   = &Fourier_Kernels_SSE2,
+#endif
+#if defined(FOURIER_HAVE_AVX2)
+		[FOURIER_ISA_LEVEL_AVX2]   = &Fourier_Kernels_AVX2,
+#endif
+#if defined(FOURIER_HAVE_AVX512)
+		[FOURIER_ISA_LEVEL_AVX512] = &Fourier_Kernels_AVX512,
+#endif
+	};
+	return Kernels[Fourier_GetISALevel()];
+}
+
+/**************************************/
+
+//! Generic entry points
+void Fourier_DCT2  (float *Buf, float *Tmp, int N) { Fourier_GetKernels()->DCT2  (Buf, Tmp, N); }
+void Fourier_DCT3  (float *Buf, float *Tmp, int N) { Fourier_GetKernels()->DCT3  (Buf, Tmp, N); }
+void Fourier_DCT4  (float *Buf, float *Tmp, int N) { Fourier_GetKernels()->DCT4  (Buf, Tmp, N); }
+void Fourier_DCT4T (float *Buf, float *Tmp, int N) { Fourier_GetKernels()->DCT4T (Buf, Tmp, N); }
+void Fourier_DCT4TR(float *Buf, float *Tmp, int N) { Fourier_GetKernels()->DCT4TR(Buf, Tmp, N); }
+void Fourier_MDCT(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	Fourier_GetKernels()->MDCT(MDCT, New, Lap, BufTmp, N, Overlap, ModulationWindow);
+}
+void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	Fourier_GetKernels()->MDCT_MDST(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow);
+}
+void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	Fourier_GetKernels()->IMDCT(BufOut, BufIn, BufLap, BufTmp, N, Overlap, ModulationWindow);
+}
+void Fourier_DCT4_Batch(float *Buf, float *Tmp, int N, int nBatch, int Stride) {
+	Fourier_GetKernels()->DCT4_Batch(Buf, Tmp, N, nBatch, Stride);
+}
+void Fourier_MDCT_Batch(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+	Fourier_GetKernels()->MDCT_Batch(MDCT, New, Lap, BufTmp, N, Overlap, ModulationWindow, nBatch, Stride, LapStride);
+}
+void Fourier_MDCT_MDST_Batch(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+	Fourier_GetKernels()->MDCT_MDST_Batch(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow, nBatch, Stride, LapStride);
+}
+void Fourier_IMDCT_Batch(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+	Fourier_GetKernels()->IMDCT_Batch(BufOut, BufIn, BufLap, BufTmp, N, Overlap, ModulationWindow, nBatch, Stride, LapStride);
+}
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -0,0 +1,298 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#include <stdint.h>
+/**************************************/
+#include "Fourier.h"
+/**************************************/
+
+//! Fixed-point DCT-IV/IMDCT
+//! These follow the generic (scalar, non-fused) paths of the
+//! float transforms step for step, with every multiplication
+//! done as .31 fixed-point. Sizes up to 64 recurse down to the
+//! N=8 kernels, rather than using the codelets.
+
+/**************************************/
+
+//! x*a (.31 fixed-point a; rounded)
+static inline __attribute__((always_inline)) int32_t MulFixed(int32_t x, int32_t a) {
+	return (int32_t)(((int64_t)x*a + (1 << 30)) >> 31);
+}
+
+//! x*a + y*b (.31 fixed-point a,b; rounded once)
+static inline __attribute__((always_inline)) int32_t MulAddFixed(int32_t x, int32_t a, int32_t y, int32_t b) {
+	return (int32_t)(((int64_t)x*a + (int64_t)y*b + (1 << 30)) >> 31);
+}
+
+//! x / 2^Shift (rounded)
+static inline __attribute__((always_inline)) int32_t ShiftFixed(int32_t x, int Shift) {
+	return (x + ((1 << Shift) >> 1)) >> Shift;
+}
+
+//! (x*2^Shift*a + y*b) / 2^Shift (.31 fixed-point a,b; rounded once)
+static inline __attribute__((always_inline)) int32_t MulAddShiftFixed(int32_t x, int32_t a, int32_t y, int32_t b, int Shift) {
+	return (int32_t)((((int64_t)x*a << Shift) + (int64_t)y*b + (1ll << (30+Shift))) >> (31+Shift));
+}
+
+/**************************************/
+
+static void DCT2_Fixed(int32_t *Buf, int32_t *Tmp, int N);
+
+//! DCT-IV (N=8)
+//! NOTE: See DCT4_8() in Fourier_DCT4.c
+static void DCT4_8_Fixed(int32_t *x) {
+	const int32_t sqrt1_2 = 0x5A82799A;
+	const int32_t c1_3 = 0x7641AF3D, s1_3 = 0x30FBC54D;
+	const int32_t c1_5 = 0x7F62368F, s1_5 = 0x0C8BD35E;
+	const int32_t c3_5 = 0x7A7D055B, s3_5 = 0x25280C5E;
+	const int32_t c5_5 = 0x70E2CBC6, s5_5 = 0x3C56BA70;
+	const int32_t c7_5 = 0x62F201AC, s7_5 = 0x5133CC94;
+
+	//! First stage (rotation butterflies; DCT4_8)
+	int32_t ax = MulAddFixed(x[0],  c1_5, x[7],  s1_5);
+	int32_t ay = MulAddFixed(x[0],  s1_5, x[7], -c1_5);
+	int32_t bx = MulAddFixed(x[1],  c3_5, x[6],  s3_5);
+	int32_t by = MulAddFixed(x[1], -s3_5, x[6],  c3_5);
+	int32_t cx = MulAddFixed(x[2],  c5_5, x[5],  s5_5);
+	int32_t cy = MulAddFixed(x[2],  s5_5, x[5], -c5_5);
+	int32_t dx = MulAddFixed(x[3],  c7_5, x[4],  s7_5);
+	int32_t dy = MulAddFixed(x[3], -s7_5, x[4],  c7_5);
+
+	//! Second stage (butterflies; DCT2_4)
+	int32_t saxdx = ax + dx;
+	int32_t daxdx = ax - dx;
+	int32_t sbxcx = bx + cx;
+	int32_t dbxcx = bx - cx;
+	int32_t sdyay = dy + ay;
+	int32_t ddyay = dy - ay;
+	int32_t scyby = cy + by;
+	int32_t dcyby = cy - by;
+
+	//! Third stage (rotation butterflies; DCT2_2, DCT4_2)
+	int32_t sx = saxdx + sbxcx;
+	int32_t sy = saxdx - sbxcx;
+	int32_t tx = MulAddFixed(daxdx, c1_3, dbxcx,  s1_3);
+	int32_t ty = MulAddFixed(daxdx, s1_3, dbxcx, -c1_3);
+	int32_t ux = sdyay + scyby;
+	int32_t uy = sdyay - scyby;
+	int32_t vx = MulAddFixed(ddyay, c1_3, dcyby,  s1_3);
+	int32_t vy = MulAddFixed(ddyay, s1_3, dcyby, -c1_3);
+
+	//! Permute and final DCT4 stage
+	x[0] = sx;
+	x[1] = tx - vy;
+	x[2] = tx + vy;
+	x[3] = MulFixed(sy + uy, sqrt1_2);
+	x[4] = MulFixed(sy - uy, sqrt1_2);
+	x[5] = ty - vx;
+	x[6] = ty + vx;
+	x[7] = ux;
+}
+
+//! DCT-II (N=8)
+//! NOTE: See DCT2_8() in Fourier_DCT2.c
+static void DCT2_8_Fixed(int32_t *x) {
+	const int32_t sqrt1_2 = 0x5A82799A;
+	const int32_t c1_4 = 0x7D8A5F40, s1_4 = 0x18F8B83C;
+	const int32_t c3_4 = 0x6A6D98A4, s3_4 = 0x471CECE7;
+	const int32_t c6_4 = 0x30FBC54D, s6_4 = 0x7641AF3D;
+
+	//! First stage butterflies (DCT2_8)
+	int32_t s07 = x[0]+x[7];
+	int32_t d07 = x[0]-x[7];
+	int32_t s16 = x[1]+x[6];
+	int32_t d16 = x[1]-x[6];
+	int32_t s25 = x[2]+x[5];
+	int32_t d25 = x[2]-x[5];
+	int32_t s34 = x[3]+x[4];
+	int32_t d34 = x[3]-x[4];
+
+	//! Second stage (DCT2_4, DCT4_4)
+	int32_t ss07s34 = s07+s34;
+	int32_t ds07s34 = s07-s34;
+	int32_t ss16s25 = s16+s25;
+	int32_t ds16s25 = s16-s25;
+	int32_t d34d07x = MulAddFixed(d34,  c3_4, d07, s3_4);
+	int32_t d34d07y = MulAddFixed(d34, -s3_4, d07, c3_4);
+	int32_t d25d16x = MulAddFixed(d25,  c1_4, d16, s1_4);
+	int32_t d25d16y = MulAddFixed(d25, -s1_4, d16, c1_4);
+
+	//! Third stage (rotation butterflies; DCT2_2, DCT4_2, DCT2_2, DCT2_2)
+	int32_t a0 = ss07s34 + ss16s25;
+	int32_t b0 = ss07s34 - ss16s25;
+	int32_t c0 = MulAddFixed(ds16s25,  c6_4, ds07s34, s6_4);
+	int32_t d0 = MulAddFixed(ds16s25, -s6_4, ds07s34, c6_4);
+	int32_t a1 = d34d07y + d25d16x;
+	int32_t c1 = d34d07y - d25d16x;
+	int32_t d1 = d34d07x + d25d16y;
+	int32_t b1 = d34d07x - d25d16y;
+
+	//! Permute and final DCT4 stage
+	x[0] = a0;
+	x[4] = MulFixed(b0, sqrt1_2);
+	x[2] = c0;
+	x[6] = d0;
+	x[1] = MulFixed(a1 + d1, sqrt1_2);
+	x[5] = b1;
+	x[3] = c1;
+	x[7] = MulFixed(a1 - d1, sqrt1_2);
+}
+
+/**************************************/
+
+//! DCT-II
+//! NOTE: See Fourier_DCT2()
+static void DCT2_Fixed(int32_t *Buf, int32_t *Tmp, int N) {
+	int i;
+
+	//! Stop condition
+	if(N == 8) {
+		DCT2_8_Fixed(Buf);
+		return;
+	}
+
+	//! Perform butterflies
+	//!  u = H_n.x
+	{
+		const int32_t *SrcLo = Buf;
+		const int32_t *SrcHi = Buf + N;
+		      int32_t *DstLo = Tmp;
+		      int32_t *DstHi = Tmp + N/2;
+		for(i=0;i<N/2;i++) {
+			int32_t a = *SrcLo++;
+			int32_t b = *--SrcHi;
+			*DstLo++ = a + b;
+			*DstHi++ = a - b;
+		}
+	}
+
+	//! Perform recursion
+	//!  z1 = cos2([u_j][j=0..n/2-1],n/2)
+	//!  z2 = cos4([u_j][j=n/2..n-1],n/2)
+	DCT2_Fixed        (Tmp,       Buf,       N/2);
+	Fourier_DCT4_Fixed(Tmp + N/2, Buf + N/2, N/2);
+
+	//! Combine
+	//!  y = (P_n)^T.(z1^T, z2^T)^T
+	{
+		const int32_t *SrcLo = Tmp;
+		const int32_t *SrcHi = Tmp + N/2;
+		      int32_t *Dst   = Buf;
+		for(i=0;i<N/2;i++) {
+			*Dst++ = *SrcLo++;
+			*Dst++ = *SrcHi++;
+		}
+	}
+}
+
+//! DCT-IV
+//! NOTE: See Fourier_DCT4()
+void Fourier_DCT4_Fixed(int32_t *Buf, int32_t *Tmp, int N) {
+	int i;
+
+	//! Stop condition
+	if(N == 8) {
+		DCT4_8_Fixed(Buf);
+		return;
+	}
+
+	//! Perform rotation butterflies
+	//!  u = R_n.x
+	{
+		const Fourier_SinTableFixed_t *WinS  = Fourier_SinTableFixedN(N);
+		const Fourier_SinTableFixed_t *WinC  = WinS + N;
+		const int32_t *SrcLo = Buf;
+		const int32_t *SrcHi = Buf + N;
+		      int32_t *DstLo = Tmp;
+		      int32_t *DstHi = Tmp + N/2;
+		int32_t a, b;
+		int32_t c, s;
+		for(i=0;i<N/2;i+=2) {
+			a = *SrcLo++;
+			b = *--SrcHi;
+			c = Fourier_SinTableFixedExpand(*--WinC);
+			s = Fourier_SinTableFixedExpand(*WinS++);
+			*DstLo++ = MulAddFixed(a, c, b,  s);
+			*DstHi++ = MulAddFixed(a, s, b, -c);
+
+			a = *SrcLo++;
+			b = *--SrcHi;
+			c = Fourier_SinTableFixedExpand(*--WinC);
+			s = Fourier_SinTableFixedExpand(*WinS++);
+			*DstLo++ = MulAddFixed(a,  c, b, s);
+			*DstHi++ = MulAddFixed(a, -s, b, c);
+		}
+	}
+
+	//! Perform recursion
+	//!  z1 = cos2([u_j][j=0..n/2-1],n/2)
+	//!  z2 = cos2([u_j][j=n/2..n-1],n/2)
+	DCT2_Fixed(Tmp,       Buf,       N/2);
+	DCT2_Fixed(Tmp + N/2, Buf + N/2, N/2);
+
+	//! Combine
+	//!  w = U_n.(z1^T, z2^T)^T
+	//!  y = (P_n)^T.w
+	{
+		const int32_t *TmpLo = Tmp;
+		const int32_t *TmpHi = Tmp + N;
+		      int32_t *Dst   = Buf;
+		int32_t a, b;
+
+		*Dst++ = *TmpLo++;
+		for(i=0;i<N/2-1;i++) {
+			a = *TmpLo++;
+			b = *--TmpHi;
+			*Dst++ = a + b;
+			*Dst++ = a - b;
+		}
+		*Dst++ = *--TmpHi;
+	}
+}
+
+/**************************************/
+
+//! IMDCT
+//! NOTE: See Fourier_IMDCT() and IMDCT_Unlap() in Fourier_IMDCT.c
+void Fourier_IMDCT_Fixed(int32_t *BufOut, const int32_t *BufIn, int32_t *BufLap, int32_t *BufTmp, int N, int Overlap, const Fourier_SinTableFixed_t *ModulationWindow, int InShift) {
+	int i;
+
+	//! Undo transform
+	if(BufIn != BufTmp) for(i=0;i<N;i++) BufTmp[i] = BufIn[i];
+	Fourier_DCT4_Fixed(BufTmp, BufOut, N);
+
+	//! Undo lapping
+	//! NOTE: The new data still has InShift extra bits, which are
+	//! rounded off here, once for each output.
+	{
+		const Fourier_SinTableFixed_t *WinS = ModulationWindow ? (ModulationWindow + Overlap-16) : Fourier_SinTableFixedN(Overlap);
+		const Fourier_SinTableFixed_t *WinC = WinS + Overlap;
+		      int32_t *Lap   = BufLap + N/2;
+		const int32_t *New   = BufTmp + N/2;
+		const int32_t *Tmp   = BufTmp + N/2;
+		      int32_t *OutLo = BufOut;
+		      int32_t *OutHi = BufOut + N;
+		for(i=0;i<(N-Overlap)/2;i++) {
+			int32_t a = *--Lap;
+			*Lap = ShiftFixed(*--New, InShift);
+			int32_t b = *Tmp++;
+			*OutLo++ = a;
+			*--OutHi = ShiftFixed(b, InShift);
+		}
+		for(;i<N/2;i++) {
+			int32_t a = *--Lap;
+			*Lap = ShiftFixed(*--New, InShift);
+			int32_t b = *Tmp++;
+			int32_t c = Fourier_SinTableFixedExpand(*--WinC);
+			int32_t s = Fourier_SinTableFixedExpand(*WinS++);
+			*OutLo++ = MulAddShiftFixed(a, c, b, -s, InShift);
+			*--OutHi = MulAddShiftFixed(a, s, b,  c, InShift);
+		}
+	}
+}
+
+/**************************************/
+//! EOF
+/**************************************/
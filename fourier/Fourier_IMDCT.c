@@ -13,6 +13,212 @@
 #include "Fourier.h"
 /**************************************/
 
+//! Final DCT-IV stage for IMDCT_Fused()
+//! This is the interleaving stage of DCT4_Fused() (see
+//! Fourier_DCT4.c), re-arranged so that each block of
+//! outputs starts on a vector boundary:
+//!  y[4s+0] = T[s]     - T[3N/4-s]   (except y[0]   = T[0])
+//!  y[4s+1] = T[N/4+s] + T[N-1-s]
+//!  y[4s+2] = T[N/4+s] - T[N-1-s]
+//!  y[4s+3] = T[1+s]   + T[3N/4-1-s] (except y[N-1] = T[N/2])
+//! Each call produces the outputs for slots s0..s0+7 (AVX),
+//! s0..s0+3 (SSE), or the single output y[k] (scalar).
+#if defined(__AVX__)
+static inline __attribute__((always_inline)) void IMDCT_Stage(__m256 *y, const float *T, int N, int s0) {
+	__m256 a, b, c0, d0, c1, d1;
+	__m256 e0, e1, e2, e3;
+	__m256 t0, t1, t2, t3;
+	a  = _mm256_load_ps (T + N/4      + s0);
+	b  = _mm256_load_ps (T + N-8      - s0);
+	c0 = _mm256_load_ps (T            + s0);
+	d0 = _mm256_loadu_ps(T + N/2+N/4-7 - s0);
+	c1 = _mm256_loadu_ps(T + 1        + s0);
+	d1 = _mm256_load_ps (T + N/2+N/4-8 - s0);
+	b  = _mm256_shuffle_ps(b,  b,  0x1B);
+	d0 = _mm256_shuffle_ps(d0, d0, 0x1B);
+	d1 = _mm256_shuffle_ps(d1, d1, 0x1B);
+	b  = _mm256_permute2f128_ps(b,  b,  0x01);
+	d0 = _mm256_permute2f128_ps(d0, d0, 0x01);
+	d1 = _mm256_permute2f128_ps(d1, d1, 0x01);
+
+	e0 = _mm256_sub_ps(c0, d0);
+	e1 = _mm256_add_ps(a,  b);
+	e2 = _mm256_sub_ps(a,  b);
+	e3 = _mm256_add_ps(c1, d1);
+	if(s0 == 0)     e0 = _mm256_blend_ps(e0, _mm256_broadcast_ss(T),       0x01);
+	if(s0 == N/4-8) e3 = _mm256_blend_ps(e3, _mm256_broadcast_ss(T + N/2), 0x80);
+	a  = _mm256_unpacklo_ps(e0, e1);
+	b  = _mm256_unpackhi_ps(e0, e1);
+	c0 = _mm256_unpacklo_ps(e2, e3);
+	d0 = _mm256_unpackhi_ps(e2, e3);
+	t0 = _mm256_shuffle_ps(a, c0, 0x44);
+	t1 = _mm256_shuffle_ps(a, c0, 0xEE);
+	t2 = _mm256_shuffle_ps(b, d0, 0x44);
+	t3 = _mm256_shuffle_ps(b, d0, 0xEE);
+	y[0] = _mm256_permute2f128_ps(t0, t1, 0x20);
+	y[1] = _mm256_permute2f128_ps(t2, t3, 0x20);
+	y[2] = _mm256_permute2f128_ps(t0, t1, 0x31);
+	y[3] = _mm256_permute2f128_ps(t2, t3, 0x31);
+}
+#elif defined(__SSE__)
+static inline __attribute__((always_inline)) void IMDCT_Stage(__m128 *y, const float *T, int N, int s0) {
+	__m128 a, b, c0, d0, c1, d1;
+	__m128 e0, e1, e2, e3;
+	a  = _mm_load_ps (T + N/4       + s0);
+	b  = _mm_loadr_ps(T + N-4       - s0);
+	c0 = _mm_load_ps (T             + s0);
+	d0 = _mm_loadu_ps(T + N/2+N/4-3 - s0);
+	c1 = _mm_loadu_ps(T + 1         + s0);
+	d1 = _mm_loadr_ps(T + N/2+N/4-4 - s0);
+	d0 = _mm_shuffle_ps(d0, d0, 0x1B);
+
+	e0 = _mm_sub_ps(c0, d0);
+	e1 = _mm_add_ps(a,  b);
+	e2 = _mm_sub_ps(a,  b);
+	e3 = _mm_add_ps(c1, d1);
+	if(s0 == 0) e0 = _mm_move_ss(e0, _mm_load_ss(T));
+	if(s0 == N/4-4) {
+		//! {e3[0], e3[1], e3[2], T[N/2]}
+		a  = _mm_shuffle_ps(e3, _mm_load_ss(T + N/2), 0x0A);
+		e3 = _mm_shuffle_ps(e3, a, 0x84);
+	}
+	a  = _mm_unpacklo_ps(e0, e1);
+	b  = _mm_unpackhi_ps(e0, e1);
+	c0 = _mm_unpacklo_ps(e2, e3);
+	d0 = _mm_unpackhi_ps(e2, e3);
+	y[0] = _mm_shuffle_ps(a, c0, 0x44);
+	y[1] = _mm_shuffle_ps(a, c0, 0xEE);
+	y[2] = _mm_shuffle_ps(b, d0, 0x44);
+	y[3] = _mm_shuffle_ps(b, d0, 0xEE);
+}
+#else
+static inline __attribute__((always_inline)) float IMDCT_Stage(const float *T, int N, int k) {
+	int s = k / 4;
+	switch(k % 4) {
+		case 0: return (k == 0)   ? T[0]   : (T[s]     - T[N/2+N/4-s]);
+		case 1: return                        T[N/4+s] + T[N-1-s];
+		case 2: return                        T[N/4+s] - T[N-1-s];
+		default:
+		case 3: return (k == N-1) ? T[N/2] : (T[1+s]   + T[N/2+N/4-1-s]);
+	}
+}
+#endif
+
+//! IMDCT (N >= FOURIER_MDCT_FUSE_MIN_N)
+//! This performs the same operations as the generic path, but
+//! the DCT-IV reads straight from BufIn[] rather than a copy,
+//! and its final stage is merged with the un-windowing. The
+//! outputs in the upper half of the DCT-IV are un-windowed with
+//! the old lapping data, while those in the lower half become
+//! the new lapping data. Processing the blocks of both halves
+//! from the middle outwards, each old lapping value has been
+//! consumed by the time that it is replaced.
+static void IMDCT_Fused(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	int i;
+	const float *WinS = ModulationWindow ? (ModulationWindow + Overlap-16) : Fourier_SinTableN(Overlap);
+	const float *WinC = WinS + Overlap;
+	const int NoLap = (N-Overlap)/2;
+
+	//! Undo transform (except for its final stage)
+	//! NOTE: BufOut is only used as scratch by the recursion,
+	//! after BufIn has been consumed, so these may be the same.
+	Fourier_DCT4_Head(BufIn, BufOut, BufTmp, N);
+
+	//! Finish the transform and undo lapping
+#if defined(__AVX__)
+	int r;
+	__m256 y[4];
+	__m256 a, b;
+	__m256 t0, t1;
+	__m256 c, s;
+	for(i=0;i<N/2;i+=32) {
+		IMDCT_Stage(y, BufTmp, N, N/8 + i/4);
+		for(r=0;r<4;r++) {
+			a = _mm256_load_ps(BufLap + N/2-8 - (i+8*r));
+			b = y[r];
+			a = _mm256_shuffle_ps(a, a, 0x1B);
+			a = _mm256_permute2f128_ps(a, a, 0x01);
+			if(i+8*r < NoLap) {
+				t0 = a;
+				t1 = b;
+			} else {
+				int j = i+8*r - NoLap;
+				s = _mm256_load_ps(WinS + j);
+				c = _mm256_load_ps(WinC-8 - j);
+				c = _mm256_shuffle_ps(c, c, 0x1B);
+				c = _mm256_permute2f128_ps(c, c, 0x01);
+#if defined(__FMA__)
+				t0 = _mm256_mul_ps(s, b);
+				t1 = _mm256_mul_ps(c, b);
+				t0 = _mm256_fmsub_ps(c, a, t0);
+				t1 = _mm256_fmadd_ps(s, a, t1);
+#else
+				t0 = _mm256_sub_ps(_mm256_mul_ps(c, a), _mm256_mul_ps(s, b));
+				t1 = _mm256_add_ps(_mm256_mul_ps(s, a), _mm256_mul_ps(c, b));
+#endif
+			}
+			t1 = _mm256_shuffle_ps(t1, t1, 0x1B);
+			t1 = _mm256_permute2f128_ps(t1, t1, 0x01);
+			_mm256_store_ps(BufOut     + (i+8*r), t0);
+			_mm256_store_ps(BufOut+N-8 - (i+8*r), t1);
+		}
+		IMDCT_Stage(y, BufTmp, N, N/8-8 - i/4);
+		for(r=0;r<4;r++) _mm256_store_ps(BufLap + N/2-32 - i + 8*r, y[r]);
+	}
+#elif defined(__SSE__)
+	int r;
+	__m128 y[4];
+	__m128 a, b;
+	__m128 t0, t1;
+	__m128 c, s;
+	for(i=0;i<N/2;i+=16) {
+		IMDCT_Stage(y, BufTmp, N, N/8 + i/4);
+		for(r=0;r<4;r++) {
+			a = _mm_loadr_ps(BufLap + N/2-4 - (i+4*r));
+			b = y[r];
+			if(i+4*r < NoLap) {
+				t0 = a;
+				t1 = b;
+			} else {
+				int j = i+4*r - NoLap;
+				s = _mm_load_ps (WinS + j);
+				c = _mm_loadr_ps(WinC-4 - j);
+#if defined(__FMA__)
+				t0 = _mm_mul_ps(s, b);
+				t1 = _mm_mul_ps(c, b);
+				t0 = _mm_fmsub_ps(c, a, t0);
+				t1 = _mm_fmadd_ps(s, a, t1);
+#else
+				t0 = _mm_sub_ps(_mm_mul_ps(c, a), _mm_mul_ps(s, b));
+				t1 = _mm_add_ps(_mm_mul_ps(s, a), _mm_mul_ps(c, b));
+#endif
+			}
+			_mm_store_ps (BufOut     + (i+4*r), t0);
+			_mm_storer_ps(BufOut+N-4 - (i+4*r), t1);
+		}
+		IMDCT_Stage(y, BufTmp, N, N/8-4 - i/4);
+		for(r=0;r<4;r++) _mm_store_ps(BufLap + N/2-16 - i + 4*r, y[r]);
+	}
+#else
+	for(i=0;i<N/2;i++) {
+		float a = BufLap[N/2-1-i];
+		float b = IMDCT_Stage(BufTmp, N, N/2+i);
+		if(i < NoLap) {
+			BufOut[i]     = a;
+			BufOut[N-1-i] = b;
+		} else {
+			float c = WinC[-1-(i-NoLap)];
+			float s = WinS[i-NoLap];
+			BufOut[i]     = c*a - s*b;
+			BufOut[N-1-i] = s*a + c*b;
+		}
+		BufLap[N/2-1-i] = IMDCT_Stage(BufTmp, N, N/2-1-i);
+	}
+#endif
+}
+
+/**************************************/
+
 //! Implementation notes for IMDCT:
 //!  IMDCT is implemented via DCT-IV, which can be thought of
 //!  as splitting the MDCT inputs into four regions:
@@ -29,27 +235,44 @@
 //!          (A_r + B) + Reverse(B_r - A) = (A_r + B) + (B - A_r) = 2B
 //!           ^ Buffered         ^ New input data
 //!  Allowing us to reconstruct the inputs A,B.
-void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+//!  The un-windowing is separate from the DCT-IV for small
+//!  transforms, and is then shared with the batched IMDCT.
+static inline __attribute__((always_inline)) void IMDCT_Unlap(float *BufOut, const float *BufTmp, float *BufLap, int N, int Overlap, const float *ModulationWindow) {
 	int i;
 	const float *WinS = ModulationWindow ? (ModulationWindow + Overlap-16) : Fourier_SinTableN(Overlap);
 	const float *WinC = WinS + Overlap;
-	const float *Lap   = BufLap + N/2;
+	      float *Lap   = BufLap + N/2;
+	const float *New   = BufTmp + N/2;
 	const float *Tmp   = BufTmp + N/2;
 	      float *OutLo = BufOut;
 	      float *OutHi = BufOut + N;
 
-	//! Undo transform
-	for(i=0;i<N;i++) BufTmp[i] = BufIn[i];
-	Fourier_DCT4(BufTmp, BufOut, N);
-
-	//! Undo lapping
+	//! NOTE: The new lapping data (BufTmp[0..N/2-1]) replaces
+	//! the old data in the same sweep, right after it is read.
 #if defined(__AVX__)
 	__m256 a, b;
 	__m256 t0, t1;
 	__m256 c, s;
+#if defined(__AVX512F__)
+	__m512i Rev = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+#endif
 
-	for(i=0;i<(N-Overlap)/2;i+=8) {
+	i = 0;
+#if defined(__AVX512F__)
+	for(;i<(N-Overlap)/2-15;i+=16) {
+		__m512 a, b;
+		Lap -= 16; a = _mm512_loadu_ps(Lap);
+		New -= 16; _mm512_storeu_ps(Lap, _mm512_loadu_ps(New));
+		b = _mm512_loadu_ps(Tmp); Tmp += 16;
+		a = _mm512_permutexvar_ps(Rev, a);
+		b = _mm512_permutexvar_ps(Rev, b);
+		_mm512_storeu_ps(OutLo, a); OutLo += 16;
+		OutHi -= 16; _mm512_storeu_ps(OutHi, b);
+	}
+#endif
+	for(;i<(N-Overlap)/2;i+=8) {
 		Lap -= 8; a = _mm256_load_ps(Lap);
+		New -= 8; _mm256_store_ps(Lap, _mm256_load_ps(New));
 		b = _mm256_load_ps(Tmp); Tmp += 8;
 		a = _mm256_shuffle_ps(a, a, 0x1B);
 		a = _mm256_permute2f128_ps(a, a, 0x01);
@@ -58,8 +281,30 @@ void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufT
 		_mm256_store_ps(OutLo, a); OutLo += 8;
 		OutHi -= 8; _mm256_store_ps(OutHi, b);
 	}
+#if defined(__AVX512F__)
+	for(;i<N/2-15;i+=16) {
+		__m512 a, b;
+		__m512 t0, t1;
+		__m512 c, s;
+		Lap -= 16; a = _mm512_loadu_ps(Lap);
+		New -= 16; _mm512_storeu_ps(Lap, _mm512_loadu_ps(New));
+		b = _mm512_loadu_ps(Tmp); Tmp += 16;
+		a = _mm512_permutexvar_ps(Rev, a);
+		WinC -= 16; c = _mm512_loadu_ps(WinC);
+		s = _mm512_loadu_ps(WinS); WinS += 16;
+		c = _mm512_permutexvar_ps(Rev, c);
+		t0 = _mm512_mul_ps(s, b);
+		t1 = _mm512_mul_ps(c, b);
+		t0 = _mm512_fmsub_ps(c, a, t0);
+		t1 = _mm512_fmadd_ps(s, a, t1);
+		t1 = _mm512_permutexvar_ps(Rev, t1);
+		_mm512_storeu_ps(OutLo, t0); OutLo += 16;
+		OutHi -= 16; _mm512_storeu_ps(OutHi, t1);
+	}
+#endif
 	for(;i<N/2;i+=8) {
 		Lap -= 8; a = _mm256_load_ps(Lap);
+		New -= 8; _mm256_store_ps(Lap, _mm256_load_ps(New));
 		b = _mm256_load_ps(Tmp); Tmp += 8;
 		a = _mm256_shuffle_ps(a, a, 0x1B);
 		a = _mm256_permute2f128_ps(a, a, 0x01);
@@ -88,12 +333,14 @@ void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufT
 
 	for(i=0;i<(N-Overlap)/2;i+=4) {
 		Lap -= 4; a = _mm_loadr_ps(Lap);
+		New -= 4; _mm_store_ps(Lap, _mm_load_ps(New));
 		b = _mm_load_ps(Tmp); Tmp += 4;
 		_mm_store_ps(OutLo, a); OutLo += 4;
 		OutHi -= 4; _mm_storer_ps(OutHi, b);
 	}
 	for(;i<N/2;i+=4) {
 		Lap -= 4; a = _mm_loadr_ps(Lap);
+		New -= 4; _mm_store_ps(Lap, _mm_load_ps(New));
 		b = _mm_load_ps(Tmp); Tmp += 4;
 		s = _mm_load_ps(WinS); WinS += 4;
 		WinC -= 4; c = _mm_loadr_ps(WinC);
@@ -112,12 +359,14 @@ void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufT
 #else
 	for(i=0;i<(N-Overlap)/2;i++) {
 		float a = *--Lap;
+		*Lap = *--New;
 		float b = *Tmp++;
 		*OutLo++ = a;
 		*--OutHi = b;
 	}
 	for(;i<N/2;i++) {
 		float a = *--Lap;
+		*Lap = *--New;
 		float b = *Tmp++;
 		float c = *--WinC;
 		float s = *WinS++;
@@ -125,8 +374,60 @@ void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufT
 		*--OutHi = s*a + c*b;
 	}
 #endif
-	//! Copy state to old block
-	for(i=0;i<N/2;i++) BufLap[i] = BufTmp[i];
+}
+
+
+void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	int i;
+
+	//! Use fused implementation when possible
+	if(N >= FOURIER_MDCT_FUSE_MIN_N && BufIn != BufTmp) {
+		IMDCT_Fused(BufOut, BufIn, BufLap, BufTmp, N, Overlap, ModulationWindow);
+		return;
+	}
+
+	//! Undo transform
+	if(BufIn != BufTmp) for(i=0;i<N;i++) BufTmp[i] = BufIn[i];
+	Fourier_DCT4(BufTmp, BufOut, N);
+
+	//! Undo lapping
+	IMDCT_Unlap(BufOut, BufTmp, BufLap, N, Overlap, ModulationWindow);
+}
+
+/**************************************/
+
+void Fourier_IMDCT_Batch(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+#if FOURIER_BATCH_LANES > 1
+	//! Small transforms: Undo the transforms of a group of lanes
+	//! at once, and then undo the lapping of each in order
+	if(N <= FOURIER_BATCH_MAX_N) {
+		int l;
+		float Tmp[FOURIER_BATCH_LANES*FOURIER_BATCH_MAX_N] __attribute__((aligned(32)));
+		float *TmpPtr[FOURIER_BATCH_LANES];
+		const float *SrcPtr[FOURIER_BATCH_LANES];
+		while(nBatch > 0) {
+			int nLanes = (nBatch < FOURIER_BATCH_LANES) ? nBatch : FOURIER_BATCH_LANES;
+			for(l=0;l<nLanes;l++) {
+				TmpPtr[l] = Tmp + l*N;
+				SrcPtr[l] = BufIn, BufIn += Stride;
+			}
+			Fourier_DCT4_Lanes(TmpPtr, SrcPtr, N, nLanes);
+			for(l=0;l<nLanes;l++) {
+				IMDCT_Unlap(BufOut, TmpPtr[l], BufLap, N, Overlap, ModulationWindow);
+				BufOut += Stride;
+				BufLap += LapStride;
+			}
+			nBatch -= nLanes;
+		}
+		return;
+	}
+#endif
+	for(;nBatch>0;nBatch--) {
+		Fourier_IMDCT(BufOut, BufIn, BufLap, BufTmp, N, Overlap, ModulationWindow);
+		BufOut += Stride;
+		BufIn  += Stride;
+		BufLap += LapStride;
+	}
 }
 
 /**************************************/
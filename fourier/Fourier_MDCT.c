@@ -3,7 +3,8 @@
 //! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
 //! Refer to the project README file for license terms.
 /**************************************/
-#if defined(__AVX__)
+#include <stddef.h>
+#if defined(__AVX__) || defined(__FMA__)
 # include <immintrin.h>
 #endif
 #if defined(__SSE__)
@@ -13,6 +14,305 @@
 #include "Fourier.h"
 /**************************************/
 
+//! MDCT+MDST (N >= FOURIER_MDCT_FUSE_MIN_N)
+//! This performs the same operations as the generic path, but
+//! the windowed lapping is merged with the first butterfly stage
+//! of DCT4T() (and DCT4TR()). In terms of the index n used for
+//! lapping, the lower half of the DCT input (L[n] = C_r + D) is
+//! in reverse order, and the upper half (U[n] = B_r - A) is in
+//! normal order, so the first stage pairs up n=2p-1 with n=2p:
+//!  T[N/4-p]   = L[2p]   + L[2p-1]
+//!  T[3N/4+p]  = L[2p]   - L[2p-1]
+//!  T[N/4+p]   = U[2p-1] + U[2p]
+//!  T[3N/4-p]  = U[2p-1] - U[2p]
+//! with L[-1] = U[0] and U[-1] = L[0] (which pair up across the
+//! middle of the input), and the unpaired T[0] = 2*L[N/2-1] and
+//! T[N/2] = 2*U[N/2-1]. Each block then carries its last input
+//! over to the next block.
+//! NOTE: The first stage for the MDST is stored to MDCT[], which
+//! is not otherwise used until the MDCT's own final stage.
+static inline __attribute__((always_inline)) void MDCT_MDST_Fused(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int WithMDST) {
+	int n;
+	const float *WinS = ModulationWindow ? (ModulationWindow + Overlap-16) : Fourier_SinTableN(Overlap);
+	const float *WinC = WinS + Overlap;
+	      float *LapLo = Lap;
+	      float *LapHi = Lap + N;
+	const float *NewLo = New;
+	const float *NewHi = New + N;
+	      float *T = BufTmp;
+	      float *S = MDCT;
+	const int NoLap = (N-Overlap)/2;
+
+	//! Perform windowed lapping and first DCT-IV stage
+	{
+#if defined(__AVX__)
+		__m256 c, s;
+		__m256 A, Br, C, Dr;
+		__m256 L0, U0, LS0, US0;
+		__m256 L1, U1, LS1, US1;
+		__m256 pL, pU, pLS, pUS;
+		__m256 Zero  = _mm256_setzero_ps();
+		__m256 MaskL = _mm256_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f);
+		__m256 MaskU = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
+#if defined(__AVX2__)
+		__m256i Rev   = _mm256_setr_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+		__m256i Rot   = _mm256_setr_epi32(7, 0, 1, 2, 3, 4, 5, 6);
+#endif
+
+		//! Fold the inputs for 8 values of n
+#define FOLD(n, L, U, LS, US) \
+		A  = _mm256_load_ps(LapLo   + (n)); \
+		Br = _mm256_load_ps(LapHi-8 - (n)); \
+		C  = _mm256_load_ps(NewLo   + (n)); \
+		Dr = _mm256_load_ps(NewHi-8 - (n)); \
+		Br = _mm256_permute2f128_ps(Br, Br, 0x01); \
+		Br = _mm256_shuffle_ps     (Br, Br, 0x1B); \
+		if((n) < NoLap) { \
+			_mm256_store_ps(LapLo   + (n), Zero); \
+			_mm256_store_ps(LapHi-8 - (n), Dr); \
+			L  = C; \
+			LS = C; \
+		} else { \
+			WinC -= 8; \
+			c  = _mm256_load_ps(WinC); \
+			s  = _mm256_load_ps(WinS); \
+			WinS += 8; \
+			_mm256_store_ps(LapLo   + (n), _mm256_mul_ps(s, C)); \
+			_mm256_store_ps(LapHi-8 - (n), _mm256_mul_ps(c, Dr)); \
+			c  = _mm256_permute2f128_ps(c,  c,  0x01); \
+			c  = _mm256_shuffle_ps     (c,  c,  0x1B); \
+			Dr = _mm256_permute2f128_ps(Dr, Dr, 0x01); \
+			Dr = _mm256_shuffle_ps     (Dr, Dr, 0x1B); \
+			C  = _mm256_mul_ps(C,  c); \
+			Dr = _mm256_mul_ps(Dr, s); \
+			L  = _mm256_add_ps(C,  Dr); \
+			LS = _mm256_sub_ps(C,  Dr); \
+		} \
+		U  = _mm256_sub_ps(Br, A); \
+		US = _mm256_add_ps(Br, A); \
+		LS = _mm256_xor_ps(LS, MaskL); \
+		US = _mm256_xor_ps(US, MaskU)
+
+		//! Split V0,V1 into even (c) and odd (s) inputs, and
+		//! shift the odd inputs up one lane, so that V[2p-1]
+		//! lines up with V[2p]. The last odd input is carried
+		//! over to the next block through p.
+#if defined(__AVX2__)
+# define PAIR_SPLIT(V0, V1, p) \
+		c = _mm256_permute2f128_ps(V0, V1, 0x20); \
+		s = _mm256_permute2f128_ps(V0, V1, 0x31); \
+		A = _mm256_shuffle_ps(c, s, 0x88); \
+		s = _mm256_shuffle_ps(c, s, 0xDD); \
+		c = A; \
+		A = _mm256_permutevar8x32_ps(s, Rot); \
+		s = _mm256_blend_ps(A, p, 0x01); \
+		p = A
+# define PAIR_REVERSE(x) x = _mm256_permutevar8x32_ps(x, Rev)
+# define PAIR_CARRY(p)   _mm256_cvtss_f32(p)
+# define PAIR_INIT(x)    (x)
+#else
+# define PAIR_SPLIT(V0, V1, p) \
+		c = _mm256_permute2f128_ps(V0, V1, 0x20); \
+		s = _mm256_permute2f128_ps(V0, V1, 0x31); \
+		A = _mm256_shuffle_ps(c, s, 0x88); \
+		s = _mm256_shuffle_ps(c, s, 0xDD); \
+		c = A; \
+		A = _mm256_permute_ps(s, 0x93); \
+		s = _mm256_blend_ps(A, _mm256_permute2f128_ps(A, p, 0x03), 0x11); \
+		p = A
+# define PAIR_REVERSE(x) x = _mm256_shuffle_ps(x, x, 0x1B), x = _mm256_permute2f128_ps(x, x, 0x01)
+# define PAIR_CARRY(p)   _mm_cvtss_f32(_mm256_extractf128_ps(p, 1))
+# define PAIR_INIT(x)    _mm256_permute2f128_ps(x, x, 0x00)
+#endif
+#define PAIR_LO(Dst, V0, V1, p) \
+		PAIR_SPLIT(V0, V1, p); \
+		A = _mm256_add_ps(c, s); \
+		s = _mm256_sub_ps(c, s); \
+		PAIR_REVERSE(A); \
+		_mm256_storeu_ps(Dst + N/4-7       - n/2, A); \
+		_mm256_store_ps (Dst + N/2+N/4     + n/2, s)
+#define PAIR_HI(Dst, V0, V1, p) \
+		PAIR_SPLIT(V0, V1, p); \
+		A = _mm256_add_ps(s, c); \
+		s = _mm256_sub_ps(s, c); \
+		PAIR_REVERSE(s); \
+		_mm256_store_ps (Dst + N/4         + n/2, A); \
+		_mm256_storeu_ps(Dst + N/2+N/4-7   - n/2, s)
+		for(n=0;n<N/2;n+=16) {
+			FOLD(n,   L0, U0, LS0, US0);
+			FOLD(n+8, L1, U1, LS1, US1);
+			if(n == 0) {
+				pL  = PAIR_INIT(U0);
+				pU  = PAIR_INIT(L0);
+				pLS = PAIR_INIT(US0);
+				pUS = PAIR_INIT(LS0);
+			}
+			PAIR_LO(T, L0, L1, pL);
+			PAIR_HI(T, U0, U1, pU);
+			if(WithMDST) {
+				PAIR_LO(S, LS0, LS1, pLS);
+				PAIR_HI(S, US0, US1, pUS);
+			}
+		}
+		T[0]   = PAIR_CARRY(pL) * 2.0f;
+		T[N/2] = PAIR_CARRY(pU) * 2.0f;
+		if(WithMDST) {
+			S[0]   = PAIR_CARRY(pLS) * 2.0f;
+			S[N/2] = PAIR_CARRY(pUS) * 2.0f;
+		}
+#undef PAIR_HI
+#undef PAIR_LO
+#undef PAIR_INIT
+#undef PAIR_CARRY
+#undef PAIR_REVERSE
+#undef PAIR_SPLIT
+#undef FOLD
+#elif defined(__SSE__)
+		__m128 c, s;
+		__m128 A, Br, C, Dr;
+		__m128 L0, U0, LS0, US0;
+		__m128 L1, U1, LS1, US1;
+		__m128 pL, pU, pLS, pUS;
+		__m128 Zero  = _mm_setzero_ps();
+		__m128 MaskL = _mm_setr_ps(-0.0f, 0.0f, -0.0f, 0.0f);
+		__m128 MaskU = _mm_setr_ps(0.0f, -0.0f, 0.0f, -0.0f);
+
+		//! Fold the inputs for 4 values of n
+#define FOLD(n, L, U, LS, US) \
+		A  = _mm_load_ps(LapLo   + (n)); \
+		Br = _mm_load_ps(LapHi-4 - (n)); \
+		C  = _mm_load_ps(NewLo   + (n)); \
+		Dr = _mm_load_ps(NewHi-4 - (n)); \
+		Br = _mm_shuffle_ps(Br, Br, 0x1B); \
+		if((n) < NoLap) { \
+			_mm_store_ps(LapLo   + (n), Zero); \
+			_mm_store_ps(LapHi-4 - (n), Dr); \
+			L  = C; \
+			LS = C; \
+		} else { \
+			WinC -= 4; \
+			c  = _mm_load_ps(WinC); \
+			s  = _mm_load_ps(WinS); \
+			WinS += 4; \
+			_mm_store_ps(LapLo   + (n), _mm_mul_ps(s, C)); \
+			_mm_store_ps(LapHi-4 - (n), _mm_mul_ps(c, Dr)); \
+			c  = _mm_shuffle_ps(c,  c,  0x1B); \
+			Dr = _mm_shuffle_ps(Dr, Dr, 0x1B); \
+			C  = _mm_mul_ps(C,  c); \
+			Dr = _mm_mul_ps(Dr, s); \
+			L  = _mm_add_ps(C,  Dr); \
+			LS = _mm_sub_ps(C,  Dr); \
+		} \
+		U  = _mm_sub_ps(Br, A); \
+		US = _mm_add_ps(Br, A); \
+		LS = _mm_xor_ps(LS, MaskL); \
+		US = _mm_xor_ps(US, MaskU)
+
+		//! Split V0,V1 into even (c) and odd (s) inputs, and
+		//! shift the odd inputs up one lane, so that V[2p-1]
+		//! lines up with V[2p]. The last odd input is carried
+		//! over to the next block through p.
+#define PAIR_SPLIT(V0, V1, p) \
+		c = _mm_shuffle_ps(V0, V1, 0x88); \
+		A = _mm_shuffle_ps(V0, V1, 0xDD); \
+		A = _mm_shuffle_ps(A,  A,  0x93); \
+		s = _mm_move_ss(A, p); \
+		p = A
+#define PAIR_LO(Dst, V0, V1, p) \
+		PAIR_SPLIT(V0, V1, p); \
+		A = _mm_add_ps(c, s); \
+		s = _mm_sub_ps(c, s); \
+		_mm_storeu_ps(Dst + N/4-3       - n/2, _mm_shuffle_ps(A, A, 0x1B)); \
+		_mm_store_ps (Dst + N/2+N/4     + n/2, s)
+#define PAIR_HI(Dst, V0, V1, p) \
+		PAIR_SPLIT(V0, V1, p); \
+		A = _mm_add_ps(s, c); \
+		s = _mm_sub_ps(s, c); \
+		_mm_store_ps (Dst + N/4         + n/2, A); \
+		_mm_storeu_ps(Dst + N/2+N/4-3   - n/2, _mm_shuffle_ps(s, s, 0x1B))
+		for(n=0;n<N/2;n+=8) {
+			FOLD(n,   L0, U0, LS0, US0);
+			FOLD(n+4, L1, U1, LS1, US1);
+			if(n == 0) pL = U0, pU = L0, pLS = US0, pUS = LS0;
+			PAIR_LO(T, L0, L1, pL);
+			PAIR_HI(T, U0, U1, pU);
+			if(WithMDST) {
+				PAIR_LO(S, LS0, LS1, pLS);
+				PAIR_HI(S, US0, US1, pUS);
+			}
+		}
+		T[0]   = _mm_cvtss_f32(pL) * 2.0f;
+		T[N/2] = _mm_cvtss_f32(pU) * 2.0f;
+		if(WithMDST) {
+			S[0]   = _mm_cvtss_f32(pLS) * 2.0f;
+			S[N/2] = _mm_cvtss_f32(pUS) * 2.0f;
+		}
+#undef PAIR_HI
+#undef PAIR_LO
+#undef PAIR_SPLIT
+#undef FOLD
+#else
+		float c, s;
+		float A, Br, C, Dr;
+		float L, U, LS, US;
+		float pL = 0.0f, pU = 0.0f, pLS = 0.0f, pUS = 0.0f;
+		for(n=0;n<N/2;n++) {
+			A  = LapLo[   n];
+			Br = LapHi[-1-n];
+			C  = NewLo[   n];
+			Dr = NewHi[-1-n];
+			if(n < NoLap) {
+				LapLo[   n] = 0.0f;
+				LapHi[-1-n] = Dr;
+				L  = C;
+				LS = C;
+			} else {
+				c = *--WinC;
+				s = *WinS++;
+				LapLo[   n] = s*C;
+				LapHi[-1-n] = c*Dr;
+				C *= c, Dr *= s;
+				L  = C + Dr;
+				LS = C - Dr;
+			}
+			U  = -A + Br;
+			US =  A + Br;
+			if(n&1) US = -US;
+			else    LS = -LS;
+			if(n == 0) pL = U, pU = L, pLS = US, pUS = LS;
+			if(!(n&1)) {
+				int p = n/2;
+				T[N/4    -p] = L + pL;
+				T[N/2+N/4+p] = L - pL;
+				T[N/4    +p] = pU + U;
+				T[N/2+N/4-p] = pU - U;
+				if(WithMDST) {
+					S[N/4    -p] = LS + pLS;
+					S[N/2+N/4+p] = LS - pLS;
+					S[N/4    +p] = pUS + US;
+					S[N/2+N/4-p] = pUS - US;
+				}
+			}
+			pL = L, pU = U, pLS = LS, pUS = US;
+		}
+		T[0]   = pL * 2.0f;
+		T[N/2] = pU * 2.0f;
+		if(WithMDST) {
+			S[0]   = pLS * 2.0f;
+			S[N/2] = pUS * 2.0f;
+		}
+#endif
+	}
+
+	//! Do remaining transform stages
+	//! NOTE: The MDST must be finished first, as it uses MDCT[]
+	//! as input, and MDCT[] is then used as scratch by the MDCT.
+	if(WithMDST) Fourier_DCT4TR_Tail(MDST, S, N);
+	Fourier_DCT4T_Tail(MDCT, T, N);
+}
+
+/**************************************/
+
 //! Implementation notes for MDCT:
 //!  MDCT is implemented via DCT-IV, which can be thought of
 //!  as splitting the MDCT inputs into four regions:
@@ -37,7 +337,9 @@
 //!     MDCT[N/2+n]   = -s*Old[n] + c*Old[N-1-n];
 //!     MDST[N/2+n]   = -s*Old[n] - c*Old[N-1-n];
 //!   }
-void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+//!  The windowing is separate from the DCT-IV for small
+//!  transforms, and is then shared with the batched MDCT.
+static inline __attribute__((always_inline)) void MDCT_MDST_Window(float *MDCT, float *MDST, const float *New, float *Lap, int N, int Overlap, const float *ModulationWindow, int WithMDST) {
 	int n;
 	const float *WinS = ModulationWindow ? (ModulationWindow + Overlap-16) : Fourier_SinTableN(Overlap);
 	const float *WinC = WinS + Overlap;
@@ -46,18 +348,43 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 	const float *NewLo = New;
 	const float *NewHi = New + N;
 	      float *MDCTMid = MDCT + N/2;
-	      float *MDSTMid = MDST + N/2;
+	      float *MDSTMid = WithMDST ? (MDST + N/2) : NULL;
 
-	//! Perform windowed lapping
 	//! NOTE: We compute MDST using DCT-IV, so sign-flip every other
-	//! value here, and then reverse the whole array after DCT-IV.
+	//! value here, and then reverse the whole array via DCT4TR().
 	{
 #if defined(__AVX__)
 		__m256 c, s;
 		__m256 A, Br, C, Dr;
 		__m256 Zero = _mm256_setzero_ps();
 		__m256 XorMask = _mm256_setr_ps(0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f, 0.0f, -0.0f);
-		for(n=0;n<(N-Overlap)/2;n+=8) {
+#if defined(__AVX512F__)
+		__m512i Rev       = _mm512_setr_epi32(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0);
+		__m512i XorMask16 = _mm512_set1_epi64(0x8000000000000000ull);
+#define XOR16(x) _mm512_castsi512_ps(_mm512_xor_si512(_mm512_castps_si512(x), XorMask16))
+#endif
+		n = 0;
+#if defined(__AVX512F__)
+		for(;n<(N-Overlap)/2-15;n+=16) {
+			__m512 c, s;
+			__m512 A, Br, C, Dr;
+			A  = _mm512_loadu_ps(LapLo    + n);
+			Br = _mm512_loadu_ps(LapHi-16 - n);
+			C  = _mm512_loadu_ps(NewLo    + n);
+			Dr = _mm512_loadu_ps(NewHi-16 - n);
+			Br = _mm512_permutexvar_ps(Rev, Br);
+			C  = _mm512_permutexvar_ps(Rev, C);
+			_mm512_storeu_ps(LapLo      + n, _mm512_setzero_ps());
+			_mm512_storeu_ps(LapHi  -16 - n, Dr);
+			_mm512_storeu_ps(MDCTMid-16 - n, C);
+			if(WithMDST) _mm512_storeu_ps(MDSTMid-16 - n, XOR16(C));
+			c = _mm512_sub_ps(Br, A);
+			s = _mm512_add_ps(Br, A);
+			_mm512_storeu_ps(MDCTMid    + n, c);
+			if(WithMDST) _mm512_storeu_ps(MDSTMid    + n, XOR16(s));
+		}
+#endif
+		for(;n<(N-Overlap)/2;n+=8) {
 			A  = _mm256_load_ps(LapLo   + n);
 			Br = _mm256_load_ps(LapHi-8 - n);
 			C  = _mm256_load_ps(NewLo   + n);
@@ -69,12 +396,44 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			_mm256_store_ps(LapLo     + n, Zero);
 			_mm256_store_ps(LapHi  -8 - n, Dr);
 			_mm256_store_ps(MDCTMid-8 - n, C);
-			_mm256_store_ps(MDSTMid-8 - n, _mm256_xor_ps(C, XorMask));
+			if(WithMDST) _mm256_store_ps(MDSTMid-8 - n, _mm256_xor_ps(C, XorMask));
 			c = _mm256_sub_ps(Br, A);
 			s = _mm256_add_ps(Br, A);
 			_mm256_store_ps(MDCTMid   + n, c);
-			_mm256_store_ps(MDSTMid   + n, _mm256_xor_ps(s, XorMask));
+			if(WithMDST) _mm256_store_ps(MDSTMid   + n, _mm256_xor_ps(s, XorMask));
+		}
+#if defined(__AVX512F__)
+		for(;n<N/2-15;n+=16) {
+			__m512 c, s;
+			__m512 A, Br, C, Dr;
+			WinC -= 16;
+			c  = _mm512_loadu_ps(WinC);
+			s  = _mm512_loadu_ps(WinS);
+			WinS += 16;
+			A  = _mm512_loadu_ps(LapLo    + n);
+			Br = _mm512_loadu_ps(LapHi-16 - n);
+			C  = _mm512_loadu_ps(NewLo    + n);
+			Dr = _mm512_loadu_ps(NewHi-16 - n);
+			_mm512_storeu_ps(LapLo    + n, _mm512_mul_ps(s, C));
+			_mm512_storeu_ps(LapHi-16 - n, _mm512_mul_ps(c, Dr));
+			c  = _mm512_permutexvar_ps(Rev, c);
+			Br = _mm512_permutexvar_ps(Rev, Br);
+			Dr = _mm512_permutexvar_ps(Rev, Dr);
+			C  = _mm512_mul_ps(C,  c);
+			Dr = _mm512_mul_ps(Dr, s);
+			c  = _mm512_add_ps(C,  Dr);
+			s  = _mm512_sub_ps(C,  Dr);
+			c  = _mm512_permutexvar_ps(Rev, c);
+			s  = _mm512_permutexvar_ps(Rev, s);
+			_mm512_storeu_ps(MDCTMid-16 - n, c);
+			if(WithMDST) _mm512_storeu_ps(MDSTMid-16 - n, XOR16(s));
+			c  = _mm512_sub_ps(Br, A);
+			s  = _mm512_add_ps(Br, A);
+			_mm512_storeu_ps(MDCTMid    + n, c);
+			if(WithMDST) _mm512_storeu_ps(MDSTMid    + n, XOR16(s));
 		}
+#undef XOR16
+#endif
 		for(;n<N/2;n+=8) {
 			WinC -= 8;
 			c  = _mm256_load_ps(WinC);
@@ -101,11 +460,11 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			s  = _mm256_permute2f128_ps(s, s, 0x01);
 			s  = _mm256_shuffle_ps     (s, s, 0x1B);
 			_mm256_store_ps(MDCTMid-8 - n, c);
-			_mm256_store_ps(MDSTMid-8 - n, _mm256_xor_ps(s, XorMask));
+			if(WithMDST) _mm256_store_ps(MDSTMid-8 - n, _mm256_xor_ps(s, XorMask));
 			c  = _mm256_sub_ps(Br, A);
 			s  = _mm256_add_ps(Br, A);
 			_mm256_store_ps(MDCTMid   + n, c);
-			_mm256_store_ps(MDSTMid   + n, _mm256_xor_ps(s, XorMask));
+			if(WithMDST) _mm256_store_ps(MDSTMid   + n, _mm256_xor_ps(s, XorMask));
 		}
 #elif defined(__SSE__)
 		__m128 c, s;
@@ -122,11 +481,11 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			_mm_store_ps(LapLo     + n, Zero);
 			_mm_store_ps(LapHi  -4 - n, Dr);
 			_mm_store_ps(MDCTMid-4 - n, C);
-			_mm_store_ps(MDSTMid-4 - n, _mm_xor_ps(C, XorMask));
+			if(WithMDST) _mm_store_ps(MDSTMid-4 - n, _mm_xor_ps(C, XorMask));
 			c = _mm_sub_ps(Br, A);
 			s = _mm_add_ps(Br, A);
 			_mm_store_ps(MDCTMid   + n, c);
-			_mm_store_ps(MDSTMid   + n, _mm_xor_ps(s, XorMask));
+			if(WithMDST) _mm_store_ps(MDSTMid   + n, _mm_xor_ps(s, XorMask));
 		}
 		for(;n<N/2;n+=4) {
 			WinC -= 4;
@@ -149,11 +508,11 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			c  = _mm_shuffle_ps(c, c, 0x1B);
 			s  = _mm_shuffle_ps(s, s, 0x1B);
 			_mm_store_ps(MDCTMid-4 - n, c);
-			_mm_store_ps(MDSTMid-4 - n, _mm_xor_ps(s, XorMask));
+			if(WithMDST) _mm_store_ps(MDSTMid-4 - n, _mm_xor_ps(s, XorMask));
 			c  = _mm_sub_ps(Br, A);
 			s  = _mm_add_ps(Br, A);
 			_mm_store_ps (MDCTMid   + n, c);
-			_mm_store_ps (MDSTMid   + n, _mm_xor_ps(s, XorMask));
+			if(WithMDST) _mm_store_ps(MDSTMid   + n, _mm_xor_ps(s, XorMask));
 		}
 #else
 		float c, s;
@@ -166,9 +525,9 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			LapLo  [   n] =  0.0f;
 			LapHi  [-1-n] =  Dr;
 			MDCTMid[-1-n] =  C;
-			MDSTMid[-1-n] =  C;
+			if(WithMDST) MDSTMid[-1-n] =  C;
 			MDCTMid[   n] = -A + Br;
-			MDSTMid[   n] =  A + Br;
+			if(WithMDST) MDSTMid[   n] =  A + Br;
 		}
 		for(;n<N/2;n++) {
 			c = *--WinC;
@@ -181,59 +540,81 @@ void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, f
 			LapHi  [-1-n] = c*Dr;
 			C *= c, Dr *= s;
 			MDCTMid[-1-n] =  C + Dr;
-			MDSTMid[-1-n] =  C - Dr;
+			if(WithMDST) MDSTMid[-1-n] =  C - Dr;
 			MDCTMid[   n] = -A + Br;
-			MDSTMid[   n] =  A + Br;
+			if(WithMDST) MDSTMid[   n] =  A + Br;
 
 		}
-		for(n=1;n<N;n+=2) MDST[n] = -MDST[n];
+		if(WithMDST) for(n=1;n<N;n+=2) MDST[n] = -MDST[n];
 #endif
 	}
+}
+static inline __attribute__((always_inline)) void MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int WithMDST) {
+	if(N >= FOURIER_MDCT_FUSE_MIN_N && New != BufTmp) {
+		MDCT_MDST_Fused(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow, WithMDST);
+		return;
+	}
+
+	//! Perform windowed lapping
+	MDCT_MDST_Window(MDCT, MDST, New, Lap, N, Overlap, ModulationWindow, WithMDST);
 
 	//! Do actual transforms
+	//! NOTE: MDST is output in reverse order by DCT4TR().
 	Fourier_DCT4T(MDCT, BufTmp, N);
-	Fourier_DCT4T(MDST, BufTmp, N);
+	if(WithMDST) Fourier_DCT4TR(MDST, BufTmp, N);
+}
 
-	//! Reverse array for MDST
-	{
-		float *BufLo = MDST;
-		float *BufHi = MDST + N;
-#if defined(__AVX_)
-		__m256 v0, v1;
-		for(n=0;n<N/2;n+=8) {
-			BufHi -= 8;
-			v0 = _mm256_load_ps(BufLo);
-			v1 = _mm256_load_ps(BufHi);
-			v0 = _mm256_shuffle_ps(v0, v0, 0x1B);
-			v1 = _mm256_shuffle_ps(v1, v1, 0x1B);
-			v0 = _mm256_permute2f128_ps(v0, v0, 0x01);
-			v1 = _mm256_permute2f128_ps(v1, v1, 0x01);
-			_mm256_store_ps(BufHi, v0);
-			_mm256_store_ps(BufLo, v1);
-			BufLo += 8;
-		}
-#elif defined(__SSE__)
-		__m128 v0, v1;
-		for(n=0;n<N/2;n+=4) {
-			BufHi -= 4;
-			v0 = _mm_load_ps(BufLo);
-			v1 = _mm_load_ps(BufHi);
-			_mm_storer_ps(BufHi, v0);
-			_mm_storer_ps(BufLo, v1);
-			BufLo += 4;
-		}
-#else
-		for(n=0;n<N/2;n++) {
-			BufHi--;
-			float t = *BufLo;
-			*BufLo = *BufHi;
-			*BufHi = t;
-			BufLo++;
+//! Batched version
+//! Small transforms are windowed in order, and then their DCT-IVs
+//! are done across lanes (with the MDCT and MDST of each transform
+//! sharing a group of lanes, so that stereo fills four lanes).
+static inline __attribute__((always_inline)) void MDCT_MDST_Batch(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int WithMDST, int nBatch, int Stride, int LapStride) {
+#if FOURIER_BATCH_LANES > 1
+	if(N <= FOURIER_BATCH_MAX_N) {
+		float *Ptr[FOURIER_BATCH_LANES];
+		while(nBatch > 0) {
+			int nLanes = 0, RevMask = 0;
+			do {
+				MDCT_MDST_Window(MDCT, MDST, New, Lap, N, Overlap, ModulationWindow, WithMDST);
+				Ptr[nLanes++] = MDCT;
+				if(WithMDST) RevMask |= 1 << nLanes, Ptr[nLanes++] = MDST;
+				MDCT += Stride;
+				if(WithMDST) MDST += Stride;
+				New += Stride;
+				Lap += LapStride;
+			} while(--nBatch > 0 && nLanes+1+WithMDST <= FOURIER_BATCH_LANES);
+			Fourier_DCT4T_Lanes(Ptr, (const float *const*)Ptr, N, nLanes, RevMask);
 		}
+		return;
+	}
 #endif
+	for(;nBatch>0;nBatch--) {
+		MDCT_MDST(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow, WithMDST);
+		MDCT += Stride;
+		if(WithMDST) MDST += Stride;
+		New  += Stride;
+		Lap  += LapStride;
 	}
 }
 
+/**************************************/
+
+void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	MDCT_MDST(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow, 1);
+}
+
+//! MDCT-only version: skips the MDST windowing stores and its DCT-IV
+void Fourier_MDCT(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow) {
+	MDCT_MDST(MDCT, NULL, New, Lap, BufTmp, N, Overlap, ModulationWindow, 0);
+}
+
+void Fourier_MDCT_MDST_Batch(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+	MDCT_MDST_Batch(MDCT, MDST, New, Lap, BufTmp, N, Overlap, ModulationWindow, 1, nBatch, Stride, LapStride);
+}
+void Fourier_MDCT_Batch(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride) {
+	MDCT_MDST_Batch(MDCT, NULL, New, Lap, BufTmp, N, Overlap, ModulationWindow, 0, nBatch, Stride, LapStride);
+}
+
 /**************************************/
 //! EOF
 /**************************************/
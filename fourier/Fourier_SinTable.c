@@ -3,6 +3,10 @@
 //! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
 //! Refer to the project README file for license terms.
 /**************************************/
+#include <stdint.h>
+/**************************************/
+#include "Fourier.h"
+/**************************************/
 
 //! Auto-generated; do not modify
 //! 40bit Sine table.
@@ -10,2056 +14,2144 @@
 //! 40bit precision should be enough for float
 //! casts in high precision, as well as any other
 //! integer conversion.
-#define X(x) ((x) * 0x1.0p-40f)
-const float Fourier_SinTable[] = {
-	X(0x0C8FB2F886ull),X(0x259020DD1Cull),X(0x3E33F2F642ull),X(0x563E69D6ACull),X(0x6D74402785ull),X(0x839C3CC917ull),X(0x987FBFE70Bull),X(0xABEB49A467ull),
+//! The values are expanded into both a float table and a .31
+//! fixed-point table (for the fixed-point transforms).
+//! Each size is stored after the last, so sizes above
+//! FOURIER_SINTABLE_MAX_N are simply left off the end.
+#define FOURIER_SINTABLE_VALUES_16(X) \
+	X(0x0C8FB2F886ull),X(0x259020DD1Cull),X(0x3E33F2F642ull),X(0x563E69D6ACull),X(0x6D74402785ull),X(0x839C3CC917ull),X(0x987FBFE70Bull),X(0xABEB49A467ull), \
 	X(0xBDAEF91355ull),X(0xCD9F023F9Cull),X(0xDB941A28CBull),X(0xE76BD7A1E6ull),X(0xF1090827B4ull),X(0xF853F7DC91ull),X(0xFD3AABF845ull),X(0xFFB10F1BCBull),
-	X(0x0648557DE8ull),X(0x12D52092CEull),X(0x1F564E56A9ull),X(0x2BC4288916ull),X(0x381704D4FCull),X(0x4447498AC7ull),X(0x504D72505Dull),X(0x5C2214C3E9ull),
-	X(0x67BDE50EA3ull),X(0x7319BA64C7ull),X(0x7E2E936FE2ull),X(0x88F59AA0DAull),X(0x93682A66E8ull),X(0x9D7FD14902ull),X(0xA73655DF1Full),X(0xB085BAA8E9ull),
-	X(0xB96841BF7Full),X(0xC1D8705FFCull),X(0xC9D1124C93ull),X(0xD14D3D0231ull),X(0xD84852C0A8ull),X(0xDEBE05637Cull),X(0xE4AA5909A0ull),X(0xEA09A68A6Eull),
+
+#if FOURIER_SINTABLE_MAX_N >= 32
+# define FOURIER_SINTABLE_VALUES_32(X) \
+	X(0x0648557DE8ull),X(0x12D52092CEull),X(0x1F564E56A9ull),X(0x2BC4288916ull),X(0x381704D4FCull),X(0x4447498AC7ull),X(0x504D72505Dull),X(0x5C2214C3E9ull), \
+	X(0x67BDE50EA3ull),X(0x7319BA64C7ull),X(0x7E2E936FE2ull),X(0x88F59AA0DAull),X(0x93682A66E8ull),X(0x9D7FD14902ull),X(0xA73655DF1Full),X(0xB085BAA8E9ull), \
+	X(0xB96841BF7Full),X(0xC1D8705FFCull),X(0xC9D1124C93ull),X(0xD14D3D0231ull),X(0xD84852C0A8ull),X(0xDEBE05637Cull),X(0xE4AA5909A0ull),X(0xEA09A68A6Eull), \
 	X(0xEED89DB666ull),X(0xF314476247ull),X(0xF6BA073B42ull),X(0xF9C79D6327ull),X(0xFC3B27D38Aull),X(0xFE1323870Cull),X(0xFF4E6D680Cull),X(0xFFEC430426ull),
-	X(0x03243A3F9Bull),X(0x096C32BACAull),X(0x0FB2B73CFCull),X(0x15F6D00A9Aull),X(0x1C3785C79Eull),X(0x2273E19DB5ull),X(0x28AAED6252ull),X(0x2EDBB3BCA1ull),
-	X(0x3505404B60ull),X(0x3B269FCA8Aull),X(0x413EE038DFull),X(0x474D10FD33ull),X(0x4D50430B86ull),X(0x53478909E3ull),X(0x5931F774FCull),X(0x5F0EA4C477ull),
-	X(0x64DCA98EF2ull),X(0x6A9B20ADB4ull),X(0x7049276004ull),X(0x75E5DD6E1Bull),X(0x7B70654BBDull),X(0x80E7E43A61ull),X(0x864B826AECull),X(0x8B9A6B1EF6ull),
-	X(0x90D3CCC99Full),X(0x95F6D92FD7ull),X(0x9B02C58832ull),X(0x9FF6CA9A2Aull),X(0xA4D224DCD8ull),X(0xA99414951Aull),X(0xAE3BDDF328ull),X(0xB2C8C92F83ull),
-	X(0xB73A22A755ull),X(0xBB8F3AF81Bull),X(0xBFC7671AB8ull),X(0xC3E2007DD1ull),X(0xC7DE651F7Cull),X(0xCBBBF7A63Eull),X(0xCF7A1F794Dull),X(0xD31848D817ull),
-	X(0xD695E4F10Eull),X(0xD9F269F7AAull),X(0xDD2D5339ACull),X(0xE046213392ull),X(0xE33C59A443ull),X(0xE60F879FE7ull),X(0xE8BF3BA1F1ull),X(0xEB4B0B9E4Full),
-	X(0xEDB29311C5ull),X(0xEFF573116Dull),X(0xF21352595Eull),X(0xF40BDD5A66ull),X(0xF5DEC646F8ull),X(0xF78BC51F23ull),X(0xF91297BBB1ull),X(0xFA7301D859ull),
+#else
+# define FOURIER_SINTABLE_VALUES_32(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 64
+# define FOURIER_SINTABLE_VALUES_64(X) \
+	X(0x03243A3F9Bull),X(0x096C32BACAull),X(0x0FB2B73CFCull),X(0x15F6D00A9Aull),X(0x1C3785C79Eull),X(0x2273E19DB5ull),X(0x28AAED6252ull),X(0x2EDBB3BCA1ull), \
+	X(0x3505404B60ull),X(0x3B269FCA8Aull),X(0x413EE038DFull),X(0x474D10FD33ull),X(0x4D50430B86ull),X(0x53478909E3ull),X(0x5931F774FCull),X(0x5F0EA4C477ull), \
+	X(0x64DCA98EF2ull),X(0x6A9B20ADB4ull),X(0x7049276004ull),X(0x75E5DD6E1Bull),X(0x7B70654BBDull),X(0x80E7E43A61ull),X(0x864B826AECull),X(0x8B9A6B1EF6ull), \
+	X(0x90D3CCC99Full),X(0x95F6D92FD7ull),X(0x9B02C58832ull),X(0x9FF6CA9A2Aull),X(0xA4D224DCD8ull),X(0xA99414951Aull),X(0xAE3BDDF328ull),X(0xB2C8C92F83ull), \
+	X(0xB73A22A755ull),X(0xBB8F3AF81Bull),X(0xBFC7671AB8ull),X(0xC3E2007DD1ull),X(0xC7DE651F7Cull),X(0xCBBBF7A63Eull),X(0xCF7A1F794Dull),X(0xD31848D817ull), \
+	X(0xD695E4F10Eull),X(0xD9F269F7AAull),X(0xDD2D5339ACull),X(0xE046213392ull),X(0xE33C59A443ull),X(0xE60F879FE7ull),X(0xE8BF3BA1F1ull),X(0xEB4B0B9E4Full), \
+	X(0xEDB29311C5ull),X(0xEFF573116Dull),X(0xF21352595Eull),X(0xF40BDD5A66ull),X(0xF5DEC646F8ull),X(0xF78BC51F23ull),X(0xF91297BBB1ull),X(0xFA7301D859ull), \
 	X(0xFBACCD1D09ull),X(0xFCBFC92648ull),X(0xFDABCB8CAEull),X(0xFE70AFEB6Dull),X(0xFF0E57E5EAull),X(0xFF84AB2C73ull),X(0xFFD3977FF7ull),X(0xFFFB10B4DCull),
-	X(0x01921F0FE6ull),X(0x04B64DAEF8ull),X(0x07DA4DCC74ull),X(0x0AFE006948ull),X(0x0E21468960ull),X(0x11440134D7ull),X(0x1466117927ull),X(0x1787586A5Dull),
-	X(0x1AA7B72449ull),X(0x1DC70ECBAEull),X(0x20E5408F75ull),X(0x24022DA9D8ull),X(0x271DB7619Bull),X(0x2A37BF0B2Full),X(0x2D502609ECull),X(0x3066CDD138ull),
-	X(0x337B97E5B8ull),X(0x368E65DE7Aull),X(0x399F196625ull),X(0x3CAD943C20ull),X(0x3FB9B835BFull),X(0x42C3673F6Full),X(0x45CA835DD9ull),X(0x48CEEEAF0Eull),
-	X(0x4BD08B6BB0ull),X(0x4ECF3BE810ull),X(0x51CAE2955Cull),X(0x54C36202BCull),X(0x57B89CDE7Aull),X(0x5AAA75F71Dull),X(0x5D98D03C90ull),X(0x60838EC13Aull),
-	X(0x636A94BB22ull),X(0x664DC58506ull),X(0x692D049F7Aull),X(0x6C0835B1FDull),X(0x6EDF3C8C12ull),X(0x71B1FD265Cull),X(0x74805BA3A7ull),X(0x774A3C5207ull),
-	X(0x7A0F83ABE1ull),X(0x7CD01658FFull),X(0x7F8BD92F9Cull),X(0x8242B13571ull),X(0x84F483A0BEull),X(0x87A135D954ull),X(0x8A48AD799Bull),X(0x8CEAD04F95ull),
-	X(0x8F87845DE4ull),X(0x921EAFDCC5ull),X(0x94B0393B14ull),X(0x973C071F47ull),X(0x99C2006864ull),X(0x9C420C2EFFull),X(0x9EBC11C62Cull),X(0xA12FF8BC73ull),
-	X(0xA39DA8DCC3ull),X(0xA6050A2F60ull),X(0xA86604FACDull),X(0xAAC081C4BAull),X(0xAD146952EBull),X(0xAF61A4AC1Bull),X(0xB1A81D18E0ull),X(0xB3E7BC248Dull),
-	X(0xB6206B9E0Cull),X(0xB8521598BBull),X(0xBA7CA46D46ull),X(0xBCA002BA7Aull),X(0xBEBC1B6619ull),X(0xC0D0D99DABull),X(0xC2DE28D74Aull),X(0xC4E3F4D26Eull),
-	X(0xC6E22998B4ull),X(0xC8D8B37EA4ull),X(0xCAC77F2473ull),X(0xCCAE7976C0ull),X(0xCE8D8FAF54ull),X(0xD064AF55D7ull),X(0xD233C6408Cull),X(0xD3FAC294FFull),
-	X(0xD5B992C8B6ull),X(0xD77025A1E0ull),X(0xD91E6A3800ull),X(0xDAC44FF490ull),X(0xDC61C693A8ull),X(0xDDF6BE249Cull),X(0xDF83270A9Bull),X(0xE106F1FD4Bull),
-	X(0xE28210095Bull),X(0xE3F4729119ull),X(0xE55E0B4D05ull),X(0xE6BECC4C59ull),X(0xE816A7F595ull),X(0xE965910707ull),X(0xEAAB7A9749ull),X(0xEBE85815C7ull),
-	X(0xED1C1D4B34ull),X(0xEE46BE5A08ull),X(0xEF682FBEF2ull),X(0xF08066514Cull),X(0xF18F574386ull),X(0xF294F82394ull),X(0xF3913EDB54ull),X(0xF48421B0EFull),
-	X(0xF56D97473Dull),X(0xF64D969E1Dull),X(0xF7241712D4ull),X(0xF7F110605Cull),X(0xF8B47A9FB9ull),X(0xF96E4E4844ull),X(0xFA1E842FFCull),X(0xFAC5158BC4ull),
-	X(0xFB61FBEFADull),X(0xFBF5314F31ull),X(0xFC7EAFFD72ull),X(0xFCFE72AD6Dull),X(0xFD74747236ull),X(0xFDE0B0BF22ull),X(0xFE432367F5ull),X(0xFE9BC8A110ull),
+#else
+# define FOURIER_SINTABLE_VALUES_64(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 128
+# define FOURIER_SINTABLE_VALUES_128(X) \
+	X(0x01921F0FE6ull),X(0x04B64DAEF8ull),X(0x07DA4DCC74ull),X(0x0AFE006948ull),X(0x0E21468960ull),X(0x11440134D7ull),X(0x1466117927ull),X(0x1787586A5Dull), \
+	X(0x1AA7B72449ull),X(0x1DC70ECBAEull),X(0x20E5408F75ull),X(0x24022DA9D8ull),X(0x271DB7619Bull),X(0x2A37BF0B2Full),X(0x2D502609ECull),X(0x3066CDD138ull), \
+	X(0x337B97E5B8ull),X(0x368E65DE7Aull),X(0x399F196625ull),X(0x3CAD943C20ull),X(0x3FB9B835BFull),X(0x42C3673F6Full),X(0x45CA835DD9ull),X(0x48CEEEAF0Eull), \
+	X(0x4BD08B6BB0ull),X(0x4ECF3BE810ull),X(0x51CAE2955Cull),X(0x54C36202BCull),X(0x57B89CDE7Aull),X(0x5AAA75F71Dull),X(0x5D98D03C90ull),X(0x60838EC13Aull), \
+	X(0x636A94BB22ull),X(0x664DC58506ull),X(0x692D049F7Aull),X(0x6C0835B1FDull),X(0x6EDF3C8C12ull),X(0x71B1FD265Cull),X(0x74805BA3A7ull),X(0x774A3C5207ull), \
+	X(0x7A0F83ABE1ull),X(0x7CD01658FFull),X(0x7F8BD92F9Cull),X(0x8242B13571ull),X(0x84F483A0BEull),X(0x87A135D954ull),X(0x8A48AD799Bull),X(0x8CEAD04F95ull), \
+	X(0x8F87845DE4ull),X(0x921EAFDCC5ull),X(0x94B0393B14ull),X(0x973C071F47ull),X(0x99C2006864ull),X(0x9C420C2EFFull),X(0x9EBC11C62Cull),X(0xA12FF8BC73ull), \
+	X(0xA39DA8DCC3ull),X(0xA6050A2F60ull),X(0xA86604FACDull),X(0xAAC081C4BAull),X(0xAD146952EBull),X(0xAF61A4AC1Bull),X(0xB1A81D18E0ull),X(0xB3E7BC248Dull), \
+	X(0xB6206B9E0Cull),X(0xB8521598BBull),X(0xBA7CA46D46ull),X(0xBCA002BA7Aull),X(0xBEBC1B6619ull),X(0xC0D0D99DABull),X(0xC2DE28D74Aull),X(0xC4E3F4D26Eull), \
+	X(0xC6E22998B4ull),X(0xC8D8B37EA4ull),X(0xCAC77F2473ull),X(0xCCAE7976C0ull),X(0xCE8D8FAF54ull),X(0xD064AF55D7ull),X(0xD233C6408Cull),X(0xD3FAC294FFull), \
+	X(0xD5B992C8B6ull),X(0xD77025A1E0ull),X(0xD91E6A3800ull),X(0xDAC44FF490ull),X(0xDC61C693A8ull),X(0xDDF6BE249Cull),X(0xDF83270A9Bull),X(0xE106F1FD4Bull), \
+	X(0xE28210095Bull),X(0xE3F4729119ull),X(0xE55E0B4D05ull),X(0xE6BECC4C59ull),X(0xE816A7F595ull),X(0xE965910707ull),X(0xEAAB7A9749ull),X(0xEBE85815C7ull), \
+	X(0xED1C1D4B34ull),X(0xEE46BE5A08ull),X(0xEF682FBEF2ull),X(0xF08066514Cull),X(0xF18F574386ull),X(0xF294F82394ull),X(0xF3913EDB54ull),X(0xF48421B0EFull), \
+	X(0xF56D97473Dull),X(0xF64D969E1Dull),X(0xF7241712D4ull),X(0xF7F110605Cull),X(0xF8B47A9FB9ull),X(0xF96E4E4844ull),X(0xFA1E842FFCull),X(0xFAC5158BC4ull), \
+	X(0xFB61FBEFADull),X(0xFBF5314F31ull),X(0xFC7EAFFD72ull),X(0xFCFE72AD6Dull),X(0xFD74747236ull),X(0xFDE0B0BF22ull),X(0xFE432367F5ull),X(0xFE9BC8A110ull), \
 	X(0xFEEA9CFF8Full),X(0xFF2F9D7971ull),X(0xFF6AC765B3ull),X(0xFF9C187C6Aull),X(0xFFC38ED6DCull),X(0xFFE128EF8Eull),X(0xFFF4E5A25Aull),X(0xFFFEC42C74ull),
-	X(0x00C90FC5F6ull),X(0x025B2D61CAull),X(0x03ED452D57ull),X(0x057F53487Eull),X(0x071153D339ull),X(0x08A342EDA1ull),X(0x0A351CB7FCull),X(0x0BC6DD52C3ull),
-	X(0x0D5880DEAFull),X(0x0EEA037CC0ull),X(0x107B614E46ull),X(0x120C9674EDull),X(0x139D9F12C5ull),X(0x152E774A4Dull),X(0x16BF1B3E79ull),X(0x184F8712C1ull),
-	X(0x19DFB6EB24ull),X(0x1B6FA6EC38ull),X(0x1CFF533B30ull),X(0x1E8EB7FDE4ull),X(0x201DD15ADFull),X(0x21AC9B7964ull),X(0x233B12817Cull),X(0x24C9329BFAull),
-	X(0x2656F7F28Aull),X(0x27E45EAFB6ull),X(0x297162FEF3ull),X(0x2AFE010CA9ull),X(0x2C8A35063Bull),X(0x2E15FB1A11ull),X(0x2FA14F77A5ull),X(0x312C2E4F88ull),
-	X(0x32B693D36Cull),X(0x34407C3630ull),X(0x35C9E3ABE7ull),X(0x3752C669E2ull),X(0x38DB20A6BAull),X(0x3A62EE9A59ull),X(0x3BEA2C7E02ull),X(0x3D70D68C5Bull),
-	X(0x3EF6E9017Aull),X(0x407C601AE7ull),X(0x42013817ADull),X(0x43856D385Dull),X(0x4508FBBF1Aull),X(0x468BDFEFA3ull),X(0x480E160F5Cull),X(0x498F9A6555ull),
-	X(0x4B10693A55ull),X(0x4C907ED8E2ull),X(0x4E0FD78D4Eull),X(0x4F8E6FA5BBull),X(0x510C437224ull),X(0x52894F446Eull),X(0x54058F7065ull),X(0x5581004BD1ull),
-	X(0x56FB9E2E76ull),X(0x5875657223ull),X(0x59EE5272B5ull),X(0x5B66618E28ull),X(0x5CDD8F2498ull),X(0x5E53D7984Full),X(0x5FC9374DCDull),X(0x613DAAABCEull),
-	X(0x62B12E1B57ull),X(0x6423BE07BDull),X(0x659556DEAEull),X(0x6705F51037ull),X(0x6875950ED4ull),X(0x69E4334F6Full),X(0x6B51CC4973ull),X(0x6CBE5C76CCull),
-	X(0x6E29E053F5ull),X(0x6F94545FFFull),X(0x70FDB51C98ull),X(0x7265FF0E19ull),X(0x73CD2EBB87ull),X(0x753340AEA1ull),X(0x76983173E8ull),X(0x77FBFD9AA5ull),
-	X(0x795EA1B4F3ull),X(0x7AC01A57C9ull),X(0x7C20641AFFull),X(0x7D7F7B995Bull),X(0x7EDD5D7093ull),X(0x803A06415Cull),X(0x819572AF6Dull),X(0x82EF9F618Dull),
-	X(0x8448890195ull),X(0x85A02C3C7Cull),X(0x86F685C25Eull),X(0x884B924685ull),X(0x899F4E7F71ull),X(0x8AF1B726DFull),X(0x8C42C8F9D2ull),X(0x8D9280B89Bull),
-	X(0x8EE0DB26E2ull),X(0x902DD50BABull),X(0x91796B3160ull),X(0x92C39A65DBull),X(0x940C5F7A69ull),X(0x9553B743D7ull),X(0x96999E9A74ull),X(0x97DE125A20ull),
-	X(0x99210F624Dull),X(0x9A6292960Aull),X(0x9BA298DC0Bull),X(0x9CE11F1EB1ull),X(0x9E1E224C0Eull),X(0x9F599F55F0ull),X(0xA0939331E8ull),X(0xA1CBFAD952ull),
-	X(0xA302D34959ull),X(0xA438198304ull),X(0xA56BCA8B39ull),X(0xA69DE36AC4ull),X(0xA7CE612E65ull),X(0xA8FD40E6CCull),X(0xAA2A7FA8ACull),X(0xAB561A8CBBull),
-	X(0xAC800EAFB9ull),X(0xADA859327Bull),X(0xAECEF739F1ull),X(0xAFF3E5EF2Bull),X(0xB117227F61ull),X(0xB238AA1BFAull),X(0xB35879FA95ull),X(0xB4768F550Cull),
-	X(0xB592E7697Full),X(0xB6AD7F7A55ull),X(0xB7C654CE4Aull),X(0xB8DD64B072ull),X(0xB9F2AC703Cull),X(0xBB06296182ull),X(0xBC17D8DC85ull),X(0xBD27B83DFCull),
-	X(0xBE35C4E716ull),X(0xBF41FC3D81ull),X(0xC04C5BAB72ull),X(0xC154E09FAAull),X(0xC25B888D7Cull),X(0xC36050ECD5ull),X(0xC463373A40ull),X(0xC56438F6F0ull),
-	X(0xC66353A8C2ull),X(0xC76084DA43ull),X(0xC85BCA1ABAull),X(0xC95520FE2Dull),X(0xCA4C871D62ull),X(0xCB41FA15EBull),X(0xCC35778A2Bull),X(0xCD26FD2158ull),
-	X(0xCE16888783ull),X(0xCF04176DA1ull),X(0xCFEFA7898Aull),X(0xD0D9369605ull),X(0xD1C0C252C9ull),X(0xD2A6488487ull),X(0xD389C6F4EBull),X(0xD46B3B72A2ull),
-	X(0xD54AA3D165ull),X(0xD627FDE9F7ull),X(0xD703479A2Full),X(0xD7DC7EC4FAull),X(0xD8B3A15265ull),X(0xD988AD2F9Bull),X(0xDA5BA04EF3ull),X(0xDB2C78A7EDull),
-	X(0xDBFB34373Cull),X(0xDCC7D0FEC8ull),X(0xDD924D05B6ull),X(0xDE5AA65869ull),X(0xDF20DB088Aull),X(0xDFE4E92D0Dull),X(0xE0A6CEE232ull),X(0xE1668A498Full),
-	X(0xE224198A0Eull),X(0xE2DF7ACFF7ull),X(0xE398AC4CF5ull),X(0xE44FAC3814ull),X(0xE50478CDCEull),X(0xE5B7105006ull),X(0xE667710616ull),X(0xE715993CCDull),
-	X(0xE7C1874672ull),X(0xE86B397ACEull),X(0xE912AE372Dull),X(0xE9B7E3DE5Full),X(0xEA5AD8D8C3ull),X(0xEAFB8B9444ull),X(0xEB99FA8460ull),X(0xEC3624222Dull),
-	X(0xECD006EC59ull),X(0xED67A16734ull),X(0xEDFCF21CABull),X(0xEE8FF79C54ull),X(0xEF20B07B6Cull),X(0xEFAF1B54DDull),X(0xF03B36C940ull),X(0xF0C5017EE3ull),
-	X(0xF14C7A21C8ull),X(0xF1D19F63AEull),X(0xF2546FFC0Eull),X(0xF2D4EAA823ull),X(0xF3530E2AEAull),X(0xF3CED94D28ull),X(0xF4484ADD6Bull),X(0xF4BF61B00Bull),
-	X(0xF5341C9F32ull),X(0xF5A67A8ADCull),X(0xF6167A58D7ull),X(0xF6841AF4CCull),X(0xF6EF5B503Cull),X(0xF7583A6285ull),X(0xF7BEB728E5ull),X(0xF822D0A67Bull),
-	X(0xF88485E44Cull),X(0xF8E3D5F142ull),X(0xF940BFE230ull),X(0xF99B42D1D5ull),X(0xF9F35DE0DDull),X(0xFA491035E5ull),X(0xFA9C58FD79ull),X(0xFAED376A1Bull),
-	X(0xFB3BAAB441ull),X(0xFB87B21A5Bull),X(0xFBD14CE0D1ull),X(0xFC187A5206ull),X(0xFC5D39BE5Aull),X(0xFC9F8A7C2Dull),X(0xFCDF6BE7DEull),X(0xFD1CDD63D0ull),
-	X(0xFD57DE5867ull),X(0xFD906E340Eull),X(0xFDC68C6B35ull),X(0xFDFA387854ull),X(0xFE2B71DBECull),X(0xFE5A381C8Aull),X(0xFE868AC6C3ull),X(0xFEB0696D3Aull),
-	X(0xFED7D3A8A2ull),X(0xFEFCC917B9ull),X(0xFF1F495F4Eull),X(0xFF3F542A41ull),X(0xFF5CE92982ull),X(0xFF78081413ull),X(0xFF90B0A709ull),X(0xFFA6E2A58Dull),
+#else
+# define FOURIER_SINTABLE_VALUES_128(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 256
+# define FOURIER_SINTABLE_VALUES_256(X) \
+	X(0x00C90FC5F6ull),X(0x025B2D61CAull),X(0x03ED452D57ull),X(0x057F53487Eull),X(0x071153D339ull),X(0x08A342EDA1ull),X(0x0A351CB7FCull),X(0x0BC6DD52C3ull), \
+	X(0x0D5880DEAFull),X(0x0EEA037CC0ull),X(0x107B614E46ull),X(0x120C9674EDull),X(0x139D9F12C5ull),X(0x152E774A4Dull),X(0x16BF1B3E79ull),X(0x184F8712C1ull), \
+	X(0x19DFB6EB24ull),X(0x1B6FA6EC38ull),X(0x1CFF533B30ull),X(0x1E8EB7FDE4ull),X(0x201DD15ADFull),X(0x21AC9B7964ull),X(0x233B12817Cull),X(0x24C9329BFAull), \
+	X(0x2656F7F28Aull),X(0x27E45EAFB6ull),X(0x297162FEF3ull),X(0x2AFE010CA9ull),X(0x2C8A35063Bull),X(0x2E15FB1A11ull),X(0x2FA14F77A5ull),X(0x312C2E4F88ull), \
+	X(0x32B693D36Cull),X(0x34407C3630ull),X(0x35C9E3ABE7ull),X(0x3752C669E2ull),X(0x38DB20A6BAull),X(0x3A62EE9A59ull),X(0x3BEA2C7E02ull),X(0x3D70D68C5Bull), \
+	X(0x3EF6E9017Aull),X(0x407C601AE7ull),X(0x42013817ADull),X(0x43856D385Dull),X(0x4508FBBF1Aull),X(0x468BDFEFA3ull),X(0x480E160F5Cull),X(0x498F9A6555ull), \
+	X(0x4B10693A55ull),X(0x4C907ED8E2ull),X(0x4E0FD78D4Eull),X(0x4F8E6FA5BBull),X(0x510C437224ull),X(0x52894F446Eull),X(0x54058F7065ull),X(0x5581004BD1ull), \
+	X(0x56FB9E2E76ull),X(0x5875657223ull),X(0x59EE5272B5ull),X(0x5B66618E28ull),X(0x5CDD8F2498ull),X(0x5E53D7984Full),X(0x5FC9374DCDull),X(0x613DAAABCEull), \
+	X(0x62B12E1B57ull),X(0x6423BE07BDull),X(0x659556DEAEull),X(0x6705F51037ull),X(0x6875950ED4ull),X(0x69E4334F6Full),X(0x6B51CC4973ull),X(0x6CBE5C76CCull), \
+	X(0x6E29E053F5ull),X(0x6F94545FFFull),X(0x70FDB51C98ull),X(0x7265FF0E19ull),X(0x73CD2EBB87ull),X(0x753340AEA1ull),X(0x76983173E8ull),X(0x77FBFD9AA5ull), \
+	X(0x795EA1B4F3ull),X(0x7AC01A57C9ull),X(0x7C20641AFFull),X(0x7D7F7B995Bull),X(0x7EDD5D7093ull),X(0x803A06415Cull),X(0x819572AF6Dull),X(0x82EF9F618Dull), \
+	X(0x8448890195ull),X(0x85A02C3C7Cull),X(0x86F685C25Eull),X(0x884B924685ull),X(0x899F4E7F71ull),X(0x8AF1B726DFull),X(0x8C42C8F9D2ull),X(0x8D9280B89Bull), \
+	X(0x8EE0DB26E2ull),X(0x902DD50BABull),X(0x91796B3160ull),X(0x92C39A65DBull),X(0x940C5F7A69ull),X(0x9553B743D7ull),X(0x96999E9A74ull),X(0x97DE125A20ull), \
+	X(0x99210F624Dull),X(0x9A6292960Aull),X(0x9BA298DC0Bull),X(0x9CE11F1EB1ull),X(0x9E1E224C0Eull),X(0x9F599F55F0ull),X(0xA0939331E8ull),X(0xA1CBFAD952ull), \
+	X(0xA302D34959ull),X(0xA438198304ull),X(0xA56BCA8B39ull),X(0xA69DE36AC4ull),X(0xA7CE612E65ull),X(0xA8FD40E6CCull),X(0xAA2A7FA8ACull),X(0xAB561A8CBBull), \
+	X(0xAC800EAFB9ull),X(0xADA859327Bull),X(0xAECEF739F1ull),X(0xAFF3E5EF2Bull),X(0xB117227F61ull),X(0xB238AA1BFAull),X(0xB35879FA95ull),X(0xB4768F550Cull), \
+	X(0xB592E7697Full),X(0xB6AD7F7A55ull),X(0xB7C654CE4Aull),X(0xB8DD64B072ull),X(0xB9F2AC703Cull),X(0xBB06296182ull),X(0xBC17D8DC85ull),X(0xBD27B83DFCull), \
+	X(0xBE35C4E716ull),X(0xBF41FC3D81ull),X(0xC04C5BAB72ull),X(0xC154E09FAAull),X(0xC25B888D7Cull),X(0xC36050ECD5ull),X(0xC463373A40ull),X(0xC56438F6F0ull), \
+	X(0xC66353A8C2ull),X(0xC76084DA43ull),X(0xC85BCA1ABAull),X(0xC95520FE2Dull),X(0xCA4C871D62ull),X(0xCB41FA15EBull),X(0xCC35778A2Bull),X(0xCD26FD2158ull), \
+	X(0xCE16888783ull),X(0xCF04176DA1ull),X(0xCFEFA7898Aull),X(0xD0D9369605ull),X(0xD1C0C252C9ull),X(0xD2A6488487ull),X(0xD389C6F4EBull),X(0xD46B3B72A2ull), \
+	X(0xD54AA3D165ull),X(0xD627FDE9F7ull),X(0xD703479A2Full),X(0xD7DC7EC4FAull),X(0xD8B3A15265ull),X(0xD988AD2F9Bull),X(0xDA5BA04EF3ull),X(0xDB2C78A7EDull), \
+	X(0xDBFB34373Cull),X(0xDCC7D0FEC8ull),X(0xDD924D05B6ull),X(0xDE5AA65869ull),X(0xDF20DB088Aull),X(0xDFE4E92D0Dull),X(0xE0A6CEE232ull),X(0xE1668A498Full), \
+	X(0xE224198A0Eull),X(0xE2DF7ACFF7ull),X(0xE398AC4CF5ull),X(0xE44FAC3814ull),X(0xE50478CDCEull),X(0xE5B7105006ull),X(0xE667710616ull),X(0xE715993CCDull), \
+	X(0xE7C1874672ull),X(0xE86B397ACEull),X(0xE912AE372Dull),X(0xE9B7E3DE5Full),X(0xEA5AD8D8C3ull),X(0xEAFB8B9444ull),X(0xEB99FA8460ull),X(0xEC3624222Dull), \
+	X(0xECD006EC59ull),X(0xED67A16734ull),X(0xEDFCF21CABull),X(0xEE8FF79C54ull),X(0xEF20B07B6Cull),X(0xEFAF1B54DDull),X(0xF03B36C940ull),X(0xF0C5017EE3ull), \
+	X(0xF14C7A21C8ull),X(0xF1D19F63AEull),X(0xF2546FFC0Eull),X(0xF2D4EAA823ull),X(0xF3530E2AEAull),X(0xF3CED94D28ull),X(0xF4484ADD6Bull),X(0xF4BF61B00Bull), \
+	X(0xF5341C9F32ull),X(0xF5A67A8ADCull),X(0xF6167A58D7ull),X(0xF6841AF4CCull),X(0xF6EF5B503Cull),X(0xF7583A6285ull),X(0xF7BEB728E5ull),X(0xF822D0A67Bull), \
+	X(0xF88485E44Cull),X(0xF8E3D5F142ull),X(0xF940BFE230ull),X(0xF99B42D1D5ull),X(0xF9F35DE0DDull),X(0xFA491035E5ull),X(0xFA9C58FD79ull),X(0xFAED376A1Bull), \
+	X(0xFB3BAAB441ull),X(0xFB87B21A5Bull),X(0xFBD14CE0D1ull),X(0xFC187A5206ull),X(0xFC5D39BE5Aull),X(0xFC9F8A7C2Dull),X(0xFCDF6BE7DEull),X(0xFD1CDD63D0ull), \
+	X(0xFD57DE5867ull),X(0xFD906E340Eull),X(0xFDC68C6B35ull),X(0xFDFA387854ull),X(0xFE2B71DBECull),X(0xFE5A381C8Aull),X(0xFE868AC6C3ull),X(0xFEB0696D3Aull), \
+	X(0xFED7D3A8A2ull),X(0xFEFCC917B9ull),X(0xFF1F495F4Eull),X(0xFF3F542A41ull),X(0xFF5CE92982ull),X(0xFF78081413ull),X(0xFF90B0A709ull),X(0xFFA6E2A58Dull), \
 	X(0xFFBA9DD8DCull),X(0xFFCBE21046ull),X(0xFFDAAF212Full),X(0xFFE704E715ull),X(0xFFF0E34386ull),X(0xFFF84A1E29ull),X(0xFFFD3964BCull),X(0xFFFFB10B10ull),
-	X(0x006487EABBull),X(0x012D97822Full),X(0x01F6A65F9Aull),X(0x02BFB406F5ull),X(0x0388BFFC3Cull),X(0x0451C9C36Bull),X(0x051AD0E07Full),X(0x05E3D4D777ull),
-	X(0x06ACD52C54ull),X(0x0775D16319ull),X(0x083EC8FFCCull),X(0x0907BB8675ull),X(0x09D0A87B21ull),X(0x0A998F61DDull),X(0x0B626FBEBEull),X(0x0C2B4915DAull),
-	X(0x0CF41AEB4Cull),X(0x0DBCE4C334ull),X(0x0E85A621B7ull),X(0x0F4E5E8AFFull),X(0x10170D833Bull),X(0x10DFB28EA2ull),X(0x11A84D316Dull),X(0x1270DCEFDFull),
-	X(0x1339614E41ull),X(0x1401D9D0E3ull),X(0x14CA45FC1Bull),X(0x1592A55448ull),X(0x165AF75DD0ull),X(0x17233B9D23ull),X(0x17EB7196B7ull),X(0x18B398CF0Cull),
-	X(0x197BB0CAABull),X(0x1A43B90E27ull),X(0x1B0BB11E1Dull),X(0x1BD3987F31ull),X(0x1C9B6EB616ull),X(0x1D63334785ull),X(0x1E2AE5B845ull),X(0x1EF2858D27ull),
-	X(0x1FBA124B07ull),X(0x20818B76CEull),X(0x2148F09571ull),X(0x2210412BF0ull),X(0x22D77CBF58ull),X(0x239EA2D4C5ull),X(0x2465B2F15Dull),X(0x252CAC9A57ull),
-	X(0x25F38F54F4ull),X(0x26BA5AA688ull),X(0x27810E1470ull),X(0x2847A9241Cull),X(0x290E2B5B09ull),X(0x29D4943EC4ull),X(0x2A9AE354E9ull),X(0x2B61182325ull),
-	X(0x2C27322F34ull),X(0x2CED30FEE4ull),X(0x2DB3141811ull),X(0x2E78DB00ABull),X(0x2F3E853EB3ull),X(0x300412583Aull),X(0x30C981D365ull),X(0x318ED33669ull),
-	X(0x3254060790ull),X(0x331919CD34ull),X(0x33DE0E0DC6ull),X(0x34A2E24FC7ull),X(0x35679619CDull),X(0x362C28F283ull),X(0x36F09A60A6ull),X(0x37B4E9EB0Aull),
-	X(0x3879171897ull),X(0x393D217049ull),X(0x3A01087933ull),X(0x3AC4CBBA7Eull),X(0x3B886ABB68ull),X(0x3C4BE50345ull),X(0x3D0F3A1981ull),X(0x3DD26985A0ull),
-	X(0x3E9572CF39ull),X(0x3F58557DFEull),X(0x401B1119B9ull),X(0x40DDA52A4Aull),X(0x41A01137AAull),X(0x426254C9EDull),X(0x43246F693Cull),X(0x43E6609DDCull),
-	X(0x44A827F02Cull),X(0x4569C4E8A2ull),X(0x462B370FD2ull),X(0x46EC7DEE66ull),X(0x47AD990D26ull),X(0x486E87F4F4ull),X(0x492F4A2ECDull),X(0x49EFDF43CBull),
-	X(0x4AB046BD20ull),X(0x4B7080241Full),X(0x4C308B0235ull),X(0x4CF066E0EBull),X(0x4DB01349E9ull),X(0x4E6F8FC6F2ull),X(0x4F2EDBE1E8ull),X(0x4FEDF724CBull),
-	X(0x50ACE119B8ull),X(0x516B994AECull),X(0x522A1F42C1ull),X(0x52E8728BB2ull),X(0x53A692B057ull),X(0x54647F3B68ull),X(0x552237B7BFull),X(0x55DFBBB054ull),
-	X(0x569D0AB03Full),X(0x575A2442BBull),X(0x581707F322ull),X(0x58D3B54CEFull),X(0x59902BDBC0ull),X(0x5A4C6B2B55ull),X(0x5B0872C78Eull),X(0x5BC4423C6Full),
-	X(0x5C7FD9161Eull),X(0x5D3B36E0E4ull),X(0x5DF65B292Dull),X(0x5EB1457B8Aull),X(0x5F6BF564AEull),X(0x60266A7170ull),X(0x60E0A42ECDull),X(0x619AA229E4ull),
-	X(0x625463EFFCull),X(0x630DE90E7Eull),X(0x63C73112FAull),X(0x64803B8B26ull),X(0x65390804DEull),X(0x65F1960E24ull),X(0x66A9E5351Full),X(0x6761F5081Eull),
-	X(0x6819C51599ull),X(0x68D154EC2Bull),X(0x6988A41A9Cull),X(0x6A3FB22FD6ull),X(0x6AF67EBAF0ull),X(0x6BAD094B28ull),X(0x6C63516FE2ull),X(0x6D1956B8AFull),
-	X(0x6DCF18B548ull),X(0x6E8496F58Dull),X(0x6F39D1098Bull),X(0x6FEEC68178ull),X(0x70A376EDB3ull),X(0x7157E1DEC8ull),X(0x720C06E56Dull),X(0x72BFE59281ull),
-	X(0x73737D7711ull),X(0x7426CE2454ull),X(0x74D9D72BAFull),X(0x758C981EB2ull),X(0x763F108F18ull),X(0x76F1400ECBull),X(0x77A3262FE1ull),X(0x7854C2849Dull),
-	X(0x7906149F71ull),X(0x79B71C12FAull),X(0x7A67D87205ull),X(0x7B18494F8Full),X(0x7BC86E3EBFull),X(0x7C7846D2EFull),X(0x7D27D29FA5ull),X(0x7DD711389Aull),
-	X(0x7E860231B3ull),X(0x7F34A51F07ull),X(0x7FE2F994DDull),X(0x8090FF27ABull),X(0x813EB56C19ull),X(0x81EC1BF6FFull),X(0x8299325D68ull),X(0x8345F8348Eull),
-	X(0x83F26D11DEull),X(0x849E908AF7ull),X(0x854A6235A9ull),X(0x85F5E1A7FAull),X(0x86A10E781Eull),X(0x874BE83C7Eull),X(0x87F66E8BB8ull),X(0x88A0A0FC9Aull),
-	X(0x894A7F2629ull),X(0x89F4089F9Cull),X(0x8A9D3D005Full),X(0x8B461BE012ull),X(0x8BEEA4D68Bull),X(0x8C96D77BD2ull),X(0x8D3EB36828ull),X(0x8DE6383402ull),
-	X(0x8E8D657809ull),X(0x8F343ACD1Full),X(0x8FDAB7CC59ull),X(0x9080DC0F06ull),X(0x9126A72EAAull),X(0x91CC18C4FEull),X(0x9271306BF7ull),X(0x9315EDBDBCull),
-	X(0x93BA5054B0ull),X(0x945E57CB6Cull),X(0x950203BCC2ull),X(0x95A553C3BBull),X(0x9648477B9Aull),X(0x96EADE7FDBull),X(0x978D186C33ull),X(0x982EF4DC90ull),
-	X(0x98D0736D1Aull),X(0x997193BA33ull),X(0x9A12556077ull),X(0x9AB2B7FCBCull),X(0x9B52BB2C14ull),X(0x9BF25E8BC9ull),X(0x9C91A1B963ull),X(0x9D308452A5ull),
-	X(0x9DCF05F58Cull),X(0x9E6D264053ull),X(0x9F0AE4D16Dull),X(0x9FA841478Full),X(0xA0453B41A6ull),X(0xA0E1D25EDDull),X(0xA17E063E9Dull),X(0xA219D6808Bull),
-	X(0xA2B542C48Bull),X(0xA3504AAABDull),X(0xA3EAEDD37Eull),X(0xA4852BDF6Dull),X(0xA51F046F64ull),X(0xA5B877247Dull),X(0xA65183A010ull),X(0xA6EA2983B5ull),
-	X(0xA782687142ull),X(0xA81A400ACEull),X(0xA8B1AFF2B0ull),X(0xA948B7CB7Cull),X(0xA9DF573809ull),X(0xAA758DDB6Eull),X(0xAB0B5B5902ull),X(0xABA0BF545Dull),
-	X(0xAC35B97159ull),X(0xACCA49540Full),X(0xAD5E6EA0DDull),X(0xADF228FC5Full),X(0xAE85780B76ull),X(0xAF185B7343ull),X(0xAFAAD2D92Bull),X(0xB03CDDE2D5ull),
-	X(0xB0CE7C362Aull),X(0xB15FAD7958ull),X(0xB1F07152CEull),X(0xB280C76941ull),X(0xB310AF63A7ull),X(0xB3A028E93Cull),X(0xB42F33A17Full),X(0xB4BDCF3434ull),
-	X(0xB54BFB4964ull),X(0xB5D9B7895Aull),X(0xB667039CABull),X(0xB6F3DF2C2Cull),X(0xB78049E0FAull),X(0xB80C436478ull),X(0xB897CB604Eull),X(0xB922E17E6Aull),
-	X(0xB9AD856900ull),X(0xBA37B6CA8Bull),X(0xBAC1754DCDull),X(0xBB4AC09DCDull),X(0xBBD39865DCull),X(0xBC5BFC5190ull),X(0xBCE3EC0CC7ull),X(0xBD6B6743A6ull),
-	X(0xBDF26DA29Dull),X(0xBE78FED65Full),X(0xBEFF1A8BECull),X(0xBF84C07089ull),X(0xC009F031C7ull),X(0xC08EA97D7Cull),X(0xC112EC01CBull),X(0xC196B76D1Dull),
-	X(0xC21A0B6E26ull),X(0xC29CE7B3E4ull),X(0xC31F4BED9Eull),X(0xC3A137CAE6ull),X(0xC422AAFB97ull),X(0xC4A3A52FD8ull),X(0xC524261818ull),X(0xC5A42D6515ull),
-	X(0xC623BAC7D3ull),X(0xC6A2CDF1A5ull),X(0xC721669429ull),X(0xC79F846146ull),X(0xC81D270B32ull),X(0xC89A4E446Dull),X(0xC916F9BFC3ull),X(0xC99329304Dull),
-	X(0xCA0EDC4971ull),X(0xCA8A12BEE2ull),X(0xCB04CC449Dull),X(0xCB7F088EEFull),X(0xCBF8C75272ull),X(0xCC7208440Dull),X(0xCCEACB18F3ull),X(0xCD630F86A7ull),
-	X(0xCDDAD542F9ull),X(0xCE521C0407ull),X(0xCEC8E3803Eull),X(0xCF3F2B6E5Aull),X(0xCFB4F38563ull),X(0xD02A3B7CB3ull),X(0xD09F030BF2ull),X(0xD11349EB16ull),
-	X(0xD1870FD265ull),X(0xD1FA547A77ull),X(0xD26D179C2Full),X(0xD2DF58F0C4ull),X(0xD3511831BBull),X(0xD3C25518E9ull),X(0xD4330F6077ull),X(0xD4A346C2D9ull),
-	X(0xD512FAFAD7ull),X(0xD5822BC38Aull),X(0xD5F0D8D85Cull),X(0xD65F01F507ull),X(0xD6CCA6D597ull),X(0xD739C7366Aull),X(0xD7A662D42Full),X(0xD812796BE9ull),
-	X(0xD87E0ABAE9ull),X(0xD8E9167ED6ull),X(0xD9539C75A8ull),X(0xD9BD9C5DAAull),X(0xDA2715F578ull),X(0xDA9008FC02ull),X(0xDAF875308Dull),X(0xDB605A52ADull),
-	X(0xDBC7B8224Dull),X(0xDC2E8E5FA9ull),X(0xDC94DCCB52ull),X(0xDCFAA3262Dull),X(0xDD5FE13173ull),X(0xDDC496AEAEull),X(0xDE28C35FC1ull),X(0xDE8C6706E0ull),
-	X(0xDEEF816695ull),X(0xDF521241BEull),X(0xDFB4195B8Full),X(0xE01596778Full),X(0xE07689599Bull),X(0xE0D6F1C5E7ull),X(0xE136CF80F9ull),X(0xE196224FB0ull),
-	X(0xE1F4E9F73Eull),X(0xE253263D2Dull),X(0xE2B0D6E75Bull),X(0xE30DFBBBFEull),X(0xE36A9481A0ull),X(0xE3C6A0FF25ull),X(0xE42220FBC2ull),X(0xE47D143F09ull),
-	X(0xE4D77A90DEull),X(0xE53153B97Eull),X(0xE58A9F817Dull),X(0xE5E35DB1C6ull),X(0xE63B8E139Bull),X(0xE693307096ull),X(0xE6EA4492A7ull),X(0xE740CA441Aull),
-	X(0xE796C14F8Dull),X(0xE7EC297FFBull),X(0xE84102A0B4ull),X(0xE8954C7D62ull),X(0xE8E906E206ull),X(0xE93C319AFAull),X(0xE98ECC74F2ull),X(0xE9E0D73CF9ull),
-	X(0xEA3251C073ull),X(0xEA833BCD1Eull),X(0xEAD3953110ull),X(0xEB235DBABAull),X(0xEB729538E4ull),X(0xEBC13B7AB0ull),X(0xEC0F504F9Cull),X(0xEC5CD3877Cull),
-	X(0xECA9C4F282ull),X(0xECF6246135ull),X(0xED41F1A47Bull),X(0xED8D2C8D90ull),X(0xEDD7D4EE0Dull),X(0xEE21EA97E5ull),X(0xEE6B6D5D65ull),X(0xEEB45D1133ull),
-	X(0xEEFCB98654ull),X(0xEF44829023ull),X(0xEF8BB80259ull),X(0xEFD259B109ull),X(0xF0186770A1ull),X(0xF05DE115ECull),X(0xF0A2C6760Dull),X(0xF0E7176686ull),
-	X(0xF12AD3BD31ull),X(0xF16DFB5048ull),X(0xF1B08DF65Dull),X(0xF1F28B865Full),X(0xF233F3D79Aull),X(0xF274C6C1B6ull),X(0xF2B5041CB4ull),X(0xF2F4ABC0F5ull),
-	X(0xF333BD8736ull),X(0xF37239488Eull),X(0xF3B01EDE73ull),X(0xF3ED6E22B6ull),X(0xF42A26EF86ull),X(0xF466491F6Eull),X(0xF4A1D48D55ull),X(0xF4DCC91482ull),
-	X(0xF517269096ull),X(0xF550ECDD90ull),X(0xF58A1BD7CDull),X(0xF5C2B35C08ull),X(0xF5FAB34757ull),X(0xF6321B7730ull),X(0xF668EBC964ull),X(0xF69F241C24ull),
-	X(0xF6D4C44DFFull),X(0xF709CC3DDFull),X(0xF73E3BCB0Eull),X(0xF77212D535ull),X(0xF7A5513C59ull),X(0xF7D7F6E0DDull),X(0xF80A03A384ull),X(0xF83B77656Full),
-	X(0xF86C52081Bull),X(0xF89C936D68ull),X(0xF8CC3B778Full),X(0xF8FB4A092Cull),X(0xF929BF0538ull),X(0xF9579A4F0Bull),X(0xF984DBCA5Bull),X(0xF9B1835B3Eull),
-	X(0xF9DD90E627ull),X(0xFA09044FECull),X(0xFA33DD7DBDull),X(0xFA5E1C552Eull),X(0xFA87C0BC2Eull),X(0xFAB0CA990Eull),X(0xFAD939D27Dull),X(0xFB010E4F8Aull),
-	X(0xFB2847F7A3ull),X(0xFB4EE6B297ull),X(0xFB74EA6893ull),X(0xFB9A530223ull),X(0xFBBF206834ull),X(0xFBE3528413ull),X(0xFC06E93F6Cull),X(0xFC29E4844Aull),
-	X(0xFC4C443D1Bull),X(0xFC6E0854A9ull),X(0xFC8F30B621ull),X(0xFCAFBD4D0Full),X(0xFCCFAE055Eull),X(0xFCEF02CB5Bull),X(0xFD0DBB8BB3ull),X(0xFD2BD83371ull),
-	X(0xFD4958B003ull),X(0xFD663CEF36ull),X(0xFD8284DF37ull),X(0xFD9E306E96ull),X(0xFDB93F8C3Full),X(0xFDD3B22783ull),X(0xFDED883010ull),X(0xFE06C195F8ull),
-	X(0xFE1F5E49AAull),X(0xFE375E3BF8ull),X(0xFE4EC15E14ull),X(0xFE6587A191ull),X(0xFE7BB0F863ull),X(0xFE913D54DEull),X(0xFEA62CA9B7ull),X(0xFEBA7EEA05ull),
-	X(0xFECE34093Eull),X(0xFEE14BFB3Aull),X(0xFEF3C6B432ull),X(0xFF05A428C0ull),X(0xFF16E44DDFull),X(0xFF278718EBull),X(0xFF378C7FA1ull),X(0xFF46F4781Eull),
-	X(0xFF55BEF8E3ull),X(0xFF63EBF8CEull),X(0xFF717B6F22ull),X(0xFF7E6D5382ull),X(0xFF8AC19DF0ull),X(0xFF967846D3ull),X(0xFFA19146F0ull),X(0xFFAC0C9770ull),
-	X(0xFFB5EA31DAull),X(0xFFBF2A1019ull),X(0xFFC7CC2C78ull),X(0xFFCFD081A4ull),X(0xFFD7370AABull),X(0xFFDDFFC2FCull),X(0xFFE42AA669ull),X(0xFFE9B7B122ull),
+#else
+# define FOURIER_SINTABLE_VALUES_256(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 512
+# define FOURIER_SINTABLE_VALUES_512(X) \
+	X(0x006487EABBull),X(0x012D97822Full),X(0x01F6A65F9Aull),X(0x02BFB406F5ull),X(0x0388BFFC3Cull),X(0x0451C9C36Bull),X(0x051AD0E07Full),X(0x05E3D4D777ull), \
+	X(0x06ACD52C54ull),X(0x0775D16319ull),X(0x083EC8FFCCull),X(0x0907BB8675ull),X(0x09D0A87B21ull),X(0x0A998F61DDull),X(0x0B626FBEBEull),X(0x0C2B4915DAull), \
+	X(0x0CF41AEB4Cull),X(0x0DBCE4C334ull),X(0x0E85A621B7ull),X(0x0F4E5E8AFFull),X(0x10170D833Bull),X(0x10DFB28EA2ull),X(0x11A84D316Dull),X(0x1270DCEFDFull), \
+	X(0x1339614E41ull),X(0x1401D9D0E3ull),X(0x14CA45FC1Bull),X(0x1592A55448ull),X(0x165AF75DD0ull),X(0x17233B9D23ull),X(0x17EB7196B7ull),X(0x18B398CF0Cull), \
+	X(0x197BB0CAABull),X(0x1A43B90E27ull),X(0x1B0BB11E1Dull),X(0x1BD3987F31ull),X(0x1C9B6EB616ull),X(0x1D63334785ull),X(0x1E2AE5B845ull),X(0x1EF2858D27ull), \
+	X(0x1FBA124B07ull),X(0x20818B76CEull),X(0x2148F09571ull),X(0x2210412BF0ull),X(0x22D77CBF58ull),X(0x239EA2D4C5ull),X(0x2465B2F15Dull),X(0x252CAC9A57ull), \
+	X(0x25F38F54F4ull),X(0x26BA5AA688ull),X(0x27810E1470ull),X(0x2847A9241Cull),X(0x290E2B5B09ull),X(0x29D4943EC4ull),X(0x2A9AE354E9ull),X(0x2B61182325ull), \
+	X(0x2C27322F34ull),X(0x2CED30FEE4ull),X(0x2DB3141811ull),X(0x2E78DB00ABull),X(0x2F3E853EB3ull),X(0x300412583Aull),X(0x30C981D365ull),X(0x318ED33669ull), \
+	X(0x3254060790ull),X(0x331919CD34ull),X(0x33DE0E0DC6ull),X(0x34A2E24FC7ull),X(0x35679619CDull),X(0x362C28F283ull),X(0x36F09A60A6ull),X(0x37B4E9EB0Aull), \
+	X(0x3879171897ull),X(0x393D217049ull),X(0x3A01087933ull),X(0x3AC4CBBA7Eull),X(0x3B886ABB68ull),X(0x3C4BE50345ull),X(0x3D0F3A1981ull),X(0x3DD26985A0ull), \
+	X(0x3E9572CF39ull),X(0x3F58557DFEull),X(0x401B1119B9ull),X(0x40DDA52A4Aull),X(0x41A01137AAull),X(0x426254C9EDull),X(0x43246F693Cull),X(0x43E6609DDCull), \
+	X(0x44A827F02Cull),X(0x4569C4E8A2ull),X(0x462B370FD2ull),X(0x46EC7DEE66ull),X(0x47AD990D26ull),X(0x486E87F4F4ull),X(0x492F4A2ECDull),X(0x49EFDF43CBull), \
+	X(0x4AB046BD20ull),X(0x4B7080241Full),X(0x4C308B0235ull),X(0x4CF066E0EBull),X(0x4DB01349E9ull),X(0x4E6F8FC6F2ull),X(0x4F2EDBE1E8ull),X(0x4FEDF724CBull), \
+	X(0x50ACE119B8ull),X(0x516B994AECull),X(0x522A1F42C1ull),X(0x52E8728BB2ull),X(0x53A692B057ull),X(0x54647F3B68ull),X(0x552237B7BFull),X(0x55DFBBB054ull), \
+	X(0x569D0AB03Full),X(0x575A2442BBull),X(0x581707F322ull),X(0x58D3B54CEFull),X(0x59902BDBC0ull),X(0x5A4C6B2B55ull),X(0x5B0872C78Eull),X(0x5BC4423C6Full), \
+	X(0x5C7FD9161Eull),X(0x5D3B36E0E4ull),X(0x5DF65B292Dull),X(0x5EB1457B8Aull),X(0x5F6BF564AEull),X(0x60266A7170ull),X(0x60E0A42ECDull),X(0x619AA229E4ull), \
+	X(0x625463EFFCull),X(0x630DE90E7Eull),X(0x63C73112FAull),X(0x64803B8B26ull),X(0x65390804DEull),X(0x65F1960E24ull),X(0x66A9E5351Full),X(0x6761F5081Eull), \
+	X(0x6819C51599ull),X(0x68D154EC2Bull),X(0x6988A41A9Cull),X(0x6A3FB22FD6ull),X(0x6AF67EBAF0ull),X(0x6BAD094B28ull),X(0x6C63516FE2ull),X(0x6D1956B8AFull), \
+	X(0x6DCF18B548ull),X(0x6E8496F58Dull),X(0x6F39D1098Bull),X(0x6FEEC68178ull),X(0x70A376EDB3ull),X(0x7157E1DEC8ull),X(0x720C06E56Dull),X(0x72BFE59281ull), \
+	X(0x73737D7711ull),X(0x7426CE2454ull),X(0x74D9D72BAFull),X(0x758C981EB2ull),X(0x763F108F18ull),X(0x76F1400ECBull),X(0x77A3262FE1ull),X(0x7854C2849Dull), \
+	X(0x7906149F71ull),X(0x79B71C12FAull),X(0x7A67D87205ull),X(0x7B18494F8Full),X(0x7BC86E3EBFull),X(0x7C7846D2EFull),X(0x7D27D29FA5ull),X(0x7DD711389Aull), \
+	X(0x7E860231B3ull),X(0x7F34A51F07ull),X(0x7FE2F994DDull),X(0x8090FF27ABull),X(0x813EB56C19ull),X(0x81EC1BF6FFull),X(0x8299325D68ull),X(0x8345F8348Eull), \
+	X(0x83F26D11DEull),X(0x849E908AF7ull),X(0x854A6235A9ull),X(0x85F5E1A7FAull),X(0x86A10E781Eull),X(0x874BE83C7Eull),X(0x87F66E8BB8ull),X(0x88A0A0FC9Aull), \
+	X(0x894A7F2629ull),X(0x89F4089F9Cull),X(0x8A9D3D005Full),X(0x8B461BE012ull),X(0x8BEEA4D68Bull),X(0x8C96D77BD2ull),X(0x8D3EB36828ull),X(0x8DE6383402ull), \
+	X(0x8E8D657809ull),X(0x8F343ACD1Full),X(0x8FDAB7CC59ull),X(0x9080DC0F06ull),X(0x9126A72EAAull),X(0x91CC18C4FEull),X(0x9271306BF7ull),X(0x9315EDBDBCull), \
+	X(0x93BA5054B0ull),X(0x945E57CB6Cull),X(0x950203BCC2ull),X(0x95A553C3BBull),X(0x9648477B9Aull),X(0x96EADE7FDBull),X(0x978D186C33ull),X(0x982EF4DC90ull), \
+	X(0x98D0736D1Aull),X(0x997193BA33ull),X(0x9A12556077ull),X(0x9AB2B7FCBCull),X(0x9B52BB2C14ull),X(0x9BF25E8BC9ull),X(0x9C91A1B963ull),X(0x9D308452A5ull), \
+	X(0x9DCF05F58Cull),X(0x9E6D264053ull),X(0x9F0AE4D16Dull),X(0x9FA841478Full),X(0xA0453B41A6ull),X(0xA0E1D25EDDull),X(0xA17E063E9Dull),X(0xA219D6808Bull), \
+	X(0xA2B542C48Bull),X(0xA3504AAABDull),X(0xA3EAEDD37Eull),X(0xA4852BDF6Dull),X(0xA51F046F64ull),X(0xA5B877247Dull),X(0xA65183A010ull),X(0xA6EA2983B5ull), \
+	X(0xA782687142ull),X(0xA81A400ACEull),X(0xA8B1AFF2B0ull),X(0xA948B7CB7Cull),X(0xA9DF573809ull),X(0xAA758DDB6Eull),X(0xAB0B5B5902ull),X(0xABA0BF545Dull), \
+	X(0xAC35B97159ull),X(0xACCA49540Full),X(0xAD5E6EA0DDull),X(0xADF228FC5Full),X(0xAE85780B76ull),X(0xAF185B7343ull),X(0xAFAAD2D92Bull),X(0xB03CDDE2D5ull), \
+	X(0xB0CE7C362Aull),X(0xB15FAD7958ull),X(0xB1F07152CEull),X(0xB280C76941ull),X(0xB310AF63A7ull),X(0xB3A028E93Cull),X(0xB42F33A17Full),X(0xB4BDCF3434ull), \
+	X(0xB54BFB4964ull),X(0xB5D9B7895Aull),X(0xB667039CABull),X(0xB6F3DF2C2Cull),X(0xB78049E0FAull),X(0xB80C436478ull),X(0xB897CB604Eull),X(0xB922E17E6Aull), \
+	X(0xB9AD856900ull),X(0xBA37B6CA8Bull),X(0xBAC1754DCDull),X(0xBB4AC09DCDull),X(0xBBD39865DCull),X(0xBC5BFC5190ull),X(0xBCE3EC0CC7ull),X(0xBD6B6743A6ull), \
+	X(0xBDF26DA29Dull),X(0xBE78FED65Full),X(0xBEFF1A8BECull),X(0xBF84C07089ull),X(0xC009F031C7ull),X(0xC08EA97D7Cull),X(0xC112EC01CBull),X(0xC196B76D1Dull), \
+	X(0xC21A0B6E26ull),X(0xC29CE7B3E4ull),X(0xC31F4BED9Eull),X(0xC3A137CAE6ull),X(0xC422AAFB97ull),X(0xC4A3A52FD8ull),X(0xC524261818ull),X(0xC5A42D6515ull), \
+	X(0xC623BAC7D3ull),X(0xC6A2CDF1A5ull),X(0xC721669429ull),X(0xC79F846146ull),X(0xC81D270B32ull),X(0xC89A4E446Dull),X(0xC916F9BFC3ull),X(0xC99329304Dull), \
+	X(0xCA0EDC4971ull),X(0xCA8A12BEE2ull),X(0xCB04CC449Dull),X(0xCB7F088EEFull),X(0xCBF8C75272ull),X(0xCC7208440Dull),X(0xCCEACB18F3ull),X(0xCD630F86A7ull), \
+	X(0xCDDAD542F9ull),X(0xCE521C0407ull),X(0xCEC8E3803Eull),X(0xCF3F2B6E5Aull),X(0xCFB4F38563ull),X(0xD02A3B7CB3ull),X(0xD09F030BF2ull),X(0xD11349EB16ull), \
+	X(0xD1870FD265ull),X(0xD1FA547A77ull),X(0xD26D179C2Full),X(0xD2DF58F0C4ull),X(0xD3511831BBull),X(0xD3C25518E9ull),X(0xD4330F6077ull),X(0xD4A346C2D9ull), \
+	X(0xD512FAFAD7ull),X(0xD5822BC38Aull),X(0xD5F0D8D85Cull),X(0xD65F01F507ull),X(0xD6CCA6D597ull),X(0xD739C7366Aull),X(0xD7A662D42Full),X(0xD812796BE9ull), \
+	X(0xD87E0ABAE9ull),X(0xD8E9167ED6ull),X(0xD9539C75A8ull),X(0xD9BD9C5DAAull),X(0xDA2715F578ull),X(0xDA9008FC02ull),X(0xDAF875308Dull),X(0xDB605A52ADull), \
+	X(0xDBC7B8224Dull),X(0xDC2E8E5FA9ull),X(0xDC94DCCB52ull),X(0xDCFAA3262Dull),X(0xDD5FE13173ull),X(0xDDC496AEAEull),X(0xDE28C35FC1ull),X(0xDE8C6706E0ull), \
+	X(0xDEEF816695ull),X(0xDF521241BEull),X(0xDFB4195B8Full),X(0xE01596778Full),X(0xE07689599Bull),X(0xE0D6F1C5E7ull),X(0xE136CF80F9ull),X(0xE196224FB0ull), \
+	X(0xE1F4E9F73Eull),X(0xE253263D2Dull),X(0xE2B0D6E75Bull),X(0xE30DFBBBFEull),X(0xE36A9481A0ull),X(0xE3C6A0FF25ull),X(0xE42220FBC2ull),X(0xE47D143F09ull), \
+	X(0xE4D77A90DEull),X(0xE53153B97Eull),X(0xE58A9F817Dull),X(0xE5E35DB1C6ull),X(0xE63B8E139Bull),X(0xE693307096ull),X(0xE6EA4492A7ull),X(0xE740CA441Aull), \
+	X(0xE796C14F8Dull),X(0xE7EC297FFBull),X(0xE84102A0B4ull),X(0xE8954C7D62ull),X(0xE8E906E206ull),X(0xE93C319AFAull),X(0xE98ECC74F2ull),X(0xE9E0D73CF9ull), \
+	X(0xEA3251C073ull),X(0xEA833BCD1Eull),X(0xEAD3953110ull),X(0xEB235DBABAull),X(0xEB729538E4ull),X(0xEBC13B7AB0ull),X(0xEC0F504F9Cull),X(0xEC5CD3877Cull), \
+	X(0xECA9C4F282ull),X(0xECF6246135ull),X(0xED41F1A47Bull),X(0xED8D2C8D90ull),X(0xEDD7D4EE0Dull),X(0xEE21EA97E5ull),X(0xEE6B6D5D65ull),X(0xEEB45D1133ull), \
+	X(0xEEFCB98654ull),X(0xEF44829023ull),X(0xEF8BB80259ull),X(0xEFD259B109ull),X(0xF0186770A1ull),X(0xF05DE115ECull),X(0xF0A2C6760Dull),X(0xF0E7176686ull), \
+	X(0xF12AD3BD31ull),X(0xF16DFB5048ull),X(0xF1B08DF65Dull),X(0xF1F28B865Full),X(0xF233F3D79Aull),X(0xF274C6C1B6ull),X(0xF2B5041CB4ull),X(0xF2F4ABC0F5ull), \
+	X(0xF333BD8736ull),X(0xF37239488Eull),X(0xF3B01EDE73ull),X(0xF3ED6E22B6ull),X(0xF42A26EF86ull),X(0xF466491F6Eull),X(0xF4A1D48D55ull),X(0xF4DCC91482ull), \
+	X(0xF517269096ull),X(0xF550ECDD90ull),X(0xF58A1BD7CDull),X(0xF5C2B35C08ull),X(0xF5FAB34757ull),X(0xF6321B7730ull),X(0xF668EBC964ull),X(0xF69F241C24ull), \
+	X(0xF6D4C44DFFull),X(0xF709CC3DDFull),X(0xF73E3BCB0Eull),X(0xF77212D535ull),X(0xF7A5513C59ull),X(0xF7D7F6E0DDull),X(0xF80A03A384ull),X(0xF83B77656Full), \
+	X(0xF86C52081Bull),X(0xF89C936D68ull),X(0xF8CC3B778Full),X(0xF8FB4A092Cull),X(0xF929BF0538ull),X(0xF9579A4F0Bull),X(0xF984DBCA5Bull),X(0xF9B1835B3Eull), \
+	X(0xF9DD90E627ull),X(0xFA09044FECull),X(0xFA33DD7DBDull),X(0xFA5E1C552Eull),X(0xFA87C0BC2Eull),X(0xFAB0CA990Eull),X(0xFAD939D27Dull),X(0xFB010E4F8Aull), \
+	X(0xFB2847F7A3ull),X(0xFB4EE6B297ull),X(0xFB74EA6893ull),X(0xFB9A530223ull),X(0xFBBF206834ull),X(0xFBE3528413ull),X(0xFC06E93F6Cull),X(0xFC29E4844Aull), \
+	X(0xFC4C443D1Bull),X(0xFC6E0854A9ull),X(0xFC8F30B621ull),X(0xFCAFBD4D0Full),X(0xFCCFAE055Eull),X(0xFCEF02CB5Bull),X(0xFD0DBB8BB3ull),X(0xFD2BD83371ull), \
+	X(0xFD4958B003ull),X(0xFD663CEF36ull),X(0xFD8284DF37ull),X(0xFD9E306E96ull),X(0xFDB93F8C3Full),X(0xFDD3B22783ull),X(0xFDED883010ull),X(0xFE06C195F8ull), \
+	X(0xFE1F5E49AAull),X(0xFE375E3BF8ull),X(0xFE4EC15E14ull),X(0xFE6587A191ull),X(0xFE7BB0F863ull),X(0xFE913D54DEull),X(0xFEA62CA9B7ull),X(0xFEBA7EEA05ull), \
+	X(0xFECE34093Eull),X(0xFEE14BFB3Aull),X(0xFEF3C6B432ull),X(0xFF05A428C0ull),X(0xFF16E44DDFull),X(0xFF278718EBull),X(0xFF378C7FA1ull),X(0xFF46F4781Eull), \
+	X(0xFF55BEF8E3ull),X(0xFF63EBF8CEull),X(0xFF717B6F22ull),X(0xFF7E6D5382ull),X(0xFF8AC19DF0ull),X(0xFF967846D3ull),X(0xFFA19146F0ull),X(0xFFAC0C9770ull), \
+	X(0xFFB5EA31DAull),X(0xFFBF2A1019ull),X(0xFFC7CC2C78ull),X(0xFFCFD081A4ull),X(0xFFD7370AABull),X(0xFFDDFFC2FCull),X(0xFFE42AA669ull),X(0xFFE9B7B122ull), \
 	X(0xFFEEA6DFBCull),X(0xFFF2F82F2Bull),X(0xFFF6AB9CC6ull),X(0xFFF9C12644ull),X(0xFFFC38C9BEull),X(0xFFFE1285AEull),X(0xFFFF4E58F1ull),X(0xFFFFEC42C3ull),
-	X(0x003243F655ull),X(0x0096CBDB41ull),X(0x00FB53A8EBull),X(0x015FDB4FD3ull),X(0x01C462C078ull),X(0x0228E9EB5Aull),X(0x028D70C0F8ull),X(0x02F1F731D1ull),
-	X(0x03567D2E64ull),X(0x03BB02A732ull),X(0x041F878CBAull),X(0x04840BCF7Aull),X(0x04E88F5FF4ull),X(0x054D122EA7ull),X(0x05B1942C13ull),X(0x06161548B8ull),
-	X(0x067A957517ull),X(0x06DF14A1AFull),X(0x074392BF01ull),X(0x07A80FBD8Full),X(0x080C8B8DD8ull),X(0x087106205Eull),X(0x08D57F65A3ull),X(0x0939F74E27ull),
-	X(0x099E6DCA6Dull),X(0x0A02E2CAF5ull),X(0x0A67564044ull),X(0x0ACBC81AD9ull),X(0x0B30384B39ull),X(0x0B94A6C1E7ull),X(0x0BF9136F64ull),X(0x0C5D7E4435ull),
-	X(0x0CC1E730DEull),X(0x0D264E25E2ull),X(0x0D8AB313C5ull),X(0x0DEF15EB0Dull),X(0x0E53769C3Eull),X(0x0EB7D517DDull),X(0x0F1C314E70ull),X(0x0F808B307Dull),
-	X(0x0FE4E2AE8Bull),X(0x104937B91Full),X(0x10AD8A40C1ull),X(0x1111DA35F8ull),X(0x117627894Dull),X(0x11DA722B47ull),X(0x123EBA0C6Full),X(0x12A2FF1D4Eull),
-	X(0x1307414E6Eull),X(0x136B809059ull),X(0x13CFBCD398ull),X(0x1433F608B7ull),X(0x14982C2042ull),X(0x14FC5F0AC4ull),X(0x15608EB8C8ull),X(0x15C4BB1ADDull),
-	X(0x1628E42190ull),X(0x168D09BD6Eull),X(0x16F12BDF05ull),X(0x17554A76E5ull),X(0x17B965759Dull),X(0x181D7CCBBDull),X(0x18819069D5ull),X(0x18E5A04077ull),
-	X(0x1949AC4034ull),X(0x19ADB459A0ull),X(0x1A11B87D4Bull),X(0x1A75B89BCBull),X(0x1AD9B4A5B3ull),X(0x1B3DAC8B98ull),X(0x1BA1A03E10ull),X(0x1C058FADB0ull),
-	X(0x1C697ACB0Full),X(0x1CCD6186C5ull),X(0x1D3143D16Aull),X(0x1D95219B95ull),X(0x1DF8FAD5E2ull),X(0x1E5CCF70EAull),X(0x1EC09F5D47ull),X(0x1F246A8B96ull),
-	X(0x1F8830EC73ull),X(0x1FEBF2707Aull),X(0x204FAF084Aull),X(0x20B366A481ull),X(0x21171935BEull),X(0x217AC6ACA2ull),X(0x21DE6EF9CDull),X(0x2242120DE1ull),
-	X(0x22A5AFD981ull),X(0x2309484D50ull),X(0x236CDB59F1ull),X(0x23D068F00Bull),X(0x2433F10042ull),X(0x2497737B3Eull),X(0x24FAF051A6ull),X(0x255E677422ull),
-	X(0x25C1D8D35Bull),X(0x2625445FFDull),X(0x2688AA0AB1ull),X(0x26EC09C424ull),X(0x274F637D02ull),X(0x27B2B725FAull),X(0x281604AFBAull),X(0x28794C0AF2ull),
-	X(0x28DC8D2852ull),X(0x293FC7F88Dull),X(0x29A2FC6C54ull),X(0x2A062A745Bull),X(0x2A69520157ull),X(0x2ACC7303FDull),X(0x2B2F8D6D04ull),X(0x2B92A12D24ull),
-	X(0x2BF5AE3514ull),X(0x2C58B4758Full),X(0x2CBBB3DF4Full),X(0x2D1EAC6310ull),X(0x2D819DF18Full),X(0x2DE4887B8Aull),X(0x2E476BF1BFull),X(0x2EAA4844EFull),
-	X(0x2F0D1D65DAull),X(0x2F6FEB4544ull),X(0x2FD2B1D3EFull),X(0x30357102A0ull),X(0x309828C21Cull),X(0x30FAD9032Bull),X(0x315D81B694ull),X(0x31C022CD20ull),
-	X(0x3222BC379Aull),X(0x32854DE6CDull),X(0x32E7D7CB86ull),X(0x334A59D692ull),X(0x33ACD3F8C1ull),X(0x340F4622E3ull),X(0x3471B045C9ull),X(0x34D4125246ull),
-	X(0x35366C392Eull),X(0x3598BDEB57ull),X(0x35FB075997ull),X(0x365D4874C6ull),X(0x36BF812DBCull),X(0x3721B17555ull),X(0x3783D93C6Bull),X(0x37E5F873DCull),
-	X(0x38480F0C86ull),X(0x38AA1CF749ull),X(0x390C222506ull),X(0x396E1E869Full),X(0x39D0120CF7ull),X(0x3A31FCA8F5ull),X(0x3A93DE4B7Dull),X(0x3AF5B6E578ull),
-	X(0x3B578667D0ull),X(0x3BB94CC36Eull),X(0x3C1B09E93Full),X(0x3C7CBDCA30ull),X(0x3CDE685731ull),X(0x3D40098130ull),X(0x3DA1A13921ull),X(0x3E032F6FF6ull),
-	X(0x3E64B416A4ull),X(0x3EC62F1E21ull),X(0x3F27A07764ull),X(0x3F89081367ull),X(0x3FEA65E325ull),X(0x404BB9D79Aull),X(0x40AD03E1C2ull),X(0x410E43F29Eull),
-	X(0x416F79FB2Eull),X(0x41D0A5EC74ull),X(0x4231C7B775ull),X(0x4292DF4D35ull),X(0x42F3EC9EBCull),X(0x4354EF9D11ull),X(0x43B5E83940ull),X(0x4416D66454ull),
-	X(0x4477BA0F59ull),X(0x44D8932B61ull),X(0x453961A97Aull),X(0x459A257AB7ull),X(0x45FADE902Cull),X(0x465B8CDAEEull),X(0x46BC304C15ull),X(0x471CC8D4B9ull),
-	X(0x477D5665F6ull),X(0x47DDD8F0E7ull),X(0x483E5066AAull),X(0x489EBCB85Full),X(0x48FF1DD727ull),X(0x495F73B426ull),X(0x49BFBE407Full),X(0x4A1FFD6D5Bull),
-	X(0x4A80312BE1ull),X(0x4AE0596D3Aull),X(0x4B40762294ull),X(0x4BA0873D1Cull),X(0x4C008CAE01ull),X(0x4C60866674ull),X(0x4CC07457A8ull),X(0x4D205672D3ull),
-	X(0x4D802CA92Aull),X(0x4DDFF6EBE8ull),X(0x4E3FB52C45ull),X(0x4E9F675B7Dull),X(0x4EFF0D6AD1ull),X(0x4F5EA74B7Eull),X(0x4FBE34EEC7ull),X(0x501DB645EFull),
-	X(0x507D2B423Dull),X(0x50DC93D4F8ull),X(0x513BEFEF68ull),X(0x519B3F82DAull),X(0x51FA82809Bull),X(0x5259B8D9FAull),X(0x52B8E28048ull),X(0x5317FF64D8ull),
-	X(0x53770F78FFull),X(0x53D612AE15ull),X(0x543508F573ull),X(0x5493F24073ull),X(0x54F2CE8072ull),X(0x55519DA6D0ull),X(0x55B05FA4EEull),X(0x560F146C2Full),
-	X(0x566DBBEDF8ull),X(0x56CC561BB0ull),X(0x572AE2E6C0ull),X(0x5789624094ull),X(0x57E7D41A9Aull),X(0x5846386640ull),X(0x58A48F14F8ull),X(0x5902D81836ull),
-	X(0x5961136170ull),X(0x59BF40E21Dull),X(0x5A1D608BB8ull),X(0x5A7B724FBCull),X(0x5AD9761FA9ull),X(0x5B376BECFDull),X(0x5B9553A93Dull),X(0x5BF32D45EDull),
-	X(0x5C50F8B493ull),X(0x5CAEB5E6B9ull),X(0x5D0C64CDEBull),X(0x5D6A055BB5ull),X(0x5DC79781A7ull),X(0x5E251B3154ull),X(0x5E82905C50ull),X(0x5EDFF6F431ull),
-	X(0x5F3D4EEA8Full),X(0x5F9A983107ull),X(0x5FF7D2B934ull),X(0x6054FE74B6ull),X(0x60B21B5530ull),X(0x610F294C45ull),X(0x616C284B9Cull),X(0x61C91844DDull),
-	X(0x6225F929B3ull),X(0x6282CAEBCBull),X(0x62DF8D7CD6ull),X(0x633C40CE85ull),X(0x6398E4D28Cull),X(0x63F5797AA3ull),X(0x6451FEB882ull),X(0x64AE747DE4ull),
-	X(0x650ADABC88ull),X(0x656731662Eull),X(0x65C3786C98ull),X(0x661FAFC18Bull),X(0x667BD756CFull),X(0x66D7EF1E2Eull),X(0x6733F70974ull),X(0x678FEF0A70ull),
-	X(0x67EBD712F3ull),X(0x6847AF14D0ull),X(0x68A37701DEull),X(0x68FF2ECBF6ull),X(0x695AD664F3ull),X(0x69B66DBEB1ull),X(0x6A11F4CB12ull),X(0x6A6D6B7BF8ull),
-	X(0x6AC8D1C348ull),X(0x6B242792EAull),X(0x6B7F6CDCC8ull),X(0x6BDAA192CFull),X(0x6C35C5A6EEull),X(0x6C90D90B17ull),X(0x6CEBDBB13Full),X(0x6D46CD8B5Cull),
-	X(0x6DA1AE8B69ull),X(0x6DFC7EA361ull),X(0x6E573DC543ull),X(0x6EB1EBE312ull),X(0x6F0C88EED0ull),X(0x6F6714DA85ull),X(0x6FC18F983Aull),X(0x701BF919FBull),
-	X(0x70765151D6ull),X(0x70D09831DEull),X(0x712ACDAC25ull),X(0x7184F1B2C4ull),X(0x71DF0437D2ull),X(0x7239052D6Dull),X(0x7292F485B3ull),X(0x72ECD232C5ull),
-	X(0x73469E26C9ull),X(0x73A05853E3ull),X(0x73FA00AC40ull),X(0x745397220Aull),X(0x74AD1BA771ull),X(0x75068E2EA8ull),X(0x755FEEA9E2ull),X(0x75B93D0B58ull),
-	X(0x7612794543ull),X(0x766BA349E2ull),X(0x76C4BB0B73ull),X(0x771DC07C3Aull),X(0x7776B38E7Cull),X(0x77CF943481ull),X(0x7828626095ull),X(0x78811E0507ull),
-	X(0x78D9C71426ull),X(0x79325D8047ull),X(0x798AE13BC0ull),X(0x79E35238ECull),X(0x7A3BB06A25ull),X(0x7A93FBC1CDull),X(0x7AEC343245ull),X(0x7B4459ADF2ull),
-	X(0x7B9C6C273Dull),X(0x7BF46B9090ull),X(0x7C4C57DC5Aull),X(0x7CA430FD0Bull),X(0x7CFBF6E518ull),X(0x7D53A986F7ull),X(0x7DAB48D521ull),X(0x7E02D4C215ull),
-	X(0x7E5A4D4051ull),X(0x7EB1B24259ull),X(0x7F0903BAB2ull),X(0x7F60419BE5ull),X(0x7FB76BD87Eull),X(0x800E82630Bull),X(0x8065852E20ull),X(0x80BC742C50ull),
-	X(0x81134F5033ull),X(0x816A168C66ull),X(0x81C0C9D385ull),X(0x8217691832ull),X(0x826DF44D11ull),X(0x82C46B64CAull),X(0x831ACE5207ull),X(0x83711D0776ull),
-	X(0x83C75777C8ull),X(0x841D7D95B0ull),X(0x84738F53E5ull),X(0x84C98CA522ull),X(0x851F757C23ull),X(0x857549CBA9ull),X(0x85CB098679ull),X(0x8620B49F58ull),
-	X(0x86764B0910ull),X(0x86CBCCB66Full),X(0x8721399A45ull),X(0x877691A765ull),X(0x87CBD4D0A6ull),X(0x88210308E3ull),X(0x88761C42F8ull),X(0x88CB2071C6ull),
-	X(0x89200F8831ull),X(0x8974E9791Full),X(0x89C9AE377Bull),X(0x8A1E5DB632ull),X(0x8A72F7E835ull),X(0x8AC77CC078ull),X(0x8B1BEC31F2ull),X(0x8B70462F9Eull),
-	X(0x8BC48AAC7Aull),X(0x8C18B99B87ull),X(0x8C6CD2EFCAull),X(0x8CC0D69C4Bull),X(0x8D14C49414ull),X(0x8D689CCA35ull),X(0x8DBC5F31BFull),X(0x8E100BBDC7ull),
-	X(0x8E63A26167ull),X(0x8EB7230FBBull),X(0x8F0A8DBBE1ull),X(0x8F5DE258FEull),X(0x8FB120DA36ull),X(0x90044932B4ull),X(0x90575B55A4ull),X(0x90AA573638ull),
-	X(0x90FD3CC7A3ull),X(0x91500BFD1Cull),X(0x91A2C4C9DEull),X(0x91F5672129ull),X(0x9247F2F63Cull),X(0x929A683C5Eull),X(0x92ECC6E6D7ull),X(0x933F0EE8F4ull),
-	X(0x9391403603ull),X(0x93E35AC159ull),X(0x94355E7E4Cull),X(0x94874B6036ull),X(0x94D9215A74ull),X(0x952AE06069ull),X(0x957C886578ull),X(0x95CE195D0Bull),
-	X(0x961F933A8Dull),X(0x9670F5F16Dull),X(0x96C241751Full),X(0x971375B919ull),X(0x976492B0D5ull),X(0x97B5984FD1ull),X(0x980686898Full),X(0x98575D5194ull),
-	X(0x98A81C9B67ull),X(0x98F8C45A96ull),X(0x99495482B0ull),X(0x9999CD0749ull),X(0x99EA2DDBF8ull),X(0x9A3A76F457ull),X(0x9A8AA84405ull),X(0x9ADAC1BEA4ull),
-	X(0x9B2AC357DBull),X(0x9B7AAD0352ull),X(0x9BCA7EB4B6ull),X(0x9C1A385FBAull),X(0x9C69D9F810ull),X(0x9CB9637171ull),X(0x9D08D4BF9Aull),X(0x9D582DD64Aull),
-	X(0x9DA76EA945ull),X(0x9DF6972C51ull),X(0x9E45A7533Bull),X(0x9E949F11CFull),X(0x9EE37E5BE2ull),X(0x9F32452549ull),X(0x9F80F361DEull),X(0x9FCF89057Full),
-	X(0xA01E06040Eull),X(0xA06C6A516Full),X(0xA0BAB5E18Dull),X(0xA108E8A855ull),X(0xA1570299B6ull),X(0xA1A503A9A6ull),X(0xA1F2EBCC1Eull),X(0xA240BAF519ull),
-	X(0xA28E711899ull),X(0xA2DC0E2AA0ull),X(0xA329921F37ull),X(0xA376FCEA6Aull),X(0xA3C44E8049ull),X(0xA41186D4E6ull),X(0xA45EA5DC5Bull),X(0xA4ABAB8AC0ull),
-	X(0xA4F897D438ull),X(0xA5456AACE3ull),X(0xA5922408EAull),X(0xA5DEC3DC78ull),X(0xA62B4A1BBBull),X(0xA677B6BAE6ull),X(0xA6C409AE32ull),X(0xA71042E9D7ull),
-	X(0xA75C626215ull),X(0xA7A8680B2Full),X(0xA7F453D96Cull),X(0xA84025C116ull),X(0xA88BDDB67Cull),X(0xA8D77BADF1ull),X(0xA922FF9BCCull),X(0xA96E697467ull),
-	X(0xA9B9B92C21ull),X(0xAA04EEB75Eull),X(0xAA500A0A83ull),X(0xAA9B0B19FCull),X(0xAAE5F1DA37ull),X(0xAB30BE3FA9ull),X(0xAB7B703EC7ull),X(0xABC607CC0Dull),
-	X(0xAC1084DBFBull),X(0xAC5AE76313ull),X(0xACA52F55DCull),X(0xACEF5CA8E4ull),X(0xAD396F50B8ull),X(0xAD836741EDull),X(0xADCD44711Bull),X(0xAE1706D2DDull),
-	X(0xAE60AE5BD4ull),X(0xAEAA3B00A3ull),X(0xAEF3ACB5F4ull),X(0xAF3D037073ull),X(0xAF863F24D1ull),X(0xAFCF5FC7C1ull),X(0xB018654DFFull),X(0xB0614FAC46ull),
-	X(0xB0AA1ED758ull),X(0xB0F2D2C3FAull),X(0xB13B6B66F7ull),X(0xB183E8B51Dull),X(0xB1CC4AA33Dull),X(0xB21491262Full),X(0xB25CBC32CCull),X(0xB2A4CBBDF4ull),
-	X(0xB2ECBFBC8Aull),X(0xB334982376ull),X(0xB37C54E7A2ull),X(0xB3C3F5FE00ull),X(0xB40B7B5B82ull),X(0xB452E4F522ull),X(0xB49A32BFDDull),X(0xB4E164B0B3ull),
-	X(0xB5287ABCA9ull),X(0xB56F74D8CAull),X(0xB5B652FA23ull),X(0xB5FD1515C7ull),X(0xB643BB20CCull),X(0xB68A45104Cull),X(0xB6D0B2D969ull),X(0xB717047143ull),
-	X(0xB75D39CD05ull),X(0xB7A352E1DAull),X(0xB7E94FA4F2ull),X(0xB82F300B83ull),X(0xB874F40AC7ull),X(0xB8BA9B97FAull),X(0xB90026A85Full),X(0xB94595313Cull),
-	X(0xB98AE727DDull),X(0xB9D01C8191ull),X(0xBA153533ACull),X(0xBA5A313385ull),X(0xBA9F10767Aull),X(0xBAE3D2F1EBull),X(0xBB28789B3Eull),X(0xBB6D0167DDull),
-	X(0xBBB16D4D36ull),X(0xBBF5BC40BCull),X(0xBC39EE37E6ull),X(0xBC7E032831ull),X(0xBCC1FB071Cull),X(0xBD05D5CA2Cull),X(0xBD499366EAull),X(0xBD8D33D2E4ull),
-	X(0xBDD0B703ACull),X(0xBE141CEED9ull),X(0xBE57658A07ull),X(0xBE9A90CAD4ull),X(0xBEDD9EA6E5ull),X(0xBF208F13E3ull),X(0xBF6362077Cull),X(0xBFA6177760ull),
-	X(0xBFE8AF5948ull),X(0xC02B29A2EDull),X(0xC06D864A0Full),X(0xC0AFC54473ull),X(0xC0F1E687E0ull),X(0xC133EA0A25ull),X(0xC175CFC113ull),X(0xC1B797A281ull),
-	X(0xC1F941A44Aull),X(0xC23ACDBC4Dull),X(0xC27C3BE06Full),X(0xC2BD8C0699ull),X(0xC2FEBE24B7ull),X(0xC33FD230BEull),X(0xC380C820A2ull),X(0xC3C19FEA60ull),
-	X(0xC4025983F8ull),X(0xC442F4E36Full),X(0xC48371FECDull),X(0xC4C3D0CC22ull),X(0xC50411417Full),X(0xC5443354FDull),X(0xC58436FCB7ull),X(0xC5C41C2ECEull),
-	X(0xC603E2E168ull),X(0xC6438B0AAFull),X(0xC68314A0D2ull),X(0xC6C27F9A04ull),X(0xC701CBEC7Eull),X(0xC740F98E7Dull),X(0xC780087643ull),X(0xC7BEF89A16ull),
-	X(0xC7FDC9F042ull),X(0xC83C7C6F17ull),X(0xC87B100CE9ull),X(0xC8B984C012ull),X(0xC8F7DA7EF1ull),X(0xC936113FE8ull),X(0xC97428F95Full),X(0xC9B221A1C4ull),
-	X(0xC9EFFB2F87ull),X(0xCA2DB59920ull),X(0xCA6B50D508ull),X(0xCAA8CCD9C0ull),X(0xCAE6299DCCull),X(0xCB236717B7ull),X(0xCB60853E0Eull),X(0xCB9D840764ull),
-	X(0xCBDA636A52ull),X(0xCC17235D74ull),X(0xCC53C3D76Cull),X(0xCC9044CEE1ull),X(0xCCCCA63A7Eull),X(0xCD08E810F4ull),X(0xCD450A48F6ull),X(0xCD810CD940ull),
-	X(0xCDBCEFB891ull),X(0xCDF8B2DDACull),X(0xCE34563F59ull),X(0xCE6FD9D467ull),X(0xCEAB3D93A8ull),X(0xCEE68173F3ull),X(0xCF21A56C24ull),X(0xCF5CA9731Eull),
-	X(0xCF978D7FC5ull),X(0xCFD2518905ull),X(0xD00CF585CFull),X(0xD047796D16ull),X(0xD081DD35D6ull),X(0xD0BC20D70Cull),X(0xD0F64447BDull),X(0xD130477EF1ull),
-	X(0xD16A2A73B7ull),X(0xD1A3ED1D20ull),X(0xD1DD8F7245ull),X(0xD217116A42ull),X(0xD25072FC3Aull),X(0xD289B41F51ull),X(0xD2C2D4CAB6ull),X(0xD2FBD4F597ull),
-	X(0xD334B4972Bull),X(0xD36D73A6ADull),X(0xD3A6121B5Cull),X(0xD3DE8FEC7Dull),X(0xD416ED1159ull),X(0xD44F298141ull),X(0xD487453387ull),X(0xD4BF401F84ull),
-	X(0xD4F71A3C97ull),X(0xD52ED38222ull),X(0xD5666BE78Eull),X(0xD59DE36448ull),X(0xD5D539EFC2ull),X(0xD60C6F8173ull),X(0xD6438410D8ull),X(0xD67A779573ull),
-	X(0xD6B14A06CAull),X(0xD6E7FB5C68ull),X(0xD71E8B8DDFull),X(0xD754FA92C4ull),X(0xD78B4862B3ull),X(0xD7C174F54Bull),X(0xD7F7804232ull),X(0xD82D6A4113ull),
-	X(0xD86332E99Dull),X(0xD898DA3384ull),X(0xD8CE601683ull),X(0xD903C48A58ull),X(0xD9390786C8ull),X(0xD96E29039Cull),X(0xD9A328F8A2ull),X(0xD9D8075DAEull),
-	X(0xDA0CC42A99ull),X(0xDA415F5742ull),X(0xDA75D8DB8Aull),X(0xDAAA30AF5Bull),X(0xDADE66CAA1ull),X(0xDB127B2551ull),X(0xDB466DB761ull),X(0xDB7A3E78D0ull),
-	X(0xDBADED619Full),X(0xDBE17A69D6ull),X(0xDC14E58982ull),X(0xDC482EB8B5ull),X(0xDC7B55EF86ull),X(0xDCAE5B2612ull),X(0xDCE13E547Aull),X(0xDD13FF72E7ull),
-	X(0xDD469E7983ull),X(0xDD791B6081ull),X(0xDDAB762017ull),X(0xDDDDAEB082ull),X(0xDE0FC50A03ull),X(0xDE41B924E0ull),X(0xDE738AF965ull),X(0xDEA53A7FE4ull),
-	X(0xDED6C7B0B3ull),X(0xDF0832842Eull),X(0xDF397AF2B6ull),X(0xDF6AA0F4B1ull),X(0xDF9BA4828Bull),X(0xDFCC8594B5ull),X(0xDFFD4423A6ull),X(0xE02DE027D8ull),
-	X(0xE05E5999CEull),X(0xE08EB0720Cull),X(0xE0BEE4A920ull),X(0xE0EEF63799ull),X(0xE11EE5160Full),X(0xE14EB13D1Dull),X(0xE17E5AA563ull),X(0xE1ADE14789ull),
-	X(0xE1DD451C3Aull),X(0xE20C861C27ull),X(0xE23BA44007ull),X(0xE26A9F8096ull),X(0xE29977D694ull),X(0xE2C82D3AC9ull),X(0xE2F6BFA600ull),X(0xE3252F110Bull),
-	X(0xE3537B74C1ull),X(0xE381A4C9FEull),X(0xE3AFAB09A3ull),X(0xE3DD8E2C98ull),X(0xE40B4E2BC8ull),X(0xE438EB0027ull),X(0xE46664A2ABull),X(0xE493BB0C50ull),
-	X(0xE4C0EE361Aull),X(0xE4EDFE190Full),X(0xE51AEAAE3Dull),X(0xE547B3EEB5ull),X(0xE57459D391ull),X(0xE5A0DC55EDull),X(0xE5CD3B6EEDull),X(0xE5F97717B8ull),
-	X(0xE6258F497Cull),X(0xE65183FD6Cull),X(0xE67D552CC2ull),X(0xE6A902D0BBull),X(0xE6D48CE29Aull),X(0xE6FFF35BAAull),X(0xE72B363539ull),X(0xE75655689Aull),
-	X(0xE78150EF28ull),X(0xE7AC28C241ull),X(0xE7D6DCDB4Bull),X(0xE8016D33AFull),X(0xE82BD9C4DDull),X(0xE85622884Aull),X(0xE880477771ull),X(0xE8AA488BD1ull),
-	X(0xE8D425BEF2ull),X(0xE8FDDF0A5Eull),X(0xE9277467A5ull),X(0xE950E5D05Full),X(0xE97A333E27ull),X(0xE9A35CAA9Eull),X(0xE9CC620F6Cull),X(0xE9F543663Dull),
-	X(0xEA1E00A8C3ull),X(0xEA4699D0B6ull),X(0xEA6F0ED7D3ull),X(0xEA975FB7DDull),X(0xEABF8C6A9Dull),X(0xEAE794E9DFull),X(0xEB0F792F79ull),X(0xEB37393543ull),
-	X(0xEB5ED4F51Bull),X(0xEB864C68E6ull),X(0xEBAD9F8A8Full),X(0xEBD4CE5403ull),X(0xEBFBD8BF3Aull),X(0xEC22BEC62Dull),X(0xEC498062DCull),X(0xEC701D8F4Eull),
-	X(0xEC9696458Full),X(0xECBCEA7FAFull),X(0xECE31A37C5ull),X(0xED092567EEull),X(0xED2F0C0A4Cull),X(0xED54CE1906ull),X(0xED7A6B8E4Aull),X(0xED9FE4644Cull),
-	X(0xEDC5389542ull),X(0xEDEA681B6Dull),X(0xEE0F72F110ull),X(0xEE34591074ull),X(0xEE591A73E9ull),X(0xEE7DB715C4ull),X(0xEEA22EF060ull),X(0xEEC681FE1Cull),
-	X(0xEEEAB0395Eull),X(0xEF0EB99C93ull),X(0xEF329E222Cull),X(0xEF565DC49Full),X(0xEF79F87E6Aull),X(0xEF9D6E4A0Eull),X(0xEFC0BF2215ull),X(0xEFE3EB010Bull),
-	X(0xF006F1E184ull),X(0xF029D3BE19ull),X(0xF04C90916Aull),X(0xF06F28561Aull),X(0xF0919B06D5ull),X(0xF0B3E89E4Aull),X(0xF0D611172Full),X(0xF0F8146C3Full),
-	X(0xF119F2983Cull),X(0xF13BAB95EDull),X(0xF15D3F601Eull),X(0xF17EADF1A2ull),X(0xF19FF74550ull),X(0xF1C11B5608ull),X(0xF1E21A1EACull),X(0xF202F39A26ull),
-	X(0xF223A7C365ull),X(0xF24436955Eull),X(0xF264A00B0Bull),X(0xF284E41F6Eull),X(0xF2A502CD8Bull),X(0xF2C4FC1070ull),X(0xF2E4CFE32Eull),X(0xF3047E40DCull),
-	X(0xF324072498ull),X(0xF3436A8985ull),X(0xF362A86ACBull),X(0xF381C0C39Aull),X(0xF3A0B38F25ull),X(0xF3BF80C8A7ull),X(0xF3DE286B60ull),X(0xF3FCAA7295ull),
-	X(0xF41B06D993ull),X(0xF4393D9BAAull),X(0xF4574EB432ull),X(0xF4753A1E88ull),X(0xF492FFD60Full),X(0xF4B09FD62Full),X(0xF4CE1A1A57ull),X(0xF4EB6E9DFBull),
-	X(0xF5089D5C95ull),X(0xF525A651A4ull),X(0xF5428978B0ull),X(0xF55F46CD43ull),X(0xF57BDE4AEFull),X(0xF5984FED4Bull),X(0xF5B49BAFF4ull),X(0xF5D0C18E8Dull),
-	X(0xF5ECC184BFull),X(0xF6089B8E38ull),X(0xF6244FA6ADull),X(0xF63FDDC9D8ull),X(0xF65B45F379ull),X(0xF676881F57ull),X(0xF691A4493Dull),X(0xF6AC9A6CFDull),
-	X(0xF6C76A866Eull),X(0xF6E214916Full),X(0xF6FC9889E2ull),X(0xF716F66BB0ull),X(0xF7312E32CAull),X(0xF74B3FDB22ull),X(0xF7652B60B5ull),X(0xF77EF0BF84ull),
-	X(0xF7988FF394ull),X(0xF7B208F8F3ull),X(0xF7CB5BCBB2ull),X(0xF7E48867EAull),X(0xF7FD8EC9B9ull),X(0xF8166EED43ull),X(0xF82F28CEB2ull),X(0xF847BC6A36ull),
-	X(0xF86029BC05ull),X(0xF87870C05Bull),X(0xF890917378ull),X(0xF8A88BD1A4ull),X(0xF8C05FD72Eull),X(0xF8D80D8067ull),X(0xF8EF94C9AAull),X(0xF906F5AF55ull),
-	X(0xF91E302DCEull),X(0xF93544417Full),X(0xF94C31E6DAull),X(0xF962F91A54ull),X(0xF97999D86Cull),X(0xF990141DA3ull),X(0xF9A667E683ull),X(0xF9BC952F99ull),
-	X(0xF9D29BF57Aull),X(0xF9E87C34C2ull),X(0xF9FE35EA0Full),X(0xFA13C91209ull),X(0xFA2935A95Bull),X(0xFA3E7BACB9ull),X(0xFA539B18D9ull),X(0xFA6893EA7Bull),
-	X(0xFA7D661E61ull),X(0xFA9211B157ull),X(0xFAA696A02Dull),X(0xFABAF4E7B7ull),X(0xFACF2C84D2ull),X(0xFAE33D7460ull),X(0xFAF727B349ull),X(0xFB0AEB3E7Bull),
-	X(0xFB1E8812E8ull),X(0xFB31FE2D8Cull),X(0xFB454D8B65ull),X(0xFB58762979ull),X(0xFB6B7804D5ull),X(0xFB7E531A89ull),X(0xFB910767ADull),X(0xFBA394E95Full),
-	X(0xFBB5FB9CC3ull),X(0xFBC83B7F01ull),X(0xFBDA548D4Aull),X(0xFBEC46C4D3ull),X(0xFBFE1222D7ull),X(0xFC0FB6A498ull),X(0xFC2134475Eull),X(0xFC328B0875ull),
-	X(0xFC43BAE533ull),X(0xFC54C3DAEFull),X(0xFC65A5E709ull),X(0xFC766106E8ull),X(0xFC86F537F5ull),X(0xFC976277A4ull),X(0xFCA7A8C36Bull),X(0xFCB7C818C8ull),
-	X(0xFCC7C0753Full),X(0xFCD791D658ull),X(0xFCE73C39A4ull),X(0xFCF6BF9CB8ull),X(0xFD061BFD2Full),X(0xFD155158ACull),X(0xFD245FACD5ull),X(0xFD3346F759ull),
-	X(0xFD420735EBull),X(0xFD50A06644ull),X(0xFD5F128625ull),X(0xFD6D5D9353ull),X(0xFD7B818B99ull),X(0xFD897E6CCAull),X(0xFD975434BEull),X(0xFDA502E151ull),
-	X(0xFDB28A7069ull),X(0xFDBFEADFEEull),X(0xFDCD242DD1ull),X(0xFDDA365808ull),X(0xFDE7215C8Full),X(0xFDF3E53967ull),X(0xFE0081EC99ull),X(0xFE0CF77433ull),
-	X(0xFE1945CE48ull),X(0xFE256CF8F4ull),X(0xFE316CF257ull),X(0xFE3D45B895ull),X(0xFE48F749DDull),X(0xFE5481A460ull),X(0xFE5FE4C657ull),X(0xFE6B20AE00ull),
-	X(0xFE763559A0ull),X(0xFE8122C781ull),X(0xFE8BE8F5F3ull),X(0xFE9687E34Eull),X(0xFEA0FF8DEFull),X(0xFEAB4FF437ull),X(0xFEB5791490ull),X(0xFEBF7AED68ull),
-	X(0xFEC9557D35ull),X(0xFED308C272ull),X(0xFEDC94BB9Full),X(0xFEE5F96744ull),X(0xFEEF36C3EEull),X(0xFEF84CD02Full),X(0xFF013B8AA3ull),X(0xFF0A02F1E7ull),
-	X(0xFF12A304A1ull),X(0xFF1B1BC17Dull),X(0xFF236D272Bull),X(0xFF2B973465ull),X(0xFF3399E7E8ull),X(0xFF3B754076ull),X(0xFF43293CDBull),X(0xFF4AB5DBE6ull),
-	X(0xFF521B1C6Cull),X(0xFF5958FD4Bull),X(0xFF606F7D64ull),X(0xFF675E9B9Full),X(0xFF6E2656EAull),X(0xFF74C6AE3Bull),X(0xFF7B3FA08Aull),X(0xFF81912CDAull),
-	X(0xFF87BB522Full),X(0xFF8DBE0F98ull),X(0xFF93996426ull),X(0xFF994D4EF3ull),X(0xFF9ED9CF1Dull),X(0xFFA43EE3C9ull),X(0xFFA97C8C23ull),X(0xFFAE92C75Bull),
-	X(0xFFB38194A8ull),X(0xFFB848F348ull),X(0xFFBCE8E27Eull),X(0xFFC1616194ull),X(0xFFC5B26FD9ull),X(0xFFC9DC0CA3ull),X(0xFFCDDE374Cull),X(0xFFD1B8EF38ull),
-	X(0xFFD56C33CEull),X(0xFFD8F8047Cull),X(0xFFDC5C60B5ull),X(0xFFDF9947F4ull),X(0xFFE2AEB9BAull),X(0xFFE59CB58Cull),X(0xFFE8633AF6ull),X(0xFFEB02498Cull),
-	X(0xFFED79E0E5ull),X(0xFFEFCA00A0ull),X(0xFFF1F2A862ull),X(0xFFF3F3D7D6ull),X(0xFFF5CD8EADull),X(0xFFF77FCC9Dull),X(0xFFF90A9164ull),X(0xFFFA6DDCC4ull),
+#else
+# define FOURIER_SINTABLE_VALUES_512(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 1024
+# define FOURIER_SINTABLE_VALUES_1024(X) \
+	X(0x003243F655ull),X(0x0096CBDB41ull),X(0x00FB53A8EBull),X(0x015FDB4FD3ull),X(0x01C462C078ull),X(0x0228E9EB5Aull),X(0x028D70C0F8ull),X(0x02F1F731D1ull), \
+	X(0x03567D2E64ull),X(0x03BB02A732ull),X(0x041F878CBAull),X(0x04840BCF7Aull),X(0x04E88F5FF4ull),X(0x054D122EA7ull),X(0x05B1942C13ull),X(0x06161548B8ull), \
+	X(0x067A957517ull),X(0x06DF14A1AFull),X(0x074392BF01ull),X(0x07A80FBD8Full),X(0x080C8B8DD8ull),X(0x087106205Eull),X(0x08D57F65A3ull),X(0x0939F74E27ull), \
+	X(0x099E6DCA6Dull),X(0x0A02E2CAF5ull),X(0x0A67564044ull),X(0x0ACBC81AD9ull),X(0x0B30384B39ull),X(0x0B94A6C1E7ull),X(0x0BF9136F64ull),X(0x0C5D7E4435ull), \
+	X(0x0CC1E730DEull),X(0x0D264E25E2ull),X(0x0D8AB313C5ull),X(0x0DEF15EB0Dull),X(0x0E53769C3Eull),X(0x0EB7D517DDull),X(0x0F1C314E70ull),X(0x0F808B307Dull), \
+	X(0x0FE4E2AE8Bull),X(0x104937B91Full),X(0x10AD8A40C1ull),X(0x1111DA35F8ull),X(0x117627894Dull),X(0x11DA722B47ull),X(0x123EBA0C6Full),X(0x12A2FF1D4Eull), \
+	X(0x1307414E6Eull),X(0x136B809059ull),X(0x13CFBCD398ull),X(0x1433F608B7ull),X(0x14982C2042ull),X(0x14FC5F0AC4ull),X(0x15608EB8C8ull),X(0x15C4BB1ADDull), \
+	X(0x1628E42190ull),X(0x168D09BD6Eull),X(0x16F12BDF05ull),X(0x17554A76E5ull),X(0x17B965759Dull),X(0x181D7CCBBDull),X(0x18819069D5ull),X(0x18E5A04077ull), \
+	X(0x1949AC4034ull),X(0x19ADB459A0ull),X(0x1A11B87D4Bull),X(0x1A75B89BCBull),X(0x1AD9B4A5B3ull),X(0x1B3DAC8B98ull),X(0x1BA1A03E10ull),X(0x1C058FADB0ull), \
+	X(0x1C697ACB0Full),X(0x1CCD6186C5ull),X(0x1D3143D16Aull),X(0x1D95219B95ull),X(0x1DF8FAD5E2ull),X(0x1E5CCF70EAull),X(0x1EC09F5D47ull),X(0x1F246A8B96ull), \
+	X(0x1F8830EC73ull),X(0x1FEBF2707Aull),X(0x204FAF084Aull),X(0x20B366A481ull),X(0x21171935BEull),X(0x217AC6ACA2ull),X(0x21DE6EF9CDull),X(0x2242120DE1ull), \
+	X(0x22A5AFD981ull),X(0x2309484D50ull),X(0x236CDB59F1ull),X(0x23D068F00Bull),X(0x2433F10042ull),X(0x2497737B3Eull),X(0x24FAF051A6ull),X(0x255E677422ull), \
+	X(0x25C1D8D35Bull),X(0x2625445FFDull),X(0x2688AA0AB1ull),X(0x26EC09C424ull),X(0x274F637D02ull),X(0x27B2B725FAull),X(0x281604AFBAull),X(0x28794C0AF2ull), \
+	X(0x28DC8D2852ull),X(0x293FC7F88Dull),X(0x29A2FC6C54ull),X(0x2A062A745Bull),X(0x2A69520157ull),X(0x2ACC7303FDull),X(0x2B2F8D6D04ull),X(0x2B92A12D24ull), \
+	X(0x2BF5AE3514ull),X(0x2C58B4758Full),X(0x2CBBB3DF4Full),X(0x2D1EAC6310ull),X(0x2D819DF18Full),X(0x2DE4887B8Aull),X(0x2E476BF1BFull),X(0x2EAA4844EFull), \
+	X(0x2F0D1D65DAull),X(0x2F6FEB4544ull),X(0x2FD2B1D3EFull),X(0x30357102A0ull),X(0x309828C21Cull),X(0x30FAD9032Bull),X(0x315D81B694ull),X(0x31C022CD20ull), \
+	X(0x3222BC379Aull),X(0x32854DE6CDull),X(0x32E7D7CB86ull),X(0x334A59D692ull),X(0x33ACD3F8C1ull),X(0x340F4622E3ull),X(0x3471B045C9ull),X(0x34D4125246ull), \
+	X(0x35366C392Eull),X(0x3598BDEB57ull),X(0x35FB075997ull),X(0x365D4874C6ull),X(0x36BF812DBCull),X(0x3721B17555ull),X(0x3783D93C6Bull),X(0x37E5F873DCull), \
+	X(0x38480F0C86ull),X(0x38AA1CF749ull),X(0x390C222506ull),X(0x396E1E869Full),X(0x39D0120CF7ull),X(0x3A31FCA8F5ull),X(0x3A93DE4B7Dull),X(0x3AF5B6E578ull), \
+	X(0x3B578667D0ull),X(0x3BB94CC36Eull),X(0x3C1B09E93Full),X(0x3C7CBDCA30ull),X(0x3CDE685731ull),X(0x3D40098130ull),X(0x3DA1A13921ull),X(0x3E032F6FF6ull), \
+	X(0x3E64B416A4ull),X(0x3EC62F1E21ull),X(0x3F27A07764ull),X(0x3F89081367ull),X(0x3FEA65E325ull),X(0x404BB9D79Aull),X(0x40AD03E1C2ull),X(0x410E43F29Eull), \
+	X(0x416F79FB2Eull),X(0x41D0A5EC74ull),X(0x4231C7B775ull),X(0x4292DF4D35ull),X(0x42F3EC9EBCull),X(0x4354EF9D11ull),X(0x43B5E83940ull),X(0x4416D66454ull), \
+	X(0x4477BA0F59ull),X(0x44D8932B61ull),X(0x453961A97Aull),X(0x459A257AB7ull),X(0x45FADE902Cull),X(0x465B8CDAEEull),X(0x46BC304C15ull),X(0x471CC8D4B9ull), \
+	X(0x477D5665F6ull),X(0x47DDD8F0E7ull),X(0x483E5066AAull),X(0x489EBCB85Full),X(0x48FF1DD727ull),X(0x495F73B426ull),X(0x49BFBE407Full),X(0x4A1FFD6D5Bull), \
+	X(0x4A80312BE1ull),X(0x4AE0596D3Aull),X(0x4B40762294ull),X(0x4BA0873D1Cull),X(0x4C008CAE01ull),X(0x4C60866674ull),X(0x4CC07457A8ull),X(0x4D205672D3ull), \
+	X(0x4D802CA92Aull),X(0x4DDFF6EBE8ull),X(0x4E3FB52C45ull),X(0x4E9F675B7Dull),X(0x4EFF0D6AD1ull),X(0x4F5EA74B7Eull),X(0x4FBE34EEC7ull),X(0x501DB645EFull), \
+	X(0x507D2B423Dull),X(0x50DC93D4F8ull),X(0x513BEFEF68ull),X(0x519B3F82DAull),X(0x51FA82809Bull),X(0x5259B8D9FAull),X(0x52B8E28048ull),X(0x5317FF64D8ull), \
+	X(0x53770F78FFull),X(0x53D612AE15ull),X(0x543508F573ull),X(0x5493F24073ull),X(0x54F2CE8072ull),X(0x55519DA6D0ull),X(0x55B05FA4EEull),X(0x560F146C2Full), \
+	X(0x566DBBEDF8ull),X(0x56CC561BB0ull),X(0x572AE2E6C0ull),X(0x5789624094ull),X(0x57E7D41A9Aull),X(0x5846386640ull),X(0x58A48F14F8ull),X(0x5902D81836ull), \
+	X(0x5961136170ull),X(0x59BF40E21Dull),X(0x5A1D608BB8ull),X(0x5A7B724FBCull),X(0x5AD9761FA9ull),X(0x5B376BECFDull),X(0x5B9553A93Dull),X(0x5BF32D45EDull), \
+	X(0x5C50F8B493ull),X(0x5CAEB5E6B9ull),X(0x5D0C64CDEBull),X(0x5D6A055BB5ull),X(0x5DC79781A7ull),X(0x5E251B3154ull),X(0x5E82905C50ull),X(0x5EDFF6F431ull), \
+	X(0x5F3D4EEA8Full),X(0x5F9A983107ull),X(0x5FF7D2B934ull),X(0x6054FE74B6ull),X(0x60B21B5530ull),X(0x610F294C45ull),X(0x616C284B9Cull),X(0x61C91844DDull), \
+	X(0x6225F929B3ull),X(0x6282CAEBCBull),X(0x62DF8D7CD6ull),X(0x633C40CE85ull),X(0x6398E4D28Cull),X(0x63F5797AA3ull),X(0x6451FEB882ull),X(0x64AE747DE4ull), \
+	X(0x650ADABC88ull),X(0x656731662Eull),X(0x65C3786C98ull),X(0x661FAFC18Bull),X(0x667BD756CFull),X(0x66D7EF1E2Eull),X(0x6733F70974ull),X(0x678FEF0A70ull), \
+	X(0x67EBD712F3ull),X(0x6847AF14D0ull),X(0x68A37701DEull),X(0x68FF2ECBF6ull),X(0x695AD664F3ull),X(0x69B66DBEB1ull),X(0x6A11F4CB12ull),X(0x6A6D6B7BF8ull), \
+	X(0x6AC8D1C348ull),X(0x6B242792EAull),X(0x6B7F6CDCC8ull),X(0x6BDAA192CFull),X(0x6C35C5A6EEull),X(0x6C90D90B17ull),X(0x6CEBDBB13Full),X(0x6D46CD8B5Cull), \
+	X(0x6DA1AE8B69ull),X(0x6DFC7EA361ull),X(0x6E573DC543ull),X(0x6EB1EBE312ull),X(0x6F0C88EED0ull),X(0x6F6714DA85ull),X(0x6FC18F983Aull),X(0x701BF919FBull), \
+	X(0x70765151D6ull),X(0x70D09831DEull),X(0x712ACDAC25ull),X(0x7184F1B2C4ull),X(0x71DF0437D2ull),X(0x7239052D6Dull),X(0x7292F485B3ull),X(0x72ECD232C5ull), \
+	X(0x73469E26C9ull),X(0x73A05853E3ull),X(0x73FA00AC40ull),X(0x745397220Aull),X(0x74AD1BA771ull),X(0x75068E2EA8ull),X(0x755FEEA9E2ull),X(0x75B93D0B58ull), \
+	X(0x7612794543ull),X(0x766BA349E2ull),X(0x76C4BB0B73ull),X(0x771DC07C3Aull),X(0x7776B38E7Cull),X(0x77CF943481ull),X(0x7828626095ull),X(0x78811E0507ull), \
+	X(0x78D9C71426ull),X(0x79325D8047ull),X(0x798AE13BC0ull),X(0x79E35238ECull),X(0x7A3BB06A25ull),X(0x7A93FBC1CDull),X(0x7AEC343245ull),X(0x7B4459ADF2ull), \
+	X(0x7B9C6C273Dull),X(0x7BF46B9090ull),X(0x7C4C57DC5Aull),X(0x7CA430FD0Bull),X(0x7CFBF6E518ull),X(0x7D53A986F7ull),X(0x7DAB48D521ull),X(0x7E02D4C215ull), \
+	X(0x7E5A4D4051ull),X(0x7EB1B24259ull),X(0x7F0903BAB2ull),X(0x7F60419BE5ull),X(0x7FB76BD87Eull),X(0x800E82630Bull),X(0x8065852E20ull),X(0x80BC742C50ull), \
+	X(0x81134F5033ull),X(0x816A168C66ull),X(0x81C0C9D385ull),X(0x8217691832ull),X(0x826DF44D11ull),X(0x82C46B64CAull),X(0x831ACE5207ull),X(0x83711D0776ull), \
+	X(0x83C75777C8ull),X(0x841D7D95B0ull),X(0x84738F53E5ull),X(0x84C98CA522ull),X(0x851F757C23ull),X(0x857549CBA9ull),X(0x85CB098679ull),X(0x8620B49F58ull), \
+	X(0x86764B0910ull),X(0x86CBCCB66Full),X(0x8721399A45ull),X(0x877691A765ull),X(0x87CBD4D0A6ull),X(0x88210308E3ull),X(0x88761C42F8ull),X(0x88CB2071C6ull), \
+	X(0x89200F8831ull),X(0x8974E9791Full),X(0x89C9AE377Bull),X(0x8A1E5DB632ull),X(0x8A72F7E835ull),X(0x8AC77CC078ull),X(0x8B1BEC31F2ull),X(0x8B70462F9Eull), \
+	X(0x8BC48AAC7Aull),X(0x8C18B99B87ull),X(0x8C6CD2EFCAull),X(0x8CC0D69C4Bull),X(0x8D14C49414ull),X(0x8D689CCA35ull),X(0x8DBC5F31BFull),X(0x8E100BBDC7ull), \
+	X(0x8E63A26167ull),X(0x8EB7230FBBull),X(0x8F0A8DBBE1ull),X(0x8F5DE258FEull),X(0x8FB120DA36ull),X(0x90044932B4ull),X(0x90575B55A4ull),X(0x90AA573638ull), \
+	X(0x90FD3CC7A3ull),X(0x91500BFD1Cull),X(0x91A2C4C9DEull),X(0x91F5672129ull),X(0x9247F2F63Cull),X(0x929A683C5Eull),X(0x92ECC6E6D7ull),X(0x933F0EE8F4ull), \
+	X(0x9391403603ull),X(0x93E35AC159ull),X(0x94355E7E4Cull),X(0x94874B6036ull),X(0x94D9215A74ull),X(0x952AE06069ull),X(0x957C886578ull),X(0x95CE195D0Bull), \
+	X(0x961F933A8Dull),X(0x9670F5F16Dull),X(0x96C241751Full),X(0x971375B919ull),X(0x976492B0D5ull),X(0x97B5984FD1ull),X(0x980686898Full),X(0x98575D5194ull), \
+	X(0x98A81C9B67ull),X(0x98F8C45A96ull),X(0x99495482B0ull),X(0x9999CD0749ull),X(0x99EA2DDBF8ull),X(0x9A3A76F457ull),X(0x9A8AA84405ull),X(0x9ADAC1BEA4ull), \
+	X(0x9B2AC357DBull),X(0x9B7AAD0352ull),X(0x9BCA7EB4B6ull),X(0x9C1A385FBAull),X(0x9C69D9F810ull),X(0x9CB9637171ull),X(0x9D08D4BF9Aull),X(0x9D582DD64Aull), \
+	X(0x9DA76EA945ull),X(0x9DF6972C51ull),X(0x9E45A7533Bull),X(0x9E949F11CFull),X(0x9EE37E5BE2ull),X(0x9F32452549ull),X(0x9F80F361DEull),X(0x9FCF89057Full), \
+	X(0xA01E06040Eull),X(0xA06C6A516Full),X(0xA0BAB5E18Dull),X(0xA108E8A855ull),X(0xA1570299B6ull),X(0xA1A503A9A6ull),X(0xA1F2EBCC1Eull),X(0xA240BAF519ull), \
+	X(0xA28E711899ull),X(0xA2DC0E2AA0ull),X(0xA329921F37ull),X(0xA376FCEA6Aull),X(0xA3C44E8049ull),X(0xA41186D4E6ull),X(0xA45EA5DC5Bull),X(0xA4ABAB8AC0ull), \
+	X(0xA4F897D438ull),X(0xA5456AACE3ull),X(0xA5922408EAull),X(0xA5DEC3DC78ull),X(0xA62B4A1BBBull),X(0xA677B6BAE6ull),X(0xA6C409AE32ull),X(0xA71042E9D7ull), \
+	X(0xA75C626215ull),X(0xA7A8680B2Full),X(0xA7F453D96Cull),X(0xA84025C116ull),X(0xA88BDDB67Cull),X(0xA8D77BADF1ull),X(0xA922FF9BCCull),X(0xA96E697467ull), \
+	X(0xA9B9B92C21ull),X(0xAA04EEB75Eull),X(0xAA500A0A83ull),X(0xAA9B0B19FCull),X(0xAAE5F1DA37ull),X(0xAB30BE3FA9ull),X(0xAB7B703EC7ull),X(0xABC607CC0Dull), \
+	X(0xAC1084DBFBull),X(0xAC5AE76313ull),X(0xACA52F55DCull),X(0xACEF5CA8E4ull),X(0xAD396F50B8ull),X(0xAD836741EDull),X(0xADCD44711Bull),X(0xAE1706D2DDull), \
+	X(0xAE60AE5BD4ull),X(0xAEAA3B00A3ull),X(0xAEF3ACB5F4ull),X(0xAF3D037073ull),X(0xAF863F24D1ull),X(0xAFCF5FC7C1ull),X(0xB018654DFFull),X(0xB0614FAC46ull), \
+	X(0xB0AA1ED758ull),X(0xB0F2D2C3FAull),X(0xB13B6B66F7ull),X(0xB183E8B51Dull),X(0xB1CC4AA33Dull),X(0xB21491262Full),X(0xB25CBC32CCull),X(0xB2A4CBBDF4ull), \
+	X(0xB2ECBFBC8Aull),X(0xB334982376ull),X(0xB37C54E7A2ull),X(0xB3C3F5FE00ull),X(0xB40B7B5B82ull),X(0xB452E4F522ull),X(0xB49A32BFDDull),X(0xB4E164B0B3ull), \
+	X(0xB5287ABCA9ull),X(0xB56F74D8CAull),X(0xB5B652FA23ull),X(0xB5FD1515C7ull),X(0xB643BB20CCull),X(0xB68A45104Cull),X(0xB6D0B2D969ull),X(0xB717047143ull), \
+	X(0xB75D39CD05ull),X(0xB7A352E1DAull),X(0xB7E94FA4F2ull),X(0xB82F300B83ull),X(0xB874F40AC7ull),X(0xB8BA9B97FAull),X(0xB90026A85Full),X(0xB94595313Cull), \
+	X(0xB98AE727DDull),X(0xB9D01C8191ull),X(0xBA153533ACull),X(0xBA5A313385ull),X(0xBA9F10767Aull),X(0xBAE3D2F1EBull),X(0xBB28789B3Eull),X(0xBB6D0167DDull), \
+	X(0xBBB16D4D36ull),X(0xBBF5BC40BCull),X(0xBC39EE37E6ull),X(0xBC7E032831ull),X(0xBCC1FB071Cull),X(0xBD05D5CA2Cull),X(0xBD499366EAull),X(0xBD8D33D2E4ull), \
+	X(0xBDD0B703ACull),X(0xBE141CEED9ull),X(0xBE57658A07ull),X(0xBE9A90CAD4ull),X(0xBEDD9EA6E5ull),X(0xBF208F13E3ull),X(0xBF6362077Cull),X(0xBFA6177760ull), \
+	X(0xBFE8AF5948ull),X(0xC02B29A2EDull),X(0xC06D864A0Full),X(0xC0AFC54473ull),X(0xC0F1E687E0ull),X(0xC133EA0A25ull),X(0xC175CFC113ull),X(0xC1B797A281ull), \
+	X(0xC1F941A44Aull),X(0xC23ACDBC4Dull),X(0xC27C3BE06Full),X(0xC2BD8C0699ull),X(0xC2FEBE24B7ull),X(0xC33FD230BEull),X(0xC380C820A2ull),X(0xC3C19FEA60ull), \
+	X(0xC4025983F8ull),X(0xC442F4E36Full),X(0xC48371FECDull),X(0xC4C3D0CC22ull),X(0xC50411417Full),X(0xC5443354FDull),X(0xC58436FCB7ull),X(0xC5C41C2ECEull), \
+	X(0xC603E2E168ull),X(0xC6438B0AAFull),X(0xC68314A0D2ull),X(0xC6C27F9A04ull),X(0xC701CBEC7Eull),X(0xC740F98E7Dull),X(0xC780087643ull),X(0xC7BEF89A16ull), \
+	X(0xC7FDC9F042ull),X(0xC83C7C6F17ull),X(0xC87B100CE9ull),X(0xC8B984C012ull),X(0xC8F7DA7EF1ull),X(0xC936113FE8ull),X(0xC97428F95Full),X(0xC9B221A1C4ull), \
+	X(0xC9EFFB2F87ull),X(0xCA2DB59920ull),X(0xCA6B50D508ull),X(0xCAA8CCD9C0ull),X(0xCAE6299DCCull),X(0xCB236717B7ull),X(0xCB60853E0Eull),X(0xCB9D840764ull), \
+	X(0xCBDA636A52ull),X(0xCC17235D74ull),X(0xCC53C3D76Cull),X(0xCC9044CEE1ull),X(0xCCCCA63A7Eull),X(0xCD08E810F4ull),X(0xCD450A48F6ull),X(0xCD810CD940ull), \
+	X(0xCDBCEFB891ull),X(0xCDF8B2DDACull),X(0xCE34563F59ull),X(0xCE6FD9D467ull),X(0xCEAB3D93A8ull),X(0xCEE68173F3ull),X(0xCF21A56C24ull),X(0xCF5CA9731Eull), \
+	X(0xCF978D7FC5ull),X(0xCFD2518905ull),X(0xD00CF585CFull),X(0xD047796D16ull),X(0xD081DD35D6ull),X(0xD0BC20D70Cull),X(0xD0F64447BDull),X(0xD130477EF1ull), \
+	X(0xD16A2A73B7ull),X(0xD1A3ED1D20ull),X(0xD1DD8F7245ull),X(0xD217116A42ull),X(0xD25072FC3Aull),X(0xD289B41F51ull),X(0xD2C2D4CAB6ull),X(0xD2FBD4F597ull), \
+	X(0xD334B4972Bull),X(0xD36D73A6ADull),X(0xD3A6121B5Cull),X(0xD3DE8FEC7Dull),X(0xD416ED1159ull),X(0xD44F298141ull),X(0xD487453387ull),X(0xD4BF401F84ull), \
+	X(0xD4F71A3C97ull),X(0xD52ED38222ull),X(0xD5666BE78Eull),X(0xD59DE36448ull),X(0xD5D539EFC2ull),X(0xD60C6F8173ull),X(0xD6438410D8ull),X(0xD67A779573ull), \
+	X(0xD6B14A06CAull),X(0xD6E7FB5C68ull),X(0xD71E8B8DDFull),X(0xD754FA92C4ull),X(0xD78B4862B3ull),X(0xD7C174F54Bull),X(0xD7F7804232ull),X(0xD82D6A4113ull), \
+	X(0xD86332E99Dull),X(0xD898DA3384ull),X(0xD8CE601683ull),X(0xD903C48A58ull),X(0xD9390786C8ull),X(0xD96E29039Cull),X(0xD9A328F8A2ull),X(0xD9D8075DAEull), \
+	X(0xDA0CC42A99ull),X(0xDA415F5742ull),X(0xDA75D8DB8Aull),X(0xDAAA30AF5Bull),X(0xDADE66CAA1ull),X(0xDB127B2551ull),X(0xDB466DB761ull),X(0xDB7A3E78D0ull), \
+	X(0xDBADED619Full),X(0xDBE17A69D6ull),X(0xDC14E58982ull),X(0xDC482EB8B5ull),X(0xDC7B55EF86ull),X(0xDCAE5B2612ull),X(0xDCE13E547Aull),X(0xDD13FF72E7ull), \
+	X(0xDD469E7983ull),X(0xDD791B6081ull),X(0xDDAB762017ull),X(0xDDDDAEB082ull),X(0xDE0FC50A03ull),X(0xDE41B924E0ull),X(0xDE738AF965ull),X(0xDEA53A7FE4ull), \
+	X(0xDED6C7B0B3ull),X(0xDF0832842Eull),X(0xDF397AF2B6ull),X(0xDF6AA0F4B1ull),X(0xDF9BA4828Bull),X(0xDFCC8594B5ull),X(0xDFFD4423A6ull),X(0xE02DE027D8ull), \
+	X(0xE05E5999CEull),X(0xE08EB0720Cull),X(0xE0BEE4A920ull),X(0xE0EEF63799ull),X(0xE11EE5160Full),X(0xE14EB13D1Dull),X(0xE17E5AA563ull),X(0xE1ADE14789ull), \
+	X(0xE1DD451C3Aull),X(0xE20C861C27ull),X(0xE23BA44007ull),X(0xE26A9F8096ull),X(0xE29977D694ull),X(0xE2C82D3AC9ull),X(0xE2F6BFA600ull),X(0xE3252F110Bull), \
+	X(0xE3537B74C1ull),X(0xE381A4C9FEull),X(0xE3AFAB09A3ull),X(0xE3DD8E2C98ull),X(0xE40B4E2BC8ull),X(0xE438EB0027ull),X(0xE46664A2ABull),X(0xE493BB0C50ull), \
+	X(0xE4C0EE361Aull),X(0xE4EDFE190Full),X(0xE51AEAAE3Dull),X(0xE547B3EEB5ull),X(0xE57459D391ull),X(0xE5A0DC55EDull),X(0xE5CD3B6EEDull),X(0xE5F97717B8ull), \
+	X(0xE6258F497Cull),X(0xE65183FD6Cull),X(0xE67D552CC2ull),X(0xE6A902D0BBull),X(0xE6D48CE29Aull),X(0xE6FFF35BAAull),X(0xE72B363539ull),X(0xE75655689Aull), \
+	X(0xE78150EF28ull),X(0xE7AC28C241ull),X(0xE7D6DCDB4Bull),X(0xE8016D33AFull),X(0xE82BD9C4DDull),X(0xE85622884Aull),X(0xE880477771ull),X(0xE8AA488BD1ull), \
+	X(0xE8D425BEF2ull),X(0xE8FDDF0A5Eull),X(0xE9277467A5ull),X(0xE950E5D05Full),X(0xE97A333E27ull),X(0xE9A35CAA9Eull),X(0xE9CC620F6Cull),X(0xE9F543663Dull), \
+	X(0xEA1E00A8C3ull),X(0xEA4699D0B6ull),X(0xEA6F0ED7D3ull),X(0xEA975FB7DDull),X(0xEABF8C6A9Dull),X(0xEAE794E9DFull),X(0xEB0F792F79ull),X(0xEB37393543ull), \
+	X(0xEB5ED4F51Bull),X(0xEB864C68E6ull),X(0xEBAD9F8A8Full),X(0xEBD4CE5403ull),X(0xEBFBD8BF3Aull),X(0xEC22BEC62Dull),X(0xEC498062DCull),X(0xEC701D8F4Eull), \
+	X(0xEC9696458Full),X(0xECBCEA7FAFull),X(0xECE31A37C5ull),X(0xED092567EEull),X(0xED2F0C0A4Cull),X(0xED54CE1906ull),X(0xED7A6B8E4Aull),X(0xED9FE4644Cull), \
+	X(0xEDC5389542ull),X(0xEDEA681B6Dull),X(0xEE0F72F110ull),X(0xEE34591074ull),X(0xEE591A73E9ull),X(0xEE7DB715C4ull),X(0xEEA22EF060ull),X(0xEEC681FE1Cull), \
+	X(0xEEEAB0395Eull),X(0xEF0EB99C93ull),X(0xEF329E222Cull),X(0xEF565DC49Full),X(0xEF79F87E6Aull),X(0xEF9D6E4A0Eull),X(0xEFC0BF2215ull),X(0xEFE3EB010Bull), \
+	X(0xF006F1E184ull),X(0xF029D3BE19ull),X(0xF04C90916Aull),X(0xF06F28561Aull),X(0xF0919B06D5ull),X(0xF0B3E89E4Aull),X(0xF0D611172Full),X(0xF0F8146C3Full), \
+	X(0xF119F2983Cull),X(0xF13BAB95EDull),X(0xF15D3F601Eull),X(0xF17EADF1A2ull),X(0xF19FF74550ull),X(0xF1C11B5608ull),X(0xF1E21A1EACull),X(0xF202F39A26ull), \
+	X(0xF223A7C365ull),X(0xF24436955Eull),X(0xF264A00B0Bull),X(0xF284E41F6Eull),X(0xF2A502CD8Bull),X(0xF2C4FC1070ull),X(0xF2E4CFE32Eull),X(0xF3047E40DCull), \
+	X(0xF324072498ull),X(0xF3436A8985ull),X(0xF362A86ACBull),X(0xF381C0C39Aull),X(0xF3A0B38F25ull),X(0xF3BF80C8A7ull),X(0xF3DE286B60ull),X(0xF3FCAA7295ull), \
+	X(0xF41B06D993ull),X(0xF4393D9BAAull),X(0xF4574EB432ull),X(0xF4753A1E88ull),X(0xF492FFD60Full),X(0xF4B09FD62Full),X(0xF4CE1A1A57ull),X(0xF4EB6E9DFBull), \
+	X(0xF5089D5C95ull),X(0xF525A651A4ull),X(0xF5428978B0ull),X(0xF55F46CD43ull),X(0xF57BDE4AEFull),X(0xF5984FED4Bull),X(0xF5B49BAFF4ull),X(0xF5D0C18E8Dull), \
+	X(0xF5ECC184BFull),X(0xF6089B8E38ull),X(0xF6244FA6ADull),X(0xF63FDDC9D8ull),X(0xF65B45F379ull),X(0xF676881F57ull),X(0xF691A4493Dull),X(0xF6AC9A6CFDull), \
+	X(0xF6C76A866Eull),X(0xF6E214916Full),X(0xF6FC9889E2ull),X(0xF716F66BB0ull),X(0xF7312E32CAull),X(0xF74B3FDB22ull),X(0xF7652B60B5ull),X(0xF77EF0BF84ull), \
+	X(0xF7988FF394ull),X(0xF7B208F8F3ull),X(0xF7CB5BCBB2ull),X(0xF7E48867EAull),X(0xF7FD8EC9B9ull),X(0xF8166EED43ull),X(0xF82F28CEB2ull),X(0xF847BC6A36ull), \
+	X(0xF86029BC05ull),X(0xF87870C05Bull),X(0xF890917378ull),X(0xF8A88BD1A4ull),X(0xF8C05FD72Eull),X(0xF8D80D8067ull),X(0xF8EF94C9AAull),X(0xF906F5AF55ull), \
+	X(0xF91E302DCEull),X(0xF93544417Full),X(0xF94C31E6DAull),X(0xF962F91A54ull),X(0xF97999D86Cull),X(0xF990141DA3ull),X(0xF9A667E683ull),X(0xF9BC952F99ull), \
+	X(0xF9D29BF57Aull),X(0xF9E87C34C2ull),X(0xF9FE35EA0Full),X(0xFA13C91209ull),X(0xFA2935A95Bull),X(0xFA3E7BACB9ull),X(0xFA539B18D9ull),X(0xFA6893EA7Bull), \
+	X(0xFA7D661E61ull),X(0xFA9211B157ull),X(0xFAA696A02Dull),X(0xFABAF4E7B7ull),X(0xFACF2C84D2ull),X(0xFAE33D7460ull),X(0xFAF727B349ull),X(0xFB0AEB3E7Bull), \
+	X(0xFB1E8812E8ull),X(0xFB31FE2D8Cull),X(0xFB454D8B65ull),X(0xFB58762979ull),X(0xFB6B7804D5ull),X(0xFB7E531A89ull),X(0xFB910767ADull),X(0xFBA394E95Full), \
+	X(0xFBB5FB9CC3ull),X(0xFBC83B7F01ull),X(0xFBDA548D4Aull),X(0xFBEC46C4D3ull),X(0xFBFE1222D7ull),X(0xFC0FB6A498ull),X(0xFC2134475Eull),X(0xFC328B0875ull), \
+	X(0xFC43BAE533ull),X(0xFC54C3DAEFull),X(0xFC65A5E709ull),X(0xFC766106E8ull),X(0xFC86F537F5ull),X(0xFC976277A4ull),X(0xFCA7A8C36Bull),X(0xFCB7C818C8ull), \
+	X(0xFCC7C0753Full),X(0xFCD791D658ull),X(0xFCE73C39A4ull),X(0xFCF6BF9CB8ull),X(0xFD061BFD2Full),X(0xFD155158ACull),X(0xFD245FACD5ull),X(0xFD3346F759ull), \
+	X(0xFD420735EBull),X(0xFD50A06644ull),X(0xFD5F128625ull),X(0xFD6D5D9353ull),X(0xFD7B818B99ull),X(0xFD897E6CCAull),X(0xFD975434BEull),X(0xFDA502E151ull), \
+	X(0xFDB28A7069ull),X(0xFDBFEADFEEull),X(0xFDCD242DD1ull),X(0xFDDA365808ull),X(0xFDE7215C8Full),X(0xFDF3E53967ull),X(0xFE0081EC99ull),X(0xFE0CF77433ull), \
+	X(0xFE1945CE48ull),X(0xFE256CF8F4ull),X(0xFE316CF257ull),X(0xFE3D45B895ull),X(0xFE48F749DDull),X(0xFE5481A460ull),X(0xFE5FE4C657ull),X(0xFE6B20AE00ull), \
+	X(0xFE763559A0ull),X(0xFE8122C781ull),X(0xFE8BE8F5F3ull),X(0xFE9687E34Eull),X(0xFEA0FF8DEFull),X(0xFEAB4FF437ull),X(0xFEB5791490ull),X(0xFEBF7AED68ull), \
+	X(0xFEC9557D35ull),X(0xFED308C272ull),X(0xFEDC94BB9Full),X(0xFEE5F96744ull),X(0xFEEF36C3EEull),X(0xFEF84CD02Full),X(0xFF013B8AA3ull),X(0xFF0A02F1E7ull), \
+	X(0xFF12A304A1ull),X(0xFF1B1BC17Dull),X(0xFF236D272Bull),X(0xFF2B973465ull),X(0xFF3399E7E8ull),X(0xFF3B754076ull),X(0xFF43293CDBull),X(0xFF4AB5DBE6ull), \
+	X(0xFF521B1C6Cull),X(0xFF5958FD4Bull),X(0xFF606F7D64ull),X(0xFF675E9B9Full),X(0xFF6E2656EAull),X(0xFF74C6AE3Bull),X(0xFF7B3FA08Aull),X(0xFF81912CDAull), \
+	X(0xFF87BB522Full),X(0xFF8DBE0F98ull),X(0xFF93996426ull),X(0xFF994D4EF3ull),X(0xFF9ED9CF1Dull),X(0xFFA43EE3C9ull),X(0xFFA97C8C23ull),X(0xFFAE92C75Bull), \
+	X(0xFFB38194A8ull),X(0xFFB848F348ull),X(0xFFBCE8E27Eull),X(0xFFC1616194ull),X(0xFFC5B26FD9ull),X(0xFFC9DC0CA3ull),X(0xFFCDDE374Cull),X(0xFFD1B8EF38ull), \
+	X(0xFFD56C33CEull),X(0xFFD8F8047Cull),X(0xFFDC5C60B5ull),X(0xFFDF9947F4ull),X(0xFFE2AEB9BAull),X(0xFFE59CB58Cull),X(0xFFE8633AF6ull),X(0xFFEB02498Cull), \
+	X(0xFFED79E0E5ull),X(0xFFEFCA00A0ull),X(0xFFF1F2A862ull),X(0xFFF3F3D7D6ull),X(0xFFF5CD8EADull),X(0xFFF77FCC9Dull),X(0xFFF90A9164ull),X(0xFFFA6DDCC4ull), \
 	X(0xFFFBA9AE87ull),X(0xFFFCBE067Cull),X(0xFFFDAAE479ull),X(0xFFFE704859ull),X(0xFFFF0E31FDull),X(0xFFFF84A14Dull),X(0xFFFFD39638ull),X(0xFFFFFB10B0ull),
-	X(0x001921FB49ull),X(0x004B65F0E5ull),X(0x007DA9E399ull),X(0x00AFEDD174ull),X(0x00E231B887ull),X(0x01147596E2ull),X(0x0146B96A94ull),X(0x0178FD31ADull),
-	X(0x01AB40EA3Eull),X(0x01DD849256ull),X(0x020FC82805ull),X(0x02420BA95Bull),X(0x02744F1468ull),X(0x02A692673Cull),X(0x02D8D59FE6ull),X(0x030B18BC77ull),
-	X(0x033D5BBAFFull),X(0x036F9E998Dull),X(0x03A1E15632ull),X(0x03D423EEFEull),X(0x04066661FFull),X(0x0438A8AD47ull),X(0x046AEACEE6ull),X(0x049D2CC4EBull),
-	X(0x04CF6E8D66ull),X(0x0501B02667ull),X(0x0533F18DFEull),X(0x056632C23Cull),X(0x059873C130ull),X(0x05CAB488EAull),X(0x05FCF5177Bull),X(0x062F356AF2ull),
-	X(0x066175815Full),X(0x0693B558D2ull),X(0x06C5F4EF5Cull),X(0x06F834430Dull),X(0x072A7351F4ull),X(0x075CB21A22ull),X(0x078EF099A7ull),X(0x07C12ECE93ull),
-	X(0x07F36CB6F5ull),X(0x0825AA50DFull),X(0x0857E79A60ull),X(0x088A249189ull),X(0x08BC613469ull),X(0x08EE9D8111ull),X(0x0920D97591ull),X(0x0953150FF9ull),
-	X(0x0985504E5Aull),X(0x09B78B2EC4ull),X(0x09E9C5AF46ull),X(0x0A1BFFCDF1ull),X(0x0A4E3988D6ull),X(0x0A8072DE05ull),X(0x0AB2ABCB8Eull),X(0x0AE4E44F81ull),
-	X(0x0B171C67EFull),X(0x0B495412E8ull),X(0x0B7B8B4E7Dull),X(0x0BADC218BDull),X(0x0BDFF86FBAull),X(0x0C122E5183ull),X(0x0C4463BC2Aull),X(0x0C7698ADBEull),
-	X(0x0CA8CD2450ull),X(0x0CDB011DF1ull),X(0x0D0D3498B1ull),X(0x0D3F6792A0ull),X(0x0D719A09D0ull),X(0x0DA3CBFC51ull),X(0x0DD5FD6832ull),X(0x0E082E4B86ull),
-	X(0x0E3A5EA45Cull),X(0x0E6C8E70C6ull),X(0x0E9EBDAED4ull),X(0x0ED0EC5C96ull),X(0x0F031A781Dull),X(0x0F3547FF7Bull),X(0x0F6774F0BFull),X(0x0F99A149FBull),
-	X(0x0FCBCD0940ull),X(0x0FFDF82C9Eull),X(0x103022B226ull),X(0x10624C97E9ull),X(0x109475DBF8ull),X(0x10C69E7C63ull),X(0x10F8C6773Dull),X(0x112AEDCA95ull),
-	X(0x115D14747Eull),X(0x118F3A7307ull),X(0x11C15FC442ull),X(0x11F384663Full),X(0x1225A85711ull),X(0x1257CB94C8ull),X(0x1289EE1D76ull),X(0x12BC0FEF2Bull),
-	X(0x12EE3107F9ull),X(0x13205165F0ull),X(0x1352710724ull),X(0x13848FE9A3ull),X(0x13B6AE0B81ull),X(0x13E8CB6ACEull),X(0x141AE8059Bull),X(0x144D03D9FBull),
-	X(0x147F1EE5FEull),X(0x14B13927B6ull),X(0x14E3529D34ull),X(0x15156B448Bull),X(0x1547831BCBull),X(0x15799A2107ull),X(0x15ABB0524Full),X(0x15DDC5ADB6ull),
-	X(0x160FDA314Dull),X(0x1641EDDB26ull),X(0x167400A952ull),X(0x16A61299E4ull),X(0x16D823AAEEull),X(0x170A33DA81ull),X(0x173C4326AEull),X(0x176E518D89ull),
-	X(0x17A05F0D23ull),X(0x17D26BA38Dull),X(0x1804774EDBull),X(0x1836820D1Eull),X(0x18688BDC68ull),X(0x189A94BACBull),X(0x18CC9CA65Aull),X(0x18FEA39D26ull),
-	X(0x1930A99D43ull),X(0x1962AEA4C1ull),X(0x1994B2B1B4ull),X(0x19C6B5C22Full),X(0x19F8B7D442ull),X(0x1A2AB8E602ull),X(0x1A5CB8F57Full),X(0x1A8EB800CEull),
-	X(0x1AC0B605FFull),X(0x1AF2B30327ull),X(0x1B24AEF657ull),X(0x1B56A9DDA3ull),X(0x1B88A3B71Cull),X(0x1BBA9C80D6ull),X(0x1BEC9438E4ull),X(0x1C1E8ADD58ull),
-	X(0x1C50806C45ull),X(0x1C8274E3BFull),X(0x1CB46841D7ull),X(0x1CE65A84A2ull),X(0x1D184BAA32ull),X(0x1D4A3BB09Aull),X(0x1D7C2A95EDull),X(0x1DAE185840ull),
-	X(0x1DE004F5A4ull),X(0x1E11F06C2Dull),X(0x1E43DAB9EEull),X(0x1E75C3DCFBull),X(0x1EA7ABD367ull),X(0x1ED9929B46ull),X(0x1F0B7832ABull),X(0x1F3D5C97AAull),
-	X(0x1F6F3FC856ull),X(0x1FA121C2C2ull),X(0x1FD3028504ull),X(0x2004E20D2Dull),X(0x2036C05952ull),X(0x20689D6788ull),X(0x209A7935E1ull),X(0x20CC53C271ull),
-	X(0x20FE2D0B4Dull),X(0x2130050E89ull),X(0x2161DBCA38ull),X(0x2193B13C70ull),X(0x21C5856343ull),X(0x21F7583CC6ull),X(0x222929C70Dull),X(0x225AFA002Eull),
-	X(0x228CC8E63Bull),X(0x22BE96774Aull),X(0x22F062B16Full),X(0x23222D92BEull),X(0x2353F7194Cull),X(0x2385BF432Eull),X(0x23B7860E78ull),X(0x23E94B793Full),
-	X(0x241B0F8199ull),X(0x244CD22598ull),X(0x247E936354ull),X(0x24B05338DFull),X(0x24E211A451ull),X(0x2513CEA3BCull),X(0x25458A3538ull),X(0x25774456D8ull),
-	X(0x25A8FD06B2ull),X(0x25DAB442DBull),X(0x260C6A0969ull),X(0x263E1E5871ull),X(0x266FD12E09ull),X(0x26A1828845ull),X(0x26D332653Cull),X(0x2704E0C302ull),
-	X(0x27368D9FAFull),X(0x276838F957ull),X(0x2799E2CE10ull),X(0x27CB8B1BF0ull),X(0x27FD31E10Eull),X(0x282ED71B7Eull),X(0x28607AC957ull),X(0x28921CE8AFull),
-	X(0x28C3BD779Dull),X(0x28F55C7435ull),X(0x2926F9DC90ull),X(0x295895AEC2ull),X(0x298A2FE8E3ull),X(0x29BBC88909ull),X(0x29ED5F8D49ull),X(0x2A1EF4F3BCull),
-	X(0x2A5088BA77ull),X(0x2A821ADF91ull),X(0x2AB3AB6122ull),X(0x2AE53A3D3Full),X(0x2B16C771FFull),X(0x2B4852FD7Bull),X(0x2B79DCDDC7ull),X(0x2BAB6510FDull),
-	X(0x2BDCEB9532ull),X(0x2C0E70687Eull),X(0x2C3FF388F9ull),X(0x2C7174F4B9ull),X(0x2CA2F4A9D6ull),X(0x2CD472A668ull),X(0x2D05EEE885ull),X(0x2D37696E47ull),
-	X(0x2D68E235C3ull),X(0x2D9A593D13ull),X(0x2DCBCE824Dull),X(0x2DFD42038Aull),X(0x2E2EB3BEE2ull),X(0x2E6023B26Cull),X(0x2E9191DC41ull),X(0x2EC2FE3A79ull),
-	X(0x2EF468CB2Bull),X(0x2F25D18C71ull),X(0x2F57387C63ull),X(0x2F889D9919ull),X(0x2FBA00E0ABull),X(0x2FEB625133ull),X(0x301CC1E8C8ull),X(0x304E1FA584ull),
-	X(0x307F7B857Full),X(0x30B0D586D3ull),X(0x30E22DA797ull),X(0x311383E5E5ull),X(0x3144D83FD6ull),X(0x31762AB384ull),X(0x31A77B3F07ull),X(0x31D8C9E079ull),
-	X(0x320A1695F2ull),X(0x323B615D8Eull),X(0x326CAA3564ull),X(0x329DF11B8Full),X(0x32CF360E28ull),X(0x3300790B49ull),X(0x3331BA110Cull),X(0x3362F91D8Aull),
-	X(0x3394362EDEull),X(0x33C5714322ull),X(0x33F6AA5870ull),X(0x3427E16CE1ull),X(0x3459167E91ull),X(0x348A498B9Aull),X(0x34BB7A9215ull),X(0x34ECA9901Eull),
-	X(0x351DD683CFull),X(0x354F016B42ull),X(0x35802A4493ull),X(0x35B1510DDDull),X(0x35E275C539ull),X(0x36139868C4ull),X(0x3644B8F698ull),X(0x3675D76CD0ull),
-	X(0x36A6F3C988ull),X(0x36D80E0ADAull),X(0x3709262EE3ull),X(0x373A3C33BEull),X(0x376B501785ull),X(0x379C61D856ull),X(0x37CD71744Bull),X(0x37FE7EE981ull),
-	X(0x382F8A3612ull),X(0x386093581Cull),X(0x38919A4DBAull),X(0x38C29F1508ull),X(0x38F3A1AC23ull),X(0x3924A21127ull),X(0x3955A04230ull),X(0x39869C3D5Aull),
-	X(0x39B79600C3ull),X(0x39E88D8A86ull),X(0x3A1982D8C1ull),X(0x3A4A75E991ull),X(0x3A7B66BB11ull),X(0x3AAC554B60ull),X(0x3ADD41989Aull),X(0x3B0E2BA0DDull),
-	X(0x3B3F136245ull),X(0x3B6FF8DAF0ull),X(0x3BA0DC08FBull),X(0x3BD1BCEA84ull),X(0x3C029B7DA9ull),X(0x3C3377C087ull),X(0x3C6451B13Cull),X(0x3C95294DE6ull),
-	X(0x3CC5FE94A2ull),X(0x3CF6D1838Full),X(0x3D27A218CBull),X(0x3D58705274ull),X(0x3D893C2EA9ull),X(0x3DBA05AB87ull),X(0x3DEACCC72Eull),X(0x3E1B917FBBull),
-	X(0x3E4C53D34Eull),X(0x3E7D13C006ull),X(0x3EADD14400ull),X(0x3EDE8C5D5Dull),X(0x3F0F450A3Bull),X(0x3F3FFB48B9ull),X(0x3F70AF16F7ull),X(0x3FA1607314ull),
-	X(0x3FD20F5B2Full),X(0x4002BBCD67ull),X(0x403365C7DEull),X(0x40640D48B1ull),X(0x4094B24E01ull),X(0x40C554D5EEull),X(0x40F5F4DE98ull),X(0x412692661Full),
-	X(0x41572D6AA3ull),X(0x4187C5EA44ull),X(0x41B85BE324ull),X(0x41E8EF5361ull),X(0x421980391Dull),X(0x424A0E9279ull),X(0x427A9A5D95ull),X(0x42AB239892ull),
-	X(0x42DBAA4191ull),X(0x430C2E56B3ull),X(0x433CAFD61Aull),X(0x436D2EBDE6ull),X(0x439DAB0C39ull),X(0x43CE24BF35ull),X(0x43FE9BD4FAull),X(0x442F104BACull),
-	X(0x445F82216Bull),X(0x448FF15459ull),X(0x44C05DE298ull),X(0x44F0C7CA4Bull),X(0x45212F0993ull),X(0x4551939E93ull),X(0x4581F5876Dull),X(0x45B254C244ull),
-	X(0x45E2B14D3Aull),X(0x46130B2672ull),X(0x4643624C0Full),X(0x4673B6BC33ull),X(0x46A4087502ull),X(0x46D457749Full),X(0x4704A3B92Dull),X(0x4734ED40CFull),
-	X(0x47653409A9ull),X(0x47957811DEull),X(0x47C5B95792ull),X(0x47F5F7D8E9ull),X(0x4826339406ull),X(0x48566C870Dull),X(0x4886A2B023ull),X(0x48B6D60D6Cull),
-	X(0x48E7069D0Bull),X(0x4917345D26ull),X(0x49475F4BE1ull),X(0x4977876760ull),X(0x49A7ACADC8ull),X(0x49D7CF1D3Full),X(0x4A07EEB3E8ull),X(0x4A380B6FE9ull),
-	X(0x4A68254F67ull),X(0x4A983C5088ull),X(0x4AC8507170ull),X(0x4AF861B045ull),X(0x4B28700B2Dull),X(0x4B587B804Eull),X(0x4B88840DCDull),X(0x4BB889B1D0ull),
-	X(0x4BE88C6A7Eull),X(0x4C188C35FCull),X(0x4C48891271ull),X(0x4C7882FE03ull),X(0x4CA879F6D8ull),X(0x4CD86DFB18ull),X(0x4D085F08E8ull),X(0x4D384D1E70ull),
-	X(0x4D683839D7ull),X(0x4D98205944ull),X(0x4DC8057ADEull),X(0x4DF7E79CCCull),X(0x4E27C6BD35ull),X(0x4E57A2DA42ull),X(0x4E877BF219ull),X(0x4EB75202E3ull),
-	X(0x4EE7250AC8ull),X(0x4F16F507EFull),X(0x4F46C1F880ull),X(0x4F768BDAA5ull),X(0x4FA652AC84ull),X(0x4FD6166C47ull),X(0x5005D71816ull),X(0x503594AE1Aull),
-	X(0x50654F2C7Cull),X(0x5095069165ull),X(0x50C4BADAFDull),X(0x50F46C076Eull),X(0x51241A14E1ull),X(0x5153C5017Full),X(0x51836CCB73ull),X(0x51B31170E6ull),
-	X(0x51E2B2F001ull),X(0x52125146EFull),X(0x5241EC73D9ull),X(0x52718474E9ull),X(0x52A119484Bull),X(0x52D0AAEC28ull),X(0x5300395EABull),X(0x532FC49DFEull),
-	X(0x535F4CA84Cull),X(0x538ED17BC1ull),X(0x53BE531686ull),X(0x53EDD176C8ull),X(0x541D4C9AB2ull),X(0x544CC4806Eull),X(0x547C392628ull),X(0x54ABAA8A0Dull),
-	X(0x54DB18AA47ull),X(0x550A838503ull),X(0x5539EB186Dull),X(0x55694F62B0ull),X(0x5598B061F9ull),X(0x55C80E1475ull),X(0x55F7687850ull),X(0x5626BF8BB6ull),
-	X(0x5656134CD5ull),X(0x568563B9D9ull),X(0x56B4B0D0F0ull),X(0x56E3FA9045ull),X(0x571340F608ull),X(0x5742840065ull),X(0x5771C3AD89ull),X(0x57A0FFFBA3ull),
-	X(0x57D038E8E0ull),X(0x57FF6E736Eull),X(0x582EA0997Bull),X(0x585DCF5936ull),X(0x588CFAB0CCull),X(0x58BC229E6Cull),X(0x58EB472046ull),X(0x591A683486ull),
-	X(0x594985D95Dull),X(0x5978A00CFAull),X(0x59A7B6CD8Aull),X(0x59D6CA193Full),X(0x5A05D9EE46ull),X(0x5A34E64AD0ull),X(0x5A63EF2D0Cull),X(0x5A92F4932Bull),
-	X(0x5AC1F67B5Bull),X(0x5AF0F4E3CDull),X(0x5B1FEFCAB1ull),X(0x5B4EE72E38ull),X(0x5B7DDB0C92ull),X(0x5BACCB63EFull),X(0x5BDBB83281ull),X(0x5C0AA17678ull),
-	X(0x5C39872E05ull),X(0x5C68695759ull),X(0x5C9747F0A6ull),X(0x5CC622F81Dull),X(0x5CF4FA6BF0ull),X(0x5D23CE4A4Full),X(0x5D529E916Eull),X(0x5D816B3F7Eull),
-	X(0x5DB03452B1ull),X(0x5DDEF9C939ull),X(0x5E0DBBA14Aull),X(0x5E3C79D914ull),X(0x5E6B346ECCull),X(0x5E99EB60A3ull),X(0x5EC89EACCDull),X(0x5EF74E517Dull),
-	X(0x5F25FA4CE5ull),X(0x5F54A29D3Bull),X(0x5F834740B0ull),X(0x5FB1E83579ull),X(0x5FE08579C9ull),X(0x600F1F0BD4ull),X(0x603DB4E9CFull),X(0x606C4711EDull),
-	X(0x609AD58264ull),X(0x60C9603966ull),X(0x60F7E7352Aull),X(0x61266A73E4ull),X(0x6154E9F3C9ull),X(0x618365B30Dull),X(0x61B1DDAFE7ull),X(0x61E051E88Bull),
-	X(0x620EC25B30ull),X(0x623D2F060Aull),X(0x626B97E74Full),X(0x6299FCFD36ull),X(0x62C85E45F5ull),X(0x62F6BBBFC1ull),X(0x63251568D2ull),X(0x63536B3F5Dull),
-	X(0x6381BD419Aull),X(0x63B00B6DBFull),X(0x63DE55C204ull),X(0x640C9C3C9Eull),X(0x643ADEDBC7ull),X(0x64691D9DB4ull),X(0x649758809Full),X(0x64C58F82BDull),
-	X(0x64F3C2A248ull),X(0x6521F1DD78ull),X(0x65501D3283ull),X(0x657E449FA4ull),X(0x65AC682312ull),X(0x65DA87BB06ull),X(0x6608A365B8ull),X(0x6636BB2163ull),
-	X(0x6664CEEC3Eull),X(0x6692DEC483ull),X(0x66C0EAA86Bull),X(0x66EEF29630ull),X(0x671CF68C0Cull),X(0x674AF68838ull),X(0x6778F288EEull),X(0x67A6EA8C6Aull),
-	X(0x67D4DE90E4ull),X(0x6802CE9497ull),X(0x6830BA95BFull),X(0x685EA29295ull),X(0x688C868954ull),X(0x68BA667839ull),X(0x68E8425D7Dull),X(0x69161A375Dull),
-	X(0x6943EE0414ull),X(0x6971BDC1DDull),X(0x699F896EF5ull),X(0x69CD510997ull),X(0x69FB149000ull),X(0x6A28D4006Cull),X(0x6A568F5918ull),X(0x6A8446983Full),
-	X(0x6AB1F9BC20ull),X(0x6ADFA8C2F6ull),X(0x6B0D53AAFFull),X(0x6B3AFA7279ull),X(0x6B689D17A0ull),X(0x6B963B98B3ull),X(0x6BC3D5F3EEull),X(0x6BF16C2791ull),
-	X(0x6C1EFE31D9ull),X(0x6C4C8C1104ull),X(0x6C7A15C351ull),X(0x6CA79B46FEull),X(0x6CD51C9A4Aull),X(0x6D0299BB74ull),X(0x6D3012A8BAull),X(0x6D5D87605Dull),
-	X(0x6D8AF7E09Cull),X(0x6DB86427B5ull),X(0x6DE5CC33E9ull),X(0x6E13300378ull),X(0x6E408F94A1ull),X(0x6E6DEAE5A5ull),X(0x6E9B41F4C4ull),X(0x6EC894C03Full),
-	X(0x6EF5E34656ull),X(0x6F232D854Aull),X(0x6F50737B5Cull),X(0x6F7DB526CEull),X(0x6FAAF285E0ull),X(0x6FD82B96D4ull),X(0x70056057ECull),X(0x703290C76Aull),
-	X(0x705FBCE390ull),X(0x708CE4AA9Full),X(0x70BA081ADBull),X(0x70E7273285ull),X(0x711441EFE0ull),X(0x7141585130ull),X(0x716E6A54B7ull),X(0x719B77F8B8ull),
-	X(0x71C8813B77ull),X(0x71F5861B37ull),X(0x722286963Cull),X(0x724F82AAC9ull),X(0x727C7A5724ull),X(0x72A96D998Full),X(0x72D65C7050ull),X(0x730346D9AAull),
-	X(0x73302CD3E3ull),X(0x735D0E5D40ull),X(0x7389EB7404ull),X(0x73B6C41677ull),X(0x73E39842DCull),X(0x741067F77Aull),X(0x743D333297ull),X(0x7469F9F277ull),
-	X(0x7496BC3562ull),X(0x74C379F99Dull),X(0x74F0333D70ull),X(0x751CE7FF20ull),X(0x7549983CF4ull),X(0x757643F534ull),X(0x75A2EB2626ull),X(0x75CF8DCE11ull),
-	X(0x75FC2BEB3Eull),X(0x7628C57BF4ull),X(0x76555A7E7Aull),X(0x7681EAF119ull),X(0x76AE76D218ull),X(0x76DAFE1FC1ull),X(0x770780D85Bull),X(0x7733FEFA30ull),
-	X(0x7760788388ull),X(0x778CED72ACull),X(0x77B95DC5E5ull),X(0x77E5C97B7Eull),X(0x78123091BFull),X(0x783E9306F2ull),X(0x786AF0D961ull),X(0x78974A0757ull),
-	X(0x78C39E8F1Dull),X(0x78EFEE6EFFull),X(0x791C39A546ull),X(0x794880303Dull),X(0x7974C20E31ull),X(0x79A0FF3D6Bull),X(0x79CD37BC37ull),X(0x79F96B88E1ull),
-	X(0x7A259AA1B4ull),X(0x7A51C504FDull),X(0x7A7DEAB108ull),X(0x7AAA0BA420ull),X(0x7AD627DC92ull),X(0x7B023F58ABull),X(0x7B2E5216B8ull),X(0x7B5A601506ull),
-	X(0x7B866951E2ull),X(0x7BB26DCB99ull),X(0x7BDE6D8079ull),X(0x7C0A686ECFull),X(0x7C365E94EAull),X(0x7C624FF118ull),X(0x7C8E3C81A7ull),X(0x7CBA2444E5ull),
-	X(0x7CE6073922ull),X(0x7D11E55CABull),X(0x7D3DBEADD1ull),X(0x7D69932AE1ull),X(0x7D9562D22Dull),X(0x7DC12DA202ull),X(0x7DECF398B2ull),X(0x7E18B4B48Cull),
-	X(0x7E4470F3E0ull),X(0x7E702854FFull),X(0x7E9BDAD639ull),X(0x7EC78875DEull),X(0x7EF3313241ull),X(0x7F1ED509B1ull),X(0x7F4A73FA80ull),X(0x7F760E0300ull),
-	X(0x7FA1A32182ull),X(0x7FCD335459ull),X(0x7FF8BE99D5ull),X(0x802444F04Aull),X(0x804FC6560Aull),X(0x807B42C967ull),X(0x80A6BA48B5ull),X(0x80D22CD246ull),
-	X(0x80FD9A646Dull),X(0x812902FD7Eull),X(0x8154669BCDull),X(0x817FC53DADull),X(0x81AB1EE172ull),X(0x81D6738570ull),X(0x8201C327FCull),X(0x822D0DC76Aull),
-	X(0x825853620Full),X(0x828393F640ull),X(0x82AECF8252ull),X(0x82DA06049Aull),X(0x8305377B6Eull),X(0x833063E523ull),X(0x835B8B4010ull),X(0x8386AD8A8Aull),
-	X(0x83B1CAC2E8ull),X(0x83DCE2E781ull),X(0x8407F5F6AAull),X(0x843303EEBAull),X(0x845E0CCE0Aull),X(0x84891092F0ull),X(0x84B40F3BC3ull),X(0x84DF08C6DCull),
-	X(0x8509FD3292ull),X(0x8534EC7D3Cull),X(0x855FD6A535ull),X(0x858ABBA8D3ull),X(0x85B59B866Full),X(0x85E0763C63ull),X(0x860B4BC907ull),X(0x86361C2AB5ull),
-	X(0x8660E75FC6ull),X(0x868BAD6694ull),X(0x86B66E3D78ull),X(0x86E129E2CDull),X(0x870BE054ECull),X(0x8736919231ull),X(0x87613D98F6ull),X(0x878BE46796ull),
-	X(0x87B685FC6Bull),X(0x87E12255D1ull),X(0x880BB97224ull),X(0x88364B4FBFull),X(0x8860D7ECFFull),X(0x888B5F483Eull),X(0x88B5E15FD9ull),X(0x88E05E322Dull),
-	X(0x890AD5BD97ull),X(0x8935480073ull),X(0x895FB4F91Full),X(0x898A1CA5F7ull),X(0x89B47F0559ull),X(0x89DEDC15A3ull),X(0x8A0933D533ull),X(0x8A33864266ull),
-	X(0x8A5DD35B9Cull),X(0x8A881B1F32ull),X(0x8AB25D8B88ull),X(0x8ADC9A9EFCull),X(0x8B06D257EDull),X(0x8B3104B4BBull),X(0x8B5B31B3C5ull),X(0x8B8559536Bull),
-	X(0x8BAF7B920Dull),X(0x8BD9986E0Bull),X(0x8C03AFE5C5ull),X(0x8C2DC1F79Dull),X(0x8C57CEA1F2ull),X(0x8C81D5E326ull),X(0x8CABD7B99Aull),X(0x8CD5D423B0ull),
-	X(0x8CFFCB1FC8ull),X(0x8D29BCAC45ull),X(0x8D53A8C789ull),X(0x8D7D8F6FF6ull),X(0x8DA770A3EFull),X(0x8DD14C61D6ull),X(0x8DFB22A80Eull),X(0x8E24F374FAull),
-	X(0x8E4EBEC6FEull),X(0x8E78849C7Cull),X(0x8EA244F3DAull),X(0x8ECBFFCB7Aull),X(0x8EF5B521C0ull),X(0x8F1F64F512ull),X(0x8F490F43D4ull),X(0x8F72B40C69ull),
-	X(0x8F9C534D39ull),X(0x8FC5ED04A7ull),X(0x8FEF813119ull),X(0x90190FD0F5ull),X(0x904298E2A1ull),X(0x906C1C6482ull),X(0x90959A54FFull),X(0x90BF12B27Eull),
-	X(0x90E8857B67ull),X(0x9111F2AE1Full),X(0x913B5A490Full),X(0x9164BC4A9Dull),X(0x918E18B132ull),X(0x91B76F7B34ull),X(0x91E0C0A70Cull),X(0x920A0C3322ull),
-	X(0x9233521DDFull),X(0x925C9265AAull),X(0x9285CD08EEull),X(0x92AF020613ull),X(0x92D8315B83ull),X(0x93015B07A6ull),X(0x932A7F08E7ull),X(0x93539D5DB0ull),
-	X(0x937CB6046Aull),X(0x93A5C8FB81ull),X(0x93CED6415Eull),X(0x93F7DDD46Eull),X(0x9420DFB31Aull),X(0x9449DBDBCEull),X(0x9472D24CF5ull),X(0x949BC304FCull),
-	X(0x94C4AE024Dull),X(0x94ED934356ull),X(0x951672C683ull),X(0x953F4C8A40ull),X(0x9568208CFAull),X(0x9590EECD1Full),X(0x95B9B7491Aull),X(0x95E279FF5Bull),
-	X(0x960B36EE4Eull),X(0x9633EE1462ull),X(0x965C9F7004ull),X(0x96854AFFA3ull),X(0x96ADF0C1AEull),X(0x96D690B494ull),X(0x96FF2AD6C3ull),X(0x9727BF26ABull),
-	X(0x97504DA2BBull),X(0x9778D64963ull),X(0x97A1591913ull),X(0x97C9D6103Cull),X(0x97F24D2D4Dull),X(0x981ABE6EB7ull),X(0x984329D2EBull),X(0x986B8F585Aull),
-	X(0x9893EEFD75ull),X(0x98BC48C0AFull),X(0x98E49CA078ull),X(0x990CEA9B43ull),X(0x993532AF82ull),X(0x995D74DBA7ull),X(0x9985B11E25ull),X(0x99ADE7756Full),
-	X(0x99D617DFF7ull),X(0x99FE425C33ull),X(0x9A2666E894ull),X(0x9A4E85838Full),X(0x9A769E2B97ull),X(0x9A9EB0DF22ull),X(0x9AC6BD9CA3ull),X(0x9AEEC4628Full),
-	X(0x9B16C52F5Cull),X(0x9B3EC0017Eull),X(0x9B66B4D76Bull),X(0x9B8EA3AF98ull),X(0x9BB68C887Bull),X(0x9BDE6F608Bull),X(0x9C064C363Eull),X(0x9C2E23080Aull),
-	X(0x9C55F3D466ull),X(0x9C7DBE99CAull),X(0x9CA58356ACull),X(0x9CCD420983ull),X(0x9CF4FAB0C9ull),X(0x9D1CAD4AF4ull),X(0x9D4459D67Dull),X(0x9D6C0051DCull),
-	X(0x9D93A0BB8Bull),X(0x9DBB3B1201ull),X(0x9DE2CF53B8ull),X(0x9E0A5D7F29ull),X(0x9E31E592CEull),X(0x9E59678D22ull),X(0x9E80E36C9Dull),X(0x9EA8592FBAull),
-	X(0x9ECFC8D4F4ull),X(0x9EF7325AC5ull),X(0x9F1E95BFA9ull),X(0x9F45F3021Bull),X(0x9F6D4A2096ull),X(0x9F949B1996ull),X(0x9FBBE5EB97ull),X(0x9FE32A9515ull),
-	X(0xA00A69148Dull),X(0xA031A1687Bull),X(0xA058D38F5Cull),X(0xA07FFF87AEull),X(0xA0A7254FEDull),X(0xA0CE44E698ull),X(0xA0F55E4A2Cull),X(0xA11C717927ull),
-	X(0xA1437E7208ull),X(0xA16A85334Dull),X(0xA19185BB75ull),X(0xA1B8800900ull),X(0xA1DF741A6Cull),X(0xA20661EE39ull),X(0xA22D4982E6ull),X(0xA2542AD6F5ull),
-	X(0xA27B05E8E4ull),X(0xA2A1DAB736ull),X(0xA2C8A94069ull),X(0xA2EF718300ull),X(0xA316337D7Bull),X(0xA33CEF2E5Dull),X(0xA363A49426ull),X(0xA38A53AD59ull),
-	X(0xA3B0FC7878ull),X(0xA3D79EF406ull),X(0xA3FE3B1E84ull),X(0xA424D0F676ull),X(0xA44B607A60ull),X(0xA471E9A8C4ull),X(0xA4986C8027ull),X(0xA4BEE8FF0Bull),
-	X(0xA4E55F23F6ull),X(0xA50BCEED6Cull),X(0xA5323859F1ull),X(0xA5589B680Bull),X(0xA57EF8163Eull),X(0xA5A54E630Full),X(0xA5CB9E4D05ull),X(0xA5F1E7D2A6ull),
-	X(0xA6182AF276ull),X(0xA63E67AAFEull),X(0xA6649DFAC3ull),X(0xA68ACDE04Cull),X(0xA6B0F75A21ull),X(0xA6D71A66C8ull),X(0xA6FD3704CAull),X(0xA7234D32ADull),
-	X(0xA7495CEEFCull),X(0xA76F66383Cull),X(0xA795690CF8ull),X(0xA7BB656BB8ull),X(0xA7E15B5305ull),X(0xA8074AC169ull),X(0xA82D33B56Dull),X(0xA853162D9Bull),
-	X(0xA878F2287Dull),X(0xA89EC7A49Dull),X(0xA8C496A086ull),X(0xA8EA5F1AC3ull),X(0xA9102111DFull),X(0xA935DC8465ull),X(0xA95B9170E1ull),X(0xA9813FD5DFull),
-	X(0xA9A6E7B1EAull),X(0xA9CC890390ull),X(0xA9F223C95Dull),X(0xAA17B801DDull),X(0xAA3D45AB9Eull),X(0xAA62CCC52Dull),X(0xAA884D4D18ull),X(0xAAADC741ECull),
-	X(0xAAD33AA238ull),X(0xAAF8A76C8Aull),X(0xAB1E0D9F71ull),X(0xAB436D397Bull),X(0xAB68C63939ull),X(0xAB8E189D38ull),X(0xABB3646409ull),X(0xABD8A98C3Cull),
-	X(0xABFDE81460ull),X(0xAC231FFB07ull),X(0xAC48513EC1ull),X(0xAC6D7BDE1Full),X(0xAC929FD7B2ull),X(0xACB7BD2A0Bull),X(0xACDCD3D3BCull),X(0xAD01E3D358ull),
-	X(0xAD26ED2770ull),X(0xAD4BEFCE96ull),X(0xAD70EBC75Eull),X(0xAD95E1105Bull),X(0xADBACFA820ull),X(0xADDFB78D3Full),X(0xAE0498BE4Eull),X(0xAE297339DFull),
-	X(0xAE4E46FE88ull),X(0xAE73140ADDull),X(0xAE97DA5D72ull),X(0xAEBC99F4DDull),X(0xAEE152CFB3ull),X(0xAF0604EC89ull),X(0xAF2AB049F6ull),X(0xAF4F54E68Full),
-	X(0xAF73F2C0EBull),X(0xAF9889D7A0ull),X(0xAFBD1A2945ull),X(0xAFE1A3B472ull),X(0xB0062677BEull),X(0xB02AA271C0ull),X(0xB04F17A110ull),X(0xB073860447ull),
-	X(0xB097ED99FDull),X(0xB0BC4E60CBull),X(0xB0E0A85749ull),X(0xB104FB7C11ull),X(0xB12947CDBCull),X(0xB14D8D4AE5ull),X(0xB171CBF224ull),X(0xB19603C215ull),
-	X(0xB1BA34B952ull),X(0xB1DE5ED675ull),X(0xB20282181Bull),X(0xB2269E7CDDull),X(0xB24AB40359ull),X(0xB26EC2AA28ull),X(0xB292CA6FE9ull),X(0xB2B6CB5337ull),
-	X(0xB2DAC552AEull),X(0xB2FEB86CECull),X(0xB322A4A08Eull),X(0xB34689EC32ull),X(0xB36A684E74ull),X(0xB38E3FC5F4ull),X(0xB3B210514Full),X(0xB3D5D9EF23ull),
-	X(0xB3F99C9E11ull),X(0xB41D585CB6ull),X(0xB4410D29B2ull),X(0xB464BB03A5ull),X(0xB48861E92Eull),X(0xB4AC01D8EEull),X(0xB4CF9AD184ull),X(0xB4F32CD193ull),
-	X(0xB516B7D7BAull),X(0xB53A3BE29Bull),X(0xB55DB8F0D7ull),X(0xB5812F0110ull),X(0xB5A49E11E9ull),X(0xB5C8062202ull),X(0xB5EB673000ull),X(0xB60EC13A84ull),
-	X(0xB632144032ull),X(0xB655603FADull),X(0xB678A53799ull),X(0xB69BE3269Aull),X(0xB6BF1A0B53ull),X(0xB6E249E46Aull),X(0xB70572B083ull),X(0xB728946E43ull),
-	X(0xB74BAF1C4Full),X(0xB76EC2B94Dull),X(0xB791CF43E2ull),X(0xB7B4D4BAB6ull),X(0xB7D7D31C6Dull),X(0xB7FACA67AFull),X(0xB81DBA9B23ull),X(0xB840A3B56Full),
-	X(0xB86385B53Cull),X(0xB886609930ull),X(0xB8A9345FF5ull),X(0xB8CC010831ull),X(0xB8EEC6908Full),X(0xB91184F7B6ull),X(0xB9343C3C50ull),X(0xB956EC5D05ull),
-	X(0xB979955880ull),X(0xB99C372D6Bull),X(0xB9BED1DA70ull),X(0xB9E1655E39ull),X(0xBA03F1B771ull),X(0xBA2676E4C3ull),X(0xBA48F4E4DAull),X(0xBA6B6BB662ull),
-	X(0xBA8DDB5807ull),X(0xBAB043C875ull),X(0xBAD2A50658ull),X(0xBAF4FF105Cull),X(0xBB1751E530ull),X(0xBB399D8380ull),X(0xBB5BE1E9FAull),X(0xBB7E1F174Bull),
-	X(0xBBA0550A22ull),X(0xBBC283C12Dull),X(0xBBE4AB3B1Aull),X(0xBC06CB7699ull),X(0xBC28E47258ull),X(0xBC4AF62D07ull),X(0xBC6D00A556ull),X(0xBC8F03D9F6ull),
-	X(0xBCB0FFC995ull),X(0xBCD2F472E5ull),X(0xBCF4E1D497ull),X(0xBD16C7ED5Bull),X(0xBD38A6BBE4ull),X(0xBD5A7E3EE3ull),X(0xBD7C4E750Aull),X(0xBD9E175D0Bull),
-	X(0xBDBFD8F599ull),X(0xBDE1933D66ull),X(0xBE03463326ull),X(0xBE24F1D58Dull),X(0xBE4696234Dull),X(0xBE68331B1Bull),X(0xBE89C8BBABull),X(0xBEAB5703B1ull),
-	X(0xBECCDDF1E3ull),X(0xBEEE5D84F6ull),X(0xBF0FD5BB9Eull),X(0xBF31469492ull),X(0xBF52B00E88ull),X(0xBF74122835ull),X(0xBF956CE050ull),X(0xBFB6C03591ull),
-	X(0xBFD80C26AEull),X(0xBFF950B25Eull),X(0xC01A8DD759ull),X(0xC03BC39458ull),X(0xC05CF1E812ull),X(0xC07E18D140ull),X(0xC09F384E9Bull),X(0xC0C0505EDBull),
-	X(0xC0E16100BBull),X(0xC1026A32F3ull),X(0xC1236BF43Eull),X(0xC144664356ull),X(0xC165591EF6ull),X(0xC1864485D8ull),X(0xC1A72876B8ull),X(0xC1C804F050ull),
-	X(0xC1E8D9F15Dull),X(0xC209A7789Aull),X(0xC22A6D84C4ull),X(0xC24B2C1498ull),X(0xC26BE326D1ull),X(0xC28C92BA2Dull),X(0xC2AD3ACD6Aull),X(0xC2CDDB5F46ull),
-	X(0xC2EE746E7Eull),X(0xC30F05F9D0ull),X(0xC32F8FFFFBull),X(0xC350127FBEull),X(0xC3708D77D9ull),X(0xC39100E709ull),X(0xC3B16CCC11ull),X(0xC3D1D125AEull),
-	X(0xC3F22DF2A2ull),X(0xC4128331ADull),X(0xC432D0E190ull),X(0xC45317010Cull),X(0xC473558EE3ull),X(0xC4938C89D7ull),X(0xC4B3BBF0A9ull),X(0xC4D3E3C21Cull),
-	X(0xC4F403FCF2ull),X(0xC5141C9FEFull),X(0xC5342DA9D5ull),X(0xC554371969ull),X(0xC57438ED6Dull),X(0xC5943324A7ull),X(0xC5B425BDDAull),X(0xC5D410B7CBull),
-	X(0xC5F3F4113Full),X(0xC613CFC8FCull),X(0xC633A3DDC7ull),X(0xC653704E65ull),X(0xC67335199Eull),X(0xC692F23E37ull),X(0xC6B2A7BAF7ull),X(0xC6D2558EA5ull),
-	X(0xC6F1FBB809ull),X(0xC7119A35EBull),X(0xC731310711ull),X(0xC750C02A45ull),X(0xC770479E4Full),X(0xC78FC761F8ull),X(0xC7AF3F7408ull),X(0xC7CEAFD34Aull),
-	X(0xC7EE187E86ull),X(0xC80D797488ull),X(0xC82CD2B419ull),X(0xC84C243C04ull),X(0xC86B6E0B14ull),X(0xC88AB02013ull),X(0xC8A9EA79CEull),X(0xC8C91D1711ull),
-	X(0xC8E847F6A6ull),X(0xC9076B175Cull),X(0xC9268677FEull),X(0xC9459A1759ull),X(0xC964A5F43Bull),X(0xC983AA0D72ull),X(0xC9A2A661CBull),X(0xC9C19AF013ull),
-	X(0xC9E087B71Bull),X(0xC9FF6CB5B1ull),X(0xCA1E49EAA3ull),X(0xCA3D1F54C1ull),X(0xCA5BECF2DBull),X(0xCA7AB2C3C1ull),X(0xCA9970C643ull),X(0xCAB826F932ull),
-	X(0xCAD6D55B5Eull),X(0xCAF57BEB99ull),X(0xCB141AA8B4ull),X(0xCB32B19181ull),X(0xCB5140A4D2ull),X(0xCB6FC7E179ull),X(0xCB8E47464Aull),X(0xCBACBED217ull),
-	X(0xCBCB2E83B4ull),X(0xCBE99659F3ull),X(0xCC07F653AAull),X(0xCC264E6FACull),X(0xCC449EACCDull),X(0xCC62E709E3ull),X(0xCC812785C3ull),X(0xCC9F601F42ull),
-	X(0xCCBD90D536ull),X(0xCCDBB9A674ull),X(0xCCF9DA91D4ull),X(0xCD17F3962Cull),X(0xCD3604B252ull),X(0xCD540DE51Full),X(0xCD720F2D69ull),X(0xCD90088A08ull),
-	X(0xCDADF9F9D6ull),X(0xCDCBE37BA9ull),X(0xCDE9C50E5Bull),X(0xCE079EB0C5ull),X(0xCE257061C1ull),X(0xCE433A2027ull),X(0xCE60FBEAD3ull),X(0xCE7EB5C09Eull),
-	X(0xCE9C67A063ull),X(0xCEBA1188FDull),X(0xCED7B37947ull),X(0xCEF54D701Dull),X(0xCF12DF6C5Aull),X(0xCF30696CDBull),X(0xCF4DEB707Cull),X(0xCF6B65761Aull),
-	X(0xCF88D77C92ull),X(0xCFA64182C1ull),X(0xCFC3A38786ull),X(0xCFE0FD89BDull),X(0xCFFE4F8846ull),X(0xD01B9981FFull),X(0xD038DB75C7ull),X(0xD05615627Dull),
-	X(0xD073474701ull),X(0xD090712232ull),X(0xD0AD92F2F1ull),X(0xD0CAACB81Full),X(0xD0E7BE709Bull),X(0xD104C81B47ull),X(0xD121C9B705ull),X(0xD13EC342B6ull),
-	X(0xD15BB4BD3Dull),X(0xD1789E257Bull),X(0xD1957F7A53ull),X(0xD1B258BAA9ull),X(0xD1CF29E55Full),X(0xD1EBF2F959ull),X(0xD208B3F57Bull),X(0xD2256CD8A9ull),
-	X(0xD2421DA1C8ull),X(0xD25EC64FBDull),X(0xD27B66E16Cull),X(0xD297FF55BCull),X(0xD2B48FAB91ull),X(0xD2D117E1D2ull),X(0xD2ED97F766ull),X(0xD30A0FEB33ull),
-	X(0xD3267FBC20ull),X(0xD342E76915ull),X(0xD35F46F0F9ull),X(0xD37B9E52B4ull),X(0xD397ED8D2Eull),X(0xD3B4349F51ull),X(0xD3D0738804ull),X(0xD3ECAA4631ull),
-	X(0xD408D8D8C2ull),X(0xD424FF3EA1ull),X(0xD4411D76B7ull),X(0xD45D337FF0ull),X(0xD479415935ull),X(0xD495470173ull),X(0xD4B1447794ull),X(0xD4CD39BA85ull),
-	X(0xD4E926C931ull),X(0xD5050BA284ull),X(0xD520E8456Cull),X(0xD53CBCB0D6ull),X(0xD55888E3AEull),X(0xD5744CDCE3ull),X(0xD590089B62ull),X(0xD5ABBC1E1Aull),
-	X(0xD5C76763F9ull),X(0xD5E30A6BEEull),X(0xD5FEA534E9ull),X(0xD61A37BDD9ull),X(0xD635C205ADull),X(0xD651440B57ull),X(0xD66CBDCDC6ull),X(0xD6882F4BECull),
-	X(0xD6A39884B9ull),X(0xD6BEF9771Full),X(0xD6DA522210ull),X(0xD6F5A2847Dull),X(0xD710EA9D5Bull),X(0xD72C2A6B9Aull),X(0xD74761EE2Eull),X(0xD76291240Aull),
-	X(0xD77DB80C23ull),X(0xD798D6A56Cull),X(0xD7B3ECEEDAull),X(0xD7CEFAE761ull),X(0xD7EA008DF6ull),X(0xD804FDE18Eull),X(0xD81FF2E120ull),X(0xD83ADF8BA1ull),
-	X(0xD855C3E007ull),X(0xD8709FDD49ull),X(0xD88B73825Dull),X(0xD8A63ECE3Cull),X(0xD8C101BFDCull),X(0xD8DBBC5636ull),X(0xD8F66E9042ull),X(0xD911186CF8ull),
-	X(0xD92BB9EB50ull),X(0xD946530A45ull),X(0xD960E3C8D0ull),X(0xD97B6C25EAull),X(0xD995EC208Eull),X(0xD9B063B7B6ull),X(0xD9CAD2EA5Dull),X(0xD9E539B77Eull),
-	X(0xD9FF981E14ull),X(0xDA19EE1D1Bull),X(0xDA343BB390ull),X(0xDA4E80E06Eull),X(0xDA68BDA2B2ull),X(0xDA82F1F95Aull),X(0xDA9D1DE363ull),X(0xDAB7415FCAull),
-	X(0xDAD15C6D8Dull),X(0xDAEB6F0BACull),X(0xDB05793924ull),X(0xDB1F7AF4F4ull),X(0xDB39743E1Cull),X(0xDB5365139Cull),X(0xDB6D4D7473ull),X(0xDB872D5FA2ull),
-	X(0xDBA104D42Aull),X(0xDBBAD3D10Aull),X(0xDBD49A5546ull),X(0xDBEE585FDDull),X(0xDC080DEFD3ull),X(0xDC21BB0429ull),X(0xDC3B5F9BE2ull),X(0xDC54FBB601ull),
-	X(0xDC6E8F5189ull),X(0xDC881A6D7Eull),X(0xDCA19D08E3ull),X(0xDCBB1722BEull),X(0xDCD488BA12ull),X(0xDCEDF1CDE4ull),X(0xDD07525D39ull),X(0xDD20AA6718ull),
-	X(0xDD39F9EA85ull),X(0xDD5340E687ull),X(0xDD6C7F5A26ull),X(0xDD85B54466ull),X(0xDD9EE2A450ull),X(0xDDB80778ECull),X(0xDDD123C140ull),X(0xDDEA377C56ull),
-	X(0xDE0342A935ull),X(0xDE1C4546E7ull),X(0xDE353F5474ull),X(0xDE4E30D0E6ull),X(0xDE6719BB48ull),X(0xDE7FFA12A2ull),X(0xDE98D1D600ull),X(0xDEB1A1046Dull),
-	X(0xDECA679CF3ull),X(0xDEE3259E9Eull),X(0xDEFBDB087Aull),X(0xDF1487D993ull),X(0xDF2D2C10F5ull),X(0xDF45C7ADAEull),X(0xDF5E5AAECAull),X(0xDF76E51356ull),
-	X(0xDF8F66DA62ull),X(0xDFA7E002FAull),X(0xDFC0508C2Dull),X(0xDFD8B8750Aull),X(0xDFF117BCA0ull),X(0xE0096E61FFull),X(0xE021BC6436ull),X(0xE03A01C256ull),
-	X(0xE0523E7B6Full),X(0xE06A728E91ull),X(0xE0829DFACEull),X(0xE09AC0BF38ull),X(0xE0B2DADADFull),X(0xE0CAEC4CD7ull),X(0xE0E2F51431ull),X(0xE0FAF53001ull),
-	X(0xE112EC9F5Aull),X(0xE12ADB614Eull),X(0xE142C174F2ull),X(0xE15A9ED95Bull),X(0xE172738D9Bull),X(0xE18A3F90C9ull),X(0xE1A202E1FAull),X(0xE1B9BD8042ull),
-	X(0xE1D16F6AB7ull),X(0xE1E918A071ull),X(0xE200B92085ull),X(0xE21850EA09ull),X(0xE22FDFFC16ull),X(0xE2476655C3ull),X(0xE25EE3F627ull),X(0xE27658DC5Bull),
-	X(0xE28DC50777ull),X(0xE2A5287694ull),X(0xE2BC8328CCull),X(0xE2D3D51D36ull),X(0xE2EB1E52EFull),X(0xE3025EC90Full),X(0xE319967EB1ull),X(0xE330C572F0ull),
-	X(0xE347EBA4E8ull),X(0xE35F0913B3ull),X(0xE3761DBE6Eull),X(0xE38D29A434ull),X(0xE3A42CC423ull),X(0xE3BB271D57ull),X(0xE3D218AEEEull),X(0xE3E9017805ull),
-	X(0xE3FFE177B9ull),X(0xE416B8AD2Aull),X(0xE42D871775ull),X(0xE4444CB5BAull),X(0xE45B098718ull),X(0xE471BD8AAFull),X(0xE48868BF9Eull),X(0xE49F0B2505ull),
-	X(0xE4B5A4BA06ull),X(0xE4CC357DC0ull),X(0xE4E2BD6F57ull),X(0xE4F93C8DEAull),X(0xE50FB2D89Dull),X(0xE526204E91ull),X(0xE53C84EEE9ull),X(0xE552E0B8C8ull),
-	X(0xE56933AB52ull),X(0xE57F7DC5A9ull),X(0xE595BF06F3ull),X(0xE5ABF76E53ull),X(0xE5C226FAEEull),X(0xE5D84DABE9ull),X(0xE5EE6B8069ull),X(0xE604807795ull),
-	X(0xE61A8C9093ull),X(0xE6308FCA87ull),X(0xE6468A249Bull),X(0xE65C7B9DF4ull),X(0xE6726435B9ull),X(0xE68843EB14ull),X(0xE69E1ABD2Bull),X(0xE6B3E8AB28ull),
-	X(0xE6C9ADB433ull),X(0xE6DF69D775ull),X(0xE6F51D1418ull),X(0xE70AC76945ull),X(0xE72068D627ull),X(0xE7360159E8ull),X(0xE74B90F3B3ull),X(0xE76117A2B4ull),
-	X(0xE776956615ull),X(0xE78C0A3D03ull),X(0xE7A17626ABull),X(0xE7B6D92237ull),X(0xE7CC332ED6ull),X(0xE7E1844BB5ull),X(0xE7F6CC7801ull),X(0xE80C0BB2E9ull),
-	X(0xE82141FB9Aull),X(0xE8366F5143ull),X(0xE84B93B314ull),X(0xE860AF203Bull),X(0xE875C197E9ull),X(0xE88ACB194Cull),X(0xE89FCBA397ull),X(0xE8B4C335F8ull),
-	X(0xE8C9B1CFA2ull),X(0xE8DE976FC6ull),X(0xE8F3741596ull),X(0xE90847C043ull),X(0xE91D126F01ull),X(0xE931D42101ull),X(0xE9468CD577ull),X(0xE95B3C8B97ull),
-	X(0xE96FE34295ull),X(0xE98480F9A4ull),X(0xE99915AFF9ull),X(0xE9ADA164C9ull),X(0xE9C2241749ull),X(0xE9D69DC6AFull),X(0xE9EB0E7231ull),X(0xE9FF761904ull),
-	X(0xEA13D4BA60ull),X(0xEA282A557Cull),X(0xEA3C76E98Full),X(0xEA50BA75D0ull),X(0xEA64F4F977ull),X(0xEA792673BEull),X(0xEA8D4EE3DCull),X(0xEAA16E490Aull),
-	X(0xEAB584A283ull),X(0xEAC991EF7Full),X(0xEADD962F39ull),X(0xEAF19160EBull),X(0xEB058383D1ull),X(0xEB196C9724ull),X(0xEB2D4C9A22ull),X(0xEB41238C04ull),
-	X(0xEB54F16C09ull),X(0xEB68B6396Cull),X(0xEB7C71F36Aull),X(0xEB90249940ull),X(0xEBA3CE2A2Dull),X(0xEBB76EA56Dull),X(0xEBCB060A40ull),X(0xEBDE9457E3ull),
-	X(0xEBF2198D96ull),X(0xEC0595AA99ull),X(0xEC1908AE2Aull),X(0xEC2C72978Bull),X(0xEC3FD365FAull),X(0xEC532B18BAull),X(0xEC6679AF0Bull),X(0xEC79BF282Full),
-	X(0xEC8CFB8367ull),X(0xECA02EBFF5ull),X(0xECB358DD1Dull),X(0xECC679DA20ull),X(0xECD991B643ull),X(0xECECA070C8ull),X(0xECFFA608F4ull),X(0xED12A27E0Bull),
-	X(0xED2595CF51ull),X(0xED387FFC0Cull),X(0xED4B610380ull),X(0xED5E38E4F4ull),X(0xED71079FAEull),X(0xED83CD32F3ull),X(0xED96899E0Bull),X(0xEDA93CE03Cull),
-	X(0xEDBBE6F8CEull),X(0xEDCE87E70Aull),X(0xEDE11FAA36ull),X(0xEDF3AE419Cull),X(0xEE0633AC84ull),X(0xEE18AFEA38ull),X(0xEE2B22FA01ull),X(0xEE3D8CDB29ull),
-	X(0xEE4FED8CFAull),X(0xEE62450EBFull),X(0xEE74935FC3ull),X(0xEE86D87F51ull),X(0xEE99146CB6ull),X(0xEEAB47273Cull),X(0xEEBD70AE30ull),X(0xEECF9100E0ull),
-	X(0xEEE1A81E97ull),X(0xEEF3B606A5ull),X(0xEF05BAB855ull),X(0xEF17B632F8ull),X(0xEF29A875DAull),X(0xEF3B91804Cull),X(0xEF4D71519Bull),X(0xEF5F47E919ull),
-	X(0xEF71154614ull),X(0xEF82D967DEull),X(0xEF94944DC6ull),X(0xEFA645F71Dull),X(0xEFB7EE6336ull),X(0xEFC98D9162ull),X(0xEFDB2380F3ull),X(0xEFECB0313Bull),
-	X(0xEFFE33A18Dull),X(0xF00FADD13Cull),X(0xF0211EBF9Dull),X(0xF032866C01ull),X(0xF043E4D5BFull),X(0xF05539FC2Aull),X(0xF06685DE98ull),X(0xF077C87C5Dull),
-	X(0xF08901D4D0ull),X(0xF09A31E746ull),X(0xF0AB58B315ull),X(0xF0BC763795ull),X(0xF0CD8A741Dull),X(0xF0DE956803ull),X(0xF0EF9712A0ull),X(0xF1008F734Cull),
-	X(0xF1117E8960ull),X(0xF122645434ull),X(0xF13340D321ull),X(0xF144140581ull),X(0xF154DDEAAEull),X(0xF1659E8203ull),X(0xF17655CAD9ull),X(0xF18703C48Dull),
-	X(0xF197A86E79ull),X(0xF1A843C7F9ull),X(0xF1B8D5D069ull),X(0xF1C95E8726ull),X(0xF1D9DDEB8Cull),X(0xF1EA53FCF9ull),X(0xF1FAC0BACAull),X(0xF20B24245Eull),
-	X(0xF21B7E3911ull),X(0xF22BCEF844ull),X(0xF23C166154ull),X(0xF24C5473A2ull),X(0xF25C892E8Dull),X(0xF26CB49175ull),X(0xF27CD69BBAull),X(0xF28CEF4CBDull),
-	X(0xF29CFEA3E0ull),X(0xF2AD04A083ull),X(0xF2BD01420Aull),X(0xF2CCF487D5ull),X(0xF2DCDE7147ull),X(0xF2ECBEFDC4ull),X(0xF2FC962CAFull),X(0xF30C63FD6Bull),
-	X(0xF31C286F5Cull),X(0xF32BE381E7ull),X(0xF33B953471ull),X(0xF34B3D865Eull),X(0xF35ADC7715ull),X(0xF36A7205FAull),X(0xF379FE3275ull),X(0xF38980FBEBull),
-	X(0xF398FA61C3ull),X(0xF3A86A6366ull),X(0xF3B7D1003Aull),X(0xF3C72E37A7ull),X(0xF3D6820917ull),X(0xF3E5CC73F1ull),X(0xF3F50D779Eull),X(0xF404451389ull),
-	X(0xF41373471Aull),X(0xF4229811BDull),X(0xF431B372DBull),X(0xF440C569E0ull),X(0xF44FCDF637ull),X(0xF45ECD174Bull),X(0xF46DC2CC88ull),X(0xF47CAF155Cull),
-	X(0xF48B91F131ull),X(0xF49A6B5F76ull),X(0xF4A93B5F99ull),X(0xF4B801F106ull),X(0xF4C6BF132Cull),X(0xF4D572C579ull),X(0xF4E41D075Dull),X(0xF4F2BDD847ull),
-	X(0xF5015537A6ull),X(0xF50FE324EAull),X(0xF51E679F84ull),X(0xF52CE2A6E4ull),X(0xF53B543A7Cull),X(0xF549BC59BDull),X(0xF5581B0418ull),X(0xF566703900ull),
-	X(0xF574BBF7E8ull),X(0xF582FE4042ull),X(0xF591371181ull),X(0xF59F666B1Aull),X(0xF5AD8C4C80ull),X(0xF5BBA8B527ull),X(0xF5C9BBA485ull),X(0xF5D7C51A0Eull),
-	X(0xF5E5C51538ull),X(0xF5F3BB9579ull),X(0xF601A89A47ull),X(0xF60F8C2318ull),X(0xF61D662F64ull),X(0xF62B36BEA1ull),X(0xF638FDD048ull),X(0xF646BB63CFull),
-	X(0xF6546F78B1ull),X(0xF6621A0E65ull),X(0xF66FBB2465ull),X(0xF67D52BA2Aull),X(0xF68AE0CF2Dull),X(0xF6986562EAull),X(0xF6A5E074DBull),X(0xF6B352047Aull),
-	X(0xF6C0BA1143ull),X(0xF6CE189AB2ull),X(0xF6DB6DA043ull),X(0xF6E8B92172ull),X(0xF6F5FB1DBCull),X(0xF70333949Eull),X(0xF710628595ull),X(0xF71D87F020ull),
-	X(0xF72AA3D3BDull),X(0xF737B62FEAull),X(0xF744BF0426ull),X(0xF751BE4FF2ull),X(0xF75EB412CBull),X(0xF76BA04C33ull),X(0xF77882FBAAull),X(0xF7855C20B1ull),
-	X(0xF7922BBAC9ull),X(0xF79EF1C974ull),X(0xF7ABAE4C33ull),X(0xF7B8614288ull),X(0xF7C50AABF8ull),X(0xF7D1AA8803ull),X(0xF7DE40D62Full),X(0xF7EACD95FEull),
-	X(0xF7F750C6F5ull),X(0xF803CA6898ull),X(0xF8103A7A6Dull),X(0xF81CA0FBF8ull),X(0xF828FDECBEull),X(0xF835514C47ull),X(0xF8419B1A19ull),X(0xF84DDB55B9ull),
-	X(0xF85A11FEB0ull),X(0xF8663F1484ull),X(0xF8726296BDull),X(0xF87E7C84E5ull),X(0xF88A8CDE82ull),X(0xF89693A31Full),X(0xF8A290D244ull),X(0xF8AE846B7Bull),
-	X(0xF8BA6E6E4Eull),X(0xF8C64EDA48ull),X(0xF8D225AEF4ull),X(0xF8DDF2EBDCull),X(0xF8E9B6908Bull),X(0xF8F5709C8Full),X(0xF901210F73ull),X(0xF90CC7E8C4ull),
-	X(0xF91865280Full),X(0xF923F8CCE1ull),X(0xF92F82D6C7ull),X(0xF93B034551ull),X(0xF9467A180Dull),X(0xF951E74E88ull),X(0xF95D4AE854ull),X(0xF968A4E4FEull),
-	X(0xF973F54418ull),X(0xF97F3C0531ull),X(0xF98A7927DBull),X(0xF995ACABA6ull),X(0xF9A0D69023ull),X(0xF9ABF6D4E5ull),X(0xF9B70D797Eull),X(0xF9C21A7D80ull),
-	X(0xF9CD1DE07Full),X(0xF9D817A20Dull),X(0xF9E307C1BEull),X(0xF9EDEE3F26ull),X(0xF9F8CB19DAull),X(0xFA039E516Full),X(0xFA0E67E579ull),X(0xFA1927D58Eull),
-	X(0xFA23DE2145ull),X(0xFA2E8AC833ull),X(0xFA392DC9EEull),X(0xFA43C7260Full),X(0xFA4E56DC2Dull),X(0xFA58DCEBDEull),X(0xFA635954BCull),X(0xFA6DCC165Eull),
-	X(0xFA7835305Eull),X(0xFA8294A256ull),X(0xFA8CEA6BDDull),X(0xFA97368C90ull),X(0xFAA1790407ull),X(0xFAABB1D1DEull),X(0xFAB5E0F5AFull),X(0xFAC0066F17ull),
-	X(0xFACA223DB2ull),X(0xFAD434611Aull),X(0xFADE3CD8EDull),X(0xFAE83BA4C9ull),X(0xFAF230C44Aull),X(0xFAFC1C370Dull),X(0xFB05FDFCB2ull),X(0xFB0FD614D7ull),
-	X(0xFB19A47F1Aull),X(0xFB23693B1Aull),X(0xFB2D244878ull),X(0xFB36D5A6D3ull),X(0xFB407D55CBull),X(0xFB4A1B5502ull),X(0xFB53AFA418ull),X(0xFB5D3A42AFull),
-	X(0xFB66BB3069ull),X(0xFB70326CE7ull),X(0xFB799FF7CDull),X(0xFB8303D0BDull),X(0xFB8C5DF75Aull),X(0xFB95AE6B49ull),X(0xFB9EF52C2Eull),X(0xFBA83239ACull),
-	X(0xFBB1659369ull),X(0xFBBA8F390Aull),X(0xFBC3AF2A35ull),X(0xFBCCC5668Eull),X(0xFBD5D1EDBEull),X(0xFBDED4BF6Aull),X(0xFBE7CDDB39ull),X(0xFBF0BD40D4ull),
-	X(0xFBF9A2EFE1ull),X(0xFC027EE809ull),X(0xFC0B5128F4ull),X(0xFC1419B24Cull),X(0xFC1CD883BAull),X(0xFC258D9CE7ull),X(0xFC2E38FD7Dull),X(0xFC36DAA528ull),
-	X(0xFC3F729391ull),X(0xFC4800C864ull),X(0xFC5085434Dull),X(0xFC590003F7ull),X(0xFC61710A0Eull),X(0xFC69D85540ull),X(0xFC7235E53Aull),X(0xFC7A89B9A8ull),
-	X(0xFC82D3D239ull),X(0xFC8B142E9Bull),X(0xFC934ACE7Dull),X(0xFC9B77B18Dull),X(0xFCA39AD77Aull),X(0xFCABB43FF5ull),X(0xFCB3C3EAAEull),X(0xFCBBC9D754ull),
-	X(0xFCC3C60599ull),X(0xFCCBB8752Eull),X(0xFCD3A125C5ull),X(0xFCDB80170Full),X(0xFCE35548BEull),X(0xFCEB20BA86ull),X(0xFCF2E26C1Aull),X(0xFCFA9A5D2Cull),
-	X(0xFD02488D71ull),X(0xFD09ECFC9Dull),X(0xFD1187AA65ull),X(0xFD1918967Dull),X(0xFD209FC09Bull),X(0xFD281D2875ull),X(0xFD2F90CDC0ull),X(0xFD36FAB033ull),
-	X(0xFD3E5ACF85ull),X(0xFD45B12B6Dull),X(0xFD4CFDC3A3ull),X(0xFD544097DEull),X(0xFD5B79A7D7ull),X(0xFD62A8F347ull),X(0xFD69CE79E7ull),X(0xFD70EA3B70ull),
-	X(0xFD77FC379Cull),X(0xFD7F046E25ull),X(0xFD8602DEC7ull),X(0xFD8CF7893Bull),X(0xFD93E26D3Dull),X(0xFD9AC38A89ull),X(0xFDA19AE0DBull),X(0xFDA8686FF0ull),
-	X(0xFDAF2C3784ull),X(0xFDB5E63755ull),X(0xFDBC966F20ull),X(0xFDC33CDEA3ull),X(0xFDC9D9859Dull),X(0xFDD06C63CCull),X(0xFDD6F578EFull),X(0xFDDD74C4C6ull),
-	X(0xFDE3EA4712ull),X(0xFDEA55FF91ull),X(0xFDF0B7EE05ull),X(0xFDF710122Full),X(0xFDFD5E6BCFull),X(0xFE03A2FAA9ull),X(0xFE09DDBE7Dull),X(0xFE100EB710ull),
-	X(0xFE1635E422ull),X(0xFE1C534578ull),X(0xFE2266DAD6ull),X(0xFE2870A3FEull),X(0xFE2E70A0B7ull),X(0xFE3466D0C4ull),X(0xFE3A5333EBull),X(0xFE4035C9F1ull),
-	X(0xFE460E929Cull),X(0xFE4BDD8DB2ull),X(0xFE51A2BAFBull),X(0xFE575E1A3Dull),X(0xFE5D0FAB3Full),X(0xFE62B76DCAull),X(0xFE685561A6ull),X(0xFE6DE9869Aull),
-	X(0xFE7373DC71ull),X(0xFE78F462F3ull),X(0xFE7E6B19EAull),X(0xFE83D80120ull),X(0xFE893B1860ull),X(0xFE8E945F75ull),X(0xFE93E3D629ull),X(0xFE99297C48ull),
-	X(0xFE9E65519Full),X(0xFEA39755F9ull),X(0xFEA8BF8923ull),X(0xFEADDDEAEBull),X(0xFEB2F27B1Eull),X(0xFEB7FD3989ull),X(0xFEBCFE25FCull),X(0xFEC1F54044ull),
-	X(0xFEC6E28830ull),X(0xFECBC5FD91ull),X(0xFED09FA035ull),X(0xFED56F6FEDull),X(0xFEDA356C8Aull),X(0xFEDEF195DCull),X(0xFEE3A3EBB4ull),X(0xFEE84C6DE4ull),
-	X(0xFEECEB1C3Full),X(0xFEF17FF696ull),X(0xFEF60AFCBCull),X(0xFEFA8C2E86ull),X(0xFEFF038BC5ull),X(0xFF0371144Eull),X(0xFF07D4C7F5ull),X(0xFF0C2EA68Full),
-	X(0xFF107EAFF2ull),X(0xFF14C4E3F2ull),X(0xFF19014265ull),X(0xFF1D33CB21ull),X(0xFF215C7DFEull),X(0xFF257B5AD2ull),X(0xFF29906174ull),X(0xFF2D9B91BCull),
-	X(0xFF319CEB82ull),X(0xFF35946E9Eull),X(0xFF39821AEAull),X(0xFF3D65F03Full),X(0xFF413FEE76ull),X(0xFF4510156Aull),X(0xFF48D664F4ull),X(0xFF4C92DCEFull),
-	X(0xFF50457D37ull),X(0xFF53EE45A7ull),X(0xFF578D361Bull),X(0xFF5B224E6Full),X(0xFF5EAD8E7Full),X(0xFF622EF62Aull),X(0xFF65A6854Cull),X(0xFF69143BC2ull),
-	X(0xFF6C78196Cull),X(0xFF6FD21E28ull),X(0xFF732249D4ull),X(0xFF76689C51ull),X(0xFF79A5157Cull),X(0xFF7CD7B538ull),X(0xFF80007B64ull),X(0xFF831F67E0ull),
-	X(0xFF86347A8Full),X(0xFF893FB351ull),X(0xFF8C411209ull),X(0xFF8F389699ull),X(0xFF922640E4ull),X(0xFF950A10CDull),X(0xFF97E40636ull),X(0xFF9AB42105ull),
-	X(0xFF9D7A611Eull),X(0xFFA036C664ull),X(0xFFA2E950BEull),X(0xFFA5920010ull),X(0xFFA830D440ull),X(0xFFAAC5CD34ull),X(0xFFAD50EAD3ull),X(0xFFAFD22D04ull),
-	X(0xFFB24993ADull),X(0xFFB4B71EB8ull),X(0xFFB71ACE0Bull),X(0xFFB974A18Full),X(0xFFBBC4992Dull),X(0xFFBE0AB4CEull),X(0xFFC046F45Cull),X(0xFFC27957C0ull),
-	X(0xFFC4A1DEE5ull),X(0xFFC6C089B6ull),X(0xFFC8D5581Dull),X(0xFFCAE04A06ull),X(0xFFCCE15F5Eull),X(0xFFCED8980Full),X(0xFFD0C5F408ull),X(0xFFD2A97334ull),
-	X(0xFFD4831581ull),X(0xFFD652DADDull),X(0xFFD818C336ull),X(0xFFD9D4CE7Aull),X(0xFFDB86FC99ull),X(0xFFDD2F4D81ull),X(0xFFDECDC123ull),X(0xFFE062576Eull),
-	X(0xFFE1ED1053ull),X(0xFFE36DEBC2ull),X(0xFFE4E4E9ACull),X(0xFFE6520A04ull),X(0xFFE7B54CBBull),X(0xFFE90EB1C4ull),X(0xFFEA5E3910ull),X(0xFFEBA3E293ull),
-	X(0xFFECDFAE42ull),X(0xFFEE119C0Eull),X(0xFFEF39ABEDull),X(0xFFF057DDD3ull),X(0xFFF16C31B6ull),X(0xFFF276A78Aull),X(0xFFF3773F45ull),X(0xFFF46DF8DEull),
-	X(0xFFF55AD44Aull),X(0xFFF63DD181ull),X(0xFFF716F07Aull),X(0xFFF7E6312Dull),X(0xFFF8AB9391ull),X(0xFFF967179Full),X(0xFFFA18BD50ull),X(0xFFFAC0849Dull),
-	X(0xFFFB5E6D80ull),X(0xFFFBF277F1ull),X(0xFFFC7CA3ECull),X(0xFFFCFCF16Cull),X(0xFFFD73606Bull),X(0xFFFDDFF0E5ull),X(0xFFFE42A2D5ull),X(0xFFFE9B7638ull),
+#else
+# define FOURIER_SINTABLE_VALUES_1024(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 2048
+# define FOURIER_SINTABLE_VALUES_2048(X) \
+	X(0x001921FB49ull),X(0x004B65F0E5ull),X(0x007DA9E399ull),X(0x00AFEDD174ull),X(0x00E231B887ull),X(0x01147596E2ull),X(0x0146B96A94ull),X(0x0178FD31ADull), \
+	X(0x01AB40EA3Eull),X(0x01DD849256ull),X(0x020FC82805ull),X(0x02420BA95Bull),X(0x02744F1468ull),X(0x02A692673Cull),X(0x02D8D59FE6ull),X(0x030B18BC77ull), \
+	X(0x033D5BBAFFull),X(0x036F9E998Dull),X(0x03A1E15632ull),X(0x03D423EEFEull),X(0x04066661FFull),X(0x0438A8AD47ull),X(0x046AEACEE6ull),X(0x049D2CC4EBull), \
+	X(0x04CF6E8D66ull),X(0x0501B02667ull),X(0x0533F18DFEull),X(0x056632C23Cull),X(0x059873C130ull),X(0x05CAB488EAull),X(0x05FCF5177Bull),X(0x062F356AF2ull), \
+	X(0x066175815Full),X(0x0693B558D2ull),X(0x06C5F4EF5Cull),X(0x06F834430Dull),X(0x072A7351F4ull),X(0x075CB21A22ull),X(0x078EF099A7ull),X(0x07C12ECE93ull), \
+	X(0x07F36CB6F5ull),X(0x0825AA50DFull),X(0x0857E79A60ull),X(0x088A249189ull),X(0x08BC613469ull),X(0x08EE9D8111ull),X(0x0920D97591ull),X(0x0953150FF9ull), \
+	X(0x0985504E5Aull),X(0x09B78B2EC4ull),X(0x09E9C5AF46ull),X(0x0A1BFFCDF1ull),X(0x0A4E3988D6ull),X(0x0A8072DE05ull),X(0x0AB2ABCB8Eull),X(0x0AE4E44F81ull), \
+	X(0x0B171C67EFull),X(0x0B495412E8ull),X(0x0B7B8B4E7Dull),X(0x0BADC218BDull),X(0x0BDFF86FBAull),X(0x0C122E5183ull),X(0x0C4463BC2Aull),X(0x0C7698ADBEull), \
+	X(0x0CA8CD2450ull),X(0x0CDB011DF1ull),X(0x0D0D3498B1ull),X(0x0D3F6792A0ull),X(0x0D719A09D0ull),X(0x0DA3CBFC51ull),X(0x0DD5FD6832ull),X(0x0E082E4B86ull), \
+	X(0x0E3A5EA45Cull),X(0x0E6C8E70C6ull),X(0x0E9EBDAED4ull),X(0x0ED0EC5C96ull),X(0x0F031A781Dull),X(0x0F3547FF7Bull),X(0x0F6774F0BFull),X(0x0F99A149FBull), \
+	X(0x0FCBCD0940ull),X(0x0FFDF82C9Eull),X(0x103022B226ull),X(0x10624C97E9ull),X(0x109475DBF8ull),X(0x10C69E7C63ull),X(0x10F8C6773Dull),X(0x112AEDCA95ull), \
+	X(0x115D14747Eull),X(0x118F3A7307ull),X(0x11C15FC442ull),X(0x11F384663Full),X(0x1225A85711ull),X(0x1257CB94C8ull),X(0x1289EE1D76ull),X(0x12BC0FEF2Bull), \
+	X(0x12EE3107F9ull),X(0x13205165F0ull),X(0x1352710724ull),X(0x13848FE9A3ull),X(0x13B6AE0B81ull),X(0x13E8CB6ACEull),X(0x141AE8059Bull),X(0x144D03D9FBull), \
+	X(0x147F1EE5FEull),X(0x14B13927B6ull),X(0x14E3529D34ull),X(0x15156B448Bull),X(0x1547831BCBull),X(0x15799A2107ull),X(0x15ABB0524Full),X(0x15DDC5ADB6ull), \
+	X(0x160FDA314Dull),X(0x1641EDDB26ull),X(0x167400A952ull),X(0x16A61299E4ull),X(0x16D823AAEEull),X(0x170A33DA81ull),X(0x173C4326AEull),X(0x176E518D89ull), \
+	X(0x17A05F0D23ull),X(0x17D26BA38Dull),X(0x1804774EDBull),X(0x1836820D1Eull),X(0x18688BDC68ull),X(0x189A94BACBull),X(0x18CC9CA65Aull),X(0x18FEA39D26ull), \
+	X(0x1930A99D43ull),X(0x1962AEA4C1ull),X(0x1994B2B1B4ull),X(0x19C6B5C22Full),X(0x19F8B7D442ull),X(0x1A2AB8E602ull),X(0x1A5CB8F57Full),X(0x1A8EB800CEull), \
+	X(0x1AC0B605FFull),X(0x1AF2B30327ull),X(0x1B24AEF657ull),X(0x1B56A9DDA3ull),X(0x1B88A3B71Cull),X(0x1BBA9C80D6ull),X(0x1BEC9438E4ull),X(0x1C1E8ADD58ull), \
+	X(0x1C50806C45ull),X(0x1C8274E3BFull),X(0x1CB46841D7ull),X(0x1CE65A84A2ull),X(0x1D184BAA32ull),X(0x1D4A3BB09Aull),X(0x1D7C2A95EDull),X(0x1DAE185840ull), \
+	X(0x1DE004F5A4ull),X(0x1E11F06C2Dull),X(0x1E43DAB9EEull),X(0x1E75C3DCFBull),X(0x1EA7ABD367ull),X(0x1ED9929B46ull),X(0x1F0B7832ABull),X(0x1F3D5C97AAull), \
+	X(0x1F6F3FC856ull),X(0x1FA121C2C2ull),X(0x1FD3028504ull),X(0x2004E20D2Dull),X(0x2036C05952ull),X(0x20689D6788ull),X(0x209A7935E1ull),X(0x20CC53C271ull), \
+	X(0x20FE2D0B4Dull),X(0x2130050E89ull),X(0x2161DBCA38ull),X(0x2193B13C70ull),X(0x21C5856343ull),X(0x21F7583CC6ull),X(0x222929C70Dull),X(0x225AFA002Eull), \
+	X(0x228CC8E63Bull),X(0x22BE96774Aull),X(0x22F062B16Full),X(0x23222D92BEull),X(0x2353F7194Cull),X(0x2385BF432Eull),X(0x23B7860E78ull),X(0x23E94B793Full), \
+	X(0x241B0F8199ull),X(0x244CD22598ull),X(0x247E936354ull),X(0x24B05338DFull),X(0x24E211A451ull),X(0x2513CEA3BCull),X(0x25458A3538ull),X(0x25774456D8ull), \
+	X(0x25A8FD06B2ull),X(0x25DAB442DBull),X(0x260C6A0969ull),X(0x263E1E5871ull),X(0x266FD12E09ull),X(0x26A1828845ull),X(0x26D332653Cull),X(0x2704E0C302ull), \
+	X(0x27368D9FAFull),X(0x276838F957ull),X(0x2799E2CE10ull),X(0x27CB8B1BF0ull),X(0x27FD31E10Eull),X(0x282ED71B7Eull),X(0x28607AC957ull),X(0x28921CE8AFull), \
+	X(0x28C3BD779Dull),X(0x28F55C7435ull),X(0x2926F9DC90ull),X(0x295895AEC2ull),X(0x298A2FE8E3ull),X(0x29BBC88909ull),X(0x29ED5F8D49ull),X(0x2A1EF4F3BCull), \
+	X(0x2A5088BA77ull),X(0x2A821ADF91ull),X(0x2AB3AB6122ull),X(0x2AE53A3D3Full),X(0x2B16C771FFull),X(0x2B4852FD7Bull),X(0x2B79DCDDC7ull),X(0x2BAB6510FDull), \
+	X(0x2BDCEB9532ull),X(0x2C0E70687Eull),X(0x2C3FF388F9ull),X(0x2C7174F4B9ull),X(0x2CA2F4A9D6ull),X(0x2CD472A668ull),X(0x2D05EEE885ull),X(0x2D37696E47ull), \
+	X(0x2D68E235C3ull),X(0x2D9A593D13ull),X(0x2DCBCE824Dull),X(0x2DFD42038Aull),X(0x2E2EB3BEE2ull),X(0x2E6023B26Cull),X(0x2E9191DC41ull),X(0x2EC2FE3A79ull), \
+	X(0x2EF468CB2Bull),X(0x2F25D18C71ull),X(0x2F57387C63ull),X(0x2F889D9919ull),X(0x2FBA00E0ABull),X(0x2FEB625133ull),X(0x301CC1E8C8ull),X(0x304E1FA584ull), \
+	X(0x307F7B857Full),X(0x30B0D586D3ull),X(0x30E22DA797ull),X(0x311383E5E5ull),X(0x3144D83FD6ull),X(0x31762AB384ull),X(0x31A77B3F07ull),X(0x31D8C9E079ull), \
+	X(0x320A1695F2ull),X(0x323B615D8Eull),X(0x326CAA3564ull),X(0x329DF11B8Full),X(0x32CF360E28ull),X(0x3300790B49ull),X(0x3331BA110Cull),X(0x3362F91D8Aull), \
+	X(0x3394362EDEull),X(0x33C5714322ull),X(0x33F6AA5870ull),X(0x3427E16CE1ull),X(0x3459167E91ull),X(0x348A498B9Aull),X(0x34BB7A9215ull),X(0x34ECA9901Eull), \
+	X(0x351DD683CFull),X(0x354F016B42ull),X(0x35802A4493ull),X(0x35B1510DDDull),X(0x35E275C539ull),X(0x36139868C4ull),X(0x3644B8F698ull),X(0x3675D76CD0ull), \
+	X(0x36A6F3C988ull),X(0x36D80E0ADAull),X(0x3709262EE3ull),X(0x373A3C33BEull),X(0x376B501785ull),X(0x379C61D856ull),X(0x37CD71744Bull),X(0x37FE7EE981ull), \
+	X(0x382F8A3612ull),X(0x386093581Cull),X(0x38919A4DBAull),X(0x38C29F1508ull),X(0x38F3A1AC23ull),X(0x3924A21127ull),X(0x3955A04230ull),X(0x39869C3D5Aull), \
+	X(0x39B79600C3ull),X(0x39E88D8A86ull),X(0x3A1982D8C1ull),X(0x3A4A75E991ull),X(0x3A7B66BB11ull),X(0x3AAC554B60ull),X(0x3ADD41989Aull),X(0x3B0E2BA0DDull), \
+	X(0x3B3F136245ull),X(0x3B6FF8DAF0ull),X(0x3BA0DC08FBull),X(0x3BD1BCEA84ull),X(0x3C029B7DA9ull),X(0x3C3377C087ull),X(0x3C6451B13Cull),X(0x3C95294DE6ull), \
+	X(0x3CC5FE94A2ull),X(0x3CF6D1838Full),X(0x3D27A218CBull),X(0x3D58705274ull),X(0x3D893C2EA9ull),X(0x3DBA05AB87ull),X(0x3DEACCC72Eull),X(0x3E1B917FBBull), \
+	X(0x3E4C53D34Eull),X(0x3E7D13C006ull),X(0x3EADD14400ull),X(0x3EDE8C5D5Dull),X(0x3F0F450A3Bull),X(0x3F3FFB48B9ull),X(0x3F70AF16F7ull),X(0x3FA1607314ull), \
+	X(0x3FD20F5B2Full),X(0x4002BBCD67ull),X(0x403365C7DEull),X(0x40640D48B1ull),X(0x4094B24E01ull),X(0x40C554D5EEull),X(0x40F5F4DE98ull),X(0x412692661Full), \
+	X(0x41572D6AA3ull),X(0x4187C5EA44ull),X(0x41B85BE324ull),X(0x41E8EF5361ull),X(0x421980391Dull),X(0x424A0E9279ull),X(0x427A9A5D95ull),X(0x42AB239892ull), \
+	X(0x42DBAA4191ull),X(0x430C2E56B3ull),X(0x433CAFD61Aull),X(0x436D2EBDE6ull),X(0x439DAB0C39ull),X(0x43CE24BF35ull),X(0x43FE9BD4FAull),X(0x442F104BACull), \
+	X(0x445F82216Bull),X(0x448FF15459ull),X(0x44C05DE298ull),X(0x44F0C7CA4Bull),X(0x45212F0993ull),X(0x4551939E93ull),X(0x4581F5876Dull),X(0x45B254C244ull), \
+	X(0x45E2B14D3Aull),X(0x46130B2672ull),X(0x4643624C0Full),X(0x4673B6BC33ull),X(0x46A4087502ull),X(0x46D457749Full),X(0x4704A3B92Dull),X(0x4734ED40CFull), \
+	X(0x47653409A9ull),X(0x47957811DEull),X(0x47C5B95792ull),X(0x47F5F7D8E9ull),X(0x4826339406ull),X(0x48566C870Dull),X(0x4886A2B023ull),X(0x48B6D60D6Cull), \
+	X(0x48E7069D0Bull),X(0x4917345D26ull),X(0x49475F4BE1ull),X(0x4977876760ull),X(0x49A7ACADC8ull),X(0x49D7CF1D3Full),X(0x4A07EEB3E8ull),X(0x4A380B6FE9ull), \
+	X(0x4A68254F67ull),X(0x4A983C5088ull),X(0x4AC8507170ull),X(0x4AF861B045ull),X(0x4B28700B2Dull),X(0x4B587B804Eull),X(0x4B88840DCDull),X(0x4BB889B1D0ull), \
+	X(0x4BE88C6A7Eull),X(0x4C188C35FCull),X(0x4C48891271ull),X(0x4C7882FE03ull),X(0x4CA879F6D8ull),X(0x4CD86DFB18ull),X(0x4D085F08E8ull),X(0x4D384D1E70ull), \
+	X(0x4D683839D7ull),X(0x4D98205944ull),X(0x4DC8057ADEull),X(0x4DF7E79CCCull),X(0x4E27C6BD35ull),X(0x4E57A2DA42ull),X(0x4E877BF219ull),X(0x4EB75202E3ull), \
+	X(0x4EE7250AC8ull),X(0x4F16F507EFull),X(0x4F46C1F880ull),X(0x4F768BDAA5ull),X(0x4FA652AC84ull),X(0x4FD6166C47ull),X(0x5005D71816ull),X(0x503594AE1Aull), \
+	X(0x50654F2C7Cull),X(0x5095069165ull),X(0x50C4BADAFDull),X(0x50F46C076Eull),X(0x51241A14E1ull),X(0x5153C5017Full),X(0x51836CCB73ull),X(0x51B31170E6ull), \
+	X(0x51E2B2F001ull),X(0x52125146EFull),X(0x5241EC73D9ull),X(0x52718474E9ull),X(0x52A119484Bull),X(0x52D0AAEC28ull),X(0x5300395EABull),X(0x532FC49DFEull), \
+	X(0x535F4CA84Cull),X(0x538ED17BC1ull),X(0x53BE531686ull),X(0x53EDD176C8ull),X(0x541D4C9AB2ull),X(0x544CC4806Eull),X(0x547C392628ull),X(0x54ABAA8A0Dull), \
+	X(0x54DB18AA47ull),X(0x550A838503ull),X(0x5539EB186Dull),X(0x55694F62B0ull),X(0x5598B061F9ull),X(0x55C80E1475ull),X(0x55F7687850ull),X(0x5626BF8BB6ull), \
+	X(0x5656134CD5ull),X(0x568563B9D9ull),X(0x56B4B0D0F0ull),X(0x56E3FA9045ull),X(0x571340F608ull),X(0x5742840065ull),X(0x5771C3AD89ull),X(0x57A0FFFBA3ull), \
+	X(0x57D038E8E0ull),X(0x57FF6E736Eull),X(0x582EA0997Bull),X(0x585DCF5936ull),X(0x588CFAB0CCull),X(0x58BC229E6Cull),X(0x58EB472046ull),X(0x591A683486ull), \
+	X(0x594985D95Dull),X(0x5978A00CFAull),X(0x59A7B6CD8Aull),X(0x59D6CA193Full),X(0x5A05D9EE46ull),X(0x5A34E64AD0ull),X(0x5A63EF2D0Cull),X(0x5A92F4932Bull), \
+	X(0x5AC1F67B5Bull),X(0x5AF0F4E3CDull),X(0x5B1FEFCAB1ull),X(0x5B4EE72E38ull),X(0x5B7DDB0C92ull),X(0x5BACCB63EFull),X(0x5BDBB83281ull),X(0x5C0AA17678ull), \
+	X(0x5C39872E05ull),X(0x5C68695759ull),X(0x5C9747F0A6ull),X(0x5CC622F81Dull),X(0x5CF4FA6BF0ull),X(0x5D23CE4A4Full),X(0x5D529E916Eull),X(0x5D816B3F7Eull), \
+	X(0x5DB03452B1ull),X(0x5DDEF9C939ull),X(0x5E0DBBA14Aull),X(0x5E3C79D914ull),X(0x5E6B346ECCull),X(0x5E99EB60A3ull),X(0x5EC89EACCDull),X(0x5EF74E517Dull), \
+	X(0x5F25FA4CE5ull),X(0x5F54A29D3Bull),X(0x5F834740B0ull),X(0x5FB1E83579ull),X(0x5FE08579C9ull),X(0x600F1F0BD4ull),X(0x603DB4E9CFull),X(0x606C4711EDull), \
+	X(0x609AD58264ull),X(0x60C9603966ull),X(0x60F7E7352Aull),X(0x61266A73E4ull),X(0x6154E9F3C9ull),X(0x618365B30Dull),X(0x61B1DDAFE7ull),X(0x61E051E88Bull), \
+	X(0x620EC25B30ull),X(0x623D2F060Aull),X(0x626B97E74Full),X(0x6299FCFD36ull),X(0x62C85E45F5ull),X(0x62F6BBBFC1ull),X(0x63251568D2ull),X(0x63536B3F5Dull), \
+	X(0x6381BD419Aull),X(0x63B00B6DBFull),X(0x63DE55C204ull),X(0x640C9C3C9Eull),X(0x643ADEDBC7ull),X(0x64691D9DB4ull),X(0x649758809Full),X(0x64C58F82BDull), \
+	X(0x64F3C2A248ull),X(0x6521F1DD78ull),X(0x65501D3283ull),X(0x657E449FA4ull),X(0x65AC682312ull),X(0x65DA87BB06ull),X(0x6608A365B8ull),X(0x6636BB2163ull), \
+	X(0x6664CEEC3Eull),X(0x6692DEC483ull),X(0x66C0EAA86Bull),X(0x66EEF29630ull),X(0x671CF68C0Cull),X(0x674AF68838ull),X(0x6778F288EEull),X(0x67A6EA8C6Aull), \
+	X(0x67D4DE90E4ull),X(0x6802CE9497ull),X(0x6830BA95BFull),X(0x685EA29295ull),X(0x688C868954ull),X(0x68BA667839ull),X(0x68E8425D7Dull),X(0x69161A375Dull), \
+	X(0x6943EE0414ull),X(0x6971BDC1DDull),X(0x699F896EF5ull),X(0x69CD510997ull),X(0x69FB149000ull),X(0x6A28D4006Cull),X(0x6A568F5918ull),X(0x6A8446983Full), \
+	X(0x6AB1F9BC20ull),X(0x6ADFA8C2F6ull),X(0x6B0D53AAFFull),X(0x6B3AFA7279ull),X(0x6B689D17A0ull),X(0x6B963B98B3ull),X(0x6BC3D5F3EEull),X(0x6BF16C2791ull), \
+	X(0x6C1EFE31D9ull),X(0x6C4C8C1104ull),X(0x6C7A15C351ull),X(0x6CA79B46FEull),X(0x6CD51C9A4Aull),X(0x6D0299BB74ull),X(0x6D3012A8BAull),X(0x6D5D87605Dull), \
+	X(0x6D8AF7E09Cull),X(0x6DB86427B5ull),X(0x6DE5CC33E9ull),X(0x6E13300378ull),X(0x6E408F94A1ull),X(0x6E6DEAE5A5ull),X(0x6E9B41F4C4ull),X(0x6EC894C03Full), \
+	X(0x6EF5E34656ull),X(0x6F232D854Aull),X(0x6F50737B5Cull),X(0x6F7DB526CEull),X(0x6FAAF285E0ull),X(0x6FD82B96D4ull),X(0x70056057ECull),X(0x703290C76Aull), \
+	X(0x705FBCE390ull),X(0x708CE4AA9Full),X(0x70BA081ADBull),X(0x70E7273285ull),X(0x711441EFE0ull),X(0x7141585130ull),X(0x716E6A54B7ull),X(0x719B77F8B8ull), \
+	X(0x71C8813B77ull),X(0x71F5861B37ull),X(0x722286963Cull),X(0x724F82AAC9ull),X(0x727C7A5724ull),X(0x72A96D998Full),X(0x72D65C7050ull),X(0x730346D9AAull), \
+	X(0x73302CD3E3ull),X(0x735D0E5D40ull),X(0x7389EB7404ull),X(0x73B6C41677ull),X(0x73E39842DCull),X(0x741067F77Aull),X(0x743D333297ull),X(0x7469F9F277ull), \
+	X(0x7496BC3562ull),X(0x74C379F99Dull),X(0x74F0333D70ull),X(0x751CE7FF20ull),X(0x7549983CF4ull),X(0x757643F534ull),X(0x75A2EB2626ull),X(0x75CF8DCE11ull), \
+	X(0x75FC2BEB3Eull),X(0x7628C57BF4ull),X(0x76555A7E7Aull),X(0x7681EAF119ull),X(0x76AE76D218ull),X(0x76DAFE1FC1ull),X(0x770780D85Bull),X(0x7733FEFA30ull), \
+	X(0x7760788388ull),X(0x778CED72ACull),X(0x77B95DC5E5ull),X(0x77E5C97B7Eull),X(0x78123091BFull),X(0x783E9306F2ull),X(0x786AF0D961ull),X(0x78974A0757ull), \
+	X(0x78C39E8F1Dull),X(0x78EFEE6EFFull),X(0x791C39A546ull),X(0x794880303Dull),X(0x7974C20E31ull),X(0x79A0FF3D6Bull),X(0x79CD37BC37ull),X(0x79F96B88E1ull), \
+	X(0x7A259AA1B4ull),X(0x7A51C504FDull),X(0x7A7DEAB108ull),X(0x7AAA0BA420ull),X(0x7AD627DC92ull),X(0x7B023F58ABull),X(0x7B2E5216B8ull),X(0x7B5A601506ull), \
+	X(0x7B866951E2ull),X(0x7BB26DCB99ull),X(0x7BDE6D8079ull),X(0x7C0A686ECFull),X(0x7C365E94EAull),X(0x7C624FF118ull),X(0x7C8E3C81A7ull),X(0x7CBA2444E5ull), \
+	X(0x7CE6073922ull),X(0x7D11E55CABull),X(0x7D3DBEADD1ull),X(0x7D69932AE1ull),X(0x7D9562D22Dull),X(0x7DC12DA202ull),X(0x7DECF398B2ull),X(0x7E18B4B48Cull), \
+	X(0x7E4470F3E0ull),X(0x7E702854FFull),X(0x7E9BDAD639ull),X(0x7EC78875DEull),X(0x7EF3313241ull),X(0x7F1ED509B1ull),X(0x7F4A73FA80ull),X(0x7F760E0300ull), \
+	X(0x7FA1A32182ull),X(0x7FCD335459ull),X(0x7FF8BE99D5ull),X(0x802444F04Aull),X(0x804FC6560Aull),X(0x807B42C967ull),X(0x80A6BA48B5ull),X(0x80D22CD246ull), \
+	X(0x80FD9A646Dull),X(0x812902FD7Eull),X(0x8154669BCDull),X(0x817FC53DADull),X(0x81AB1EE172ull),X(0x81D6738570ull),X(0x8201C327FCull),X(0x822D0DC76Aull), \
+	X(0x825853620Full),X(0x828393F640ull),X(0x82AECF8252ull),X(0x82DA06049Aull),X(0x8305377B6Eull),X(0x833063E523ull),X(0x835B8B4010ull),X(0x8386AD8A8Aull), \
+	X(0x83B1CAC2E8ull),X(0x83DCE2E781ull),X(0x8407F5F6AAull),X(0x843303EEBAull),X(0x845E0CCE0Aull),X(0x84891092F0ull),X(0x84B40F3BC3ull),X(0x84DF08C6DCull), \
+	X(0x8509FD3292ull),X(0x8534EC7D3Cull),X(0x855FD6A535ull),X(0x858ABBA8D3ull),X(0x85B59B866Full),X(0x85E0763C63ull),X(0x860B4BC907ull),X(0x86361C2AB5ull), \
+	X(0x8660E75FC6ull),X(0x868BAD6694ull),X(0x86B66E3D78ull),X(0x86E129E2CDull),X(0x870BE054ECull),X(0x8736919231ull),X(0x87613D98F6ull),X(0x878BE46796ull), \
+	X(0x87B685FC6Bull),X(0x87E12255D1ull),X(0x880BB97224ull),X(0x88364B4FBFull),X(0x8860D7ECFFull),X(0x888B5F483Eull),X(0x88B5E15FD9ull),X(0x88E05E322Dull), \
+	X(0x890AD5BD97ull),X(0x8935480073ull),X(0x895FB4F91Full),X(0x898A1CA5F7ull),X(0x89B47F0559ull),X(0x89DEDC15A3ull),X(0x8A0933D533ull),X(0x8A33864266ull), \
+	X(0x8A5DD35B9Cull),X(0x8A881B1F32ull),X(0x8AB25D8B88ull),X(0x8ADC9A9EFCull),X(0x8B06D257EDull),X(0x8B3104B4BBull),X(0x8B5B31B3C5ull),X(0x8B8559536Bull), \
+	X(0x8BAF7B920Dull),X(0x8BD9986E0Bull),X(0x8C03AFE5C5ull),X(0x8C2DC1F79Dull),X(0x8C57CEA1F2ull),X(0x8C81D5E326ull),X(0x8CABD7B99Aull),X(0x8CD5D423B0ull), \
+	X(0x8CFFCB1FC8ull),X(0x8D29BCAC45ull),X(0x8D53A8C789ull),X(0x8D7D8F6FF6ull),X(0x8DA770A3EFull),X(0x8DD14C61D6ull),X(0x8DFB22A80Eull),X(0x8E24F374FAull), \
+	X(0x8E4EBEC6FEull),X(0x8E78849C7Cull),X(0x8EA244F3DAull),X(0x8ECBFFCB7Aull),X(0x8EF5B521C0ull),X(0x8F1F64F512ull),X(0x8F490F43D4ull),X(0x8F72B40C69ull), \
+	X(0x8F9C534D39ull),X(0x8FC5ED04A7ull),X(0x8FEF813119ull),X(0x90190FD0F5ull),X(0x904298E2A1ull),X(0x906C1C6482ull),X(0x90959A54FFull),X(0x90BF12B27Eull), \
+	X(0x90E8857B67ull),X(0x9111F2AE1Full),X(0x913B5A490Full),X(0x9164BC4A9Dull),X(0x918E18B132ull),X(0x91B76F7B34ull),X(0x91E0C0A70Cull),X(0x920A0C3322ull), \
+	X(0x9233521DDFull),X(0x925C9265AAull),X(0x9285CD08EEull),X(0x92AF020613ull),X(0x92D8315B83ull),X(0x93015B07A6ull),X(0x932A7F08E7ull),X(0x93539D5DB0ull), \
+	X(0x937CB6046Aull),X(0x93A5C8FB81ull),X(0x93CED6415Eull),X(0x93F7DDD46Eull),X(0x9420DFB31Aull),X(0x9449DBDBCEull),X(0x9472D24CF5ull),X(0x949BC304FCull), \
+	X(0x94C4AE024Dull),X(0x94ED934356ull),X(0x951672C683ull),X(0x953F4C8A40ull),X(0x9568208CFAull),X(0x9590EECD1Full),X(0x95B9B7491Aull),X(0x95E279FF5Bull), \
+	X(0x960B36EE4Eull),X(0x9633EE1462ull),X(0x965C9F7004ull),X(0x96854AFFA3ull),X(0x96ADF0C1AEull),X(0x96D690B494ull),X(0x96FF2AD6C3ull),X(0x9727BF26ABull), \
+	X(0x97504DA2BBull),X(0x9778D64963ull),X(0x97A1591913ull),X(0x97C9D6103Cull),X(0x97F24D2D4Dull),X(0x981ABE6EB7ull),X(0x984329D2EBull),X(0x986B8F585Aull), \
+	X(0x9893EEFD75ull),X(0x98BC48C0AFull),X(0x98E49CA078ull),X(0x990CEA9B43ull),X(0x993532AF82ull),X(0x995D74DBA7ull),X(0x9985B11E25ull),X(0x99ADE7756Full), \
+	X(0x99D617DFF7ull),X(0x99FE425C33ull),X(0x9A2666E894ull),X(0x9A4E85838Full),X(0x9A769E2B97ull),X(0x9A9EB0DF22ull),X(0x9AC6BD9CA3ull),X(0x9AEEC4628Full), \
+	X(0x9B16C52F5Cull),X(0x9B3EC0017Eull),X(0x9B66B4D76Bull),X(0x9B8EA3AF98ull),X(0x9BB68C887Bull),X(0x9BDE6F608Bull),X(0x9C064C363Eull),X(0x9C2E23080Aull), \
+	X(0x9C55F3D466ull),X(0x9C7DBE99CAull),X(0x9CA58356ACull),X(0x9CCD420983ull),X(0x9CF4FAB0C9ull),X(0x9D1CAD4AF4ull),X(0x9D4459D67Dull),X(0x9D6C0051DCull), \
+	X(0x9D93A0BB8Bull),X(0x9DBB3B1201ull),X(0x9DE2CF53B8ull),X(0x9E0A5D7F29ull),X(0x9E31E592CEull),X(0x9E59678D22ull),X(0x9E80E36C9Dull),X(0x9EA8592FBAull), \
+	X(0x9ECFC8D4F4ull),X(0x9EF7325AC5ull),X(0x9F1E95BFA9ull),X(0x9F45F3021Bull),X(0x9F6D4A2096ull),X(0x9F949B1996ull),X(0x9FBBE5EB97ull),X(0x9FE32A9515ull), \
+	X(0xA00A69148Dull),X(0xA031A1687Bull),X(0xA058D38F5Cull),X(0xA07FFF87AEull),X(0xA0A7254FEDull),X(0xA0CE44E698ull),X(0xA0F55E4A2Cull),X(0xA11C717927ull), \
+	X(0xA1437E7208ull),X(0xA16A85334Dull),X(0xA19185BB75ull),X(0xA1B8800900ull),X(0xA1DF741A6Cull),X(0xA20661EE39ull),X(0xA22D4982E6ull),X(0xA2542AD6F5ull), \
+	X(0xA27B05E8E4ull),X(0xA2A1DAB736ull),X(0xA2C8A94069ull),X(0xA2EF718300ull),X(0xA316337D7Bull),X(0xA33CEF2E5Dull),X(0xA363A49426ull),X(0xA38A53AD59ull), \
+	X(0xA3B0FC7878ull),X(0xA3D79EF406ull),X(0xA3FE3B1E84ull),X(0xA424D0F676ull),X(0xA44B607A60ull),X(0xA471E9A8C4ull),X(0xA4986C8027ull),X(0xA4BEE8FF0Bull), \
+	X(0xA4E55F23F6ull),X(0xA50BCEED6Cull),X(0xA5323859F1ull),X(0xA5589B680Bull),X(0xA57EF8163Eull),X(0xA5A54E630Full),X(0xA5CB9E4D05ull),X(0xA5F1E7D2A6ull), \
+	X(0xA6182AF276ull),X(0xA63E67AAFEull),X(0xA6649DFAC3ull),X(0xA68ACDE04Cull),X(0xA6B0F75A21ull),X(0xA6D71A66C8ull),X(0xA6FD3704CAull),X(0xA7234D32ADull), \
+	X(0xA7495CEEFCull),X(0xA76F66383Cull),X(0xA795690CF8ull),X(0xA7BB656BB8ull),X(0xA7E15B5305ull),X(0xA8074AC169ull),X(0xA82D33B56Dull),X(0xA853162D9Bull), \
+	X(0xA878F2287Dull),X(0xA89EC7A49Dull),X(0xA8C496A086ull),X(0xA8EA5F1AC3ull),X(0xA9102111DFull),X(0xA935DC8465ull),X(0xA95B9170E1ull),X(0xA9813FD5DFull), \
+	X(0xA9A6E7B1EAull),X(0xA9CC890390ull),X(0xA9F223C95Dull),X(0xAA17B801DDull),X(0xAA3D45AB9Eull),X(0xAA62CCC52Dull),X(0xAA884D4D18ull),X(0xAAADC741ECull), \
+	X(0xAAD33AA238ull),X(0xAAF8A76C8Aull),X(0xAB1E0D9F71ull),X(0xAB436D397Bull),X(0xAB68C63939ull),X(0xAB8E189D38ull),X(0xABB3646409ull),X(0xABD8A98C3Cull), \
+	X(0xABFDE81460ull),X(0xAC231FFB07ull),X(0xAC48513EC1ull),X(0xAC6D7BDE1Full),X(0xAC929FD7B2ull),X(0xACB7BD2A0Bull),X(0xACDCD3D3BCull),X(0xAD01E3D358ull), \
+	X(0xAD26ED2770ull),X(0xAD4BEFCE96ull),X(0xAD70EBC75Eull),X(0xAD95E1105Bull),X(0xADBACFA820ull),X(0xADDFB78D3Full),X(0xAE0498BE4Eull),X(0xAE297339DFull), \
+	X(0xAE4E46FE88ull),X(0xAE73140ADDull),X(0xAE97DA5D72ull),X(0xAEBC99F4DDull),X(0xAEE152CFB3ull),X(0xAF0604EC89ull),X(0xAF2AB049F6ull),X(0xAF4F54E68Full), \
+	X(0xAF73F2C0EBull),X(0xAF9889D7A0ull),X(0xAFBD1A2945ull),X(0xAFE1A3B472ull),X(0xB0062677BEull),X(0xB02AA271C0ull),X(0xB04F17A110ull),X(0xB073860447ull), \
+	X(0xB097ED99FDull),X(0xB0BC4E60CBull),X(0xB0E0A85749ull),X(0xB104FB7C11ull),X(0xB12947CDBCull),X(0xB14D8D4AE5ull),X(0xB171CBF224ull),X(0xB19603C215ull), \
+	X(0xB1BA34B952ull),X(0xB1DE5ED675ull),X(0xB20282181Bull),X(0xB2269E7CDDull),X(0xB24AB40359ull),X(0xB26EC2AA28ull),X(0xB292CA6FE9ull),X(0xB2B6CB5337ull), \
+	X(0xB2DAC552AEull),X(0xB2FEB86CECull),X(0xB322A4A08Eull),X(0xB34689EC32ull),X(0xB36A684E74ull),X(0xB38E3FC5F4ull),X(0xB3B210514Full),X(0xB3D5D9EF23ull), \
+	X(0xB3F99C9E11ull),X(0xB41D585CB6ull),X(0xB4410D29B2ull),X(0xB464BB03A5ull),X(0xB48861E92Eull),X(0xB4AC01D8EEull),X(0xB4CF9AD184ull),X(0xB4F32CD193ull), \
+	X(0xB516B7D7BAull),X(0xB53A3BE29Bull),X(0xB55DB8F0D7ull),X(0xB5812F0110ull),X(0xB5A49E11E9ull),X(0xB5C8062202ull),X(0xB5EB673000ull),X(0xB60EC13A84ull), \
+	X(0xB632144032ull),X(0xB655603FADull),X(0xB678A53799ull),X(0xB69BE3269Aull),X(0xB6BF1A0B53ull),X(0xB6E249E46Aull),X(0xB70572B083ull),X(0xB728946E43ull), \
+	X(0xB74BAF1C4Full),X(0xB76EC2B94Dull),X(0xB791CF43E2ull),X(0xB7B4D4BAB6ull),X(0xB7D7D31C6Dull),X(0xB7FACA67AFull),X(0xB81DBA9B23ull),X(0xB840A3B56Full), \
+	X(0xB86385B53Cull),X(0xB886609930ull),X(0xB8A9345FF5ull),X(0xB8CC010831ull),X(0xB8EEC6908Full),X(0xB91184F7B6ull),X(0xB9343C3C50ull),X(0xB956EC5D05ull), \
+	X(0xB979955880ull),X(0xB99C372D6Bull),X(0xB9BED1DA70ull),X(0xB9E1655E39ull),X(0xBA03F1B771ull),X(0xBA2676E4C3ull),X(0xBA48F4E4DAull),X(0xBA6B6BB662ull), \
+	X(0xBA8DDB5807ull),X(0xBAB043C875ull),X(0xBAD2A50658ull),X(0xBAF4FF105Cull),X(0xBB1751E530ull),X(0xBB399D8380ull),X(0xBB5BE1E9FAull),X(0xBB7E1F174Bull), \
+	X(0xBBA0550A22ull),X(0xBBC283C12Dull),X(0xBBE4AB3B1Aull),X(0xBC06CB7699ull),X(0xBC28E47258ull),X(0xBC4AF62D07ull),X(0xBC6D00A556ull),X(0xBC8F03D9F6ull), \
+	X(0xBCB0FFC995ull),X(0xBCD2F472E5ull),X(0xBCF4E1D497ull),X(0xBD16C7ED5Bull),X(0xBD38A6BBE4ull),X(0xBD5A7E3EE3ull),X(0xBD7C4E750Aull),X(0xBD9E175D0Bull), \
+	X(0xBDBFD8F599ull),X(0xBDE1933D66ull),X(0xBE03463326ull),X(0xBE24F1D58Dull),X(0xBE4696234Dull),X(0xBE68331B1Bull),X(0xBE89C8BBABull),X(0xBEAB5703B1ull), \
+	X(0xBECCDDF1E3ull),X(0xBEEE5D84F6ull),X(0xBF0FD5BB9Eull),X(0xBF31469492ull),X(0xBF52B00E88ull),X(0xBF74122835ull),X(0xBF956CE050ull),X(0xBFB6C03591ull), \
+	X(0xBFD80C26AEull),X(0xBFF950B25Eull),X(0xC01A8DD759ull),X(0xC03BC39458ull),X(0xC05CF1E812ull),X(0xC07E18D140ull),X(0xC09F384E9Bull),X(0xC0C0505EDBull), \
+	X(0xC0E16100BBull),X(0xC1026A32F3ull),X(0xC1236BF43Eull),X(0xC144664356ull),X(0xC165591EF6ull),X(0xC1864485D8ull),X(0xC1A72876B8ull),X(0xC1C804F050ull), \
+	X(0xC1E8D9F15Dull),X(0xC209A7789Aull),X(0xC22A6D84C4ull),X(0xC24B2C1498ull),X(0xC26BE326D1ull),X(0xC28C92BA2Dull),X(0xC2AD3ACD6Aull),X(0xC2CDDB5F46ull), \
+	X(0xC2EE746E7Eull),X(0xC30F05F9D0ull),X(0xC32F8FFFFBull),X(0xC350127FBEull),X(0xC3708D77D9ull),X(0xC39100E709ull),X(0xC3B16CCC11ull),X(0xC3D1D125AEull), \
+	X(0xC3F22DF2A2ull),X(0xC4128331ADull),X(0xC432D0E190ull),X(0xC45317010Cull),X(0xC473558EE3ull),X(0xC4938C89D7ull),X(0xC4B3BBF0A9ull),X(0xC4D3E3C21Cull), \
+	X(0xC4F403FCF2ull),X(0xC5141C9FEFull),X(0xC5342DA9D5ull),X(0xC554371969ull),X(0xC57438ED6Dull),X(0xC5943324A7ull),X(0xC5B425BDDAull),X(0xC5D410B7CBull), \
+	X(0xC5F3F4113Full),X(0xC613CFC8FCull),X(0xC633A3DDC7ull),X(0xC653704E65ull),X(0xC67335199Eull),X(0xC692F23E37ull),X(0xC6B2A7BAF7ull),X(0xC6D2558EA5ull), \
+	X(0xC6F1FBB809ull),X(0xC7119A35EBull),X(0xC731310711ull),X(0xC750C02A45ull),X(0xC770479E4Full),X(0xC78FC761F8ull),X(0xC7AF3F7408ull),X(0xC7CEAFD34Aull), \
+	X(0xC7EE187E86ull),X(0xC80D797488ull),X(0xC82CD2B419ull),X(0xC84C243C04ull),X(0xC86B6E0B14ull),X(0xC88AB02013ull),X(0xC8A9EA79CEull),X(0xC8C91D1711ull), \
+	X(0xC8E847F6A6ull),X(0xC9076B175Cull),X(0xC9268677FEull),X(0xC9459A1759ull),X(0xC964A5F43Bull),X(0xC983AA0D72ull),X(0xC9A2A661CBull),X(0xC9C19AF013ull), \
+	X(0xC9E087B71Bull),X(0xC9FF6CB5B1ull),X(0xCA1E49EAA3ull),X(0xCA3D1F54C1ull),X(0xCA5BECF2DBull),X(0xCA7AB2C3C1ull),X(0xCA9970C643ull),X(0xCAB826F932ull), \
+	X(0xCAD6D55B5Eull),X(0xCAF57BEB99ull),X(0xCB141AA8B4ull),X(0xCB32B19181ull),X(0xCB5140A4D2ull),X(0xCB6FC7E179ull),X(0xCB8E47464Aull),X(0xCBACBED217ull), \
+	X(0xCBCB2E83B4ull),X(0xCBE99659F3ull),X(0xCC07F653AAull),X(0xCC264E6FACull),X(0xCC449EACCDull),X(0xCC62E709E3ull),X(0xCC812785C3ull),X(0xCC9F601F42ull), \
+	X(0xCCBD90D536ull),X(0xCCDBB9A674ull),X(0xCCF9DA91D4ull),X(0xCD17F3962Cull),X(0xCD3604B252ull),X(0xCD540DE51Full),X(0xCD720F2D69ull),X(0xCD90088A08ull), \
+	X(0xCDADF9F9D6ull),X(0xCDCBE37BA9ull),X(0xCDE9C50E5Bull),X(0xCE079EB0C5ull),X(0xCE257061C1ull),X(0xCE433A2027ull),X(0xCE60FBEAD3ull),X(0xCE7EB5C09Eull), \
+	X(0xCE9C67A063ull),X(0xCEBA1188FDull),X(0xCED7B37947ull),X(0xCEF54D701Dull),X(0xCF12DF6C5Aull),X(0xCF30696CDBull),X(0xCF4DEB707Cull),X(0xCF6B65761Aull), \
+	X(0xCF88D77C92ull),X(0xCFA64182C1ull),X(0xCFC3A38786ull),X(0xCFE0FD89BDull),X(0xCFFE4F8846ull),X(0xD01B9981FFull),X(0xD038DB75C7ull),X(0xD05615627Dull), \
+	X(0xD073474701ull),X(0xD090712232ull),X(0xD0AD92F2F1ull),X(0xD0CAACB81Full),X(0xD0E7BE709Bull),X(0xD104C81B47ull),X(0xD121C9B705ull),X(0xD13EC342B6ull), \
+	X(0xD15BB4BD3Dull),X(0xD1789E257Bull),X(0xD1957F7A53ull),X(0xD1B258BAA9ull),X(0xD1CF29E55Full),X(0xD1EBF2F959ull),X(0xD208B3F57Bull),X(0xD2256CD8A9ull), \
+	X(0xD2421DA1C8ull),X(0xD25EC64FBDull),X(0xD27B66E16Cull),X(0xD297FF55BCull),X(0xD2B48FAB91ull),X(0xD2D117E1D2ull),X(0xD2ED97F766ull),X(0xD30A0FEB33ull), \
+	X(0xD3267FBC20ull),X(0xD342E76915ull),X(0xD35F46F0F9ull),X(0xD37B9E52B4ull),X(0xD397ED8D2Eull),X(0xD3B4349F51ull),X(0xD3D0738804ull),X(0xD3ECAA4631ull), \
+	X(0xD408D8D8C2ull),X(0xD424FF3EA1ull),X(0xD4411D76B7ull),X(0xD45D337FF0ull),X(0xD479415935ull),X(0xD495470173ull),X(0xD4B1447794ull),X(0xD4CD39BA85ull), \
+	X(0xD4E926C931ull),X(0xD5050BA284ull),X(0xD520E8456Cull),X(0xD53CBCB0D6ull),X(0xD55888E3AEull),X(0xD5744CDCE3ull),X(0xD590089B62ull),X(0xD5ABBC1E1Aull), \
+	X(0xD5C76763F9ull),X(0xD5E30A6BEEull),X(0xD5FEA534E9ull),X(0xD61A37BDD9ull),X(0xD635C205ADull),X(0xD651440B57ull),X(0xD66CBDCDC6ull),X(0xD6882F4BECull), \
+	X(0xD6A39884B9ull),X(0xD6BEF9771Full),X(0xD6DA522210ull),X(0xD6F5A2847Dull),X(0xD710EA9D5Bull),X(0xD72C2A6B9Aull),X(0xD74761EE2Eull),X(0xD76291240Aull), \
+	X(0xD77DB80C23ull),X(0xD798D6A56Cull),X(0xD7B3ECEEDAull),X(0xD7CEFAE761ull),X(0xD7EA008DF6ull),X(0xD804FDE18Eull),X(0xD81FF2E120ull),X(0xD83ADF8BA1ull), \
+	X(0xD855C3E007ull),X(0xD8709FDD49ull),X(0xD88B73825Dull),X(0xD8A63ECE3Cull),X(0xD8C101BFDCull),X(0xD8DBBC5636ull),X(0xD8F66E9042ull),X(0xD911186CF8ull), \
+	X(0xD92BB9EB50ull),X(0xD946530A45ull),X(0xD960E3C8D0ull),X(0xD97B6C25EAull),X(0xD995EC208Eull),X(0xD9B063B7B6ull),X(0xD9CAD2EA5Dull),X(0xD9E539B77Eull), \
+	X(0xD9FF981E14ull),X(0xDA19EE1D1Bull),X(0xDA343BB390ull),X(0xDA4E80E06Eull),X(0xDA68BDA2B2ull),X(0xDA82F1F95Aull),X(0xDA9D1DE363ull),X(0xDAB7415FCAull), \
+	X(0xDAD15C6D8Dull),X(0xDAEB6F0BACull),X(0xDB05793924ull),X(0xDB1F7AF4F4ull),X(0xDB39743E1Cull),X(0xDB5365139Cull),X(0xDB6D4D7473ull),X(0xDB872D5FA2ull), \
+	X(0xDBA104D42Aull),X(0xDBBAD3D10Aull),X(0xDBD49A5546ull),X(0xDBEE585FDDull),X(0xDC080DEFD3ull),X(0xDC21BB0429ull),X(0xDC3B5F9BE2ull),X(0xDC54FBB601ull), \
+	X(0xDC6E8F5189ull),X(0xDC881A6D7Eull),X(0xDCA19D08E3ull),X(0xDCBB1722BEull),X(0xDCD488BA12ull),X(0xDCEDF1CDE4ull),X(0xDD07525D39ull),X(0xDD20AA6718ull), \
+	X(0xDD39F9EA85ull),X(0xDD5340E687ull),X(0xDD6C7F5A26ull),X(0xDD85B54466ull),X(0xDD9EE2A450ull),X(0xDDB80778ECull),X(0xDDD123C140ull),X(0xDDEA377C56ull), \
+	X(0xDE0342A935ull),X(0xDE1C4546E7ull),X(0xDE353F5474ull),X(0xDE4E30D0E6ull),X(0xDE6719BB48ull),X(0xDE7FFA12A2ull),X(0xDE98D1D600ull),X(0xDEB1A1046Dull), \
+	X(0xDECA679CF3ull),X(0xDEE3259E9Eull),X(0xDEFBDB087Aull),X(0xDF1487D993ull),X(0xDF2D2C10F5ull),X(0xDF45C7ADAEull),X(0xDF5E5AAECAull),X(0xDF76E51356ull), \
+	X(0xDF8F66DA62ull),X(0xDFA7E002FAull),X(0xDFC0508C2Dull),X(0xDFD8B8750Aull),X(0xDFF117BCA0ull),X(0xE0096E61FFull),X(0xE021BC6436ull),X(0xE03A01C256ull), \
+	X(0xE0523E7B6Full),X(0xE06A728E91ull),X(0xE0829DFACEull),X(0xE09AC0BF38ull),X(0xE0B2DADADFull),X(0xE0CAEC4CD7ull),X(0xE0E2F51431ull),X(0xE0FAF53001ull), \
+	X(0xE112EC9F5Aull),X(0xE12ADB614Eull),X(0xE142C174F2ull),X(0xE15A9ED95Bull),X(0xE172738D9Bull),X(0xE18A3F90C9ull),X(0xE1A202E1FAull),X(0xE1B9BD8042ull), \
+	X(0xE1D16F6AB7ull),X(0xE1E918A071ull),X(0xE200B92085ull),X(0xE21850EA09ull),X(0xE22FDFFC16ull),X(0xE2476655C3ull),X(0xE25EE3F627ull),X(0xE27658DC5Bull), \
+	X(0xE28DC50777ull),X(0xE2A5287694ull),X(0xE2BC8328CCull),X(0xE2D3D51D36ull),X(0xE2EB1E52EFull),X(0xE3025EC90Full),X(0xE319967EB1ull),X(0xE330C572F0ull), \
+	X(0xE347EBA4E8ull),X(0xE35F0913B3ull),X(0xE3761DBE6Eull),X(0xE38D29A434ull),X(0xE3A42CC423ull),X(0xE3BB271D57ull),X(0xE3D218AEEEull),X(0xE3E9017805ull), \
+	X(0xE3FFE177B9ull),X(0xE416B8AD2Aull),X(0xE42D871775ull),X(0xE4444CB5BAull),X(0xE45B098718ull),X(0xE471BD8AAFull),X(0xE48868BF9Eull),X(0xE49F0B2505ull), \
+	X(0xE4B5A4BA06ull),X(0xE4CC357DC0ull),X(0xE4E2BD6F57ull),X(0xE4F93C8DEAull),X(0xE50FB2D89Dull),X(0xE526204E91ull),X(0xE53C84EEE9ull),X(0xE552E0B8C8ull), \
+	X(0xE56933AB52ull),X(0xE57F7DC5A9ull),X(0xE595BF06F3ull),X(0xE5ABF76E53ull),X(0xE5C226FAEEull),X(0xE5D84DABE9ull),X(0xE5EE6B8069ull),X(0xE604807795ull), \
+	X(0xE61A8C9093ull),X(0xE6308FCA87ull),X(0xE6468A249Bull),X(0xE65C7B9DF4ull),X(0xE6726435B9ull),X(0xE68843EB14ull),X(0xE69E1ABD2Bull),X(0xE6B3E8AB28ull), \
+	X(0xE6C9ADB433ull),X(0xE6DF69D775ull),X(0xE6F51D1418ull),X(0xE70AC76945ull),X(0xE72068D627ull),X(0xE7360159E8ull),X(0xE74B90F3B3ull),X(0xE76117A2B4ull), \
+	X(0xE776956615ull),X(0xE78C0A3D03ull),X(0xE7A17626ABull),X(0xE7B6D92237ull),X(0xE7CC332ED6ull),X(0xE7E1844BB5ull),X(0xE7F6CC7801ull),X(0xE80C0BB2E9ull), \
+	X(0xE82141FB9Aull),X(0xE8366F5143ull),X(0xE84B93B314ull),X(0xE860AF203Bull),X(0xE875C197E9ull),X(0xE88ACB194Cull),X(0xE89FCBA397ull),X(0xE8B4C335F8ull), \
+	X(0xE8C9B1CFA2ull),X(0xE8DE976FC6ull),X(0xE8F3741596ull),X(0xE90847C043ull),X(0xE91D126F01ull),X(0xE931D42101ull),X(0xE9468CD577ull),X(0xE95B3C8B97ull), \
+	X(0xE96FE34295ull),X(0xE98480F9A4ull),X(0xE99915AFF9ull),X(0xE9ADA164C9ull),X(0xE9C2241749ull),X(0xE9D69DC6AFull),X(0xE9EB0E7231ull),X(0xE9FF761904ull), \
+	X(0xEA13D4BA60ull),X(0xEA282A557Cull),X(0xEA3C76E98Full),X(0xEA50BA75D0ull),X(0xEA64F4F977ull),X(0xEA792673BEull),X(0xEA8D4EE3DCull),X(0xEAA16E490Aull), \
+	X(0xEAB584A283ull),X(0xEAC991EF7Full),X(0xEADD962F39ull),X(0xEAF19160EBull),X(0xEB058383D1ull),X(0xEB196C9724ull),X(0xEB2D4C9A22ull),X(0xEB41238C04ull), \
+	X(0xEB54F16C09ull),X(0xEB68B6396Cull),X(0xEB7C71F36Aull),X(0xEB90249940ull),X(0xEBA3CE2A2Dull),X(0xEBB76EA56Dull),X(0xEBCB060A40ull),X(0xEBDE9457E3ull), \
+	X(0xEBF2198D96ull),X(0xEC0595AA99ull),X(0xEC1908AE2Aull),X(0xEC2C72978Bull),X(0xEC3FD365FAull),X(0xEC532B18BAull),X(0xEC6679AF0Bull),X(0xEC79BF282Full), \
+	X(0xEC8CFB8367ull),X(0xECA02EBFF5ull),X(0xECB358DD1Dull),X(0xECC679DA20ull),X(0xECD991B643ull),X(0xECECA070C8ull),X(0xECFFA608F4ull),X(0xED12A27E0Bull), \
+	X(0xED2595CF51ull),X(0xED387FFC0Cull),X(0xED4B610380ull),X(0xED5E38E4F4ull),X(0xED71079FAEull),X(0xED83CD32F3ull),X(0xED96899E0Bull),X(0xEDA93CE03Cull), \
+	X(0xEDBBE6F8CEull),X(0xEDCE87E70Aull),X(0xEDE11FAA36ull),X(0xEDF3AE419Cull),X(0xEE0633AC84ull),X(0xEE18AFEA38ull),X(0xEE2B22FA01ull),X(0xEE3D8CDB29ull), \
+	X(0xEE4FED8CFAull),X(0xEE62450EBFull),X(0xEE74935FC3ull),X(0xEE86D87F51ull),X(0xEE99146CB6ull),X(0xEEAB47273Cull),X(0xEEBD70AE30ull),X(0xEECF9100E0ull), \
+	X(0xEEE1A81E97ull),X(0xEEF3B606A5ull),X(0xEF05BAB855ull),X(0xEF17B632F8ull),X(0xEF29A875DAull),X(0xEF3B91804Cull),X(0xEF4D71519Bull),X(0xEF5F47E919ull), \
+	X(0xEF71154614ull),X(0xEF82D967DEull),X(0xEF94944DC6ull),X(0xEFA645F71Dull),X(0xEFB7EE6336ull),X(0xEFC98D9162ull),X(0xEFDB2380F3ull),X(0xEFECB0313Bull), \
+	X(0xEFFE33A18Dull),X(0xF00FADD13Cull),X(0xF0211EBF9Dull),X(0xF032866C01ull),X(0xF043E4D5BFull),X(0xF05539FC2Aull),X(0xF06685DE98ull),X(0xF077C87C5Dull), \
+	X(0xF08901D4D0ull),X(0xF09A31E746ull),X(0xF0AB58B315ull),X(0xF0BC763795ull),X(0xF0CD8A741Dull),X(0xF0DE956803ull),X(0xF0EF9712A0ull),X(0xF1008F734Cull), \
+	X(0xF1117E8960ull),X(0xF122645434ull),X(0xF13340D321ull),X(0xF144140581ull),X(0xF154DDEAAEull),X(0xF1659E8203ull),X(0xF17655CAD9ull),X(0xF18703C48Dull), \
+	X(0xF197A86E79ull),X(0xF1A843C7F9ull),X(0xF1B8D5D069ull),X(0xF1C95E8726ull),X(0xF1D9DDEB8Cull),X(0xF1EA53FCF9ull),X(0xF1FAC0BACAull),X(0xF20B24245Eull), \
+	X(0xF21B7E3911ull),X(0xF22BCEF844ull),X(0xF23C166154ull),X(0xF24C5473A2ull),X(0xF25C892E8Dull),X(0xF26CB49175ull),X(0xF27CD69BBAull),X(0xF28CEF4CBDull), \
+	X(0xF29CFEA3E0ull),X(0xF2AD04A083ull),X(0xF2BD01420Aull),X(0xF2CCF487D5ull),X(0xF2DCDE7147ull),X(0xF2ECBEFDC4ull),X(0xF2FC962CAFull),X(0xF30C63FD6Bull), \
+	X(0xF31C286F5Cull),X(0xF32BE381E7ull),X(0xF33B953471ull),X(0xF34B3D865Eull),X(0xF35ADC7715ull),X(0xF36A7205FAull),X(0xF379FE3275ull),X(0xF38980FBEBull), \
+	X(0xF398FA61C3ull),X(0xF3A86A6366ull),X(0xF3B7D1003Aull),X(0xF3C72E37A7ull),X(0xF3D6820917ull),X(0xF3E5CC73F1ull),X(0xF3F50D779Eull),X(0xF404451389ull), \
+	X(0xF41373471Aull),X(0xF4229811BDull),X(0xF431B372DBull),X(0xF440C569E0ull),X(0xF44FCDF637ull),X(0xF45ECD174Bull),X(0xF46DC2CC88ull),X(0xF47CAF155Cull), \
+	X(0xF48B91F131ull),X(0xF49A6B5F76ull),X(0xF4A93B5F99ull),X(0xF4B801F106ull),X(0xF4C6BF132Cull),X(0xF4D572C579ull),X(0xF4E41D075Dull),X(0xF4F2BDD847ull), \
+	X(0xF5015537A6ull),X(0xF50FE324EAull),X(0xF51E679F84ull),X(0xF52CE2A6E4ull),X(0xF53B543A7Cull),X(0xF549BC59BDull),X(0xF5581B0418ull),X(0xF566703900ull), \
+	X(0xF574BBF7E8ull),X(0xF582FE4042ull),X(0xF591371181ull),X(0xF59F666B1Aull),X(0xF5AD8C4C80ull),X(0xF5BBA8B527ull),X(0xF5C9BBA485ull),X(0xF5D7C51A0Eull), \
+	X(0xF5E5C51538ull),X(0xF5F3BB9579ull),X(0xF601A89A47ull),X(0xF60F8C2318ull),X(0xF61D662F64ull),X(0xF62B36BEA1ull),X(0xF638FDD048ull),X(0xF646BB63CFull), \
+	X(0xF6546F78B1ull),X(0xF6621A0E65ull),X(0xF66FBB2465ull),X(0xF67D52BA2Aull),X(0xF68AE0CF2Dull),X(0xF6986562EAull),X(0xF6A5E074DBull),X(0xF6B352047Aull), \
+	X(0xF6C0BA1143ull),X(0xF6CE189AB2ull),X(0xF6DB6DA043ull),X(0xF6E8B92172ull),X(0xF6F5FB1DBCull),X(0xF70333949Eull),X(0xF710628595ull),X(0xF71D87F020ull), \
+	X(0xF72AA3D3BDull),X(0xF737B62FEAull),X(0xF744BF0426ull),X(0xF751BE4FF2ull),X(0xF75EB412CBull),X(0xF76BA04C33ull),X(0xF77882FBAAull),X(0xF7855C20B1ull), \
+	X(0xF7922BBAC9ull),X(0xF79EF1C974ull),X(0xF7ABAE4C33ull),X(0xF7B8614288ull),X(0xF7C50AABF8ull),X(0xF7D1AA8803ull),X(0xF7DE40D62Full),X(0xF7EACD95FEull), \
+	X(0xF7F750C6F5ull),X(0xF803CA6898ull),X(0xF8103A7A6Dull),X(0xF81CA0FBF8ull),X(0xF828FDECBEull),X(0xF835514C47ull),X(0xF8419B1A19ull),X(0xF84DDB55B9ull), \
+	X(0xF85A11FEB0ull),X(0xF8663F1484ull),X(0xF8726296BDull),X(0xF87E7C84E5ull),X(0xF88A8CDE82ull),X(0xF89693A31Full),X(0xF8A290D244ull),X(0xF8AE846B7Bull), \
+	X(0xF8BA6E6E4Eull),X(0xF8C64EDA48ull),X(0xF8D225AEF4ull),X(0xF8DDF2EBDCull),X(0xF8E9B6908Bull),X(0xF8F5709C8Full),X(0xF901210F73ull),X(0xF90CC7E8C4ull), \
+	X(0xF91865280Full),X(0xF923F8CCE1ull),X(0xF92F82D6C7ull),X(0xF93B034551ull),X(0xF9467A180Dull),X(0xF951E74E88ull),X(0xF95D4AE854ull),X(0xF968A4E4FEull), \
+	X(0xF973F54418ull),X(0xF97F3C0531ull),X(0xF98A7927DBull),X(0xF995ACABA6ull),X(0xF9A0D69023ull),X(0xF9ABF6D4E5ull),X(0xF9B70D797Eull),X(0xF9C21A7D80ull), \
+	X(0xF9CD1DE07Full),X(0xF9D817A20Dull),X(0xF9E307C1BEull),X(0xF9EDEE3F26ull),X(0xF9F8CB19DAull),X(0xFA039E516Full),X(0xFA0E67E579ull),X(0xFA1927D58Eull), \
+	X(0xFA23DE2145ull),X(0xFA2E8AC833ull),X(0xFA392DC9EEull),X(0xFA43C7260Full),X(0xFA4E56DC2Dull),X(0xFA58DCEBDEull),X(0xFA635954BCull),X(0xFA6DCC165Eull), \
+	X(0xFA7835305Eull),X(0xFA8294A256ull),X(0xFA8CEA6BDDull),X(0xFA97368C90ull),X(0xFAA1790407ull),X(0xFAABB1D1DEull),X(0xFAB5E0F5AFull),X(0xFAC0066F17ull), \
+	X(0xFACA223DB2ull),X(0xFAD434611Aull),X(0xFADE3CD8EDull),X(0xFAE83BA4C9ull),X(0xFAF230C44Aull),X(0xFAFC1C370Dull),X(0xFB05FDFCB2ull),X(0xFB0FD614D7ull), \
+	X(0xFB19A47F1Aull),X(0xFB23693B1Aull),X(0xFB2D244878ull),X(0xFB36D5A6D3ull),X(0xFB407D55CBull),X(0xFB4A1B5502ull),X(0xFB53AFA418ull),X(0xFB5D3A42AFull), \
+	X(0xFB66BB3069ull),X(0xFB70326CE7ull),X(0xFB799FF7CDull),X(0xFB8303D0BDull),X(0xFB8C5DF75Aull),X(0xFB95AE6B49ull),X(0xFB9EF52C2Eull),X(0xFBA83239ACull), \
+	X(0xFBB1659369ull),X(0xFBBA8F390Aull),X(0xFBC3AF2A35ull),X(0xFBCCC5668Eull),X(0xFBD5D1EDBEull),X(0xFBDED4BF6Aull),X(0xFBE7CDDB39ull),X(0xFBF0BD40D4ull), \
+	X(0xFBF9A2EFE1ull),X(0xFC027EE809ull),X(0xFC0B5128F4ull),X(0xFC1419B24Cull),X(0xFC1CD883BAull),X(0xFC258D9CE7ull),X(0xFC2E38FD7Dull),X(0xFC36DAA528ull), \
+	X(0xFC3F729391ull),X(0xFC4800C864ull),X(0xFC5085434Dull),X(0xFC590003F7ull),X(0xFC61710A0Eull),X(0xFC69D85540ull),X(0xFC7235E53Aull),X(0xFC7A89B9A8ull), \
+	X(0xFC82D3D239ull),X(0xFC8B142E9Bull),X(0xFC934ACE7Dull),X(0xFC9B77B18Dull),X(0xFCA39AD77Aull),X(0xFCABB43FF5ull),X(0xFCB3C3EAAEull),X(0xFCBBC9D754ull), \
+	X(0xFCC3C60599ull),X(0xFCCBB8752Eull),X(0xFCD3A125C5ull),X(0xFCDB80170Full),X(0xFCE35548BEull),X(0xFCEB20BA86ull),X(0xFCF2E26C1Aull),X(0xFCFA9A5D2Cull), \
+	X(0xFD02488D71ull),X(0xFD09ECFC9Dull),X(0xFD1187AA65ull),X(0xFD1918967Dull),X(0xFD209FC09Bull),X(0xFD281D2875ull),X(0xFD2F90CDC0ull),X(0xFD36FAB033ull), \
+	X(0xFD3E5ACF85ull),X(0xFD45B12B6Dull),X(0xFD4CFDC3A3ull),X(0xFD544097DEull),X(0xFD5B79A7D7ull),X(0xFD62A8F347ull),X(0xFD69CE79E7ull),X(0xFD70EA3B70ull), \
+	X(0xFD77FC379Cull),X(0xFD7F046E25ull),X(0xFD8602DEC7ull),X(0xFD8CF7893Bull),X(0xFD93E26D3Dull),X(0xFD9AC38A89ull),X(0xFDA19AE0DBull),X(0xFDA8686FF0ull), \
+	X(0xFDAF2C3784ull),X(0xFDB5E63755ull),X(0xFDBC966F20ull),X(0xFDC33CDEA3ull),X(0xFDC9D9859Dull),X(0xFDD06C63CCull),X(0xFDD6F578EFull),X(0xFDDD74C4C6ull), \
+	X(0xFDE3EA4712ull),X(0xFDEA55FF91ull),X(0xFDF0B7EE05ull),X(0xFDF710122Full),X(0xFDFD5E6BCFull),X(0xFE03A2FAA9ull),X(0xFE09DDBE7Dull),X(0xFE100EB710ull), \
+	X(0xFE1635E422ull),X(0xFE1C534578ull),X(0xFE2266DAD6ull),X(0xFE2870A3FEull),X(0xFE2E70A0B7ull),X(0xFE3466D0C4ull),X(0xFE3A5333EBull),X(0xFE4035C9F1ull), \
+	X(0xFE460E929Cull),X(0xFE4BDD8DB2ull),X(0xFE51A2BAFBull),X(0xFE575E1A3Dull),X(0xFE5D0FAB3Full),X(0xFE62B76DCAull),X(0xFE685561A6ull),X(0xFE6DE9869Aull), \
+	X(0xFE7373DC71ull),X(0xFE78F462F3ull),X(0xFE7E6B19EAull),X(0xFE83D80120ull),X(0xFE893B1860ull),X(0xFE8E945F75ull),X(0xFE93E3D629ull),X(0xFE99297C48ull), \
+	X(0xFE9E65519Full),X(0xFEA39755F9ull),X(0xFEA8BF8923ull),X(0xFEADDDEAEBull),X(0xFEB2F27B1Eull),X(0xFEB7FD3989ull),X(0xFEBCFE25FCull),X(0xFEC1F54044ull), \
+	X(0xFEC6E28830ull),X(0xFECBC5FD91ull),X(0xFED09FA035ull),X(0xFED56F6FEDull),X(0xFEDA356C8Aull),X(0xFEDEF195DCull),X(0xFEE3A3EBB4ull),X(0xFEE84C6DE4ull), \
+	X(0xFEECEB1C3Full),X(0xFEF17FF696ull),X(0xFEF60AFCBCull),X(0xFEFA8C2E86ull),X(0xFEFF038BC5ull),X(0xFF0371144Eull),X(0xFF07D4C7F5ull),X(0xFF0C2EA68Full), \
+	X(0xFF107EAFF2ull),X(0xFF14C4E3F2ull),X(0xFF19014265ull),X(0xFF1D33CB21ull),X(0xFF215C7DFEull),X(0xFF257B5AD2ull),X(0xFF29906174ull),X(0xFF2D9B91BCull), \
+	X(0xFF319CEB82ull),X(0xFF35946E9Eull),X(0xFF39821AEAull),X(0xFF3D65F03Full),X(0xFF413FEE76ull),X(0xFF4510156Aull),X(0xFF48D664F4ull),X(0xFF4C92DCEFull), \
+	X(0xFF50457D37ull),X(0xFF53EE45A7ull),X(0xFF578D361Bull),X(0xFF5B224E6Full),X(0xFF5EAD8E7Full),X(0xFF622EF62Aull),X(0xFF65A6854Cull),X(0xFF69143BC2ull), \
+	X(0xFF6C78196Cull),X(0xFF6FD21E28ull),X(0xFF732249D4ull),X(0xFF76689C51ull),X(0xFF79A5157Cull),X(0xFF7CD7B538ull),X(0xFF80007B64ull),X(0xFF831F67E0ull), \
+	X(0xFF86347A8Full),X(0xFF893FB351ull),X(0xFF8C411209ull),X(0xFF8F389699ull),X(0xFF922640E4ull),X(0xFF950A10CDull),X(0xFF97E40636ull),X(0xFF9AB42105ull), \
+	X(0xFF9D7A611Eull),X(0xFFA036C664ull),X(0xFFA2E950BEull),X(0xFFA5920010ull),X(0xFFA830D440ull),X(0xFFAAC5CD34ull),X(0xFFAD50EAD3ull),X(0xFFAFD22D04ull), \
+	X(0xFFB24993ADull),X(0xFFB4B71EB8ull),X(0xFFB71ACE0Bull),X(0xFFB974A18Full),X(0xFFBBC4992Dull),X(0xFFBE0AB4CEull),X(0xFFC046F45Cull),X(0xFFC27957C0ull), \
+	X(0xFFC4A1DEE5ull),X(0xFFC6C089B6ull),X(0xFFC8D5581Dull),X(0xFFCAE04A06ull),X(0xFFCCE15F5Eull),X(0xFFCED8980Full),X(0xFFD0C5F408ull),X(0xFFD2A97334ull), \
+	X(0xFFD4831581ull),X(0xFFD652DADDull),X(0xFFD818C336ull),X(0xFFD9D4CE7Aull),X(0xFFDB86FC99ull),X(0xFFDD2F4D81ull),X(0xFFDECDC123ull),X(0xFFE062576Eull), \
+	X(0xFFE1ED1053ull),X(0xFFE36DEBC2ull),X(0xFFE4E4E9ACull),X(0xFFE6520A04ull),X(0xFFE7B54CBBull),X(0xFFE90EB1C4ull),X(0xFFEA5E3910ull),X(0xFFEBA3E293ull), \
+	X(0xFFECDFAE42ull),X(0xFFEE119C0Eull),X(0xFFEF39ABEDull),X(0xFFF057DDD3ull),X(0xFFF16C31B6ull),X(0xFFF276A78Aull),X(0xFFF3773F45ull),X(0xFFF46DF8DEull), \
+	X(0xFFF55AD44Aull),X(0xFFF63DD181ull),X(0xFFF716F07Aull),X(0xFFF7E6312Dull),X(0xFFF8AB9391ull),X(0xFFF967179Full),X(0xFFFA18BD50ull),X(0xFFFAC0849Dull), \
+	X(0xFFFB5E6D80ull),X(0xFFFBF277F1ull),X(0xFFFC7CA3ECull),X(0xFFFCFCF16Cull),X(0xFFFD73606Bull),X(0xFFFDDFF0E5ull),X(0xFFFE42A2D5ull),X(0xFFFE9B7638ull), \
 	X(0xFFFEEA6B0Bull),X(0xFFFF2F814Aull),X(0xFFFF6AB8F2ull),X(0xFFFF9C1202ull),X(0xFFFFC38C78ull),X(0xFFFFE12851ull),X(0xFFFFF4E58Dull),X(0xFFFFFEC42Cull),
-	X(0x000C90FDA8ull),X(0x0025B2F8DBull),X(0x003ED4F3B1ull),X(0x0057F6EDEBull),X(0x007118E74Dull),X(0x008A3ADF97ull),X(0x00A35CD68Dull),X(0x00BC7ECBEFull),
-	X(0x00D5A0BF81ull),X(0x00EEC2B103ull),X(0x0107E4A038ull),X(0x0121068CE2ull),X(0x013A2876C2ull),X(0x01534A5D9Cull),X(0x016C6C4131ull),X(0x01858E2142ull),
-	X(0x019EAFFD92ull),X(0x01B7D1D5E3ull),X(0x01D0F3A9F7ull),X(0x01EA15798Full),X(0x020337446Eull),X(0x021C590A56ull),X(0x02357ACB09ull),X(0x024E9C8648ull),
-	X(0x0267BE3BD7ull),X(0x0280DFEB76ull),X(0x029A0194E7ull),X(0x02B32337EDull),X(0x02CC44D44Aull),X(0x02E56669C0ull),X(0x02FE87F810ull),X(0x0317A97EFDull),
-	X(0x0330CAFE49ull),X(0x0349EC75B5ull),X(0x03630DE504ull),X(0x037C2F4BF8ull),X(0x039550AA52ull),X(0x03AE71FFD5ull),X(0x03C7934C42ull),X(0x03E0B48F5Cull),
-	X(0x03F9D5C8E5ull),X(0x0412F6F89Eull),X(0x042C181E4Aull),X(0x04453939AAull),X(0x045E5A4A81ull),X(0x04777B5091ull),X(0x04909C4B9Bull),X(0x04A9BD3B62ull),
-	X(0x04C2DE1FA7ull),X(0x04DBFEF82Dull),X(0x04F51FC4B5ull),X(0x050E408502ull),X(0x05276138D5ull),X(0x054081DFF1ull),X(0x0559A27A18ull),X(0x0572C3070Bull),
-	X(0x058BE3868Dull),X(0x05A503F85Full),X(0x05BE245C44ull),X(0x05D744B1FEull),X(0x05F064F94Eull),X(0x06098531F6ull),X(0x0622A55BB9ull),X(0x063BC57659ull),
-	X(0x0654E58197ull),X(0x066E057D36ull),X(0x06872568F8ull),X(0x06A045449Eull),X(0x06B9650FEBull),X(0x06D284CAA0ull),X(0x06EBA47480ull),X(0x0704C40D4Dull),
-	X(0x071DE394C8ull),X(0x0737030AB4ull),X(0x0750226ED3ull),X(0x076941C0E7ull),X(0x07826100B1ull),X(0x079B802DF4ull),X(0x07B49F4871ull),X(0x07CDBE4FEBull),
-	X(0x07E6DD4424ull),X(0x07FFFC24DEull),X(0x08191AF1DBull),X(0x083239AADCull),X(0x084B584FA5ull),X(0x086476DFF6ull),X(0x087D955B92ull),X(0x0896B3C23Bull),
-	X(0x08AFD213B3ull),X(0x08C8F04FBCull),X(0x08E20E7617ull),X(0x08FB2C8688ull),X(0x09144A80D0ull),X(0x092D6864B1ull),X(0x09468631EDull),X(0x095FA3E846ull),
-	X(0x0978C1877Eull),X(0x0991DF0F57ull),X(0x09AAFC7F93ull),X(0x09C419D7F5ull),X(0x09DD37183Eull),X(0x09F6544030ull),X(0x0A0F714F8Eull),X(0x0A288E4619ull),
-	X(0x0A41AB2393ull),X(0x0A5AC7E7BFull),X(0x0A73E4925Eull),X(0x0A8D012332ull),X(0x0AA61D99FEull),X(0x0ABF39F684ull),X(0x0AD8563886ull),X(0x0AF1725FC5ull),
-	X(0x0B0A8E6C03ull),X(0x0B23AA5D04ull),X(0x0B3CC63288ull),X(0x0B55E1EC52ull),X(0x0B6EFD8A24ull),X(0x0B88190BC0ull),X(0x0BA13470E8ull),X(0x0BBA4FB95Eull),
-	X(0x0BD36AE4E4ull),X(0x0BEC85F33Dull),X(0x0C05A0E429ull),X(0x0C1EBBB76Cull),X(0x0C37D66CC7ull),X(0x0C50F103FCull),X(0x0C6A0B7CCEull),X(0x0C8325D6FEull),
-	X(0x0C9C40124Full),X(0x0CB55A2E83ull),X(0x0CCE742B5Bull),X(0x0CE78E089Aull),X(0x0D00A7C601ull),X(0x0D19C16354ull),X(0x0D32DAE053ull),X(0x0D4BF43CC2ull),
-	X(0x0D650D7861ull),X(0x0D7E2692F4ull),X(0x0D973F8C3Cull),X(0x0DB05863FBull),X(0x0DC97119F4ull),X(0x0DE289ADE8ull),X(0x0DFBA21F9Aull),X(0x0E14BA6ECBull),
-	X(0x0E2DD29B3Eull),X(0x0E46EAA4B4ull),X(0x0E60028AF1ull),X(0x0E791A4DB5ull),X(0x0E9231ECC4ull),X(0x0EAB4967DFull),X(0x0EC460BEC7ull),X(0x0EDD77F140ull),
-	X(0x0EF68EFF0Cull),X(0x0F0FA5E7ECull),X(0x0F28BCABA2ull),X(0x0F41D349F2ull),X(0x0F5AE9C29Cull),X(0x0F74001562ull),X(0x0F8D164208ull),X(0x0FA62C484Full),
-	X(0x0FBF4227F9ull),X(0x0FD857E0C8ull),X(0x0FF16D727Full),X(0x100A82DCDFull),X(0x1023981FABull),X(0x103CAD3AA4ull),X(0x1055C22D8Eull),X(0x106ED6F829ull),
-	X(0x1087EB9A38ull),X(0x10A100137Dull),X(0x10BA1463BBull),X(0x10D3288AB3ull),X(0x10EC3C8827ull),X(0x1105505BDBull),X(0x111E64058Full),X(0x1137778505ull),
-	X(0x11508ADA01ull),X(0x11699E0444ull),X(0x1182B10390ull),X(0x119BC3D7A8ull),X(0x11B4D6804Dull),X(0x11CDE8FD42ull),X(0x11E6FB4E49ull),X(0x12000D7323ull),
-	X(0x12191F6B94ull),X(0x123231375Dull),X(0x124B42D640ull),X(0x1264544800ull),X(0x127D658C5Eull),X(0x129676A31Eull),X(0x12AF878C00ull),X(0x12C89846C7ull),
-	X(0x12E1A8D336ull),X(0x12FAB9310Eull),X(0x1313C96012ull),X(0x132CD96003ull),X(0x1345E930A4ull),X(0x135EF8D1B8ull),X(0x13780842FFull),X(0x139117843Dull),
-	X(0x13AA269534ull),X(0x13C33575A5ull),X(0x13DC442553ull),X(0x13F552A400ull),X(0x140E60F16Full),X(0x14276F0D61ull),X(0x14407CF798ull),X(0x14598AAFD7ull),
-	X(0x14729835E1ull),X(0x148BA58976ull),X(0x14A4B2AA5Aull),X(0x14BDBF984Eull),X(0x14D6CC5315ull),X(0x14EFD8DA71ull),X(0x1508E52E24ull),X(0x1521F14DF0ull),
-	X(0x153AFD3998ull),X(0x155408F0DEull),X(0x156D147383ull),X(0x15861FC14Bull),X(0x159F2AD9F7ull),X(0x15B835BD49ull),X(0x15D1406B04ull),X(0x15EA4AE2EAull),
-	X(0x16035524BEull),X(0x161C5F3040ull),X(0x1635690534ull),X(0x164E72A35Cull),X(0x16677C0A7Aull),X(0x1680853A51ull),X(0x16998E32A1ull),X(0x16B296F32Full),
-	X(0x16CB9F7BBBull),X(0x16E4A7CC09ull),X(0x16FDAFE3DAull),X(0x1716B7C2F1ull),X(0x172FBF690Full),X(0x1748C6D5F8ull),X(0x1761CE096Dull),X(0x177AD50331ull),
-	X(0x1793DBC305ull),X(0x17ACE248ADull),X(0x17C5E893EAull),X(0x17DEEEA47Full),X(0x17F7F47A2Dull),X(0x1810FA14B8ull),X(0x1829FF73E1ull),X(0x184304976Bull),
-	X(0x185C097F18ull),X(0x18750E2AA9ull),X(0x188E1299E3ull),X(0x18A716CC86ull),X(0x18C01AC255ull),X(0x18D91E7B12ull),X(0x18F221F680ull),X(0x190B253461ull),
-	X(0x1924283477ull),X(0x193D2AF684ull),X(0x19562D7A4Bull),X(0x196F2FBF8Eull),X(0x198831C610ull),X(0x19A1338D92ull),X(0x19BA3515D6ull),X(0x19D3365EA0ull),
-	X(0x19EC3767B2ull),X(0x1A053830CDull),X(0x1A1E38B9B5ull),X(0x1A3739022Aull),X(0x1A503909F1ull),X(0x1A6938D0CAull),X(0x1A82385679ull),X(0x1A9B379AC0ull),
-	X(0x1AB4369D61ull),X(0x1ACD355E1Dull),X(0x1AE633DCB9ull),X(0x1AFF3218F5ull),X(0x1B18301295ull),X(0x1B312DC95Bull),X(0x1B4A2B3D08ull),X(0x1B63286D60ull),
-	X(0x1B7C255A24ull),X(0x1B95220318ull),X(0x1BAE1E67FDull),X(0x1BC71A8895ull),X(0x1BE01664A4ull),X(0x1BF911FBEBull),X(0x1C120D4E2Cull),X(0x1C2B085B2Bull),
-	X(0x1C440322AAull),X(0x1C5CFDA46Aull),X(0x1C75F7E02Eull),X(0x1C8EF1D5B9ull),X(0x1CA7EB84CDull),X(0x1CC0E4ED2Cull),X(0x1CD9DE0E99ull),X(0x1CF2D6E8D7ull),
-	X(0x1D0BCF7BA6ull),X(0x1D24C7C6CBull),X(0x1D3DBFCA07ull),X(0x1D56B7851Cull),X(0x1D6FAEF7CDull),X(0x1D88A621DDull),X(0x1DA19D030Eull),X(0x1DBA939B22ull),
-	X(0x1DD389E9DCull),X(0x1DEC7FEEFEull),X(0x1E0575AA4Aull),X(0x1E1E6B1B83ull),X(0x1E3760426Bull),X(0x1E50551EC5ull),X(0x1E6949B054ull),X(0x1E823DF6D9ull),
-	X(0x1E9B31F216ull),X(0x1EB425A1D0ull),X(0x1ECD1905C7ull),X(0x1EE60C1DBEull),X(0x1EFEFEE978ull),X(0x1F17F168B8ull),X(0x1F30E39B3Full),X(0x1F49D580D0ull),
-	X(0x1F62C7192Dull),X(0x1F7BB8641Aull),X(0x1F94A96158ull),X(0x1FAD9A10AAull),X(0x1FC68A71D2ull),X(0x1FDF7A8493ull),X(0x1FF86A48B0ull),X(0x201159BDEAull),
-	X(0x202A48E404ull),X(0x204337BAC1ull),X(0x205C2641E4ull),X(0x207514792Eull),X(0x208E026062ull),X(0x20A6EFF743ull),X(0x20BFDD3D93ull),X(0x20D8CA3314ull),
-	X(0x20F1B6D78Aull),X(0x210AA32AB6ull),X(0x21238F2C5Cull),X(0x213C7ADC3Dull),X(0x2155663A1Dull),X(0x216E5145BDull),X(0x21873BFEE0ull),X(0x21A0266549ull),
-	X(0x21B91078BAull),X(0x21D1FA38F6ull),X(0x21EAE3A5BFull),X(0x2203CCBED8ull),X(0x221CB58404ull),X(0x22359DF504ull),X(0x224E86119Cull),X(0x22676DD98Eull),
-	X(0x2280554C9Cull),X(0x22993C6A8Aull),X(0x22B2233319ull),X(0x22CB09A60Cull),X(0x22E3EFC326ull),X(0x22FCD58A2Aull),X(0x2315BAFAD9ull),X(0x232EA014F7ull),
-	X(0x234784D845ull),X(0x2360694488ull),X(0x23794D5981ull),X(0x23923116F2ull),X(0x23AB147C9Full),X(0x23C3F78A49ull),X(0x23DCDA3FB5ull),X(0x23F5BC9CA3ull),
-	X(0x240E9EA0D7ull),X(0x2427804C14ull),X(0x2440619E1Cull),X(0x24594296B1ull),X(0x2472233596ull),X(0x248B037A8Eull),X(0x24A3E3655Cull),X(0x24BCC2F5C1ull),
-	X(0x24D5A22B82ull),X(0x24EE81065Full),X(0x25075F861Dull),X(0x25203DAA7Dull),X(0x25391B7342ull),X(0x2551F8E02Full),X(0x256AD5F107ull),X(0x2583B2A58Cull),
-	X(0x259C8EFD81ull),X(0x25B56AF8A8ull),X(0x25CE4696C4ull),X(0x25E721D799ull),X(0x25FFFCBAE7ull),X(0x2618D74073ull),X(0x2631B167FFull),X(0x264A8B314Dull),
-	X(0x2663649C20ull),X(0x267C3DA83Bull),X(0x2695165561ull),X(0x26ADEEA354ull),X(0x26C6C691D7ull),X(0x26DF9E20ADull),X(0x26F8754F98ull),X(0x27114C1E5Bull),
-	X(0x272A228CB9ull),X(0x2742F89A75ull),X(0x275BCE4750ull),X(0x2774A3930Full),X(0x278D787D73ull),X(0x27A64D0640ull),X(0x27BF212D37ull),X(0x27D7F4F21Dull),
-	X(0x27F0C854B3ull),X(0x28099B54BDull),X(0x28226DF1FDull),X(0x283B402C36ull),X(0x285412032Aull),X(0x286CE3769Cull),X(0x2885B48650ull),X(0x289E853208ull),
-	X(0x28B7557986ull),X(0x28D0255C8Eull),X(0x28E8F4DAE2ull),X(0x2901C3F445ull),X(0x291A92A87Aull),X(0x293360F743ull),X(0x294C2EE064ull),X(0x2964FC639Full),
-	X(0x297DC980B7ull),X(0x299696376Full),X(0x29AF628789ull),X(0x29C82E70C9ull),X(0x29E0F9F2F1ull),X(0x29F9C50DC4ull),X(0x2A128FC105ull),X(0x2A2B5A0C77ull),
-	X(0x2A4423EFDCull),X(0x2A5CED6AF8ull),X(0x2A75B67D8Dull),X(0x2A8E7F275Eull),X(0x2AA747682Dull),X(0x2AC00F3FBFull),X(0x2AD8D6ADD5ull),X(0x2AF19DB233ull),
-	X(0x2B0A644C9Bull),X(0x2B232A7CD0ull),X(0x2B3BF04295ull),X(0x2B54B59DADull),X(0x2B6D7A8DDBull),X(0x2B863F12E2ull),X(0x2B9F032C84ull),X(0x2BB7C6DA85ull),
-	X(0x2BD08A1CA7ull),X(0x2BE94CF2AEull),X(0x2C020F5C5Cull),X(0x2C1AD15974ull),X(0x2C3392E9B9ull),X(0x2C4C540CEDull),X(0x2C6514C2D5ull),X(0x2C7DD50B33ull),
-	X(0x2C9694E5C9ull),X(0x2CAF54525Bull),X(0x2CC81350ABull),X(0x2CE0D1E07Dull),X(0x2CF9900194ull),X(0x2D124DB3B2ull),X(0x2D2B0AF69Aull),X(0x2D43C7CA0Full),
-	X(0x2D5C842DD5ull),X(0x2D754021AEull),X(0x2D8DFBA55Eull),X(0x2DA6B6B8A6ull),X(0x2DBF715B4Bull),X(0x2DD82B8D0Full),X(0x2DF0E54DB5ull),X(0x2E099E9D01ull),
-	X(0x2E22577AB4ull),X(0x2E3B0FE693ull),X(0x2E53C7E05Full),X(0x2E6C7F67DDull),X(0x2E85367CCFull),X(0x2E9DED1EF8ull),X(0x2EB6A34E1Cull),X(0x2ECF5909FDull),
-	X(0x2EE80E525Eull),X(0x2F00C32702ull),X(0x2F197787ADull),X(0x2F322B7421ull),X(0x2F4ADEEC21ull),X(0x2F6391EF71ull),X(0x2F7C447DD4ull),X(0x2F94F6970Cull),
-	X(0x2FADA83ADDull),X(0x2FC6596909ull),X(0x2FDF0A2155ull),X(0x2FF7BA6382ull),X(0x30106A2F54ull),X(0x302919848Full),X(0x3041C862F4ull),X(0x305A76CA48ull),
-	X(0x307324BA4Dull),X(0x308BD232C7ull),X(0x30A47F3378ull),X(0x30BD2BBC24ull),X(0x30D5D7CC8Eull),X(0x30EE836478ull),X(0x31072E83A7ull),X(0x311FD929DDull),
-	X(0x31388356DDull),X(0x31512D0A6Bull),X(0x3169D64449ull),X(0x31827F043Cull),X(0x319B274A05ull),X(0x31B3CF1568ull),X(0x31CC766628ull),X(0x31E51D3C09ull),
-	X(0x31FDC396CEull),X(0x3216697639ull),X(0x322F0EDA0Eull),X(0x3247B3C211ull),X(0x3260582E03ull),X(0x3278FC1DAAull),X(0x32919F90C7ull),X(0x32AA42871Eull),
-	X(0x32C2E50072ull),X(0x32DB86FC86ull),X(0x32F4287B1Eull),X(0x330CC97BFDull),X(0x332569FEE6ull),X(0x333E0A039Dull),X(0x3356A989E4ull),X(0x336F48917Eull),
-	X(0x3387E71A30ull),X(0x33A08523BCull),X(0x33B922ADE5ull),X(0x33D1BFB870ull),X(0x33EA5C431Eull),X(0x3402F84DB4ull),X(0x341B93D7F4ull),X(0x34342EE1A3ull),
-	X(0x344CC96A82ull),X(0x3465637256ull),X(0x347DFCF8E2ull),X(0x349695FDE9ull),X(0x34AF2E812Eull),X(0x34C7C68275ull),X(0x34E05E0181ull),X(0x34F8F4FE15ull),
-	X(0x35118B77F5ull),X(0x352A216EE4ull),X(0x3542B6E2A6ull),X(0x355B4BD2FDull),X(0x3573E03FADull),X(0x358C742879ull),X(0x35A5078D26ull),X(0x35BD9A6D75ull),
-	X(0x35D62CC92Bull),X(0x35EEBEA00Bull),X(0x36074FF1D8ull),X(0x361FE0BE55ull),X(0x3638710547ull),X(0x365100C66Full),X(0x3669900193ull),X(0x36821EB675ull),
-	X(0x369AACE4D8ull),X(0x36B33A8C81ull),X(0x36CBC7AD32ull),X(0x36E45446AEull),X(0x36FCE058BAull),X(0x37156BE319ull),X(0x372DF6E58Eull),X(0x3746815FDCull),
-	X(0x375F0B51C8ull),X(0x377794BB14ull),X(0x37901D9B84ull),X(0x37A8A5F2DBull),X(0x37C12DC0DDull),X(0x37D9B5054Dull),X(0x37F23BBFF0ull),X(0x380AC1F087ull),
-	X(0x38234796D8ull),X(0x383BCCB2A4ull),X(0x38545143B1ull),X(0x386CD549C1ull),X(0x388558C497ull),X(0x389DDBB3F8ull),X(0x38B65E17A7ull),X(0x38CEDFEF67ull),
-	X(0x38E7613AFCull),X(0x38FFE1FA29ull),X(0x3918622CB3ull),X(0x3930E1D25Bull),X(0x394960EAE7ull),X(0x3961DF761Aull),X(0x397A5D73B7ull),X(0x3992DAE381ull),
-	X(0x39AB57C53Dull),X(0x39C3D418AEull),X(0x39DC4FDD97ull),X(0x39F4CB13BDull),X(0x3A0D45BAE2ull),X(0x3A25BFD2CAull),X(0x3A3E395B39ull),X(0x3A56B253F3ull),
-	X(0x3A6F2ABCBBull),X(0x3A87A29554ull),X(0x3AA019DD83ull),X(0x3AB890950Bull),X(0x3AD106BBB0ull),X(0x3AE97C5135ull),X(0x3B01F1555Eull),X(0x3B1A65C7EEull),
-	X(0x3B32D9A8A9ull),X(0x3B4B4CF754ull),X(0x3B63BFB3B1ull),X(0x3B7C31DD84ull),X(0x3B94A37492ull),X(0x3BAD14789Dull),X(0x3BC584E969ull),X(0x3BDDF4C6BAull),
-	X(0x3BF6641054ull),X(0x3C0ED2C5FAull),X(0x3C2740E771ull),X(0x3C3FAE747Bull),X(0x3C581B6CDDull),X(0x3C7087D05Aull),X(0x3C88F39EB7ull),X(0x3CA15ED7B6ull),
-	X(0x3CB9C97B1Cull),X(0x3CD23388ACull),X(0x3CEA9D002Aull),X(0x3D0305E15Aull),X(0x3D1B6E2BFFull),X(0x3D33D5DFDEull),X(0x3D4C3CFCBAull),X(0x3D64A38257ull),
-	X(0x3D7D097079ull),X(0x3D956EC6E3ull),X(0x3DADD3855Aull),X(0x3DC637ABA1ull),X(0x3DDE9B397Cull),X(0x3DF6FE2EAEull),X(0x3E0F608AFDull),X(0x3E27C24E2Aull),
-	X(0x3E402377FBull),X(0x3E58840834ull),X(0x3E70E3FE97ull),X(0x3E89435AE9ull),X(0x3EA1A21CEEull),X(0x3EBA004469ull),X(0x3ED25DD11Full),X(0x3EEABAC2D3ull),
-	X(0x3F0317194Aull),X(0x3F1B72D446ull),X(0x3F33CDF38Dull),X(0x3F4C2876E1ull),X(0x3F64825E08ull),X(0x3F7CDBA8C4ull),X(0x3F953456DAull),X(0x3FAD8C680Dull),
-	X(0x3FC5E3DC22ull),X(0x3FDE3AB2DDull),X(0x3FF690EC01ull),X(0x400EE68752ull),X(0x40273B8495ull),X(0x403F8FE38Cull),X(0x4057E3A3FEull),X(0x407036C5ACull),
-	X(0x408889485Cull),X(0x40A0DB2BD1ull),X(0x40B92C6FCFull),X(0x40D17D141Aull),X(0x40E9CD1876ull),X(0x41021C7CA8ull),X(0x411A6B4073ull),X(0x4132B9639Bull),
-	X(0x414B06E5E5ull),X(0x416353C713ull),X(0x417BA006ECull),X(0x4193EBA531ull),X(0x41AC36A1A8ull),X(0x41C480FC15ull),X(0x41DCCAB43Bull),X(0x41F513C9DFull),
-	X(0x420D5C3CC4ull),X(0x4225A40CB0ull),X(0x423DEB3965ull),X(0x425631C2A8ull),X(0x426E77A83Eull),X(0x4286BCE9EAull),X(0x429F018770ull),X(0x42B7458094ull),
-	X(0x42CF88D51Bull),X(0x42E7CB84C9ull),X(0x43000D8F61ull),X(0x43184EF4A9ull),X(0x43308FB464ull),X(0x4348CFCE56ull),X(0x43610F4244ull),X(0x43794E0FF1ull),
-	X(0x43918C3722ull),X(0x43A9C9B79Bull),X(0x43C2069120ull),X(0x43DA42C376ull),X(0x43F27E4E60ull),X(0x440AB931A3ull),X(0x4422F36D04ull),X(0x443B2D0045ull),
-	X(0x445365EB2Cull),X(0x446B9E2D7Cull),X(0x4483D5C6FBull),X(0x449C0CB76Bull),X(0x44B442FE93ull),X(0x44CC789C34ull),X(0x44E4AD9015ull),X(0x44FCE1D9F9ull),
-	X(0x45151579A5ull),X(0x452D486EDCull),X(0x45457AB964ull),X(0x455DAC58FFull),X(0x4575DD4D74ull),X(0x458E0D9686ull),X(0x45A63D33F8ull),X(0x45BE6C2591ull),
-	X(0x45D69A6B14ull),X(0x45EEC80444ull),X(0x4606F4F0E8ull),X(0x461F2130C2ull),X(0x46374CC398ull),X(0x464F77A92Eull),X(0x4667A1E148ull),X(0x467FCB6BAAull),
-	X(0x4697F44819ull),X(0x46B01C7659ull),X(0x46C843F62Full),X(0x46E06AC75Full),X(0x46F890E9ADull),X(0x4710B65CDEull),X(0x4728DB20B7ull),X(0x4740FF34FBull),
-	X(0x475922996Full),X(0x4771454DD8ull),X(0x47896751FAull),X(0x47A188A59Aull),X(0x47B9A9487Bull),X(0x47D1C93A63ull),X(0x47E9E87B16ull),X(0x4802070A58ull),
-	X(0x481A24E7EEull),X(0x483242139Cull),X(0x484A5E8D27ull),X(0x48627A5454ull),X(0x487A9568E6ull),X(0x4892AFCAA3ull),X(0x48AAC9794Full),X(0x48C2E274AEull),
-	X(0x48DAFABC85ull),X(0x48F3125099ull),X(0x490B2930AEull),X(0x49233F5C89ull),X(0x493B54D3EDull),X(0x49536996A1ull),X(0x496B7DA468ull),X(0x498390FD07ull),
-	X(0x499BA3A042ull),X(0x49B3B58DDFull),X(0x49CBC6C5A2ull),X(0x49E3D7474Full),X(0x49FBE712ABull),X(0x4A13F6277Aull),X(0x4A2C048582ull),X(0x4A44122C87ull),
-	X(0x4A5C1F1C4Eull),X(0x4A742B549Aull),X(0x4A8C36D532ull),X(0x4AA4419DD9ull),X(0x4ABC4BAE55ull),X(0x4AD4550669ull),X(0x4AEC5DA5DCull),X(0x4B04658C70ull),
-	X(0x4B1C6CB9ECull),X(0x4B34732E13ull),X(0x4B4C78E8ABull),X(0x4B647DE978ull),X(0x4B7C82303Eull),X(0x4B9485BCC4ull),X(0x4BAC888ECDull),X(0x4BC48AA61Eull),
-	X(0x4BDC8C027Dull),X(0x4BF48CA3ACull),X(0x4C0C8C8973ull),X(0x4C248BB395ull),X(0x4C3C8A21D6ull),X(0x4C5487D3FDull),X(0x4C6C84C9CDull),X(0x4C8481030Cull),
-	X(0x4C9C7C7F7Eull),X(0x4CB4773EE8ull),X(0x4CCC714110ull),X(0x4CE46A85B9ull),X(0x4CFC630CA8ull),X(0x4D145AD5A3ull),X(0x4D2C51E06Full),X(0x4D44482CD0ull),
-	X(0x4D5C3DBA8Bull),X(0x4D74328964ull),X(0x4D8C269922ull),X(0x4DA419E989ull),X(0x4DBC0C7A5Dull),X(0x4DD3FE4B64ull),X(0x4DEBEF5C62ull),X(0x4E03DFAD1Dull),
-	X(0x4E1BCF3D59ull),X(0x4E33BE0CDBull),X(0x4E4BAC1B69ull),X(0x4E639968C7ull),X(0x4E7B85F4BAull),X(0x4E9371BF07ull),X(0x4EAB5CC774ull),X(0x4EC3470DC4ull),
-	X(0x4EDB3091BEull),X(0x4EF3195326ull),X(0x4F0B0151C1ull),X(0x4F22E88D54ull),X(0x4F3ACF05A4ull),X(0x4F52B4BA76ull),X(0x4F6A99AB90ull),X(0x4F827DD8B5ull),
-	X(0x4F9A6141ADull),X(0x4FB243E63Aull),X(0x4FCA25C623ull),X(0x4FE206E12Cull),X(0x4FF9E7371Bull),X(0x5011C6C7B5ull),X(0x5029A592BEull),X(0x50418397FDull),
-	X(0x505960D735ull),X(0x50713D502Cull),X(0x50891902A8ull),X(0x50A0F3EE6Dull),X(0x50B8CE1340ull),X(0x50D0A770E7ull),X(0x50E8800727ull),X(0x510057D5C5ull),
-	X(0x51182EDC86ull),X(0x5130051B2Full),X(0x5147DA9185ull),X(0x515FAF3F4Full),X(0x5177832450ull),X(0x518F56404Eull),X(0x51A728930Full),X(0x51BEFA1C57ull),
-	X(0x51D6CADBECull),X(0x51EE9AD193ull),X(0x520669FD11ull),X(0x521E385E2Cull),X(0x523605F4A8ull),X(0x524DD2C04Cull),X(0x52659EC0DBull),X(0x527D69F61Dull),
-	X(0x5295345FD5ull),X(0x52ACFDFDC9ull),X(0x52C4C6CFBFull),X(0x52DC8ED57Cull),X(0x52F4560EC4ull),X(0x530C1C7B5Eull),X(0x5323E21B0Full),X(0x533BA6ED9Cull),
-	X(0x53536AF2CBull),X(0x536B2E2A60ull),X(0x5382F09422ull),X(0x539AB22FD5ull),X(0x53B272FD3Full),X(0x53CA32FC26ull),X(0x53E1F22C4Eull),X(0x53F9B08D7Dull),
-	X(0x54116E1F79ull),X(0x54292AE207ull),X(0x5440E6D4EDull),X(0x5458A1F7EFull),X(0x54705C4AD3ull),X(0x548815CD60ull),X(0x549FCE7F59ull),X(0x54B7866086ull),
-	X(0x54CF3D70AAull),X(0x54E6F3AF8Cull),X(0x54FEA91CF1ull),X(0x55165DB89Full),X(0x552E11825Bull),X(0x5545C479EBull),X(0x555D769F14ull),X(0x557527F19Cull),
-	X(0x558CD87148ull),X(0x55A4881DDEull),X(0x55BC36F723ull),X(0x55D3E4FCDDull),X(0x55EB922ED2ull),X(0x56033E8CC7ull),X(0x561AEA1681ull),X(0x563294CBC7ull),
-	X(0x564A3EAC5Eull),X(0x5661E7B80Bull),X(0x56798FEE94ull),X(0x5691374FBFull),X(0x56A8DDDB52ull),X(0x56C0839111ull),X(0x56D82870C4ull),X(0x56EFCC7A2Eull),
-	X(0x57076FAD17ull),X(0x571F120943ull),X(0x5736B38E79ull),X(0x574E543C7Dull),X(0x5765F41317ull),X(0x577D93120Bull),X(0x579531391Full),X(0x57ACCE8819ull),
-	X(0x57C46AFEBFull),X(0x57DC069CD6ull),X(0x57F3A16224ull),X(0x580B3B4E6Full),X(0x5822D4617Dull),X(0x583A6C9B14ull),X(0x585203FAF8ull),X(0x58699A80F1ull),
-	X(0x5881302CC3ull),X(0x5898C4FE35ull),X(0x58B058F50Dull),X(0x58C7EC1110ull),X(0x58DF7E5204ull),X(0x58F70FB7AEull),X(0x590EA041D6ull),X(0x59262FF040ull),
-	X(0x593DBEC2B3ull),X(0x59554CB8F4ull),X(0x596CD9D2C9ull),X(0x5984660FF9ull),X(0x599BF17049ull),X(0x59B37BF37Eull),X(0x59CB059960ull),X(0x59E28E61B3ull),
-	X(0x59FA164C3Eull),X(0x5A119D58C7ull),X(0x5A29238713ull),X(0x5A40A8D6E9ull),X(0x5A582D480Eull),X(0x5A6FB0DA49ull),X(0x5A87338D5Full),X(0x5A9EB56117ull),
-	X(0x5AB6365536ull),X(0x5ACDB66983ull),X(0x5AE5359DC4ull),X(0x5AFCB3F1BDull),X(0x5B14316537ull),X(0x5B2BADF7F6ull),X(0x5B4329A9C1ull),X(0x5B5AA47A5Dull),
-	X(0x5B721E6991ull),X(0x5B89977723ull),X(0x5BA10FA2D9ull),X(0x5BB886EC79ull),X(0x5BCFFD53C9ull),X(0x5BE772D88Full),X(0x5BFEE77A92ull),X(0x5C165B3997ull),
-	X(0x5C2DCE1565ull),X(0x5C45400DC1ull),X(0x5C5CB12273ull),X(0x5C7421533Full),X(0x5C8B909FEDull),X(0x5CA2FF0842ull),X(0x5CBA6C8C05ull),X(0x5CD1D92AFBull),
-	X(0x5CE944E4ECull),X(0x5D00AFB99Cull),X(0x5D1819A8D3ull),X(0x5D2F82B257ull),X(0x5D46EAD5EEull),X(0x5D5E52135Dull),X(0x5D75B86A6Dull),X(0x5D8D1DDAE1ull),
-	X(0x5DA4826482ull),X(0x5DBBE60715ull),X(0x5DD348C260ull),X(0x5DEAAA962Bull),X(0x5E020B823Aull),X(0x5E196B8655ull),X(0x5E30CAA241ull),X(0x5E4828D5C6ull),
-	X(0x5E5F8620A9ull),X(0x5E76E282B0ull),X(0x5E8E3DFBA3ull),X(0x5EA5988B48ull),X(0x5EBCF23164ull),X(0x5ED44AEDBEull),X(0x5EEBA2C01Dull),X(0x5F02F9A847ull),
-	X(0x5F1A4FA603ull),X(0x5F31A4B917ull),X(0x5F48F8E148ull),X(0x5F604C1E5Full),X(0x5F779E7021ull),X(0x5F8EEFD654ull),X(0x5FA64050C0ull),X(0x5FBD8FDF2Aull),
-	X(0x5FD4DE8159ull),X(0x5FEC2C3714ull),X(0x6003790021ull),X(0x601AC4DC46ull),X(0x60320FCB4Bull),X(0x604959CCF5ull),X(0x6060A2E10Bull),X(0x6077EB0755ull),
-	X(0x608F323F97ull),X(0x60A6788999ull),X(0x60BDBDE522ull),X(0x60D50251F7ull),X(0x60EC45CFE0ull),X(0x6103885EA4ull),X(0x611AC9FE08ull),X(0x61320AADD3ull),
-	X(0x61494A6DCDull),X(0x6160893DBBull),X(0x6177C71D64ull),X(0x618F040C90ull),X(0x61A6400B04ull),X(0x61BD7B1887ull),X(0x61D4B534E0ull),X(0x61EBEE5FD6ull),
-	X(0x6203269930ull),X(0x621A5DE0B3ull),X(0x6231943627ull),X(0x6248C99953ull),X(0x625FFE09FDull),X(0x62773187ECull),X(0x628E6412E6ull),X(0x62A595AAB4ull),
-	X(0x62BCC64F1Aull),X(0x62D3F5FFE1ull),X(0x62EB24BCCEull),X(0x63025285A9ull),X(0x63197F5A38ull),X(0x6330AB3A43ull),X(0x6347D62590ull),X(0x635F001BE6ull),
-	X(0x6376291D0Bull),X(0x638D5128C7ull),X(0x63A4783EE1ull),X(0x63BB9E5F1Full),X(0x63D2C38949ull),X(0x63E9E7BD24ull),X(0x64010AFA79ull),X(0x64182D410Dull),
-	X(0x642F4E90A8ull),X(0x64466EE912ull),X(0x645D8E4A10ull),X(0x6474ACB369ull),X(0x648BCA24E5ull),X(0x64A2E69E4Bull),X(0x64BA021F62ull),X(0x64D11CA7F0ull),
-	X(0x64E83637BCull),X(0x64FF4ECE8Full),X(0x6516666C2Dull),X(0x652D7D1060ull),X(0x654492BAEDull),X(0x655BA76B9Bull),X(0x6572BB2233ull),X(0x6589CDDE7Aull),
-	X(0x65A0DFA038ull),X(0x65B7F06734ull),X(0x65CF003335ull),X(0x65E60F0402ull),X(0x65FD1CD963ull),X(0x661429B31Eull),X(0x662B3590FAull),X(0x66424072BFull),
-	X(0x66594A5833ull),X(0x667053411Full),X(0x66875B2D48ull),X(0x669E621C77ull),X(0x66B5680E72ull),X(0x66CC6D0301ull),X(0x66E370F9EBull),X(0x66FA73F2F7ull),
-	X(0x671175EDEBull),X(0x672876EA91ull),X(0x673F76E8AEull),X(0x675675E80Aull),X(0x676D73E86Dull),X(0x678470E99Dull),X(0x679B6CEB61ull),X(0x67B267ED82ull),
-	X(0x67C961EFC6ull),X(0x67E05AF1F5ull),X(0x67F752F3D6ull),X(0x680E49F530ull),X(0x68253FF5CBull),X(0x683C34F56Dull),X(0x685328F3E0ull),X(0x686A1BF0E8ull),
-	X(0x68810DEC4Full),X(0x6897FEE5DCull),X(0x68AEEEDD55ull),X(0x68C5DDD283ull),X(0x68DCCBC52Cull),X(0x68F3B8B518ull),X(0x690AA4A20Full),X(0x69218F8BD8ull),
-	X(0x693879723Bull),X(0x694F6254FEull),X(0x69664A33EAull),X(0x697D310EC6ull),X(0x699416E559ull),X(0x69AAFBB76Aull),X(0x69C1DF84C3ull),X(0x69D8C24D29ull),
-	X(0x69EFA41064ull),X(0x6A0684CE3Dull),X(0x6A1D64867Aull),X(0x6A344338E3ull),X(0x6A4B20E540ull),X(0x6A61FD8B58ull),X(0x6A78D92AF2ull),X(0x6A8FB3C3D8ull),
-	X(0x6AA68D55CFull),X(0x6ABD65E0A0ull),X(0x6AD43D6412ull),X(0x6AEB13DFEDull),X(0x6B01E953F9ull),X(0x6B18BDBFFDull),X(0x6B2F9123C1ull),X(0x6B46637F0Cull),
-	X(0x6B5D34D1A7ull),X(0x6B74051B58ull),X(0x6B8AD45BE9ull),X(0x6BA1A2931Full),X(0x6BB86FC0C4ull),X(0x6BCF3BE49Full),X(0x6BE606FE77ull),X(0x6BFCD10E15ull),
-	X(0x6C139A1340ull),X(0x6C2A620DC0ull),X(0x6C4128FD5Cull),X(0x6C57EEE1DEull),X(0x6C6EB3BB0Bull),X(0x6C857788ACull),X(0x6C9C3A4A8Aull),X(0x6CB2FC006Bull),
-	X(0x6CC9BCAA18ull),X(0x6CE07C4759ull),X(0x6CF73AD7F5ull),X(0x6D0DF85BB4ull),X(0x6D24B4D25Eull),X(0x6D3B703BBCull),X(0x6D522A9794ull),X(0x6D68E3E5B0ull),
-	X(0x6D7F9C25D6ull),X(0x6D965357CFull),X(0x6DAD097B63ull),X(0x6DC3BE9059ull),X(0x6DDA72967Aull),X(0x6DF1258D8Eull),X(0x6E07D7755Cull),X(0x6E1E884DADull),
-	X(0x6E35381648ull),X(0x6E4BE6CEF7ull),X(0x6E62947780ull),X(0x6E79410FABull),X(0x6E8FEC9742ull),X(0x6EA6970E0Bull),X(0x6EBD4073D0ull),X(0x6ED3E8C857ull),
-	X(0x6EEA900B6Aull),X(0x6F01363CCFull),X(0x6F17DB5C50ull),X(0x6F2E7F69B5ull),X(0x6F452264C5ull),X(0x6F5BC44D49ull),X(0x6F72652309ull),X(0x6F8904E5CDull),
-	X(0x6F9FA3955Dull),X(0x6FB6413181ull),X(0x6FCCDDBA02ull),X(0x6FE3792EA8ull),X(0x6FFA138F3Bull),X(0x7010ACDB84ull),X(0x702745134Aull),X(0x703DDC3655ull),
-	X(0x705472446Full),X(0x706B073D5Full),X(0x70819B20EEull),X(0x70982DEEE3ull),X(0x70AEBFA708ull),X(0x70C5504924ull),X(0x70DBDFD500ull),X(0x70F26E4A65ull),
-	X(0x7108FBA919ull),X(0x711F87F0E7ull),X(0x7136132196ull),X(0x714C9D3AEEull),X(0x7163263CB8ull),X(0x7179AE26BDull),X(0x719034F8C5ull),X(0x71A6BAB297ull),
-	X(0x71BD3F53FEull),X(0x71D3C2DCC0ull),X(0x71EA454CA7ull),X(0x7200C6A37Bull),X(0x721746E104ull),X(0x722DC6050Cull),X(0x7244440F5Aull),X(0x725AC0FFB6ull),
-	X(0x72713CD5EAull),X(0x7287B791BEull),X(0x729E3132FBull),X(0x72B4A9B969ull),X(0x72CB2124D0ull),X(0x72E19774F9ull),X(0x72F80CA9ADull),X(0x730E80C2B5ull),
-	X(0x7324F3BFD8ull),X(0x733B65A0E0ull),X(0x7351D66595ull),X(0x7368460DC0ull),X(0x737EB4992Aull),X(0x739522079Aull),X(0x73AB8E58DAull),X(0x73C1F98CB3ull),
-	X(0x73D863A2ECull),X(0x73EECC9B50ull),X(0x74053475A6ull),X(0x741B9B31B7ull),X(0x743200CF4Cull),X(0x7448654E2Eull),X(0x745EC8AE25ull),X(0x74752AEEFAull),
-	X(0x748B8C1077ull),X(0x74A1EC1263ull),X(0x74B84AF487ull),X(0x74CEA8B6ADull),X(0x74E505589Dull),X(0x74FB60DA20ull),X(0x7511BB3AFFull),X(0x7528147B03ull),
-	X(0x753E6C99F4ull),X(0x7554C3979Bull),X(0x756B1973C2ull),X(0x75816E2E31ull),X(0x7597C1C6B1ull),X(0x75AE143D0Aull),X(0x75C4659107ull),X(0x75DAB5C270ull),
-	X(0x75F104D10Dull),X(0x760752BCA8ull),X(0x761D9F8509ull),X(0x7633EB29FBull),X(0x764A35AB45ull),X(0x76607F08B0ull),X(0x7676C74207ull),X(0x768D0E5711ull),
-	X(0x76A3544797ull),X(0x76B9991364ull),X(0x76CFDCBA3Full),X(0x76E61F3BF2ull),X(0x76FC609846ull),X(0x7712A0CF04ull),X(0x7728DFDFF5ull),X(0x773F1DCAE3ull),
-	X(0x77555A8F95ull),X(0x776B962DD7ull),X(0x7781D0A56Full),X(0x779809F629ull),X(0x77AE421FCDull),X(0x77C4792224ull),X(0x77DAAEFCF7ull),X(0x77F0E3B00Full),
-	X(0x7807173B37ull),X(0x781D499E36ull),X(0x78337AD8D6ull),X(0x7849AAEAE1ull),X(0x785FD9D420ull),X(0x787607945Bull),X(0x788C342B5Dull),X(0x78A25F98EEull),
-	X(0x78B889DCD8ull),X(0x78CEB2F6E4ull),X(0x78E4DAE6DCull),X(0x78FB01AC88ull),X(0x79112747B2ull),X(0x79274BB824ull),X(0x793D6EFDA7ull),X(0x7953911804ull),
-	X(0x7969B20704ull),X(0x797FD1CA72ull),X(0x7995F06215ull),X(0x79AC0DCDB9ull),X(0x79C22A0D26ull),X(0x79D8452026ull),X(0x79EE5F0682ull),X(0x7A0477C003ull),
-	X(0x7A1A8F4C74ull),X(0x7A30A5AB9Dull),X(0x7A46BADD48ull),X(0x7A5CCEE13Full),X(0x7A72E1B74Bull),X(0x7A88F35F35ull),X(0x7A9F03D8C8ull),X(0x7AB51323CDull),
-	X(0x7ACB21400Dull),X(0x7AE12E2D52ull),X(0x7AF739EB65ull),X(0x7B0D447A11ull),X(0x7B234DD91Eull),X(0x7B39560857ull),X(0x7B4F5D0784ull),X(0x7B6562D671ull),
-	X(0x7B7B6774E5ull),X(0x7B916AE2ACull),X(0x7BA76D1F8Eull),X(0x7BBD6E2B56ull),X(0x7BD36E05CDull),X(0x7BE96CAEBCull),X(0x7BFF6A25EEull),X(0x7C15666B2Dull),
-	X(0x7C2B617E41ull),X(0x7C415B5EF5ull),X(0x7C57540D13ull),X(0x7C6D4B8864ull),X(0x7C8341D0B2ull),X(0x7C9936E5C7ull),X(0x7CAF2AC76Dull),X(0x7CC51D756Dull),
-	X(0x7CDB0EEF92ull),X(0x7CF0FF35A6ull),X(0x7D06EE4771ull),X(0x7D1CDC24BFull),X(0x7D32C8CD58ull),X(0x7D48B44108ull),X(0x7D5E9E7F97ull),X(0x7D748788D0ull),
-	X(0x7D8A6F5C7Cull),X(0x7DA055FA66ull),X(0x7DB63B6258ull),X(0x7DCC1F941Bull),X(0x7DE2028F7Aull),X(0x7DF7E4543Eull),X(0x7E0DC4E231ull),X(0x7E23A4391Full),
-	X(0x7E398258CFull),X(0x7E4F5F410Eull),X(0x7E653AF1A4ull),X(0x7E7B156A5Cull),X(0x7E90EEAAFFull),X(0x7EA6C6B359ull),X(0x7EBC9D8332ull),X(0x7ED2731A56ull),
-	X(0x7EE847788Eull),X(0x7EFE1A9DA4ull),X(0x7F13EC8963ull),X(0x7F29BD3B95ull),X(0x7F3F8CB403ull),X(0x7F555AF278ull),X(0x7F6B27F6BFull),X(0x7F80F3C0A1ull),
-	X(0x7F96BE4FE9ull),X(0x7FAC87A461ull),X(0x7FC24FBDD3ull),X(0x7FD8169C09ull),X(0x7FEDDC3ECEull),X(0x8003A0A5ECull),X(0x801963D12Dull),X(0x802F25C05Cull),
-	X(0x8044E67343ull),X(0x805AA5E9ABull),X(0x8070642361ull),X(0x808621202Dull),X(0x809BDCDFDAull),X(0x80B1976234ull),X(0x80C750A703ull),X(0x80DD08AE12ull),
-	X(0x80F2BF772Dull),X(0x810875021Cull),X(0x811E294EACull),X(0x8133DC5CA5ull),X(0x81498E2BD3ull),X(0x815F3EBC00ull),X(0x8174EE0CF7ull),X(0x818A9C1E81ull),
-	X(0x81A048F06Aull),X(0x81B5F4827Dull),X(0x81CB9ED483ull),X(0x81E147E647ull),X(0x81F6EFB793ull),X(0x820C964833ull),X(0x82223B97F1ull),X(0x8237DFA697ull),
-	X(0x824D8273F0ull),X(0x826323FFC7ull),X(0x8278C449E6ull),X(0x828E635218ull),X(0x82A4011828ull),X(0x82B99D9BE0ull),X(0x82CF38DD0Aull),X(0x82E4D2DB73ull),
-	X(0x82FA6B96E3ull),X(0x8310030F27ull),X(0x8325994408ull),X(0x833B2E3552ull),X(0x8350C1E2CFull),X(0x8366544C4Aull),X(0x837BE5718Eull),X(0x8391755265ull),
-	X(0x83A703EE9Bull),X(0x83BC9145FAull),X(0x83D21D584Cull),X(0x83E7A8255Eull),X(0x83FD31ACF9ull),X(0x8412B9EEE9ull),X(0x842840EAF8ull),X(0x843DC6A0F1ull),
-	X(0x84534B10A0ull),X(0x8468CE39CEull),X(0x847E501C48ull),X(0x8493D0B7D7ull),X(0x84A9500C47ull),X(0x84BECE1964ull),X(0x84D44ADEF7ull),X(0x84E9C65CCBull),
-	X(0x84FF4092ADull),X(0x8514B98066ull),X(0x852A3125C2ull),X(0x853FA7828Cull),X(0x85551C968Full),X(0x856A906195ull),X(0x858002E36Bull),X(0x8595741BDBull),
-	X(0x85AAE40AAFull),X(0x85C052AFB5ull),X(0x85D5C00AB5ull),X(0x85EB2C1B7Cull),X(0x860096E1D5ull),X(0x8616005D8Bull),X(0x862B688E68ull),X(0x8640CF7439ull),
-	X(0x8656350EC8ull),X(0x866B995DE0ull),X(0x8680FC614Eull),X(0x86965E18DBull),X(0x86ABBE8454ull),X(0x86C11DA383ull),X(0x86D67B7634ull),X(0x86EBD7FC32ull),
-	X(0x8701333549ull),X(0x87168D2143ull),X(0x872BE5BFECull),X(0x87413D110Full),X(0x8756931478ull),X(0x876BE7C9F2ull),X(0x87813B3148ull),X(0x87968D4A46ull),
-	X(0x87ABDE14B8ull),X(0x87C12D9067ull),X(0x87D67BBD21ull),X(0x87EBC89AB0ull),X(0x88011428E1ull),X(0x88165E677Dull),X(0x882BA75651ull),X(0x8840EEF528ull),
-	X(0x88563543CEull),X(0x886B7A420Full),X(0x8880BDEFB5ull),X(0x8896004C8Cull),X(0x88AB415861ull),X(0x88C08112FDull),X(0x88D5BF7C2Eull),X(0x88EAFC93BEull),
-	X(0x890038597Aull),X(0x891572CD2Cull),X(0x892AABEEA0ull),X(0x893FE3BDA3ull),X(0x89551A39FFull),X(0x896A4F6381ull),X(0x897F8339F3ull),X(0x8994B5BD23ull),
-	X(0x89A9E6ECDAull),X(0x89BF16C8E6ull),X(0x89D4455112ull),X(0x89E9728529ull),X(0x89FE9E64F7ull),X(0x8A13C8F049ull),X(0x8A28F226E9ull),X(0x8A3E1A08A4ull),
-	X(0x8A53409545ull),X(0x8A6865CC99ull),X(0x8A7D89AE6Aull),X(0x8A92AC3A86ull),X(0x8AA7CD70B7ull),X(0x8ABCED50CAull),X(0x8AD20BDA8Bull),X(0x8AE7290DC4ull),
-	X(0x8AFC44EA44ull),X(0x8B115F6FD4ull),X(0x8B26789E41ull),X(0x8B3B907558ull),X(0x8B50A6F4E3ull),X(0x8B65BC1CB0ull),X(0x8B7ACFEC89ull),X(0x8B8FE2643Cull),
-	X(0x8BA4F38393ull),X(0x8BBA034A5Cull),X(0x8BCF11B861ull),X(0x8BE41ECD70ull),X(0x8BF92A8954ull),X(0x8C0E34EBD9ull),X(0x8C233DF4CBull),X(0x8C3845A3F7ull),
-	X(0x8C4D4BF928ull),X(0x8C6250F42Aull),X(0x8C775494CBull),X(0x8C8C56DAD5ull),X(0x8CA157C616ull),X(0x8CB6575659ull),X(0x8CCB558B6Aull),X(0x8CE0526516ull),
-	X(0x8CF54DE328ull),X(0x8D0A48056Eull),X(0x8D1F40CBB3ull),X(0x8D343835C4ull),X(0x8D492E436Cull),X(0x8D5E22F479ull),X(0x8D731648B6ull),X(0x8D88083FF0ull),
-	X(0x8D9CF8D9F2ull),X(0x8DB1E8168Bull),X(0x8DC6D5F585ull),X(0x8DDBC276ACull),X(0x8DF0AD99CFull),X(0x8E05975EB8ull),X(0x8E1A7FC535ull),X(0x8E2F66CD11ull),
-	X(0x8E444C7619ull),X(0x8E5930C01Aull),X(0x8E6E13AAE0ull),X(0x8E82F53637ull),X(0x8E97D561ECull),X(0x8EACB42DCBull),X(0x8EC19199A2ull),X(0x8ED66DA53Cull),
-	X(0x8EEB485065ull),X(0x8F00219AECull),X(0x8F14F9849Bull),X(0x8F29D00D40ull),X(0x8F3EA534A7ull),X(0x8F5378FA9Dull),X(0x8F684B5EEFull),X(0x8F7D1C6168ull),
-	X(0x8F91EC01D6ull),X(0x8FA6BA4006ull),X(0x8FBB871BC3ull),X(0x8FD05294DBull),X(0x8FE51CAB1Bull),X(0x8FF9E55E4Eull),X(0x900EACAE43ull),X(0x9023729AC5ull),
-	X(0x90383723A1ull),X(0x904CFA48A4ull),X(0x9061BC099Bull),X(0x90767C6652ull),X(0x908B3B5E97ull),X(0x909FF8F236ull),X(0x90B4B520FCull),X(0x90C96FEAB6ull),
-	X(0x90DE294F31ull),X(0x90F2E14E39ull),X(0x910797E79Cull),X(0x911C4D1B26ull),X(0x913100E8A4ull),X(0x9145B34FE4ull),X(0x915A6450B1ull),X(0x916F13EADAull),
-	X(0x9183C21E2Aull),X(0x91986EEA70ull),X(0x91AD1A4F77ull),X(0x91C1C44D0Eull),X(0x91D66CE300ull),X(0x91EB14111Bull),X(0x91FFB9D72Dull),X(0x92145E3501ull),
-	X(0x9229012A66ull),X(0x923DA2B728ull),X(0x925242DB14ull),X(0x9266E195F8ull),X(0x927B7EE7A0ull),X(0x92901ACFDAull),X(0x92A4B54E73ull),X(0x92B94E6338ull),
-	X(0x92CDE60DF6ull),X(0x92E27C4E7Aull),X(0x92F7112492ull),X(0x930BA4900Bull),X(0x93203690B2ull),X(0x9334C72654ull),X(0x93495650BFull),X(0x935DE40FC0ull),
-	X(0x9372706323ull),X(0x9386FB4AB7ull),X(0x939B84C649ull),X(0x93B00CD5A6ull),X(0x93C493789Bull),X(0x93D918AEF5ull),X(0x93ED9C7883ull),X(0x94021ED512ull),
-	X(0x94169FC46Eull),X(0x942B1F4666ull),X(0x943F9D5AC6ull),X(0x94541A015Cull),X(0x94689539F6ull),X(0x947D0F0462ull),X(0x949187606Bull),X(0x94A5FE4DE1ull),
-	X(0x94BA73CC90ull),X(0x94CEE7DC46ull),X(0x94E35A7CD1ull),X(0x94F7CBADFEull),X(0x950C3B6F9Bull),X(0x9520A9C175ull),X(0x953516A35Aull),X(0x9549821517ull),
-	X(0x955DEC167Aull),X(0x957254A751ull),X(0x9586BBC76Aull),X(0x959B217691ull),X(0x95AF85B495ull),X(0x95C3E88144ull),X(0x95D849DC6Aull),X(0x95ECA9C5D6ull),
-	X(0x9601083D56ull),X(0x96156542B7ull),X(0x9629C0D5C8ull),X(0x963E1AF654ull),X(0x965273A42Cull),X(0x9666CADF1Cull),X(0x967B20A6F2ull),X(0x968F74FB7Cull),
-	X(0x96A3C7DC87ull),X(0x96B81949E3ull),X(0x96CC69435Cull),X(0x96E0B7C8C0ull),X(0x96F504D9DEull),X(0x9709507683ull),X(0x971D9A9E7Dull),X(0x9731E3519Bull),
-	X(0x97462A8FA9ull),X(0x975A705876ull),X(0x976EB4ABD1ull),X(0x9782F78986ull),X(0x979738F164ull),X(0x97AB78E33Aull),X(0x97BFB75ED4ull),X(0x97D3F46402ull),
-	X(0x97E82FF290ull),X(0x97FC6A0A4Eull),X(0x9810A2AB0Aull),X(0x9824D9D490ull),X(0x98390F86B1ull),X(0x984D43C139ull),X(0x98617683F6ull),X(0x9875A7CEB8ull),
-	X(0x9889D7A14Cull),X(0x989E05FB81ull),X(0x98B232DD24ull),X(0x98C65E4603ull),X(0x98DA8835EEull),X(0x98EEB0ACB2ull),X(0x9902D7AA1Eull),X(0x9916FD2DFFull),
-	X(0x992B213825ull),X(0x993F43C85Dull),X(0x995364DE76ull),X(0x9967847A3Dull),X(0x997BA29B83ull),X(0x998FBF4214ull),X(0x99A3DA6DBFull),X(0x99B7F41E52ull),
-	X(0x99CC0C539Dull),X(0x99E0230D6Dull),X(0x99F4384B91ull),X(0x9A084C0DD7ull),X(0x9A1C5E540Eull),X(0x9A306F1E04ull),X(0x9A447E6B87ull),X(0x9A588C3C67ull),
-	X(0x9A6C989071ull),X(0x9A80A36775ull),X(0x9A94ACC141ull),X(0x9AA8B49DA2ull),X(0x9ABCBAFC69ull),X(0x9AD0BFDD63ull),X(0x9AE4C34060ull),X(0x9AF8C5252Dull),
-	X(0x9B0CC58B99ull),X(0x9B20C47374ull),X(0x9B34C1DC8Bull),X(0x9B48BDC6ADull),X(0x9B5CB831AAull),X(0x9B70B11D4Full),X(0x9B84A8896Cull),X(0x9B989E75CFull),
-	X(0x9BAC92E247ull),X(0x9BC085CEA3ull),X(0x9BD4773AB1ull),X(0x9BE8672640ull),X(0x9BFC559120ull),X(0x9C10427B1Eull),X(0x9C242DE40Aull),X(0x9C3817CBB3ull),
-	X(0x9C4C0031E7ull),X(0x9C5FE71676ull),X(0x9C73CC792Eull),X(0x9C87B059DEull),X(0x9C9B92B855ull),X(0x9CAF739462ull),X(0x9CC352EDD4ull),X(0x9CD730C47Aull),
-	X(0x9CEB0D1823ull),X(0x9CFEE7E89Eull),X(0x9D12C135B9ull),X(0x9D2698FF45ull),X(0x9D3A6F450Full),X(0x9D4E4406E8ull),X(0x9D6217449Eull),X(0x9D75E8FE00ull),
-	X(0x9D89B932DDull),X(0x9D9D87E305ull),X(0x9DB1550E46ull),X(0x9DC520B470ull),X(0x9DD8EAD551ull),X(0x9DECB370BAull),X(0x9E007A8679ull),X(0x9E1440165Dull),
-	X(0x9E28042036ull),X(0x9E3BC6A3D2ull),X(0x9E4F87A102ull),X(0x9E63471794ull),X(0x9E77050757ull),X(0x9E8AC1701Cull),X(0x9E9E7C51B1ull),X(0x9EB235ABE5ull),
-	X(0x9EC5ED7E88ull),X(0x9ED9A3C969ull),X(0x9EED588C58ull),X(0x9F010BC724ull),X(0x9F14BD799Cull),X(0x9F286DA390ull),X(0x9F3C1C44CFull),X(0x9F4FC95D28ull),
-	X(0x9F6374EC6Cull),X(0x9F771EF269ull),X(0x9F8AC76EEFull),X(0x9F9E6E61CDull),X(0x9FB213CAD4ull),X(0x9FC5B7A9D2ull),X(0x9FD959FE97ull),X(0x9FECFAC8F3ull),
-	X(0xA0009A08B5ull),X(0xA01437BDADull),X(0xA027D3E7AAull),X(0xA03B6E867Cull),X(0xA04F0799F2ull),X(0xA0629F21DDull),X(0xA076351E0Cull),X(0xA089C98E4Full),
-	X(0xA09D5C7274ull),X(0xA0B0EDCA4Dull),X(0xA0C47D95A8ull),X(0xA0D80BD456ull),X(0xA0EB988626ull),X(0xA0FF23AAE8ull),X(0xA112AD426Cull),X(0xA126354C81ull),
-	X(0xA139BBC8F7ull),X(0xA14D40B79Full),X(0xA160C41847ull),X(0xA17445EAC1ull),X(0xA187C62EDBull),X(0xA19B44E466ull),X(0xA1AEC20B31ull),X(0xA1C23DA30Dull),
-	X(0xA1D5B7ABC9ull),X(0xA1E9302535ull),X(0xA1FCA70F21ull),X(0xA2101C695Eull),X(0xA2239033BBull),X(0xA237026E08ull),X(0xA24A731815ull),X(0xA25DE231B3ull),
-	X(0xA2714FBAB0ull),X(0xA284BBB2DFull),X(0xA298261A0Dull),X(0xA2AB8EF00Cull),X(0xA2BEF634ACull),X(0xA2D25BE7BCull),X(0xA2E5C0090Eull),X(0xA2F9229870ull),
-	X(0xA30C8395B4ull),X(0xA31FE300A9ull),X(0xA33340D920ull),X(0xA3469D1EE8ull),X(0xA359F7D1D3ull),X(0xA36D50F1B0ull),X(0xA380A87E4Full),X(0xA393FE7782ull),
-	X(0xA3A752DD17ull),X(0xA3BAA5AEE0ull),X(0xA3CDF6ECADull),X(0xA3E146964Dull),X(0xA3F494AB93ull),X(0xA407E12C4Dull),X(0xA41B2C184Cull),X(0xA42E756F60ull),
-	X(0xA441BD315Bull),X(0xA455035E0Cull),X(0xA46847F544ull),X(0xA47B8AF6D4ull),X(0xA48ECC628Bull),X(0xA4A20C383Aull),X(0xA4B54A77B3ull),X(0xA4C88720C4ull),
-	X(0xA4DBC23340ull),X(0xA4EEFBAEF6ull),X(0xA5023393B6ull),X(0xA51569E153ull),X(0xA5289E979Bull),X(0xA53BD1B661ull),X(0xA54F033D73ull),X(0xA562332CA4ull),
-	X(0xA5756183C3ull),X(0xA5888E42A2ull),X(0xA59BB96911ull),X(0xA5AEE2F6E0ull),X(0xA5C20AEBE1ull),X(0xA5D53147E4ull),X(0xA5E8560ABAull),X(0xA5FB793434ull),
-	X(0xA60E9AC422ull),X(0xA621BABA56ull),X(0xA634D916A0ull),X(0xA647F5D8D0ull),X(0xA65B1100B8ull),X(0xA66E2A8E29ull),X(0xA6814280F4ull),X(0xA69458D8E9ull),
-	X(0xA6A76D95D9ull),X(0xA6BA80B795ull),X(0xA6CD923DEFull),X(0xA6E0A228B7ull),X(0xA6F3B077BDull),X(0xA706BD2AD4ull),X(0xA719C841CCull),X(0xA72CD1BC76ull),
-	X(0xA73FD99AA3ull),X(0xA752DFDC24ull),X(0xA765E480CAull),X(0xA778E78866ull),X(0xA78BE8F2CAull),X(0xA79EE8BFC7ull),X(0xA7B1E6EF2Cull),X(0xA7C4E380CDull),
-	X(0xA7D7DE7479ull),X(0xA7EAD7CA03ull),X(0xA7FDCF813Bull),X(0xA810C599F2ull),X(0xA823BA13F9ull),X(0xA836ACEF23ull),X(0xA8499E2B40ull),X(0xA85C8DC821ull),
-	X(0xA86F7BC598ull),X(0xA882682375ull),X(0xA89552E18Bull),X(0xA8A83BFFABull),X(0xA8BB237DA5ull),X(0xA8CE095B4Cull),X(0xA8E0ED9870ull),X(0xA8F3D034E4ull),
-	X(0xA906B13077ull),X(0xA919908AFDull),X(0xA92C6E4446ull),X(0xA93F4A5C24ull),X(0xA95224D267ull),X(0xA964FDA6E3ull),X(0xA977D4D968ull),X(0xA98AAA69C7ull),
-	X(0xA99D7E57D3ull),X(0xA9B050A35Cull),X(0xA9C3214C35ull),X(0xA9D5F0522Eull),X(0xA9E8BDB51Aull),X(0xA9FB8974CAull),X(0xAA0E539110ull),X(0xAA211C09BEull),
-	X(0xAA33E2DEA4ull),X(0xAA46A80F95ull),X(0xAA596B9C62ull),X(0xAA6C2D84DDull),X(0xAA7EEDC8D9ull),X(0xAA91AC6825ull),X(0xAAA4696295ull),X(0xAAB724B7FAull),
-	X(0xAAC9DE6826ull),X(0xAADC9672EAull),X(0xAAEF4CD819ull),X(0xAB02019784ull),X(0xAB14B4B0FDull),X(0xAB27662457ull),X(0xAB3A15F162ull),X(0xAB4CC417F0ull),
-	X(0xAB5F7097D5ull),X(0xAB721B70E1ull),X(0xAB84C4A2E6ull),X(0xAB976C2DB7ull),X(0xABAA121125ull),X(0xABBCB64D03ull),X(0xABCF58E122ull),X(0xABE1F9CD55ull),
-	X(0xABF499116Dull),X(0xAC0736AD3Cull),X(0xAC19D2A096ull),X(0xAC2C6CEB4Aull),X(0xAC3F058D2Dull),X(0xAC519C8610ull),X(0xAC6431D5C4ull),X(0xAC76C57C1Dull),
-	X(0xAC895778ECull),X(0xAC9BE7CC04ull),X(0xACAE767536ull),X(0xACC1037455ull),X(0xACD38EC934ull),X(0xACE61873A4ull),X(0xACF8A07377ull),X(0xAD0B26C880ull),
-	X(0xAD1DAB7292ull),X(0xAD302E717Eull),X(0xAD42AFC517ull),X(0xAD552F6D2Full),X(0xAD67AD6999ull),X(0xAD7A29BA27ull),X(0xAD8CA45EABull),X(0xAD9F1D56F8ull),
-	X(0xADB194A2E0ull),X(0xADC40A4235ull),X(0xADD67E34CBull),X(0xADE8F07A73ull),X(0xADFB611300ull),X(0xAE0DCFFE44ull),X(0xAE203D3C13ull),X(0xAE32A8CC3Eull),
-	X(0xAE4512AE98ull),X(0xAE577AE2F3ull),X(0xAE69E16923ull),X(0xAE7C4640FAull),X(0xAE8EA96A4Bull),X(0xAEA10AE4E7ull),X(0xAEB36AB0A2ull),X(0xAEC5C8CD4Full),
-	X(0xAED8253ABFull),X(0xAEEA7FF8C6ull),X(0xAEFCD90737ull),X(0xAF0F3065E4ull),X(0xAF218614A0ull),X(0xAF33DA133Eull),X(0xAF462C6190ull),X(0xAF587CFF6Aull),
-	X(0xAF6ACBEC9Dull),X(0xAF7D1928FEull),X(0xAF8F64B45Eull),X(0xAFA1AE8E91ull),X(0xAFB3F6B769ull),X(0xAFC63D2EBAull),X(0xAFD881F456ull),X(0xAFEAC50810ull),
-	X(0xAFFD0669BCull),X(0xB00F46192Bull),X(0xB021841632ull),X(0xB033C060A3ull),X(0xB045FAF851ull),X(0xB05833DD0Full),X(0xB06A6B0EB0ull),X(0xB07CA08D07ull),
-	X(0xB08ED457E8ull),X(0xB0A1066F24ull),X(0xB0B336D291ull),X(0xB0C5658200ull),X(0xB0D7927D44ull),X(0xB0E9BDC432ull),X(0xB0FBE7569Cull),X(0xB10E0F3454ull),
-	X(0xB120355D30ull),X(0xB13259D101ull),X(0xB1447C8F9Aull),X(0xB1569D98D0ull),X(0xB168BCEC76ull),X(0xB17ADA8A5Eull),X(0xB18CF6725Cull),X(0xB19F10A443ull),
-	X(0xB1B1291FE7ull),X(0xB1C33FE51Bull),X(0xB1D554F3B2ull),X(0xB1E7684B81ull),X(0xB1F979EC59ull),X(0xB20B89D60Full),X(0xB21D980875ull),X(0xB22FA48361ull),
-	X(0xB241AF46A4ull),X(0xB253B85212ull),X(0xB265BFA580ull),X(0xB277C540C0ull),X(0xB289C923A6ull),X(0xB29BCB4E05ull),X(0xB2ADCBBFB1ull),X(0xB2BFCA787Eull),
-	X(0xB2D1C77840ull),X(0xB2E3C2BEC9ull),X(0xB2F5BC4BEDull),X(0xB307B41F81ull),X(0xB319AA3958ull),X(0xB32B9E9945ull),X(0xB33D913F1Cull),X(0xB34F822AB1ull),
-	X(0xB361715BD8ull),X(0xB3735ED264ull),X(0xB3854A8E29ull),X(0xB397348EFCull),X(0xB3A91CD4AFull),X(0xB3BB035F16ull),X(0xB3CCE82E06ull),X(0xB3DECB4152ull),
-	X(0xB3F0AC98CEull),X(0xB4028C344Full),X(0xB4146A13A7ull),X(0xB4264636AAull),X(0xB438209D2Eull),X(0xB449F94705ull),X(0xB45BD03404ull),X(0xB46DA563FFull),
-	X(0xB47F78D6C9ull),X(0xB4914A8C36ull),X(0xB4A31A841Cull),X(0xB4B4E8BE4Dull),X(0xB4C6B53A9Eull),X(0xB4D87FF8E3ull),X(0xB4EA48F8EFull),X(0xB4FC103A98ull),
-	X(0xB50DD5BDB1ull),X(0xB51F99820Full),X(0xB5315B8785ull),X(0xB5431BCDE7ull),X(0xB554DA550Bull),X(0xB566971CC3ull),X(0xB5785224E6ull),X(0xB58A0B6D45ull),
-	X(0xB59BC2F5B7ull),X(0xB5AD78BE0Full),X(0xB5BF2CC621ull),X(0xB5D0DF0DC2ull),X(0xB5E28F94C6ull),X(0xB5F43E5B02ull),X(0xB605EB6049ull),X(0xB61796A471ull),
-	X(0xB62940274Eull),X(0xB63AE7E8B3ull),X(0xB64C8DE876ull),X(0xB65E32266Bull),X(0xB66FD4A267ull),X(0xB681755C3Dull),X(0xB6931453C3ull),X(0xB6A4B188CCull),
-	X(0xB6B64CFB2Eull),X(0xB6C7E6AABEull),X(0xB6D97E974Eull),X(0xB6EB14C0B5ull),X(0xB6FCA926C7ull),X(0xB70E3BC959ull),X(0xB71FCCA83Eull),X(0xB7315BC34Cull),
-	X(0xB742E91A57ull),X(0xB75474AD35ull),X(0xB765FE7BB9ull),X(0xB7778685B9ull),X(0xB7890CCB0Aull),X(0xB79A914B7Full),X(0xB7AC1406EEull),X(0xB7BD94FD2Cull),
-	X(0xB7CF142E0Dull),X(0xB7E0919966ull),X(0xB7F20D3F0Cull),X(0xB803871ED5ull),X(0xB814FF3894ull),X(0xB826758C1Full),X(0xB837EA194Bull),X(0xB8495CDFECull),
-	X(0xB85ACDDFD7ull),X(0xB86C3D18E3ull),X(0xB87DAA8AE2ull),X(0xB88F1635ABull),X(0xB8A0801913ull),X(0xB8B1E834EEull),X(0xB8C34E8912ull),X(0xB8D4B31553ull),
-	X(0xB8E615D987ull),X(0xB8F776D583ull),X(0xB908D6091Cull),X(0xB91A337427ull),X(0xB92B8F1679ull),X(0xB93CE8EFE8ull),X(0xB94E410048ull),X(0xB95F97476Full),
-	X(0xB970EBC532ull),X(0xB9823E7966ull),X(0xB9938F63E1ull),X(0xB9A4DE8477ull),X(0xB9B62BDAFFull),X(0xB9C777674Dull),X(0xB9D8C12937ull),X(0xB9EA092092ull),
-	X(0xB9FB4F4D33ull),X(0xBA0C93AEF0ull),X(0xBA1DD6459Eull),X(0xBA2F171113ull),X(0xBA40561124ull),X(0xBA519345A7ull),X(0xBA62CEAE70ull),X(0xBA74084B56ull),
-	X(0xBA85401C2Eull),X(0xBA967620CDull),X(0xBAA7AA5909ull),X(0xBAB8DCC4B8ull),X(0xBACA0D63AEull),X(0xBADB3C35C3ull),X(0xBAEC693ACBull),X(0xBAFD94729Bull),
-	X(0xBB0EBDDD0Bull),X(0xBB1FE579EEull),X(0xBB310B491Bull),X(0xBB422F4A68ull),X(0xBB53517DAAull),X(0xBB6471E2B7ull),X(0xBB75907965ull),X(0xBB86AD418Aull),
-	X(0xBB97C83AFAull),X(0xBBA8E1658Dull),X(0xBBB9F8C118ull),X(0xBBCB0E4D70ull),X(0xBBDC220A6Cull),X(0xBBED33F7E1ull),X(0xBBFE4415A6ull),X(0xBC0F52638Full),
-	X(0xBC205EE174ull),X(0xBC31698F2Aull),X(0xBC42726C87ull),X(0xBC53797961ull),X(0xBC647EB58Eull),X(0xBC758220E4ull),X(0xBC8683BB39ull),X(0xBC97838462ull),
-	X(0xBCA8817C37ull),X(0xBCB97DA28Dull),X(0xBCCA77F73Bull),X(0xBCDB707A15ull),X(0xBCEC672AF4ull),X(0xBCFD5C09ABull),X(0xBD0E4F1613ull),X(0xBD1F405000ull),
-	X(0xBD302FB74Aull),X(0xBD411D4BC6ull),X(0xBD52090D4Bull),X(0xBD62F2FBAEull),X(0xBD73DB16C7ull),X(0xBD84C15E6Bull),X(0xBD95A5D270ull),X(0xBDA68872AEull),
-	X(0xBDB7693EFAull),X(0xBDC848372Bull),X(0xBDD9255B17ull),X(0xBDEA00AA94ull),X(0xBDFADA257Aull),X(0xBE0BB1CB9Dull),X(0xBE1C879CD6ull),X(0xBE2D5B98F9ull),
-	X(0xBE3E2DBFDEull),X(0xBE4EFE115Cull),X(0xBE5FCC8D48ull),X(0xBE70993379ull),X(0xBE816403C7ull),X(0xBE922CFE06ull),X(0xBEA2F4220Full),X(0xBEB3B96FB7ull),
-	X(0xBEC47CE6D5ull),X(0xBED53E8740ull),X(0xBEE5FE50CEull),X(0xBEF6BC4357ull),X(0xBF07785EB0ull),X(0xBF1832A2B1ull),X(0xBF28EB0F30ull),X(0xBF39A1A404ull),
-	X(0xBF4A566104ull),X(0xBF5B094606ull),X(0xBF6BBA52E2ull),X(0xBF7C69876Eull),X(0xBF8D16E381ull),X(0xBF9DC266F2ull),X(0xBFAE6C1197ull),X(0xBFBF13E348ull),
-	X(0xBFCFB9DBDCull),X(0xBFE05DFB29ull),X(0xBFF1004106ull),X(0xC001A0AD4Bull),X(0xC0123F3FCDull),X(0xC022DBF866ull),X(0xC03376D6EAull),X(0xC0440FDB32ull),
-	X(0xC054A70514ull),X(0xC0653C5467ull),X(0xC075CFC904ull),X(0xC0866162BFull),X(0xC096F12172ull),X(0xC0A77F04F2ull),X(0xC0B80B0D17ull),X(0xC0C89539B9ull),
-	X(0xC0D91D8AAEull),X(0xC0E9A3FFCDull),X(0xC0FA2898EEull),X(0xC10AAB55E9ull),X(0xC11B2C3693ull),X(0xC12BAB3AC6ull),X(0xC13C286257ull),X(0xC14CA3AD1Eull),
-	X(0xC15D1D1AF3ull),X(0xC16D94ABADull),X(0xC17E0A5F23ull),X(0xC18E7E352Dull),X(0xC19EF02DA2ull),X(0xC1AF604859ull),X(0xC1BFCE852Aull),X(0xC1D03AE3EDull),
-	X(0xC1E0A56479ull),X(0xC1F10E06A4ull),X(0xC20174CA48ull),X(0xC211D9AF3Bull),X(0xC2223CB555ull),X(0xC2329DDC6Eull),X(0xC242FD245Dull),X(0xC2535A8CF9ull),
-	X(0xC263B6161Bull),X(0xC2740FBF99ull),X(0xC28467894Dull),X(0xC294BD730Cull),X(0xC2A5117CB0ull),X(0xC2B563A60Full),X(0xC2C5B3EF02ull),X(0xC2D6025760ull),
-	X(0xC2E64EDF01ull),X(0xC2F69985BCull),X(0xC306E24B6Aull),X(0xC317292FE3ull),X(0xC3276E32FDull),X(0xC337B15492ull),X(0xC347F29479ull),X(0xC35831F289ull),
-	X(0xC3686F6E9Bull),X(0xC378AB0887ull),X(0xC388E4C025ull),X(0xC3991C954Cull),X(0xC3A95287D4ull),X(0xC3B9869796ull),X(0xC3C9B8C46Aull),X(0xC3D9E90E27ull),
-	X(0xC3EA1774A6ull),X(0xC3FA43F7BFull),X(0xC40A6E9749ull),X(0xC41A97531Eull),X(0xC42ABE2B14ull),X(0xC43AE31F05ull),X(0xC44B062EC8ull),X(0xC45B275A36ull),
-	X(0xC46B46A126ull),X(0xC47B640372ull),X(0xC48B7F80F1ull),X(0xC49B99197Bull),X(0xC4ABB0CCE9ull),X(0xC4BBC69B13ull),X(0xC4CBDA83D1ull),X(0xC4DBEC86FCull),
-	X(0xC4EBFCA46Cull),X(0xC4FC0ADBFAull),X(0xC50C172D7Dull),X(0xC51C2198CFull),X(0xC52C2A1DC7ull),X(0xC53C30BC3Eull),X(0xC54C35740Dull),X(0xC55C38450Bull),
-	X(0xC56C392F13ull),X(0xC57C3831FBull),X(0xC58C354D9Cull),X(0xC59C3081D0ull),X(0xC5AC29CE6Full),X(0xC5BC213350ull),X(0xC5CC16B04Eull),X(0xC5DC0A4540ull),
-	X(0xC5EBFBF1FFull),X(0xC5FBEBB664ull),X(0xC60BD99247ull),X(0xC61BC58581ull),X(0xC62BAF8FECull),X(0xC63B97B15Full),X(0xC64B7DE9B3ull),X(0xC65B6238C1ull),
-	X(0xC66B449E62ull),X(0xC67B251A6Full),X(0xC68B03ACC0ull),X(0xC69AE0552Full),X(0xC6AABB1394ull),X(0xC6BA93E7C8ull),X(0xC6CA6AD1A5ull),X(0xC6DA3FD102ull),
-	X(0xC6EA12E5B9ull),X(0xC6F9E40FA2ull),X(0xC709B34E98ull),X(0xC71980A272ull),X(0xC7294C0B0Aull),X(0xC739158839ull),X(0xC748DD19D8ull),X(0xC758A2BFC0ull),
-	X(0xC7686679CAull),X(0xC7782847CEull),X(0xC787E829A8ull),X(0xC797A61F2Eull),X(0xC7A762283Bull),X(0xC7B71C44A8ull),X(0xC7C6D4744Eull),X(0xC7D68AB706ull),
-	X(0xC7E63F0CA9ull),X(0xC7F5F17511ull),X(0xC805A1F016ull),X(0xC815507D93ull),X(0xC824FD1D60ull),X(0xC834A7CF57ull),X(0xC844509352ull),X(0xC853F76928ull),
-	X(0xC8639C50B5ull),X(0xC8733F49D1ull),X(0xC882E05456ull),X(0xC8927F701Cull),X(0xC8A21C9CFFull),X(0xC8B1B7DAD6ull),X(0xC8C151297Cull),X(0xC8D0E888CAull),
-	X(0xC8E07DF89Aull),X(0xC8F01178C5ull),X(0xC8FFA30924ull),X(0xC90F32A992ull),X(0xC91EC059E8ull),X(0xC92E4C19FFull),X(0xC93DD5E9B2ull),X(0xC94D5DC8D9ull),
-	X(0xC95CE3B74Full),X(0xC96C67B4EDull),X(0xC97BE9C18Dull),X(0xC98B69DD09ull),X(0xC99AE8073Aull),X(0xC9AA643FFAull),X(0xC9B9DE8723ull),X(0xC9C956DC8Full),
-	X(0xC9D8CD4018ull),X(0xC9E841B197ull),X(0xC9F7B430E7ull),X(0xCA0724BDE1ull),X(0xCA1693585Eull),X(0xCA2600003Aull),X(0xCA356AB54Eull),X(0xCA44D37774ull),
-	X(0xCA543A4686ull),X(0xCA639F225Eull),X(0xCA73020AD5ull),X(0xCA8262FFC7ull),X(0xCA91C2010Dull),X(0xCAA11F0E80ull),X(0xCAB07A27FCull),X(0xCABFD34D5Bull),
-	X(0xCACF2A7E76ull),X(0xCADE7FBB27ull),X(0xCAEDD30349ull),X(0xCAFD2456B6ull),X(0xCB0C73B548ull),X(0xCB1BC11EDAull),X(0xCB2B0C9345ull),X(0xCB3A561264ull),
-	X(0xCB499D9C12ull),X(0xCB58E33027ull),X(0xCB6826CE80ull),X(0xCB776876F5ull),X(0xCB86A82963ull),X(0xCB95E5E5A1ull),X(0xCBA521AB8Dull),X(0xCBB45B7AFFull),
-	X(0xCBC39353D1ull),X(0xCBD2C935E0ull),X(0xCBE1FD2104ull),X(0xCBF12F1519ull),X(0xCC005F11F9ull),X(0xCC0F8D177Full),X(0xCC1EB92585ull),X(0xCC2DE33BE5ull),
-	X(0xCC3D0B5A7Aull),X(0xCC4C31811Full),X(0xCC5B55AFAFull),X(0xCC6A77E604ull),X(0xCC799823F9ull),X(0xCC88B66968ull),X(0xCC97D2B62Cull),X(0xCCA6ED0A20ull),
-	X(0xCCB605651Eull),X(0xCCC51BC702ull),X(0xCCD4302FA6ull),X(0xCCE3429EE5ull),X(0xCCF2531499ull),X(0xCD0161909Eull),X(0xCD106E12CFull),X(0xCD1F789B06ull),
-	X(0xCD2E81291Dull),X(0xCD3D87BCF1ull),X(0xCD4C8C565Cull),X(0xCD5B8EF539ull),X(0xCD6A8F9963ull),X(0xCD798E42B4ull),X(0xCD888AF109ull),X(0xCD9785A43Bull),
-	X(0xCDA67E5C26ull),X(0xCDB57518A5ull),X(0xCDC469D994ull),X(0xCDD35C9ECCull),X(0xCDE24D682Aull),X(0xCDF13C3588ull),X(0xCE002906C2ull),X(0xCE0F13DBB2ull),
-	X(0xCE1DFCB434ull),X(0xCE2CE39024ull),X(0xCE3BC86F5Cull),X(0xCE4AAB51B7ull),X(0xCE598C3712ull),X(0xCE686B1F46ull),X(0xCE77480A30ull),X(0xCE8622F7ABull),
-	X(0xCE94FBE792ull),X(0xCEA3D2D9C1ull),X(0xCEB2A7CE12ull),X(0xCEC17AC462ull),X(0xCED04BBC8Cull),X(0xCEDF1AB66Bull),X(0xCEEDE7B1DAull),X(0xCEFCB2AEB6ull),
-	X(0xCF0B7BACD9ull),X(0xCF1A42AC1Full),X(0xCF2907AC64ull),X(0xCF37CAAD84ull),X(0xCF468BAF59ull),X(0xCF554AB1BFull),X(0xCF6407B493ull),X(0xCF72C2B7AFull),
-	X(0xCF817BBAF0ull),X(0xCF9032BE30ull),X(0xCF9EE7C14Cull),X(0xCFAD9AC420ull),X(0xCFBC4BC687ull),X(0xCFCAFAC85Cull),X(0xCFD9A7C97Dull),X(0xCFE852C9C3ull),
-	X(0xCFF6FBC90Cull),X(0xD005A2C733ull),X(0xD01447C414ull),X(0xD022EABF8Bull),X(0xD0318BB974ull),X(0xD0402AB1AAull),X(0xD04EC7A809ull),X(0xD05D629C6Eull),
-	X(0xD06BFB8EB4ull),X(0xD07A927EB8ull),X(0xD089276C55ull),X(0xD097BA5768ull),X(0xD0A64B3FCCull),X(0xD0B4DA255Dull),X(0xD0C36707F9ull),X(0xD0D1F1E779ull),
-	X(0xD0E07AC3BCull),X(0xD0EF019C9Dull),X(0xD0FD8671F7ull),X(0xD10C0943A8ull),X(0xD11A8A118Cull),X(0xD12908DB7Eull),X(0xD13785A15Bull),X(0xD1460062FFull),
-	X(0xD154792047ull),X(0xD162EFD90Eull),X(0xD171648D32ull),X(0xD17FD73C8Eull),X(0xD18E47E6FEull),X(0xD19CB68C60ull),X(0xD1AB232C8Full),X(0xD1B98DC768ull),
-	X(0xD1C7F65CC8ull),X(0xD1D65CEC8Aull),X(0xD1E4C1768Bull),X(0xD1F323FAA9ull),X(0xD2018478BEull),X(0xD20FE2F0A8ull),X(0xD21E3F6244ull),X(0xD22C99CD6Dull),
-	X(0xD23AF23201ull),X(0xD249488FDCull),X(0xD2579CE6DBull),X(0xD265EF36DAull),X(0xD2743F7FB6ull),X(0xD2828DC14Cull),X(0xD290D9FB78ull),X(0xD29F242E17ull),
-	X(0xD2AD6C5906ull),X(0xD2BBB27C22ull),X(0xD2C9F69747ull),X(0xD2D838AA53ull),X(0xD2E678B521ull),X(0xD2F4B6B78Full),X(0xD302F2B17Aull),X(0xD3112CA2BEull),
-	X(0xD31F648B39ull),X(0xD32D9A6AC8ull),X(0xD33BCE4147ull),X(0xD34A000E93ull),X(0xD3582FD289ull),X(0xD3665D8D06ull),X(0xD374893DE8ull),X(0xD382B2E50Bull),
-	X(0xD390DA824Dull),X(0xD39F00158Aull),X(0xD3AD239E9Full),X(0xD3BB451D6Bull),X(0xD3C96491C9ull),X(0xD3D781FB97ull),X(0xD3E59D5AB2ull),X(0xD3F3B6AEF7ull),
-	X(0xD401CDF844ull),X(0xD40FE33676ull),X(0xD41DF66969ull),X(0xD42C0790FCull),X(0xD43A16AD0Cull),X(0xD44823BD75ull),X(0xD4562EC216ull),X(0xD46437BACBull),
-	X(0xD4723EA772ull),X(0xD4804387E8ull),X(0xD48E465C0Cull),X(0xD49C4723B9ull),X(0xD4AA45DECEull),X(0xD4B8428D28ull),X(0xD4C63D2EA4ull),X(0xD4D435C321ull),
-	X(0xD4E22C4A7Bull),X(0xD4F020C491ull),X(0xD4FE13313Full),X(0xD50C039063ull),X(0xD519F1E1DBull),X(0xD527DE2585ull),X(0xD535C85B3Eull),X(0xD543B082E4ull),
-	X(0xD551969C55ull),X(0xD55F7AA76Dull),X(0xD56D5CA40Cull),X(0xD57B3C920Eull),X(0xD5891A7152ull),X(0xD596F641B5ull),X(0xD5A4D00316ull),X(0xD5B2A7B551ull),
-	X(0xD5C07D5844ull),X(0xD5CE50EBCFull),X(0xD5DC226FCEull),X(0xD5E9F1E41Full),X(0xD5F7BF48A1ull),X(0xD6058A9D31ull),X(0xD61353E1ADull),X(0xD6211B15F3ull),
-	X(0xD62EE039E2ull),X(0xD63CA34D56ull),X(0xD64A64502Full),X(0xD65823424Bull),X(0xD665E02387ull),X(0xD6739AF3C1ull),X(0xD68153B2D8ull),X(0xD68F0A60AAull),
-	X(0xD69CBEFD15ull),X(0xD6AA7187F6ull),X(0xD6B822012Eull),X(0xD6C5D06899ull),X(0xD6D37CBE15ull),X(0xD6E1270182ull),X(0xD6EECF32BDull),X(0xD6FC7551A5ull),
-	X(0xD70A195E18ull),X(0xD717BB57F4ull),X(0xD7255B3F17ull),X(0xD732F91361ull),X(0xD74094D4AFull),X(0xD74E2E82E1ull),X(0xD75BC61DD3ull),X(0xD7695BA566ull),
-	X(0xD776EF1976ull),X(0xD7848079E4ull),X(0xD7920FC68Cull),X(0xD79F9CFF4Full),X(0xD7AD28240Aull),X(0xD7BAB1349Cull),X(0xD7C83830E3ull),X(0xD7D5BD18BFull),
-	X(0xD7E33FEC0Eull),X(0xD7F0C0AAAEull),X(0xD7FE3F547Eull),X(0xD80BBBE95Eull),X(0xD81936692Bull),X(0xD826AED3C4ull),X(0xD834252909ull),X(0xD8419968D7ull),
-	X(0xD84F0B930Eull),X(0xD85C7BA78Dull),X(0xD869E9A632ull),X(0xD877558EDCull),X(0xD884BF616Bull),X(0xD892271DBCull),X(0xD89F8CC3B0ull),X(0xD8ACF05324ull),
-	X(0xD8BA51CBF9ull),X(0xD8C7B12E0Cull),X(0xD8D50E793Dull),X(0xD8E269AD6Bull),X(0xD8EFC2CA75ull),X(0xD8FD19D03Aull),X(0xD90A6EBE99ull),X(0xD917C19571ull),
-	X(0xD9251254A1ull),X(0xD93260FC09ull),X(0xD93FAD8B88ull),X(0xD94CF802FCull),X(0xD95A406246ull),X(0xD96786A943ull),X(0xD974CAD7D5ull),X(0xD9820CEDD9ull),
-	X(0xD98F4CEB2Full),X(0xD99C8ACFB6ull),X(0xD9A9C69B4Eull),X(0xD9B7004DD6ull),X(0xD9C437E72Dull),X(0xD9D16D6734ull),X(0xD9DEA0CDC8ull),X(0xD9EBD21ACAull),
-	X(0xD9F9014E19ull),X(0xDA062E6795ull),X(0xDA1359671Dull),X(0xDA20824C90ull),X(0xDA2DA917CEull),X(0xDA3ACDC8B7ull),X(0xDA47F05F2Aull),X(0xDA5510DB07ull),
-	X(0xDA622F3C2Eull),X(0xDA6F4B827Dull),X(0xDA7C65ADD5ull),X(0xDA897DBE15ull),X(0xDA9693B31Eull),X(0xDAA3A78CCEull),X(0xDAB0B94B05ull),X(0xDABDC8EDA4ull),
-	X(0xDACAD6748Aull),X(0xDAD7E1DF97ull),X(0xDAE4EB2EAAull),X(0xDAF1F261A3ull),X(0xDAFEF77863ull),X(0xDB0BFA72CAull),X(0xDB18FB50B6ull),X(0xDB25FA1208ull),
-	X(0xDB32F6B6A0ull),X(0xDB3FF13E5Eull),X(0xDB4CE9A922ull),X(0xDB59DFF6CCull),X(0xDB66D4273Bull),X(0xDB73C63A51ull),X(0xDB80B62FECull),X(0xDB8DA407EEull),
-	X(0xDB9A8FC236ull),X(0xDBA7795EA3ull),X(0xDBB460DD18ull),X(0xDBC1463D73ull),X(0xDBCE297F94ull),X(0xDBDB0AA35Dull),X(0xDBE7E9A8ADull),X(0xDBF4C68F64ull),
-	X(0xDC01A15762ull),X(0xDC0E7A0089ull),X(0xDC1B508AB8ull),X(0xDC2824F5D0ull),X(0xDC34F741B0ull),X(0xDC41C76E3Aull),X(0xDC4E957B4Dull),X(0xDC5B6168CBull),
-	X(0xDC682B3693ull),X(0xDC74F2E486ull),X(0xDC81B87284ull),X(0xDC8E7BE06Full),X(0xDC9B3D2E25ull),X(0xDCA7FC5B89ull),X(0xDCB4B9687Aull),X(0xDCC17454D9ull),
-	X(0xDCCE2D2087ull),X(0xDCDAE3CB64ull),X(0xDCE7985551ull),X(0xDCF44ABE2Eull),X(0xDD00FB05DDull),X(0xDD0DA92C3Eull),X(0xDD1A553131ull),X(0xDD26FF1497ull),
-	X(0xDD33A6D652ull),X(0xDD404C7641ull),X(0xDD4CEFF447ull),X(0xDD59915042ull),X(0xDD66308A15ull),X(0xDD72CDA1A0ull),X(0xDD7F6896C4ull),X(0xDD8C016963ull),
-	X(0xDD9898195Cull),X(0xDDA52CA690ull),X(0xDDB1BF10E2ull),X(0xDDBE4F5831ull),X(0xDDCADD7C5Full),X(0xDDD7697D4Dull),X(0xDDE3F35ADCull),X(0xDDF07B14ECull),
-	X(0xDDFD00AB60ull),X(0xDE09841E17ull),X(0xDE16056CF4ull),X(0xDE228497D7ull),X(0xDE2F019EA1ull),X(0xDE3B7C8135ull),X(0xDE47F53F72ull),X(0xDE546BD93Aull),
-	X(0xDE60E04E6Full),X(0xDE6D529EF1ull),X(0xDE79C2CAA2ull),X(0xDE8630D163ull),X(0xDE929CB316ull),X(0xDE9F066F9Cull),X(0xDEAB6E06D6ull),X(0xDEB7D378A6ull),
-	X(0xDEC436C4EDull),X(0xDED097EB8Cull),X(0xDEDCF6EC65ull),X(0xDEE953C75Aull),X(0xDEF5AE7C4Cull),X(0xDF02070B1Cull),X(0xDF0E5D73ACull),X(0xDF1AB1B5DEull),
-	X(0xDF2703D193ull),X(0xDF3353C6ADull),X(0xDF3FA1950Dull),X(0xDF4BED3C95ull),X(0xDF5836BD27ull),X(0xDF647E16A4ull),X(0xDF70C348EEull),X(0xDF7D0653E7ull),
-	X(0xDF89473770ull),X(0xDF9585F36Cull),X(0xDFA1C287BCull),X(0xDFADFCF441ull),X(0xDFBA3538DFull),X(0xDFC66B5576ull),X(0xDFD29F49E8ull),X(0xDFDED11618ull),
-	X(0xDFEB00B9E7ull),X(0xDFF72E3537ull),X(0xE0035987EAull),X(0xE00F82B1E2ull),X(0xE01BA9B301ull),X(0xE027CE8B2Aull),X(0xE033F13A3Dull),X(0xE04011C01Eull),
-	X(0xE04C301CAEull),X(0xE0584C4FD0ull),X(0xE064665965ull),X(0xE0707E394Full),X(0xE07C93EF71ull),X(0xE088A77BAEull),X(0xE094B8DDE6ull),X(0xE0A0C815FDull),
-	X(0xE0ACD523D4ull),X(0xE0B8E0074Full),X(0xE0C4E8C04Eull),X(0xE0D0EF4EB5ull),X(0xE0DCF3B266ull),X(0xE0E8F5EB43ull),X(0xE0F4F5F92Full),X(0xE100F3DC0Cull),
-	X(0xE10CEF93BCull),X(0xE118E92021ull),X(0xE124E0811Full),X(0xE130D5B698ull),X(0xE13CC8C06Eull),X(0xE148B99E83ull),X(0xE154A850BBull),X(0xE16094D6F8ull),
-	X(0xE16C7F311Cull),X(0xE178675F0Aull),X(0xE1844D60A4ull),X(0xE1903135CEull),X(0xE19C12DE6Aull),X(0xE1A7F25A5Aull),X(0xE1B3CFA982ull),X(0xE1BFAACBC4ull),
-	X(0xE1CB83C102ull),X(0xE1D75A8921ull),X(0xE1E32F2401ull),X(0xE1EF019186ull),X(0xE1FAD1D194ull),X(0xE2069FE40Cull),X(0xE2126BC8D2ull),X(0xE21E357FC9ull),
-	X(0xE229FD08D3ull),X(0xE235C263D4ull),X(0xE2418590AEull),X(0xE24D468F44ull),X(0xE259055F7Aull),X(0xE264C20132ull),X(0xE2707C7450ull),X(0xE27C34B8B6ull),
-	X(0xE287EACE47ull),X(0xE2939EB4E8ull),X(0xE29F506C7Aull),X(0xE2AAFFF4E1ull),X(0xE2B6AD4E00ull),X(0xE2C25877BAull),X(0xE2CE0171F3ull),X(0xE2D9A83C8Eull),
-	X(0xE2E54CD76Eull),X(0xE2F0EF4276ull),X(0xE2FC8F7D8Aull),X(0xE3082D888Cull),X(0xE313C96361ull),X(0xE31F630DEBull),X(0xE32AFA880Eull),X(0xE3368FD1AEull),
-	X(0xE34222EAADull),X(0xE34DB3D2EFull),X(0xE359428A59ull),X(0xE364CF10CCull),X(0xE37059662Dull),X(0xE37BE18A5Full),X(0xE387677D46ull),X(0xE392EB3EC5ull),
-	X(0xE39E6CCEC0ull),X(0xE3A9EC2D1Bull),X(0xE3B56959B8ull),X(0xE3C0E4547Dull),X(0xE3CC5D1D4Cull),X(0xE3D7D3B409ull),X(0xE3E3481897ull),X(0xE3EEBA4ADCull),
-	X(0xE3FA2A4ABAull),X(0xE405981815ull),X(0xE41103B2D1ull),X(0xE41C6D1AD1ull),X(0xE427D44FFAull),X(0xE433395230ull),X(0xE43E9C2156ull),X(0xE449FCBD50ull),
-	X(0xE4555B2603ull),X(0xE460B75B51ull),X(0xE46C115D20ull),X(0xE477692B53ull),X(0xE482BEC5CEull),X(0xE48E122C75ull),X(0xE499635F2Cull),X(0xE4A4B25DD7ull),
-	X(0xE4AFFF285Bull),X(0xE4BB49BE9Cull),X(0xE4C692207Cull),X(0xE4D1D84DE2ull),X(0xE4DD1C46B1ull),X(0xE4E85E0ACDull),X(0xE4F39D9A1Aull),X(0xE4FEDAF47Dull),
-	X(0xE50A1619DAull),X(0xE5154F0A14ull),X(0xE52085C512ull),X(0xE52BBA4AB6ull),X(0xE536EC9AE6ull),X(0xE5421CB585ull),X(0xE54D4A9A78ull),X(0xE5587649A3ull),
-	X(0xE5639FC2EBull),X(0xE56EC70635ull),X(0xE579EC1364ull),X(0xE5850EEA5Dull),X(0xE5902F8B05ull),X(0xE59B4DF541ull),X(0xE5A66A28F4ull),X(0xE5B1842604ull),
-	X(0xE5BC9BEC55ull),X(0xE5C7B17BCCull),X(0xE5D2C4D44Dull),X(0xE5DDD5F5BDull),X(0xE5E8E4E001ull),X(0xE5F3F192FDull),X(0xE5FEFC0E96ull),X(0xE60A0452B2ull),
-	X(0xE6150A5F34ull),X(0xE6200E3401ull),X(0xE62B0FD0FFull),X(0xE6360F3612ull),X(0xE6410C631Full),X(0xE64C07580Bull),X(0xE6570014BBull),X(0xE661F69913ull),
-	X(0xE66CEAE4FAull),X(0xE677DCF853ull),X(0xE682CCD303ull),X(0xE68DBA74F1ull),X(0xE698A5DE00ull),X(0xE6A38F0E15ull),X(0xE6AE760517ull),X(0xE6B95AC2EAull),
-	X(0xE6C43D4773ull),X(0xE6CF1D9297ull),X(0xE6D9FBA43Bull),X(0xE6E4D77C45ull),X(0xE6EFB11A99ull),X(0xE6FA887F1Eull),X(0xE7055DA9B8ull),X(0xE710309A4Dull),
-	X(0xE71B0150C1ull),X(0xE725CFCCFAull),X(0xE7309C0EDEull),X(0xE73B661652ull),X(0xE7462DE33Bull),X(0xE750F3757Full),X(0xE75BB6CD02ull),X(0xE76677E9ABull),
-	X(0xE77136CB5Full),X(0xE77BF37204ull),X(0xE786ADDD7Eull),X(0xE791660DB4ull),X(0xE79C1C028Bull),X(0xE7A6CFBBE8ull),X(0xE7B18139B2ull),X(0xE7BC307BCEull),
-	X(0xE7C6DD8220ull),X(0xE7D1884C90ull),X(0xE7DC30DB03ull),X(0xE7E6D72D5Eull),X(0xE7F17B4388ull),X(0xE7FC1D1D65ull),X(0xE806BCBADCull),X(0xE8115A1BD3ull),
-	X(0xE81BF5402Eull),X(0xE8268E27D5ull),X(0xE83124D2ADull),X(0xE83BB9409Cull),X(0xE8464B7188ull),X(0xE850DB6556ull),X(0xE85B691BEDull),X(0xE865F49532ull),
-	X(0xE8707DD10Cull),X(0xE87B04CF61ull),X(0xE885899016ull),X(0xE8900C1311ull),X(0xE89A8C583Aull),X(0xE8A50A5F75ull),X(0xE8AF8628A9ull),X(0xE8B9FFB3BCull),
-	X(0xE8C4770094ull),X(0xE8CEEC0F18ull),X(0xE8D95EDF2Dull),X(0xE8E3CF70BAull),X(0xE8EE3DC3A5ull),X(0xE8F8A9D7D4ull),X(0xE90313AD2Eull),X(0xE90D7B4399ull),
-	X(0xE917E09AFBull),X(0xE92243B33Aull),X(0xE92CA48C3Eull),X(0xE9370325EBull),X(0xE9415F802Aull),X(0xE94BB99ADFull),X(0xE9561175F3ull),X(0xE96067114Aull),
-	X(0xE96ABA6CCCull),X(0xE9750B885Full),X(0xE97F5A63E9ull),X(0xE989A6FF52ull),X(0xE993F15A80ull),X(0xE99E397559ull),X(0xE9A87F4FC4ull),X(0xE9B2C2E9A8ull),
-	X(0xE9BD0442EBull),X(0xE9C7435B75ull),X(0xE9D180332Bull),X(0xE9DBBAC9F5ull),X(0xE9E5F31FB9ull),X(0xE9F029345Eull),X(0xE9FA5D07CBull),X(0xEA048E99E6ull),
-	X(0xEA0EBDEA98ull),X(0xEA18EAF9C5ull),X(0xEA2315C756ull),X(0xEA2D3E5331ull),X(0xEA37649D3Eull),X(0xEA4188A562ull),X(0xEA4BAA6B86ull),X(0xEA55C9EF90ull),
-	X(0xEA5FE73167ull),X(0xEA6A0230F2ull),X(0xEA741AEE18ull),X(0xEA7E3168C1ull),X(0xEA8845A0D3ull),X(0xEA92579635ull),X(0xEA9C6748D0ull),X(0xEAA674B889ull),
-	X(0xEAB07FE548ull),X(0xEABA88CEF5ull),X(0xEAC48F7576ull),X(0xEACE93D8B3ull),X(0xEAD895F893ull),X(0xEAE295D4FEull),X(0xEAEC936DDAull),X(0xEAF68EC30Full),
-	X(0xEB0087D485ull),X(0xEB0A7EA223ull),X(0xEB14732BD0ull),X(0xEB1E657173ull),X(0xEB285572F5ull),X(0xEB3243303Cull),X(0xEB3C2EA931ull),X(0xEB4617DDBAull),
-	X(0xEB4FFECDBFull),X(0xEB59E37929ull),X(0xEB63C5DFDDull),X(0xEB6DA601C4ull),X(0xEB7783DEC6ull),X(0xEB815F76CBull),X(0xEB8B38C9B9ull),X(0xEB950FD779ull),
-	X(0xEB9EE49FF2ull),X(0xEBA8B7230Dull),X(0xEBB28760B0ull),X(0xEBBC5558C4ull),X(0xEBC6210B30ull),X(0xEBCFEA77DDull),X(0xEBD9B19EB1ull),X(0xEBE3767F96ull),
-	X(0xEBED391A73ull),X(0xEBF6F96F2Full),X(0xEC00B77DB3ull),X(0xEC0A7345E7ull),X(0xEC142CC7B3ull),X(0xEC1DE402FFull),X(0xEC2798F7B2ull),X(0xEC314BA5B5ull),
-	X(0xEC3AFC0CF0ull),X(0xEC44AA2D4Aull),X(0xEC4E5606ADull),X(0xEC57FF9900ull),X(0xEC61A6E42Cull),X(0xEC6B4BE818ull),X(0xEC74EEA4ACull),X(0xEC7E8F19D2ull),
-	X(0xEC882D4771ull),X(0xEC91C92D71ull),X(0xEC9B62CBBCull),X(0xECA4FA2238ull),X(0xECAE8F30CFull),X(0xECB821F768ull),X(0xECC1B275EDull),X(0xECCB40AC45ull),
-	X(0xECD4CC9A5Aull),X(0xECDE564012ull),X(0xECE7DD9D58ull),X(0xECF162B213ull),X(0xECFAE57E2Cull),X(0xED0466018Bull),X(0xED0DE43C19ull),X(0xED17602DBFull),
-	X(0xED20D9D665ull),X(0xED2A5135F4ull),X(0xED33C64C54ull),X(0xED3D39196Full),X(0xED46A99D2Cull),X(0xED5017D775ull),X(0xED5983C831ull),X(0xED62ED6F4Bull),
-	X(0xED6C54CCABull),X(0xED75B9E039ull),X(0xED7F1CA9DEull),X(0xED887D2984ull),X(0xED91DB5F13ull),X(0xED9B374A74ull),X(0xEDA490EB8Full),X(0xEDADE8424Full),
-	X(0xEDB73D4E9Bull),X(0xEDC090105Dull),X(0xEDC9E0877Dull),X(0xEDD32EB3E5ull),X(0xEDDC7A957Eull),X(0xEDE5C42C31ull),X(0xEDEF0B77E7ull),X(0xEDF8507889ull),
-	X(0xEE01932E00ull),X(0xEE0AD39835ull),X(0xEE1411B712ull),X(0xEE1D4D8A7Full),X(0xEE26871267ull),X(0xEE2FBE4EB1ull),X(0xEE38F33F48ull),X(0xEE4225E414ull),
-	X(0xEE4B563D00ull),X(0xEE548449F4ull),X(0xEE5DB00AD9ull),X(0xEE66D97F99ull),X(0xEE7000A81Eull),X(0xEE79258451ull),X(0xEE8248141Bull),X(0xEE8B685765ull),
-	X(0xEE94864E1Aull),X(0xEE9DA1F823ull),X(0xEEA6BB5569ull),X(0xEEAFD265D5ull),X(0xEEB8E72952ull),X(0xEEC1F99FC9ull),X(0xEECB09C924ull),X(0xEED417A54Cull),
-	X(0xEEDD23342Aull),X(0xEEE62C75AAull),X(0xEEEF3369B3ull),X(0xEEF8381030ull),X(0xEF013A690Cull),X(0xEF0A3A742Eull),X(0xEF13383182ull),X(0xEF1C33A0F1ull),
-	X(0xEF252CC265ull),X(0xEF2E2395C8ull),X(0xEF37181B03ull),X(0xEF400A5202ull),X(0xEF48FA3AACull),X(0xEF51E7D4EDull),X(0xEF5AD320AFull),X(0xEF63BC1DDBull),
-	X(0xEF6CA2CC5Bull),X(0xEF75872C1Aull),X(0xEF7E693D01ull),X(0xEF8748FEFBull),X(0xEF902671F2ull),X(0xEF990195D0ull),X(0xEFA1DA6A7Full),X(0xEFAAB0EFE8ull),
-	X(0xEFB38525F8ull),X(0xEFBC570C96ull),X(0xEFC526A3AFull),X(0xEFCDF3EB2Cull),X(0xEFD6BEE2F7ull),X(0xEFDF878AFAull),X(0xEFE84DE321ull),X(0xEFF111EB55ull),
-	X(0xEFF9D3A381ull),X(0xF002930B8Full),X(0xF00B502369ull),X(0xF0140AEAFBull),X(0xF01CC3622Dull),X(0xF0257988ECull),X(0xF02E2D5F21ull),X(0xF036DEE4B7ull),
-	X(0xF03F8E1999ull),X(0xF0483AFDB0ull),X(0xF050E590E9ull),X(0xF0598DD32Cull),X(0xF06233C466ull),X(0xF06AD76480ull),X(0xF07378B365ull),X(0xF07C17B100ull),
-	X(0xF084B45D3Cull),X(0xF08D4EB804ull),X(0xF095E6C141ull),X(0xF09E7C78E0ull),X(0xF0A70FDECAull),X(0xF0AFA0F2EBull),X(0xF0B82FB52Eull),X(0xF0C0BC257Dull),
-	X(0xF0C94643C4ull),X(0xF0D1CE0FECull),X(0xF0DA5389E2ull),X(0xF0E2D6B190ull),X(0xF0EB5786E1ull),X(0xF0F3D609C1ull),X(0xF0FC523A19ull),X(0xF104CC17D6ull),
-	X(0xF10D43A2E2ull),X(0xF115B8DB29ull),X(0xF11E2BC096ull),X(0xF1269C5313ull),X(0xF12F0A928Cull),X(0xF137767EECull),X(0xF13FE0181Full),X(0xF148475E10ull),
-	X(0xF150AC50A9ull),X(0xF1590EEFD6ull),X(0xF1616F3B83ull),X(0xF169CD339Bull),X(0xF17228D808ull),X(0xF17A8228B8ull),X(0xF182D92594ull),X(0xF18B2DCE89ull),
-	X(0xF193802381ull),X(0xF19BD02469ull),X(0xF1A41DD12Cull),X(0xF1AC6929B5ull),X(0xF1B4B22DEFull),X(0xF1BCF8DDC7ull),X(0xF1C53D3928ull),X(0xF1CD7F3FFEull),
-	X(0xF1D5BEF234ull),X(0xF1DDFC4FB5ull),X(0xF1E637586Eull),X(0xF1EE700C4Aull),X(0xF1F6A66B36ull),X(0xF1FEDA751Bull),X(0xF2070C29E8ull),X(0xF20F3B8986ull),
-	X(0xF2176893E2ull),X(0xF21F9348E8ull),X(0xF227BBA884ull),X(0xF22FE1B2A2ull),X(0xF23805672Cull),X(0xF24026C610ull),X(0xF24845CF3Aull),X(0xF250628294ull),
-	X(0xF2587CE00Cull),X(0xF26094E78Dull),X(0xF268AA9904ull),X(0xF270BDF45Bull),X(0xF278CEF980ull),X(0xF280DDA85Full),X(0xF288EA00E3ull),X(0xF290F402F9ull),
-	X(0xF298FBAE8Dull),X(0xF2A101038Bull),X(0xF2A90401DFull),X(0xF2B104A976ull),X(0xF2B902FA3Bull),X(0xF2C0FEF41Cull),X(0xF2C8F89704ull),X(0xF2D0EFE2E0ull),
-	X(0xF2D8E4D79Bull),X(0xF2E0D77524ull),X(0xF2E8C7BB64ull),X(0xF2F0B5AA4Bull),X(0xF2F8A141C2ull),X(0xF3008A81B8ull),X(0xF308716A19ull),X(0xF31055FAD0ull),
-	X(0xF3183833CBull),X(0xF3201814F7ull),X(0xF327F59E3Full),X(0xF32FD0CF90ull),X(0xF337A9A8D7ull),X(0xF33F802A01ull),X(0xF3475452FAull),X(0xF34F2623AFull),
-	X(0xF356F59C0Dull),X(0xF35EC2BC00ull),X(0xF3668D8375ull),X(0xF36E55F259ull),X(0xF3761C0898ull),X(0xF37DDFC620ull),X(0xF385A12ADEull),X(0xF38D6036BEull),
-	X(0xF3951CE9ACull),X(0xF39CD74397ull),X(0xF3A48F446Bull),X(0xF3AC44EC14ull),X(0xF3B3F83A81ull),X(0xF3BBA92F9Dull),X(0xF3C357CB56ull),X(0xF3CB040D99ull),
-	X(0xF3D2ADF653ull),X(0xF3DA558571ull),X(0xF3E1FABAE0ull),X(0xF3E99D968Eull),X(0xF3F13E1867ull),X(0xF3F8DC4059ull),X(0xF400780E51ull),X(0xF40811823Bull),
-	X(0xF40FA89C06ull),X(0xF4173D5B9Full),X(0xF41ECFC0F3ull),X(0xF4265FCBEFull),X(0xF42DED7C80ull),X(0xF43578D295ull),X(0xF43D01CE19ull),X(0xF444886EFCull),
-	X(0xF44C0CB52Aull),X(0xF4538EA090ull),X(0xF45B0E311Cull),X(0xF4628B66BCull),X(0xF46A06415Dull),X(0xF4717EC0EDull),X(0xF478F4E559ull),X(0xF48068AE8Eull),
-	X(0xF487DA1C7Cull),X(0xF48F492F0Eull),X(0xF496B5E633ull),X(0xF49E2041D8ull),X(0xF4A58841EBull),X(0xF4ACEDE65Bull),X(0xF4B4512F14ull),X(0xF4BBB21C04ull),
-	X(0xF4C310AD19ull),X(0xF4CA6CE241ull),X(0xF4D1C6BB6Aull),X(0xF4D91E3882ull),X(0xF4E0735976ull),X(0xF4E7C61E35ull),X(0xF4EF1686ACull),X(0xF4F66492C9ull),
-	X(0xF4FDB0427Bull),X(0xF504F995AFull),X(0xF50C408C54ull),X(0xF513852656ull),X(0xF51AC763A6ull),X(0xF52207442Full),X(0xF52944C7E2ull),X(0xF5307FEEABull),
-	X(0xF537B8B879ull),X(0xF53EEF253Aull),X(0xF5462334DCull),X(0xF54D54E74Full),X(0xF554843C7Eull),X(0xF55BB1345Aull),X(0xF562DBCED1ull),X(0xF56A040BD0ull),
-	X(0xF57129EB46ull),X(0xF5784D6D21ull),X(0xF57F6E9150ull),X(0xF5868D57C1ull),X(0xF58DA9C063ull),X(0xF594C3CB24ull),X(0xF59BDB77F3ull),X(0xF5A2F0C6BDull),
-	X(0xF5AA03B773ull),X(0xF5B1144A01ull),X(0xF5B8227E57ull),X(0xF5BF2E5463ull),X(0xF5C637CC14ull),X(0xF5CD3EE559ull),X(0xF5D443A01Full),X(0xF5DB45FC57ull),
-	X(0xF5E245F9EEull),X(0xF5E94398D4ull),X(0xF5F03ED8F6ull),X(0xF5F737BA45ull),X(0xF5FE2E3CAEull),X(0xF605226020ull),X(0xF60C14248Bull),X(0xF6130389DDull),
-	X(0xF619F09005ull),X(0xF620DB36F2ull),X(0xF627C37E92ull),X(0xF62EA966D6ull),X(0xF6358CEFABull),X(0xF63C6E1902ull),X(0xF6434CE2C8ull),X(0xF64A294CEDull),
-	X(0xF651035760ull),X(0xF657DB0210ull),X(0xF65EB04CECull),X(0xF6658337E3ull),X(0xF66C53C2E5ull),X(0xF67321EDE1ull),X(0xF679EDB8C5ull),X(0xF680B72382ull),
-	X(0xF6877E2E06ull),X(0xF68E42D840ull),X(0xF695052221ull),X(0xF69BC50B97ull),X(0xF6A2829491ull),X(0xF6A93DBCFFull),X(0xF6AFF684D1ull),X(0xF6B6ACEBF6ull),
-	X(0xF6BD60F25Cull),X(0xF6C41297F5ull),X(0xF6CAC1DCAEull),X(0xF6D16EC079ull),X(0xF6D8194343ull),X(0xF6DEC164FDull),X(0xF6E5672597ull),X(0xF6EC0A84FFull),
-	X(0xF6F2AB8326ull),X(0xF6F94A1FFBull),X(0xF6FFE65B6Eull),X(0xF70680356Full),X(0xF70D17ADECull),X(0xF713ACC4D7ull),X(0xF71A3F7A1Full),X(0xF720CFCDB3ull),
-	X(0xF7275DBF83ull),X(0xF72DE94F80ull),X(0xF734727D98ull),X(0xF73AF949BDull),X(0xF7417DB3DDull),X(0xF747FFBBE9ull),X(0xF74E7F61D1ull),X(0xF754FCA584ull),
-	X(0xF75B7786F3ull),X(0xF761F0060Dull),X(0xF7686622C3ull),X(0xF76ED9DD05ull),X(0xF7754B34C2ull),X(0xF77BBA29ECull),X(0xF78226BC71ull),X(0xF78890EC43ull),
-	X(0xF78EF8B951ull),X(0xF7955E238Bull),X(0xF79BC12AE2ull),X(0xF7A221CF46ull),X(0xF7A88010A8ull),X(0xF7AEDBEEF7ull),X(0xF7B5356A24ull),X(0xF7BB8C821Full),
-	X(0xF7C1E136D8ull),X(0xF7C8338841ull),X(0xF7CE837648ull),X(0xF7D4D100E0ull),X(0xF7DB1C27F8ull),X(0xF7E164EB80ull),X(0xF7E7AB4B6Aull),X(0xF7EDEF47A5ull),
-	X(0xF7F430E022ull),X(0xF7FA7014D2ull),X(0xF800ACE5A6ull),X(0xF806E7528Eull),X(0xF80D1F5B7Aull),X(0xF81355005Bull),X(0xF819884122ull),X(0xF81FB91DC0ull),
-	X(0xF825E79626ull),X(0xF82C13AA43ull),X(0xF8323D5A0Aull),X(0xF83864A56Aull),X(0xF83E898C54ull),X(0xF844AC0EBAull),X(0xF84ACC2C8Cull),X(0xF850E9E5BBull),
-	X(0xF857053A38ull),X(0xF85D1E29F4ull),X(0xF86334B4E0ull),X(0xF86948DAEDull),X(0xF86F5A9C0Cull),X(0xF87569F82Eull),X(0xF87B76EF43ull),X(0xF88181813Eull),
-	X(0xF88789AE0Eull),X(0xF88D8F75A6ull),X(0xF89392D7F6ull),X(0xF89993D4F0ull),X(0xF89F926C84ull),X(0xF8A58E9EA4ull),X(0xF8AB886B42ull),X(0xF8B17FD24Eull),
-	X(0xF8B774D3B9ull),X(0xF8BD676F76ull),X(0xF8C357A575ull),X(0xF8C94575A7ull),X(0xF8CF30DFFFull),X(0xF8D519E46Dull),X(0xF8DB0082E2ull),X(0xF8E0E4BB51ull),
-	X(0xF8E6C68DABull),X(0xF8ECA5F9E1ull),X(0xF8F282FFE5ull),X(0xF8F85D9FA8ull),X(0xF8FE35D91Cull),X(0xF9040BAC32ull),X(0xF909DF18DCull),X(0xF90FB01F0Cull),
-	X(0xF9157EBEB3ull),X(0xF91B4AF7C3ull),X(0xF92114CA2Eull),X(0xF926DC35E5ull),X(0xF92CA13ADAull),X(0xF93263D8FFull),X(0xF938241046ull),X(0xF93DE1E0A0ull),
-	X(0xF9439D49FFull),X(0xF949564C56ull),X(0xF94F0CE796ull),X(0xF954C11BB0ull),X(0xF95A72E898ull),X(0xF960224E3Eull),X(0xF965CF4C95ull),X(0xF96B79E38Full),
-	X(0xF97122131Dull),X(0xF976C7DB33ull),X(0xF97C6B3BC1ull),X(0xF9820C34BBull),X(0xF987AAC611ull),X(0xF98D46EFB7ull),X(0xF992E0B19Eull),X(0xF998780BB9ull),
-	X(0xF99E0CFDF9ull),X(0xF9A39F8852ull),X(0xF9A92FAAB4ull),X(0xF9AEBD6514ull),X(0xF9B448B762ull),X(0xF9B9D1A191ull),X(0xF9BF582394ull),X(0xF9C4DC3D5Cull),
-	X(0xF9CA5DEEDDull),X(0xF9CFDD3809ull),X(0xF9D55A18D2ull),X(0xF9DAD4912Aull),X(0xF9E04CA104ull),X(0xF9E5C24853ull),X(0xF9EB358709ull),X(0xF9F0A65D18ull),
-	X(0xF9F614CA74ull),X(0xF9FB80CF0Eull),X(0xFA00EA6ADAull),X(0xFA06519DCAull),X(0xFA0BB667D1ull),X(0xFA1118C8E1ull),X(0xFA1678C0EEull),X(0xFA1BD64FE9ull),
-	X(0xFA213175C6ull),X(0xFA268A3277ull),X(0xFA2BE085F0ull),X(0xFA31347022ull),X(0xFA3685F102ull),X(0xFA3BD50881ull),X(0xFA4121B693ull),X(0xFA466BFB2Bull),
-	X(0xFA4BB3D63Bull),X(0xFA50F947B7ull),X(0xFA563C4F91ull),X(0xFA5B7CEDBDull),X(0xFA60BB222Eull),X(0xFA65F6ECD6ull),X(0xFA6B304DA9ull),X(0xFA70674499ull),
-	X(0xFA759BD19Bull),X(0xFA7ACDF4A1ull),X(0xFA7FFDAD9Eull),X(0xFA852AFC86ull),X(0xFA8A55E14Bull),X(0xFA8F7E5BE2ull),X(0xFA94A46C3Dull),X(0xFA99C8124Full),
-	X(0xFA9EE94E0Cull),X(0xFAA4081F68ull),X(0xFAA9248655ull),X(0xFAAE3E82C7ull),X(0xFAB35614B1ull),X(0xFAB86B3C07ull),X(0xFABD7DF8BDull),X(0xFAC28E4AC5ull),
-	X(0xFAC79C3214ull),X(0xFACCA7AE9Cull),X(0xFAD1B0C052ull),X(0xFAD6B76729ull),X(0xFADBBBA314ull),X(0xFAE0BD7407ull),X(0xFAE5BCD9F7ull),X(0xFAEAB9D4D5ull),
-	X(0xFAEFB46497ull),X(0xFAF4AC8930ull),X(0xFAF9A24294ull),X(0xFAFE9590B5ull),X(0xFB03867389ull),X(0xFB0874EB03ull),X(0xFB0D60F717ull),X(0xFB124A97B8ull),
-	X(0xFB1731CCDBull),X(0xFB1C169674ull),X(0xFB20F8F475ull),X(0xFB25D8E6D5ull),X(0xFB2AB66D85ull),X(0xFB2F91887Bull),X(0xFB346A37AAull),X(0xFB39407B06ull),
-	X(0xFB3E145284ull),X(0xFB42E5BE17ull),X(0xFB47B4BDB4ull),X(0xFB4C81514Eull),X(0xFB514B78DBull),X(0xFB5613344Eull),X(0xFB5AD8839Aull),X(0xFB5F9B66B6ull),
-	X(0xFB645BDD94ull),X(0xFB6919E829ull),X(0xFB6DD5866Aull),X(0xFB728EB84Aull),X(0xFB77457DBFull),X(0xFB7BF9D6BBull),X(0xFB80ABC335ull),X(0xFB855B431Full),
-	X(0xFB8A085670ull),X(0xFB8EB2FD1Aull),X(0xFB935B3713ull),X(0xFB9801044Full),X(0xFB9CA464C3ull),X(0xFBA1455863ull),X(0xFBA5E3DF23ull),X(0xFBAA7FF8F9ull),
-	X(0xFBAF19A5D9ull),X(0xFBB3B0E5B8ull),X(0xFBB845B88Aull),X(0xFBBCD81E43ull),X(0xFBC16816DAull),X(0xFBC5F5A242ull),X(0xFBCA80C070ull),X(0xFBCF09715Aull),
-	X(0xFBD38FB4F3ull),X(0xFBD8138B31ull),X(0xFBDC94F408ull),X(0xFBE113EF6Eull),X(0xFBE5907D57ull),X(0xFBEA0A9DB8ull),X(0xFBEE825087ull),X(0xFBF2F795B8ull),
-	X(0xFBF76A6D40ull),X(0xFBFBDAD714ull),X(0xFC0048D329ull),X(0xFC04B46175ull),X(0xFC091D81ECull),X(0xFC0D843483ull),X(0xFC11E87931ull),X(0xFC164A4FE9ull),
-	X(0xFC1AA9B8A1ull),X(0xFC1F06B34Eull),X(0xFC23613FE6ull),X(0xFC27B95E5Eull),X(0xFC2C0F0EABull),X(0xFC306250C1ull),X(0xFC34B32498ull),X(0xFC39018A24ull),
-	X(0xFC3D4D8159ull),X(0xFC41970A2Full),X(0xFC45DE249Aull),X(0xFC4A22D08Full),X(0xFC4E650E05ull),X(0xFC52A4DCF0ull),X(0xFC56E23D46ull),X(0xFC5B1D2EFDull),
-	X(0xFC5F55B20Bull),X(0xFC638BC663ull),X(0xFC67BF6BFEull),X(0xFC6BF0A2CFull),X(0xFC701F6ACDull),X(0xFC744BC3EEull),X(0xFC7875AE26ull),X(0xFC7C9D296Cull),
-	X(0xFC80C235B6ull),X(0xFC84E4D2F9ull),X(0xFC8905012Cull),X(0xFC8D22C043ull),X(0xFC913E1035ull),X(0xFC9556F0F8ull),X(0xFC996D6281ull),X(0xFC9D8164C7ull),
-	X(0xFCA192F7BFull),X(0xFCA5A21B5Full),X(0xFCA9AECF9Eull),X(0xFCADB91471ull),X(0xFCB1C0E9CEull),X(0xFCB5C64FACull),X(0xFCB9C94601ull),X(0xFCBDC9CCC2ull),
-	X(0xFCC1C7E3E5ull),X(0xFCC5C38B62ull),X(0xFCC9BCC32Eull),X(0xFCCDB38B3Full),X(0xFCD1A7E38Bull),X(0xFCD599CC09ull),X(0xFCD98944AFull),X(0xFCDD764D74ull),
-	X(0xFCE160E64Dull),X(0xFCE5490F31ull),X(0xFCE92EC816ull),X(0xFCED1210F3ull),X(0xFCF0F2E9BEull),X(0xFCF4D1526Dull),X(0xFCF8AD4AF8ull),X(0xFCFC86D354ull),
-	X(0xFD005DEB77ull),X(0xFD0432935Aull),X(0xFD0804CAF1ull),X(0xFD0BD49234ull),X(0xFD0FA1E919ull),X(0xFD136CCF97ull),X(0xFD173545A4ull),X(0xFD1AFB4B37ull),
-	X(0xFD1EBEE047ull),X(0xFD228004CBull),X(0xFD263EB8B9ull),X(0xFD29FAFC08ull),X(0xFD2DB4CEAEull),X(0xFD316C30A4ull),X(0xFD352121DEull),X(0xFD38D3A255ull),
-	X(0xFD3C83B200ull),X(0xFD403150D4ull),X(0xFD43DC7EC9ull),X(0xFD47853BD6ull),X(0xFD4B2B87F2ull),X(0xFD4ECF6314ull),X(0xFD5270CD33ull),X(0xFD560FC645ull),
-	X(0xFD59AC4E43ull),X(0xFD5D466523ull),X(0xFD60DE0ADCull),X(0xFD64733F66ull),X(0xFD680602B7ull),X(0xFD6B9654C6ull),X(0xFD6F24358Cull),X(0xFD72AFA4FEull),
-	X(0xFD7638A316ull),X(0xFD79BF2FC8ull),X(0xFD7D434B0Eull),X(0xFD80C4F4DEull),X(0xFD84442D30ull),X(0xFD87C0F3FAull),X(0xFD8B3B4936ull),X(0xFD8EB32CD8ull),
-	X(0xFD92289EDBull),X(0xFD959B9F34ull),X(0xFD990C2DDBull),X(0xFD9C7A4AC8ull),X(0xFD9FE5F5F2ull),X(0xFDA34F2F51ull),X(0xFDA6B5F6DCull),X(0xFDAA1A4C8Cull),
-	X(0xFDAD7C3057ull),X(0xFDB0DBA235ull),X(0xFDB438A21Full),X(0xFDB793300Bull),X(0xFDBAEB4BF1ull),X(0xFDBE40F5CAull),X(0xFDC1942D8Cull),X(0xFDC4E4F331ull),
-	X(0xFDC83346AFull),X(0xFDCB7F27FEull),X(0xFDCEC89716ull),X(0xFDD20F93F0ull),X(0xFDD5541E83ull),X(0xFDD89636C7ull),X(0xFDDBD5DCB3ull),X(0xFDDF131041ull),
-	X(0xFDE24DD167ull),X(0xFDE586201Full),X(0xFDE8BBFC60ull),X(0xFDEBEF6621ull),X(0xFDEF205D5Cull),X(0xFDF24EE209ull),X(0xFDF57AF41Full),X(0xFDF8A49396ull),
-	X(0xFDFBCBC067ull),X(0xFDFEF07A8Bull),X(0xFE0212C1F9ull),X(0xFE053296A9ull),X(0xFE084FF894ull),X(0xFE0B6AE7B3ull),X(0xFE0E8363FDull),X(0xFE11996D6Aull),
-	X(0xFE14AD03F5ull),X(0xFE17BE2794ull),X(0xFE1ACCD840ull),X(0xFE1DD915F1ull),X(0xFE20E2E0A1ull),X(0xFE23EA3847ull),X(0xFE26EF1CDCull),X(0xFE29F18E59ull),
-	X(0xFE2CF18CB7ull),X(0xFE2FEF17EDull),X(0xFE32EA2FF4ull),X(0xFE35E2D4C6ull),X(0xFE38D9065Aull),X(0xFE3BCCC4AAull),X(0xFE3EBE0FADull),X(0xFE41ACE75Eull),
-	X(0xFE44994BB5ull),X(0xFE47833CAAull),X(0xFE4A6ABA36ull),X(0xFE4D4FC452ull),X(0xFE50325AF7ull),X(0xFE53127E1Eull),X(0xFE55F02DC0ull),X(0xFE58CB69D6ull),
-	X(0xFE5BA43258ull),X(0xFE5E7A873Full),X(0xFE614E6886ull),X(0xFE641FD624ull),X(0xFE66EED012ull),X(0xFE69BB564Bull),X(0xFE6C8568C6ull),X(0xFE6F4D077Dull),
-	X(0xFE72123269ull),X(0xFE74D4E983ull),X(0xFE77952CC5ull),X(0xFE7A52FC28ull),X(0xFE7D0E57A4ull),X(0xFE7FC73F34ull),X(0xFE827DB2D0ull),X(0xFE8531B272ull),
-	X(0xFE87E33E12ull),X(0xFE8A9255ACull),X(0xFE8D3EF937ull),X(0xFE8FE928ADull),X(0xFE9290E408ull),X(0xFE95362B41ull),X(0xFE97D8FE51ull),X(0xFE9A795D33ull),
-	X(0xFE9D1747DFull),X(0xFE9FB2BE4Full),X(0xFEA24BC07Dull),X(0xFEA4E24E62ull),X(0xFEA77667F8ull),X(0xFEAA080D39ull),X(0xFEAC973E1Dull),X(0xFEAF23FAA0ull),
-	X(0xFEB1AE42BAull),X(0xFEB4361665ull),X(0xFEB6BB759Cull),X(0xFEB93E6057ull),X(0xFEBBBED691ull),X(0xFEBE3CD844ull),X(0xFEC0B86569ull),X(0xFEC3317DFAull),
-	X(0xFEC5A821F1ull),X(0xFEC81C5148ull),X(0xFECA8E0BF9ull),X(0xFECCFD51FEull),X(0xFECF6A2351ull),X(0xFED1D47FEBull),X(0xFED43C67C8ull),X(0xFED6A1DAE1ull),
-	X(0xFED904D930ull),X(0xFEDB6562AFull),X(0xFEDDC37759ull),X(0xFEE01F1727ull),X(0xFEE2784214ull),X(0xFEE4CEF81Aull),X(0xFEE7233932ull),X(0xFEE9750559ull),
-	X(0xFEEBC45C87ull),X(0xFEEE113EB7ull),X(0xFEF05BABE3ull),X(0xFEF2A3A406ull),X(0xFEF4E9271Aull),X(0xFEF72C3519ull),X(0xFEF96CCDFEull),X(0xFEFBAAF1C4ull),
-	X(0xFEFDE6A064ull),X(0xFF001FD9DAull),X(0xFF02569E1Full),X(0xFF048AED2Eull),X(0xFF06BCC703ull),X(0xFF08EC2B97ull),X(0xFF0B191AE4ull),X(0xFF0D4394E7ull),
-	X(0xFF0F6B9999ull),X(0xFF119128F5ull),X(0xFF13B442F5ull),X(0xFF15D4E795ull),X(0xFF17F316D0ull),X(0xFF1A0ED09Full),X(0xFF1C2814FEull),X(0xFF1E3EE3E7ull),
-	X(0xFF20533D56ull),X(0xFF22652145ull),X(0xFF24748FB0ull),X(0xFF26818890ull),X(0xFF288C0BE2ull),X(0xFF2A9419A0ull),X(0xFF2C99B1C4ull),X(0xFF2E9CD44Bull),
-	X(0xFF309D812Eull),X(0xFF329BB86Aull),X(0xFF349779F9ull),X(0xFF3690C5D6ull),X(0xFF38879BFDull),X(0xFF3A7BFC68ull),X(0xFF3C6DE713ull),X(0xFF3E5D5BF9ull),
-	X(0xFF404A5B15ull),X(0xFF4234E463ull),X(0xFF441CF7DDull),X(0xFF46029580ull),X(0xFF47E5BD45ull),X(0xFF49C66F29ull),X(0xFF4BA4AB28ull),X(0xFF4D80713Bull),
-	X(0xFF4F59C160ull),X(0xFF51309B91ull),X(0xFF5304FFC9ull),X(0xFF54D6EE05ull),X(0xFF56A6663Full),X(0xFF58736874ull),X(0xFF5A3DF49Full),X(0xFF5C060ABAull),
-	X(0xFF5DCBAAC3ull),X(0xFF5F8ED4B5ull),X(0xFF614F888Bull),X(0xFF630DC640ull),X(0xFF64C98DD2ull),X(0xFF6682DF3Bull),X(0xFF6839BA77ull),X(0xFF69EE1F81ull),
-	X(0xFF6BA00E57ull),X(0xFF6D4F86F3ull),X(0xFF6EFC8951ull),X(0xFF70A7156Eull),X(0xFF724F2B45ull),X(0xFF73F4CAD1ull),X(0xFF7597F410ull),X(0xFF7738A6FCull),
-	X(0xFF78D6E393ull),X(0xFF7A72A9CFull),X(0xFF7C0BF9ADull),X(0xFF7DA2D32Aull),X(0xFF7F373640ull),X(0xFF80C922ECull),X(0xFF8258992Bull),X(0xFF83E598F8ull),
-	X(0xFF85702250ull),X(0xFF86F8352Full),X(0xFF887DD190ull),X(0xFF8A00F771ull),X(0xFF8B81A6CEull),X(0xFF8CFFDFA2ull),X(0xFF8E7BA1EBull),X(0xFF8FF4EDA4ull),
-	X(0xFF916BC2C9ull),X(0xFF92E02158ull),X(0xFF9452094Dull),X(0xFF95C17AA4ull),X(0xFF972E7559ull),X(0xFF9898F96Aull),X(0xFF9A0106D2ull),X(0xFF9B669D8Eull),
-	X(0xFF9CC9BD9Aull),X(0xFF9E2A66F4ull),X(0xFF9F889998ull),X(0xFFA0E45582ull),X(0xFFA23D9AAFull),X(0xFFA394691Cull),X(0xFFA4E8C0C5ull),X(0xFFA63AA1A8ull),
-	X(0xFFA78A0BC0ull),X(0xFFA8D6FF0Bull),X(0xFFAA217B86ull),X(0xFFAB69812Dull),X(0xFFACAF0FFDull),X(0xFFADF227F2ull),X(0xFFAF32C90Bull),X(0xFFB070F344ull),
-	X(0xFFB1ACA699ull),X(0xFFB2E5E308ull),X(0xFFB41CA88Dull),X(0xFFB550F727ull),X(0xFFB682CED0ull),X(0xFFB7B22F88ull),X(0xFFB8DF194Aull),X(0xFFBA098C15ull),
-	X(0xFFBB3187E4ull),X(0xFFBC570CB6ull),X(0xFFBD7A1A87ull),X(0xFFBE9AB154ull),X(0xFFBFB8D11Bull),X(0xFFC0D479D9ull),X(0xFFC1EDAB8Cull),X(0xFFC3046630ull),
-	X(0xFFC418A9C3ull),X(0xFFC52A7642ull),X(0xFFC639CBAAull),X(0xFFC746A9FAull),X(0xFFC851112Eull),X(0xFFC9590144ull),X(0xFFCA5E7A39ull),X(0xFFCB617C0Bull),
-	X(0xFFCC6206B7ull),X(0xFFCD601A3Aull),X(0xFFCE5BB693ull),X(0xFFCF54DBBFull),X(0xFFD04B89BCull),X(0xFFD13FC086ull),X(0xFFD231801Dull),X(0xFFD320C87Dull),
-	X(0xFFD40D99A3ull),X(0xFFD4F7F38Full),X(0xFFD5DFD63Dull),X(0xFFD6C541ACull),X(0xFFD7A835D9ull),X(0xFFD888B2C2ull),X(0xFFD966B864ull),X(0xFFDA4246BEull),
-	X(0xFFDB1B5DCEull),X(0xFFDBF1FD91ull),X(0xFFDCC62605ull),X(0xFFDD97D729ull),X(0xFFDE6710FAull),X(0xFFDF33D377ull),X(0xFFDFFE1E9Cull),X(0xFFE0C5F269ull),
-	X(0xFFE18B4EDCull),X(0xFFE24E33F2ull),X(0xFFE30EA1AAull),X(0xFFE3CC9801ull),X(0xFFE48816F7ull),X(0xFFE5411E89ull),X(0xFFE5F7AEB5ull),X(0xFFE6ABC77Aull),
-	X(0xFFE75D68D5ull),X(0xFFE80C92C6ull),X(0xFFE8B9454Bull),X(0xFFE9638061ull),X(0xFFEA0B4407ull),X(0xFFEAB0903Cull),X(0xFFEB5364FEull),X(0xFFEBF3C24Bull),
-	X(0xFFEC91A823ull),X(0xFFED2D1682ull),X(0xFFEDC60D69ull),X(0xFFEE5C8CD5ull),X(0xFFEEF094C4ull),X(0xFFEF822536ull),X(0xFFF0113E2Aull),X(0xFFF09DDF9Dull),
-	X(0xFFF128098Eull),X(0xFFF1AFBBFDull),X(0xFFF234F6E7ull),X(0xFFF2B7BA4Bull),X(0xFFF3380629ull),X(0xFFF3B5DA7Full),X(0xFFF431374Bull),X(0xFFF4AA1C8Dull),
-	X(0xFFF5208A44ull),X(0xFFF594806Dull),X(0xFFF605FF09ull),X(0xFFF6750616ull),X(0xFFF6E19592ull),X(0xFFF74BAD7Eull),X(0xFFF7B34DD7ull),X(0xFFF818769Eull),
-	X(0xFFF87B27D0ull),X(0xFFF8DB616Dull),X(0xFFF9392374ull),X(0xFFF9946DE5ull),X(0xFFF9ED40BDull),X(0xFFFA439BFDull),X(0xFFFA977FA4ull),X(0xFFFAE8EBB0ull),
-	X(0xFFFB37E021ull),X(0xFFFB845CF7ull),X(0xFFFBCE6230ull),X(0xFFFC15EFCBull),X(0xFFFC5B05C9ull),X(0xFFFC9DA428ull),X(0xFFFCDDCAE8ull),X(0xFFFD1B7A08ull),
-	X(0xFFFD56B188ull),X(0xFFFD8F7166ull),X(0xFFFDC5B9A3ull),X(0xFFFDF98A3Eull),X(0xFFFE2AE336ull),X(0xFFFE59C48Bull),X(0xFFFE862E3Dull),X(0xFFFEB0204Bull),
-	X(0xFFFED79AB4ull),X(0xFFFEFC9D79ull),X(0xFFFF1F2898ull),X(0xFFFF3F3C12ull),X(0xFFFF5CD7E6ull),X(0xFFFF77FC15ull),X(0xFFFF90A89Dull),X(0xFFFFA6DD7Eull),
+#else
+# define FOURIER_SINTABLE_VALUES_2048(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 4096
+# define FOURIER_SINTABLE_VALUES_4096(X) \
+	X(0x000C90FDA8ull),X(0x0025B2F8DBull),X(0x003ED4F3B1ull),X(0x0057F6EDEBull),X(0x007118E74Dull),X(0x008A3ADF97ull),X(0x00A35CD68Dull),X(0x00BC7ECBEFull), \
+	X(0x00D5A0BF81ull),X(0x00EEC2B103ull),X(0x0107E4A038ull),X(0x0121068CE2ull),X(0x013A2876C2ull),X(0x01534A5D9Cull),X(0x016C6C4131ull),X(0x01858E2142ull), \
+	X(0x019EAFFD92ull),X(0x01B7D1D5E3ull),X(0x01D0F3A9F7ull),X(0x01EA15798Full),X(0x020337446Eull),X(0x021C590A56ull),X(0x02357ACB09ull),X(0x024E9C8648ull), \
+	X(0x0267BE3BD7ull),X(0x0280DFEB76ull),X(0x029A0194E7ull),X(0x02B32337EDull),X(0x02CC44D44Aull),X(0x02E56669C0ull),X(0x02FE87F810ull),X(0x0317A97EFDull), \
+	X(0x0330CAFE49ull),X(0x0349EC75B5ull),X(0x03630DE504ull),X(0x037C2F4BF8ull),X(0x039550AA52ull),X(0x03AE71FFD5ull),X(0x03C7934C42ull),X(0x03E0B48F5Cull), \
+	X(0x03F9D5C8E5ull),X(0x0412F6F89Eull),X(0x042C181E4Aull),X(0x04453939AAull),X(0x045E5A4A81ull),X(0x04777B5091ull),X(0x04909C4B9Bull),X(0x04A9BD3B62ull), \
+	X(0x04C2DE1FA7ull),X(0x04DBFEF82Dull),X(0x04F51FC4B5ull),X(0x050E408502ull),X(0x05276138D5ull),X(0x054081DFF1ull),X(0x0559A27A18ull),X(0x0572C3070Bull), \
+	X(0x058BE3868Dull),X(0x05A503F85Full),X(0x05BE245C44ull),X(0x05D744B1FEull),X(0x05F064F94Eull),X(0x06098531F6ull),X(0x0622A55BB9ull),X(0x063BC57659ull), \
+	X(0x0654E58197ull),X(0x066E057D36ull),X(0x06872568F8ull),X(0x06A045449Eull),X(0x06B9650FEBull),X(0x06D284CAA0ull),X(0x06EBA47480ull),X(0x0704C40D4Dull), \
+	X(0x071DE394C8ull),X(0x0737030AB4ull),X(0x0750226ED3ull),X(0x076941C0E7ull),X(0x07826100B1ull),X(0x079B802DF4ull),X(0x07B49F4871ull),X(0x07CDBE4FEBull), \
+	X(0x07E6DD4424ull),X(0x07FFFC24DEull),X(0x08191AF1DBull),X(0x083239AADCull),X(0x084B584FA5ull),X(0x086476DFF6ull),X(0x087D955B92ull),X(0x0896B3C23Bull), \
+	X(0x08AFD213B3ull),X(0x08C8F04FBCull),X(0x08E20E7617ull),X(0x08FB2C8688ull),X(0x09144A80D0ull),X(0x092D6864B1ull),X(0x09468631EDull),X(0x095FA3E846ull), \
+	X(0x0978C1877Eull),X(0x0991DF0F57ull),X(0x09AAFC7F93ull),X(0x09C419D7F5ull),X(0x09DD37183Eull),X(0x09F6544030ull),X(0x0A0F714F8Eull),X(0x0A288E4619ull), \
+	X(0x0A41AB2393ull),X(0x0A5AC7E7BFull),X(0x0A73E4925Eull),X(0x0A8D012332ull),X(0x0AA61D99FEull),X(0x0ABF39F684ull),X(0x0AD8563886ull),X(0x0AF1725FC5ull), \
+	X(0x0B0A8E6C03ull),X(0x0B23AA5D04ull),X(0x0B3CC63288ull),X(0x0B55E1EC52ull),X(0x0B6EFD8A24ull),X(0x0B88190BC0ull),X(0x0BA13470E8ull),X(0x0BBA4FB95Eull), \
+	X(0x0BD36AE4E4ull),X(0x0BEC85F33Dull),X(0x0C05A0E429ull),X(0x0C1EBBB76Cull),X(0x0C37D66CC7ull),X(0x0C50F103FCull),X(0x0C6A0B7CCEull),X(0x0C8325D6FEull), \
+	X(0x0C9C40124Full),X(0x0CB55A2E83ull),X(0x0CCE742B5Bull),X(0x0CE78E089Aull),X(0x0D00A7C601ull),X(0x0D19C16354ull),X(0x0D32DAE053ull),X(0x0D4BF43CC2ull), \
+	X(0x0D650D7861ull),X(0x0D7E2692F4ull),X(0x0D973F8C3Cull),X(0x0DB05863FBull),X(0x0DC97119F4ull),X(0x0DE289ADE8ull),X(0x0DFBA21F9Aull),X(0x0E14BA6ECBull), \
+	X(0x0E2DD29B3Eull),X(0x0E46EAA4B4ull),X(0x0E60028AF1ull),X(0x0E791A4DB5ull),X(0x0E9231ECC4ull),X(0x0EAB4967DFull),X(0x0EC460BEC7ull),X(0x0EDD77F140ull), \
+	X(0x0EF68EFF0Cull),X(0x0F0FA5E7ECull),X(0x0F28BCABA2ull),X(0x0F41D349F2ull),X(0x0F5AE9C29Cull),X(0x0F74001562ull),X(0x0F8D164208ull),X(0x0FA62C484Full), \
+	X(0x0FBF4227F9ull),X(0x0FD857E0C8ull),X(0x0FF16D727Full),X(0x100A82DCDFull),X(0x1023981FABull),X(0x103CAD3AA4ull),X(0x1055C22D8Eull),X(0x106ED6F829ull), \
+	X(0x1087EB9A38ull),X(0x10A100137Dull),X(0x10BA1463BBull),X(0x10D3288AB3ull),X(0x10EC3C8827ull),X(0x1105505BDBull),X(0x111E64058Full),X(0x1137778505ull), \
+	X(0x11508ADA01ull),X(0x11699E0444ull),X(0x1182B10390ull),X(0x119BC3D7A8ull),X(0x11B4D6804Dull),X(0x11CDE8FD42ull),X(0x11E6FB4E49ull),X(0x12000D7323ull), \
+	X(0x12191F6B94ull),X(0x123231375Dull),X(0x124B42D640ull),X(0x1264544800ull),X(0x127D658C5Eull),X(0x129676A31Eull),X(0x12AF878C00ull),X(0x12C89846C7ull), \
+	X(0x12E1A8D336ull),X(0x12FAB9310Eull),X(0x1313C96012ull),X(0x132CD96003ull),X(0x1345E930A4ull),X(0x135EF8D1B8ull),X(0x13780842FFull),X(0x139117843Dull), \
+	X(0x13AA269534ull),X(0x13C33575A5ull),X(0x13DC442553ull),X(0x13F552A400ull),X(0x140E60F16Full),X(0x14276F0D61ull),X(0x14407CF798ull),X(0x14598AAFD7ull), \
+	X(0x14729835E1ull),X(0x148BA58976ull),X(0x14A4B2AA5Aull),X(0x14BDBF984Eull),X(0x14D6CC5315ull),X(0x14EFD8DA71ull),X(0x1508E52E24ull),X(0x1521F14DF0ull), \
+	X(0x153AFD3998ull),X(0x155408F0DEull),X(0x156D147383ull),X(0x15861FC14Bull),X(0x159F2AD9F7ull),X(0x15B835BD49ull),X(0x15D1406B04ull),X(0x15EA4AE2EAull), \
+	X(0x16035524BEull),X(0x161C5F3040ull),X(0x1635690534ull),X(0x164E72A35Cull),X(0x16677C0A7Aull),X(0x1680853A51ull),X(0x16998E32A1ull),X(0x16B296F32Full), \
+	X(0x16CB9F7BBBull),X(0x16E4A7CC09ull),X(0x16FDAFE3DAull),X(0x1716B7C2F1ull),X(0x172FBF690Full),X(0x1748C6D5F8ull),X(0x1761CE096Dull),X(0x177AD50331ull), \
+	X(0x1793DBC305ull),X(0x17ACE248ADull),X(0x17C5E893EAull),X(0x17DEEEA47Full),X(0x17F7F47A2Dull),X(0x1810FA14B8ull),X(0x1829FF73E1ull),X(0x184304976Bull), \
+	X(0x185C097F18ull),X(0x18750E2AA9ull),X(0x188E1299E3ull),X(0x18A716CC86ull),X(0x18C01AC255ull),X(0x18D91E7B12ull),X(0x18F221F680ull),X(0x190B253461ull), \
+	X(0x1924283477ull),X(0x193D2AF684ull),X(0x19562D7A4Bull),X(0x196F2FBF8Eull),X(0x198831C610ull),X(0x19A1338D92ull),X(0x19BA3515D6ull),X(0x19D3365EA0ull), \
+	X(0x19EC3767B2ull),X(0x1A053830CDull),X(0x1A1E38B9B5ull),X(0x1A3739022Aull),X(0x1A503909F1ull),X(0x1A6938D0CAull),X(0x1A82385679ull),X(0x1A9B379AC0ull), \
+	X(0x1AB4369D61ull),X(0x1ACD355E1Dull),X(0x1AE633DCB9ull),X(0x1AFF3218F5ull),X(0x1B18301295ull),X(0x1B312DC95Bull),X(0x1B4A2B3D08ull),X(0x1B63286D60ull), \
+	X(0x1B7C255A24ull),X(0x1B95220318ull),X(0x1BAE1E67FDull),X(0x1BC71A8895ull),X(0x1BE01664A4ull),X(0x1BF911FBEBull),X(0x1C120D4E2Cull),X(0x1C2B085B2Bull), \
+	X(0x1C440322AAull),X(0x1C5CFDA46Aull),X(0x1C75F7E02Eull),X(0x1C8EF1D5B9ull),X(0x1CA7EB84CDull),X(0x1CC0E4ED2Cull),X(0x1CD9DE0E99ull),X(0x1CF2D6E8D7ull), \
+	X(0x1D0BCF7BA6ull),X(0x1D24C7C6CBull),X(0x1D3DBFCA07ull),X(0x1D56B7851Cull),X(0x1D6FAEF7CDull),X(0x1D88A621DDull),X(0x1DA19D030Eull),X(0x1DBA939B22ull), \
+	X(0x1DD389E9DCull),X(0x1DEC7FEEFEull),X(0x1E0575AA4Aull),X(0x1E1E6B1B83ull),X(0x1E3760426Bull),X(0x1E50551EC5ull),X(0x1E6949B054ull),X(0x1E823DF6D9ull), \
+	X(0x1E9B31F216ull),X(0x1EB425A1D0ull),X(0x1ECD1905C7ull),X(0x1EE60C1DBEull),X(0x1EFEFEE978ull),X(0x1F17F168B8ull),X(0x1F30E39B3Full),X(0x1F49D580D0ull), \
+	X(0x1F62C7192Dull),X(0x1F7BB8641Aull),X(0x1F94A96158ull),X(0x1FAD9A10AAull),X(0x1FC68A71D2ull),X(0x1FDF7A8493ull),X(0x1FF86A48B0ull),X(0x201159BDEAull), \
+	X(0x202A48E404ull),X(0x204337BAC1ull),X(0x205C2641E4ull),X(0x207514792Eull),X(0x208E026062ull),X(0x20A6EFF743ull),X(0x20BFDD3D93ull),X(0x20D8CA3314ull), \
+	X(0x20F1B6D78Aull),X(0x210AA32AB6ull),X(0x21238F2C5Cull),X(0x213C7ADC3Dull),X(0x2155663A1Dull),X(0x216E5145BDull),X(0x21873BFEE0ull),X(0x21A0266549ull), \
+	X(0x21B91078BAull),X(0x21D1FA38F6ull),X(0x21EAE3A5BFull),X(0x2203CCBED8ull),X(0x221CB58404ull),X(0x22359DF504ull),X(0x224E86119Cull),X(0x22676DD98Eull), \
+	X(0x2280554C9Cull),X(0x22993C6A8Aull),X(0x22B2233319ull),X(0x22CB09A60Cull),X(0x22E3EFC326ull),X(0x22FCD58A2Aull),X(0x2315BAFAD9ull),X(0x232EA014F7ull), \
+	X(0x234784D845ull),X(0x2360694488ull),X(0x23794D5981ull),X(0x23923116F2ull),X(0x23AB147C9Full),X(0x23C3F78A49ull),X(0x23DCDA3FB5ull),X(0x23F5BC9CA3ull), \
+	X(0x240E9EA0D7ull),X(0x2427804C14ull),X(0x2440619E1Cull),X(0x24594296B1ull),X(0x2472233596ull),X(0x248B037A8Eull),X(0x24A3E3655Cull),X(0x24BCC2F5C1ull), \
+	X(0x24D5A22B82ull),X(0x24EE81065Full),X(0x25075F861Dull),X(0x25203DAA7Dull),X(0x25391B7342ull),X(0x2551F8E02Full),X(0x256AD5F107ull),X(0x2583B2A58Cull), \
+	X(0x259C8EFD81ull),X(0x25B56AF8A8ull),X(0x25CE4696C4ull),X(0x25E721D799ull),X(0x25FFFCBAE7ull),X(0x2618D74073ull),X(0x2631B167FFull),X(0x264A8B314Dull), \
+	X(0x2663649C20ull),X(0x267C3DA83Bull),X(0x2695165561ull),X(0x26ADEEA354ull),X(0x26C6C691D7ull),X(0x26DF9E20ADull),X(0x26F8754F98ull),X(0x27114C1E5Bull), \
+	X(0x272A228CB9ull),X(0x2742F89A75ull),X(0x275BCE4750ull),X(0x2774A3930Full),X(0x278D787D73ull),X(0x27A64D0640ull),X(0x27BF212D37ull),X(0x27D7F4F21Dull), \
+	X(0x27F0C854B3ull),X(0x28099B54BDull),X(0x28226DF1FDull),X(0x283B402C36ull),X(0x285412032Aull),X(0x286CE3769Cull),X(0x2885B48650ull),X(0x289E853208ull), \
+	X(0x28B7557986ull),X(0x28D0255C8Eull),X(0x28E8F4DAE2ull),X(0x2901C3F445ull),X(0x291A92A87Aull),X(0x293360F743ull),X(0x294C2EE064ull),X(0x2964FC639Full), \
+	X(0x297DC980B7ull),X(0x299696376Full),X(0x29AF628789ull),X(0x29C82E70C9ull),X(0x29E0F9F2F1ull),X(0x29F9C50DC4ull),X(0x2A128FC105ull),X(0x2A2B5A0C77ull), \
+	X(0x2A4423EFDCull),X(0x2A5CED6AF8ull),X(0x2A75B67D8Dull),X(0x2A8E7F275Eull),X(0x2AA747682Dull),X(0x2AC00F3FBFull),X(0x2AD8D6ADD5ull),X(0x2AF19DB233ull), \
+	X(0x2B0A644C9Bull),X(0x2B232A7CD0ull),X(0x2B3BF04295ull),X(0x2B54B59DADull),X(0x2B6D7A8DDBull),X(0x2B863F12E2ull),X(0x2B9F032C84ull),X(0x2BB7C6DA85ull), \
+	X(0x2BD08A1CA7ull),X(0x2BE94CF2AEull),X(0x2C020F5C5Cull),X(0x2C1AD15974ull),X(0x2C3392E9B9ull),X(0x2C4C540CEDull),X(0x2C6514C2D5ull),X(0x2C7DD50B33ull), \
+	X(0x2C9694E5C9ull),X(0x2CAF54525Bull),X(0x2CC81350ABull),X(0x2CE0D1E07Dull),X(0x2CF9900194ull),X(0x2D124DB3B2ull),X(0x2D2B0AF69Aull),X(0x2D43C7CA0Full), \
+	X(0x2D5C842DD5ull),X(0x2D754021AEull),X(0x2D8DFBA55Eull),X(0x2DA6B6B8A6ull),X(0x2DBF715B4Bull),X(0x2DD82B8D0Full),X(0x2DF0E54DB5ull),X(0x2E099E9D01ull), \
+	X(0x2E22577AB4ull),X(0x2E3B0FE693ull),X(0x2E53C7E05Full),X(0x2E6C7F67DDull),X(0x2E85367CCFull),X(0x2E9DED1EF8ull),X(0x2EB6A34E1Cull),X(0x2ECF5909FDull), \
+	X(0x2EE80E525Eull),X(0x2F00C32702ull),X(0x2F197787ADull),X(0x2F322B7421ull),X(0x2F4ADEEC21ull),X(0x2F6391EF71ull),X(0x2F7C447DD4ull),X(0x2F94F6970Cull), \
+	X(0x2FADA83ADDull),X(0x2FC6596909ull),X(0x2FDF0A2155ull),X(0x2FF7BA6382ull),X(0x30106A2F54ull),X(0x302919848Full),X(0x3041C862F4ull),X(0x305A76CA48ull), \
+	X(0x307324BA4Dull),X(0x308BD232C7ull),X(0x30A47F3378ull),X(0x30BD2BBC24ull),X(0x30D5D7CC8Eull),X(0x30EE836478ull),X(0x31072E83A7ull),X(0x311FD929DDull), \
+	X(0x31388356DDull),X(0x31512D0A6Bull),X(0x3169D64449ull),X(0x31827F043Cull),X(0x319B274A05ull),X(0x31B3CF1568ull),X(0x31CC766628ull),X(0x31E51D3C09ull), \
+	X(0x31FDC396CEull),X(0x3216697639ull),X(0x322F0EDA0Eull),X(0x3247B3C211ull),X(0x3260582E03ull),X(0x3278FC1DAAull),X(0x32919F90C7ull),X(0x32AA42871Eull), \
+	X(0x32C2E50072ull),X(0x32DB86FC86ull),X(0x32F4287B1Eull),X(0x330CC97BFDull),X(0x332569FEE6ull),X(0x333E0A039Dull),X(0x3356A989E4ull),X(0x336F48917Eull), \
+	X(0x3387E71A30ull),X(0x33A08523BCull),X(0x33B922ADE5ull),X(0x33D1BFB870ull),X(0x33EA5C431Eull),X(0x3402F84DB4ull),X(0x341B93D7F4ull),X(0x34342EE1A3ull), \
+	X(0x344CC96A82ull),X(0x3465637256ull),X(0x347DFCF8E2ull),X(0x349695FDE9ull),X(0x34AF2E812Eull),X(0x34C7C68275ull),X(0x34E05E0181ull),X(0x34F8F4FE15ull), \
+	X(0x35118B77F5ull),X(0x352A216EE4ull),X(0x3542B6E2A6ull),X(0x355B4BD2FDull),X(0x3573E03FADull),X(0x358C742879ull),X(0x35A5078D26ull),X(0x35BD9A6D75ull), \
+	X(0x35D62CC92Bull),X(0x35EEBEA00Bull),X(0x36074FF1D8ull),X(0x361FE0BE55ull),X(0x3638710547ull),X(0x365100C66Full),X(0x3669900193ull),X(0x36821EB675ull), \
+	X(0x369AACE4D8ull),X(0x36B33A8C81ull),X(0x36CBC7AD32ull),X(0x36E45446AEull),X(0x36FCE058BAull),X(0x37156BE319ull),X(0x372DF6E58Eull),X(0x3746815FDCull), \
+	X(0x375F0B51C8ull),X(0x377794BB14ull),X(0x37901D9B84ull),X(0x37A8A5F2DBull),X(0x37C12DC0DDull),X(0x37D9B5054Dull),X(0x37F23BBFF0ull),X(0x380AC1F087ull), \
+	X(0x38234796D8ull),X(0x383BCCB2A4ull),X(0x38545143B1ull),X(0x386CD549C1ull),X(0x388558C497ull),X(0x389DDBB3F8ull),X(0x38B65E17A7ull),X(0x38CEDFEF67ull), \
+	X(0x38E7613AFCull),X(0x38FFE1FA29ull),X(0x3918622CB3ull),X(0x3930E1D25Bull),X(0x394960EAE7ull),X(0x3961DF761Aull),X(0x397A5D73B7ull),X(0x3992DAE381ull), \
+	X(0x39AB57C53Dull),X(0x39C3D418AEull),X(0x39DC4FDD97ull),X(0x39F4CB13BDull),X(0x3A0D45BAE2ull),X(0x3A25BFD2CAull),X(0x3A3E395B39ull),X(0x3A56B253F3ull), \
+	X(0x3A6F2ABCBBull),X(0x3A87A29554ull),X(0x3AA019DD83ull),X(0x3AB890950Bull),X(0x3AD106BBB0ull),X(0x3AE97C5135ull),X(0x3B01F1555Eull),X(0x3B1A65C7EEull), \
+	X(0x3B32D9A8A9ull),X(0x3B4B4CF754ull),X(0x3B63BFB3B1ull),X(0x3B7C31DD84ull),X(0x3B94A37492ull),X(0x3BAD14789Dull),X(0x3BC584E969ull),X(0x3BDDF4C6BAull), \
+	X(0x3BF6641054ull),X(0x3C0ED2C5FAull),X(0x3C2740E771ull),X(0x3C3FAE747Bull),X(0x3C581B6CDDull),X(0x3C7087D05Aull),X(0x3C88F39EB7ull),X(0x3CA15ED7B6ull), \
+	X(0x3CB9C97B1Cull),X(0x3CD23388ACull),X(0x3CEA9D002Aull),X(0x3D0305E15Aull),X(0x3D1B6E2BFFull),X(0x3D33D5DFDEull),X(0x3D4C3CFCBAull),X(0x3D64A38257ull), \
+	X(0x3D7D097079ull),X(0x3D956EC6E3ull),X(0x3DADD3855Aull),X(0x3DC637ABA1ull),X(0x3DDE9B397Cull),X(0x3DF6FE2EAEull),X(0x3E0F608AFDull),X(0x3E27C24E2Aull), \
+	X(0x3E402377FBull),X(0x3E58840834ull),X(0x3E70E3FE97ull),X(0x3E89435AE9ull),X(0x3EA1A21CEEull),X(0x3EBA004469ull),X(0x3ED25DD11Full),X(0x3EEABAC2D3ull), \
+	X(0x3F0317194Aull),X(0x3F1B72D446ull),X(0x3F33CDF38Dull),X(0x3F4C2876E1ull),X(0x3F64825E08ull),X(0x3F7CDBA8C4ull),X(0x3F953456DAull),X(0x3FAD8C680Dull), \
+	X(0x3FC5E3DC22ull),X(0x3FDE3AB2DDull),X(0x3FF690EC01ull),X(0x400EE68752ull),X(0x40273B8495ull),X(0x403F8FE38Cull),X(0x4057E3A3FEull),X(0x407036C5ACull), \
+	X(0x408889485Cull),X(0x40A0DB2BD1ull),X(0x40B92C6FCFull),X(0x40D17D141Aull),X(0x40E9CD1876ull),X(0x41021C7CA8ull),X(0x411A6B4073ull),X(0x4132B9639Bull), \
+	X(0x414B06E5E5ull),X(0x416353C713ull),X(0x417BA006ECull),X(0x4193EBA531ull),X(0x41AC36A1A8ull),X(0x41C480FC15ull),X(0x41DCCAB43Bull),X(0x41F513C9DFull), \
+	X(0x420D5C3CC4ull),X(0x4225A40CB0ull),X(0x423DEB3965ull),X(0x425631C2A8ull),X(0x426E77A83Eull),X(0x4286BCE9EAull),X(0x429F018770ull),X(0x42B7458094ull), \
+	X(0x42CF88D51Bull),X(0x42E7CB84C9ull),X(0x43000D8F61ull),X(0x43184EF4A9ull),X(0x43308FB464ull),X(0x4348CFCE56ull),X(0x43610F4244ull),X(0x43794E0FF1ull), \
+	X(0x43918C3722ull),X(0x43A9C9B79Bull),X(0x43C2069120ull),X(0x43DA42C376ull),X(0x43F27E4E60ull),X(0x440AB931A3ull),X(0x4422F36D04ull),X(0x443B2D0045ull), \
+	X(0x445365EB2Cull),X(0x446B9E2D7Cull),X(0x4483D5C6FBull),X(0x449C0CB76Bull),X(0x44B442FE93ull),X(0x44CC789C34ull),X(0x44E4AD9015ull),X(0x44FCE1D9F9ull), \
+	X(0x45151579A5ull),X(0x452D486EDCull),X(0x45457AB964ull),X(0x455DAC58FFull),X(0x4575DD4D74ull),X(0x458E0D9686ull),X(0x45A63D33F8ull),X(0x45BE6C2591ull), \
+	X(0x45D69A6B14ull),X(0x45EEC80444ull),X(0x4606F4F0E8ull),X(0x461F2130C2ull),X(0x46374CC398ull),X(0x464F77A92Eull),X(0x4667A1E148ull),X(0x467FCB6BAAull), \
+	X(0x4697F44819ull),X(0x46B01C7659ull),X(0x46C843F62Full),X(0x46E06AC75Full),X(0x46F890E9ADull),X(0x4710B65CDEull),X(0x4728DB20B7ull),X(0x4740FF34FBull), \
+	X(0x475922996Full),X(0x4771454DD8ull),X(0x47896751FAull),X(0x47A188A59Aull),X(0x47B9A9487Bull),X(0x47D1C93A63ull),X(0x47E9E87B16ull),X(0x4802070A58ull), \
+	X(0x481A24E7EEull),X(0x483242139Cull),X(0x484A5E8D27ull),X(0x48627A5454ull),X(0x487A9568E6ull),X(0x4892AFCAA3ull),X(0x48AAC9794Full),X(0x48C2E274AEull), \
+	X(0x48DAFABC85ull),X(0x48F3125099ull),X(0x490B2930AEull),X(0x49233F5C89ull),X(0x493B54D3EDull),X(0x49536996A1ull),X(0x496B7DA468ull),X(0x498390FD07ull), \
+	X(0x499BA3A042ull),X(0x49B3B58DDFull),X(0x49CBC6C5A2ull),X(0x49E3D7474Full),X(0x49FBE712ABull),X(0x4A13F6277Aull),X(0x4A2C048582ull),X(0x4A44122C87ull), \
+	X(0x4A5C1F1C4Eull),X(0x4A742B549Aull),X(0x4A8C36D532ull),X(0x4AA4419DD9ull),X(0x4ABC4BAE55ull),X(0x4AD4550669ull),X(0x4AEC5DA5DCull),X(0x4B04658C70ull), \
+	X(0x4B1C6CB9ECull),X(0x4B34732E13ull),X(0x4B4C78E8ABull),X(0x4B647DE978ull),X(0x4B7C82303Eull),X(0x4B9485BCC4ull),X(0x4BAC888ECDull),X(0x4BC48AA61Eull), \
+	X(0x4BDC8C027Dull),X(0x4BF48CA3ACull),X(0x4C0C8C8973ull),X(0x4C248BB395ull),X(0x4C3C8A21D6ull),X(0x4C5487D3FDull),X(0x4C6C84C9CDull),X(0x4C8481030Cull), \
+	X(0x4C9C7C7F7Eull),X(0x4CB4773EE8ull),X(0x4CCC714110ull),X(0x4CE46A85B9ull),X(0x4CFC630CA8ull),X(0x4D145AD5A3ull),X(0x4D2C51E06Full),X(0x4D44482CD0ull), \
+	X(0x4D5C3DBA8Bull),X(0x4D74328964ull),X(0x4D8C269922ull),X(0x4DA419E989ull),X(0x4DBC0C7A5Dull),X(0x4DD3FE4B64ull),X(0x4DEBEF5C62ull),X(0x4E03DFAD1Dull), \
+	X(0x4E1BCF3D59ull),X(0x4E33BE0CDBull),X(0x4E4BAC1B69ull),X(0x4E639968C7ull),X(0x4E7B85F4BAull),X(0x4E9371BF07ull),X(0x4EAB5CC774ull),X(0x4EC3470DC4ull), \
+	X(0x4EDB3091BEull),X(0x4EF3195326ull),X(0x4F0B0151C1ull),X(0x4F22E88D54ull),X(0x4F3ACF05A4ull),X(0x4F52B4BA76ull),X(0x4F6A99AB90ull),X(0x4F827DD8B5ull), \
+	X(0x4F9A6141ADull),X(0x4FB243E63Aull),X(0x4FCA25C623ull),X(0x4FE206E12Cull),X(0x4FF9E7371Bull),X(0x5011C6C7B5ull),X(0x5029A592BEull),X(0x50418397FDull), \
+	X(0x505960D735ull),X(0x50713D502Cull),X(0x50891902A8ull),X(0x50A0F3EE6Dull),X(0x50B8CE1340ull),X(0x50D0A770E7ull),X(0x50E8800727ull),X(0x510057D5C5ull), \
+	X(0x51182EDC86ull),X(0x5130051B2Full),X(0x5147DA9185ull),X(0x515FAF3F4Full),X(0x5177832450ull),X(0x518F56404Eull),X(0x51A728930Full),X(0x51BEFA1C57ull), \
+	X(0x51D6CADBECull),X(0x51EE9AD193ull),X(0x520669FD11ull),X(0x521E385E2Cull),X(0x523605F4A8ull),X(0x524DD2C04Cull),X(0x52659EC0DBull),X(0x527D69F61Dull), \
+	X(0x5295345FD5ull),X(0x52ACFDFDC9ull),X(0x52C4C6CFBFull),X(0x52DC8ED57Cull),X(0x52F4560EC4ull),X(0x530C1C7B5Eull),X(0x5323E21B0Full),X(0x533BA6ED9Cull), \
+	X(0x53536AF2CBull),X(0x536B2E2A60ull),X(0x5382F09422ull),X(0x539AB22FD5ull),X(0x53B272FD3Full),X(0x53CA32FC26ull),X(0x53E1F22C4Eull),X(0x53F9B08D7Dull), \
+	X(0x54116E1F79ull),X(0x54292AE207ull),X(0x5440E6D4EDull),X(0x5458A1F7EFull),X(0x54705C4AD3ull),X(0x548815CD60ull),X(0x549FCE7F59ull),X(0x54B7866086ull), \
+	X(0x54CF3D70AAull),X(0x54E6F3AF8Cull),X(0x54FEA91CF1ull),X(0x55165DB89Full),X(0x552E11825Bull),X(0x5545C479EBull),X(0x555D769F14ull),X(0x557527F19Cull), \
+	X(0x558CD87148ull),X(0x55A4881DDEull),X(0x55BC36F723ull),X(0x55D3E4FCDDull),X(0x55EB922ED2ull),X(0x56033E8CC7ull),X(0x561AEA1681ull),X(0x563294CBC7ull), \
+	X(0x564A3EAC5Eull),X(0x5661E7B80Bull),X(0x56798FEE94ull),X(0x5691374FBFull),X(0x56A8DDDB52ull),X(0x56C0839111ull),X(0x56D82870C4ull),X(0x56EFCC7A2Eull), \
+	X(0x57076FAD17ull),X(0x571F120943ull),X(0x5736B38E79ull),X(0x574E543C7Dull),X(0x5765F41317ull),X(0x577D93120Bull),X(0x579531391Full),X(0x57ACCE8819ull), \
+	X(0x57C46AFEBFull),X(0x57DC069CD6ull),X(0x57F3A16224ull),X(0x580B3B4E6Full),X(0x5822D4617Dull),X(0x583A6C9B14ull),X(0x585203FAF8ull),X(0x58699A80F1ull), \
+	X(0x5881302CC3ull),X(0x5898C4FE35ull),X(0x58B058F50Dull),X(0x58C7EC1110ull),X(0x58DF7E5204ull),X(0x58F70FB7AEull),X(0x590EA041D6ull),X(0x59262FF040ull), \
+	X(0x593DBEC2B3ull),X(0x59554CB8F4ull),X(0x596CD9D2C9ull),X(0x5984660FF9ull),X(0x599BF17049ull),X(0x59B37BF37Eull),X(0x59CB059960ull),X(0x59E28E61B3ull), \
+	X(0x59FA164C3Eull),X(0x5A119D58C7ull),X(0x5A29238713ull),X(0x5A40A8D6E9ull),X(0x5A582D480Eull),X(0x5A6FB0DA49ull),X(0x5A87338D5Full),X(0x5A9EB56117ull), \
+	X(0x5AB6365536ull),X(0x5ACDB66983ull),X(0x5AE5359DC4ull),X(0x5AFCB3F1BDull),X(0x5B14316537ull),X(0x5B2BADF7F6ull),X(0x5B4329A9C1ull),X(0x5B5AA47A5Dull), \
+	X(0x5B721E6991ull),X(0x5B89977723ull),X(0x5BA10FA2D9ull),X(0x5BB886EC79ull),X(0x5BCFFD53C9ull),X(0x5BE772D88Full),X(0x5BFEE77A92ull),X(0x5C165B3997ull), \
+	X(0x5C2DCE1565ull),X(0x5C45400DC1ull),X(0x5C5CB12273ull),X(0x5C7421533Full),X(0x5C8B909FEDull),X(0x5CA2FF0842ull),X(0x5CBA6C8C05ull),X(0x5CD1D92AFBull), \
+	X(0x5CE944E4ECull),X(0x5D00AFB99Cull),X(0x5D1819A8D3ull),X(0x5D2F82B257ull),X(0x5D46EAD5EEull),X(0x5D5E52135Dull),X(0x5D75B86A6Dull),X(0x5D8D1DDAE1ull), \
+	X(0x5DA4826482ull),X(0x5DBBE60715ull),X(0x5DD348C260ull),X(0x5DEAAA962Bull),X(0x5E020B823Aull),X(0x5E196B8655ull),X(0x5E30CAA241ull),X(0x5E4828D5C6ull), \
+	X(0x5E5F8620A9ull),X(0x5E76E282B0ull),X(0x5E8E3DFBA3ull),X(0x5EA5988B48ull),X(0x5EBCF23164ull),X(0x5ED44AEDBEull),X(0x5EEBA2C01Dull),X(0x5F02F9A847ull), \
+	X(0x5F1A4FA603ull),X(0x5F31A4B917ull),X(0x5F48F8E148ull),X(0x5F604C1E5Full),X(0x5F779E7021ull),X(0x5F8EEFD654ull),X(0x5FA64050C0ull),X(0x5FBD8FDF2Aull), \
+	X(0x5FD4DE8159ull),X(0x5FEC2C3714ull),X(0x6003790021ull),X(0x601AC4DC46ull),X(0x60320FCB4Bull),X(0x604959CCF5ull),X(0x6060A2E10Bull),X(0x6077EB0755ull), \
+	X(0x608F323F97ull),X(0x60A6788999ull),X(0x60BDBDE522ull),X(0x60D50251F7ull),X(0x60EC45CFE0ull),X(0x6103885EA4ull),X(0x611AC9FE08ull),X(0x61320AADD3ull), \
+	X(0x61494A6DCDull),X(0x6160893DBBull),X(0x6177C71D64ull),X(0x618F040C90ull),X(0x61A6400B04ull),X(0x61BD7B1887ull),X(0x61D4B534E0ull),X(0x61EBEE5FD6ull), \
+	X(0x6203269930ull),X(0x621A5DE0B3ull),X(0x6231943627ull),X(0x6248C99953ull),X(0x625FFE09FDull),X(0x62773187ECull),X(0x628E6412E6ull),X(0x62A595AAB4ull), \
+	X(0x62BCC64F1Aull),X(0x62D3F5FFE1ull),X(0x62EB24BCCEull),X(0x63025285A9ull),X(0x63197F5A38ull),X(0x6330AB3A43ull),X(0x6347D62590ull),X(0x635F001BE6ull), \
+	X(0x6376291D0Bull),X(0x638D5128C7ull),X(0x63A4783EE1ull),X(0x63BB9E5F1Full),X(0x63D2C38949ull),X(0x63E9E7BD24ull),X(0x64010AFA79ull),X(0x64182D410Dull), \
+	X(0x642F4E90A8ull),X(0x64466EE912ull),X(0x645D8E4A10ull),X(0x6474ACB369ull),X(0x648BCA24E5ull),X(0x64A2E69E4Bull),X(0x64BA021F62ull),X(0x64D11CA7F0ull), \
+	X(0x64E83637BCull),X(0x64FF4ECE8Full),X(0x6516666C2Dull),X(0x652D7D1060ull),X(0x654492BAEDull),X(0x655BA76B9Bull),X(0x6572BB2233ull),X(0x6589CDDE7Aull), \
+	X(0x65A0DFA038ull),X(0x65B7F06734ull),X(0x65CF003335ull),X(0x65E60F0402ull),X(0x65FD1CD963ull),X(0x661429B31Eull),X(0x662B3590FAull),X(0x66424072BFull), \
+	X(0x66594A5833ull),X(0x667053411Full),X(0x66875B2D48ull),X(0x669E621C77ull),X(0x66B5680E72ull),X(0x66CC6D0301ull),X(0x66E370F9EBull),X(0x66FA73F2F7ull), \
+	X(0x671175EDEBull),X(0x672876EA91ull),X(0x673F76E8AEull),X(0x675675E80Aull),X(0x676D73E86Dull),X(0x678470E99Dull),X(0x679B6CEB61ull),X(0x67B267ED82ull), \
+	X(0x67C961EFC6ull),X(0x67E05AF1F5ull),X(0x67F752F3D6ull),X(0x680E49F530ull),X(0x68253FF5CBull),X(0x683C34F56Dull),X(0x685328F3E0ull),X(0x686A1BF0E8ull), \
+	X(0x68810DEC4Full),X(0x6897FEE5DCull),X(0x68AEEEDD55ull),X(0x68C5DDD283ull),X(0x68DCCBC52Cull),X(0x68F3B8B518ull),X(0x690AA4A20Full),X(0x69218F8BD8ull), \
+	X(0x693879723Bull),X(0x694F6254FEull),X(0x69664A33EAull),X(0x697D310EC6ull),X(0x699416E559ull),X(0x69AAFBB76Aull),X(0x69C1DF84C3ull),X(0x69D8C24D29ull), \
+	X(0x69EFA41064ull),X(0x6A0684CE3Dull),X(0x6A1D64867Aull),X(0x6A344338E3ull),X(0x6A4B20E540ull),X(0x6A61FD8B58ull),X(0x6A78D92AF2ull),X(0x6A8FB3C3D8ull), \
+	X(0x6AA68D55CFull),X(0x6ABD65E0A0ull),X(0x6AD43D6412ull),X(0x6AEB13DFEDull),X(0x6B01E953F9ull),X(0x6B18BDBFFDull),X(0x6B2F9123C1ull),X(0x6B46637F0Cull), \
+	X(0x6B5D34D1A7ull),X(0x6B74051B58ull),X(0x6B8AD45BE9ull),X(0x6BA1A2931Full),X(0x6BB86FC0C4ull),X(0x6BCF3BE49Full),X(0x6BE606FE77ull),X(0x6BFCD10E15ull), \
+	X(0x6C139A1340ull),X(0x6C2A620DC0ull),X(0x6C4128FD5Cull),X(0x6C57EEE1DEull),X(0x6C6EB3BB0Bull),X(0x6C857788ACull),X(0x6C9C3A4A8Aull),X(0x6CB2FC006Bull), \
+	X(0x6CC9BCAA18ull),X(0x6CE07C4759ull),X(0x6CF73AD7F5ull),X(0x6D0DF85BB4ull),X(0x6D24B4D25Eull),X(0x6D3B703BBCull),X(0x6D522A9794ull),X(0x6D68E3E5B0ull), \
+	X(0x6D7F9C25D6ull),X(0x6D965357CFull),X(0x6DAD097B63ull),X(0x6DC3BE9059ull),X(0x6DDA72967Aull),X(0x6DF1258D8Eull),X(0x6E07D7755Cull),X(0x6E1E884DADull), \
+	X(0x6E35381648ull),X(0x6E4BE6CEF7ull),X(0x6E62947780ull),X(0x6E79410FABull),X(0x6E8FEC9742ull),X(0x6EA6970E0Bull),X(0x6EBD4073D0ull),X(0x6ED3E8C857ull), \
+	X(0x6EEA900B6Aull),X(0x6F01363CCFull),X(0x6F17DB5C50ull),X(0x6F2E7F69B5ull),X(0x6F452264C5ull),X(0x6F5BC44D49ull),X(0x6F72652309ull),X(0x6F8904E5CDull), \
+	X(0x6F9FA3955Dull),X(0x6FB6413181ull),X(0x6FCCDDBA02ull),X(0x6FE3792EA8ull),X(0x6FFA138F3Bull),X(0x7010ACDB84ull),X(0x702745134Aull),X(0x703DDC3655ull), \
+	X(0x705472446Full),X(0x706B073D5Full),X(0x70819B20EEull),X(0x70982DEEE3ull),X(0x70AEBFA708ull),X(0x70C5504924ull),X(0x70DBDFD500ull),X(0x70F26E4A65ull), \
+	X(0x7108FBA919ull),X(0x711F87F0E7ull),X(0x7136132196ull),X(0x714C9D3AEEull),X(0x7163263CB8ull),X(0x7179AE26BDull),X(0x719034F8C5ull),X(0x71A6BAB297ull), \
+	X(0x71BD3F53FEull),X(0x71D3C2DCC0ull),X(0x71EA454CA7ull),X(0x7200C6A37Bull),X(0x721746E104ull),X(0x722DC6050Cull),X(0x7244440F5Aull),X(0x725AC0FFB6ull), \
+	X(0x72713CD5EAull),X(0x7287B791BEull),X(0x729E3132FBull),X(0x72B4A9B969ull),X(0x72CB2124D0ull),X(0x72E19774F9ull),X(0x72F80CA9ADull),X(0x730E80C2B5ull), \
+	X(0x7324F3BFD8ull),X(0x733B65A0E0ull),X(0x7351D66595ull),X(0x7368460DC0ull),X(0x737EB4992Aull),X(0x739522079Aull),X(0x73AB8E58DAull),X(0x73C1F98CB3ull), \
+	X(0x73D863A2ECull),X(0x73EECC9B50ull),X(0x74053475A6ull),X(0x741B9B31B7ull),X(0x743200CF4Cull),X(0x7448654E2Eull),X(0x745EC8AE25ull),X(0x74752AEEFAull), \
+	X(0x748B8C1077ull),X(0x74A1EC1263ull),X(0x74B84AF487ull),X(0x74CEA8B6ADull),X(0x74E505589Dull),X(0x74FB60DA20ull),X(0x7511BB3AFFull),X(0x7528147B03ull), \
+	X(0x753E6C99F4ull),X(0x7554C3979Bull),X(0x756B1973C2ull),X(0x75816E2E31ull),X(0x7597C1C6B1ull),X(0x75AE143D0Aull),X(0x75C4659107ull),X(0x75DAB5C270ull), \
+	X(0x75F104D10Dull),X(0x760752BCA8ull),X(0x761D9F8509ull),X(0x7633EB29FBull),X(0x764A35AB45ull),X(0x76607F08B0ull),X(0x7676C74207ull),X(0x768D0E5711ull), \
+	X(0x76A3544797ull),X(0x76B9991364ull),X(0x76CFDCBA3Full),X(0x76E61F3BF2ull),X(0x76FC609846ull),X(0x7712A0CF04ull),X(0x7728DFDFF5ull),X(0x773F1DCAE3ull), \
+	X(0x77555A8F95ull),X(0x776B962DD7ull),X(0x7781D0A56Full),X(0x779809F629ull),X(0x77AE421FCDull),X(0x77C4792224ull),X(0x77DAAEFCF7ull),X(0x77F0E3B00Full), \
+	X(0x7807173B37ull),X(0x781D499E36ull),X(0x78337AD8D6ull),X(0x7849AAEAE1ull),X(0x785FD9D420ull),X(0x787607945Bull),X(0x788C342B5Dull),X(0x78A25F98EEull), \
+	X(0x78B889DCD8ull),X(0x78CEB2F6E4ull),X(0x78E4DAE6DCull),X(0x78FB01AC88ull),X(0x79112747B2ull),X(0x79274BB824ull),X(0x793D6EFDA7ull),X(0x7953911804ull), \
+	X(0x7969B20704ull),X(0x797FD1CA72ull),X(0x7995F06215ull),X(0x79AC0DCDB9ull),X(0x79C22A0D26ull),X(0x79D8452026ull),X(0x79EE5F0682ull),X(0x7A0477C003ull), \
+	X(0x7A1A8F4C74ull),X(0x7A30A5AB9Dull),X(0x7A46BADD48ull),X(0x7A5CCEE13Full),X(0x7A72E1B74Bull),X(0x7A88F35F35ull),X(0x7A9F03D8C8ull),X(0x7AB51323CDull), \
+	X(0x7ACB21400Dull),X(0x7AE12E2D52ull),X(0x7AF739EB65ull),X(0x7B0D447A11ull),X(0x7B234DD91Eull),X(0x7B39560857ull),X(0x7B4F5D0784ull),X(0x7B6562D671ull), \
+	X(0x7B7B6774E5ull),X(0x7B916AE2ACull),X(0x7BA76D1F8Eull),X(0x7BBD6E2B56ull),X(0x7BD36E05CDull),X(0x7BE96CAEBCull),X(0x7BFF6A25EEull),X(0x7C15666B2Dull), \
+	X(0x7C2B617E41ull),X(0x7C415B5EF5ull),X(0x7C57540D13ull),X(0x7C6D4B8864ull),X(0x7C8341D0B2ull),X(0x7C9936E5C7ull),X(0x7CAF2AC76Dull),X(0x7CC51D756Dull), \
+	X(0x7CDB0EEF92ull),X(0x7CF0FF35A6ull),X(0x7D06EE4771ull),X(0x7D1CDC24BFull),X(0x7D32C8CD58ull),X(0x7D48B44108ull),X(0x7D5E9E7F97ull),X(0x7D748788D0ull), \
+	X(0x7D8A6F5C7Cull),X(0x7DA055FA66ull),X(0x7DB63B6258ull),X(0x7DCC1F941Bull),X(0x7DE2028F7Aull),X(0x7DF7E4543Eull),X(0x7E0DC4E231ull),X(0x7E23A4391Full), \
+	X(0x7E398258CFull),X(0x7E4F5F410Eull),X(0x7E653AF1A4ull),X(0x7E7B156A5Cull),X(0x7E90EEAAFFull),X(0x7EA6C6B359ull),X(0x7EBC9D8332ull),X(0x7ED2731A56ull), \
+	X(0x7EE847788Eull),X(0x7EFE1A9DA4ull),X(0x7F13EC8963ull),X(0x7F29BD3B95ull),X(0x7F3F8CB403ull),X(0x7F555AF278ull),X(0x7F6B27F6BFull),X(0x7F80F3C0A1ull), \
+	X(0x7F96BE4FE9ull),X(0x7FAC87A461ull),X(0x7FC24FBDD3ull),X(0x7FD8169C09ull),X(0x7FEDDC3ECEull),X(0x8003A0A5ECull),X(0x801963D12Dull),X(0x802F25C05Cull), \
+	X(0x8044E67343ull),X(0x805AA5E9ABull),X(0x8070642361ull),X(0x808621202Dull),X(0x809BDCDFDAull),X(0x80B1976234ull),X(0x80C750A703ull),X(0x80DD08AE12ull), \
+	X(0x80F2BF772Dull),X(0x810875021Cull),X(0x811E294EACull),X(0x8133DC5CA5ull),X(0x81498E2BD3ull),X(0x815F3EBC00ull),X(0x8174EE0CF7ull),X(0x818A9C1E81ull), \
+	X(0x81A048F06Aull),X(0x81B5F4827Dull),X(0x81CB9ED483ull),X(0x81E147E647ull),X(0x81F6EFB793ull),X(0x820C964833ull),X(0x82223B97F1ull),X(0x8237DFA697ull), \
+	X(0x824D8273F0ull),X(0x826323FFC7ull),X(0x8278C449E6ull),X(0x828E635218ull),X(0x82A4011828ull),X(0x82B99D9BE0ull),X(0x82CF38DD0Aull),X(0x82E4D2DB73ull), \
+	X(0x82FA6B96E3ull),X(0x8310030F27ull),X(0x8325994408ull),X(0x833B2E3552ull),X(0x8350C1E2CFull),X(0x8366544C4Aull),X(0x837BE5718Eull),X(0x8391755265ull), \
+	X(0x83A703EE9Bull),X(0x83BC9145FAull),X(0x83D21D584Cull),X(0x83E7A8255Eull),X(0x83FD31ACF9ull),X(0x8412B9EEE9ull),X(0x842840EAF8ull),X(0x843DC6A0F1ull), \
+	X(0x84534B10A0ull),X(0x8468CE39CEull),X(0x847E501C48ull),X(0x8493D0B7D7ull),X(0x84A9500C47ull),X(0x84BECE1964ull),X(0x84D44ADEF7ull),X(0x84E9C65CCBull), \
+	X(0x84FF4092ADull),X(0x8514B98066ull),X(0x852A3125C2ull),X(0x853FA7828Cull),X(0x85551C968Full),X(0x856A906195ull),X(0x858002E36Bull),X(0x8595741BDBull), \
+	X(0x85AAE40AAFull),X(0x85C052AFB5ull),X(0x85D5C00AB5ull),X(0x85EB2C1B7Cull),X(0x860096E1D5ull),X(0x8616005D8Bull),X(0x862B688E68ull),X(0x8640CF7439ull), \
+	X(0x8656350EC8ull),X(0x866B995DE0ull),X(0x8680FC614Eull),X(0x86965E18DBull),X(0x86ABBE8454ull),X(0x86C11DA383ull),X(0x86D67B7634ull),X(0x86EBD7FC32ull), \
+	X(0x8701333549ull),X(0x87168D2143ull),X(0x872BE5BFECull),X(0x87413D110Full),X(0x8756931478ull),X(0x876BE7C9F2ull),X(0x87813B3148ull),X(0x87968D4A46ull), \
+	X(0x87ABDE14B8ull),X(0x87C12D9067ull),X(0x87D67BBD21ull),X(0x87EBC89AB0ull),X(0x88011428E1ull),X(0x88165E677Dull),X(0x882BA75651ull),X(0x8840EEF528ull), \
+	X(0x88563543CEull),X(0x886B7A420Full),X(0x8880BDEFB5ull),X(0x8896004C8Cull),X(0x88AB415861ull),X(0x88C08112FDull),X(0x88D5BF7C2Eull),X(0x88EAFC93BEull), \
+	X(0x890038597Aull),X(0x891572CD2Cull),X(0x892AABEEA0ull),X(0x893FE3BDA3ull),X(0x89551A39FFull),X(0x896A4F6381ull),X(0x897F8339F3ull),X(0x8994B5BD23ull), \
+	X(0x89A9E6ECDAull),X(0x89BF16C8E6ull),X(0x89D4455112ull),X(0x89E9728529ull),X(0x89FE9E64F7ull),X(0x8A13C8F049ull),X(0x8A28F226E9ull),X(0x8A3E1A08A4ull), \
+	X(0x8A53409545ull),X(0x8A6865CC99ull),X(0x8A7D89AE6Aull),X(0x8A92AC3A86ull),X(0x8AA7CD70B7ull),X(0x8ABCED50CAull),X(0x8AD20BDA8Bull),X(0x8AE7290DC4ull), \
+	X(0x8AFC44EA44ull),X(0x8B115F6FD4ull),X(0x8B26789E41ull),X(0x8B3B907558ull),X(0x8B50A6F4E3ull),X(0x8B65BC1CB0ull),X(0x8B7ACFEC89ull),X(0x8B8FE2643Cull), \
+	X(0x8BA4F38393ull),X(0x8BBA034A5Cull),X(0x8BCF11B861ull),X(0x8BE41ECD70ull),X(0x8BF92A8954ull),X(0x8C0E34EBD9ull),X(0x8C233DF4CBull),X(0x8C3845A3F7ull), \
+	X(0x8C4D4BF928ull),X(0x8C6250F42Aull),X(0x8C775494CBull),X(0x8C8C56DAD5ull),X(0x8CA157C616ull),X(0x8CB6575659ull),X(0x8CCB558B6Aull),X(0x8CE0526516ull), \
+	X(0x8CF54DE328ull),X(0x8D0A48056Eull),X(0x8D1F40CBB3ull),X(0x8D343835C4ull),X(0x8D492E436Cull),X(0x8D5E22F479ull),X(0x8D731648B6ull),X(0x8D88083FF0ull), \
+	X(0x8D9CF8D9F2ull),X(0x8DB1E8168Bull),X(0x8DC6D5F585ull),X(0x8DDBC276ACull),X(0x8DF0AD99CFull),X(0x8E05975EB8ull),X(0x8E1A7FC535ull),X(0x8E2F66CD11ull), \
+	X(0x8E444C7619ull),X(0x8E5930C01Aull),X(0x8E6E13AAE0ull),X(0x8E82F53637ull),X(0x8E97D561ECull),X(0x8EACB42DCBull),X(0x8EC19199A2ull),X(0x8ED66DA53Cull), \
+	X(0x8EEB485065ull),X(0x8F00219AECull),X(0x8F14F9849Bull),X(0x8F29D00D40ull),X(0x8F3EA534A7ull),X(0x8F5378FA9Dull),X(0x8F684B5EEFull),X(0x8F7D1C6168ull), \
+	X(0x8F91EC01D6ull),X(0x8FA6BA4006ull),X(0x8FBB871BC3ull),X(0x8FD05294DBull),X(0x8FE51CAB1Bull),X(0x8FF9E55E4Eull),X(0x900EACAE43ull),X(0x9023729AC5ull), \
+	X(0x90383723A1ull),X(0x904CFA48A4ull),X(0x9061BC099Bull),X(0x90767C6652ull),X(0x908B3B5E97ull),X(0x909FF8F236ull),X(0x90B4B520FCull),X(0x90C96FEAB6ull), \
+	X(0x90DE294F31ull),X(0x90F2E14E39ull),X(0x910797E79Cull),X(0x911C4D1B26ull),X(0x913100E8A4ull),X(0x9145B34FE4ull),X(0x915A6450B1ull),X(0x916F13EADAull), \
+	X(0x9183C21E2Aull),X(0x91986EEA70ull),X(0x91AD1A4F77ull),X(0x91C1C44D0Eull),X(0x91D66CE300ull),X(0x91EB14111Bull),X(0x91FFB9D72Dull),X(0x92145E3501ull), \
+	X(0x9229012A66ull),X(0x923DA2B728ull),X(0x925242DB14ull),X(0x9266E195F8ull),X(0x927B7EE7A0ull),X(0x92901ACFDAull),X(0x92A4B54E73ull),X(0x92B94E6338ull), \
+	X(0x92CDE60DF6ull),X(0x92E27C4E7Aull),X(0x92F7112492ull),X(0x930BA4900Bull),X(0x93203690B2ull),X(0x9334C72654ull),X(0x93495650BFull),X(0x935DE40FC0ull), \
+	X(0x9372706323ull),X(0x9386FB4AB7ull),X(0x939B84C649ull),X(0x93B00CD5A6ull),X(0x93C493789Bull),X(0x93D918AEF5ull),X(0x93ED9C7883ull),X(0x94021ED512ull), \
+	X(0x94169FC46Eull),X(0x942B1F4666ull),X(0x943F9D5AC6ull),X(0x94541A015Cull),X(0x94689539F6ull),X(0x947D0F0462ull),X(0x949187606Bull),X(0x94A5FE4DE1ull), \
+	X(0x94BA73CC90ull),X(0x94CEE7DC46ull),X(0x94E35A7CD1ull),X(0x94F7CBADFEull),X(0x950C3B6F9Bull),X(0x9520A9C175ull),X(0x953516A35Aull),X(0x9549821517ull), \
+	X(0x955DEC167Aull),X(0x957254A751ull),X(0x9586BBC76Aull),X(0x959B217691ull),X(0x95AF85B495ull),X(0x95C3E88144ull),X(0x95D849DC6Aull),X(0x95ECA9C5D6ull), \
+	X(0x9601083D56ull),X(0x96156542B7ull),X(0x9629C0D5C8ull),X(0x963E1AF654ull),X(0x965273A42Cull),X(0x9666CADF1Cull),X(0x967B20A6F2ull),X(0x968F74FB7Cull), \
+	X(0x96A3C7DC87ull),X(0x96B81949E3ull),X(0x96CC69435Cull),X(0x96E0B7C8C0ull),X(0x96F504D9DEull),X(0x9709507683ull),X(0x971D9A9E7Dull),X(0x9731E3519Bull), \
+	X(0x97462A8FA9ull),X(0x975A705876ull),X(0x976EB4ABD1ull),X(0x9782F78986ull),X(0x979738F164ull),X(0x97AB78E33Aull),X(0x97BFB75ED4ull),X(0x97D3F46402ull), \
+	X(0x97E82FF290ull),X(0x97FC6A0A4Eull),X(0x9810A2AB0Aull),X(0x9824D9D490ull),X(0x98390F86B1ull),X(0x984D43C139ull),X(0x98617683F6ull),X(0x9875A7CEB8ull), \
+	X(0x9889D7A14Cull),X(0x989E05FB81ull),X(0x98B232DD24ull),X(0x98C65E4603ull),X(0x98DA8835EEull),X(0x98EEB0ACB2ull),X(0x9902D7AA1Eull),X(0x9916FD2DFFull), \
+	X(0x992B213825ull),X(0x993F43C85Dull),X(0x995364DE76ull),X(0x9967847A3Dull),X(0x997BA29B83ull),X(0x998FBF4214ull),X(0x99A3DA6DBFull),X(0x99B7F41E52ull), \
+	X(0x99CC0C539Dull),X(0x99E0230D6Dull),X(0x99F4384B91ull),X(0x9A084C0DD7ull),X(0x9A1C5E540Eull),X(0x9A306F1E04ull),X(0x9A447E6B87ull),X(0x9A588C3C67ull), \
+	X(0x9A6C989071ull),X(0x9A80A36775ull),X(0x9A94ACC141ull),X(0x9AA8B49DA2ull),X(0x9ABCBAFC69ull),X(0x9AD0BFDD63ull),X(0x9AE4C34060ull),X(0x9AF8C5252Dull), \
+	X(0x9B0CC58B99ull),X(0x9B20C47374ull),X(0x9B34C1DC8Bull),X(0x9B48BDC6ADull),X(0x9B5CB831AAull),X(0x9B70B11D4Full),X(0x9B84A8896Cull),X(0x9B989E75CFull), \
+	X(0x9BAC92E247ull),X(0x9BC085CEA3ull),X(0x9BD4773AB1ull),X(0x9BE8672640ull),X(0x9BFC559120ull),X(0x9C10427B1Eull),X(0x9C242DE40Aull),X(0x9C3817CBB3ull), \
+	X(0x9C4C0031E7ull),X(0x9C5FE71676ull),X(0x9C73CC792Eull),X(0x9C87B059DEull),X(0x9C9B92B855ull),X(0x9CAF739462ull),X(0x9CC352EDD4ull),X(0x9CD730C47Aull), \
+	X(0x9CEB0D1823ull),X(0x9CFEE7E89Eull),X(0x9D12C135B9ull),X(0x9D2698FF45ull),X(0x9D3A6F450Full),X(0x9D4E4406E8ull),X(0x9D6217449Eull),X(0x9D75E8FE00ull), \
+	X(0x9D89B932DDull),X(0x9D9D87E305ull),X(0x9DB1550E46ull),X(0x9DC520B470ull),X(0x9DD8EAD551ull),X(0x9DECB370BAull),X(0x9E007A8679ull),X(0x9E1440165Dull), \
+	X(0x9E28042036ull),X(0x9E3BC6A3D2ull),X(0x9E4F87A102ull),X(0x9E63471794ull),X(0x9E77050757ull),X(0x9E8AC1701Cull),X(0x9E9E7C51B1ull),X(0x9EB235ABE5ull), \
+	X(0x9EC5ED7E88ull),X(0x9ED9A3C969ull),X(0x9EED588C58ull),X(0x9F010BC724ull),X(0x9F14BD799Cull),X(0x9F286DA390ull),X(0x9F3C1C44CFull),X(0x9F4FC95D28ull), \
+	X(0x9F6374EC6Cull),X(0x9F771EF269ull),X(0x9F8AC76EEFull),X(0x9F9E6E61CDull),X(0x9FB213CAD4ull),X(0x9FC5B7A9D2ull),X(0x9FD959FE97ull),X(0x9FECFAC8F3ull), \
+	X(0xA0009A08B5ull),X(0xA01437BDADull),X(0xA027D3E7AAull),X(0xA03B6E867Cull),X(0xA04F0799F2ull),X(0xA0629F21DDull),X(0xA076351E0Cull),X(0xA089C98E4Full), \
+	X(0xA09D5C7274ull),X(0xA0B0EDCA4Dull),X(0xA0C47D95A8ull),X(0xA0D80BD456ull),X(0xA0EB988626ull),X(0xA0FF23AAE8ull),X(0xA112AD426Cull),X(0xA126354C81ull), \
+	X(0xA139BBC8F7ull),X(0xA14D40B79Full),X(0xA160C41847ull),X(0xA17445EAC1ull),X(0xA187C62EDBull),X(0xA19B44E466ull),X(0xA1AEC20B31ull),X(0xA1C23DA30Dull), \
+	X(0xA1D5B7ABC9ull),X(0xA1E9302535ull),X(0xA1FCA70F21ull),X(0xA2101C695Eull),X(0xA2239033BBull),X(0xA237026E08ull),X(0xA24A731815ull),X(0xA25DE231B3ull), \
+	X(0xA2714FBAB0ull),X(0xA284BBB2DFull),X(0xA298261A0Dull),X(0xA2AB8EF00Cull),X(0xA2BEF634ACull),X(0xA2D25BE7BCull),X(0xA2E5C0090Eull),X(0xA2F9229870ull), \
+	X(0xA30C8395B4ull),X(0xA31FE300A9ull),X(0xA33340D920ull),X(0xA3469D1EE8ull),X(0xA359F7D1D3ull),X(0xA36D50F1B0ull),X(0xA380A87E4Full),X(0xA393FE7782ull), \
+	X(0xA3A752DD17ull),X(0xA3BAA5AEE0ull),X(0xA3CDF6ECADull),X(0xA3E146964Dull),X(0xA3F494AB93ull),X(0xA407E12C4Dull),X(0xA41B2C184Cull),X(0xA42E756F60ull), \
+	X(0xA441BD315Bull),X(0xA455035E0Cull),X(0xA46847F544ull),X(0xA47B8AF6D4ull),X(0xA48ECC628Bull),X(0xA4A20C383Aull),X(0xA4B54A77B3ull),X(0xA4C88720C4ull), \
+	X(0xA4DBC23340ull),X(0xA4EEFBAEF6ull),X(0xA5023393B6ull),X(0xA51569E153ull),X(0xA5289E979Bull),X(0xA53BD1B661ull),X(0xA54F033D73ull),X(0xA562332CA4ull), \
+	X(0xA5756183C3ull),X(0xA5888E42A2ull),X(0xA59BB96911ull),X(0xA5AEE2F6E0ull),X(0xA5C20AEBE1ull),X(0xA5D53147E4ull),X(0xA5E8560ABAull),X(0xA5FB793434ull), \
+	X(0xA60E9AC422ull),X(0xA621BABA56ull),X(0xA634D916A0ull),X(0xA647F5D8D0ull),X(0xA65B1100B8ull),X(0xA66E2A8E29ull),X(0xA6814280F4ull),X(0xA69458D8E9ull), \
+	X(0xA6A76D95D9ull),X(0xA6BA80B795ull),X(0xA6CD923DEFull),X(0xA6E0A228B7ull),X(0xA6F3B077BDull),X(0xA706BD2AD4ull),X(0xA719C841CCull),X(0xA72CD1BC76ull), \
+	X(0xA73FD99AA3ull),X(0xA752DFDC24ull),X(0xA765E480CAull),X(0xA778E78866ull),X(0xA78BE8F2CAull),X(0xA79EE8BFC7ull),X(0xA7B1E6EF2Cull),X(0xA7C4E380CDull), \
+	X(0xA7D7DE7479ull),X(0xA7EAD7CA03ull),X(0xA7FDCF813Bull),X(0xA810C599F2ull),X(0xA823BA13F9ull),X(0xA836ACEF23ull),X(0xA8499E2B40ull),X(0xA85C8DC821ull), \
+	X(0xA86F7BC598ull),X(0xA882682375ull),X(0xA89552E18Bull),X(0xA8A83BFFABull),X(0xA8BB237DA5ull),X(0xA8CE095B4Cull),X(0xA8E0ED9870ull),X(0xA8F3D034E4ull), \
+	X(0xA906B13077ull),X(0xA919908AFDull),X(0xA92C6E4446ull),X(0xA93F4A5C24ull),X(0xA95224D267ull),X(0xA964FDA6E3ull),X(0xA977D4D968ull),X(0xA98AAA69C7ull), \
+	X(0xA99D7E57D3ull),X(0xA9B050A35Cull),X(0xA9C3214C35ull),X(0xA9D5F0522Eull),X(0xA9E8BDB51Aull),X(0xA9FB8974CAull),X(0xAA0E539110ull),X(0xAA211C09BEull), \
+	X(0xAA33E2DEA4ull),X(0xAA46A80F95ull),X(0xAA596B9C62ull),X(0xAA6C2D84DDull),X(0xAA7EEDC8D9ull),X(0xAA91AC6825ull),X(0xAAA4696295ull),X(0xAAB724B7FAull), \
+	X(0xAAC9DE6826ull),X(0xAADC9672EAull),X(0xAAEF4CD819ull),X(0xAB02019784ull),X(0xAB14B4B0FDull),X(0xAB27662457ull),X(0xAB3A15F162ull),X(0xAB4CC417F0ull), \
+	X(0xAB5F7097D5ull),X(0xAB721B70E1ull),X(0xAB84C4A2E6ull),X(0xAB976C2DB7ull),X(0xABAA121125ull),X(0xABBCB64D03ull),X(0xABCF58E122ull),X(0xABE1F9CD55ull), \
+	X(0xABF499116Dull),X(0xAC0736AD3Cull),X(0xAC19D2A096ull),X(0xAC2C6CEB4Aull),X(0xAC3F058D2Dull),X(0xAC519C8610ull),X(0xAC6431D5C4ull),X(0xAC76C57C1Dull), \
+	X(0xAC895778ECull),X(0xAC9BE7CC04ull),X(0xACAE767536ull),X(0xACC1037455ull),X(0xACD38EC934ull),X(0xACE61873A4ull),X(0xACF8A07377ull),X(0xAD0B26C880ull), \
+	X(0xAD1DAB7292ull),X(0xAD302E717Eull),X(0xAD42AFC517ull),X(0xAD552F6D2Full),X(0xAD67AD6999ull),X(0xAD7A29BA27ull),X(0xAD8CA45EABull),X(0xAD9F1D56F8ull), \
+	X(0xADB194A2E0ull),X(0xADC40A4235ull),X(0xADD67E34CBull),X(0xADE8F07A73ull),X(0xADFB611300ull),X(0xAE0DCFFE44ull),X(0xAE203D3C13ull),X(0xAE32A8CC3Eull), \
+	X(0xAE4512AE98ull),X(0xAE577AE2F3ull),X(0xAE69E16923ull),X(0xAE7C4640FAull),X(0xAE8EA96A4Bull),X(0xAEA10AE4E7ull),X(0xAEB36AB0A2ull),X(0xAEC5C8CD4Full), \
+	X(0xAED8253ABFull),X(0xAEEA7FF8C6ull),X(0xAEFCD90737ull),X(0xAF0F3065E4ull),X(0xAF218614A0ull),X(0xAF33DA133Eull),X(0xAF462C6190ull),X(0xAF587CFF6Aull), \
+	X(0xAF6ACBEC9Dull),X(0xAF7D1928FEull),X(0xAF8F64B45Eull),X(0xAFA1AE8E91ull),X(0xAFB3F6B769ull),X(0xAFC63D2EBAull),X(0xAFD881F456ull),X(0xAFEAC50810ull), \
+	X(0xAFFD0669BCull),X(0xB00F46192Bull),X(0xB021841632ull),X(0xB033C060A3ull),X(0xB045FAF851ull),X(0xB05833DD0Full),X(0xB06A6B0EB0ull),X(0xB07CA08D07ull), \
+	X(0xB08ED457E8ull),X(0xB0A1066F24ull),X(0xB0B336D291ull),X(0xB0C5658200ull),X(0xB0D7927D44ull),X(0xB0E9BDC432ull),X(0xB0FBE7569Cull),X(0xB10E0F3454ull), \
+	X(0xB120355D30ull),X(0xB13259D101ull),X(0xB1447C8F9Aull),X(0xB1569D98D0ull),X(0xB168BCEC76ull),X(0xB17ADA8A5Eull),X(0xB18CF6725Cull),X(0xB19F10A443ull), \
+	X(0xB1B1291FE7ull),X(0xB1C33FE51Bull),X(0xB1D554F3B2ull),X(0xB1E7684B81ull),X(0xB1F979EC59ull),X(0xB20B89D60Full),X(0xB21D980875ull),X(0xB22FA48361ull), \
+	X(0xB241AF46A4ull),X(0xB253B85212ull),X(0xB265BFA580ull),X(0xB277C540C0ull),X(0xB289C923A6ull),X(0xB29BCB4E05ull),X(0xB2ADCBBFB1ull),X(0xB2BFCA787Eull), \
+	X(0xB2D1C77840ull),X(0xB2E3C2BEC9ull),X(0xB2F5BC4BEDull),X(0xB307B41F81ull),X(0xB319AA3958ull),X(0xB32B9E9945ull),X(0xB33D913F1Cull),X(0xB34F822AB1ull), \
+	X(0xB361715BD8ull),X(0xB3735ED264ull),X(0xB3854A8E29ull),X(0xB397348EFCull),X(0xB3A91CD4AFull),X(0xB3BB035F16ull),X(0xB3CCE82E06ull),X(0xB3DECB4152ull), \
+	X(0xB3F0AC98CEull),X(0xB4028C344Full),X(0xB4146A13A7ull),X(0xB4264636AAull),X(0xB438209D2Eull),X(0xB449F94705ull),X(0xB45BD03404ull),X(0xB46DA563FFull), \
+	X(0xB47F78D6C9ull),X(0xB4914A8C36ull),X(0xB4A31A841Cull),X(0xB4B4E8BE4Dull),X(0xB4C6B53A9Eull),X(0xB4D87FF8E3ull),X(0xB4EA48F8EFull),X(0xB4FC103A98ull), \
+	X(0xB50DD5BDB1ull),X(0xB51F99820Full),X(0xB5315B8785ull),X(0xB5431BCDE7ull),X(0xB554DA550Bull),X(0xB566971CC3ull),X(0xB5785224E6ull),X(0xB58A0B6D45ull), \
+	X(0xB59BC2F5B7ull),X(0xB5AD78BE0Full),X(0xB5BF2CC621ull),X(0xB5D0DF0DC2ull),X(0xB5E28F94C6ull),X(0xB5F43E5B02ull),X(0xB605EB6049ull),X(0xB61796A471ull), \
+	X(0xB62940274Eull),X(0xB63AE7E8B3ull),X(0xB64C8DE876ull),X(0xB65E32266Bull),X(0xB66FD4A267ull),X(0xB681755C3Dull),X(0xB6931453C3ull),X(0xB6A4B188CCull), \
+	X(0xB6B64CFB2Eull),X(0xB6C7E6AABEull),X(0xB6D97E974Eull),X(0xB6EB14C0B5ull),X(0xB6FCA926C7ull),X(0xB70E3BC959ull),X(0xB71FCCA83Eull),X(0xB7315BC34Cull), \
+	X(0xB742E91A57ull),X(0xB75474AD35ull),X(0xB765FE7BB9ull),X(0xB7778685B9ull),X(0xB7890CCB0Aull),X(0xB79A914B7Full),X(0xB7AC1406EEull),X(0xB7BD94FD2Cull), \
+	X(0xB7CF142E0Dull),X(0xB7E0919966ull),X(0xB7F20D3F0Cull),X(0xB803871ED5ull),X(0xB814FF3894ull),X(0xB826758C1Full),X(0xB837EA194Bull),X(0xB8495CDFECull), \
+	X(0xB85ACDDFD7ull),X(0xB86C3D18E3ull),X(0xB87DAA8AE2ull),X(0xB88F1635ABull),X(0xB8A0801913ull),X(0xB8B1E834EEull),X(0xB8C34E8912ull),X(0xB8D4B31553ull), \
+	X(0xB8E615D987ull),X(0xB8F776D583ull),X(0xB908D6091Cull),X(0xB91A337427ull),X(0xB92B8F1679ull),X(0xB93CE8EFE8ull),X(0xB94E410048ull),X(0xB95F97476Full), \
+	X(0xB970EBC532ull),X(0xB9823E7966ull),X(0xB9938F63E1ull),X(0xB9A4DE8477ull),X(0xB9B62BDAFFull),X(0xB9C777674Dull),X(0xB9D8C12937ull),X(0xB9EA092092ull), \
+	X(0xB9FB4F4D33ull),X(0xBA0C93AEF0ull),X(0xBA1DD6459Eull),X(0xBA2F171113ull),X(0xBA40561124ull),X(0xBA519345A7ull),X(0xBA62CEAE70ull),X(0xBA74084B56ull), \
+	X(0xBA85401C2Eull),X(0xBA967620CDull),X(0xBAA7AA5909ull),X(0xBAB8DCC4B8ull),X(0xBACA0D63AEull),X(0xBADB3C35C3ull),X(0xBAEC693ACBull),X(0xBAFD94729Bull), \
+	X(0xBB0EBDDD0Bull),X(0xBB1FE579EEull),X(0xBB310B491Bull),X(0xBB422F4A68ull),X(0xBB53517DAAull),X(0xBB6471E2B7ull),X(0xBB75907965ull),X(0xBB86AD418Aull), \
+	X(0xBB97C83AFAull),X(0xBBA8E1658Dull),X(0xBBB9F8C118ull),X(0xBBCB0E4D70ull),X(0xBBDC220A6Cull),X(0xBBED33F7E1ull),X(0xBBFE4415A6ull),X(0xBC0F52638Full), \
+	X(0xBC205EE174ull),X(0xBC31698F2Aull),X(0xBC42726C87ull),X(0xBC53797961ull),X(0xBC647EB58Eull),X(0xBC758220E4ull),X(0xBC8683BB39ull),X(0xBC97838462ull), \
+	X(0xBCA8817C37ull),X(0xBCB97DA28Dull),X(0xBCCA77F73Bull),X(0xBCDB707A15ull),X(0xBCEC672AF4ull),X(0xBCFD5C09ABull),X(0xBD0E4F1613ull),X(0xBD1F405000ull), \
+	X(0xBD302FB74Aull),X(0xBD411D4BC6ull),X(0xBD52090D4Bull),X(0xBD62F2FBAEull),X(0xBD73DB16C7ull),X(0xBD84C15E6Bull),X(0xBD95A5D270ull),X(0xBDA68872AEull), \
+	X(0xBDB7693EFAull),X(0xBDC848372Bull),X(0xBDD9255B17ull),X(0xBDEA00AA94ull),X(0xBDFADA257Aull),X(0xBE0BB1CB9Dull),X(0xBE1C879CD6ull),X(0xBE2D5B98F9ull), \
+	X(0xBE3E2DBFDEull),X(0xBE4EFE115Cull),X(0xBE5FCC8D48ull),X(0xBE70993379ull),X(0xBE816403C7ull),X(0xBE922CFE06ull),X(0xBEA2F4220Full),X(0xBEB3B96FB7ull), \
+	X(0xBEC47CE6D5ull),X(0xBED53E8740ull),X(0xBEE5FE50CEull),X(0xBEF6BC4357ull),X(0xBF07785EB0ull),X(0xBF1832A2B1ull),X(0xBF28EB0F30ull),X(0xBF39A1A404ull), \
+	X(0xBF4A566104ull),X(0xBF5B094606ull),X(0xBF6BBA52E2ull),X(0xBF7C69876Eull),X(0xBF8D16E381ull),X(0xBF9DC266F2ull),X(0xBFAE6C1197ull),X(0xBFBF13E348ull), \
+	X(0xBFCFB9DBDCull),X(0xBFE05DFB29ull),X(0xBFF1004106ull),X(0xC001A0AD4Bull),X(0xC0123F3FCDull),X(0xC022DBF866ull),X(0xC03376D6EAull),X(0xC0440FDB32ull), \
+	X(0xC054A70514ull),X(0xC0653C5467ull),X(0xC075CFC904ull),X(0xC0866162BFull),X(0xC096F12172ull),X(0xC0A77F04F2ull),X(0xC0B80B0D17ull),X(0xC0C89539B9ull), \
+	X(0xC0D91D8AAEull),X(0xC0E9A3FFCDull),X(0xC0FA2898EEull),X(0xC10AAB55E9ull),X(0xC11B2C3693ull),X(0xC12BAB3AC6ull),X(0xC13C286257ull),X(0xC14CA3AD1Eull), \
+	X(0xC15D1D1AF3ull),X(0xC16D94ABADull),X(0xC17E0A5F23ull),X(0xC18E7E352Dull),X(0xC19EF02DA2ull),X(0xC1AF604859ull),X(0xC1BFCE852Aull),X(0xC1D03AE3EDull), \
+	X(0xC1E0A56479ull),X(0xC1F10E06A4ull),X(0xC20174CA48ull),X(0xC211D9AF3Bull),X(0xC2223CB555ull),X(0xC2329DDC6Eull),X(0xC242FD245Dull),X(0xC2535A8CF9ull), \
+	X(0xC263B6161Bull),X(0xC2740FBF99ull),X(0xC28467894Dull),X(0xC294BD730Cull),X(0xC2A5117CB0ull),X(0xC2B563A60Full),X(0xC2C5B3EF02ull),X(0xC2D6025760ull), \
+	X(0xC2E64EDF01ull),X(0xC2F69985BCull),X(0xC306E24B6Aull),X(0xC317292FE3ull),X(0xC3276E32FDull),X(0xC337B15492ull),X(0xC347F29479ull),X(0xC35831F289ull), \
+	X(0xC3686F6E9Bull),X(0xC378AB0887ull),X(0xC388E4C025ull),X(0xC3991C954Cull),X(0xC3A95287D4ull),X(0xC3B9869796ull),X(0xC3C9B8C46Aull),X(0xC3D9E90E27ull), \
+	X(0xC3EA1774A6ull),X(0xC3FA43F7BFull),X(0xC40A6E9749ull),X(0xC41A97531Eull),X(0xC42ABE2B14ull),X(0xC43AE31F05ull),X(0xC44B062EC8ull),X(0xC45B275A36ull), \
+	X(0xC46B46A126ull),X(0xC47B640372ull),X(0xC48B7F80F1ull),X(0xC49B99197Bull),X(0xC4ABB0CCE9ull),X(0xC4BBC69B13ull),X(0xC4CBDA83D1ull),X(0xC4DBEC86FCull), \
+	X(0xC4EBFCA46Cull),X(0xC4FC0ADBFAull),X(0xC50C172D7Dull),X(0xC51C2198CFull),X(0xC52C2A1DC7ull),X(0xC53C30BC3Eull),X(0xC54C35740Dull),X(0xC55C38450Bull), \
+	X(0xC56C392F13ull),X(0xC57C3831FBull),X(0xC58C354D9Cull),X(0xC59C3081D0ull),X(0xC5AC29CE6Full),X(0xC5BC213350ull),X(0xC5CC16B04Eull),X(0xC5DC0A4540ull), \
+	X(0xC5EBFBF1FFull),X(0xC5FBEBB664ull),X(0xC60BD99247ull),X(0xC61BC58581ull),X(0xC62BAF8FECull),X(0xC63B97B15Full),X(0xC64B7DE9B3ull),X(0xC65B6238C1ull), \
+	X(0xC66B449E62ull),X(0xC67B251A6Full),X(0xC68B03ACC0ull),X(0xC69AE0552Full),X(0xC6AABB1394ull),X(0xC6BA93E7C8ull),X(0xC6CA6AD1A5ull),X(0xC6DA3FD102ull), \
+	X(0xC6EA12E5B9ull),X(0xC6F9E40FA2ull),X(0xC709B34E98ull),X(0xC71980A272ull),X(0xC7294C0B0Aull),X(0xC739158839ull),X(0xC748DD19D8ull),X(0xC758A2BFC0ull), \
+	X(0xC7686679CAull),X(0xC7782847CEull),X(0xC787E829A8ull),X(0xC797A61F2Eull),X(0xC7A762283Bull),X(0xC7B71C44A8ull),X(0xC7C6D4744Eull),X(0xC7D68AB706ull), \
+	X(0xC7E63F0CA9ull),X(0xC7F5F17511ull),X(0xC805A1F016ull),X(0xC815507D93ull),X(0xC824FD1D60ull),X(0xC834A7CF57ull),X(0xC844509352ull),X(0xC853F76928ull), \
+	X(0xC8639C50B5ull),X(0xC8733F49D1ull),X(0xC882E05456ull),X(0xC8927F701Cull),X(0xC8A21C9CFFull),X(0xC8B1B7DAD6ull),X(0xC8C151297Cull),X(0xC8D0E888CAull), \
+	X(0xC8E07DF89Aull),X(0xC8F01178C5ull),X(0xC8FFA30924ull),X(0xC90F32A992ull),X(0xC91EC059E8ull),X(0xC92E4C19FFull),X(0xC93DD5E9B2ull),X(0xC94D5DC8D9ull), \
+	X(0xC95CE3B74Full),X(0xC96C67B4EDull),X(0xC97BE9C18Dull),X(0xC98B69DD09ull),X(0xC99AE8073Aull),X(0xC9AA643FFAull),X(0xC9B9DE8723ull),X(0xC9C956DC8Full), \
+	X(0xC9D8CD4018ull),X(0xC9E841B197ull),X(0xC9F7B430E7ull),X(0xCA0724BDE1ull),X(0xCA1693585Eull),X(0xCA2600003Aull),X(0xCA356AB54Eull),X(0xCA44D37774ull), \
+	X(0xCA543A4686ull),X(0xCA639F225Eull),X(0xCA73020AD5ull),X(0xCA8262FFC7ull),X(0xCA91C2010Dull),X(0xCAA11F0E80ull),X(0xCAB07A27FCull),X(0xCABFD34D5Bull), \
+	X(0xCACF2A7E76ull),X(0xCADE7FBB27ull),X(0xCAEDD30349ull),X(0xCAFD2456B6ull),X(0xCB0C73B548ull),X(0xCB1BC11EDAull),X(0xCB2B0C9345ull),X(0xCB3A561264ull), \
+	X(0xCB499D9C12ull),X(0xCB58E33027ull),X(0xCB6826CE80ull),X(0xCB776876F5ull),X(0xCB86A82963ull),X(0xCB95E5E5A1ull),X(0xCBA521AB8Dull),X(0xCBB45B7AFFull), \
+	X(0xCBC39353D1ull),X(0xCBD2C935E0ull),X(0xCBE1FD2104ull),X(0xCBF12F1519ull),X(0xCC005F11F9ull),X(0xCC0F8D177Full),X(0xCC1EB92585ull),X(0xCC2DE33BE5ull), \
+	X(0xCC3D0B5A7Aull),X(0xCC4C31811Full),X(0xCC5B55AFAFull),X(0xCC6A77E604ull),X(0xCC799823F9ull),X(0xCC88B66968ull),X(0xCC97D2B62Cull),X(0xCCA6ED0A20ull), \
+	X(0xCCB605651Eull),X(0xCCC51BC702ull),X(0xCCD4302FA6ull),X(0xCCE3429EE5ull),X(0xCCF2531499ull),X(0xCD0161909Eull),X(0xCD106E12CFull),X(0xCD1F789B06ull), \
+	X(0xCD2E81291Dull),X(0xCD3D87BCF1ull),X(0xCD4C8C565Cull),X(0xCD5B8EF539ull),X(0xCD6A8F9963ull),X(0xCD798E42B4ull),X(0xCD888AF109ull),X(0xCD9785A43Bull), \
+	X(0xCDA67E5C26ull),X(0xCDB57518A5ull),X(0xCDC469D994ull),X(0xCDD35C9ECCull),X(0xCDE24D682Aull),X(0xCDF13C3588ull),X(0xCE002906C2ull),X(0xCE0F13DBB2ull), \
+	X(0xCE1DFCB434ull),X(0xCE2CE39024ull),X(0xCE3BC86F5Cull),X(0xCE4AAB51B7ull),X(0xCE598C3712ull),X(0xCE686B1F46ull),X(0xCE77480A30ull),X(0xCE8622F7ABull), \
+	X(0xCE94FBE792ull),X(0xCEA3D2D9C1ull),X(0xCEB2A7CE12ull),X(0xCEC17AC462ull),X(0xCED04BBC8Cull),X(0xCEDF1AB66Bull),X(0xCEEDE7B1DAull),X(0xCEFCB2AEB6ull), \
+	X(0xCF0B7BACD9ull),X(0xCF1A42AC1Full),X(0xCF2907AC64ull),X(0xCF37CAAD84ull),X(0xCF468BAF59ull),X(0xCF554AB1BFull),X(0xCF6407B493ull),X(0xCF72C2B7AFull), \
+	X(0xCF817BBAF0ull),X(0xCF9032BE30ull),X(0xCF9EE7C14Cull),X(0xCFAD9AC420ull),X(0xCFBC4BC687ull),X(0xCFCAFAC85Cull),X(0xCFD9A7C97Dull),X(0xCFE852C9C3ull), \
+	X(0xCFF6FBC90Cull),X(0xD005A2C733ull),X(0xD01447C414ull),X(0xD022EABF8Bull),X(0xD0318BB974ull),X(0xD0402AB1AAull),X(0xD04EC7A809ull),X(0xD05D629C6Eull), \
+	X(0xD06BFB8EB4ull),X(0xD07A927EB8ull),X(0xD089276C55ull),X(0xD097BA5768ull),X(0xD0A64B3FCCull),X(0xD0B4DA255Dull),X(0xD0C36707F9ull),X(0xD0D1F1E779ull), \
+	X(0xD0E07AC3BCull),X(0xD0EF019C9Dull),X(0xD0FD8671F7ull),X(0xD10C0943A8ull),X(0xD11A8A118Cull),X(0xD12908DB7Eull),X(0xD13785A15Bull),X(0xD1460062FFull), \
+	X(0xD154792047ull),X(0xD162EFD90Eull),X(0xD171648D32ull),X(0xD17FD73C8Eull),X(0xD18E47E6FEull),X(0xD19CB68C60ull),X(0xD1AB232C8Full),X(0xD1B98DC768ull), \
+	X(0xD1C7F65CC8ull),X(0xD1D65CEC8Aull),X(0xD1E4C1768Bull),X(0xD1F323FAA9ull),X(0xD2018478BEull),X(0xD20FE2F0A8ull),X(0xD21E3F6244ull),X(0xD22C99CD6Dull), \
+	X(0xD23AF23201ull),X(0xD249488FDCull),X(0xD2579CE6DBull),X(0xD265EF36DAull),X(0xD2743F7FB6ull),X(0xD2828DC14Cull),X(0xD290D9FB78ull),X(0xD29F242E17ull), \
+	X(0xD2AD6C5906ull),X(0xD2BBB27C22ull),X(0xD2C9F69747ull),X(0xD2D838AA53ull),X(0xD2E678B521ull),X(0xD2F4B6B78Full),X(0xD302F2B17Aull),X(0xD3112CA2BEull), \
+	X(0xD31F648B39ull),X(0xD32D9A6AC8ull),X(0xD33BCE4147ull),X(0xD34A000E93ull),X(0xD3582FD289ull),X(0xD3665D8D06ull),X(0xD374893DE8ull),X(0xD382B2E50Bull), \
+	X(0xD390DA824Dull),X(0xD39F00158Aull),X(0xD3AD239E9Full),X(0xD3BB451D6Bull),X(0xD3C96491C9ull),X(0xD3D781FB97ull),X(0xD3E59D5AB2ull),X(0xD3F3B6AEF7ull), \
+	X(0xD401CDF844ull),X(0xD40FE33676ull),X(0xD41DF66969ull),X(0xD42C0790FCull),X(0xD43A16AD0Cull),X(0xD44823BD75ull),X(0xD4562EC216ull),X(0xD46437BACBull), \
+	X(0xD4723EA772ull),X(0xD4804387E8ull),X(0xD48E465C0Cull),X(0xD49C4723B9ull),X(0xD4AA45DECEull),X(0xD4B8428D28ull),X(0xD4C63D2EA4ull),X(0xD4D435C321ull), \
+	X(0xD4E22C4A7Bull),X(0xD4F020C491ull),X(0xD4FE13313Full),X(0xD50C039063ull),X(0xD519F1E1DBull),X(0xD527DE2585ull),X(0xD535C85B3Eull),X(0xD543B082E4ull), \
+	X(0xD551969C55ull),X(0xD55F7AA76Dull),X(0xD56D5CA40Cull),X(0xD57B3C920Eull),X(0xD5891A7152ull),X(0xD596F641B5ull),X(0xD5A4D00316ull),X(0xD5B2A7B551ull), \
+	X(0xD5C07D5844ull),X(0xD5CE50EBCFull),X(0xD5DC226FCEull),X(0xD5E9F1E41Full),X(0xD5F7BF48A1ull),X(0xD6058A9D31ull),X(0xD61353E1ADull),X(0xD6211B15F3ull), \
+	X(0xD62EE039E2ull),X(0xD63CA34D56ull),X(0xD64A64502Full),X(0xD65823424Bull),X(0xD665E02387ull),X(0xD6739AF3C1ull),X(0xD68153B2D8ull),X(0xD68F0A60AAull), \
+	X(0xD69CBEFD15ull),X(0xD6AA7187F6ull),X(0xD6B822012Eull),X(0xD6C5D06899ull),X(0xD6D37CBE15ull),X(0xD6E1270182ull),X(0xD6EECF32BDull),X(0xD6FC7551A5ull), \
+	X(0xD70A195E18ull),X(0xD717BB57F4ull),X(0xD7255B3F17ull),X(0xD732F91361ull),X(0xD74094D4AFull),X(0xD74E2E82E1ull),X(0xD75BC61DD3ull),X(0xD7695BA566ull), \
+	X(0xD776EF1976ull),X(0xD7848079E4ull),X(0xD7920FC68Cull),X(0xD79F9CFF4Full),X(0xD7AD28240Aull),X(0xD7BAB1349Cull),X(0xD7C83830E3ull),X(0xD7D5BD18BFull), \
+	X(0xD7E33FEC0Eull),X(0xD7F0C0AAAEull),X(0xD7FE3F547Eull),X(0xD80BBBE95Eull),X(0xD81936692Bull),X(0xD826AED3C4ull),X(0xD834252909ull),X(0xD8419968D7ull), \
+	X(0xD84F0B930Eull),X(0xD85C7BA78Dull),X(0xD869E9A632ull),X(0xD877558EDCull),X(0xD884BF616Bull),X(0xD892271DBCull),X(0xD89F8CC3B0ull),X(0xD8ACF05324ull), \
+	X(0xD8BA51CBF9ull),X(0xD8C7B12E0Cull),X(0xD8D50E793Dull),X(0xD8E269AD6Bull),X(0xD8EFC2CA75ull),X(0xD8FD19D03Aull),X(0xD90A6EBE99ull),X(0xD917C19571ull), \
+	X(0xD9251254A1ull),X(0xD93260FC09ull),X(0xD93FAD8B88ull),X(0xD94CF802FCull),X(0xD95A406246ull),X(0xD96786A943ull),X(0xD974CAD7D5ull),X(0xD9820CEDD9ull), \
+	X(0xD98F4CEB2Full),X(0xD99C8ACFB6ull),X(0xD9A9C69B4Eull),X(0xD9B7004DD6ull),X(0xD9C437E72Dull),X(0xD9D16D6734ull),X(0xD9DEA0CDC8ull),X(0xD9EBD21ACAull), \
+	X(0xD9F9014E19ull),X(0xDA062E6795ull),X(0xDA1359671Dull),X(0xDA20824C90ull),X(0xDA2DA917CEull),X(0xDA3ACDC8B7ull),X(0xDA47F05F2Aull),X(0xDA5510DB07ull), \
+	X(0xDA622F3C2Eull),X(0xDA6F4B827Dull),X(0xDA7C65ADD5ull),X(0xDA897DBE15ull),X(0xDA9693B31Eull),X(0xDAA3A78CCEull),X(0xDAB0B94B05ull),X(0xDABDC8EDA4ull), \
+	X(0xDACAD6748Aull),X(0xDAD7E1DF97ull),X(0xDAE4EB2EAAull),X(0xDAF1F261A3ull),X(0xDAFEF77863ull),X(0xDB0BFA72CAull),X(0xDB18FB50B6ull),X(0xDB25FA1208ull), \
+	X(0xDB32F6B6A0ull),X(0xDB3FF13E5Eull),X(0xDB4CE9A922ull),X(0xDB59DFF6CCull),X(0xDB66D4273Bull),X(0xDB73C63A51ull),X(0xDB80B62FECull),X(0xDB8DA407EEull), \
+	X(0xDB9A8FC236ull),X(0xDBA7795EA3ull),X(0xDBB460DD18ull),X(0xDBC1463D73ull),X(0xDBCE297F94ull),X(0xDBDB0AA35Dull),X(0xDBE7E9A8ADull),X(0xDBF4C68F64ull), \
+	X(0xDC01A15762ull),X(0xDC0E7A0089ull),X(0xDC1B508AB8ull),X(0xDC2824F5D0ull),X(0xDC34F741B0ull),X(0xDC41C76E3Aull),X(0xDC4E957B4Dull),X(0xDC5B6168CBull), \
+	X(0xDC682B3693ull),X(0xDC74F2E486ull),X(0xDC81B87284ull),X(0xDC8E7BE06Full),X(0xDC9B3D2E25ull),X(0xDCA7FC5B89ull),X(0xDCB4B9687Aull),X(0xDCC17454D9ull), \
+	X(0xDCCE2D2087ull),X(0xDCDAE3CB64ull),X(0xDCE7985551ull),X(0xDCF44ABE2Eull),X(0xDD00FB05DDull),X(0xDD0DA92C3Eull),X(0xDD1A553131ull),X(0xDD26FF1497ull), \
+	X(0xDD33A6D652ull),X(0xDD404C7641ull),X(0xDD4CEFF447ull),X(0xDD59915042ull),X(0xDD66308A15ull),X(0xDD72CDA1A0ull),X(0xDD7F6896C4ull),X(0xDD8C016963ull), \
+	X(0xDD9898195Cull),X(0xDDA52CA690ull),X(0xDDB1BF10E2ull),X(0xDDBE4F5831ull),X(0xDDCADD7C5Full),X(0xDDD7697D4Dull),X(0xDDE3F35ADCull),X(0xDDF07B14ECull), \
+	X(0xDDFD00AB60ull),X(0xDE09841E17ull),X(0xDE16056CF4ull),X(0xDE228497D7ull),X(0xDE2F019EA1ull),X(0xDE3B7C8135ull),X(0xDE47F53F72ull),X(0xDE546BD93Aull), \
+	X(0xDE60E04E6Full),X(0xDE6D529EF1ull),X(0xDE79C2CAA2ull),X(0xDE8630D163ull),X(0xDE929CB316ull),X(0xDE9F066F9Cull),X(0xDEAB6E06D6ull),X(0xDEB7D378A6ull), \
+	X(0xDEC436C4EDull),X(0xDED097EB8Cull),X(0xDEDCF6EC65ull),X(0xDEE953C75Aull),X(0xDEF5AE7C4Cull),X(0xDF02070B1Cull),X(0xDF0E5D73ACull),X(0xDF1AB1B5DEull), \
+	X(0xDF2703D193ull),X(0xDF3353C6ADull),X(0xDF3FA1950Dull),X(0xDF4BED3C95ull),X(0xDF5836BD27ull),X(0xDF647E16A4ull),X(0xDF70C348EEull),X(0xDF7D0653E7ull), \
+	X(0xDF89473770ull),X(0xDF9585F36Cull),X(0xDFA1C287BCull),X(0xDFADFCF441ull),X(0xDFBA3538DFull),X(0xDFC66B5576ull),X(0xDFD29F49E8ull),X(0xDFDED11618ull), \
+	X(0xDFEB00B9E7ull),X(0xDFF72E3537ull),X(0xE0035987EAull),X(0xE00F82B1E2ull),X(0xE01BA9B301ull),X(0xE027CE8B2Aull),X(0xE033F13A3Dull),X(0xE04011C01Eull), \
+	X(0xE04C301CAEull),X(0xE0584C4FD0ull),X(0xE064665965ull),X(0xE0707E394Full),X(0xE07C93EF71ull),X(0xE088A77BAEull),X(0xE094B8DDE6ull),X(0xE0A0C815FDull), \
+	X(0xE0ACD523D4ull),X(0xE0B8E0074Full),X(0xE0C4E8C04Eull),X(0xE0D0EF4EB5ull),X(0xE0DCF3B266ull),X(0xE0E8F5EB43ull),X(0xE0F4F5F92Full),X(0xE100F3DC0Cull), \
+	X(0xE10CEF93BCull),X(0xE118E92021ull),X(0xE124E0811Full),X(0xE130D5B698ull),X(0xE13CC8C06Eull),X(0xE148B99E83ull),X(0xE154A850BBull),X(0xE16094D6F8ull), \
+	X(0xE16C7F311Cull),X(0xE178675F0Aull),X(0xE1844D60A4ull),X(0xE1903135CEull),X(0xE19C12DE6Aull),X(0xE1A7F25A5Aull),X(0xE1B3CFA982ull),X(0xE1BFAACBC4ull), \
+	X(0xE1CB83C102ull),X(0xE1D75A8921ull),X(0xE1E32F2401ull),X(0xE1EF019186ull),X(0xE1FAD1D194ull),X(0xE2069FE40Cull),X(0xE2126BC8D2ull),X(0xE21E357FC9ull), \
+	X(0xE229FD08D3ull),X(0xE235C263D4ull),X(0xE2418590AEull),X(0xE24D468F44ull),X(0xE259055F7Aull),X(0xE264C20132ull),X(0xE2707C7450ull),X(0xE27C34B8B6ull), \
+	X(0xE287EACE47ull),X(0xE2939EB4E8ull),X(0xE29F506C7Aull),X(0xE2AAFFF4E1ull),X(0xE2B6AD4E00ull),X(0xE2C25877BAull),X(0xE2CE0171F3ull),X(0xE2D9A83C8Eull), \
+	X(0xE2E54CD76Eull),X(0xE2F0EF4276ull),X(0xE2FC8F7D8Aull),X(0xE3082D888Cull),X(0xE313C96361ull),X(0xE31F630DEBull),X(0xE32AFA880Eull),X(0xE3368FD1AEull), \
+	X(0xE34222EAADull),X(0xE34DB3D2EFull),X(0xE359428A59ull),X(0xE364CF10CCull),X(0xE37059662Dull),X(0xE37BE18A5Full),X(0xE387677D46ull),X(0xE392EB3EC5ull), \
+	X(0xE39E6CCEC0ull),X(0xE3A9EC2D1Bull),X(0xE3B56959B8ull),X(0xE3C0E4547Dull),X(0xE3CC5D1D4Cull),X(0xE3D7D3B409ull),X(0xE3E3481897ull),X(0xE3EEBA4ADCull), \
+	X(0xE3FA2A4ABAull),X(0xE405981815ull),X(0xE41103B2D1ull),X(0xE41C6D1AD1ull),X(0xE427D44FFAull),X(0xE433395230ull),X(0xE43E9C2156ull),X(0xE449FCBD50ull), \
+	X(0xE4555B2603ull),X(0xE460B75B51ull),X(0xE46C115D20ull),X(0xE477692B53ull),X(0xE482BEC5CEull),X(0xE48E122C75ull),X(0xE499635F2Cull),X(0xE4A4B25DD7ull), \
+	X(0xE4AFFF285Bull),X(0xE4BB49BE9Cull),X(0xE4C692207Cull),X(0xE4D1D84DE2ull),X(0xE4DD1C46B1ull),X(0xE4E85E0ACDull),X(0xE4F39D9A1Aull),X(0xE4FEDAF47Dull), \
+	X(0xE50A1619DAull),X(0xE5154F0A14ull),X(0xE52085C512ull),X(0xE52BBA4AB6ull),X(0xE536EC9AE6ull),X(0xE5421CB585ull),X(0xE54D4A9A78ull),X(0xE5587649A3ull), \
+	X(0xE5639FC2EBull),X(0xE56EC70635ull),X(0xE579EC1364ull),X(0xE5850EEA5Dull),X(0xE5902F8B05ull),X(0xE59B4DF541ull),X(0xE5A66A28F4ull),X(0xE5B1842604ull), \
+	X(0xE5BC9BEC55ull),X(0xE5C7B17BCCull),X(0xE5D2C4D44Dull),X(0xE5DDD5F5BDull),X(0xE5E8E4E001ull),X(0xE5F3F192FDull),X(0xE5FEFC0E96ull),X(0xE60A0452B2ull), \
+	X(0xE6150A5F34ull),X(0xE6200E3401ull),X(0xE62B0FD0FFull),X(0xE6360F3612ull),X(0xE6410C631Full),X(0xE64C07580Bull),X(0xE6570014BBull),X(0xE661F69913ull), \
+	X(0xE66CEAE4FAull),X(0xE677DCF853ull),X(0xE682CCD303ull),X(0xE68DBA74F1ull),X(0xE698A5DE00ull),X(0xE6A38F0E15ull),X(0xE6AE760517ull),X(0xE6B95AC2EAull), \
+	X(0xE6C43D4773ull),X(0xE6CF1D9297ull),X(0xE6D9FBA43Bull),X(0xE6E4D77C45ull),X(0xE6EFB11A99ull),X(0xE6FA887F1Eull),X(0xE7055DA9B8ull),X(0xE710309A4Dull), \
+	X(0xE71B0150C1ull),X(0xE725CFCCFAull),X(0xE7309C0EDEull),X(0xE73B661652ull),X(0xE7462DE33Bull),X(0xE750F3757Full),X(0xE75BB6CD02ull),X(0xE76677E9ABull), \
+	X(0xE77136CB5Full),X(0xE77BF37204ull),X(0xE786ADDD7Eull),X(0xE791660DB4ull),X(0xE79C1C028Bull),X(0xE7A6CFBBE8ull),X(0xE7B18139B2ull),X(0xE7BC307BCEull), \
+	X(0xE7C6DD8220ull),X(0xE7D1884C90ull),X(0xE7DC30DB03ull),X(0xE7E6D72D5Eull),X(0xE7F17B4388ull),X(0xE7FC1D1D65ull),X(0xE806BCBADCull),X(0xE8115A1BD3ull), \
+	X(0xE81BF5402Eull),X(0xE8268E27D5ull),X(0xE83124D2ADull),X(0xE83BB9409Cull),X(0xE8464B7188ull),X(0xE850DB6556ull),X(0xE85B691BEDull),X(0xE865F49532ull), \
+	X(0xE8707DD10Cull),X(0xE87B04CF61ull),X(0xE885899016ull),X(0xE8900C1311ull),X(0xE89A8C583Aull),X(0xE8A50A5F75ull),X(0xE8AF8628A9ull),X(0xE8B9FFB3BCull), \
+	X(0xE8C4770094ull),X(0xE8CEEC0F18ull),X(0xE8D95EDF2Dull),X(0xE8E3CF70BAull),X(0xE8EE3DC3A5ull),X(0xE8F8A9D7D4ull),X(0xE90313AD2Eull),X(0xE90D7B4399ull), \
+	X(0xE917E09AFBull),X(0xE92243B33Aull),X(0xE92CA48C3Eull),X(0xE9370325EBull),X(0xE9415F802Aull),X(0xE94BB99ADFull),X(0xE9561175F3ull),X(0xE96067114Aull), \
+	X(0xE96ABA6CCCull),X(0xE9750B885Full),X(0xE97F5A63E9ull),X(0xE989A6FF52ull),X(0xE993F15A80ull),X(0xE99E397559ull),X(0xE9A87F4FC4ull),X(0xE9B2C2E9A8ull), \
+	X(0xE9BD0442EBull),X(0xE9C7435B75ull),X(0xE9D180332Bull),X(0xE9DBBAC9F5ull),X(0xE9E5F31FB9ull),X(0xE9F029345Eull),X(0xE9FA5D07CBull),X(0xEA048E99E6ull), \
+	X(0xEA0EBDEA98ull),X(0xEA18EAF9C5ull),X(0xEA2315C756ull),X(0xEA2D3E5331ull),X(0xEA37649D3Eull),X(0xEA4188A562ull),X(0xEA4BAA6B86ull),X(0xEA55C9EF90ull), \
+	X(0xEA5FE73167ull),X(0xEA6A0230F2ull),X(0xEA741AEE18ull),X(0xEA7E3168C1ull),X(0xEA8845A0D3ull),X(0xEA92579635ull),X(0xEA9C6748D0ull),X(0xEAA674B889ull), \
+	X(0xEAB07FE548ull),X(0xEABA88CEF5ull),X(0xEAC48F7576ull),X(0xEACE93D8B3ull),X(0xEAD895F893ull),X(0xEAE295D4FEull),X(0xEAEC936DDAull),X(0xEAF68EC30Full), \
+	X(0xEB0087D485ull),X(0xEB0A7EA223ull),X(0xEB14732BD0ull),X(0xEB1E657173ull),X(0xEB285572F5ull),X(0xEB3243303Cull),X(0xEB3C2EA931ull),X(0xEB4617DDBAull), \
+	X(0xEB4FFECDBFull),X(0xEB59E37929ull),X(0xEB63C5DFDDull),X(0xEB6DA601C4ull),X(0xEB7783DEC6ull),X(0xEB815F76CBull),X(0xEB8B38C9B9ull),X(0xEB950FD779ull), \
+	X(0xEB9EE49FF2ull),X(0xEBA8B7230Dull),X(0xEBB28760B0ull),X(0xEBBC5558C4ull),X(0xEBC6210B30ull),X(0xEBCFEA77DDull),X(0xEBD9B19EB1ull),X(0xEBE3767F96ull), \
+	X(0xEBED391A73ull),X(0xEBF6F96F2Full),X(0xEC00B77DB3ull),X(0xEC0A7345E7ull),X(0xEC142CC7B3ull),X(0xEC1DE402FFull),X(0xEC2798F7B2ull),X(0xEC314BA5B5ull), \
+	X(0xEC3AFC0CF0ull),X(0xEC44AA2D4Aull),X(0xEC4E5606ADull),X(0xEC57FF9900ull),X(0xEC61A6E42Cull),X(0xEC6B4BE818ull),X(0xEC74EEA4ACull),X(0xEC7E8F19D2ull), \
+	X(0xEC882D4771ull),X(0xEC91C92D71ull),X(0xEC9B62CBBCull),X(0xECA4FA2238ull),X(0xECAE8F30CFull),X(0xECB821F768ull),X(0xECC1B275EDull),X(0xECCB40AC45ull), \
+	X(0xECD4CC9A5Aull),X(0xECDE564012ull),X(0xECE7DD9D58ull),X(0xECF162B213ull),X(0xECFAE57E2Cull),X(0xED0466018Bull),X(0xED0DE43C19ull),X(0xED17602DBFull), \
+	X(0xED20D9D665ull),X(0xED2A5135F4ull),X(0xED33C64C54ull),X(0xED3D39196Full),X(0xED46A99D2Cull),X(0xED5017D775ull),X(0xED5983C831ull),X(0xED62ED6F4Bull), \
+	X(0xED6C54CCABull),X(0xED75B9E039ull),X(0xED7F1CA9DEull),X(0xED887D2984ull),X(0xED91DB5F13ull),X(0xED9B374A74ull),X(0xEDA490EB8Full),X(0xEDADE8424Full), \
+	X(0xEDB73D4E9Bull),X(0xEDC090105Dull),X(0xEDC9E0877Dull),X(0xEDD32EB3E5ull),X(0xEDDC7A957Eull),X(0xEDE5C42C31ull),X(0xEDEF0B77E7ull),X(0xEDF8507889ull), \
+	X(0xEE01932E00ull),X(0xEE0AD39835ull),X(0xEE1411B712ull),X(0xEE1D4D8A7Full),X(0xEE26871267ull),X(0xEE2FBE4EB1ull),X(0xEE38F33F48ull),X(0xEE4225E414ull), \
+	X(0xEE4B563D00ull),X(0xEE548449F4ull),X(0xEE5DB00AD9ull),X(0xEE66D97F99ull),X(0xEE7000A81Eull),X(0xEE79258451ull),X(0xEE8248141Bull),X(0xEE8B685765ull), \
+	X(0xEE94864E1Aull),X(0xEE9DA1F823ull),X(0xEEA6BB5569ull),X(0xEEAFD265D5ull),X(0xEEB8E72952ull),X(0xEEC1F99FC9ull),X(0xEECB09C924ull),X(0xEED417A54Cull), \
+	X(0xEEDD23342Aull),X(0xEEE62C75AAull),X(0xEEEF3369B3ull),X(0xEEF8381030ull),X(0xEF013A690Cull),X(0xEF0A3A742Eull),X(0xEF13383182ull),X(0xEF1C33A0F1ull), \
+	X(0xEF252CC265ull),X(0xEF2E2395C8ull),X(0xEF37181B03ull),X(0xEF400A5202ull),X(0xEF48FA3AACull),X(0xEF51E7D4EDull),X(0xEF5AD320AFull),X(0xEF63BC1DDBull), \
+	X(0xEF6CA2CC5Bull),X(0xEF75872C1Aull),X(0xEF7E693D01ull),X(0xEF8748FEFBull),X(0xEF902671F2ull),X(0xEF990195D0ull),X(0xEFA1DA6A7Full),X(0xEFAAB0EFE8ull), \
+	X(0xEFB38525F8ull),X(0xEFBC570C96ull),X(0xEFC526A3AFull),X(0xEFCDF3EB2Cull),X(0xEFD6BEE2F7ull),X(0xEFDF878AFAull),X(0xEFE84DE321ull),X(0xEFF111EB55ull), \
+	X(0xEFF9D3A381ull),X(0xF002930B8Full),X(0xF00B502369ull),X(0xF0140AEAFBull),X(0xF01CC3622Dull),X(0xF0257988ECull),X(0xF02E2D5F21ull),X(0xF036DEE4B7ull), \
+	X(0xF03F8E1999ull),X(0xF0483AFDB0ull),X(0xF050E590E9ull),X(0xF0598DD32Cull),X(0xF06233C466ull),X(0xF06AD76480ull),X(0xF07378B365ull),X(0xF07C17B100ull), \
+	X(0xF084B45D3Cull),X(0xF08D4EB804ull),X(0xF095E6C141ull),X(0xF09E7C78E0ull),X(0xF0A70FDECAull),X(0xF0AFA0F2EBull),X(0xF0B82FB52Eull),X(0xF0C0BC257Dull), \
+	X(0xF0C94643C4ull),X(0xF0D1CE0FECull),X(0xF0DA5389E2ull),X(0xF0E2D6B190ull),X(0xF0EB5786E1ull),X(0xF0F3D609C1ull),X(0xF0FC523A19ull),X(0xF104CC17D6ull), \
+	X(0xF10D43A2E2ull),X(0xF115B8DB29ull),X(0xF11E2BC096ull),X(0xF1269C5313ull),X(0xF12F0A928Cull),X(0xF137767EECull),X(0xF13FE0181Full),X(0xF148475E10ull), \
+	X(0xF150AC50A9ull),X(0xF1590EEFD6ull),X(0xF1616F3B83ull),X(0xF169CD339Bull),X(0xF17228D808ull),X(0xF17A8228B8ull),X(0xF182D92594ull),X(0xF18B2DCE89ull), \
+	X(0xF193802381ull),X(0xF19BD02469ull),X(0xF1A41DD12Cull),X(0xF1AC6929B5ull),X(0xF1B4B22DEFull),X(0xF1BCF8DDC7ull),X(0xF1C53D3928ull),X(0xF1CD7F3FFEull), \
+	X(0xF1D5BEF234ull),X(0xF1DDFC4FB5ull),X(0xF1E637586Eull),X(0xF1EE700C4Aull),X(0xF1F6A66B36ull),X(0xF1FEDA751Bull),X(0xF2070C29E8ull),X(0xF20F3B8986ull), \
+	X(0xF2176893E2ull),X(0xF21F9348E8ull),X(0xF227BBA884ull),X(0xF22FE1B2A2ull),X(0xF23805672Cull),X(0xF24026C610ull),X(0xF24845CF3Aull),X(0xF250628294ull), \
+	X(0xF2587CE00Cull),X(0xF26094E78Dull),X(0xF268AA9904ull),X(0xF270BDF45Bull),X(0xF278CEF980ull),X(0xF280DDA85Full),X(0xF288EA00E3ull),X(0xF290F402F9ull), \
+	X(0xF298FBAE8Dull),X(0xF2A101038Bull),X(0xF2A90401DFull),X(0xF2B104A976ull),X(0xF2B902FA3Bull),X(0xF2C0FEF41Cull),X(0xF2C8F89704ull),X(0xF2D0EFE2E0ull), \
+	X(0xF2D8E4D79Bull),X(0xF2E0D77524ull),X(0xF2E8C7BB64ull),X(0xF2F0B5AA4Bull),X(0xF2F8A141C2ull),X(0xF3008A81B8ull),X(0xF308716A19ull),X(0xF31055FAD0ull), \
+	X(0xF3183833CBull),X(0xF3201814F7ull),X(0xF327F59E3Full),X(0xF32FD0CF90ull),X(0xF337A9A8D7ull),X(0xF33F802A01ull),X(0xF3475452FAull),X(0xF34F2623AFull), \
+	X(0xF356F59C0Dull),X(0xF35EC2BC00ull),X(0xF3668D8375ull),X(0xF36E55F259ull),X(0xF3761C0898ull),X(0xF37DDFC620ull),X(0xF385A12ADEull),X(0xF38D6036BEull), \
+	X(0xF3951CE9ACull),X(0xF39CD74397ull),X(0xF3A48F446Bull),X(0xF3AC44EC14ull),X(0xF3B3F83A81ull),X(0xF3BBA92F9Dull),X(0xF3C357CB56ull),X(0xF3CB040D99ull), \
+	X(0xF3D2ADF653ull),X(0xF3DA558571ull),X(0xF3E1FABAE0ull),X(0xF3E99D968Eull),X(0xF3F13E1867ull),X(0xF3F8DC4059ull),X(0xF400780E51ull),X(0xF40811823Bull), \
+	X(0xF40FA89C06ull),X(0xF4173D5B9Full),X(0xF41ECFC0F3ull),X(0xF4265FCBEFull),X(0xF42DED7C80ull),X(0xF43578D295ull),X(0xF43D01CE19ull),X(0xF444886EFCull), \
+	X(0xF44C0CB52Aull),X(0xF4538EA090ull),X(0xF45B0E311Cull),X(0xF4628B66BCull),X(0xF46A06415Dull),X(0xF4717EC0EDull),X(0xF478F4E559ull),X(0xF48068AE8Eull), \
+	X(0xF487DA1C7Cull),X(0xF48F492F0Eull),X(0xF496B5E633ull),X(0xF49E2041D8ull),X(0xF4A58841EBull),X(0xF4ACEDE65Bull),X(0xF4B4512F14ull),X(0xF4BBB21C04ull), \
+	X(0xF4C310AD19ull),X(0xF4CA6CE241ull),X(0xF4D1C6BB6Aull),X(0xF4D91E3882ull),X(0xF4E0735976ull),X(0xF4E7C61E35ull),X(0xF4EF1686ACull),X(0xF4F66492C9ull), \
+	X(0xF4FDB0427Bull),X(0xF504F995AFull),X(0xF50C408C54ull),X(0xF513852656ull),X(0xF51AC763A6ull),X(0xF52207442Full),X(0xF52944C7E2ull),X(0xF5307FEEABull), \
+	X(0xF537B8B879ull),X(0xF53EEF253Aull),X(0xF5462334DCull),X(0xF54D54E74Full),X(0xF554843C7Eull),X(0xF55BB1345Aull),X(0xF562DBCED1ull),X(0xF56A040BD0ull), \
+	X(0xF57129EB46ull),X(0xF5784D6D21ull),X(0xF57F6E9150ull),X(0xF5868D57C1ull),X(0xF58DA9C063ull),X(0xF594C3CB24ull),X(0xF59BDB77F3ull),X(0xF5A2F0C6BDull), \
+	X(0xF5AA03B773ull),X(0xF5B1144A01ull),X(0xF5B8227E57ull),X(0xF5BF2E5463ull),X(0xF5C637CC14ull),X(0xF5CD3EE559ull),X(0xF5D443A01Full),X(0xF5DB45FC57ull), \
+	X(0xF5E245F9EEull),X(0xF5E94398D4ull),X(0xF5F03ED8F6ull),X(0xF5F737BA45ull),X(0xF5FE2E3CAEull),X(0xF605226020ull),X(0xF60C14248Bull),X(0xF6130389DDull), \
+	X(0xF619F09005ull),X(0xF620DB36F2ull),X(0xF627C37E92ull),X(0xF62EA966D6ull),X(0xF6358CEFABull),X(0xF63C6E1902ull),X(0xF6434CE2C8ull),X(0xF64A294CEDull), \
+	X(0xF651035760ull),X(0xF657DB0210ull),X(0xF65EB04CECull),X(0xF6658337E3ull),X(0xF66C53C2E5ull),X(0xF67321EDE1ull),X(0xF679EDB8C5ull),X(0xF680B72382ull), \
+	X(0xF6877E2E06ull),X(0xF68E42D840ull),X(0xF695052221ull),X(0xF69BC50B97ull),X(0xF6A2829491ull),X(0xF6A93DBCFFull),X(0xF6AFF684D1ull),X(0xF6B6ACEBF6ull), \
+	X(0xF6BD60F25Cull),X(0xF6C41297F5ull),X(0xF6CAC1DCAEull),X(0xF6D16EC079ull),X(0xF6D8194343ull),X(0xF6DEC164FDull),X(0xF6E5672597ull),X(0xF6EC0A84FFull), \
+	X(0xF6F2AB8326ull),X(0xF6F94A1FFBull),X(0xF6FFE65B6Eull),X(0xF70680356Full),X(0xF70D17ADECull),X(0xF713ACC4D7ull),X(0xF71A3F7A1Full),X(0xF720CFCDB3ull), \
+	X(0xF7275DBF83ull),X(0xF72DE94F80ull),X(0xF734727D98ull),X(0xF73AF949BDull),X(0xF7417DB3DDull),X(0xF747FFBBE9ull),X(0xF74E7F61D1ull),X(0xF754FCA584ull), \
+	X(0xF75B7786F3ull),X(0xF761F0060Dull),X(0xF7686622C3ull),X(0xF76ED9DD05ull),X(0xF7754B34C2ull),X(0xF77BBA29ECull),X(0xF78226BC71ull),X(0xF78890EC43ull), \
+	X(0xF78EF8B951ull),X(0xF7955E238Bull),X(0xF79BC12AE2ull),X(0xF7A221CF46ull),X(0xF7A88010A8ull),X(0xF7AEDBEEF7ull),X(0xF7B5356A24ull),X(0xF7BB8C821Full), \
+	X(0xF7C1E136D8ull),X(0xF7C8338841ull),X(0xF7CE837648ull),X(0xF7D4D100E0ull),X(0xF7DB1C27F8ull),X(0xF7E164EB80ull),X(0xF7E7AB4B6Aull),X(0xF7EDEF47A5ull), \
+	X(0xF7F430E022ull),X(0xF7FA7014D2ull),X(0xF800ACE5A6ull),X(0xF806E7528Eull),X(0xF80D1F5B7Aull),X(0xF81355005Bull),X(0xF819884122ull),X(0xF81FB91DC0ull), \
+	X(0xF825E79626ull),X(0xF82C13AA43ull),X(0xF8323D5A0Aull),X(0xF83864A56Aull),X(0xF83E898C54ull),X(0xF844AC0EBAull),X(0xF84ACC2C8Cull),X(0xF850E9E5BBull), \
+	X(0xF857053A38ull),X(0xF85D1E29F4ull),X(0xF86334B4E0ull),X(0xF86948DAEDull),X(0xF86F5A9C0Cull),X(0xF87569F82Eull),X(0xF87B76EF43ull),X(0xF88181813Eull), \
+	X(0xF88789AE0Eull),X(0xF88D8F75A6ull),X(0xF89392D7F6ull),X(0xF89993D4F0ull),X(0xF89F926C84ull),X(0xF8A58E9EA4ull),X(0xF8AB886B42ull),X(0xF8B17FD24Eull), \
+	X(0xF8B774D3B9ull),X(0xF8BD676F76ull),X(0xF8C357A575ull),X(0xF8C94575A7ull),X(0xF8CF30DFFFull),X(0xF8D519E46Dull),X(0xF8DB0082E2ull),X(0xF8E0E4BB51ull), \
+	X(0xF8E6C68DABull),X(0xF8ECA5F9E1ull),X(0xF8F282FFE5ull),X(0xF8F85D9FA8ull),X(0xF8FE35D91Cull),X(0xF9040BAC32ull),X(0xF909DF18DCull),X(0xF90FB01F0Cull), \
+	X(0xF9157EBEB3ull),X(0xF91B4AF7C3ull),X(0xF92114CA2Eull),X(0xF926DC35E5ull),X(0xF92CA13ADAull),X(0xF93263D8FFull),X(0xF938241046ull),X(0xF93DE1E0A0ull), \
+	X(0xF9439D49FFull),X(0xF949564C56ull),X(0xF94F0CE796ull),X(0xF954C11BB0ull),X(0xF95A72E898ull),X(0xF960224E3Eull),X(0xF965CF4C95ull),X(0xF96B79E38Full), \
+	X(0xF97122131Dull),X(0xF976C7DB33ull),X(0xF97C6B3BC1ull),X(0xF9820C34BBull),X(0xF987AAC611ull),X(0xF98D46EFB7ull),X(0xF992E0B19Eull),X(0xF998780BB9ull), \
+	X(0xF99E0CFDF9ull),X(0xF9A39F8852ull),X(0xF9A92FAAB4ull),X(0xF9AEBD6514ull),X(0xF9B448B762ull),X(0xF9B9D1A191ull),X(0xF9BF582394ull),X(0xF9C4DC3D5Cull), \
+	X(0xF9CA5DEEDDull),X(0xF9CFDD3809ull),X(0xF9D55A18D2ull),X(0xF9DAD4912Aull),X(0xF9E04CA104ull),X(0xF9E5C24853ull),X(0xF9EB358709ull),X(0xF9F0A65D18ull), \
+	X(0xF9F614CA74ull),X(0xF9FB80CF0Eull),X(0xFA00EA6ADAull),X(0xFA06519DCAull),X(0xFA0BB667D1ull),X(0xFA1118C8E1ull),X(0xFA1678C0EEull),X(0xFA1BD64FE9ull), \
+	X(0xFA213175C6ull),X(0xFA268A3277ull),X(0xFA2BE085F0ull),X(0xFA31347022ull),X(0xFA3685F102ull),X(0xFA3BD50881ull),X(0xFA4121B693ull),X(0xFA466BFB2Bull), \
+	X(0xFA4BB3D63Bull),X(0xFA50F947B7ull),X(0xFA563C4F91ull),X(0xFA5B7CEDBDull),X(0xFA60BB222Eull),X(0xFA65F6ECD6ull),X(0xFA6B304DA9ull),X(0xFA70674499ull), \
+	X(0xFA759BD19Bull),X(0xFA7ACDF4A1ull),X(0xFA7FFDAD9Eull),X(0xFA852AFC86ull),X(0xFA8A55E14Bull),X(0xFA8F7E5BE2ull),X(0xFA94A46C3Dull),X(0xFA99C8124Full), \
+	X(0xFA9EE94E0Cull),X(0xFAA4081F68ull),X(0xFAA9248655ull),X(0xFAAE3E82C7ull),X(0xFAB35614B1ull),X(0xFAB86B3C07ull),X(0xFABD7DF8BDull),X(0xFAC28E4AC5ull), \
+	X(0xFAC79C3214ull),X(0xFACCA7AE9Cull),X(0xFAD1B0C052ull),X(0xFAD6B76729ull),X(0xFADBBBA314ull),X(0xFAE0BD7407ull),X(0xFAE5BCD9F7ull),X(0xFAEAB9D4D5ull), \
+	X(0xFAEFB46497ull),X(0xFAF4AC8930ull),X(0xFAF9A24294ull),X(0xFAFE9590B5ull),X(0xFB03867389ull),X(0xFB0874EB03ull),X(0xFB0D60F717ull),X(0xFB124A97B8ull), \
+	X(0xFB1731CCDBull),X(0xFB1C169674ull),X(0xFB20F8F475ull),X(0xFB25D8E6D5ull),X(0xFB2AB66D85ull),X(0xFB2F91887Bull),X(0xFB346A37AAull),X(0xFB39407B06ull), \
+	X(0xFB3E145284ull),X(0xFB42E5BE17ull),X(0xFB47B4BDB4ull),X(0xFB4C81514Eull),X(0xFB514B78DBull),X(0xFB5613344Eull),X(0xFB5AD8839Aull),X(0xFB5F9B66B6ull), \
+	X(0xFB645BDD94ull),X(0xFB6919E829ull),X(0xFB6DD5866Aull),X(0xFB728EB84Aull),X(0xFB77457DBFull),X(0xFB7BF9D6BBull),X(0xFB80ABC335ull),X(0xFB855B431Full), \
+	X(0xFB8A085670ull),X(0xFB8EB2FD1Aull),X(0xFB935B3713ull),X(0xFB9801044Full),X(0xFB9CA464C3ull),X(0xFBA1455863ull),X(0xFBA5E3DF23ull),X(0xFBAA7FF8F9ull), \
+	X(0xFBAF19A5D9ull),X(0xFBB3B0E5B8ull),X(0xFBB845B88Aull),X(0xFBBCD81E43ull),X(0xFBC16816DAull),X(0xFBC5F5A242ull),X(0xFBCA80C070ull),X(0xFBCF09715Aull), \
+	X(0xFBD38FB4F3ull),X(0xFBD8138B31ull),X(0xFBDC94F408ull),X(0xFBE113EF6Eull),X(0xFBE5907D57ull),X(0xFBEA0A9DB8ull),X(0xFBEE825087ull),X(0xFBF2F795B8ull), \
+	X(0xFBF76A6D40ull),X(0xFBFBDAD714ull),X(0xFC0048D329ull),X(0xFC04B46175ull),X(0xFC091D81ECull),X(0xFC0D843483ull),X(0xFC11E87931ull),X(0xFC164A4FE9ull), \
+	X(0xFC1AA9B8A1ull),X(0xFC1F06B34Eull),X(0xFC23613FE6ull),X(0xFC27B95E5Eull),X(0xFC2C0F0EABull),X(0xFC306250C1ull),X(0xFC34B32498ull),X(0xFC39018A24ull), \
+	X(0xFC3D4D8159ull),X(0xFC41970A2Full),X(0xFC45DE249Aull),X(0xFC4A22D08Full),X(0xFC4E650E05ull),X(0xFC52A4DCF0ull),X(0xFC56E23D46ull),X(0xFC5B1D2EFDull), \
+	X(0xFC5F55B20Bull),X(0xFC638BC663ull),X(0xFC67BF6BFEull),X(0xFC6BF0A2CFull),X(0xFC701F6ACDull),X(0xFC744BC3EEull),X(0xFC7875AE26ull),X(0xFC7C9D296Cull), \
+	X(0xFC80C235B6ull),X(0xFC84E4D2F9ull),X(0xFC8905012Cull),X(0xFC8D22C043ull),X(0xFC913E1035ull),X(0xFC9556F0F8ull),X(0xFC996D6281ull),X(0xFC9D8164C7ull), \
+	X(0xFCA192F7BFull),X(0xFCA5A21B5Full),X(0xFCA9AECF9Eull),X(0xFCADB91471ull),X(0xFCB1C0E9CEull),X(0xFCB5C64FACull),X(0xFCB9C94601ull),X(0xFCBDC9CCC2ull), \
+	X(0xFCC1C7E3E5ull),X(0xFCC5C38B62ull),X(0xFCC9BCC32Eull),X(0xFCCDB38B3Full),X(0xFCD1A7E38Bull),X(0xFCD599CC09ull),X(0xFCD98944AFull),X(0xFCDD764D74ull), \
+	X(0xFCE160E64Dull),X(0xFCE5490F31ull),X(0xFCE92EC816ull),X(0xFCED1210F3ull),X(0xFCF0F2E9BEull),X(0xFCF4D1526Dull),X(0xFCF8AD4AF8ull),X(0xFCFC86D354ull), \
+	X(0xFD005DEB77ull),X(0xFD0432935Aull),X(0xFD0804CAF1ull),X(0xFD0BD49234ull),X(0xFD0FA1E919ull),X(0xFD136CCF97ull),X(0xFD173545A4ull),X(0xFD1AFB4B37ull), \
+	X(0xFD1EBEE047ull),X(0xFD228004CBull),X(0xFD263EB8B9ull),X(0xFD29FAFC08ull),X(0xFD2DB4CEAEull),X(0xFD316C30A4ull),X(0xFD352121DEull),X(0xFD38D3A255ull), \
+	X(0xFD3C83B200ull),X(0xFD403150D4ull),X(0xFD43DC7EC9ull),X(0xFD47853BD6ull),X(0xFD4B2B87F2ull),X(0xFD4ECF6314ull),X(0xFD5270CD33ull),X(0xFD560FC645ull), \
+	X(0xFD59AC4E43ull),X(0xFD5D466523ull),X(0xFD60DE0ADCull),X(0xFD64733F66ull),X(0xFD680602B7ull),X(0xFD6B9654C6ull),X(0xFD6F24358Cull),X(0xFD72AFA4FEull), \
+	X(0xFD7638A316ull),X(0xFD79BF2FC8ull),X(0xFD7D434B0Eull),X(0xFD80C4F4DEull),X(0xFD84442D30ull),X(0xFD87C0F3FAull),X(0xFD8B3B4936ull),X(0xFD8EB32CD8ull), \
+	X(0xFD92289EDBull),X(0xFD959B9F34ull),X(0xFD990C2DDBull),X(0xFD9C7A4AC8ull),X(0xFD9FE5F5F2ull),X(0xFDA34F2F51ull),X(0xFDA6B5F6DCull),X(0xFDAA1A4C8Cull), \
+	X(0xFDAD7C3057ull),X(0xFDB0DBA235ull),X(0xFDB438A21Full),X(0xFDB793300Bull),X(0xFDBAEB4BF1ull),X(0xFDBE40F5CAull),X(0xFDC1942D8Cull),X(0xFDC4E4F331ull), \
+	X(0xFDC83346AFull),X(0xFDCB7F27FEull),X(0xFDCEC89716ull),X(0xFDD20F93F0ull),X(0xFDD5541E83ull),X(0xFDD89636C7ull),X(0xFDDBD5DCB3ull),X(0xFDDF131041ull), \
+	X(0xFDE24DD167ull),X(0xFDE586201Full),X(0xFDE8BBFC60ull),X(0xFDEBEF6621ull),X(0xFDEF205D5Cull),X(0xFDF24EE209ull),X(0xFDF57AF41Full),X(0xFDF8A49396ull), \
+	X(0xFDFBCBC067ull),X(0xFDFEF07A8Bull),X(0xFE0212C1F9ull),X(0xFE053296A9ull),X(0xFE084FF894ull),X(0xFE0B6AE7B3ull),X(0xFE0E8363FDull),X(0xFE11996D6Aull), \
+	X(0xFE14AD03F5ull),X(0xFE17BE2794ull),X(0xFE1ACCD840ull),X(0xFE1DD915F1ull),X(0xFE20E2E0A1ull),X(0xFE23EA3847ull),X(0xFE26EF1CDCull),X(0xFE29F18E59ull), \
+	X(0xFE2CF18CB7ull),X(0xFE2FEF17EDull),X(0xFE32EA2FF4ull),X(0xFE35E2D4C6ull),X(0xFE38D9065Aull),X(0xFE3BCCC4AAull),X(0xFE3EBE0FADull),X(0xFE41ACE75Eull), \
+	X(0xFE44994BB5ull),X(0xFE47833CAAull),X(0xFE4A6ABA36ull),X(0xFE4D4FC452ull),X(0xFE50325AF7ull),X(0xFE53127E1Eull),X(0xFE55F02DC0ull),X(0xFE58CB69D6ull), \
+	X(0xFE5BA43258ull),X(0xFE5E7A873Full),X(0xFE614E6886ull),X(0xFE641FD624ull),X(0xFE66EED012ull),X(0xFE69BB564Bull),X(0xFE6C8568C6ull),X(0xFE6F4D077Dull), \
+	X(0xFE72123269ull),X(0xFE74D4E983ull),X(0xFE77952CC5ull),X(0xFE7A52FC28ull),X(0xFE7D0E57A4ull),X(0xFE7FC73F34ull),X(0xFE827DB2D0ull),X(0xFE8531B272ull), \
+	X(0xFE87E33E12ull),X(0xFE8A9255ACull),X(0xFE8D3EF937ull),X(0xFE8FE928ADull),X(0xFE9290E408ull),X(0xFE95362B41ull),X(0xFE97D8FE51ull),X(0xFE9A795D33ull), \
+	X(0xFE9D1747DFull),X(0xFE9FB2BE4Full),X(0xFEA24BC07Dull),X(0xFEA4E24E62ull),X(0xFEA77667F8ull),X(0xFEAA080D39ull),X(0xFEAC973E1Dull),X(0xFEAF23FAA0ull), \
+	X(0xFEB1AE42BAull),X(0xFEB4361665ull),X(0xFEB6BB759Cull),X(0xFEB93E6057ull),X(0xFEBBBED691ull),X(0xFEBE3CD844ull),X(0xFEC0B86569ull),X(0xFEC3317DFAull), \
+	X(0xFEC5A821F1ull),X(0xFEC81C5148ull),X(0xFECA8E0BF9ull),X(0xFECCFD51FEull),X(0xFECF6A2351ull),X(0xFED1D47FEBull),X(0xFED43C67C8ull),X(0xFED6A1DAE1ull), \
+	X(0xFED904D930ull),X(0xFEDB6562AFull),X(0xFEDDC37759ull),X(0xFEE01F1727ull),X(0xFEE2784214ull),X(0xFEE4CEF81Aull),X(0xFEE7233932ull),X(0xFEE9750559ull), \
+	X(0xFEEBC45C87ull),X(0xFEEE113EB7ull),X(0xFEF05BABE3ull),X(0xFEF2A3A406ull),X(0xFEF4E9271Aull),X(0xFEF72C3519ull),X(0xFEF96CCDFEull),X(0xFEFBAAF1C4ull), \
+	X(0xFEFDE6A064ull),X(0xFF001FD9DAull),X(0xFF02569E1Full),X(0xFF048AED2Eull),X(0xFF06BCC703ull),X(0xFF08EC2B97ull),X(0xFF0B191AE4ull),X(0xFF0D4394E7ull), \
+	X(0xFF0F6B9999ull),X(0xFF119128F5ull),X(0xFF13B442F5ull),X(0xFF15D4E795ull),X(0xFF17F316D0ull),X(0xFF1A0ED09Full),X(0xFF1C2814FEull),X(0xFF1E3EE3E7ull), \
+	X(0xFF20533D56ull),X(0xFF22652145ull),X(0xFF24748FB0ull),X(0xFF26818890ull),X(0xFF288C0BE2ull),X(0xFF2A9419A0ull),X(0xFF2C99B1C4ull),X(0xFF2E9CD44Bull), \
+	X(0xFF309D812Eull),X(0xFF329BB86Aull),X(0xFF349779F9ull),X(0xFF3690C5D6ull),X(0xFF38879BFDull),X(0xFF3A7BFC68ull),X(0xFF3C6DE713ull),X(0xFF3E5D5BF9ull), \
+	X(0xFF404A5B15ull),X(0xFF4234E463ull),X(0xFF441CF7DDull),X(0xFF46029580ull),X(0xFF47E5BD45ull),X(0xFF49C66F29ull),X(0xFF4BA4AB28ull),X(0xFF4D80713Bull), \
+	X(0xFF4F59C160ull),X(0xFF51309B91ull),X(0xFF5304FFC9ull),X(0xFF54D6EE05ull),X(0xFF56A6663Full),X(0xFF58736874ull),X(0xFF5A3DF49Full),X(0xFF5C060ABAull), \
+	X(0xFF5DCBAAC3ull),X(0xFF5F8ED4B5ull),X(0xFF614F888Bull),X(0xFF630DC640ull),X(0xFF64C98DD2ull),X(0xFF6682DF3Bull),X(0xFF6839BA77ull),X(0xFF69EE1F81ull), \
+	X(0xFF6BA00E57ull),X(0xFF6D4F86F3ull),X(0xFF6EFC8951ull),X(0xFF70A7156Eull),X(0xFF724F2B45ull),X(0xFF73F4CAD1ull),X(0xFF7597F410ull),X(0xFF7738A6FCull), \
+	X(0xFF78D6E393ull),X(0xFF7A72A9CFull),X(0xFF7C0BF9ADull),X(0xFF7DA2D32Aull),X(0xFF7F373640ull),X(0xFF80C922ECull),X(0xFF8258992Bull),X(0xFF83E598F8ull), \
+	X(0xFF85702250ull),X(0xFF86F8352Full),X(0xFF887DD190ull),X(0xFF8A00F771ull),X(0xFF8B81A6CEull),X(0xFF8CFFDFA2ull),X(0xFF8E7BA1EBull),X(0xFF8FF4EDA4ull), \
+	X(0xFF916BC2C9ull),X(0xFF92E02158ull),X(0xFF9452094Dull),X(0xFF95C17AA4ull),X(0xFF972E7559ull),X(0xFF9898F96Aull),X(0xFF9A0106D2ull),X(0xFF9B669D8Eull), \
+	X(0xFF9CC9BD9Aull),X(0xFF9E2A66F4ull),X(0xFF9F889998ull),X(0xFFA0E45582ull),X(0xFFA23D9AAFull),X(0xFFA394691Cull),X(0xFFA4E8C0C5ull),X(0xFFA63AA1A8ull), \
+	X(0xFFA78A0BC0ull),X(0xFFA8D6FF0Bull),X(0xFFAA217B86ull),X(0xFFAB69812Dull),X(0xFFACAF0FFDull),X(0xFFADF227F2ull),X(0xFFAF32C90Bull),X(0xFFB070F344ull), \
+	X(0xFFB1ACA699ull),X(0xFFB2E5E308ull),X(0xFFB41CA88Dull),X(0xFFB550F727ull),X(0xFFB682CED0ull),X(0xFFB7B22F88ull),X(0xFFB8DF194Aull),X(0xFFBA098C15ull), \
+	X(0xFFBB3187E4ull),X(0xFFBC570CB6ull),X(0xFFBD7A1A87ull),X(0xFFBE9AB154ull),X(0xFFBFB8D11Bull),X(0xFFC0D479D9ull),X(0xFFC1EDAB8Cull),X(0xFFC3046630ull), \
+	X(0xFFC418A9C3ull),X(0xFFC52A7642ull),X(0xFFC639CBAAull),X(0xFFC746A9FAull),X(0xFFC851112Eull),X(0xFFC9590144ull),X(0xFFCA5E7A39ull),X(0xFFCB617C0Bull), \
+	X(0xFFCC6206B7ull),X(0xFFCD601A3Aull),X(0xFFCE5BB693ull),X(0xFFCF54DBBFull),X(0xFFD04B89BCull),X(0xFFD13FC086ull),X(0xFFD231801Dull),X(0xFFD320C87Dull), \
+	X(0xFFD40D99A3ull),X(0xFFD4F7F38Full),X(0xFFD5DFD63Dull),X(0xFFD6C541ACull),X(0xFFD7A835D9ull),X(0xFFD888B2C2ull),X(0xFFD966B864ull),X(0xFFDA4246BEull), \
+	X(0xFFDB1B5DCEull),X(0xFFDBF1FD91ull),X(0xFFDCC62605ull),X(0xFFDD97D729ull),X(0xFFDE6710FAull),X(0xFFDF33D377ull),X(0xFFDFFE1E9Cull),X(0xFFE0C5F269ull), \
+	X(0xFFE18B4EDCull),X(0xFFE24E33F2ull),X(0xFFE30EA1AAull),X(0xFFE3CC9801ull),X(0xFFE48816F7ull),X(0xFFE5411E89ull),X(0xFFE5F7AEB5ull),X(0xFFE6ABC77Aull), \
+	X(0xFFE75D68D5ull),X(0xFFE80C92C6ull),X(0xFFE8B9454Bull),X(0xFFE9638061ull),X(0xFFEA0B4407ull),X(0xFFEAB0903Cull),X(0xFFEB5364FEull),X(0xFFEBF3C24Bull), \
+	X(0xFFEC91A823ull),X(0xFFED2D1682ull),X(0xFFEDC60D69ull),X(0xFFEE5C8CD5ull),X(0xFFEEF094C4ull),X(0xFFEF822536ull),X(0xFFF0113E2Aull),X(0xFFF09DDF9Dull), \
+	X(0xFFF128098Eull),X(0xFFF1AFBBFDull),X(0xFFF234F6E7ull),X(0xFFF2B7BA4Bull),X(0xFFF3380629ull),X(0xFFF3B5DA7Full),X(0xFFF431374Bull),X(0xFFF4AA1C8Dull), \
+	X(0xFFF5208A44ull),X(0xFFF594806Dull),X(0xFFF605FF09ull),X(0xFFF6750616ull),X(0xFFF6E19592ull),X(0xFFF74BAD7Eull),X(0xFFF7B34DD7ull),X(0xFFF818769Eull), \
+	X(0xFFF87B27D0ull),X(0xFFF8DB616Dull),X(0xFFF9392374ull),X(0xFFF9946DE5ull),X(0xFFF9ED40BDull),X(0xFFFA439BFDull),X(0xFFFA977FA4ull),X(0xFFFAE8EBB0ull), \
+	X(0xFFFB37E021ull),X(0xFFFB845CF7ull),X(0xFFFBCE6230ull),X(0xFFFC15EFCBull),X(0xFFFC5B05C9ull),X(0xFFFC9DA428ull),X(0xFFFCDDCAE8ull),X(0xFFFD1B7A08ull), \
+	X(0xFFFD56B188ull),X(0xFFFD8F7166ull),X(0xFFFDC5B9A3ull),X(0xFFFDF98A3Eull),X(0xFFFE2AE336ull),X(0xFFFE59C48Bull),X(0xFFFE862E3Dull),X(0xFFFEB0204Bull), \
+	X(0xFFFED79AB4ull),X(0xFFFEFC9D79ull),X(0xFFFF1F2898ull),X(0xFFFF3F3C12ull),X(0xFFFF5CD7E6ull),X(0xFFFF77FC15ull),X(0xFFFF90A89Dull),X(0xFFFFA6DD7Eull), \
 	X(0xFFFFBA9AB9ull),X(0xFFFFCBE04Dull),X(0xFFFFDAAE39ull),X(0xFFFFE7047Full),X(0xFFFFF0E31Dull),X(0xFFFFF84A14ull),X(0xFFFFFD3963ull),X(0xFFFFFFB10Bull),
-	X(0x0006487ED4ull),X(0x0012D97C7Aull),X(0x001F6A7A15ull),X(0x002BFB779Cull),X(0x00388C7507ull),X(0x00451D7250ull),X(0x0051AE6F6Full),X(0x005E3F6C5Aull),
-	X(0x006AD0690Cull),X(0x007761657Cull),X(0x0083F261A2ull),X(0x0090835D77ull),X(0x009D1458F3ull),X(0x00A9A5540Eull),X(0x00B6364EC0ull),X(0x00C2C74902ull),
-	X(0x00CF5842CBull),X(0x00DBE93C15ull),X(0x00E87A34D7ull),X(0x00F50B2D0Aull),X(0x01019C24A5ull),X(0x010E2D1BA2ull),X(0x011ABE11F8ull),X(0x01274F079Full),
-	X(0x0133DFFC91ull),X(0x014070F0C4ull),X(0x014D01E432ull),X(0x015992D6D2ull),X(0x016623C89Dull),X(0x0172B4B98Cull),X(0x017F45A995ull),X(0x018BD698B2ull),
-	X(0x01986786DBull),X(0x01A4F87409ull),X(0x01B1896032ull),X(0x01BE1A4B50ull),X(0x01CAAB355Bull),X(0x01D73C1E4Bull),X(0x01E3CD0618ull),X(0x01F05DECBBull),
-	X(0x01FCEED22Bull),X(0x02097FB662ull),X(0x0216109957ull),X(0x0222A17B02ull),X(0x022F325B5Dull),X(0x023BC33A5Eull),X(0x02485417FFull),X(0x0254E4F437ull),
-	X(0x026175CEFFull),X(0x026E06A84Full),X(0x027A978020ull),X(0x0287285669ull),X(0x0293B92B22ull),X(0x02A049FE45ull),X(0x02ACDACFC9ull),X(0x02B96B9FA7ull),
-	X(0x02C5FC6DD6ull),X(0x02D28D3A50ull),X(0x02DF1E050Cull),X(0x02EBAECE02ull),X(0x02F83F952Bull),X(0x0304D05A7Full),X(0x0311611DF7ull),X(0x031DF1DF8Aull),
-	X(0x032A829F31ull),X(0x0337135CE4ull),X(0x0343A4189Bull),X(0x035034D24Eull),X(0x035CC589F7ull),X(0x0369563F8Cull),X(0x0375E6F307ull),X(0x038277A45Full),
-	X(0x038F08538Dull),X(0x039B990089ull),X(0x03A829AB4Cull),X(0x03B4BA53CDull),X(0x03C14AFA04ull),X(0x03CDDB9DEBull),X(0x03DA6C3F79ull),X(0x03E6FCDEA7ull),
-	X(0x03F38D7B6Cull),X(0x04001E15C1ull),X(0x040CAEAD9Full),X(0x04193F42FDull),X(0x0425CFD5D4ull),X(0x043260661Cull),X(0x043EF0F3CDull),X(0x044B817EDFull),
-	X(0x045812074Cull),X(0x0464A28D0Aull),X(0x0471331013ull),X(0x047DC3905Eull),X(0x048A540DE4ull),X(0x0496E4889Dull),X(0x04A3750082ull),X(0x04B0057589ull),
-	X(0x04BC95E7ADull),X(0x04C92656E5ull),X(0x04D5B6C329ull),X(0x04E2472C71ull),X(0x04EED792B6ull),X(0x04FB67F5F0ull),X(0x0507F85618ull),X(0x051488B325ull),
-	X(0x0521190D0Full),X(0x052DA963D0ull),X(0x053A39B75Full),X(0x0546CA07B5ull),X(0x05535A54C9ull),X(0x055FEA9E94ull),X(0x056C7AE50Full),X(0x05790B2831ull),
-	X(0x05859B67F3ull),X(0x05922BA44Cull),X(0x059EBBDD37ull),X(0x05AB4C12A9ull),X(0x05B7DC449Dull),X(0x05C46C7309ull),X(0x05D0FC9DE7ull),X(0x05DD8CC52Eull),
-	X(0x05EA1CE8D7ull),X(0x05F6AD08DAull),X(0x06033D252Full),X(0x060FCD3DCFull),X(0x061C5D52B1ull),X(0x0628ED63CFull),X(0x06357D7120ull),X(0x06420D7A9Cull),
-	X(0x064E9D803Cull),X(0x065B2D81F9ull),X(0x0667BD7FC9ull),X(0x06744D79A6ull),X(0x0680DD6F88ull),X(0x068D6D6167ull),X(0x0699FD4F3Bull),X(0x06A68D38FCull),
-	X(0x06B31D1EA3ull),X(0x06BFAD0029ull),X(0x06CC3CDD85ull),X(0x06D8CCB6AFull),X(0x06E55C8BA0ull),X(0x06F1EC5C50ull),X(0x06FE7C28B7ull),X(0x070B0BF0CEull),
-	X(0x07179BB48Dull),X(0x07242B73EBull),X(0x0730BB2EE2ull),X(0x073D4AE56Aull),X(0x0749DA977Aull),X(0x07566A450Cull),X(0x0762F9EE16ull),X(0x076F899292ull),
-	X(0x077C193278ull),X(0x0788A8CDC0ull),X(0x0795386463ull),X(0x07A1C7F658ull),X(0x07AE578398ull),X(0x07BAE70C1Aull),X(0x07C7768FD9ull),X(0x07D4060ECAull),
-	X(0x07E09588E8ull),X(0x07ED24FE29ull),X(0x07F9B46E87ull),X(0x080643D9FAull),X(0x0812D34079ull),X(0x081F62A1FDull),X(0x082BF1FE7Full),X(0x08388155F6ull),
-	X(0x084510A85Bull),X(0x08519FF5A7ull),X(0x085E2F3DD0ull),X(0x086ABE80D0ull),X(0x08774DBE9Full),X(0x0883DCF735ull),X(0x08906C2A8Bull),X(0x089CFB5898ull),
-	X(0x08A98A8155ull),X(0x08B619A4BAull),X(0x08C2A8C2BFull),X(0x08CF37DB5Dull),X(0x08DBC6EE8Cull),X(0x08E855FC44ull),X(0x08F4E5047Dull),X(0x0901740730ull),
-	X(0x090E030455ull),X(0x091A91FBE4ull),X(0x092720EDD6ull),X(0x0933AFDA22ull),X(0x09403EC0C1ull),X(0x094CCDA1ABull),X(0x09595C7CD8ull),X(0x0965EB5241ull),
-	X(0x09727A21DEull),X(0x097F08EBA7ull),X(0x098B97AF95ull),X(0x0998266D9Full),X(0x09A4B525BEull),X(0x09B143D7EBull),X(0x09BDD2841Dull),X(0x09CA612A4Cull),
-	X(0x09D6EFCA72ull),X(0x09E37E6485ull),X(0x09F00CF87Full),X(0x09FC9B8658ull),X(0x0A092A0E08ull),X(0x0A15B88F87ull),X(0x0A22470ACDull),X(0x0A2ED57FD3ull),
-	X(0x0A3B63EE91ull),X(0x0A47F25700ull),X(0x0A5480B916ull),X(0x0A610F14CEull),X(0x0A6D9D6A1Eull),X(0x0A7A2BB900ull),X(0x0A86BA016Cull),X(0x0A93484359ull),
-	X(0x0A9FD67EC0ull),X(0x0AAC64B399ull),X(0x0AB8F2E1DDull),X(0x0AC5810983ull),X(0x0AD20F2A85ull),X(0x0ADE9D44DAull),X(0x0AEB2B587Aull),X(0x0AF7B9655Full),
-	X(0x0B04476B7Full),X(0x0B10D56AD4ull),X(0x0B1D636355ull),X(0x0B29F154FBull),X(0x0B367F3FBEull),X(0x0B430D2397ull),X(0x0B4F9B007Dull),X(0x0B5C28D668ull),
-	X(0x0B68B6A552ull),X(0x0B75446D33ull),X(0x0B81D22E02ull),X(0x0B8E5FE7B8ull),X(0x0B9AED9A4Dull),X(0x0BA77B45B9ull),X(0x0BB408E9F5ull),X(0x0BC09686F9ull),
-	X(0x0BCD241CBDull),X(0x0BD9B1AB39ull),X(0x0BE63F3266ull),X(0x0BF2CCB23Cull),X(0x0BFF5A2AB3ull),X(0x0C0BE79BC4ull),X(0x0C18750566ull),X(0x0C25026793ull),
-	X(0x0C318FC241ull),X(0x0C3E1D156Aull),X(0x0C4AAA6106ull),X(0x0C5737A50Cull),X(0x0C63C4E176ull),X(0x0C7052163Cull),X(0x0C7CDF4355ull),X(0x0C896C68BAull),
-	X(0x0C95F98663ull),X(0x0CA2869C49ull),X(0x0CAF13AA64ull),X(0x0CBBA0B0ACull),X(0x0CC82DAF19ull),X(0x0CD4BAA5A3ull),X(0x0CE1479444ull),X(0x0CEDD47AF2ull),
-	X(0x0CFA6159A7ull),X(0x0D06EE305Aull),X(0x0D137AFF04ull),X(0x0D2007C59Eull),X(0x0D2C94841Full),X(0x0D39213A7Full),X(0x0D45ADE8B7ull),X(0x0D523A8EBFull),
-	X(0x0D5EC72C90ull),X(0x0D6B53C222ull),X(0x0D77E04F6Cull),X(0x0D846CD467ull),X(0x0D90F9510Cull),X(0x0D9D85C553ull),X(0x0DAA123134ull),X(0x0DB69E94A6ull),
-	X(0x0DC32AEFA4ull),X(0x0DCFB74224ull),X(0x0DDC438C1Full),X(0x0DE8CFCD8Dull),X(0x0DF55C0667ull),X(0x0E01E836A4ull),X(0x0E0E745E3Eull),X(0x0E1B007D2Cull),
-	X(0x0E278C9366ull),X(0x0E3418A0E5ull),X(0x0E40A4A5A2ull),X(0x0E4D30A193ull),X(0x0E59BC94B3ull),X(0x0E66487EF8ull),X(0x0E72D4605Bull),X(0x0E7F6038D5ull),
-	X(0x0E8BEC085Dull),X(0x0E9877CEECull),X(0x0EA5038C7Aull),X(0x0EB18F4100ull),X(0x0EBE1AEC75ull),X(0x0ECAA68ED3ull),X(0x0ED7322810ull),X(0x0EE3BDB826ull),
-	X(0x0EF0493F0Dull),X(0x0EFCD4BCBCull),X(0x0F0960312Dull),X(0x0F15EB9C58ull),X(0x0F2276FE34ull),X(0x0F2F0256BAull),X(0x0F3B8DA5E3ull),X(0x0F4818EBA6ull),
-	X(0x0F54A427FCull),X(0x0F612F5ADDull),X(0x0F6DBA8441ull),X(0x0F7A45A421ull),X(0x0F86D0BA75ull),X(0x0F935BC735ull),X(0x0F9FE6CA5Aull),X(0x0FAC71C3DBull),
-	X(0x0FB8FCB3B1ull),X(0x0FC58799D4ull),X(0x0FD212763Cull),X(0x0FDE9D48E3ull),X(0x0FEB2811BFull),X(0x0FF7B2D0CAull),X(0x10043D85FBull),X(0x1010C8314Aull),
-	X(0x101D52D2B1ull),X(0x1029DD6A27ull),X(0x103667F7A5ull),X(0x1042F27B23ull),X(0x104F7CF498ull),X(0x105C0763FEull),X(0x106891C94Dull),X(0x10751C247Cull),
-	X(0x1081A67585ull),X(0x108E30BC5Full),X(0x109ABAF902ull),X(0x10A7452B68ull),X(0x10B3CF5388ull),X(0x10C059715Aull),X(0x10CCE384D7ull),X(0x10D96D8DF7ull),
-	X(0x10E5F78CB2ull),X(0x10F2818101ull),X(0x10FF0B6ADBull),X(0x110B954A3Aull),X(0x11181F1F15ull),X(0x1124A8E964ull),X(0x113132A921ull),X(0x113DBC5E42ull),
-	X(0x114A4608C1ull),X(0x1156CFA896ull),X(0x1163593DB8ull),X(0x116FE2C821ull),X(0x117C6C47C8ull),X(0x1188F5BCA6ull),X(0x11957F26B2ull),X(0x11A20885E6ull),
-	X(0x11AE91DA3Aull),X(0x11BB1B23A5ull),X(0x11C7A46221ull),X(0x11D42D95A4ull),X(0x11E0B6BE29ull),X(0x11ED3FDBA6ull),X(0x11F9C8EE14ull),X(0x120651F56Cull),
-	X(0x1212DAF1A5ull),X(0x121F63E2B8ull),X(0x122BECC89Eull),X(0x123875A34Eull),X(0x1244FE72C0ull),X(0x12518736EEull),X(0x125E0FEFCFull),X(0x126A989D5Bull),
-	X(0x1277213F8Bull),X(0x1283A9D658ull),X(0x12903261B8ull),X(0x129CBAE1A5ull),X(0x12A9435618ull),X(0x12B5CBBF07ull),X(0x12C2541C6Bull),X(0x12CEDC6E3Eull),
-	X(0x12DB64B476ull),X(0x12E7ECEF0Cull),X(0x12F4751DF9ull),X(0x1300FD4135ull),X(0x130D8558B8ull),X(0x131A0D647Aull),X(0x1326956474ull),X(0x13331D589Dull),
-	X(0x133FA540EFull),X(0x134C2D1D61ull),X(0x1358B4EDEBull),X(0x13653CB287ull),X(0x1371C46B2Cull),X(0x137E4C17D2ull),X(0x138AD3B872ull),X(0x13975B4D04ull),
-	X(0x13A3E2D580ull),X(0x13B06A51DFull),X(0x13BCF1C218ull),X(0x13C9792625ull),X(0x13D6007DFDull),X(0x13E287C999ull),X(0x13EF0F08F0ull),X(0x13FB963BFCull),
-	X(0x14081D62B4ull),X(0x1414A47D11ull),X(0x14212B8B0Bull),X(0x142DB28C9Aull),X(0x143A3981B7ull),X(0x1446C06A5Aull),X(0x145347467Aull),X(0x145FCE1611ull),
-	X(0x146C54D917ull),X(0x1478DB8F83ull),X(0x148562394Full),X(0x1491E8D672ull),X(0x149E6F66E5ull),X(0x14AAF5EAA0ull),X(0x14B77C619Bull),X(0x14C402CBCFull),
-	X(0x14D0892933ull),X(0x14DD0F79C1ull),X(0x14E995BD70ull),X(0x14F61BF438ull),X(0x1502A21E13ull),X(0x150F283AF7ull),X(0x151BAE4ADEull),X(0x1528344DC0ull),
-	X(0x1534BA4395ull),X(0x1541402C55ull),X(0x154DC607F9ull),X(0x155A4BD679ull),X(0x1566D197CCull),X(0x1573574BECull),X(0x157FDCF2D1ull),X(0x158C628C73ull),
-	X(0x1598E818CAull),X(0x15A56D97CEull),X(0x15B1F30978ull),X(0x15BE786DC0ull),X(0x15CAFDC49Full),X(0x15D7830E0Cull),X(0x15E4084A00ull),X(0x15F08D7873ull),
-	X(0x15FD12995Eull),X(0x160997ACB8ull),X(0x16161CB27Aull),X(0x1622A1AA9Dull),X(0x162F269518ull),X(0x163BAB71E4ull),X(0x16483040F9ull),X(0x1654B5024Full),
-	X(0x166139B5DFull),X(0x166DBE5BA1ull),X(0x167A42F38Dull),X(0x1686C77D9Cull),X(0x16934BF9C5ull),X(0x169FD06802ull),X(0x16AC54C849ull),X(0x16B8D91A95ull),
-	X(0x16C55D5EDCull),X(0x16D1E19517ull),X(0x16DE65BD3Full),X(0x16EAE9D74Bull),X(0x16F76DE335ull),X(0x1703F1E0F4ull),X(0x171075D080ull),X(0x171CF9B1D2ull),
-	X(0x17297D84E2ull),X(0x17360149A9ull),X(0x174285001Eull),X(0x174F08A83Bull),X(0x175B8C41F6ull),X(0x17680FCD49ull),X(0x1774934A2Cull),X(0x178116B897ull),
-	X(0x178D9A1882ull),X(0x179A1D69E6ull),X(0x17A6A0ACBBull),X(0x17B323E0F9ull),X(0x17BFA70698ull),X(0x17CC2A1D91ull),X(0x17D8AD25DDull),X(0x17E5301F72ull),
-	X(0x17F1B30A4Bull),X(0x17FE35E65Eull),X(0x180AB8B3A4ull),X(0x18173B7216ull),X(0x1823BE21ABull),X(0x183040C25Dull),X(0x183CC35423ull),X(0x184945D6F5ull),
-	X(0x1855C84ACCull),X(0x18624AAFA1ull),X(0x186ECD056Bull),X(0x187B4F4C22ull),X(0x1887D183C0ull),X(0x189453AC3Cull),X(0x18A0D5C58Full),X(0x18AD57CFB0ull),
-	X(0x18B9D9CA98ull),X(0x18C65BB640ull),X(0x18D2DD92A0ull),X(0x18DF5F5FB0ull),X(0x18EBE11D68ull),X(0x18F862CBC0ull),X(0x1904E46AB1ull),X(0x191165FA34ull),
-	X(0x191DE77A40ull),X(0x192A68EACEull),X(0x1936EA4BD5ull),X(0x19436B9D4Full),X(0x194FECDF34ull),X(0x195C6E117Bull),X(0x1968EF341Dull),X(0x1975704713ull),
-	X(0x1981F14A55ull),X(0x198E723DDBull),X(0x199AF3219Dull),X(0x19A773F593ull),X(0x19B3F4B9B6ull),X(0x19C0756DFFull),X(0x19CCF61265ull),X(0x19D976A6E1ull),
-	X(0x19E5F72B6Aull),X(0x19F2779FFAull),X(0x19FEF80489ull),X(0x1A0B78590Eull),X(0x1A17F89D83ull),X(0x1A2478D1DFull),X(0x1A30F8F61Bull),X(0x1A3D790A2Full),
-	X(0x1A49F90E13ull),X(0x1A567901C0ull),X(0x1A62F8E52Eull),X(0x1A6F78B855ull),X(0x1A7BF87B2Dull),X(0x1A88782DAFull),X(0x1A94F7CFD3ull),X(0x1AA1776192ull),
-	X(0x1AADF6E2E3ull),X(0x1ABA7653C0ull),X(0x1AC6F5B41Full),X(0x1AD37503FAull),X(0x1ADFF44349ull),X(0x1AEC737203ull),X(0x1AF8F29023ull),X(0x1B05719D9Full),
-	X(0x1B11F09A6Full),X(0x1B1E6F868Eull),X(0x1B2AEE61F1ull),X(0x1B376D2C93ull),X(0x1B43EBE66Aull),X(0x1B506A8F71ull),X(0x1B5CE9279Dull),X(0x1B6967AEE9ull),
-	X(0x1B75E6254Cull),X(0x1B82648ABFull),X(0x1B8EE2DF3Aull),X(0x1B9B6122B5ull),X(0x1BA7DF5528ull),X(0x1BB45D768Cull),X(0x1BC0DB86DAull),X(0x1BCD598608ull),
-	X(0x1BD9D77410ull),X(0x1BE65550EBull),X(0x1BF2D31C8Full),X(0x1BFF50D6F6ull),X(0x1C0BCE8018ull),X(0x1C184C17EDull),X(0x1C24C99E6Dull),X(0x1C31471391ull),
-	X(0x1C3DC47751ull),X(0x1C4A41C9A6ull),X(0x1C56BF0A87ull),X(0x1C633C39EDull),X(0x1C6FB957D0ull),X(0x1C7C366429ull),X(0x1C88B35EEFull),X(0x1C9530481Cull),
-	X(0x1CA1AD1FA7ull),X(0x1CAE29E588ull),X(0x1CBAA699B9ull),X(0x1CC7233C31ull),X(0x1CD39FCCE8ull),X(0x1CE01C4BD8ull),X(0x1CEC98B8F7ull),X(0x1CF915143Full),
-	X(0x1D05915DA8ull),X(0x1D120D952Aull),X(0x1D1E89BABDull),X(0x1D2B05CE5Aull),X(0x1D3781CFF9ull),X(0x1D43FDBF92ull),X(0x1D50799D1Eull),X(0x1D5CF56894ull),
-	X(0x1D697121EEull),X(0x1D75ECC923ull),X(0x1D82685E2Cull),X(0x1D8EE3E101ull),X(0x1D9B5F519Aull),X(0x1DA7DAAFF0ull),X(0x1DB455FBFBull),X(0x1DC0D135B3ull),
-	X(0x1DCD4C5D11ull),X(0x1DD9C7720Dull),X(0x1DE642749Full),X(0x1DF2BD64BFull),X(0x1DFF384266ull),X(0x1E0BB30D8Cull),X(0x1E182DC62Aull),X(0x1E24A86C37ull),
-	X(0x1E3122FFACull),X(0x1E3D9D8082ull),X(0x1E4A17EEB0ull),X(0x1E56924A2Eull),X(0x1E630C92F7ull),X(0x1E6F86C900ull),X(0x1E7C00EC44ull),X(0x1E887AFCB9ull),
-	X(0x1E94F4FA59ull),X(0x1EA16EE51Cull),X(0x1EADE8BCF9ull),X(0x1EBA6281EAull),X(0x1EC6DC33E7ull),X(0x1ED355D2E7ull),X(0x1EDFCF5EE4ull),X(0x1EEC48D7D5ull),
-	X(0x1EF8C23DB3ull),X(0x1F053B9076ull),X(0x1F11B4D017ull),X(0x1F1E2DFC8Dull),X(0x1F2AA715D2ull),X(0x1F37201BDDull),X(0x1F43990EA6ull),X(0x1F5011EE26ull),
-	X(0x1F5C8ABA56ull),X(0x1F6903732Eull),X(0x1F757C18A5ull),X(0x1F81F4AAB4ull),X(0x1F8E6D2954ull),X(0x1F9AE5947Dull),X(0x1FA75DEC27ull),X(0x1FB3D6304Aull),
-	X(0x1FC04E60DFull),X(0x1FCCC67DDFull),X(0x1FD93E8740ull),X(0x1FE5B67CFCull),X(0x1FF22E5F0Bull),X(0x1FFEA62D66ull),X(0x200B1DE804ull),X(0x2017958EDEull),
-	X(0x20240D21ECull),X(0x203084A127ull),X(0x203CFC0C86ull),X(0x2049736403ull),X(0x2055EAA795ull),X(0x206261D735ull),X(0x206ED8F2DBull),X(0x207B4FFA7Full),
-	X(0x2087C6EE1Aull),X(0x20943DCDA4ull),X(0x20A0B49916ull),X(0x20AD2B5067ull),X(0x20B9A1F390ull),X(0x20C6188289ull),X(0x20D28EFD4Bull),X(0x20DF0563CDull),
-	X(0x20EB7BB609ull),X(0x20F7F1F3F6ull),X(0x2104681D8Eull),X(0x2110DE32C7ull),X(0x211D54339Bull),X(0x2129CA2001ull),X(0x21363FF7F3ull),X(0x2142B5BB68ull),
-	X(0x214F2B6A58ull),X(0x215BA104BDull),X(0x2168168A8Eull),X(0x21748BFBC4ull),X(0x2181015856ull),X(0x218D76A03Eull),X(0x2199EBD373ull),X(0x21A660F1EFull),
-	X(0x21B2D5FBA8ull),X(0x21BF4AF098ull),X(0x21CBBFD0B7ull),X(0x21D8349BFEull),X(0x21E4A95263ull),X(0x21F11DF3E1ull),X(0x21FD92806Eull),X(0x220A06F804ull),
-	X(0x22167B5A9Bull),X(0x2222EFA82Aull),X(0x222F63E0ACull),X(0x223BD80416ull),X(0x22484C1263ull),X(0x2254C00B8Bull),X(0x226133EF84ull),X(0x226DA7BE49ull),
-	X(0x227A1B77D1ull),X(0x22868F1C15ull),X(0x229302AB0Dull),X(0x229F7624B1ull),X(0x22ABE988F9ull),X(0x22B85CD7DFull),X(0x22C4D01159ull),X(0x22D1433561ull),
-	X(0x22DDB643EFull),X(0x22EA293CFCull),X(0x22F69C207Eull),X(0x23030EEE70ull),X(0x230F81A6C8ull),X(0x231BF44980ull),X(0x232866D690ull),X(0x2334D94DF0ull),
-	X(0x23414BAF99ull),X(0x234DBDFB82ull),X(0x235A3031A4ull),X(0x2366A251F7ull),X(0x2373145C75ull),X(0x237F865114ull),X(0x238BF82FCEull),X(0x239869F89Aull),
-	X(0x23A4DBAB71ull),X(0x23B14D484Cull),X(0x23BDBECF22ull),X(0x23CA303FEDull),X(0x23D6A19AA3ull),X(0x23E312DF3Eull),X(0x23EF840DB7ull),X(0x23FBF52604ull),
-	X(0x240866281Full),X(0x2414D71400ull),X(0x242147E99Full),X(0x242DB8A8F5ull),X(0x243A2951FAull),X(0x244699E4A6ull),X(0x24530A60F1ull),X(0x245F7AC6D5ull),
-	X(0x246BEB1649ull),X(0x24785B4F45ull),X(0x2484CB71C2ull),X(0x24913B7DB8ull),X(0x249DAB7320ull),X(0x24AA1B51F1ull),X(0x24B68B1A25ull),X(0x24C2FACBB3ull),
-	X(0x24CF6A6694ull),X(0x24DBD9EAC1ull),X(0x24E8495830ull),X(0x24F4B8AEDCull),X(0x250127EEBCull),X(0x250D9717C8ull),X(0x251A0629F9ull),X(0x2526752547ull),
-	X(0x2532E409ABull),X(0x253F52D71Cull),X(0x254BC18D94ull),X(0x2558302D0Aull),X(0x25649EB577ull),X(0x25710D26D3ull),X(0x257D7B8116ull),X(0x2589E9C439ull),
-	X(0x259657F034ull),X(0x25A2C60500ull),X(0x25AF340295ull),X(0x25BBA1E8EAull),X(0x25C80FB7FAull),X(0x25D47D6FBBull),X(0x25E0EB1026ull),X(0x25ED589933ull),
-	X(0x25F9C60ADBull),X(0x2606336517ull),X(0x2612A0A7DEull),X(0x261F0DD328ull),X(0x262B7AE6EFull),X(0x2637E7E32Aull),X(0x264454C7D2ull),X(0x2650C194E0ull),
-	X(0x265D2E4A4Aull),X(0x26699AE80Bull),X(0x2676076E19ull),X(0x268273DC6Eull),X(0x268EE03302ull),X(0x269B4C71CDull),X(0x26A7B898C8ull),X(0x26B424A7EAull),
-	X(0x26C0909F2Cull),X(0x26CCFC7E87ull),X(0x26D96845F3ull),X(0x26E5D3F568ull),X(0x26F23F8CDFull),X(0x26FEAB0C4Full),X(0x270B1673B1ull),X(0x271781C2FFull),
-	X(0x2723ECFA2Eull),X(0x273058193Aull),X(0x273CC32018ull),X(0x27492E0EC3ull),X(0x275598E532ull),X(0x276203A35Dull),X(0x276E6E493Dull),X(0x277AD8D6CBull),
-	X(0x2787434BFEull),X(0x2793ADA8CFull),X(0x27A017ED36ull),X(0x27AC82192Cull),X(0x27B8EC2CA9ull),X(0x27C55627A5ull),X(0x27D1C00A19ull),X(0x27DE29D3FDull),
-	X(0x27EA938549ull),X(0x27F6FD1DF5ull),X(0x2803669DFBull),X(0x280FD00552ull),X(0x281C3953F3ull),X(0x2828A289D6ull),X(0x28350BA6F3ull),X(0x284174AB43ull),
-	X(0x284DDD96BEull),X(0x285A46695Dull),X(0x2866AF2317ull),X(0x287317C3E6ull),X(0x287F804BC0ull),X(0x288BE8BAA0ull),X(0x289851107Dull),X(0x28A4B94D4Full),
-	X(0x28B121710Full),X(0x28BD897BB6ull),X(0x28C9F16D3Aull),X(0x28D6594596ull),X(0x28E2C104C1ull),X(0x28EF28AAB4ull),X(0x28FB903766ull),X(0x2907F7AAD1ull),
-	X(0x29145F04ECull),X(0x2920C645B1ull),X(0x292D2D6D16ull),X(0x2939947B16ull),X(0x2945FB6FA7ull),X(0x2952624AC3ull),X(0x295EC90C61ull),X(0x296B2FB47Bull),
-	X(0x2977964308ull),X(0x2983FCB801ull),X(0x299063135Dull),X(0x299CC95517ull),X(0x29A92F7D25ull),X(0x29B5958B80ull),X(0x29C1FB8021ull),X(0x29CE615B00ull),
-	X(0x29DAC71C15ull),X(0x29E72CC358ull),X(0x29F39250C3ull),X(0x29FFF7C44Dull),X(0x2A0C5D1DEEull),X(0x2A18C25DA0ull),X(0x2A25278359ull),X(0x2A318C8F14ull),
-	X(0x2A3DF180C7ull),X(0x2A4A56586Cull),X(0x2A56BB15FBull),X(0x2A631FB96Cull),X(0x2A6F8442B7ull),X(0x2A7BE8B1D6ull),X(0x2A884D06BFull),X(0x2A94B1416Cull),
-	X(0x2AA11561D5ull),X(0x2AAD7967F2ull),X(0x2AB9DD53BCull),X(0x2AC641252Aull),X(0x2AD2A4DC36ull),X(0x2ADF0878D8ull),X(0x2AEB6BFB08ull),X(0x2AF7CF62BEull),
-	X(0x2B0432AFF3ull),X(0x2B1095E29Full),X(0x2B1CF8FABBull),X(0x2B295BF83Eull),X(0x2B35BEDB21ull),X(0x2B4221A35Eull),X(0x2B4E8450EBull),X(0x2B5AE6E3C1ull),
-	X(0x2B67495BD9ull),X(0x2B73ABB92Bull),X(0x2B800DFBAFull),X(0x2B8C70235Eull),X(0x2B98D23031ull),X(0x2BA534221Eull),X(0x2BB195F91Full),X(0x2BBDF7B52Dull),
-	X(0x2BCA59563Full),X(0x2BD6BADC4Eull),X(0x2BE31C4752ull),X(0x2BEF7D9744ull),X(0x2BFBDECC1Cull),X(0x2C083FE5D2ull),X(0x2C14A0E45Full),X(0x2C2101C7BBull),
-	X(0x2C2D628FDFull),X(0x2C39C33CC2ull),X(0x2C4623CE5Dull),X(0x2C528444A9ull),X(0x2C5EE49F9Eull),X(0x2C6B44DF34ull),X(0x2C77A50364ull),X(0x2C84050C25ull),
-	X(0x2C9064F971ull),X(0x2C9CC4CB40ull),X(0x2CA924818Aull),X(0x2CB5841C47ull),X(0x2CC1E39B71ull),X(0x2CCE42FEFEull),X(0x2CDAA246E8ull),X(0x2CE7017327ull),
-	X(0x2CF36083B3ull),X(0x2CFFBF7885ull),X(0x2D0C1E5195ull),X(0x2D187D0EDBull),X(0x2D24DBB050ull),X(0x2D313A35ECull),X(0x2D3D989FA8ull),X(0x2D49F6ED7Cull),
-	X(0x2D56551F60ull),X(0x2D62B3354Cull),X(0x2D6F112F3Aull),X(0x2D7B6F0D21ull),X(0x2D87CCCEF9ull),X(0x2D942A74BCull),X(0x2DA087FE61ull),X(0x2DACE56BE1ull),
-	X(0x2DB942BD35ull),X(0x2DC59FF254ull),X(0x2DD1FD0B37ull),X(0x2DDE5A07D6ull),X(0x2DEAB6E82Aull),X(0x2DF713AC2Bull),X(0x2E037053D2ull),X(0x2E0FCCDF16ull),
-	X(0x2E1C294DF1ull),X(0x2E2885A05Aull),X(0x2E34E1D64Aull),X(0x2E413DEFBAull),X(0x2E4D99ECA1ull),X(0x2E59F5CCF9ull),X(0x2E665190B8ull),X(0x2E72AD37D9ull),
-	X(0x2E7F08C253ull),X(0x2E8B64301Full),X(0x2E97BF8134ull),X(0x2EA41AB58Cull),X(0x2EB075CD1Full),X(0x2EBCD0C7E5ull),X(0x2EC92BA5D6ull),X(0x2ED58666EBull),
-	X(0x2EE1E10B1Dull),X(0x2EEE3B9263ull),X(0x2EFA95FCB6ull),X(0x2F06F04A0Eull),X(0x2F134A7A65ull),X(0x2F1FA48DB1ull),X(0x2F2BFE83ECull),X(0x2F38585D0Eull),
-	X(0x2F44B2190Full),X(0x2F510BB7E8ull),X(0x2F5D653991ull),X(0x2F69BE9E03ull),X(0x2F7617E535ull),X(0x2F82710F20ull),X(0x2F8ECA1BBDull),X(0x2F9B230B04ull),
-	X(0x2FA77BDCEEull),X(0x2FB3D49172ull),X(0x2FC02D2889ull),X(0x2FCC85A22Cull),X(0x2FD8DDFE52ull),X(0x2FE5363CF5ull),X(0x2FF18E5E0Dull),X(0x2FFDE66192ull),
-	X(0x300A3E477Cull),X(0x3016960FC4ull),X(0x3022EDBA62ull),X(0x302F45474Eull),X(0x303B9CB682ull),X(0x3047F407F5ull),X(0x30544B3BA0ull),X(0x3060A2517Bull),
-	X(0x306CF9497Full),X(0x30795023A3ull),X(0x3085A6DFE1ull),X(0x3091FD7E30ull),X(0x309E53FE8Aull),X(0x30AAAA60E6ull),X(0x30B700A53Dull),X(0x30C356CB87ull),
-	X(0x30CFACD3BDull),X(0x30DC02BDD7ull),X(0x30E85889CDull),X(0x30F4AE3798ull),X(0x310103C730ull),X(0x310D59388Eull),X(0x3119AE8BAAull),X(0x312603C07Dull),
-	X(0x313258D6FEull),X(0x313EADCF26ull),X(0x314B02A8EEull),X(0x315757644Dull),X(0x3163AC013Eull),X(0x3170007FB7ull),X(0x317C54DFB1ull),X(0x3188A92124ull),
-	X(0x3194FD440Aull),X(0x31A1514859ull),X(0x31ADA52E0Cull),X(0x31B9F8F51Aull),X(0x31C64C9D7Bull),X(0x31D2A02728ull),X(0x31DEF39219ull),X(0x31EB46DE47ull),
-	X(0x31F79A0BABull),X(0x3203ED1A3Bull),X(0x32104009F2ull),X(0x321C92DAC7ull),X(0x3228E58CB2ull),X(0x3235381FADull),X(0x32418A93AFull),X(0x324DDCE8B1ull),
-	X(0x325A2F1EABull),X(0x3266813596ull),X(0x3272D32D6Bull),X(0x327F250620ull),X(0x328B76BFB0ull),X(0x3297C85A11ull),X(0x32A419D53Eull),X(0x32B06B312Dull),
-	X(0x32BCBC6DD8ull),X(0x32C90D8B37ull),X(0x32D55E8942ull),X(0x32E1AF67F2ull),X(0x32EE00273Full),X(0x32FA50C722ull),X(0x3306A14792ull),X(0x3312F1A889ull),
-	X(0x331F41E9FFull),X(0x332B920BEBull),X(0x3337E20E47ull),X(0x334431F10Bull),X(0x335081B430ull),X(0x335CD157ADull),X(0x336920DB7Bull),X(0x3375703F93ull),
-	X(0x3381BF83EDull),X(0x338E0EA881ull),X(0x339A5DAD48ull),X(0x33A6AC923Aull),X(0x33B2FB5750ull),X(0x33BF49FC81ull),X(0x33CB9881C7ull),X(0x33D7E6E71Aull),
-	X(0x33E4352C72ull),X(0x33F08351C8ull),X(0x33FCD15714ull),X(0x34091F3C4Eull),X(0x34156D016Full),X(0x3421BAA670ull),X(0x342E082B48ull),X(0x343A558FF0ull),
-	X(0x3446A2D461ull),X(0x3452EFF892ull),X(0x345F3CFC7Dull),X(0x346B89E01Aull),X(0x3477D6A361ull),X(0x348423464Aull),X(0x34906FC8CFull),X(0x349CBC2AE6ull),
-	X(0x34A9086C8Aull),X(0x34B5548DB2ull),X(0x34C1A08E56ull),X(0x34CDEC6E70ull),X(0x34DA382DF7ull),X(0x34E683CCE4ull),X(0x34F2CF4B2Full),X(0x34FF1AA8D0ull),
-	X(0x350B65E5C1ull),X(0x3517B101FAull),X(0x3523FBFD72ull),X(0x353046D823ull),X(0x353C919205ull),X(0x3548DC2B10ull),X(0x355526A33Cull),X(0x356170FA83ull),
-	X(0x356DBB30DCull),X(0x357A054640ull),X(0x35864F3AA7ull),X(0x3592990E0Aull),X(0x359EE2C061ull),X(0x35AB2C51A5ull),X(0x35B775C1CDull),X(0x35C3BF10D3ull),
-	X(0x35D0083EAFull),X(0x35DC514B59ull),X(0x35E89A36CAull),X(0x35F4E300FAull),X(0x36012BA9E1ull),X(0x360D743179ull),X(0x3619BC97B8ull),X(0x362604DC99ull),
-	X(0x36324D0013ull),X(0x363E95021Eull),X(0x364ADCE2B3ull),X(0x365724A1CBull),X(0x36636C3F5Eull),X(0x366FB3BB64ull),X(0x367BFB15D6ull),X(0x3688424EACull),
-	X(0x36948965DFull),X(0x36A0D05B66ull),X(0x36AD172F3Cull),X(0x36B95DE157ull),X(0x36C5A471B0ull),X(0x36D1EAE040ull),X(0x36DE312D00ull),X(0x36EA7757E6ull),
-	X(0x36F6BD60EDull),X(0x370303480Dull),X(0x370F490D3Dull),X(0x371B8EB077ull),X(0x3727D431B2ull),X(0x37341990E8ull),X(0x37405ECE10ull),X(0x374CA3E923ull),
-	X(0x3758E8E21Aull),X(0x37652DB8ECull),X(0x3771726D93ull),X(0x377DB70007ull),X(0x3789FB7040ull),X(0x37963FBE36ull),X(0x37A283E9E3ull),X(0x37AEC7F33Eull),
-	X(0x37BB0BDA40ull),X(0x37C74F9EE1ull),X(0x37D393411Aull),X(0x37DFD6C0E4ull),X(0x37EC1A1E36ull),X(0x37F85D5909ull),X(0x3804A07156ull),X(0x3810E36714ull),
-	X(0x381D263A3Eull),X(0x382968EACAull),X(0x3835AB78B1ull),X(0x3841EDE3ECull),X(0x384E302C73ull),X(0x385A72523Full),X(0x3866B45548ull),X(0x3872F63586ull),
-	X(0x387F37F2F2ull),X(0x388B798D85ull),X(0x3897BB0536ull),X(0x38A3FC59FFull),X(0x38B03D8BD7ull),X(0x38BC7E9AB7ull),X(0x38C8BF8698ull),X(0x38D5004F72ull),
-	X(0x38E140F53Eull),X(0x38ED8177F3ull),X(0x38F9C1D78Bull),X(0x39060213FDull),X(0x3912422D43ull),X(0x391E822354ull),X(0x392AC1F62Aull),X(0x393701A5BBull),
-	X(0x3943413202ull),X(0x394F809AF7ull),X(0x395BBFE091ull),X(0x3967FF02CAull),X(0x39743E0199ull),X(0x39807CDCF7ull),X(0x398CBB94DEull),X(0x3998FA2944ull),
-	X(0x39A5389A23ull),X(0x39B176E773ull),X(0x39BDB5112Cull),X(0x39C9F31747ull),X(0x39D630F9BDull),X(0x39E26EB885ull),X(0x39EEAC5399ull),X(0x39FAE9CAF0ull),
-	X(0x3A07271E84ull),X(0x3A13644E4Cull),X(0x3A1FA15A41ull),X(0x3A2BDE425Cull),X(0x3A381B0694ull),X(0x3A4457A6E3ull),X(0x3A50942341ull),X(0x3A5CD07BA6ull),
-	X(0x3A690CB00Bull),X(0x3A7548C068ull),X(0x3A8184ACB6ull),X(0x3A8DC074EDull),X(0x3A99FC1905ull),X(0x3AA63798F7ull),X(0x3AB272F4BCull),X(0x3ABEAE2C4Cull),
-	X(0x3ACAE93F9Full),X(0x3AD7242EAEull),X(0x3AE35EF972ull),X(0x3AEF999FE2ull),X(0x3AFBD421F7ull),X(0x3B080E7FAAull),X(0x3B1448B8F3ull),X(0x3B2082CDCBull),
-	X(0x3B2CBCBE2Aull),X(0x3B38F68A08ull),X(0x3B4530315Eull),X(0x3B5169B425ull),X(0x3B5DA31254ull),X(0x3B69DC4BE5ull),X(0x3B761560D0ull),X(0x3B824E510Dull),
-	X(0x3B8E871C94ull),X(0x3B9ABFC35Full),X(0x3BA6F84565ull),X(0x3BB330A2A0ull),X(0x3BBF68DB07ull),X(0x3BCBA0EE93ull),X(0x3BD7D8DD3Cull),X(0x3BE410A6FCull),
-	X(0x3BF0484BCAull),X(0x3BFC7FCB9Full),X(0x3C08B72673ull),X(0x3C14EE5C3Full),X(0x3C21256CFBull),X(0x3C2D5C58A0ull),X(0x3C39931F26ull),X(0x3C45C9C086ull),
-	X(0x3C52003CB8ull),X(0x3C5E3693B4ull),X(0x3C6A6CC574ull),X(0x3C76A2D1EFull),X(0x3C82D8B91Eull),X(0x3C8F0E7AFAull),X(0x3C9B44177Aull),X(0x3CA7798E98ull),
-	X(0x3CB3AEE04Cull),X(0x3CBFE40C8Eull),X(0x3CCC191357ull),X(0x3CD84DF49Full),X(0x3CE482B05Full),X(0x3CF0B7468Full),X(0x3CFCEBB728ull),X(0x3D09200222ull),
-	X(0x3D15542776ull),X(0x3D2188271Cull),X(0x3D2DBC010Cull),X(0x3D39EFB540ull),X(0x3D462343AFull),X(0x3D5256AC52ull),X(0x3D5E89EF21ull),X(0x3D6ABD0C16ull),
-	X(0x3D76F00327ull),X(0x3D8322D44Full),X(0x3D8F557F85ull),X(0x3D9B8804C2ull),X(0x3DA7BA63FEull),X(0x3DB3EC9D33ull),X(0x3DC01EB057ull),X(0x3DCC509D64ull),
-	X(0x3DD8826452ull),X(0x3DE4B4051Aull),X(0x3DF0E57FB5ull),X(0x3DFD16D41Aull),X(0x3E09480242ull),X(0x3E15790A25ull),X(0x3E21A9EBBDull),X(0x3E2DDAA702ull),
-	X(0x3E3A0B3BEBull),X(0x3E463BAA72ull),X(0x3E526BF28Full),X(0x3E5E9C143Bull),X(0x3E6ACC0F6Dull),X(0x3E76FBE41Full),X(0x3E832B9249ull),X(0x3E8F5B19E4ull),
-	X(0x3E9B8A7AE7ull),X(0x3EA7B9B54Cull),X(0x3EB3E8C90Aull),X(0x3EC017B61Bull),X(0x3ECC467C77ull),X(0x3ED8751C17ull),X(0x3EE4A394F2ull),X(0x3EF0D1E701ull),
-	X(0x3EFD00123Dull),X(0x3F092E169Full),X(0x3F155BF41Eull),X(0x3F2189AAB3ull),X(0x3F2DB73A58ull),X(0x3F39E4A303ull),X(0x3F4611E4AEull),X(0x3F523EFF52ull),
-	X(0x3F5E6BF2E6ull),X(0x3F6A98BF63ull),X(0x3F76C564C2ull),X(0x3F82F1E2FBull),X(0x3F8F1E3A07ull),X(0x3F9B4A69DEull),X(0x3FA7767279ull),X(0x3FB3A253D0ull),
-	X(0x3FBFCE0DDBull),X(0x3FCBF9A094ull),X(0x3FD8250BF2ull),X(0x3FE4504FEEull),X(0x3FF07B6C81ull),X(0x3FFCA661A3ull),X(0x4008D12F4Dull),X(0x4014FBD576ull),
-	X(0x4021265419ull),X(0x402D50AB2Cull),X(0x40397ADAA9ull),X(0x4045A4E288ull),X(0x4051CEC2C1ull),X(0x405DF87B4Eull),X(0x406A220C26ull),X(0x40764B7542ull),
-	X(0x408274B69Bull),X(0x408E9DD029ull),X(0x409AC6C1E4ull),X(0x40A6EF8BC6ull),X(0x40B3182DC6ull),X(0x40BF40A7DDull),X(0x40CB68FA03ull),X(0x40D7912432ull),
-	X(0x40E3B92661ull),X(0x40EFE10089ull),X(0x40FC08B2A3ull),X(0x4108303CA7ull),X(0x4114579E8Dull),X(0x41207ED84Full),X(0x412CA5E9E4ull),X(0x4138CCD345ull),
-	X(0x4144F3946Aull),X(0x41511A2D4Dull),X(0x415D409DE5ull),X(0x416966E62Cull),X(0x41758D0619ull),X(0x4181B2FDA5ull),X(0x418DD8CCC9ull),X(0x4199FE737Dull),
-	X(0x41A623F1B9ull),X(0x41B2494777ull),X(0x41BE6E74AEull),X(0x41CA937957ull),X(0x41D6B8556Bull),X(0x41E2DD08E2ull),X(0x41EF0193B5ull),X(0x41FB25F5DCull),
-	X(0x42074A2F50ull),X(0x42136E4009ull),X(0x421F922800ull),X(0x422BB5E72Cull),X(0x4237D97D88ull),X(0x4243FCEB0Bull),X(0x4250202FAEull),X(0x425C434B68ull),
-	X(0x4268663E34ull),X(0x4274890809ull),X(0x4280ABA8E0ull),X(0x428CCE20B1ull),X(0x4298F06F75ull),X(0x42A5129524ull),X(0x42B13491B7ull),X(0x42BD566527ull),
-	X(0x42C9780F6Bull),X(0x42D599907Dull),X(0x42E1BAE855ull),X(0x42EDDC16EBull),X(0x42F9FD1C39ull),X(0x43061DF835ull),X(0x43123EAADAull),X(0x431E5F341Full),
-	X(0x432A7F93FEull),X(0x43369FCA6Eull),X(0x4342BFD768ull),X(0x434EDFBAE4ull),X(0x435AFF74DCull),X(0x43671F0547ull),X(0x43733E6C1Full),X(0x437F5DA95Bull),
-	X(0x438B7CBCF5ull),X(0x43979BA6E4ull),X(0x43A3BA6721ull),X(0x43AFD8FDA6ull),X(0x43BBF76A69ull),X(0x43C815AD65ull),X(0x43D433C690ull),X(0x43E051B5E5ull),
-	X(0x43EC6F7B5Bull),X(0x43F88D16EBull),X(0x4404AA888Eull),X(0x4410C7D03Bull),X(0x441CE4EDECull),X(0x442901E199ull),X(0x44351EAB3Bull),X(0x44413B4AC9ull),
-	X(0x444D57C03Eull),X(0x4459740B90ull),X(0x4465902CB9ull),X(0x4471AC23B2ull),X(0x447DC7F072ull),X(0x4489E392F3ull),X(0x4495FF0B2Cull),X(0x44A21A5916ull),
-	X(0x44AE357CABull),X(0x44BA5075E2ull),X(0x44C66B44B4ull),X(0x44D285E919ull),X(0x44DEA0630Aull),X(0x44EABAB280ull),X(0x44F6D4D773ull),X(0x4502EED1DCull),
-	X(0x450F08A1B2ull),X(0x451B2246F0ull),X(0x45273BC18Cull),X(0x4533551181ull),X(0x453F6E36C6ull),X(0x454B873153ull),X(0x4557A00122ull),X(0x4563B8A62Bull),
-	X(0x456FD12066ull),X(0x457BE96FCCull),X(0x4588019456ull),X(0x4594198DFCull),X(0x45A0315CB6ull),X(0x45AC49007Dull),X(0x45B860794Bull),X(0x45C477C716ull),
-	X(0x45D08EE9D8ull),X(0x45DCA5E18Aull),X(0x45E8BCAE23ull),X(0x45F4D34F9Dull),X(0x4600E9C5F0ull),X(0x460D001114ull),X(0x4619163102ull),X(0x46252C25B3ull),
-	X(0x463141EF1Eull),X(0x463D578D3Eull),X(0x46496D000Aull),X(0x465582477Aull),X(0x4661976388ull),X(0x466DAC542Cull),X(0x4679C1195Eull),X(0x4685D5B317ull),
-	X(0x4691EA214Full),X(0x469DFE63FFull),X(0x46AA127B20ull),X(0x46B62666ABull),X(0x46C23A2697ull),X(0x46CE4DBADDull),X(0x46DA612376ull),X(0x46E674605Aull),
-	X(0x46F2877182ull),X(0x46FE9A56E6ull),X(0x470AAD1080ull),X(0x4716BF9E47ull),X(0x4722D20034ull),X(0x472EE43640ull),X(0x473AF64063ull),X(0x4747081E96ull),
-	X(0x475319D0D1ull),X(0x475F2B570Dull),X(0x476B3CB142ull),X(0x47774DDF6Aull),X(0x47835EE17Cull),X(0x478F6FB771ull),X(0x479B806141ull),X(0x47A790DEE6ull),
-	X(0x47B3A13058ull),X(0x47BFB1558Full),X(0x47CBC14E84ull),X(0x47D7D11B2Full),X(0x47E3E0BB89ull),X(0x47EFF02F8Bull),X(0x47FBFF772Dull),X(0x48080E9268ull),
-	X(0x48141D8134ull),X(0x48202C4389ull),X(0x482C3AD962ull),X(0x48384942B5ull),X(0x4844577F7Bull),X(0x4850658FAEull),X(0x485C737345ull),X(0x4868812A39ull),
-	X(0x48748EB483ull),X(0x48809C121Cull),X(0x488CA942FBull),X(0x4898B6471Aull),X(0x48A4C31E71ull),X(0x48B0CFC8F8ull),X(0x48BCDC46A9ull),X(0x48C8E8977Bull),
-	X(0x48D4F4BB68ull),X(0x48E100B267ull),X(0x48ED0C7C72ull),X(0x48F9181981ull),X(0x490523898Cull),X(0x49112ECC8Cull),X(0x491D39E27Bull),X(0x492944CB4Full),
-	X(0x49354F8702ull),X(0x49415A158Dull),X(0x494D6476E8ull),X(0x49596EAB0Bull),X(0x496578B1F0ull),X(0x4971828B8Eull),X(0x497D8C37DEull),X(0x498995B6D9ull),
-	X(0x49959F0878ull),X(0x49A1A82CB3ull),X(0x49ADB12382ull),X(0x49B9B9ECDFull),X(0x49C5C288C1ull),X(0x49D1CAF721ull),X(0x49DDD337F9ull),X(0x49E9DB4B40ull),
-	X(0x49F5E330EFull),X(0x4A01EAE8FEull),X(0x4A0DF27367ull),X(0x4A19F9D021ull),X(0x4A2600FF26ull),X(0x4A3208006Eull),X(0x4A3E0ED3F2ull),X(0x4A4A1579A9ull),
-	X(0x4A561BF18Dull),X(0x4A62223B97ull),X(0x4A6E2857BEull),X(0x4A7A2E45FCull),X(0x4A86340648ull),X(0x4A9239989Dull),X(0x4A9E3EFCF1ull),X(0x4AAA44333Full),
-	X(0x4AB6493B7Dull),X(0x4AC24E15A6ull),X(0x4ACE52C1B1ull),X(0x4ADA573F97ull),X(0x4AE65B8F51ull),X(0x4AF25FB0D8ull),X(0x4AFE63A423ull),X(0x4B0A67692Cull),
-	X(0x4B166AFFEAull),X(0x4B226E6858ull),X(0x4B2E71A26Cull),X(0x4B3A74AE21ull),X(0x4B46778B6Dull),X(0x4B527A3A4Bull),X(0x4B5E7CBAB3ull),X(0x4B6A7F0C9Cull),
-	X(0x4B76813001ull),X(0x4B828324D8ull),X(0x4B8E84EB1Cull),X(0x4B9A8682C4ull),X(0x4BA687EBCAull),X(0x4BB2892625ull),X(0x4BBE8A31CFull),X(0x4BCA8B0EBFull),
-	X(0x4BD68BBCEFull),X(0x4BE28C3C57ull),X(0x4BEE8C8CF0ull),X(0x4BFA8CAEB2ull),X(0x4C068CA196ull),X(0x4C128C6595ull),X(0x4C1E8BFAA7ull),X(0x4C2A8B60C4ull),
-	X(0x4C368A97E6ull),X(0x4C4289A005ull),X(0x4C4E887919ull),X(0x4C5A87231Bull),X(0x4C66859E05ull),X(0x4C7283E9CDull),X(0x4C7E82066Dull),X(0x4C8A7FF3DEull),
-	X(0x4C967DB218ull),X(0x4CA27B4114ull),X(0x4CAE78A0CAull),X(0x4CBA75D133ull),X(0x4CC672D247ull),X(0x4CD26FA400ull),X(0x4CDE6C4655ull),X(0x4CEA68B940ull),
-	X(0x4CF664FCB9ull),X(0x4D026110B8ull),X(0x4D0E5CF537ull),X(0x4D1A58AA2Dull),X(0x4D26542F94ull),X(0x4D324F8563ull),X(0x4D3E4AAB95ull),X(0x4D4A45A220ull),
-	X(0x4D564068FFull),X(0x4D623B0028ull),X(0x4D6E356796ull),X(0x4D7A2F9F41ull),X(0x4D8629A721ull),X(0x4D92237F2Eull),X(0x4D9E1D2762ull),X(0x4DAA169FB6ull),
-	X(0x4DB60FE821ull),X(0x4DC209009Cull),X(0x4DCE01E920ull),X(0x4DD9FAA1A6ull),X(0x4DE5F32A26ull),X(0x4DF1EB8299ull),X(0x4DFDE3AAF8ull),X(0x4E09DBA33Aull),
-	X(0x4E15D36B59ull),X(0x4E21CB034Dull),X(0x4E2DC26B0Full),X(0x4E39B9A298ull),X(0x4E45B0A9E0ull),X(0x4E51A780DFull),X(0x4E5D9E278Full),X(0x4E69949DE8ull),
-	X(0x4E758AE3E3ull),X(0x4E8180F977ull),X(0x4E8D76DE9Full),X(0x4E996C9352ull),X(0x4EA5621789ull),X(0x4EB1576B3Dull),X(0x4EBD4C8E66ull),X(0x4EC94180FDull),
-	X(0x4ED53642FBull),X(0x4EE12AD458ull),X(0x4EED1F350Dull),X(0x4EF9136512ull),X(0x4F05076460ull),X(0x4F10FB32F1ull),X(0x4F1CEED0BBull),X(0x4F28E23DB8ull),
-	X(0x4F34D579E1ull),X(0x4F40C8852Full),X(0x4F4CBB5F99ull),X(0x4F58AE0918ull),X(0x4F64A081A6ull),X(0x4F7092C93Aull),X(0x4F7C84DFCEull),X(0x4F8876C55Aull),
-	X(0x4F946879D6ull),X(0x4FA059FD3Cull),X(0x4FAC4B4F84ull),X(0x4FB83C70A6ull),X(0x4FC42D609Bull),X(0x4FD01E1F5Cull),X(0x4FDC0EACE2ull),X(0x4FE7FF0925ull),
-	X(0x4FF3EF341Dull),X(0x4FFFDF2DC4ull),X(0x500BCEF612ull),X(0x5017BE8CFFull),X(0x5023ADF285ull),X(0x502F9D269Bull),X(0x503B8C293Bull),X(0x50477AFA5Dull),
-	X(0x50536999FBull),X(0x505F58080Bull),X(0x506B464488ull),X(0x5077344F69ull),X(0x50832228A8ull),X(0x508F0FD03Cull),X(0x509AFD4620ull),X(0x50A6EA8A4Aull),
-	X(0x50B2D79CB5ull),X(0x50BEC47D58ull),X(0x50CAB12C2Dull),X(0x50D69DA92Bull),X(0x50E289F44Cull),X(0x50EE760D88ull),X(0x50FA61F4D8ull),X(0x51064DAA34ull),
-	X(0x5112392D95ull),X(0x511E247EF4ull),X(0x512A0F9E4Aull),X(0x5135FA8B8Eull),X(0x5141E546BBull),X(0x514DCFCFC7ull),X(0x5159BA26ADull),X(0x5165A44B64ull),
-	X(0x51718E3DE6ull),X(0x517D77FE2Aull),X(0x5189618C2Aull),X(0x51954AE7DFull),X(0x51A1341140ull),X(0x51AD1D0847ull),X(0x51B905CCECull),X(0x51C4EE5F28ull),
-	X(0x51D0D6BEF3ull),X(0x51DCBEEC46ull),X(0x51E8A6E71Bull),X(0x51F48EAF69ull),X(0x5200764529ull),X(0x520C5DA853ull),X(0x521844D8E2ull),X(0x52242BD6CCull),
-	X(0x523012A20Bull),X(0x523BF93A98ull),X(0x5247DFA06Aull),X(0x5253C5D37Cull),X(0x525FABD3C4ull),X(0x526B91A13Dull),X(0x5277773BDFull),X(0x52835CA3A2ull),
-	X(0x528F41D87Full),X(0x529B26DA6Full),X(0x52A70BA96Aull),X(0x52B2F04569ull),X(0x52BED4AE65ull),X(0x52CAB8E456ull),X(0x52D69CE735ull),X(0x52E280B6FBull),
-	X(0x52EE6453A0ull),X(0x52FA47BD1Dull),X(0x53062AF36Bull),X(0x53120DF683ull),X(0x531DF0C65Cull),X(0x5329D362F0ull),X(0x5335B5CC38ull),X(0x534198022Bull),
-	X(0x534D7A04C3ull),X(0x53595BD3F9ull),X(0x53653D6FC4ull),X(0x53711ED81Full),X(0x537D000D01ull),X(0x5388E10E62ull),X(0x5394C1DC3Dull),X(0x53A0A27689ull),
-	X(0x53AC82DD3Full),X(0x53B8631057ull),X(0x53C4430FCBull),X(0x53D022DB94ull),X(0x53DC0273A9ull),X(0x53E7E1D803ull),X(0x53F3C1089Cull),X(0x53FFA0056Bull),
-	X(0x540B7ECE6Aull),X(0x54175D6391ull),X(0x54233BC4D9ull),X(0x542F19F23Bull),X(0x543AF7EBAEull),X(0x5446D5B12Dull),X(0x5452B342AFull),X(0x545E90A02Dull),
-	X(0x546A6DC9A0ull),X(0x54764ABF01ull),X(0x5482278048ull),X(0x548E040D6Eull),X(0x5499E0666Cull),X(0x54A5BC8B3Aull),X(0x54B1987BD1ull),X(0x54BD74382Aull),
-	X(0x54C94FC03Dull),X(0x54D52B1403ull),X(0x54E1063375ull),X(0x54ECE11E8Bull),X(0x54F8BBD53Full),X(0x5504965788ull),X(0x551070A560ull),X(0x551C4ABEBFull),
-	X(0x552824A39Eull),X(0x5533FE53F6ull),X(0x553FD7CFBFull),X(0x554BB116F1ull),X(0x55578A2987ull),X(0x5563630778ull),X(0x556F3BB0BCull),X(0x557B14254Eull),
-	X(0x5586EC6525ull),X(0x5592C4703Aull),X(0x559E9C4686ull),X(0x55AA73E801ull),X(0x55B64B54A5ull),X(0x55C2228C69ull),X(0x55CDF98F47ull),X(0x55D9D05D37ull),
-	X(0x55E5A6F633ull),X(0x55F17D5A31ull),X(0x55FD53892Dull),X(0x560929831Dull),X(0x5614FF47FBull),X(0x5620D4D7C0ull),X(0x562CAA3264ull),X(0x56387F57DFull),
-	X(0x564454482Cull),X(0x5650290341ull),X(0x565BFD8919ull),X(0x5667D1D9ABull),X(0x5673A5F4F1ull),X(0x567F79DAE2ull),X(0x568B4D8B79ull),X(0x56972106ADull),
-	X(0x56A2F44C77ull),X(0x56AEC75CD0ull),X(0x56BA9A37B0ull),X(0x56C66CDD11ull),X(0x56D23F4CEBull),X(0x56DE118737ull),X(0x56E9E38BEDull),X(0x56F5B55B07ull),
-	X(0x570186F47Cull),X(0x570D585846ull),X(0x571929865Dull),X(0x5724FA7EBAull),X(0x5730CB4155ull),X(0x573C9BCE29ull),X(0x57486C252Cull),X(0x57543C4658ull),
-	X(0x57600C31A6ull),X(0x576BDBE70Eull),X(0x5777AB6688ull),X(0x57837AB00Full),X(0x578F49C39Aull),X(0x579B18A122ull),X(0x57A6E748A0ull),X(0x57B2B5BA0Dull),
-	X(0x57BE83F560ull),X(0x57CA51FA94ull),X(0x57D61FC9A1ull),X(0x57E1ED627Full),X(0x57EDBAC527ull),X(0x57F987F192ull),X(0x580554E7B8ull),X(0x581121A793ull),
-	X(0x581CEE311Bull),X(0x5828BA8448ull),X(0x583486A115ull),X(0x5840528778ull),X(0x584C1E376Bull),X(0x5857E9B0E7ull),X(0x5863B4F3E4ull),X(0x586F80005Bull),
-	X(0x587B4AD645ull),X(0x588715759Bull),X(0x5892DFDE55ull),X(0x589EAA106Cull),X(0x58AA740BD9ull),X(0x58B63DD094ull),X(0x58C2075E96ull),X(0x58CDD0B5D8ull),
-	X(0x58D999D653ull),X(0x58E562BFFFull),X(0x58F12B72D6ull),X(0x58FCF3EECFull),X(0x5908BC33E4ull),X(0x591484420Dull),X(0x59204C1943ull),X(0x592C13B97Eull),
-	X(0x5937DB22B9ull),X(0x5943A254EAull),X(0x594F69500Cull),X(0x595B301416ull),X(0x5966F6A101ull),X(0x5972BCF6C7ull),X(0x597E831560ull),X(0x598A48FCC4ull),
-	X(0x59960EACEDull),X(0x59A1D425D3ull),X(0x59AD99676Eull),X(0x59B95E71B9ull),X(0x59C52344AAull),X(0x59D0E7E03Cull),X(0x59DCAC4467ull),X(0x59E8707123ull),
-	X(0x59F4346669ull),X(0x59FFF82433ull),X(0x5A0BBBAA78ull),X(0x5A177EF932ull),X(0x5A23421059ull),X(0x5A2F04EFE6ull),X(0x5A3AC797D1ull),X(0x5A468A0815ull),
-	X(0x5A524C40A8ull),X(0x5A5E0E4185ull),X(0x5A69D00AA3ull),X(0x5A75919BFCull),X(0x5A8152F588ull),X(0x5A8D141740ull),X(0x5A98D5011Dull),X(0x5AA495B318ull),
-	X(0x5AB0562D28ull),X(0x5ABC166F48ull),X(0x5AC7D6796Full),X(0x5AD3964B97ull),X(0x5ADF55E5B8ull),X(0x5AEB1547CBull),X(0x5AF6D471C9ull),X(0x5B029363AAull),
-	X(0x5B0E521D68ull),X(0x5B1A109EFAull),X(0x5B25CEE85Bull),X(0x5B318CF982ull),X(0x5B3D4AD268ull),X(0x5B49087306ull),X(0x5B54C5DB55ull),X(0x5B60830B4Eull),
-	X(0x5B6C4002E9ull),X(0x5B77FCC21Full),X(0x5B83B948E9ull),X(0x5B8F759740ull),X(0x5B9B31AD1Bull),X(0x5BA6ED8A75ull),X(0x5BB2A92F46ull),X(0x5BBE649B87ull),
-	X(0x5BCA1FCF30ull),X(0x5BD5DACA3Aull),X(0x5BE1958C9Eull),X(0x5BED501655ull),X(0x5BF90A6757ull),X(0x5C04C47F9Dull),X(0x5C107E5F21ull),X(0x5C1C3805DAull),
-	X(0x5C27F173C2ull),X(0x5C33AAA8D1ull),X(0x5C3F63A500ull),X(0x5C4B1C6848ull),X(0x5C56D4F2A2ull),X(0x5C628D4406ull),X(0x5C6E455C6Dull),X(0x5C79FD3BD0ull),
-	X(0x5C85B4E228ull),X(0x5C916C4F6Dull),X(0x5C9D238398ull),X(0x5CA8DA7EA3ull),X(0x5CB4914085ull),X(0x5CC047C938ull),X(0x5CCBFE18B4ull),X(0x5CD7B42EF2ull),
-	X(0x5CE36A0BEBull),X(0x5CEF1FAF98ull),X(0x5CFAD519F1ull),X(0x5D068A4AF0ull),X(0x5D123F428Cull),X(0x5D1DF400BFull),X(0x5D29A88582ull),X(0x5D355CD0CDull),
-	X(0x5D4110E299ull),X(0x5D4CC4BAE0ull),X(0x5D58785998ull),X(0x5D642BBEBDull),X(0x5D6FDEEA45ull),X(0x5D7B91DC2Bull),X(0x5D87449466ull),X(0x5D92F712F0ull),
-	X(0x5D9EA957C1ull),X(0x5DAA5B62D2ull),X(0x5DB60D341Dull),X(0x5DC1BECB99ull),X(0x5DCD70293Full),X(0x5DD9214D09ull),X(0x5DE4D236EFull),X(0x5DF082E6EAull),
-	X(0x5DFC335CF3ull),X(0x5E07E39902ull),X(0x5E13939B10ull),X(0x5E1F436316ull),X(0x5E2AF2F10Eull),X(0x5E36A244EEull),X(0x5E42515EB1ull),X(0x5E4E003E50ull),
-	X(0x5E59AEE3C2ull),X(0x5E655D4F01ull),X(0x5E710B8006ull),X(0x5E7CB976C9ull),X(0x5E88673344ull),X(0x5E9414B56Eull),X(0x5E9FC1FD41ull),X(0x5EAB6F0AB6ull),
-	X(0x5EB71BDDC5ull),X(0x5EC2C87667ull),X(0x5ECE74D495ull),X(0x5EDA20F848ull),X(0x5EE5CCE178ull),X(0x5EF178901Full),X(0x5EFD240435ull),X(0x5F08CF3DB3ull),
-	X(0x5F147A3C92ull),X(0x5F202500CAull),X(0x5F2BCF8A55ull),X(0x5F3779D92Aull),X(0x5F4323ED44ull),X(0x5F4ECDC69Bull),X(0x5F5A776527ull),X(0x5F6620C8E2ull),
-	X(0x5F71C9F1C3ull),X(0x5F7D72DFC5ull),X(0x5F891B92E0ull),X(0x5F94C40B0Cull),X(0x5FA06C4843ull),X(0x5FAC144A7Dull),X(0x5FB7BC11B3ull),X(0x5FC3639DDEull),
-	X(0x5FCF0AEEF6ull),X(0x5FDAB204F5ull),X(0x5FE658DFD3ull),X(0x5FF1FF7F8Aull),X(0x5FFDA5E411ull),X(0x60094C0D62ull),X(0x6014F1FB76ull),X(0x602097AE45ull),
-	X(0x602C3D25C8ull),X(0x6037E261F8ull),X(0x60438762CEull),X(0x604F2C2843ull),X(0x605AD0B24Full),X(0x60667500EBull),X(0x6072191411ull),X(0x607DBCEBB8ull),
-	X(0x60896087DAull),X(0x609503E870ull),X(0x60A0A70D72ull),X(0x60AC49F6D9ull),X(0x60B7ECA49Eull),X(0x60C38F16BAull),X(0x60CF314D26ull),X(0x60DAD347DAull),
-	X(0x60E67506CFull),X(0x60F21689FFull),X(0x60FDB7D161ull),X(0x610958DCF0ull),X(0x6114F9ACA3ull),X(0x61209A4073ull),X(0x612C3A985Aull),X(0x6137DAB44Full),
-	X(0x61437A944Dull),X(0x614F1A384Cull),X(0x615AB9A043ull),X(0x616658CC2Eull),X(0x6171F7BC03ull),X(0x617D966FBDull),X(0x618934E754ull),X(0x6194D322C0ull),
-	X(0x61A07121FBull),X(0x61AC0EE4FDull),X(0x61B7AC6BC0ull),X(0x61C349B63Cull),X(0x61CEE6C469ull),X(0x61DA839641ull),X(0x61E6202BBDull),X(0x61F1BC84D6ull),
-	X(0x61FD58A183ull),X(0x6208F481BFull),X(0x6214902581ull),X(0x62202B8CC4ull),X(0x622BC6B77Full),X(0x623761A5ABull),X(0x6242FC5742ull),X(0x624E96CC3Cull),
-	X(0x625A310492ull),X(0x6265CB003Cull),X(0x627164BF35ull),X(0x627CFE4174ull),X(0x62889786F2ull),X(0x6294308FA8ull),X(0x629FC95B90ull),X(0x62AB61EAA1ull),
-	X(0x62B6FA3CD5ull),X(0x62C2925225ull),X(0x62CE2A2A89ull),X(0x62D9C1C5FAull),X(0x62E5592472ull),X(0x62F0F045E9ull),X(0x62FC872A57ull),X(0x63081DD1B6ull),
-	X(0x6313B43BFFull),X(0x631F4A692Aull),X(0x632AE05930ull),X(0x6336760C0Aull),X(0x63420B81B2ull),X(0x634DA0BA1Full),X(0x635935B54Bull),X(0x6364CA732Eull),
-	X(0x63705EF3C2ull),X(0x637BF336FEull),X(0x6387873CDDull),X(0x63931B0557ull),X(0x639EAE9065ull),X(0x63AA41DDFFull),X(0x63B5D4EE1Full),X(0x63C167C0BEull),
-	X(0x63CCFA55D3ull),X(0x63D88CAD59ull),X(0x63E41EC748ull),X(0x63EFB0A398ull),X(0x63FB424243ull),X(0x6406D3A342ull),X(0x641264C68Dull),X(0x641DF5AC1Dull),
-	X(0x64298653ECull),X(0x643516BDF2ull),X(0x6440A6EA27ull),X(0x644C36D885ull),X(0x6457C68905ull),X(0x646355FBA0ull),X(0x646EE5304Dull),X(0x647A742707ull),
-	X(0x648602DFC6ull),X(0x6491915A83ull),X(0x649D1F9737ull),X(0x64A8AD95DBull),X(0x64B43B5667ull),X(0x64BFC8D8D4ull),X(0x64CB561D1Cull),X(0x64D6E32337ull),
-	X(0x64E26FEB1Eull),X(0x64EDFC74CBull),X(0x64F988C035ull),X(0x650514CD55ull),X(0x6510A09C26ull),X(0x651C2C2C9Eull),X(0x6527B77EB8ull),X(0x653342926Dull),
-	X(0x653ECD67B4ull),X(0x654A57FE87ull),X(0x6555E256E0ull),X(0x65616C70B6ull),X(0x656CF64C02ull),X(0x65787FE8BEull),X(0x65840946E3ull),X(0x658F926669ull),
-	X(0x659B1B4749ull),X(0x65A6A3E97Cull),X(0x65B22C4CFAull),X(0x65BDB471BEull),X(0x65C93C57C0ull),X(0x65D4C3FEF8ull),X(0x65E04B675Full),X(0x65EBD290EFull),
-	X(0x65F7597BA0ull),X(0x6602E0276Bull),X(0x660E669449ull),X(0x6619ECC234ull),X(0x662572B123ull),X(0x6630F8610Full),X(0x663C7DD1F3ull),X(0x66480303C5ull),
-	X(0x665387F681ull),X(0x665F0CAA1Dull),X(0x666A911E94ull),X(0x66761553DDull),X(0x66819949F3ull),X(0x668D1D00CEull),X(0x6698A07866ull),X(0x66A423B0B5ull),
-	X(0x66AFA6A9B3ull),X(0x66BB29635Aull),X(0x66C6ABDDA3ull),X(0x66D22E1885ull),X(0x66DDB013FBull),X(0x66E931CFFDull),X(0x66F4B34C84ull),X(0x6700348988ull),
-	X(0x670BB58703ull),X(0x67173644EFull),X(0x6722B6C342ull),X(0x672E3701F7ull),X(0x6739B70107ull),X(0x674536C069ull),X(0x6750B64018ull),X(0x675C35800Dull),
-	X(0x6767B4803Full),X(0x67733340A8ull),X(0x677EB1C140ull),X(0x678A300202ull),X(0x6795AE02E5ull),X(0x67A12BC3E3ull),X(0x67ACA944F4ull),X(0x67B8268612ull),
-	X(0x67C3A38735ull),X(0x67CF204856ull),X(0x67DA9CC96Eull),X(0x67E6190A77ull),X(0x67F1950B68ull),X(0x67FD10CC3Bull),X(0x68088C4CE9ull),X(0x6814078D6Bull),
-	X(0x681F828DB9ull),X(0x682AFD4DCDull),X(0x683677CD9Full),X(0x6841F20D29ull),X(0x684D6C0C63ull),X(0x6858E5CB46ull),X(0x68645F49CBull),X(0x686FD887ECull),
-	X(0x687B5185A0ull),X(0x6886CA42E1ull),X(0x689242BFA8ull),X(0x689DBAFBEEull),X(0x68A932F7ACull),X(0x68B4AAB2DAull),X(0x68C0222D72ull),X(0x68CB99676Cull),
-	X(0x68D71060C1ull),X(0x68E287196Bull),X(0x68EDFD9162ull),X(0x68F973C89Full),X(0x6904E9BF1Cull),X(0x69105F74D0ull),X(0x691BD4E9B6ull),X(0x69274A1DC5ull),
-	X(0x6932BF10F7ull),X(0x693E33C345ull),X(0x6949A834A7ull),X(0x69551C6518ull),X(0x696090548Eull),X(0x696C040305ull),X(0x6977777073ull),X(0x6982EA9CD3ull),
-	X(0x698E5D881Eull),X(0x6999D0324Bull),X(0x69A5429B55ull),X(0x69B0B4C334ull),X(0x69BC26A9E1ull),X(0x69C7984F55ull),X(0x69D309B389ull),X(0x69DE7AD676ull),
-	X(0x69E9EBB814ull),X(0x69F55C585Eull),X(0x6A00CCB74Bull),X(0x6A0C3CD4D5ull),X(0x6A17ACB0F4ull),X(0x6A231C4BA2ull),X(0x6A2E8BA4D8ull),X(0x6A39FABC8Dull),
-	X(0x6A456992BDull),X(0x6A50D8275Eull),X(0x6A5C467A6Bull),X(0x6A67B48BDCull),X(0x6A73225BAAull),X(0x6A7E8FE9CFull),X(0x6A89FD3642ull),X(0x6A956A40FEull),
-	X(0x6AA0D709FAull),X(0x6AAC439131ull),X(0x6AB7AFD69Aull),X(0x6AC31BDA2Full),X(0x6ACE879BE9ull),X(0x6AD9F31BC1ull),X(0x6AE55E59B0ull),X(0x6AF0C955AEull),
-	X(0x6AFC340FB4ull),X(0x6B079E87BDull),X(0x6B1308BDC0ull),X(0x6B1E72B1B6ull),X(0x6B29DC6399ull),X(0x6B3545D361ull),X(0x6B40AF0107ull),X(0x6B4C17EC85ull),
-	X(0x6B578095D4ull),X(0x6B62E8FCEBull),X(0x6B6E5121C5ull),X(0x6B79B9045Aull),X(0x6B8520A4A3ull),X(0x6B90880299ull),X(0x6B9BEF1E35ull),X(0x6BA755F771ull),
-	X(0x6BB2BC8E44ull),X(0x6BBE22E2A8ull),X(0x6BC988F496ull),X(0x6BD4EEC408ull),X(0x6BE05450F5ull),X(0x6BEBB99B57ull),X(0x6BF71EA326ull),X(0x6C0283685Dull),
-	X(0x6C0DE7EAF3ull),X(0x6C194C2AE2ull),X(0x6C24B02823ull),X(0x6C3013E2AFull),X(0x6C3B775A7Eull),X(0x6C46DA8F89ull),X(0x6C523D81CBull),X(0x6C5DA0313Bull),
-	X(0x6C69029DD2ull),X(0x6C7464C78Bull),X(0x6C7FC6AE5Cull),X(0x6C8B285240ull),X(0x6C9689B330ull),X(0x6CA1EAD124ull),X(0x6CAD4BAC16ull),X(0x6CB8AC43FEull),
-	X(0x6CC40C98D5ull),X(0x6CCF6CAA95ull),X(0x6CDACC7936ull),X(0x6CE62C04B2ull),X(0x6CF18B4D00ull),X(0x6CFCEA521Cull),X(0x6D084913FCull),X(0x6D13A7929Bull),
-	X(0x6D1F05CDF1ull),X(0x6D2A63C5F7ull),X(0x6D35C17AA7ull),X(0x6D411EEBF9ull),X(0x6D4C7C19E6ull),X(0x6D57D90467ull),X(0x6D6335AB76ull),X(0x6D6E920F0Aull),
-	X(0x6D79EE2F1Eull),X(0x6D854A0BABull),X(0x6D90A5A4A8ull),X(0x6D9C00FA0Full),X(0x6DA75C0BDAull),X(0x6DB2B6DA01ull),X(0x6DBE11647Dull),X(0x6DC96BAB47ull),
-	X(0x6DD4C5AE59ull),X(0x6DE01F6DAAull),X(0x6DEB78E935ull),X(0x6DF6D220F2ull),X(0x6E022B14DAull),X(0x6E0D83C4E6ull),X(0x6E18DC310Full),X(0x6E2434594Full),
-	X(0x6E2F8C3D9Eull),X(0x6E3AE3DDF4ull),X(0x6E463B3A4Dull),X(0x6E5192529Full),X(0x6E5CE926E4ull),X(0x6E683FB716ull),X(0x6E7396032Cull),X(0x6E7EEC0B21ull),
-	X(0x6E8A41CEEDull),X(0x6E95974E8Aull),X(0x6EA0EC89EFull),X(0x6EAC418117ull),X(0x6EB79633FAull),X(0x6EC2EAA291ull),X(0x6ECE3ECCD6ull),X(0x6ED992B2C1ull),
-	X(0x6EE4E6544Bull),X(0x6EF039B16Dull),X(0x6EFB8CCA21ull),X(0x6F06DF9E5Full),X(0x6F12322E21ull),X(0x6F1D84795Eull),X(0x6F28D68011ull),X(0x6F34284233ull),
-	X(0x6F3F79BFBCull),X(0x6F4ACAF8A5ull),X(0x6F561BECE8ull),X(0x6F616C9C7Dull),X(0x6F6CBD075Eull),X(0x6F780D2D83ull),X(0x6F835D0EE6ull),X(0x6F8EACAB80ull),
-	X(0x6F99FC0348ull),X(0x6FA54B163Aull),X(0x6FB099E44Dull),X(0x6FBBE86D7Bull),X(0x6FC736B1BCull),X(0x6FD284B10Bull),X(0x6FDDD26B5Eull),X(0x6FE91FE0B1ull),
-	X(0x6FF46D10FBull),X(0x6FFFB9FC37ull),X(0x700B06A25Cull),X(0x7016530364ull),X(0x70219F1F48ull),X(0x702CEAF600ull),X(0x7038368787ull),X(0x704381D3D5ull),
-	X(0x704ECCDAE2ull),X(0x705A179CA9ull),X(0x7065621922ull),X(0x7070AC5046ull),X(0x707BF6420Eull),X(0x70873FEE74ull),X(0x709289556Full),X(0x709DD276FAull),
-	X(0x70A91B530Dull),X(0x70B463E9A2ull),X(0x70BFAC3AB1ull),X(0x70CAF44633ull),X(0x70D63C0C22ull),X(0x70E1838C77ull),X(0x70ECCAC72Aull),X(0x70F811BC34ull),
-	X(0x7103586B90ull),X(0x710E9ED534ull),X(0x7119E4F91Cull),X(0x71252AD740ull),X(0x7130706F98ull),X(0x713BB5C21Eull),X(0x7146FACECBull),X(0x71523F9598ull),
-	X(0x715D84167Eull),X(0x7168C85176ull),X(0x71740C4679ull),X(0x717F4FF581ull),X(0x718A935E85ull),X(0x7195D68180ull),X(0x71A1195E6Bull),X(0x71AC5BF53Dull),
-	X(0x71B79E45F1ull),X(0x71C2E05080ull),X(0x71CE2214E2ull),X(0x71D9639311ull),X(0x71E4A4CB05ull),X(0x71EFE5BCB8ull),X(0x71FB266823ull),X(0x720666CD3Full),
-	X(0x7211A6EC04ull),X(0x721CE6C46Dull),X(0x7228265671ull),X(0x723365A20Bull),X(0x723EA4A733ull),X(0x7249E365E1ull),X(0x725521DE11ull),X(0x7260600FB9ull),
-	X(0x726B9DFAD4ull),X(0x7276DB9F5Bull),X(0x728218FD45ull),X(0x728D56148Eull),X(0x729892E52Dull),X(0x72A3CF6F1Cull),X(0x72AF0BB254ull),X(0x72BA47AECDull),
-	X(0x72C5836482ull),X(0x72D0BED36Aull),X(0x72DBF9FB80ull),X(0x72E734DCBBull),X(0x72F26F7716ull),X(0x72FDA9CA8Aull),X(0x7308E3D70Eull),X(0x73141D9C9Dull),
-	X(0x731F571B30ull),X(0x732A9052BFull),X(0x7335C94344ull),X(0x734101ECB7ull),X(0x734C3A4F13ull),X(0x7357726A4Full),X(0x7362AA3E65ull),X(0x736DE1CB4Full),
-	X(0x7379191104ull),X(0x7384500F7Full),X(0x738F86C6B8ull),X(0x739ABD36A9ull),X(0x73A5F35F4Aull),X(0x73B1294094ull),X(0x73BC5EDA81ull),X(0x73C7942D0Aull),
-	X(0x73D2C93828ull),X(0x73DDFDFBD3ull),X(0x73E9327806ull),X(0x73F466ACB9ull),X(0x73FF9A99E4ull),X(0x740ACE3F82ull),X(0x7416019D8Cull),X(0x742134B3FAull),
-	X(0x742C6782C5ull),X(0x74379A09E7ull),X(0x7442CC4959ull),X(0x744DFE4114ull),X(0x74592FF110ull),X(0x7464615947ull),X(0x746F9279B3ull),X(0x747AC3524Cull),
-	X(0x7485F3E30Bull),X(0x7491242BE9ull),X(0x749C542CE0ull),X(0x74A783E5E9ull),X(0x74B2B356FCull),X(0x74BDE28013ull),X(0x74C9116127ull),X(0x74D43FFA30ull),
-	X(0x74DF6E4B29ull),X(0x74EA9C540Aull),X(0x74F5CA14CDull),X(0x7500F78D6Aull),X(0x750C24BDDAull),X(0x751751A617ull),X(0x75227E4619ull),X(0x752DAA9DDBull),
-	X(0x7538D6AD54ull),X(0x754402747Full),X(0x754F2DF353ull),X(0x755A5929CBull),X(0x75658417DFull),X(0x7570AEBD89ull),X(0x757BD91AC1ull),X(0x7587032F81ull),
-	X(0x75922CFBC2ull),X(0x759D567F7Dull),X(0x75A87FBAAAull),X(0x75B3A8AD44ull),X(0x75BED15744ull),X(0x75C9F9B8A1ull),X(0x75D521D156ull),X(0x75E049A15Cull),
-	X(0x75EB7128ACull),X(0x75F698673Eull),X(0x7601BF5D0Cull),X(0x760CE60A10ull),X(0x76180C6E41ull),X(0x762332899Bull),X(0x762E585C14ull),X(0x76397DE5A7ull),
-	X(0x7644A3264Dull),X(0x764FC81DFFull),X(0x765AECCCB5ull),X(0x766611326Aull),X(0x7671354F16ull),X(0x767C5922B2ull),X(0x76877CAD38ull),X(0x76929FEEA1ull),
-	X(0x769DC2E6E5ull),X(0x76A8E595FEull),X(0x76B407FBE5ull),X(0x76BF2A1893ull),X(0x76CA4BEC02ull),X(0x76D56D762Aull),X(0x76E08EB704ull),X(0x76EBAFAE8Aull),
-	X(0x76F6D05CB5ull),X(0x7701F0C17Eull),X(0x770D10DCDEull),X(0x771830AECEull),X(0x7723503747ull),X(0x772E6F7643ull),X(0x77398E6BBBull),X(0x7744AD17A7ull),
-	X(0x774FCB7A01ull),X(0x775AE992C2ull),X(0x77660761E4ull),X(0x777124E75Full),X(0x777C42232Cull),X(0x77875F1545ull),X(0x77927BBDA3ull),X(0x779D981C3Eull),
-	X(0x77A8B43111ull),X(0x77B3CFFC14ull),X(0x77BEEB7D40ull),X(0x77CA06B48Full),X(0x77D521A1F9ull),X(0x77E03C4578ull),X(0x77EB569F06ull),X(0x77F670AE9Aull),
-	X(0x78018A742Eull),X(0x780CA3EFBCull),X(0x7817BD213Dull),X(0x7822D608A9ull),X(0x782DEEA5FAull),X(0x783906F929ull),X(0x78441F022Full),X(0x784F36C106ull),
-	X(0x785A4E35A6ull),X(0x7865656009ull),X(0x78707C4028ull),X(0x787B92D5FBull),X(0x7886A9217Dull),X(0x7891BF22A6ull),X(0x789CD4D96Full),X(0x78A7EA45D2ull),
-	X(0x78B2FF67C8ull),X(0x78BE143F4Aull),X(0x78C928CC51ull),X(0x78D43D0ED6ull),X(0x78DF5106D3ull),X(0x78EA64B440ull),X(0x78F5781717ull),X(0x79008B2F51ull),
-	X(0x790B9DFCE7ull),X(0x7916B07FD2ull),X(0x7921C2B80Cull),X(0x792CD4A58Dull),X(0x7937E64850ull),X(0x7942F7A04Cull),X(0x794E08AD7Bull),X(0x7959196FD7ull),
-	X(0x796429E758ull),X(0x796F3A13F7ull),X(0x797A49F5AFull),X(0x7985598C78ull),X(0x799068D84Aull),X(0x799B77D921ull),X(0x79A6868EF3ull),X(0x79B194F9BCull),
-	X(0x79BCA31973ull),X(0x79C7B0EE12ull),X(0x79D2BE7793ull),X(0x79DDCBB5EEull),X(0x79E8D8A91Dull),X(0x79F3E55119ull),X(0x79FEF1ADDAull),X(0x7A09FDBF5Bull),
-	X(0x7A15098594ull),X(0x7A2015007Full),X(0x7A2B203014ull),X(0x7A362B144Dull),X(0x7A4135AD24ull),X(0x7A4C3FFA91ull),X(0x7A5749FC8Dull),X(0x7A6253B312ull),
-	X(0x7A6D5D1E19ull),X(0x7A78663D9Bull),X(0x7A836F1191ull),X(0x7A8E7799F4ull),X(0x7A997FD6BFull),X(0x7AA487C7E9ull),X(0x7AAF8F6D6Cull),X(0x7ABA96C741ull),
-	X(0x7AC59DD562ull),X(0x7AD0A497C8ull),X(0x7ADBAB0E6Bull),X(0x7AE6B13945ull),X(0x7AF1B71850ull),X(0x7AFCBCAB84ull),X(0x7B07C1F2DBull),X(0x7B12C6EE4Dull),
-	X(0x7B1DCB9DD5ull),X(0x7B28D0016Aull),X(0x7B33D41907ull),X(0x7B3ED7E4A5ull),X(0x7B49DB643Dull),X(0x7B54DE97C8ull),X(0x7B5FE17F3Full),X(0x7B6AE41A9Bull),
-	X(0x7B75E669D6ull),X(0x7B80E86CE9ull),X(0x7B8BEA23CEull),X(0x7B96EB8E7Cull),X(0x7BA1ECACEEull),X(0x7BACED7F1Dull),X(0x7BB7EE0501ull),X(0x7BC2EE3E95ull),
-	X(0x7BCDEE2BD2ull),X(0x7BD8EDCCAFull),X(0x7BE3ED2128ull),X(0x7BEEEC2935ull),X(0x7BF9EAE4CEull),X(0x7C04E953EFull),X(0x7C0FE7768Full),X(0x7C1AE54CA8ull),
-	X(0x7C25E2D633ull),X(0x7C30E01329ull),X(0x7C3BDD0384ull),X(0x7C46D9A73Dull),X(0x7C51D5FE4Cull),X(0x7C5CD208ACull),X(0x7C67CDC656ull),X(0x7C72C93742ull),
-	X(0x7C7DC45B6Aull),X(0x7C88BF32C7ull),X(0x7C93B9BD52ull),X(0x7C9EB3FB05ull),X(0x7CA9ADEBD9ull),X(0x7CB4A78FC7ull),X(0x7CBFA0E6C8ull),X(0x7CCA99F0D5ull),
-	X(0x7CD592ADE9ull),X(0x7CE08B1DFBull),X(0x7CEB834106ull),X(0x7CF67B1701ull),X(0x7D01729FE8ull),X(0x7D0C69DBB2ull),X(0x7D1760CA5Aull),X(0x7D22576BD8ull),
-	X(0x7D2D4DC026ull),X(0x7D3843C73Cull),X(0x7D43398115ull),X(0x7D4E2EEDA8ull),X(0x7D59240CF1ull),X(0x7D6418DEE7ull),X(0x7D6F0D6384ull),X(0x7D7A019AC2ull),
-	X(0x7D84F58499ull),X(0x7D8FE92103ull),X(0x7D9ADC6FF9ull),X(0x7DA5CF7174ull),X(0x7DB0C2256Eull),X(0x7DBBB48BDFull),X(0x7DC6A6A4C1ull),X(0x7DD198700Eull),
-	X(0x7DDC89EDBEull),X(0x7DE77B1DCBull),X(0x7DF26C002Eull),X(0x7DFD5C94E0ull),X(0x7E084CDBDBull),X(0x7E133CD517ull),X(0x7E1E2C808Full),X(0x7E291BDE3Bull),
-	X(0x7E340AEE14ull),X(0x7E3EF9B014ull),X(0x7E49E82434ull),X(0x7E54D64A6Dull),X(0x7E5FC422B9ull),X(0x7E6AB1AD11ull),X(0x7E759EE96Eull),X(0x7E808BD7C9ull),
-	X(0x7E8B78781Bull),X(0x7E9664CA5Full),X(0x7EA150CE8Cull),X(0x7EAC3C849Dull),X(0x7EB727EC8Bull),X(0x7EC213064Eull),X(0x7ECCFDD1E1ull),X(0x7ED7E84F3Cull),
-	X(0x7EE2D27E59ull),X(0x7EEDBC5F31ull),X(0x7EF8A5F1BDull),X(0x7F038F35F6ull),X(0x7F0E782BD6ull),X(0x7F1960D357ull),X(0x7F24492C70ull),X(0x7F2F31371Dull),
-	X(0x7F3A18F355ull),X(0x7F45006112ull),X(0x7F4FE7804Dull),X(0x7F5ACE5101ull),X(0x7F65B4D325ull),X(0x7F709B06B3ull),X(0x7F7B80EBA5ull),X(0x7F866681F4ull),
-	X(0x7F914BC998ull),X(0x7F9C30C28Dull),X(0x7FA7156CC9ull),X(0x7FB1F9C848ull),X(0x7FBCDDD502ull),X(0x7FC7C192F0ull),X(0x7FD2A5020Cull),X(0x7FDD88224Full),
-	X(0x7FE86AF3B2ull),X(0x7FF34D762Full),X(0x7FFE2FA9BFull),X(0x8009118E5Bull),X(0x8013F323FCull),X(0x801ED46A9Dull),X(0x8029B56235ull),X(0x8034960ABEull),
-	X(0x803F766433ull),X(0x804A566E8Bull),X(0x80553629C0ull),X(0x80601595CCull),X(0x806AF4B2A7ull),X(0x8075D3804Cull),X(0x8080B1FEB3ull),X(0x808B902DD5ull),
-	X(0x80966E0DADull),X(0x80A14B9E33ull),X(0x80AC28DF60ull),X(0x80B705D12Eull),X(0x80C1E27397ull),X(0x80CCBEC693ull),X(0x80D79ACA1Bull),X(0x80E2767E2Aull),
-	X(0x80ED51E2B8ull),X(0x80F82CF7BFull),X(0x810307BD37ull),X(0x810DE2331Bull),X(0x8118BC5964ull),X(0x812396300Aull),X(0x812E6FB708ull),X(0x813948EE56ull),
-	X(0x814421D5EDull),X(0x814EFA6DC8ull),X(0x8159D2B5E0ull),X(0x8164AAAE2Dull),X(0x816F8256A9ull),X(0x817A59AF4Eull),X(0x818530B814ull),X(0x81900770F5ull),
-	X(0x819ADDD9EAull),X(0x81A5B3F2EDull),X(0x81B089BBF7ull),X(0x81BB5F3501ull),X(0x81C6345E05ull),X(0x81D10936FCull),X(0x81DBDDBFDFull),X(0x81E6B1F8A7ull),
-	X(0x81F185E14Eull),X(0x81FC5979CDull),X(0x82072CC21Eull),X(0x8211FFBA3Aull),X(0x821CD2621Aull),X(0x8227A4B9B7ull),X(0x823276C10Bull),X(0x823D48780Full),
-	X(0x824819DEBCull),X(0x8252EAF50Cull),X(0x825DBBBAF8ull),X(0x82688C307Aull),X(0x82735C558Bull),X(0x827E2C2A23ull),X(0x8288FBAE3Dull),X(0x8293CAE1D1ull),
-	X(0x829E99C4DAull),X(0x82A9685750ull),X(0x82B436992Dull),X(0x82BF048A6Aull),X(0x82C9D22B00ull),X(0x82D49F7AE9ull),X(0x82DF6C7A1Eull),X(0x82EA392898ull),
-	X(0x82F5058651ull),X(0x82FFD19342ull),X(0x830A9D4F65ull),X(0x831568BAB3ull),X(0x832033D524ull),X(0x832AFE9EB3ull),X(0x8335C91759ull),X(0x8340933F0Full),
-	X(0x834B5D15CEull),X(0x8356269B90ull),X(0x8360EFD04Eull),X(0x836BB8B402ull),X(0x83768146A5ull),X(0x8381498830ull),X(0x838C11789Cull),X(0x8396D917E4ull),
-	X(0x83A1A065FFull),X(0x83AC6762E9ull),X(0x83B72E0E99ull),X(0x83C1F46909ull),X(0x83CCBA7234ull),X(0x83D7802A11ull),X(0x83E245909Aull),X(0x83ED0AA5CAull),
-	X(0x83F7CF6998ull),X(0x840293DBFFull),X(0x840D57FCF8ull),X(0x84181BCC7Cull),X(0x8422DF4A84ull),X(0x842DA2770Aull),X(0x8438655208ull),X(0x844327DB76ull),
-	X(0x844DEA134Eull),X(0x8458ABF989ull),X(0x84636D8E21ull),X(0x846E2ED110ull),X(0x8478EFC24Dull),X(0x8483B061D4ull),X(0x848E70AF9Cull),X(0x849930ABA0ull),
-	X(0x84A3F055D9ull),X(0x84AEAFAE40ull),X(0x84B96EB4CFull),X(0x84C42D697Full),X(0x84CEEBCC4Aull),X(0x84D9A9DD28ull),X(0x84E4679C13ull),X(0x84EF250904ull),
-	X(0x84F9E223F6ull),X(0x85049EECE1ull),X(0x850F5B63BEull),X(0x851A178888ull),X(0x8524D35B37ull),X(0x852F8EDBC4ull),X(0x853A4A0A2Aull),X(0x854504E661ull),
-	X(0x854FBF7063ull),X(0x855A79A82Aull),X(0x8565338DAEull),X(0x856FED20E9ull),X(0x857AA661D5ull),X(0x85855F506Aull),X(0x859017ECA3ull),X(0x859AD03678ull),
-	X(0x85A5882DE4ull),X(0x85B03FD2DEull),X(0x85BAF72562ull),X(0x85C5AE2567ull),X(0x85D064D2E8ull),X(0x85DB1B2DDEull),X(0x85E5D13643ull),X(0x85F086EC0Full),
-	X(0x85FB3C4F3Cull),X(0x8605F15FC4ull),X(0x8610A61D9Full),X(0x861B5A88C8ull),X(0x86260EA138ull),X(0x8630C266E7ull),X(0x863B75D9D1ull),X(0x864628F9EDull),
-	X(0x8650DBC735ull),X(0x865B8E41A3ull),X(0x8666406930ull),X(0x8670F23DD6ull),X(0x867BA3BF8Dull),X(0x868654EE50ull),X(0x869105CA18ull),X(0x869BB652DDull),
-	X(0x86A666889Bull),X(0x86B1166B49ull),X(0x86BBC5FAE1ull),X(0x86C675375Dull),X(0x86D12420B7ull),X(0x86DBD2B6E7ull),X(0x86E680F9E6ull),X(0x86F12EE9B0ull),
-	X(0x86FBDC863Cull),X(0x870689CF84ull),X(0x871136C582ull),X(0x871BE3682Full),X(0x87268FB784ull),X(0x87313BB37Bull),X(0x873BE75C0Eull),X(0x874692B135ull),
-	X(0x87513DB2EAull),X(0x875BE86127ull),X(0x876692BBE5ull),X(0x87713CC31Dull),X(0x877BE676C9ull),X(0x87868FD6E2ull),X(0x879138E362ull),X(0x879BE19C42ull),
-	X(0x87A68A017Bull),X(0x87B1321308ull),X(0x87BBD9D0E1ull),X(0x87C6813AFFull),X(0x87D128515Dull),X(0x87DBCF13F3ull),X(0x87E67582BCull),X(0x87F11B9DAFull),
-	X(0x87FBC164C8ull),X(0x880666D7FFull),X(0x88110BF74Eull),X(0x881BB0C2AFull),X(0x8826553A1Aull),X(0x8830F95D89ull),X(0x883B9D2CF5ull),X(0x884640A858ull),
-	X(0x8850E3CFACull),X(0x885B86A2EAull),X(0x886629220Bull),X(0x8870CB4D09ull),X(0x887B6D23DDull),X(0x88860EA680ull),X(0x8890AFD4EDull),X(0x889B50AF1Cull),
-	X(0x88A5F13507ull),X(0x88B09166A7ull),X(0x88BB3143F6ull),X(0x88C5D0CCEEull),X(0x88D0700187ull),X(0x88DB0EE1BBull),X(0x88E5AD6D84ull),X(0x88F04BA4DBull),
-	X(0x88FAE987BAull),X(0x8905871619ull),X(0x8910244FF3ull),X(0x891AC13541ull),X(0x89255DC5FCull),X(0x892FFA021Eull),X(0x893A95E9A0ull),X(0x8945317C7Cull),
-	X(0x894FCCBAABull),X(0x895A67A426ull),X(0x89650238E8ull),X(0x896F9C78E9ull),X(0x897A366423ull),X(0x8984CFFA90ull),X(0x898F693C28ull),X(0x899A0228E6ull),
-	X(0x89A49AC0C2ull),X(0x89AF3303B7ull),X(0x89B9CAF1BEull),X(0x89C4628AD0ull),X(0x89CEF9CEE7ull),X(0x89D990BDFBull),X(0x89E4275808ull),X(0x89EEBD9D05ull),
-	X(0x89F9538CEDull),X(0x8A03E927B9ull),X(0x8A0E7E6D63ull),X(0x8A19135DE3ull),X(0x8A23A7F934ull),X(0x8A2E3C3F4Full),X(0x8A38D0302Dull),X(0x8A4363CBC9ull),
-	X(0x8A4DF7121Aull),X(0x8A588A031Bull),X(0x8A631C9EC6ull),X(0x8A6DAEE513ull),X(0x8A7840D5FDull),X(0x8A82D2717Cull),X(0x8A8D63B78Bull),X(0x8A97F4A822ull),
-	X(0x8AA285433Cull),X(0x8AAD1588D1ull),X(0x8AB7A578DBull),X(0x8AC2351354ull),X(0x8ACCC45835ull),X(0x8AD7534778ull),X(0x8AE1E1E115ull),X(0x8AEC702508ull),
-	X(0x8AF6FE1348ull),X(0x8B018BABD0ull),X(0x8B0C18EE99ull),X(0x8B16A5DB9Dull),X(0x8B213272D4ull),X(0x8B2BBEB439ull),X(0x8B364A9FC5ull),X(0x8B40D63572ull),
-	X(0x8B4B617538ull),X(0x8B55EC5F12ull),X(0x8B6076F2FAull),X(0x8B6B0130E7ull),X(0x8B758B18D5ull),X(0x8B8014AABCull),X(0x8B8A9DE696ull),X(0x8B9526CC5Cull),
-	X(0x8B9FAF5C09ull),X(0x8BAA379595ull),X(0x8BB4BF78FAull),X(0x8BBF470632ull),X(0x8BC9CE3D35ull),X(0x8BD4551DFEull),X(0x8BDEDBA886ull),X(0x8BE961DCC7ull),
-	X(0x8BF3E7BABAull),X(0x8BFE6D4258ull),X(0x8C08F2739Bull),X(0x8C13774E7Dull),X(0x8C1DFBD2F7ull),X(0x8C28800103ull),X(0x8C3303D899ull),X(0x8C3D8759B4ull),
-	X(0x8C480A844Eull),X(0x8C528D585Full),X(0x8C5D0FD5E1ull),X(0x8C6791FCCEull),X(0x8C7213CD1Full),X(0x8C7C9546CEull),X(0x8C871669D4ull),X(0x8C9197362Aull),
-	X(0x8C9C17ABCCull),X(0x8CA697CAB0ull),X(0x8CB11792D3ull),X(0x8CBB97042Cull),X(0x8CC6161EB5ull),X(0x8CD094E268ull),X(0x8CDB134F3Full),X(0x8CE5916533ull),
-	X(0x8CF00F243Dull),X(0x8CFA8C8C57ull),X(0x8D05099D7Bull),X(0x8D0F8657A1ull),X(0x8D1A02BAC5ull),X(0x8D247EC6DEull),X(0x8D2EFA7BE7ull),X(0x8D3975D9DAull),
-	X(0x8D43F0E0AFull),X(0x8D4E6B9060ull),X(0x8D58E5E8E7ull),X(0x8D635FEA3Eull),X(0x8D6DD9945Dull),X(0x8D7852E73Full),X(0x8D82CBE2DCull),X(0x8D8D44872Full),
-	X(0x8D97BCD432ull),X(0x8DA234C9DCull),X(0x8DACAC6829ull),X(0x8DB723AF12ull),X(0x8DC19A9E90ull),X(0x8DCC11369Cull),X(0x8DD6877731ull),X(0x8DE0FD6048ull),
-	X(0x8DEB72F1DAull),X(0x8DF5E82BE1ull),X(0x8E005D0E56ull),X(0x8E0AD19934ull),X(0x8E1545CC73ull),X(0x8E1FB9A80Dull),X(0x8E2A2D2BFCull),X(0x8E34A05839ull),
-	X(0x8E3F132CBEull),X(0x8E4985A984ull),X(0x8E53F7CE85ull),X(0x8E5E699BBBull),X(0x8E68DB111Full),X(0x8E734C2EAAull),X(0x8E7DBCF456ull),X(0x8E882D621Dull),
-	X(0x8E929D77F9ull),X(0x8E9D0D35E2ull),X(0x8EA77C9BD2ull),X(0x8EB1EBA9C4ull),X(0x8EBC5A5FB0ull),X(0x8EC6C8BD90ull),X(0x8ED136C35Eull),X(0x8EDBA47113ull),
-	X(0x8EE611C6A8ull),X(0x8EF07EC418ull),X(0x8EFAEB695Cull),X(0x8F0557B66Eull),X(0x8F0FC3AB46ull),X(0x8F1A2F47DFull),X(0x8F249A8C33ull),X(0x8F2F05783Aull),
-	X(0x8F39700BEEull),X(0x8F43DA4749ull),X(0x8F4E442A45ull),X(0x8F58ADB4DBull),X(0x8F6316E704ull),X(0x8F6D7FC0BBull),X(0x8F77E841F9ull),X(0x8F82506AB7ull),
-	X(0x8F8CB83AEEull),X(0x8F971FB29Aull),X(0x8FA186D1B2ull),X(0x8FABED9832ull),X(0x8FB6540611ull),X(0x8FC0BA1B4Bull),X(0x8FCB1FD7D7ull),X(0x8FD5853BB1ull),
-	X(0x8FDFEA46D2ull),X(0x8FEA4EF933ull),X(0x8FF4B352CDull),X(0x8FFF17539Bull),X(0x90097AFB96ull),X(0x9013DE4AB8ull),X(0x901E4140FAull),X(0x9028A3DE55ull),
-	X(0x90330622C4ull),X(0x903D680E40ull),X(0x9047C9A0C2ull),X(0x90522ADA45ull),X(0x905C8BBAC1ull),X(0x9066EC4231ull),X(0x90714C708Dull),X(0x907BAC45D0ull),
-	X(0x90860BC1F4ull),X(0x90906AE4F1ull),X(0x909AC9AEC1ull),X(0x90A5281F5Eull),X(0x90AF8636C2ull),X(0x90B9E3F4E6ull),X(0x90C44159C4ull),X(0x90CE9E6555ull),
-	X(0x90D8FB1793ull),X(0x90E3577078ull),X(0x90EDB36FFDull),X(0x90F80F161Bull),X(0x91026A62CEull),X(0x910CC5560Dull),X(0x91171FEFD3ull),X(0x91217A3019ull),
-	X(0x912BD416D9ull),X(0x91362DA40Cull),X(0x914086D7ACull),X(0x914ADFB1B4ull),X(0x915538321Bull),X(0x915F9058DDull),X(0x9169E825F2ull),X(0x91743F9954ull),
-	X(0x917E96B2FDull),X(0x9188ED72E7ull),X(0x919343D90Aull),X(0x919D99E561ull),X(0x91A7EF97E6ull),X(0x91B244F091ull),X(0x91BC99EF5Dull),X(0x91C6EE9444ull),
-	X(0x91D142DF3Eull),X(0x91DB96D045ull),X(0x91E5EA6753ull),X(0x91F03DA463ull),X(0x91FA90876Cull),X(0x9204E3106Aull),X(0x920F353F55ull),X(0x9219871427ull),
-	X(0x9223D88EDAull),X(0x922E29AF68ull),X(0x92387A75CAull),X(0x9242CAE1F9ull),X(0x924D1AF3F0ull),X(0x92576AABA8ull),X(0x9261BA091Bull),X(0x926C090C42ull),
-	X(0x927657B517ull),X(0x9280A60393ull),X(0x928AF3F7B1ull),X(0x929541916Aull),X(0x929F8ED0B7ull),X(0x92A9DBB592ull),X(0x92B4283FF5ull),X(0x92BE746FDAull),
-	X(0x92C8C0453Aull),X(0x92D30BC00Full),X(0x92DD56E052ull),X(0x92E7A1A5FDull),X(0x92F1EC1109ull),X(0x92FC362172ull),X(0x93067FD72Full),X(0x9310C9323Bull),
-	X(0x931B12328Full),X(0x93255AD825ull),X(0x932FA322F7ull),X(0x9339EB12FEull),X(0x934432A834ull),X(0x934E79E293ull),X(0x9358C0C214ull),X(0x93630746B1ull),
-	X(0x936D4D7064ull),X(0x9377933F26ull),X(0x9381D8B2F0ull),X(0x938C1DCBBEull),X(0x9396628987ull),X(0x93A0A6EC47ull),X(0x93AAEAF3F6ull),X(0x93B52EA08Eull),
-	X(0x93BF71F20Aull),X(0x93C9B4E862ull),X(0x93D3F78390ull),X(0x93DE39C38Eull),X(0x93E87BA856ull),X(0x93F2BD31E1ull),X(0x93FCFE6029ull),X(0x94073F3328ull),
-	X(0x94117FAAD7ull),X(0x941BBFC72Full),X(0x9425FF882Cull),X(0x94303EEDC6ull),X(0x943A7DF7F7ull),X(0x9444BCA6B8ull),X(0x944EFAFA05ull),X(0x945938F1D5ull),
-	X(0x9463768E22ull),X(0x946DB3CEE8ull),X(0x9477F0B41Eull),X(0x94822D3DBFull),X(0x948C696BC5ull),X(0x9496A53E28ull),X(0x94A0E0B4E4ull),X(0x94AB1BCFF1ull),
-	X(0x94B5568F4Aull),X(0x94BF90F2E7ull),X(0x94C9CAFAC3ull),X(0x94D404A6D7ull),X(0x94DE3DF71Dull),X(0x94E876EB8Full),X(0x94F2AF8426ull),X(0x94FCE7C0DDull),
-	X(0x95071FA1ACull),X(0x951157268Dull),X(0x951B8E4F7Bull),X(0x9525C51C6Full),X(0x952FFB8D62ull),X(0x953A31A24Full),X(0x9544675B2Eull),X(0x954E9CB7FAull),
-	X(0x9558D1B8ACull),X(0x9563065D3Full),X(0x956D3AA5ABull),X(0x95776E91EBull),X(0x9581A221F8ull),X(0x958BD555CCull),X(0x9596082D61ull),X(0x95A03AA8AFull),
-	X(0x95AA6CC7B2ull),X(0x95B49E8A63ull),X(0x95BECFF0BBull),X(0x95C900FAB4ull),X(0x95D331A848ull),X(0x95DD61F971ull),X(0x95E791EE28ull),X(0x95F1C18667ull),
-	X(0x95FBF0C227ull),X(0x96061FA163ull),X(0x96104E2415ull),X(0x961A7C4A35ull),X(0x9624AA13BEull),X(0x962ED780A9ull),X(0x96390490F0ull),X(0x964331448Dull),
-	X(0x964D5D9B7Aull),X(0x96578995AFull),X(0x9661B53328ull),X(0x966BE073DEull),X(0x96760B57C9ull),X(0x968035DEE5ull),X(0x968A60092Bull),X(0x969489D694ull),
-	X(0x969EB3471Bull),X(0x96A8DC5AB9ull),X(0x96B3051167ull),X(0x96BD2D6B20ull),X(0x96C75567DEull),X(0x96D17D0799ull),X(0x96DBA44A4Cull),X(0x96E5CB2FF0ull),
-	X(0x96EFF1B880ull),X(0x96FA17E3F5ull),X(0x97043DB248ull),X(0x970E632374ull),X(0x9718883772ull),X(0x9722ACEE3Bull),X(0x972CD147CBull),X(0x9736F5441Aull),
-	X(0x974118E322ull),X(0x974B3C24DCull),X(0x97555F0944ull),X(0x975F819052ull),X(0x9769A3BA00ull),X(0x9773C58647ull),X(0x977DE6F523ull),X(0x978808068Cull),
-	X(0x979228BA7Cull),X(0x979C4910EDull),X(0x97A66909D8ull),X(0x97B088A538ull),X(0x97BAA7E306ull),X(0x97C4C6C33Cull),X(0x97CEE545D3ull),X(0x97D9036AC6ull),
-	X(0x97E321320Eull),X(0x97ED3E9BA5ull),X(0x97F75BA785ull),X(0x98017855A7ull),X(0x980B94A606ull),X(0x9815B0989Aull),X(0x981FCC2D5Eull),X(0x9829E7644Cull),
-	X(0x9834023D5Dull),X(0x983E1CB88Bull),X(0x984836D5D0ull),X(0x9852509525ull),X(0x985C69F685ull),X(0x986682F9E8ull),X(0x98709B9F4Aull),X(0x987AB3E6A3ull),
-	X(0x9884CBCFEEull),X(0x988EE35B24ull),X(0x9898FA883Full),X(0x98A3115739ull),X(0x98AD27C80Bull),X(0x98B73DDAB0ull),X(0x98C1538F20ull),X(0x98CB68E557ull),
-	X(0x98D57DDD4Dull),X(0x98DF9276FDull),X(0x98E9A6B260ull),X(0x98F3BA8F6Full),X(0x98FDCE0E26ull),X(0x9907E12E7Dull),X(0x9911F3F06Full),X(0x991C0653F4ull),
-	X(0x9926185908ull),X(0x993029FFA3ull),X(0x993A3B47C0ull),X(0x99444C3158ull),X(0x994E5CBC65ull),X(0x99586CE8E1ull),X(0x99627CB6C6ull),X(0x996C8C260Dull),
-	X(0x99769B36B0ull),X(0x9980A9E8AAull),X(0x998AB83BF3ull),X(0x9994C63086ull),X(0x999ED3C65Cull),X(0x99A8E0FD70ull),X(0x99B2EDD5BAull),X(0x99BCFA4F36ull),
-	X(0x99C70669DCull),X(0x99D11225A6ull),X(0x99DB1D828Full),X(0x99E5288090ull),X(0x99EF331FA3ull),X(0x99F93D5FC1ull),X(0x9A034740E5ull),X(0x9A0D50C308ull),
-	X(0x9A1759E624ull),X(0x9A2162AA33ull),X(0x9A2B6B0F2Full),X(0x9A35731511ull),X(0x9A3F7ABBD4ull),X(0x9A49820370ull),X(0x9A5388EBE1ull),X(0x9A5D8F751Full),
-	X(0x9A67959F26ull),X(0x9A719B69EDull),X(0x9A7BA0D570ull),X(0x9A85A5E1A7ull),X(0x9A8FAA8E8Eull),X(0x9A99AEDC1Dull),X(0x9AA3B2CA4Full),X(0x9AADB6591Dull),
-	X(0x9AB7B98881ull),X(0x9AC1BC5875ull),X(0x9ACBBEC8F3ull),X(0x9AD5C0D9F4ull),X(0x9ADFC28B73ull),X(0x9AE9C3DD69ull),X(0x9AF3C4CFD1ull),X(0x9AFDC562A3ull),
-	X(0x9B07C595DAull),X(0x9B11C56970ull),X(0x9B1BC4DD5Eull),X(0x9B25C3F19Eull),X(0x9B2FC2A62Aull),X(0x9B39C0FAFCull),X(0x9B43BEF00Full),X(0x9B4DBC855Aull),
-	X(0x9B57B9BAD9ull),X(0x9B61B69085ull),X(0x9B6BB30659ull),X(0x9B75AF1C4Dull),X(0x9B7FAAD25Cull),X(0x9B89A62880ull),X(0x9B93A11EB2ull),X(0x9B9D9BB4EDull),
-	X(0x9BA795EB2Aull),X(0x9BB18FC162ull),X(0x9BBB893791ull),X(0x9BC5824DAFull),X(0x9BCF7B03B7ull),X(0x9BD97359A2ull),X(0x9BE36B4F6Bull),X(0x9BED62E50Aull),
-	X(0x9BF75A1A7Bull),X(0x9C0150EFB6ull),X(0x9C0B4764B6ull),X(0x9C153D7975ull),X(0x9C1F332DECull),X(0x9C29288215ull),X(0x9C331D75EAull),X(0x9C3D120965ull),
-	X(0x9C47063C80ull),X(0x9C50FA0F34ull),X(0x9C5AED817Cull),X(0x9C64E09352ull),X(0x9C6ED344AFull),X(0x9C78C5958Cull),X(0x9C82B785E5ull),X(0x9C8CA915B3ull),
-	X(0x9C969A44EFull),X(0x9CA08B1394ull),X(0x9CAA7B819Bull),X(0x9CB46B8EFFull),X(0x9CBE5B3BB9ull),X(0x9CC84A87C2ull),X(0x9CD2397316ull),X(0x9CDC27FDAEull),
-	X(0x9CE6162783ull),X(0x9CF003F090ull),X(0x9CF9F158CEull),X(0x9D03DE6037ull),X(0x9D0DCB06C6ull),X(0x9D17B74C74ull),X(0x9D21A3313Aull),X(0x9D2B8EB513ull),
-	X(0x9D3579D7FAull),X(0x9D3F6499E6ull),X(0x9D494EFAD3ull),X(0x9D5338FABBull),X(0x9D5D229996ull),X(0x9D670BD760ull),X(0x9D70F4B412ull),X(0x9D7ADD2FA5ull),
-	X(0x9D84C54A15ull),X(0x9D8EAD035Aull),X(0x9D98945B6Eull),X(0x9DA27B524Cull),X(0x9DAC61E7EEull),X(0x9DB6481C4Cull),X(0x9DC02DEF62ull),X(0x9DCA136129ull),
-	X(0x9DD3F8719Aull),X(0x9DDDDD20B1ull),X(0x9DE7C16E66ull),X(0x9DF1A55AB3ull),X(0x9DFB88E593ull),X(0x9E056C0F00ull),X(0x9E0F4ED6F3ull),X(0x9E19313D66ull),
-	X(0x9E23134253ull),X(0x9E2CF4E5B4ull),X(0x9E36D62783ull),X(0x9E40B707BAull),X(0x9E4A978653ull),X(0x9E5477A347ull),X(0x9E5E575E91ull),X(0x9E6836B82Aull),
-	X(0x9E7215B00Dull),X(0x9E7BF44632ull),X(0x9E85D27A95ull),X(0x9E8FB04D30ull),X(0x9E998DBDFBull),X(0x9EA36ACCF1ull),X(0x9EAD477A0Cull),X(0x9EB723C545ull),
-	X(0x9EC0FFAE97ull),X(0x9ECADB35FCull),X(0x9ED4B65B6Eull),X(0x9EDE911EE6ull),X(0x9EE86B805Eull),X(0x9EF2457FD0ull),X(0x9EFC1F1D37ull),X(0x9F05F8588Cull),
-	X(0x9F0FD131C8ull),X(0x9F19A9A8E7ull),X(0x9F2381BDE2ull),X(0x9F2D5970B2ull),X(0x9F3730C152ull),X(0x9F4107AFBCull),X(0x9F4ADE3BEAull),X(0x9F54B465D5ull),
-	X(0x9F5E8A2D78ull),X(0x9F685F92CBull),X(0x9F723495CBull),X(0x9F7C09366Full),X(0x9F85DD74B3ull),X(0x9F8FB15090ull),X(0x9F9984CA00ull),X(0x9FA357E0FDull),
-	X(0x9FAD2A9581ull),X(0x9FB6FCE786ull),X(0x9FC0CED706ull),X(0x9FCAA063FBull),X(0x9FD4718E5Eull),X(0x9FDE42562Aull),X(0x9FE812BB59ull),X(0x9FF1E2BDE4ull),
-	X(0x9FFBB25DC6ull),X(0xA005819AF8ull),X(0xA00F507574ull),X(0xA0191EED35ull),X(0xA022ED0235ull),X(0xA02CBAB46Cull),X(0xA0368803D6ull),X(0xA04054F06Cull),
-	X(0xA04A217A28ull),X(0xA053EDA104ull),X(0xA05DB964FAull),X(0xA06784C605ull),X(0xA0714FC41Dull),X(0xA07B1A5F3Dull),X(0xA084E4975Full),X(0xA08EAE6C7Dull),
-	X(0xA09877DE90ull),X(0xA0A240ED94ull),X(0xA0AC099981ull),X(0xA0B5D1E251ull),X(0xA0BF99C800ull),X(0xA0C9614A86ull),X(0xA0D32869DEull),X(0xA0DCEF2601ull),
-	X(0xA0E6B57EEAull),X(0xA0F07B7492ull),X(0xA0FA4106F3ull),X(0xA104063609ull),X(0xA10DCB01CBull),X(0xA1178F6A35ull),X(0xA121536F40ull),X(0xA12B1710E7ull),
-	X(0xA134DA4F23ull),X(0xA13E9D29EEull),X(0xA1485FA143ull),X(0xA15221B51Bull),X(0xA15BE36570ull),X(0xA165A4B23Cull),X(0xA16F659B7Aull),X(0xA179262122ull),
-	X(0xA182E64330ull),X(0xA18CA6019Dull),X(0xA196655C63ull),X(0xA1A024537Cull),X(0xA1A9E2E6E3ull),X(0xA1B3A11690ull),X(0xA1BD5EE27Full),X(0xA1C71C4AA9ull),
-	X(0xA1D0D94F07ull),X(0xA1DA95EF95ull),X(0xA1E4522C4Cull),X(0xA1EE0E0526ull),X(0xA1F7C97A1Dull),X(0xA201848B2Bull),X(0xA20B3F384Aull),X(0xA214F98174ull),
-	X(0xA21EB366A3ull),X(0xA2286CE7D1ull),X(0xA2322604F9ull),X(0xA23BDEBE13ull),X(0xA24597131Aull),X(0xA24F4F0409ull),X(0xA2590690D8ull),X(0xA262BDB983ull),
-	X(0xA26C747E03ull),X(0xA2762ADE51ull),X(0xA27FE0DA69ull),X(0xA289967244ull),X(0xA2934BA5DCull),X(0xA29D00752Bull),X(0xA2A6B4E02Cull),X(0xA2B068E6D7ull),
-	X(0xA2BA1C8928ull),X(0xA2C3CFC717ull),X(0xA2CD82A0A0ull),X(0xA2D73515BDull),X(0xA2E0E72666ull),X(0xA2EA98D297ull),X(0xA2F44A1A49ull),X(0xA2FDFAFD76ull),
-	X(0xA307AB7C19ull),X(0xA3115B962Bull),X(0xA31B0B4BA6ull),X(0xA324BA9C85ull),X(0xA32E6988C1ull),X(0xA338181054ull),X(0xA341C63339ull),X(0xA34B73F16Aull),
-	X(0xA355214AE0ull),X(0xA35ECE3F95ull),X(0xA3687ACF85ull),X(0xA37226FAA8ull),X(0xA37BD2C0F8ull),X(0xA3857E2270ull),X(0xA38F291F0Aull),X(0xA398D3B6C0ull),
-	X(0xA3A27DE98Bull),X(0xA3AC27B766ull),X(0xA3B5D1204Cull),X(0xA3BF7A2435ull),X(0xA3C922C31Cull),X(0xA3D2CAFCFBull),X(0xA3DC72D1CCull),X(0xA3E61A4189ull),
-	X(0xA3EFC14C2Cull),X(0xA3F967F1B0ull),X(0xA4030E320Eull),X(0xA40CB40D40ull),X(0xA416598340ull),X(0xA41FFE9409ull),X(0xA429A33F94ull),X(0xA4334785DBull),
-	X(0xA43CEB66DAull),X(0xA4468EE288ull),X(0xA45031F8E2ull),X(0xA459D4A9E0ull),X(0xA46376F57Cull),X(0xA46D18DBB2ull),X(0xA476BA5C7Aull),X(0xA4805B77D0ull),
-	X(0xA489FC2DACull),X(0xA4939C7E09ull),X(0xA49D3C68E2ull),X(0xA4A6DBEE30ull),X(0xA4B07B0DECull),X(0xA4BA19C813ull),X(0xA4C3B81C9Cull),X(0xA4CD560B83ull),
-	X(0xA4D6F394C2ull),X(0xA4E090B852ull),X(0xA4EA2D762Dull),X(0xA4F3C9CE4Full),X(0xA4FD65C0B0ull),X(0xA507014D4Bull),X(0xA5109C741Aull),X(0xA51A373517ull),
-	X(0xA523D1903Cull),X(0xA52D6B8583ull),X(0xA5370514E6ull),X(0xA5409E3E60ull),X(0xA54A3701EAull),X(0xA553CF5F7Eull),X(0xA55D675717ull),X(0xA566FEE8AFull),
-	X(0xA570961440ull),X(0xA57A2CD9C3ull),X(0xA583C33933ull),X(0xA58D59328Aull),X(0xA596EEC5C2ull),X(0xA5A083F2D5ull),X(0xA5AA18B9BEull),X(0xA5B3AD1A75ull),
-	X(0xA5BD4114F7ull),X(0xA5C6D4A93Bull),X(0xA5D067D73Eull),X(0xA5D9FA9EF8ull),X(0xA5E38D0063ull),X(0xA5ED1EFB7Bull),X(0xA5F6B09039ull),X(0xA60041BE96ull),
-	X(0xA609D2868Eull),X(0xA61362E81Aull),X(0xA61CF2E335ull),X(0xA6268277D8ull),X(0xA63011A5FEull),X(0xA639A06DA0ull),X(0xA6432ECEB9ull),X(0xA64CBCC943ull),
-	X(0xA6564A5D38ull),X(0xA65FD78A92ull),X(0xA66964514Bull),X(0xA672F0B15Eull),X(0xA67C7CAAC4ull),X(0xA686083D77ull),X(0xA68F936972ull),X(0xA6991E2EAFull),
-	X(0xA6A2A88D28ull),X(0xA6AC3284D7ull),X(0xA6B5BC15B6ull),X(0xA6BF453FBFull),X(0xA6C8CE02ECull),X(0xA6D2565F38ull),X(0xA6DBDE549Dull),X(0xA6E565E314ull),
-	X(0xA6EEED0A98ull),X(0xA6F873CB23ull),X(0xA701FA24AFull),X(0xA70B801737ull),X(0xA71505A2B3ull),X(0xA71E8AC71Full),X(0xA7280F8475ull),X(0xA73193DAAEull),
-	X(0xA73B17C9C6ull),X(0xA7449B51B5ull),X(0xA74E1E7276ull),X(0xA757A12C04ull),X(0xA761237E57ull),X(0xA76AA5696Cull),X(0xA77426ED3Bull),X(0xA77DA809BEull),
-	X(0xA78728BEF1ull),X(0xA790A90CCDull),X(0xA79A28F34Cull),X(0xA7A3A87268ull),X(0xA7AD278A1Cull),X(0xA7B6A63A61ull),X(0xA7C0248332ull),X(0xA7C9A26489ull),
-	X(0xA7D31FDE60ull),X(0xA7DC9CF0B1ull),X(0xA7E6199B76ull),X(0xA7EF95DEAAull),X(0xA7F911BA47ull),X(0xA8028D2E46ull),X(0xA80C083AA3ull),X(0xA81582DF56ull),
-	X(0xA81EFD1C5Bull),X(0xA82876F1ABull),X(0xA831F05F40ull),X(0xA83B696515ull),X(0xA844E20324ull),X(0xA84E5A3968ull),X(0xA857D207D9ull),X(0xA861496E72ull),
-	X(0xA86AC06D2Full),X(0xA874370407ull),X(0xA87DAD32F7ull),X(0xA88722F9F7ull),X(0xA890985903ull),X(0xA89A0D5014ull),X(0xA8A381DF25ull),X(0xA8ACF6062Full),
-	X(0xA8B669C52Dull),X(0xA8BFDD1C19ull),X(0xA8C9500AEDull),X(0xA8D2C291A3ull),X(0xA8DC34B036ull),X(0xA8E5A6669Full),X(0xA8EF17B4DAull),X(0xA8F8889ADFull),
-	X(0xA901F918AAull),X(0xA90B692E34ull),X(0xA914D8DB77ull),X(0xA91E48206Full),X(0xA927B6FD14ull),X(0xA931257161ull),X(0xA93A937D51ull),X(0xA9440120DDull),
-	X(0xA94D6E5BFFull),X(0xA956DB2EB3ull),X(0xA9604798F1ull),X(0xA969B39AB5ull),X(0xA9731F33F8ull),X(0xA97C8A64B5ull),X(0xA985F52CE5ull),X(0xA98F5F8C84ull),
-	X(0xA998C9838Aull),X(0xA9A23311F3ull),X(0xA9AB9C37B8ull),X(0xA9B504F4D5ull),X(0xA9BE6D4942ull),X(0xA9C7D534FAull),X(0xA9D13CB7F7ull),X(0xA9DAA3D234ull),
-	X(0xA9E40A83ABull),X(0xA9ED70CC56ull),X(0xA9F6D6AC2Full),X(0xAA003C2330ull),X(0xAA09A13153ull),X(0xAA1305D694ull),X(0xAA1C6A12EBull),X(0xAA25CDE654ull),
-	X(0xAA2F3150C7ull),X(0xAA38945241ull),X(0xAA41F6EABAull),X(0xAA4B591A2Dull),X(0xAA54BAE095ull),X(0xAA5E1C3DEAull),X(0xAA677D3229ull),X(0xAA70DDBD4Aull),
-	X(0xAA7A3DDF48ull),X(0xAA839D981Eull),X(0xAA8CFCE7C5ull),X(0xAA965BCE38ull),X(0xAA9FBA4B70ull),X(0xAAA9185F69ull),X(0xAAB2760A1Cull),X(0xAABBD34B84ull),
-	X(0xAAC530239Bull),X(0xAACE8C925Aull),X(0xAAD7E897BDull),X(0xAAE14433BEull),X(0xAAEA9F6656ull),X(0xAAF3FA2F80ull),X(0xAAFD548F36ull),X(0xAB06AE8573ull),
-	X(0xAB10081230ull),X(0xAB19613569ull),X(0xAB22B9EF16ull),X(0xAB2C123F32ull),X(0xAB356A25B9ull),X(0xAB3EC1A2A3ull),X(0xAB4818B5EBull),X(0xAB516F5F8Bull),
-	X(0xAB5AC59F7Eull),X(0xAB641B75BEull),X(0xAB6D70E244ull),X(0xAB76C5E50Cull),X(0xAB801A7E10ull),X(0xAB896EAD49ull),X(0xAB92C272B2ull),X(0xAB9C15CE45ull),
-	X(0xABA568BFFDull),X(0xABAEBB47D4ull),X(0xABB80D65C4ull),X(0xABC15F19C6ull),X(0xABCAB063D7ull),X(0xABD40143EFull),X(0xABDD51BA09ull),X(0xABE6A1C61Full),
-	X(0xABEFF1682Cull),X(0xABF940A029ull),X(0xAC028F6E12ull),X(0xAC0BDDD1E0ull),X(0xAC152BCB8Dull),X(0xAC1E795B14ull),X(0xAC27C6806Full),X(0xAC31133B99ull),
-	X(0xAC3A5F8C8Bull),X(0xAC43AB7340ull),X(0xAC4CF6EFB2ull),X(0xAC564201DBull),X(0xAC5F8CA9B6ull),X(0xAC68D6E73Dull),X(0xAC7220BA6Aull),X(0xAC7B6A2337ull),
-	X(0xAC84B321A0ull),X(0xAC8DFBB59Dull),X(0xAC9743DF2Aull),X(0xACA08B9E40ull),X(0xACA9D2F2D9ull),X(0xACB319DCF1ull),X(0xACBC605C82ull),X(0xACC5A67185ull),
-	X(0xACCEEC1BF5ull),X(0xACD8315BCCull),X(0xACE1763104ull),X(0xACEABA9B99ull),X(0xACF3FE9B83ull),X(0xACFD4230BEull),X(0xAD06855B44ull),X(0xAD0FC81B0Eull),
-	X(0xAD190A7017ull),X(0xAD224C5A5Aull),X(0xAD2B8DD9D1ull),X(0xAD34CEEE76ull),X(0xAD3E0F9843ull),X(0xAD474FD733ull),X(0xAD508FAB40ull),X(0xAD59CF1464ull),
-	X(0xAD630E129Aull),X(0xAD6C4CA5DBull),X(0xAD758ACE23ull),X(0xAD7EC88B6Bull),X(0xAD8805DDADull),X(0xAD9142C4E5ull),X(0xAD9A7F410Cull),X(0xADA3BB521Dull),
-	X(0xADACF6F812ull),X(0xADB63232E4ull),X(0xADBF6D0290ull),X(0xADC8A7670Eull),X(0xADD1E1605Aull),X(0xADDB1AEE6Dull),X(0xADE4541141ull),X(0xADED8CC8D2ull),
-	X(0xADF6C51519ull),X(0xADFFFCF611ull),X(0xAE09346BB4ull),X(0xAE126B75FDull),X(0xAE1BA214E4ull),X(0xAE24D84866ull),X(0xAE2E0E107Dull),X(0xAE37436D21ull),
-	X(0xAE40785E4Full),X(0xAE49ACE400ull),X(0xAE52E0FE2Full),X(0xAE5C14ACD5ull),X(0xAE6547EFEEull),X(0xAE6E7AC773ull),X(0xAE77AD335Full),X(0xAE80DF33ADull),
-	X(0xAE8A10C856ull),X(0xAE9341F154ull),X(0xAE9C72AEA3ull),X(0xAEA5A3003Dull),X(0xAEAED2E61Bull),X(0xAEB8026038ull),X(0xAEC1316E8Full),X(0xAECA60111Aull),
-	X(0xAED38E47D3ull),X(0xAEDCBC12B5ull),X(0xAEE5E971B9ull),X(0xAEEF1664DBull),X(0xAEF842EC14ull),X(0xAF016F075Full),X(0xAF0A9AB6B6ull),X(0xAF13C5FA14ull),
-	X(0xAF1CF0D172ull),X(0xAF261B3CCCull),X(0xAF2F453C1Cull),X(0xAF386ECF5Bull),X(0xAF4197F685ull),X(0xAF4AC0B194ull),X(0xAF53E90081ull),X(0xAF5D10E348ull),
-	X(0xAF663859E2ull),X(0xAF6F5F644Bull),X(0xAF7886027Cull),X(0xAF81AC3470ull),X(0xAF8AD1FA20ull),X(0xAF93F75389ull),X(0xAF9D1C40A3ull),X(0xAFA640C169ull),
-	X(0xAFAF64D5D6ull),X(0xAFB8887DE4ull),X(0xAFC1ABB98Dull),X(0xAFCACE88CCull),X(0xAFD3F0EB9Bull),X(0xAFDD12E1F4ull),X(0xAFE6346BD1ull),X(0xAFEF55892Eull),
-	X(0xAFF8763A05ull),X(0xB001967E4Full),X(0xB00AB65608ull),X(0xB013D5C129ull),X(0xB01CF4BFADull),X(0xB02613518Eull),X(0xB02F3176C7ull),X(0xB0384F2F52ull),
-	X(0xB0416C7B2Aull),X(0xB04A895A48ull),X(0xB053A5CCA8ull),X(0xB05CC1D243ull),X(0xB065DD6B15ull),X(0xB06EF89716ull),X(0xB078135643ull),X(0xB0812DA894ull),
-	X(0xB08A478E05ull),X(0xB093610690ull),X(0xB09C7A122Full),X(0xB0A592B0DDull),X(0xB0AEAAE294ull),X(0xB0B7C2A74Eull),X(0xB0C0D9FF06ull),X(0xB0C9F0E9B7ull),
-	X(0xB0D307675Aull),X(0xB0DC1D77EAull),X(0xB0E5331B61ull),X(0xB0EE4851BBull),X(0xB0F75D1AF0ull),X(0xB1007176FCull),X(0xB1098565D9ull),X(0xB11298E782ull),
-	X(0xB11BABFBF0ull),X(0xB124BEA31Full),X(0xB12DD0DD08ull),X(0xB136E2A9A6ull),X(0xB13FF408F4ull),X(0xB14904FAEBull),X(0xB152157F87ull),X(0xB15B2596C1ull),
-	X(0xB164354094ull),X(0xB16D447CFBull),X(0xB176534BF0ull),X(0xB17F61AD6Dull),X(0xB1886FA16Dull),X(0xB1917D27EAull),X(0xB19A8A40DEull),X(0xB1A396EC44ull),
-	X(0xB1ACA32A17ull),X(0xB1B5AEFA50ull),X(0xB1BEBA5CEBull),X(0xB1C7C551E1ull),X(0xB1D0CFD92Eull),X(0xB1D9D9F2CBull),X(0xB1E2E39EB2ull),X(0xB1EBECDCDFull),
-	X(0xB1F4F5AD4Cull),X(0xB1FDFE0FF3ull),X(0xB2070604CFull),X(0xB2100D8BDAull),X(0xB21914A50Eull),X(0xB2221B5066ull),X(0xB22B218DDCull),X(0xB234275D6Bull),
-	X(0xB23D2CBF0Dull),X(0xB24631B2BDull),X(0xB24F363875ull),X(0xB2583A5030ull),X(0xB2613DF9E7ull),X(0xB26A413596ull),X(0xB273440337ull),X(0xB27C4662C3ull),
-	X(0xB285485437ull),X(0xB28E49D78Cull),X(0xB2974AECBCull),X(0xB2A04B93C3ull),X(0xB2A94BCC99ull),X(0xB2B24B973Bull),X(0xB2BB4AF3A2ull),X(0xB2C449E1CAull),
-	X(0xB2CD4861ABull),X(0xB2D6467341ull),X(0xB2DF441686ull),X(0xB2E8414B75ull),X(0xB2F13E1208ull),X(0xB2FA3A6A3Aull),X(0xB303365404ull),X(0xB30C31CF62ull),
-	X(0xB3152CDC4Eull),X(0xB31E277AC3ull),X(0xB32721AABAull),X(0xB3301B6C2Eull),X(0xB33914BF1Bull),X(0xB3420DA379ull),X(0xB34B061944ull),X(0xB353FE2077ull),
-	X(0xB35CF5B90Bull),X(0xB365ECE2FBull),X(0xB36EE39E42ull),X(0xB377D9EADAull),X(0xB380CFC8BDull),X(0xB389C537E6ull),X(0xB392BA3850ull),X(0xB39BAEC9F5ull),
-	X(0xB3A4A2ECCFull),X(0xB3AD96A0D9ull),X(0xB3B689E60Eull),X(0xB3BF7CBC67ull),X(0xB3C86F23E0ull),X(0xB3D1611C72ull),X(0xB3DA52A619ull),X(0xB3E343C0CEull),
-	X(0xB3EC346C8Dull),X(0xB3F524A950ull),X(0xB3FE147711ull),X(0xB40703D5CAull),X(0xB40FF2C577ull),X(0xB418E14611ull),X(0xB421CF5794ull),X(0xB42ABCF9F9ull),
-	X(0xB433AA2D3Cull),X(0xB43C96F156ull),X(0xB445834642ull),X(0xB44E6F2BFBull),X(0xB4575AA27Bull),X(0xB46045A9BDull),X(0xB4693041BBull),X(0xB4721A6A6Full),
-	X(0xB47B0423D5ull),X(0xB483ED6DE6ull),X(0xB48CD6489Eull),X(0xB495BEB3F6ull),X(0xB49EA6AFEAull),X(0xB4A78E3C73ull),X(0xB4B075598Cull),X(0xB4B95C0730ull),
-	X(0xB4C2424559ull),X(0xB4CB281402ull),X(0xB4D40D7325ull),X(0xB4DCF262BDull),X(0xB4E5D6E2C4ull),X(0xB4EEBAF335ull),X(0xB4F79E940Aull),X(0xB50081C53Eull),
-	X(0xB5096486CBull),X(0xB51246D8ACull),X(0xB51B28BADBull),X(0xB5240A2D53ull),X(0xB52CEB300Full),X(0xB535CBC309ull),X(0xB53EABE63Bull),X(0xB5478B99A0ull),
-	X(0xB5506ADD32ull),X(0xB55949B0EDull),X(0xB5622814CAull),X(0xB56B0608C4ull),X(0xB573E38CD6ull),X(0xB57CC0A0F9ull),X(0xB5859D452Aull),X(0xB58E797962ull),
-	X(0xB597553D9Bull),X(0xB5A03091D1ull),X(0xB5A90B75FEull),X(0xB5B1E5EA1Bull),X(0xB5BABFEE25ull),X(0xB5C3998216ull),X(0xB5CC72A5E7ull),X(0xB5D54B5993ull),
-	X(0xB5DE239D16ull),X(0xB5E6FB706Aull),X(0xB5EFD2D388ull),X(0xB5F8A9C66Cull),X(0xB601804911ull),X(0xB60A565B70ull),X(0xB6132BFD85ull),X(0xB61C012F49ull),
-	X(0xB624D5F0B8ull),X(0xB62DAA41CCull),X(0xB6367E227Full),X(0xB63F5192CDull),X(0xB6482492AFull),X(0xB650F72220ull),X(0xB659C9411Cull),X(0xB6629AEF9Bull),
-	X(0xB66B6C2D99ull),X(0xB6743CFB11ull),X(0xB67D0D57FDull),X(0xB685DD4458ull),X(0xB68EACC01Bull),X(0xB6977BCB42ull),X(0xB6A04A65C8ull),X(0xB6A9188FA6ull),
-	X(0xB6B1E648D8ull),X(0xB6BAB39158ull),X(0xB6C3806920ull),X(0xB6CC4CD02Bull),X(0xB6D518C674ull),X(0xB6DDE44BF6ull),X(0xB6E6AF60AAull),X(0xB6EF7A048Cull),
-	X(0xB6F8443795ull),X(0xB7010DF9C1ull),X(0xB709D74B0Bull),X(0xB712A02B6Cull),X(0xB71B689ADFull),X(0xB72430995Full),X(0xB72CF826E7ull),X(0xB735BF4371ull),
-	X(0xB73E85EEF7ull),X(0xB7474C2975ull),X(0xB75011F2E4ull),X(0xB758D74B40ull),X(0xB7619C3283ull),X(0xB76A60A8A8ull),X(0xB77324ADA8ull),X(0xB77BE84180ull),
-	X(0xB784AB6428ull),X(0xB78D6E159Dull),X(0xB7963055D8ull),X(0xB79EF224D5ull),X(0xB7A7B3828Dull),X(0xB7B0746EFCull),X(0xB7B934EA1Bull),X(0xB7C1F4F3E6ull),
-	X(0xB7CAB48C57ull),X(0xB7D373B369ull),X(0xB7DC326917ull),X(0xB7E4F0AD5Aull),X(0xB7EDAE802Eull),X(0xB7F66BE18Dull),X(0xB7FF28D172ull),X(0xB807E54FD7ull),
-	X(0xB810A15CB7ull),X(0xB8195CF80Dull),X(0xB8221821D3ull),X(0xB82AD2DA04ull),X(0xB8338D209Bull),X(0xB83C46F591ull),X(0xB8450058E3ull),X(0xB84DB94A89ull),
-	X(0xB85671CA80ull),X(0xB85F29D8C1ull),X(0xB867E17547ull),X(0xB87098A00Dull),X(0xB8794F590Eull),X(0xB88205A043ull),X(0xB88ABB75A9ull),X(0xB89370D938ull),
-	X(0xB89C25CAEDull),X(0xB8A4DA4AC1ull),X(0xB8AD8E58AFull),X(0xB8B641F4B2ull),X(0xB8BEF51EC4ull),X(0xB8C7A7D6E1ull),X(0xB8D05A1D02ull),X(0xB8D90BF123ull),
-	X(0xB8E1BD533Eull),X(0xB8EA6E434Dull),X(0xB8F31EC14Cull),X(0xB8FBCECD34ull),X(0xB9047E6701ull),X(0xB90D2D8EAEull),X(0xB915DC4434ull),X(0xB91E8A878Eull),
-	X(0xB9273858B8ull),X(0xB92FE5B7ACull),X(0xB93892A464ull),X(0xB9413F1EDBull),X(0xB949EB270Bull),X(0xB95296BCF1ull),X(0xB95B41E085ull),X(0xB963EC91C3ull),
-	X(0xB96C96D0A5ull),X(0xB975409D26ull),X(0xB97DE9F741ull),X(0xB98692DEF0ull),X(0xB98F3B542Eull),X(0xB997E356F6ull),X(0xB9A08AE742ull),X(0xB9A932050Cull),
-	X(0xB9B1D8B051ull),X(0xB9BA7EE90Aull),X(0xB9C324AF31ull),X(0xB9CBCA02C3ull),X(0xB9D46EE3B8ull),X(0xB9DD13520Dull),X(0xB9E5B74DBBull),X(0xB9EE5AD6BDull),
-	X(0xB9F6FDED0Eull),X(0xB9FFA090A9ull),X(0xBA0842C189ull),X(0xBA10E47FA7ull),X(0xBA1985CAFFull),X(0xBA2226A38Bull),X(0xBA2AC70946ull),X(0xBA3366FC2Bull),
-	X(0xBA3C067C34ull),X(0xBA44A5895Cull),X(0xBA4D44239Eull),X(0xBA55E24AF4ull),X(0xBA5E7FFF59ull),X(0xBA671D40C8ull),X(0xBA6FBA0F3Cull),X(0xBA78566AAFull),
-	X(0xBA80F2531Bull),X(0xBA898DC87Cull),X(0xBA9228CACDull),X(0xBA9AC35A07ull),X(0xBAA35D7625ull),X(0xBAABF71F23ull),X(0xBAB49054FBull),X(0xBABD2917A8ull),
-	X(0xBAC5C16724ull),X(0xBACE59436Aull),X(0xBAD6F0AC75ull),X(0xBADF87A240ull),X(0xBAE81E24C4ull),X(0xBAF0B433FEull),X(0xBAF949CFE7ull),X(0xBB01DEF87Aull),
-	X(0xBB0A73ADB2ull),X(0xBB1307EF8Aull),X(0xBB1B9BBDFDull),X(0xBB242F1904ull),X(0xBB2CC2009Bull),X(0xBB355474BDull),X(0xBB3DE67564ull),X(0xBB4678028Bull),
-	X(0xBB4F091C2Dull),X(0xBB5799C244ull),X(0xBB6029F4CBull),X(0xBB68B9B3BDull),X(0xBB7148FF15ull),X(0xBB79D7D6CDull),X(0xBB82663AE0ull),X(0xBB8AF42B48ull),
-	X(0xBB9381A801ull),X(0xBB9C0EB105ull),X(0xBBA49B464Full),X(0xBBAD2767DAull),X(0xBBB5B315A0ull),X(0xBBBE3E4F9Cull),X(0xBBC6C915C9ull),X(0xBBCF536821ull),
-	X(0xBBD7DD46A0ull),X(0xBBE066B13Full),X(0xBBE8EFA7FBull),X(0xBBF1782ACCull),X(0xBBFA0039AFull),X(0xBC0287D49Eull),X(0xBC0B0EFB94ull),X(0xBC1395AE8Bull),
-	X(0xBC1C1BED7Eull),X(0xBC24A1B868ull),X(0xBC2D270F43ull),X(0xBC35ABF20Bull),X(0xBC3E3060BBull),X(0xBC46B45B4Cull),X(0xBC4F37E1B9ull),X(0xBC57BAF3FEull),
-	X(0xBC603D9215ull),X(0xBC68BFBBF9ull),X(0xBC714171A5ull),X(0xBC79C2B313ull),X(0xBC8243803Eull),X(0xBC8AC3D921ull),X(0xBC9343BDB6ull),X(0xBC9BC32DF9ull),
-	X(0xBCA44229E4ull),X(0xBCACC0B172ull),X(0xBCB53EC49Eull),X(0xBCBDBC6362ull),X(0xBCC6398DBAull),X(0xBCCEB6439Full),X(0xBCD732850Dull),X(0xBCDFAE51FEull),
-	X(0xBCE829AA6Eull),X(0xBCF0A48E57ull),X(0xBCF91EFDB3ull),X(0xBD0198F87Eull),X(0xBD0A127EB3ull),X(0xBD128B904Bull),X(0xBD1B042D43ull),X(0xBD237C5594ull),
-	X(0xBD2BF40939ull),X(0xBD346B482Eull),X(0xBD3CE2126Dull),X(0xBD455867F0ull),X(0xBD4DCE48B3ull),X(0xBD5643B4B0ull),X(0xBD5EB8ABE3ull),X(0xBD672D2E45ull),
-	X(0xBD6FA13BD2ull),X(0xBD7814D484ull),X(0xBD8087F857ull),X(0xBD88FAA745ull),X(0xBD916CE148ull),X(0xBD99DEA65Cull),X(0xBDA24FF67Cull),X(0xBDAAC0D1A1ull),
-	X(0xBDB33137C8ull),X(0xBDBBA128EBull),X(0xBDC410A504ull),X(0xBDCC7FAC0Eull),X(0xBDD4EE3E05ull),X(0xBDDD5C5AE2ull),X(0xBDE5CA02A2ull),X(0xBDEE37353Eull),
-	X(0xBDF6A3F2B1ull),X(0xBDFF103AF6ull),X(0xBE077C0E09ull),X(0xBE0FE76BE3ull),X(0xBE18525480ull),X(0xBE20BCC7DAull),X(0xBE2926C5ECull),X(0xBE31904EB2ull),
-	X(0xBE39F96225ull),X(0xBE42620041ull),X(0xBE4ACA2900ull),X(0xBE5331DC5Eull),X(0xBE5B991A55ull),X(0xBE63FFE2DFull),X(0xBE6C6635F9ull),X(0xBE74CC139Cull),
-	X(0xBE7D317BC3ull),X(0xBE85966E69ull),X(0xBE8DFAEB8Aull),X(0xBE965EF31Full),X(0xBE9EC28524ull),X(0xBEA725A193ull),X(0xBEAF884868ull),X(0xBEB7EA799Dull),
-	X(0xBEC04C352Cull),X(0xBEC8AD7B12ull),X(0xBED10E4B48ull),X(0xBED96EA5CAull),X(0xBEE1CE8A91ull),X(0xBEEA2DF99Aull),X(0xBEF28CF2DFull),X(0xBEFAEB765Bull),
-	X(0xBF03498408ull),X(0xBF0BA71BE2ull),X(0xBF14043DE3ull),X(0xBF1C60EA06ull),X(0xBF24BD2047ull),X(0xBF2D18E09Full),X(0xBF35742B09ull),X(0xBF3DCEFF82ull),
-	X(0xBF46295E02ull),X(0xBF4E834686ull),X(0xBF56DCB908ull),X(0xBF5F35B583ull),X(0xBF678E3BF1ull),X(0xBF6FE64C4Eull),X(0xBF783DE695ull),X(0xBF80950AC0ull),
-	X(0xBF88EBB8CAull),X(0xBF9141F0AEull),X(0xBF9997B267ull),X(0xBFA1ECFDF0ull),X(0xBFAA41D343ull),X(0xBFB296325Cull),X(0xBFBAEA1B35ull),X(0xBFC33D8DC9ull),
-	X(0xBFCB908A14ull),X(0xBFD3E3100Full),X(0xBFDC351FB6ull),X(0xBFE486B904ull),X(0xBFECD7DBF3ull),X(0xBFF528887Full),X(0xBFFD78BEA2ull),X(0xC005C87E57ull),
-	X(0xC00E17C799ull),X(0xC016669A63ull),X(0xC01EB4F6B0ull),X(0xC02702DC7Aull),X(0xC02F504BBDull),X(0xC0379D4473ull),X(0xC03FE9C698ull),X(0xC04835D225ull),
-	X(0xC050816717ull),X(0xC058CC8568ull),X(0xC061172D12ull),X(0xC069615E11ull),X(0xC071AB1860ull),X(0xC079F45BF9ull),X(0xC0823D28D8ull),X(0xC08A857EF6ull),
-	X(0xC092CD5E50ull),X(0xC09B14C6E0ull),X(0xC0A35BB8A1ull),X(0xC0ABA2338Dull),X(0xC0B3E837A1ull),X(0xC0BC2DC4D6ull),X(0xC0C472DB27ull),X(0xC0CCB77A90ull),
-	X(0xC0D4FBA30Bull),X(0xC0DD3F5493ull),X(0xC0E5828F24ull),X(0xC0EDC552B7ull),X(0xC0F6079F48ull),X(0xC0FE4974D2ull),X(0xC1068AD350ull),X(0xC10ECBBABDull),
-	X(0xC1170C2B13ull),X(0xC11F4C244Dull),X(0xC1278BA667ull),X(0xC12FCAB15Bull),X(0xC138094524ull),X(0xC1404761BDull),X(0xC148850722ull),X(0xC150C2354Cull),
-	X(0xC158FEEC37ull),X(0xC1613B2BDEull),X(0xC16976F43Bull),X(0xC171B2454Bull),X(0xC179ED1F06ull),X(0xC182278169ull),X(0xC18A616C6Full),X(0xC1929AE012ull),
-	X(0xC19AD3DC4Dull),X(0xC1A30C611Bull),X(0xC1AB446E77ull),X(0xC1B37C045Dull),X(0xC1BBB322C6ull),X(0xC1C3E9C9AEull),X(0xC1CC1FF910ull),X(0xC1D455B0E7ull),
-	X(0xC1DC8AF12Dull),X(0xC1E4BFB9DEull),X(0xC1ECF40AF5ull),X(0xC1F527E46Cull),X(0xC1FD5B463Eull),X(0xC2058E3067ull),X(0xC20DC0A2E1ull),X(0xC215F29DA8ull),
-	X(0xC21E2420B5ull),X(0xC226552C05ull),X(0xC22E85BF92ull),X(0xC236B5DB57ull),X(0xC23EE57F4Full),X(0xC24714AB75ull),X(0xC24F435FC4ull),X(0xC257719C36ull),
-	X(0xC25F9F60C8ull),X(0xC267CCAD73ull),X(0xC26FF98233ull),X(0xC27825DF03ull),X(0xC28051C3DDull),X(0xC2887D30BDull),X(0xC290A8259Dull),X(0xC298D2A279ull),
-	X(0xC2A0FCA74Cull),X(0xC2A9263410ull),X(0xC2B14F48C0ull),X(0xC2B977E558ull),X(0xC2C1A009D1ull),X(0xC2C9C7B629ull),X(0xC2D1EEEA58ull),X(0xC2DA15A65Bull),
-	X(0xC2E23BEA2Cull),X(0xC2EA61B5C7ull),X(0xC2F2870925ull),X(0xC2FAABE443ull),X(0xC302D0471Aull),X(0xC30AF431A7ull),X(0xC31317A3E4ull),X(0xC31B3A9DCCull),
-	X(0xC3235D1F5Aull),X(0xC32B7F2889ull),X(0xC333A0B954ull),X(0xC33BC1D1B6ull),X(0xC343E271AAull),X(0xC34C02992Aull),X(0xC354224833ull),X(0xC35C417EBFull),
-	X(0xC364603CC9ull),X(0xC36C7E824Bull),X(0xC3749C4F42ull),X(0xC37CB9A3A7ull),X(0xC384D67F77ull),X(0xC38CF2E2ABull),X(0xC3950ECD3Full),X(0xC39D2A3F2Eull),
-	X(0xC3A5453873ull),X(0xC3AD5FB909ull),X(0xC3B579C0EBull),X(0xC3BD935013ull),X(0xC3C5AC667Eull),X(0xC3CDC50425ull),X(0xC3D5DD2904ull),X(0xC3DDF4D516ull),
-	X(0xC3E60C0856ull),X(0xC3EE22C2BFull),X(0xC3F639044Cull),X(0xC3FE4ECCF8ull),X(0xC406641CBEull),X(0xC40E78F399ull),X(0xC4168D5184ull),X(0xC41EA1367Aull),
-	X(0xC426B4A276ull),X(0xC42EC79573ull),X(0xC436DA0F6Cull),X(0xC43EEC105Cull),X(0xC446FD983Eull),X(0xC44F0EA70Dull),X(0xC4571F3CC5ull),X(0xC45F2F595Full),
-	X(0xC4673EFCD8ull),X(0xC46F4E272Aull),X(0xC4775CD851ull),X(0xC47F6B1046ull),X(0xC48778CF06ull),X(0xC48F86148Cull),X(0xC49792E0D1ull),X(0xC49F9F33D3ull),
-	X(0xC4A7AB0D8Aull),X(0xC4AFB66DF3ull),X(0xC4B7C15509ull),X(0xC4BFCBC2C6ull),X(0xC4C7D5B726ull),X(0xC4CFDF3223ull),X(0xC4D7E833B9ull),X(0xC4DFF0BBE3ull),
-	X(0xC4E7F8CA9Cull),X(0xC4F0005FDFull),X(0xC4F8077BA6ull),X(0xC5000E1DEDull),X(0xC5081446AFull),X(0xC51019F5E8ull),X(0xC5181F2B91ull),X(0xC52023E7A7ull),
-	X(0xC528282A23ull),X(0xC5302BF302ull),X(0xC5382F423Eull),X(0xC5403217D3ull),X(0xC5483473BBull),X(0xC5503655F1ull),X(0xC55837BE71ull),X(0xC56038AD36ull),
-	X(0xC56839223Aull),X(0xC570391D79ull),X(0xC578389EEEull),X(0xC58037A693ull),X(0xC588363465ull),X(0xC59034485Dull),X(0xC59831E278ull),X(0xC5A02F02AFull),
-	X(0xC5A82BA8FFull),X(0xC5B027D562ull),X(0xC5B82387D4ull),X(0xC5C01EC04Full),X(0xC5C8197ECEull),X(0xC5D013C34Dull),X(0xC5D80D8DC7ull),X(0xC5E006DE36ull),
-	X(0xC5E7FFB496ull),X(0xC5EFF810E2ull),X(0xC5F7EFF315ull),X(0xC5FFE75B2Aull),X(0xC607DE491Dull),X(0xC60FD4BCE7ull),X(0xC617CAB685ull),X(0xC61FC035F1ull),
-	X(0xC627B53B27ull),X(0xC62FA9C621ull),X(0xC6379DD6DBull),X(0xC63F916D50ull),X(0xC64784897Bull),X(0xC64F772B56ull),X(0xC6576952DEull),X(0xC65F5B000Dull),
-	X(0xC6674C32DEull),X(0xC66F3CEB4Dull),X(0xC6772D2954ull),X(0xC67F1CECEFull),X(0xC6870C3618ull),X(0xC68EFB04CBull),X(0xC696E95903ull),X(0xC69ED732BBull),
-	X(0xC6A6C491EEull),X(0xC6AEB17697ull),X(0xC6B69DE0B2ull),X(0xC6BE89D039ull),X(0xC6C6754528ull),X(0xC6CE603F79ull),X(0xC6D64ABF28ull),X(0xC6DE34C430ull),
-	X(0xC6E61E4E8Dull),X(0xC6EE075E38ull),X(0xC6F5EFF32Dull),X(0xC6FDD80D68ull),X(0xC705BFACE3ull),X(0xC70DA6D19Aull),X(0xC7158D7B88ull),X(0xC71D73AAA8ull),
-	X(0xC725595EF5ull),X(0xC72D3E9869ull),X(0xC735235701ull),X(0xC73D079AB8ull),X(0xC744EB6388ull),X(0xC74CCEB16Dull),X(0xC754B18461ull),X(0xC75C93DC61ull),
-	X(0xC76475B966ull),X(0xC76C571B6Dull),X(0xC774380270ull),X(0xC77C186E6Aull),X(0xC783F85F58ull),X(0xC78BD7D533ull),X(0xC793B6CFF6ull),X(0xC79B954F9Eull),
-	X(0xC7A3735425ull),X(0xC7AB50DD87ull),X(0xC7B32DEBBEull),X(0xC7BB0A7EC6ull),X(0xC7C2E69699ull),X(0xC7CAC23333ull),X(0xC7D29D5490ull),X(0xC7DA77FAAAull),
-	X(0xC7E252257Cull),X(0xC7EA2BD502ull),X(0xC7F2050936ull),X(0xC7F9DDC215ull),X(0xC801B5FF98ull),X(0xC8098DC1BCull),X(0xC81165087Bull),X(0xC8193BD3D0ull),
-	X(0xC8211223B8ull),X(0xC828E7F82Cull),X(0xC830BD5128ull),X(0xC838922EA7ull),X(0xC8406690A5ull),X(0xC8483A771Cull),X(0xC8500DE208ull),X(0xC857E0D164ull),
-	X(0xC85FB3452Bull),X(0xC867853D58ull),X(0xC86F56B9E7ull),X(0xC87727BAD2ull),X(0xC87EF84015ull),X(0xC886C849ABull),X(0xC88E97D78Full),X(0xC89666E9BCull),
-	X(0xC89E35802Eull),X(0xC8A6039ADFull),X(0xC8ADD139CCull),X(0xC8B59E5CEEull),X(0xC8BD6B0442ull),X(0xC8C5372FC2ull),X(0xC8CD02DF69ull),X(0xC8D4CE1334ull),
-	X(0xC8DC98CB1Cull),X(0xC8E463071Eull),X(0xC8EC2CC734ull),X(0xC8F3F60B59ull),X(0xC8FBBED38Aull),X(0xC903871FC0ull),X(0xC90B4EEFF8ull),X(0xC91316442Cull),
-	X(0xC91ADD1C57ull),X(0xC922A37875ull),X(0xC92A695882ull),X(0xC9322EBC77ull),X(0xC939F3A451ull),X(0xC941B8100Aull),X(0xC9497BFF9Full),X(0xC9513F7309ull),
-	X(0xC959026A44ull),X(0xC960C4E54Cull),X(0xC96886E41Cull),X(0xC9704866AEull),X(0xC978096CFFull),X(0xC97FC9F709ull),X(0xC9878A04C7ull),X(0xC98F499636ull),
-	X(0xC99708AB4Full),X(0xC99EC7440Eull),X(0xC9A685606Full),X(0xC9AE43006Cull),X(0xC9B6002401ull),X(0xC9BDBCCB2Aull),X(0xC9C578F5E0ull),X(0xC9CD34A420ull),
-	X(0xC9D4EFD5E5ull),X(0xC9DCAA8B2Aull),X(0xC9E464C3EBull),X(0xC9EC1E8021ull),X(0xC9F3D7BFC9ull),X(0xC9FB9082DFull),X(0xCA0348C95Cull),X(0xCA0B00933Dull),
-	X(0xCA12B7E07Dull),X(0xCA1A6EB116ull),X(0xCA22250505ull),X(0xCA29DADC44ull),X(0xCA319036CEull),X(0xCA3945149Full),X(0xCA40F975B3ull),X(0xCA48AD5A04ull),
-	X(0xCA5060C18Dull),X(0xCA5813AC4Bull),X(0xCA5FC61A37ull),X(0xCA67780B4Eull),X(0xCA6F297F8Aull),X(0xCA76DA76E8ull),X(0xCA7E8AF161ull),X(0xCA863AEEF2ull),
-	X(0xCA8DEA6F95ull),X(0xCA95997347ull),X(0xCA9D47FA01ull),X(0xCAA4F603C0ull),X(0xCAACA3907Full),X(0xCAB450A038ull),X(0xCABBFD32E8ull),X(0xCAC3A94889ull),
-	X(0xCACB54E117ull),X(0xCAD2FFFC8Dull),X(0xCADAAA9AE6ull),X(0xCAE254BC1Eull),X(0xCAE9FE6030ull),X(0xCAF1A78717ull),X(0xCAF95030CEull),X(0xCB00F85D51ull),
-	X(0xCB08A00C9Aull),X(0xCB10473EA6ull),X(0xCB17EDF370ull),X(0xCB1F942AF2ull),X(0xCB2739E528ull),X(0xCB2EDF220Eull),X(0xCB3683E19Eull),X(0xCB3E2823D4ull),
-	X(0xCB45CBE8ABull),X(0xCB4D6F301Full),X(0xCB5511FA2Aull),X(0xCB5CB446C9ull),X(0xCB645615F5ull),X(0xCB6BF767ACull),X(0xCB73983BE7ull),X(0xCB7B3892A3ull),
-	X(0xCB82D86BDAull),X(0xCB8A77C788ull),X(0xCB9216A5A8ull),X(0xCB99B50636ull),X(0xCBA152E92Cull),X(0xCBA8F04E86ull),X(0xCBB08D3640ull),X(0xCBB829A054ull),
-	X(0xCBBFC58CBEull),X(0xCBC760FB79ull),X(0xCBCEFBEC81ull),X(0xCBD6965FD0ull),X(0xCBDE305563ull),X(0xCBE5C9CD35ull),X(0xCBED62C740ull),X(0xCBF4FB4380ull),
-	X(0xCBFC9341F0ull),X(0xCC042AC28Dull),X(0xCC0BC1C550ull),X(0xCC13584A36ull),X(0xCC1AEE5139ull),X(0xCC2283DA56ull),X(0xCC2A18E586ull),X(0xCC31AD72C7ull),
-	X(0xCC39418212ull),X(0xCC40D51364ull),X(0xCC486826B7ull),X(0xCC4FFABC07ull),X(0xCC578CD34Full),X(0xCC5F1E6C8Bull),X(0xCC66AF87B6ull),X(0xCC6E4024CCull),
-	X(0xCC75D043C7ull),X(0xCC7D5FE4A2ull),X(0xCC84EF075Aull),X(0xCC8C7DABEAull),X(0xCC940BD24Dull),X(0xCC9B997A7Eull),X(0xCCA326A478ull),X(0xCCAAB35038ull),
-	X(0xCCB23F7DB8ull),X(0xCCB9CB2CF3ull),X(0xCCC1565DE6ull),X(0xCCC8E1108Aull),X(0xCCD06B44DDull),X(0xCCD7F4FAD9ull),X(0xCCDF7E3279ull),X(0xCCE706EBB8ull),
-	X(0xCCEE8F2693ull),X(0xCCF616E305ull),X(0xCCFD9E2108ull),X(0xCD0524E098ull),X(0xCD0CAB21B1ull),X(0xCD1430E44Dull),X(0xCD1BB62869ull),X(0xCD233AEE00ull),
-	X(0xCD2ABF350Cull),X(0xCD3242FD8Aull),X(0xCD39C64775ull),X(0xCD414912C7ull),X(0xCD48CB5F7Dull),X(0xCD504D2D92ull),X(0xCD57CE7D01ull),X(0xCD5F4F4DC6ull),
-	X(0xCD66CF9FDBull),X(0xCD6E4F733Dull),X(0xCD75CEC7E6ull),X(0xCD7D4D9DD3ull),X(0xCD84CBF4FDull),X(0xCD8C49CD62ull),X(0xCD93C726FCull),X(0xCD9B4401C6ull),
-	X(0xCDA2C05DBCull),X(0xCDAA3C3ADAull),X(0xCDB1B7991Aull),X(0xCDB9327878ull),X(0xCDC0ACD8F0ull),X(0xCDC826BA7Cull),X(0xCDCFA01D19ull),X(0xCDD71900C1ull),
-	X(0xCDDE916571ull),X(0xCDE6094B23ull),X(0xCDED80B1D2ull),X(0xCDF4F7997Bull),X(0xCDFC6E0219ull),X(0xCE03E3EBA6ull),X(0xCE0B59561Full),X(0xCE12CE417Eull),
-	X(0xCE1A42ADC0ull),X(0xCE21B69ADFull),X(0xCE292A08D8ull),X(0xCE309CF7A4ull),X(0xCE380F6741ull),X(0xCE3F8157A9ull),X(0xCE46F2C8D7ull),X(0xCE4E63BAC7ull),
-	X(0xCE55D42D75ull),X(0xCE5D4420DCull),X(0xCE64B394F7ull),X(0xCE6C2289C1ull),X(0xCE7390FF37ull),X(0xCE7AFEF553ull),X(0xCE826C6C11ull),X(0xCE89D9636Cull),
-	X(0xCE9145DB60ull),X(0xCE98B1D3E9ull),X(0xCEA01D4D01ull),X(0xCEA78846A3ull),X(0xCEAEF2C0CDull),X(0xCEB65CBB78ull),X(0xCEBDC636A1ull),X(0xCEC52F3242ull),
-	X(0xCECC97AE57ull),X(0xCED3FFAADCull),X(0xCEDB6727CCull),X(0xCEE2CE2522ull),X(0xCEEA34A2DBull),X(0xCEF19AA0F0ull),X(0xCEF9001F5Full),X(0xCF00651E21ull),
-	X(0xCF07C99D33ull),X(0xCF0F2D9C91ull),X(0xCF16911C34ull),X(0xCF1DF41C1Aull),X(0xCF25569C3Dull),X(0xCF2CB89C99ull),X(0xCF341A1D29ull),X(0xCF3B7B1DE9ull),
-	X(0xCF42DB9ED4ull),X(0xCF4A3B9FE6ull),X(0xCF519B211Aull),X(0xCF58FA226Bull),X(0xCF6058A3D6ull),X(0xCF67B6A554ull),X(0xCF6F1426E3ull),X(0xCF7671287Dull),
-	X(0xCF7DCDAA1Eull),X(0xCF8529ABC1ull),X(0xCF8C852D62ull),X(0xCF93E02EFCull),X(0xCF9B3AB08Bull),X(0xCFA294B209ull),X(0xCFA9EE3374ull),X(0xCFB14734C5ull),
-	X(0xCFB89FB5F9ull),X(0xCFBFF7B70Bull),X(0xCFC74F37F6ull),X(0xCFCEA638B7ull),X(0xCFD5FCB948ull),X(0xCFDD52B9A4ull),X(0xCFE4A839C8ull),X(0xCFEBFD39AFull),
-	X(0xCFF351B954ull),X(0xCFFAA5B8B3ull),X(0xD001F937C7ull),X(0xD0094C368Cull),X(0xD0109EB4FDull),X(0xD017F0B315ull),X(0xD01F4230D1ull),X(0xD026932E2Cull),
-	X(0xD02DE3AB21ull),X(0xD03533A7ABull),X(0xD03C8323C7ull),X(0xD043D21F6Full),X(0xD04B209A9Full),X(0xD0526E9553ull),X(0xD059BC0F86ull),X(0xD061090934ull),
-	X(0xD068558258ull),X(0xD06FA17AEDull),X(0xD076ECF2EFull),X(0xD07E37EA5Aull),X(0xD08582612Aull),X(0xD08CCC5758ull),X(0xD09415CCE2ull),X(0xD09B5EC1C3ull),
-	X(0xD0A2A735F5ull),X(0xD0A9EF2975ull),X(0xD0B1369C3Full),X(0xD0B87D8E4Dull),X(0xD0BFC3FF9Bull),X(0xD0C709F025ull),X(0xD0CE4F5FE6ull),X(0xD0D5944ED9ull),
-	X(0xD0DCD8BCFBull),X(0xD0E41CAA47ull),X(0xD0EB6016B8ull),X(0xD0F2A30249ull),X(0xD0F9E56CF7ull),X(0xD1012756BDull),X(0xD10868BF96ull),X(0xD10FA9A77Eull),
-	X(0xD116EA0E70ull),X(0xD11E29F468ull),X(0xD125695962ull),X(0xD12CA83D58ull),X(0xD133E6A048ull),X(0xD13B24822Bull),X(0xD14261E2FDull),X(0xD1499EC2BBull),
-	X(0xD150DB215Full),X(0xD15816FEE6ull),X(0xD15F525B4Aull),X(0xD1668D3688ull),X(0xD16DC7909Aull),X(0xD17501697Dull),X(0xD17C3AC12Bull),X(0xD1837397A1ull),
-	X(0xD18AABECDAull),X(0xD191E3C0D1ull),X(0xD1991B1383ull),X(0xD1A051E4EAull),X(0xD1A7883502ull),X(0xD1AEBE03C7ull),X(0xD1B5F35134ull),X(0xD1BD281D45ull),
-	X(0xD1C45C67F5ull),X(0xD1CB903140ull),X(0xD1D2C37922ull),X(0xD1D9F63F96ull),X(0xD1E1288497ull),X(0xD1E85A4822ull),X(0xD1EF8B8A31ull),X(0xD1F6BC4AC0ull),
-	X(0xD1FDEC89CBull),X(0xD2051C474Eull),X(0xD20C4B8344ull),X(0xD2137A3DA8ull),X(0xD21AA87676ull),X(0xD221D62DAAull),X(0xD229036340ull),X(0xD230301732ull),
-	X(0xD2375C497Cull),X(0xD23E87FA1Bull),X(0xD245B32909ull),X(0xD24CDDD642ull),X(0xD2540801C2ull),X(0xD25B31AB84ull),X(0xD2625AD384ull),X(0xD2698379BEull),
-	X(0xD270AB9E2Cull),X(0xD277D340CCull),X(0xD27EFA6197ull),X(0xD28621008Aull),X(0xD28D471DA1ull),X(0xD2946CB8D7ull),X(0xD29B91D227ull),X(0xD2A2B6698Dull),
-	X(0xD2A9DA7F05ull),X(0xD2B0FE128Bull),X(0xD2B8212419ull),X(0xD2BF43B3ACull),X(0xD2C665C13Full),X(0xD2CD874CCEull),X(0xD2D4A85654ull),X(0xD2DBC8DDCDull),
-	X(0xD2E2E8E335ull),X(0xD2EA086687ull),X(0xD2F12767BFull),X(0xD2F845E6D8ull),X(0xD2FF63E3CEull),X(0xD306815E9Cull),X(0xD30D9E573Full),X(0xD314BACDB1ull),
-	X(0xD31BD6C1F0ull),X(0xD322F233F5ull),X(0xD32A0D23BCull),X(0xD331279142ull),X(0xD338417C82ull),X(0xD33F5AE578ull),X(0xD34673CC1Eull),X(0xD34D8C3071ull),
-	X(0xD354A4126Dull),X(0xD35BBB720Dull),X(0xD362D24F4Cull),X(0xD369E8AA27ull),X(0xD370FE8298ull),X(0xD37813D89Cull),X(0xD37F28AC2Eull),X(0xD3863CFD4Aull),
-	X(0xD38D50CBECull),X(0xD39464180Eull),X(0xD39B76E1ADull),X(0xD3A28928C4ull),X(0xD3A99AED50ull),X(0xD3B0AC2F4Bull),X(0xD3B7BCEEB1ull),X(0xD3BECD2B7Eull),
-	X(0xD3C5DCE5ADull),X(0xD3CCEC1D3Bull),X(0xD3D3FAD223ull),X(0xD3DB09045Full),X(0xD3E216B3EEull),X(0xD3E923E0C8ull),X(0xD3F0308AECull),X(0xD3F73CB253ull),
-	X(0xD3FE4856FAull),X(0xD4055378DCull),X(0xD40C5E17F6ull),X(0xD413683442ull),X(0xD41A71CDBCull),X(0xD4217AE460ull),X(0xD42883782Aull),X(0xD42F8B8916ull),
-	X(0xD43693171Eull),X(0xD43D9A223Full),X(0xD444A0AA74ull),X(0xD44BA6AFB9ull),X(0xD452AC320Aull),X(0xD459B13162ull),X(0xD460B5ADBEull),X(0xD467B9A717ull),
-	X(0xD46EBD1D6Bull),X(0xD475C010B5ull),X(0xD47CC280F1ull),X(0xD483C46E1Aull),X(0xD48AC5D82Cull),X(0xD491C6BF23ull),X(0xD498C722FAull),X(0xD49FC703AEull),
-	X(0xD4A6C66139ull),X(0xD4ADC53B97ull),X(0xD4B4C392C5ull),X(0xD4BBC166BDull),X(0xD4C2BEB77Cull),X(0xD4C9BB84FDull),X(0xD4D0B7CF3Cull),X(0xD4D7B39634ull),
-	X(0xD4DEAED9E2ull),X(0xD4E5A99A40ull),X(0xD4ECA3D74Cull),X(0xD4F39D90FFull),X(0xD4FA96C757ull),X(0xD5018F7A4Eull),X(0xD50887A9E1ull),X(0xD50F7F560Bull),
-	X(0xD516767EC7ull),X(0xD51D6D2413ull),X(0xD5246345E8ull),X(0xD52B58E443ull),X(0xD5324DFF21ull),X(0xD53942967Bull),X(0xD54036AA4Eull),X(0xD5472A3A97ull),
-	X(0xD54E1D474Full),X(0xD5550FD074ull),X(0xD55C01D601ull),X(0xD562F357F2ull),X(0xD569E45642ull),X(0xD570D4D0EDull),X(0xD577C4C7EEull),X(0xD57EB43B43ull),
-	X(0xD585A32AE5ull),X(0xD58C9196D1ull),X(0xD5937F7F03ull),X(0xD59A6CE377ull),X(0xD5A159C428ull),X(0xD5A8462111ull),X(0xD5AF31FA2Full),X(0xD5B61D4F7Eull),
-	X(0xD5BD0820F8ull),X(0xD5C3F26E9Aull),X(0xD5CADC3860ull),X(0xD5D1C57E45ull),X(0xD5D8AE4045ull),X(0xD5DF967E5Cull),X(0xD5E67E3885ull),X(0xD5ED656EBCull),
-	X(0xD5F44C20FEull),X(0xD5FB324F45ull),X(0xD60217F98Dull),X(0xD608FD1FD3ull),X(0xD60FE1C211ull),X(0xD616C5E045ull),X(0xD61DA97A68ull),X(0xD6248C9078ull),
-	X(0xD62B6F2270ull),X(0xD63251304Bull),X(0xD63932BA06ull),X(0xD64013BF9Cull),X(0xD646F4410Aull),X(0xD64DD43E49ull),X(0xD654B3B758ull),X(0xD65B92AC30ull),
-	X(0xD662711CCEull),X(0xD6694F092Full),X(0xD6702C714Cull),X(0xD677095523ull),X(0xD67DE5B4AFull),X(0xD684C18FECull),X(0xD68B9CE6D6ull),X(0xD69277B967ull),
-	X(0xD69952079Dull),X(0xD6A02BD173ull),X(0xD6A70516E5ull),X(0xD6ADDDD7EEull),X(0xD6B4B6148Aull),X(0xD6BB8DCCB5ull),X(0xD6C265006Bull),X(0xD6C93BAFA7ull),
-	X(0xD6D011DA66ull),X(0xD6D6E780A3ull),X(0xD6DDBCA25Aull),X(0xD6E4913F87ull),X(0xD6EB655825ull),X(0xD6F238EC30ull),X(0xD6F90BFBA5ull),X(0xD6FFDE867Eull),
-	X(0xD706B08CB8ull),X(0xD70D820E4Eull),X(0xD714530B3Dull),X(0xD71B23837Full),X(0xD721F37712ull),X(0xD728C2E5F0ull),X(0xD72F91D015ull),X(0xD73660357Eull),
-	X(0xD73D2E1625ull),X(0xD743FB7208ull),X(0xD74AC84921ull),X(0xD751949B6Cull),X(0xD7586068E6ull),X(0xD75F2BB18Aull),X(0xD765F67554ull),X(0xD76CC0B43Full),
-	X(0xD7738A6E48ull),X(0xD77A53A36Aull),X(0xD7811C53A1ull),X(0xD787E47EE9ull),X(0xD78EAC253Eull),X(0xD79573469Cull),X(0xD79C39E2FEull),X(0xD7A2FFFA60ull),
-	X(0xD7A9C58CBEull),X(0xD7B08A9A13ull),X(0xD7B74F225Dull),X(0xD7BE132596ull),X(0xD7C4D6A3BAull),X(0xD7CB999CC6ull),X(0xD7D25C10B4ull),X(0xD7D91DFF81ull),
-	X(0xD7DFDF6929ull),X(0xD7E6A04DA8ull),X(0xD7ED60ACF8ull),X(0xD7F4208717ull),X(0xD7FADFDC00ull),X(0xD8019EABAEull),X(0xD8085CF61Eull),X(0xD80F1ABB4Cull),
-	X(0xD815D7FB33ull),X(0xD81C94B5CFull),X(0xD82350EB1Cull),X(0xD82A0C9B16ull),X(0xD830C7C5B9ull),X(0xD837826B01ull),X(0xD83E3C8AE8ull),X(0xD844F6256Cull),
-	X(0xD84BAF3A88ull),X(0xD85267CA38ull),X(0xD8591FD478ull),X(0xD85FD75944ull),X(0xD8668E5897ull),X(0xD86D44D26Dull),X(0xD873FAC6C3ull),X(0xD87AB03594ull),
-	X(0xD881651EDCull),X(0xD888198296ull),X(0xD88ECD60C0ull),X(0xD89580B953ull),X(0xD89C338C4Eull),X(0xD8A2E5D9AAull),X(0xD8A997A165ull),X(0xD8B048E37Aull),
-	X(0xD8B6F99FE4ull),X(0xD8BDA9D6A1ull),X(0xD8C45987ABull),X(0xD8CB08B2FFull),X(0xD8D1B75898ull),X(0xD8D8657872ull),X(0xD8DF131289ull),X(0xD8E5C026DAull),
-	X(0xD8EC6CB55Full),X(0xD8F318BE16ull),X(0xD8F9C440F9ull),X(0xD9006F3E04ull),X(0xD90719B534ull),X(0xD90DC3A685ull),X(0xD9146D11F1ull),X(0xD91B15F776ull),
-	X(0xD921BE570Full),X(0xD9286630B7ull),X(0xD92F0D846Cull),X(0xD935B45228ull),X(0xD93C5A99E8ull),X(0xD943005BA7ull),X(0xD949A59762ull),X(0xD9504A4D14ull),
-	X(0xD956EE7CB9ull),X(0xD95D92264Eull),X(0xD9643549CDull),X(0xD96AD7E733ull),X(0xD97179FE7Cull),X(0xD9781B8FA4ull),X(0xD97EBC9AA7ull),X(0xD9855D1F80ull),
-	X(0xD98BFD1E2Bull),X(0xD9929C96A5ull),X(0xD9993B88E9ull),X(0xD99FD9F4F4ull),X(0xD9A677DAC0ull),X(0xD9AD153A4Bull),X(0xD9B3B2138Full),X(0xD9BA4E668Aull),
-	X(0xD9C0EA3336ull),X(0xD9C7857990ull),X(0xD9CE203994ull),X(0xD9D4BA733Dull),X(0xD9DB542688ull),X(0xD9E1ED5370ull),X(0xD9E885F9F1ull),X(0xD9EF1E1A08ull),
-	X(0xD9F5B5B3B0ull),X(0xD9FC4CC6E5ull),X(0xDA02E353A4ull),X(0xDA097959E7ull),X(0xDA100ED9ABull),X(0xDA16A3D2EDull),X(0xDA1D3845A7ull),X(0xDA23CC31D6ull),
-	X(0xDA2A5F9775ull),X(0xDA30F27682ull),X(0xDA3784CEF7ull),X(0xDA3E16A0D0ull),X(0xDA44A7EC0Aull),X(0xDA4B38B0A1ull),X(0xDA51C8EE90ull),X(0xDA5858A5D3ull),
-	X(0xDA5EE7D667ull),X(0xDA65768047ull),X(0xDA6C04A36Full),X(0xDA72923FDBull),X(0xDA791F5588ull),X(0xDA7FABE470ull),X(0xDA8637EC91ull),X(0xDA8CC36DE6ull),
-	X(0xDA934E686Aull),X(0xDA99D8DC1Bull),X(0xDAA062C8F4ull),X(0xDAA6EC2EF0ull),X(0xDAAD750E0Cull),X(0xDAB3FD6645ull),X(0xDABA853794ull),X(0xDAC10C81F8ull),
-	X(0xDAC793456Cull),X(0xDACE1981EBull),X(0xDAD49F3771ull),X(0xDADB2465FCull),X(0xDAE1A90D86ull),X(0xDAE82D2E0Cull),X(0xDAEEB0C789ull),X(0xDAF533D9FAull),
-	X(0xDAFBB6655Bull),X(0xDB023869A7ull),X(0xDB08B9E6DAull),X(0xDB0F3ADCF1ull),X(0xDB15BB4BE8ull),X(0xDB1C3B33BAull),X(0xDB22BA9464ull),X(0xDB29396DE1ull),
-	X(0xDB2FB7C02Dull),X(0xDB36358B45ull),X(0xDB3CB2CF25ull),X(0xDB432F8BC8ull),X(0xDB49ABC12Aull),X(0xDB50276F48ull),X(0xDB56A2961Eull),X(0xDB5D1D35A6ull),
-	X(0xDB63974DDFull),X(0xDB6A10DEC2ull),X(0xDB7089E84Eull),X(0xDB77026A7Cull),X(0xDB7D7A654Bull),X(0xDB83F1D8B4ull),X(0xDB8A68C4B6ull),X(0xDB90DF294Aull),
-	X(0xDB9755066Full),X(0xDB9DCA5C1Full),X(0xDBA43F2A56ull),X(0xDBAAB37111ull),X(0xDBB127304Cull),X(0xDBB79A6802ull),X(0xDBBE0D1830ull),X(0xDBC47F40D2ull),
-	X(0xDBCAF0E1E3ull),X(0xDBD161FB60ull),X(0xDBD7D28D45ull),X(0xDBDE42978Dull),X(0xDBE4B21A36ull),X(0xDBEB21153Aull),X(0xDBF18F8896ull),X(0xDBF7FD7446ull),
-	X(0xDBFE6AD846ull),X(0xDC04D7B492ull),X(0xDC0B440926ull),X(0xDC11AFD5FDull),X(0xDC181B1B15ull),X(0xDC1E85D86Aull),X(0xDC24F00DF6ull),X(0xDC2B59BBB6ull),
-	X(0xDC31C2E1A7ull),X(0xDC382B7FC4ull),X(0xDC3E939609ull),X(0xDC44FB2473ull),X(0xDC4B622AFDull),X(0xDC51C8A9A4ull),X(0xDC582EA063ull),X(0xDC5E940F37ull),
-	X(0xDC64F8F61Cull),X(0xDC6B5D550Dull),X(0xDC71C12C07ull),X(0xDC78247B06ull),X(0xDC7E874205ull),X(0xDC84E98102ull),X(0xDC8B4B37F8ull),X(0xDC91AC66E2ull),
-	X(0xDC980D0DBEull),X(0xDC9E6D2C87ull),X(0xDCA4CCC339ull),X(0xDCAB2BD1D1ull),X(0xDCB18A584Aull),X(0xDCB7E856A1ull),X(0xDCBE45CCD1ull),X(0xDCC4A2BAD6ull),
-	X(0xDCCAFF20AEull),X(0xDCD15AFE53ull),X(0xDCD7B653C2ull),X(0xDCDE1120F7ull),X(0xDCE46B65EEull),X(0xDCEAC522A3ull),X(0xDCF11E5712ull),X(0xDCF7770338ull),
-	X(0xDCFDCF270Full),X(0xDD0426C296ull),X(0xDD0A7DD5C6ull),X(0xDD10D4609Eull),X(0xDD172A6318ull),X(0xDD1D7FDD31ull),X(0xDD23D4CEE5ull),X(0xDD2A29382Full),
-	X(0xDD307D190Dull),X(0xDD36D0717Aull),X(0xDD3D234172ull),X(0xDD437588F2ull),X(0xDD49C747F5ull),X(0xDD50187E78ull),X(0xDD56692C76ull),X(0xDD5CB951ECull),
-	X(0xDD6308EED6ull),X(0xDD69580330ull),X(0xDD6FA68EF6ull),X(0xDD75F49224ull),X(0xDD7C420CB7ull),X(0xDD828EFEAAull),X(0xDD88DB67F9ull),X(0xDD8F2748A1ull),
-	X(0xDD9572A09Eull),X(0xDD9BBD6FECull),X(0xDDA207B687ull),X(0xDDA851746Bull),X(0xDDAE9AA995ull),X(0xDDB4E355FFull),X(0xDDBB2B79A7ull),X(0xDDC1731489ull),
-	X(0xDDC7BA26A1ull),X(0xDDCE00AFEAull),X(0xDDD446B061ull),X(0xDDDA8C2803ull),X(0xDDE0D116CBull),X(0xDDE7157CB5ull),X(0xDDED5959BEull),X(0xDDF39CADE1ull),
-	X(0xDDF9DF791Bull),X(0xDE0021BB68ull),X(0xDE066374C5ull),X(0xDE0CA4A52Cull),X(0xDE12E54C9Bull),X(0xDE19256B0Dull),X(0xDE1F65007Full),X(0xDE25A40CEDull),
-	X(0xDE2BE29053ull),X(0xDE32208AADull),X(0xDE385DFBF7ull),X(0xDE3E9AE42Dull),X(0xDE44D7434Cull),X(0xDE4B131950ull),X(0xDE514E6635ull),X(0xDE578929F6ull),
-	X(0xDE5DC36491ull),X(0xDE63FD1601ull),X(0xDE6A363E43ull),X(0xDE706EDD52ull),X(0xDE76A6F32Bull),X(0xDE7CDE7FCAull),X(0xDE8315832Bull),X(0xDE894BFD4Aull),
-	X(0xDE8F81EE24ull),X(0xDE95B755B5ull),X(0xDE9BEC33F8ull),X(0xDEA22088EBull),X(0xDEA8545488ull),X(0xDEAE8796CDull),X(0xDEB4BA4FB5ull),X(0xDEBAEC7F3Dull),
-	X(0xDEC11E2561ull),X(0xDEC74F421Dull),X(0xDECD7FD56Dull),X(0xDED3AFDF4Eull),X(0xDED9DF5FBBull),X(0xDEE00E56B1ull),X(0xDEE63CC42Cull),X(0xDEEC6AA828ull),
-	X(0xDEF29802A1ull),X(0xDEF8C4D394ull),X(0xDEFEF11AFDull),X(0xDF051CD8D7ull),X(0xDF0B480D20ull),X(0xDF1172B7D3ull),X(0xDF179CD8ECull),X(0xDF1DC67068ull),
-	X(0xDF23EF7E43ull),X(0xDF2A180279ull),X(0xDF303FFD07ull),X(0xDF36676DE7ull),X(0xDF3C8E5518ull),X(0xDF42B4B294ull),X(0xDF48DA8659ull),X(0xDF4EFFD062ull),
-	X(0xDF552490ABull),X(0xDF5B48C731ull),X(0xDF616C73F0ull),X(0xDF678F96E4ull),X(0xDF6DB2300Aull),X(0xDF73D43F5Dull),X(0xDF79F5C4DAull),X(0xDF8016C07Dull),
-	X(0xDF86373242ull),X(0xDF8C571A26ull),X(0xDF92767824ull),X(0xDF98954C39ull),X(0xDF9EB39661ull),X(0xDFA4D15699ull),X(0xDFAAEE8CDCull),X(0xDFB10B3928ull),
-	X(0xDFB7275B77ull),X(0xDFBD42F3C6ull),X(0xDFC35E0212ull),X(0xDFC9788657ull),X(0xDFCF928090ull),X(0xDFD5ABF0BBull),X(0xDFDBC4D6D4ull),X(0xDFE1DD32D6ull),
-	X(0xDFE7F504BEull),X(0xDFEE0C4C88ull),X(0xDFF4230A30ull),X(0xDFFA393DB3ull),X(0xE0004EE70Dull),X(0xE00664063Bull),X(0xE00C789B37ull),X(0xE0128CA5FFull),
-	X(0xE018A02690ull),X(0xE01EB31CE4ull),X(0xE024C588F9ull),X(0xE02AD76ACAull),X(0xE030E8C254ull),X(0xE036F98F94ull),X(0xE03D09D284ull),X(0xE043198B23ull),
-	X(0xE04928B96Bull),X(0xE04F375D5Aull),X(0xE0554576EBull),X(0xE05B53061Bull),X(0xE061600AE6ull),X(0xE0676C8548ull),X(0xE06D78753Eull),X(0xE07383DAC4ull),
-	X(0xE0798EB5D5ull),X(0xE07F99066Full),X(0xE085A2CC8Eull),X(0xE08BAC082Dull),X(0xE091B4B94Aull),X(0xE097BCDFE0ull),X(0xE09DC47BECull),X(0xE0A3CB8D6Aull),
-	X(0xE0A9D21456ull),X(0xE0AFD810ADull),X(0xE0B5DD826Bull),X(0xE0BBE2698Bull),X(0xE0C1E6C60Cull),X(0xE0C7EA97E8ull),X(0xE0CDEDDF1Cull),X(0xE0D3F09BA4ull),
-	X(0xE0D9F2CD7Dull),X(0xE0DFF474A3ull),X(0xE0E5F59112ull),X(0xE0EBF622C6ull),X(0xE0F1F629BCull),X(0xE0F7F5A5F1ull),X(0xE0FDF49760ull),X(0xE103F2FE05ull),
-	X(0xE109F0D9DDull),X(0xE10FEE2AE5ull),X(0xE115EAF118ull),X(0xE11BE72C74ull),X(0xE121E2DCF3ull),X(0xE127DE0293ull),X(0xE12DD89D50ull),X(0xE133D2AD26ull),
-	X(0xE139CC3211ull),X(0xE13FC52C0Eull),X(0xE145BD9B19ull),X(0xE14BB57F2Full),X(0xE151ACD84Cull),X(0xE157A3A66Bull),X(0xE15D99E98Aull),X(0xE1638FA1A4ull),
-	X(0xE16984CEB7ull),X(0xE16F7970BDull),X(0xE1756D87B5ull),X(0xE17B611399ull),X(0xE181541467ull),X(0xE187468A1Bull),X(0xE18D3874B0ull),X(0xE19329D424ull),
-	X(0xE1991AA872ull),X(0xE19F0AF197ull),X(0xE1A4FAAF90ull),X(0xE1AAE9E258ull),X(0xE1B0D889EDull),X(0xE1B6C6A649ull),X(0xE1BCB4376Bull),X(0xE1C2A13D4Dull),
-	X(0xE1C88DB7EDull),X(0xE1CE79A746ull),X(0xE1D4650B56ull),X(0xE1DA4FE418ull),X(0xE1E03A3188ull),X(0xE1E623F3A4ull),X(0xE1EC0D2A67ull),X(0xE1F1F5D5CEull),
-	X(0xE1F7DDF5D5ull),X(0xE1FDC58A79ull),X(0xE203AC93B6ull),X(0xE209931188ull),X(0xE20F7903EBull),X(0xE2155E6ADDull),X(0xE21B434658ull),X(0xE22127965Bull),
-	X(0xE2270B5AE0ull),X(0xE22CEE93E5ull),X(0xE232D14166ull),X(0xE238B3635Full),X(0xE23E94F9CCull),X(0xE2447604ABull),X(0xE24A5683F6ull),X(0xE2503677ACull),
-	X(0xE25615DFC7ull),X(0xE25BF4BC45ull),X(0xE261D30D21ull),X(0xE267B0D259ull),X(0xE26D8E0BE8ull),X(0xE2736AB9CBull),X(0xE27946DBFFull),X(0xE27F22727Full),
-	X(0xE284FD7D48ull),X(0xE28AD7FC57ull),X(0xE290B1EFA8ull),X(0xE2968B5737ull),X(0xE29C643300ull),X(0xE2A23C8301ull),X(0xE2A8144735ull),X(0xE2ADEB7F98ull),
-	X(0xE2B3C22C28ull),X(0xE2B9984CE1ull),X(0xE2BF6DE1BFull),X(0xE2C542EABEull),X(0xE2CB1767DBull),X(0xE2D0EB5912ull),X(0xE2D6BEBE60ull),X(0xE2DC9197C1ull),
-	X(0xE2E263E531ull),X(0xE2E835A6ADull),X(0xE2EE06DC32ull),X(0xE2F3D785BBull),X(0xE2F9A7A345ull),X(0xE2FF7734CDull),X(0xE305463A4Full),X(0xE30B14B3C7ull),
-	X(0xE310E2A131ull),X(0xE316B0028Bull),X(0xE31C7CD7D1ull),X(0xE3224920FFull),X(0xE32814DE11ull),X(0xE32DE00F03ull),X(0xE333AAB3D4ull),X(0xE33974CC7Eull),
-	X(0xE33F3E58FEull),X(0xE345075950ull),X(0xE34ACFCD72ull),X(0xE35097B55Full),X(0xE3565F1114ull),X(0xE35C25E08Eull),X(0xE361EC23C8ull),X(0xE367B1DABFull),
-	X(0xE36D770570ull),X(0xE3733BA3D7ull),X(0xE378FFB5F0ull),X(0xE37EC33BB9ull),X(0xE38486352Dull),X(0xE38A48A248ull),X(0xE3900A8309ull),X(0xE395CBD769ull),
-	X(0xE39B8C9F67ull),X(0xE3A14CDAFFull),X(0xE3A70C8A2Dull),X(0xE3ACCBACEDull),X(0xE3B28A433Cull),X(0xE3B8484D17ull),X(0xE3BE05CA79ull),X(0xE3C3C2BB61ull),
-	X(0xE3C97F1FC8ull),X(0xE3CF3AF7AEull),X(0xE3D4F6430Dull),X(0xE3DAB101E2ull),X(0xE3E06B342Aull),X(0xE3E624D9E1ull),X(0xE3EBDDF303ull),X(0xE3F1967F8Eull),
-	X(0xE3F74E7F7Dull),X(0xE3FD05F2CEull),X(0xE402BCD97Cull),X(0xE408733384ull),X(0xE40E2900E2ull),X(0xE413DE4193ull),X(0xE41992F594ull),X(0xE41F471CE1ull),
-	X(0xE424FAB776ull),X(0xE42AADC550ull),X(0xE43060466Bull),X(0xE436123AC4ull),X(0xE43BC3A258ull),X(0xE441747D22ull),X(0xE44724CB1Full),X(0xE44CD48C4Dull),
-	X(0xE45283C0A7ull),X(0xE458326829ull),X(0xE45DE082D1ull),X(0xE4638E109Aull),X(0xE4693B1182ull),X(0xE46EE78585ull),X(0xE474936C9Eull),X(0xE47A3EC6CCull),
-	X(0xE47FE9940Aull),X(0xE48593D455ull),X(0xE48B3D87A8ull),X(0xE490E6AE02ull),X(0xE4968F475Eull),X(0xE49C3753B9ull),X(0xE4A1DED30Full),X(0xE4A785C55Dull),
-	X(0xE4AD2C2AA0ull),X(0xE4B2D202D3ull),X(0xE4B8774DF3ull),X(0xE4BE1C0BFEull),X(0xE4C3C03CEFull),X(0xE4C963E0C3ull),X(0xE4CF06F776ull),X(0xE4D4A98105ull),
-	X(0xE4DA4B7D6Dull),X(0xE4DFECECAAull),X(0xE4E58DCEB8ull),X(0xE4EB2E2394ull),X(0xE4F0CDEB3Bull),X(0xE4F66D25AAull),X(0xE4FC0BD2DCull),X(0xE501A9F2CEull),
-	X(0xE50747857Cull),X(0xE50CE48AE5ull),X(0xE512810302ull),X(0xE5181CEDD3ull),X(0xE51DB84B52ull),X(0xE523531B7Cull),X(0xE528ED5E4Full),X(0xE52E8713C6ull),
-	X(0xE534203BDEull),X(0xE539B8D694ull),X(0xE53F50E3E4ull),X(0xE544E863CBull),X(0xE54A7F5645ull),X(0xE55015BB4Eull),X(0xE555AB92E4ull),X(0xE55B40DD03ull),
-	X(0xE560D599A8ull),X(0xE56669C8CFull),X(0xE56BFD6A74ull),X(0xE571907E94ull),X(0xE57723052Cull),X(0xE57CB4FE38ull),X(0xE5824669B5ull),X(0xE587D747A0ull),
-	X(0xE58D6797F5ull),X(0xE592F75AB0ull),X(0xE598868FCEull),X(0xE59E15374Cull),X(0xE5A3A35126ull),X(0xE5A930DD59ull),X(0xE5AEBDDBE1ull),X(0xE5B44A4CBBull),
-	X(0xE5B9D62FE4ull),X(0xE5BF618558ull),X(0xE5C4EC4D14ull),X(0xE5CA768714ull),X(0xE5D0003355ull),X(0xE5D58951D4ull),X(0xE5DB11E28Cull),X(0xE5E099E57Bull),
-	X(0xE5E6215A9Dull),X(0xE5EBA841EFull),X(0xE5F12E9B6Eull),X(0xE5F6B46716ull),X(0xE5FC39A4E3ull),X(0xE601BE54D2ull),X(0xE6074276E0ull),X(0xE60CC60B09ull),
-	X(0xE61249114Bull),X(0xE617CB89A1ull),X(0xE61D4D7408ull),X(0xE622CED07Dull),X(0xE6284F9EFCull),X(0xE62DCFDF83ull),X(0xE6334F920Dull),X(0xE638CEB697ull),
-	X(0xE63E4D4D1Eull),X(0xE643CB559Eull),X(0xE64948D015ull),X(0xE64EC5BC7Eull),X(0xE654421AD6ull),X(0xE659BDEB1Aull),X(0xE65F392D47ull),X(0xE664B3E159ull),
-	X(0xE66A2E074Cull),X(0xE66FA79F1Eull),X(0xE67520A8CBull),X(0xE67A992450ull),X(0xE6801111A8ull),X(0xE6858870D2ull),X(0xE68AFF41C9ull),X(0xE69075848Aull),
-	X(0xE695EB3912ull),X(0xE69B605F5Dull),X(0xE6A0D4F769ull),X(0xE6A6490131ull),X(0xE6ABBC7CB2ull),X(0xE6B12F69E9ull),X(0xE6B6A1C8D3ull),X(0xE6BC13996Cull),
-	X(0xE6C184DBB1ull),X(0xE6C6F58F9Eull),X(0xE6CC65B530ull),X(0xE6D1D54C65ull),X(0xE6D7445537ull),X(0xE6DCB2CFA5ull),X(0xE6E220BBAAull),X(0xE6E78E1944ull),
-	X(0xE6ECFAE86Full),X(0xE6F2672927ull),X(0xE6F7D2DB6Aull),X(0xE6FD3DFF34ull),X(0xE702A89481ull),X(0xE708129B4Full),X(0xE70D7C139Aull),X(0xE712E4FD5Eull),
-	X(0xE7184D5898ull),X(0xE71DB52546ull),X(0xE7231C6363ull),X(0xE7288312ECull),X(0xE72DE933DFull),X(0xE7334EC637ull),X(0xE738B3C9F1ull),X(0xE73E183F0Aull),
-	X(0xE7437C257Full),X(0xE748DF7D4Dull),X(0xE74E42466Full),X(0xE753A480E3ull),X(0xE759062CA5ull),X(0xE75E6749B2ull),X(0xE763C7D807ull),X(0xE76927D7A0ull),
-	X(0xE76E87487Bull),X(0xE773E62A93ull),X(0xE779447DE6ull),X(0xE77EA2426Full),X(0xE783FF782Dull),X(0xE7895C1F1Bull),X(0xE78EB83737ull),X(0xE79413C07Cull),
-	X(0xE7996EBAE8ull),X(0xE79EC92677ull),X(0xE7A4230326ull),X(0xE7A97C50F2ull),X(0xE7AED50FD7ull),X(0xE7B42D3FD2ull),X(0xE7B984E0E0ull),X(0xE7BEDBF2FEull),
-	X(0xE7C4327628ull),X(0xE7C9886A5Bull),X(0xE7CEDDCF93ull),X(0xE7D432A5CEull),X(0xE7D986ED08ull),X(0xE7DEDAA53Dull),X(0xE7E42DCE6Bull),X(0xE7E980688Eull),
-	X(0xE7EED273A3ull),X(0xE7F423EFA7ull),X(0xE7F974DC96ull),X(0xE7FEC53A6Dull),X(0xE804150929ull),X(0xE8096448C7ull),X(0xE80EB2F942ull),X(0xE814011A99ull),
-	X(0xE8194EACC7ull),X(0xE81E9BAFCAull),X(0xE823E8239Eull),X(0xE829340840ull),X(0xE82E7F5DACull),X(0xE833CA23E0ull),X(0xE839145AD8ull),X(0xE83E5E0290ull),
-	X(0xE843A71B06ull),X(0xE848EFA437ull),X(0xE84E379E1Eull),X(0xE8537F08BAull),X(0xE858C5E406ull),X(0xE85E0C2FFFull),X(0xE86351ECA2ull),X(0xE8689719ECull),
-	X(0xE86DDBB7D9ull),X(0xE8731FC667ull),X(0xE878634591ull),X(0xE87DA63556ull),X(0xE882E895B1ull),X(0xE8882A669Full),X(0xE88D6BA81Dull),X(0xE892AC5A28ull),
-	X(0xE897EC7CBDull),X(0xE89D2C0FD8ull),X(0xE8A26B1376ull),X(0xE8A7A98794ull),X(0xE8ACE76C2Eull),X(0xE8B224C142ull),X(0xE8B76186CCull),X(0xE8BC9DBCC9ull),
-	X(0xE8C1D96335ull),X(0xE8C7147A0Eull),X(0xE8CC4F0150ull),X(0xE8D188F8F9ull),X(0xE8D6C26104ull),X(0xE8DBFB396Eull),X(0xE8E1338235ull),X(0xE8E66B3B55ull),
-	X(0xE8EBA264CBull),X(0xE8F0D8FE94ull),X(0xE8F60F08ACull),X(0xE8FB448310ull),X(0xE900796DBDull),X(0xE905ADC8B0ull),X(0xE90AE193E6ull),X(0xE91014CF5Bull),
-	X(0xE915477B0Dull),X(0xE91A7996F7ull),X(0xE91FAB2317ull),X(0xE924DC1F6Aull),X(0xE92A0C8BECull),X(0xE92F3C689Aull),X(0xE9346BB571ull),X(0xE9399A726Eull),
-	X(0xE93EC89F8Eull),X(0xE943F63CCDull),X(0xE949234A28ull),X(0xE94E4FC79Cull),X(0xE9537BB526ull),X(0xE958A712C3ull),X(0xE95DD1E06Full),X(0xE962FC1E27ull),
-	X(0xE96825CBE9ull),X(0xE96D4EE9B0ull),X(0xE97277777Aull),X(0xE9779F7543ull),X(0xE97CC6E309ull),X(0xE981EDC0C8ull),X(0xE987140E7Dull),X(0xE98C39CC24ull),
-	X(0xE9915EF9BBull),X(0xE99683973Full),X(0xE99BA7A4ACull),X(0xE9A0CB21FFull),X(0xE9A5EE0F35ull),X(0xE9AB106C4Bull),X(0xE9B032393Dull),X(0xE9B5537609ull),
-	X(0xE9BA7422ABull),X(0xE9BF943F20ull),X(0xE9C4B3CB65ull),X(0xE9C9D2C777ull),X(0xE9CEF13353ull),X(0xE9D40F0EF4ull),X(0xE9D92C5A5Aull),X(0xE9DE49157Full),
-	X(0xE9E3654061ull),X(0xE9E880DAFEull),X(0xE9ED9BE551ull),X(0xE9F2B65F57ull),X(0xE9F7D0490Eull),X(0xE9FCE9A272ull),X(0xEA02026B80ull),X(0xEA071AA436ull),
-	X(0xEA0C324C8Full),X(0xEA11496488ull),X(0xEA165FEC1Full),X(0xEA1B75E351ull),X(0xEA208B4A1Aull),X(0xEA25A02077ull),X(0xEA2AB46665ull),X(0xEA2FC81BE1ull),
-	X(0xEA34DB40E8ull),X(0xEA39EDD576ull),X(0xEA3EFFD988ull),X(0xEA44114D1Cull),X(0xEA4922302Full),X(0xEA4E3282BCull),X(0xEA534244C1ull),X(0xEA5851763Bull),
-	X(0xEA5D601727ull),X(0xEA626E2782ull),X(0xEA677BA747ull),X(0xEA6C889676ull),X(0xEA7194F509ull),X(0xEA76A0C2FFull),X(0xEA7BAC0054ull),X(0xEA80B6AD04ull),
-	X(0xEA85C0C90Eull),X(0xEA8ACA546Dull),X(0xEA8FD34F1Full),X(0xEA94DBB920ull),X(0xEA99E3926Dull),X(0xEA9EEADB04ull),X(0xEAA3F192E1ull),X(0xEAA8F7BA01ull),
-	X(0xEAADFD5061ull),X(0xEAB30255FEull),X(0xEAB806CAD5ull),X(0xEABD0AAEE2ull),X(0xEAC20E0223ull),X(0xEAC710C495ull),X(0xEACC12F634ull),X(0xEAD11496FDull),
-	X(0xEAD615A6EDull),X(0xEADB162602ull),X(0xEAE0161438ull),X(0xEAE515718Bull),X(0xEAEA143DFAull),X(0xEAEF127980ull),X(0xEAF410241Bull),X(0xEAF90D3DC8ull),
-	X(0xEAFE09C683ull),X(0xEB0305BE4Aull),X(0xEB08012519ull),X(0xEB0CFBFAEEull),X(0xEB11F63FC4ull),X(0xEB16EFF39Aull),X(0xEB1BE9166Dull),X(0xEB20E1A838ull),
-	X(0xEB25D9A8F9ull),X(0xEB2AD118ADull),X(0xEB2FC7F751ull),X(0xEB34BE44E2ull),X(0xEB39B4015Dull),X(0xEB3EA92CBEull),X(0xEB439DC703ull),X(0xEB4891D029ull),
-	X(0xEB4D85482Cull),X(0xEB52782F09ull),X(0xEB576A84BEull),X(0xEB5C5C4948ull),X(0xEB614D7CA2ull),X(0xEB663E1ECBull),X(0xEB6B2E2FBFull),X(0xEB701DAF7Bull),
-	X(0xEB750C9DFDull),X(0xEB79FAFB40ull),X(0xEB7EE8C743ull),X(0xEB83D60201ull),X(0xEB88C2AB79ull),X(0xEB8DAEC3A6ull),X(0xEB929A4A87ull),X(0xEB97854017ull),
-	X(0xEB9C6FA454ull),X(0xEBA159773Bull),X(0xEBA642B8C8ull),X(0xEBAB2B68F9ull),X(0xEBB01387CBull),X(0xEBB4FB153Bull),X(0xEBB9E21145ull),X(0xEBBEC87BE7ull),
-	X(0xEBC3AE551Eull),X(0xEBC8939CE6ull),X(0xEBCD78533Dull),X(0xEBD25C781Full),X(0xEBD7400B8Aull),X(0xEBDC230D7Aull),X(0xEBE1057DEDull),X(0xEBE5E75CDFull),
-	X(0xEBEAC8AA4Eull),X(0xEBEFA96636ull),X(0xEBF4899094ull),X(0xEBF9692966ull),X(0xEBFE4830A9ull),X(0xEC0326A659ull),X(0xEC08048A73ull),X(0xEC0CE1DCF5ull),
-	X(0xEC11BE9DDBull),X(0xEC169ACD23ull),X(0xEC1B766AC9ull),X(0xEC205176CBull),X(0xEC252BF125ull),X(0xEC2A05D9D4ull),X(0xEC2EDF30D6ull),X(0xEC33B7F627ull),
-	X(0xEC389029C5ull),X(0xEC3D67CBACull),X(0xEC423EDBDAull),X(0xEC47155A4Bull),X(0xEC4BEB46FDull),X(0xEC50C0A1ECull),X(0xEC55956B16ull),X(0xEC5A69A278ull),
-	X(0xEC5F3D480Eull),X(0xEC64105BD6ull),X(0xEC68E2DDCCull),X(0xEC6DB4CDEEull),X(0xEC72862C39ull),X(0xEC7756F8A9ull),X(0xEC7C27333Cull),X(0xEC80F6DBEFull),
-	X(0xEC85C5F2BFull),X(0xEC8A9477A9ull),X(0xEC8F626AAAull),X(0xEC942FCBBEull),X(0xEC98FC9AE4ull),X(0xEC9DC8D817ull),X(0xECA2948356ull),X(0xECA75F9C9Cull),
-	X(0xECAC2A23E8ull),X(0xECB0F41936ull),X(0xECB5BD7C83ull),X(0xECBA864DCCull),X(0xECBF4E8D0Full),X(0xECC4163A48ull),X(0xECC8DD5575ull),X(0xECCDA3DE92ull),
-	X(0xECD269D59Cull),X(0xECD72F3A91ull),X(0xECDBF40D6Eull),X(0xECE0B84E2Full),X(0xECE57BFCD3ull),X(0xECEA3F1955ull),X(0xECEF01A3B2ull),X(0xECF3C39BE9ull),
-	X(0xECF88501F6ull),X(0xECFD45D5D6ull),X(0xED02061786ull),X(0xED06C5C703ull),X(0xED0B84E44Bull),X(0xED10436F5Aull),X(0xED1501682Dull),X(0xED19BECEC2ull),
-	X(0xED1E7BA315ull),X(0xED2337E524ull),X(0xED27F394ECull),X(0xED2CAEB26Aull),X(0xED31693D9Aull),X(0xED3623367Bull),X(0xED3ADC9D08ull),X(0xED3F957140ull),
-	X(0xED444DB31Full),X(0xED490562A2ull),X(0xED4DBC7FC7ull),X(0xED52730A8Aull),X(0xED572902E9ull),X(0xED5BDE68E0ull),X(0xED60933C6Dull),X(0xED65477D8Eull),
-	X(0xED69FB2C3Eull),X(0xED6EAE487Bull),X(0xED7360D242ull),X(0xED7812C991ull),X(0xED7CC42E64ull),X(0xED817500B9ull),X(0xED8625408Cull),X(0xED8AD4EDDBull),
-	X(0xED8F8408A3ull),X(0xED943290E0ull),X(0xED98E08691ull),X(0xED9D8DE9B2ull),X(0xEDA23ABA40ull),X(0xEDA6E6F839ull),X(0xEDAB92A399ull),X(0xEDB03DBC5Dull),
-	X(0xEDB4E84284ull),X(0xEDB9923609ull),X(0xEDBE3B96EAull),X(0xEDC2E46525ull),X(0xEDC78CA0B5ull),X(0xEDCC344999ull),X(0xEDD0DB5FCEull),X(0xEDD581E350ull),
-	X(0xEDDA27D41Dull),X(0xEDDECD3232ull),X(0xEDE371FD8Bull),X(0xEDE8163627ull),X(0xEDECB9DC03ull),X(0xEDF15CEF1Aull),X(0xEDF5FF6F6Cull),X(0xEDFAA15CF4ull),
-	X(0xEDFF42B7AFull),X(0xEE03E37F9Cull),X(0xEE0883B4B7ull),X(0xEE0D2356FEull),X(0xEE11C2666Cull),X(0xEE1660E301ull),X(0xEE1AFECCB8ull),X(0xEE1F9C238Full),
-	X(0xEE2438E783ull),X(0xEE28D51891ull),X(0xEE2D70B6B6ull),X(0xEE320BC1F0ull),X(0xEE36A63A3Cull),X(0xEE3B401F97ull),X(0xEE3FD971FDull),X(0xEE4472316Dull),
-	X(0xEE490A5DE3ull),X(0xEE4DA1F75Dull),X(0xEE5238FDD7ull),X(0xEE56CF714Full),X(0xEE5B6551C2ull),X(0xEE5FFA9F2Dull),X(0xEE648F598Eull),X(0xEE692380E1ull),
-	X(0xEE6DB71524ull),X(0xEE724A1653ull),X(0xEE76DC846Dull),X(0xEE7B6E5F6Eull),X(0xEE7FFFA753ull),X(0xEE84905C1Aull),X(0xEE89207DC0ull),X(0xEE8DB00C42ull),
-	X(0xEE923F079Cull),X(0xEE96CD6FCEull),X(0xEE9B5B44D2ull),X(0xEE9FE886A8ull),X(0xEEA475354Bull),X(0xEEA90150B9ull),X(0xEEAD8CD8F0ull),X(0xEEB217CDECull),
-	X(0xEEB6A22FABull),X(0xEEBB2BFE2Aull),X(0xEEBFB53965ull),X(0xEEC43DE15Cull),X(0xEEC8C5F609ull),X(0xEECD4D776Cull),X(0xEED1D46580ull),X(0xEED65AC043ull),
-	X(0xEEDAE087B3ull),X(0xEEDF65BBCCull),X(0xEEE3EA5C8Cull),X(0xEEE86E69F0ull),X(0xEEECF1E3F5ull),X(0xEEF174CA98ull),X(0xEEF5F71DD7ull),X(0xEEFA78DDAFull),
-	X(0xEEFEFA0A1Dull),X(0xEF037AA31Eull),X(0xEF07FAA8B0ull),X(0xEF0C7A1ACFull),X(0xEF10F8F97Aull),X(0xEF157744ACull),X(0xEF19F4FC64ull),X(0xEF1E72209Full),
-	X(0xEF22EEB159ull),X(0xEF276AAE90ull),X(0xEF2BE61842ull),X(0xEF3060EE6Bull),X(0xEF34DB3109ull),X(0xEF3954E01Aull),X(0xEF3DCDFB99ull),X(0xEF42468385ull),
-	X(0xEF46BE77DBull),X(0xEF4B35D897ull),X(0xEF4FACA5B8ull),X(0xEF5422DF3Aull),X(0xEF5898851Cull),X(0xEF5D0D9759ull),X(0xEF618215EFull),X(0xEF65F600DCull),
-	X(0xEF6A69581Cull),X(0xEF6EDC1BAEull),X(0xEF734E4B8Eull),X(0xEF77BFE7B9ull),X(0xEF7C30F02Dull),X(0xEF80A164E7ull),X(0xEF851145E4ull),X(0xEF89809322ull),
-	X(0xEF8DEF4C9Eull),X(0xEF925D7255ull),X(0xEF96CB0444ull),X(0xEF9B380269ull),X(0xEF9FA46CC1ull),X(0xEFA4104348ull),X(0xEFA87B85FEull),X(0xEFACE634DEull),
-	X(0xEFB1504FE5ull),X(0xEFB5B9D713ull),X(0xEFBA22CA62ull),X(0xEFBE8B29D2ull),X(0xEFC2F2F55Full),X(0xEFC75A2D06ull),X(0xEFCBC0D0C4ull),X(0xEFD026E098ull),
-	X(0xEFD48C5C7Eull),X(0xEFD8F14473ull),X(0xEFDD559875ull),X(0xEFE1B95882ull),X(0xEFE61C8495ull),X(0xEFEA7F1CAEull),X(0xEFEEE120C8ull),X(0xEFF34290E2ull),
-	X(0xEFF7A36CF8ull),X(0xEFFC03B508ull),X(0xF00063690Full),X(0xF004C2890Bull),X(0xF0092114F9ull),X(0xF00D7F0CD5ull),X(0xF011DC709Eull),X(0xF016394051ull),
-	X(0xF01A957BEBull),X(0xF01EF12369ull),X(0xF0234C36C9ull),X(0xF027A6B607ull),X(0xF02C00A122ull),X(0xF03059F817ull),X(0xF034B2BAE2ull),X(0xF0390AE981ull),
-	X(0xF03D6283F3ull),X(0xF041B98A33ull),X(0xF0460FFC3Full),X(0xF04A65DA14ull),X(0xF04EBB23B1ull),X(0xF0530FD911ull),X(0xF05763FA34ull),X(0xF05BB78714ull),
-	X(0xF0600A7FB1ull),X(0xF0645CE408ull),X(0xF068AEB415ull),X(0xF06CFFEFD7ull),X(0xF07150974Aull),X(0xF075A0AA6Cull),X(0xF079F0293Aull),X(0xF07E3F13B1ull),
-	X(0xF0828D69CFull),X(0xF086DB2B92ull),X(0xF08B2858F6ull),X(0xF08F74F1F9ull),X(0xF093C0F698ull),X(0xF0980C66D1ull),X(0xF09C5742A0ull),X(0xF0A0A18A04ull),
-	X(0xF0A4EB3CFAull),X(0xF0A9345B7Eull),X(0xF0AD7CE58Full),X(0xF0B1C4DB2Aull),X(0xF0B60C3C4Bull),X(0xF0BA5308F1ull),X(0xF0BE994119ull),X(0xF0C2DEE4C0ull),
-	X(0xF0C723F3E4ull),X(0xF0CB686E81ull),X(0xF0CFAC5496ull),X(0xF0D3EFA61Full),X(0xF0D832631Aull),X(0xF0DC748B85ull),X(0xF0E0B61F5Cull),X(0xF0E4F71E9Eull),
-	X(0xF0E9378947ull),X(0xF0ED775F55ull),X(0xF0F1B6A0C5ull),X(0xF0F5F54D94ull),X(0xF0FA3365C1ull),X(0xF0FE70E948ull),X(0xF102ADD827ull),X(0xF106EA325Bull),
-	X(0xF10B25F7E1ull),X(0xF10F6128B8ull),X(0xF1139BC4DBull),X(0xF117D5CC4Aull),X(0xF11C0F3F00ull),X(0xF120481CFCull),X(0xF12480663Bull),X(0xF128B81ABAull),
-	X(0xF12CEF3A77ull),X(0xF13125C56Full),X(0xF1355BBBA0ull),X(0xF139911D06ull),X(0xF13DC5E9A0ull),X(0xF141FA216Aull),X(0xF1462DC463ull),X(0xF14A60D287ull),
-	X(0xF14E934BD4ull),X(0xF152C53047ull),X(0xF156F67FDEull),X(0xF15B273A96ull),X(0xF15F57606Dull),X(0xF16386F160ull),X(0xF167B5ED6Cull),X(0xF16BE4548Full),
-	X(0xF1701226C6ull),X(0xF1743F640Full),X(0xF1786C0C67ull),X(0xF17C981FCCull),X(0xF180C39E3Aull),X(0xF184EE87B0ull),X(0xF18918DC2Bull),X(0xF18D429BA7ull),
-	X(0xF1916BC624ull),X(0xF195945B9Eull),X(0xF199BC5C12ull),X(0xF19DE3C77Eull),X(0xF1A20A9DE0ull),X(0xF1A630DF34ull),X(0xF1AA568B79ull),X(0xF1AE7BA2ABull),
-	X(0xF1B2A024C9ull),X(0xF1B6C411CFull),X(0xF1BAE769BCull),X(0xF1BF0A2C8Cull),X(0xF1C32C5A3Cull),X(0xF1C74DF2CCull),X(0xF1CB6EF637ull),X(0xF1CF8F647Bull),
-	X(0xF1D3AF3D96ull),X(0xF1D7CE8186ull),X(0xF1DBED3047ull),X(0xF1E00B49D7ull),X(0xF1E428CE34ull),X(0xF1E845BD5Bull),X(0xF1EC621749ull),X(0xF1F07DDBFDull),
-	X(0xF1F4990B72ull),X(0xF1F8B3A5A8ull),X(0xF1FCCDAA9Bull),X(0xF200E71A4Aull),X(0xF204FFF4B0ull),X(0xF2091839CCull),X(0xF20D2FE99Cull),X(0xF21147041Cull),
-	X(0xF2155D894Aull),X(0xF219737925ull),X(0xF21D88D3A8ull),X(0xF2219D98D2ull),X(0xF225B1C8A0ull),X(0xF229C56310ull),X(0xF22DD8681Full),X(0xF231EAD7CBull),
-	X(0xF235FCB210ull),X(0xF23A0DF6EEull),X(0xF23E1EA660ull),X(0xF2422EC065ull),X(0xF2463E44FAull),X(0xF24A4D341Dull),X(0xF24E5B8DCAull),X(0xF252695200ull),
-	X(0xF2567680BDull),X(0xF25A8319FCull),X(0xF25E8F1DBDull),X(0xF2629A8BFDull),X(0xF266A564B8ull),X(0xF26AAFA7EDull),X(0xF26EB95599ull),X(0xF272C26DBAull),
-	X(0xF276CAF04Dull),X(0xF27AD2DD50ull),X(0xF27EDA34BFull),X(0xF282E0F699ull),X(0xF286E722DCull),X(0xF28AECB984ull),X(0xF28EF1BA8Full),X(0xF292F625FBull),
-	X(0xF296F9FBC5ull),X(0xF29AFD3BEBull),X(0xF29EFFE66Aull),X(0xF2A301FB41ull),X(0xF2A7037A6Bull),X(0xF2AB0463E7ull),X(0xF2AF04B7B3ull),X(0xF2B30475CCull),
-	X(0xF2B7039E2Full),X(0xF2BB0230DAull),X(0xF2BF002DCAull),X(0xF2C2FD94FEull),X(0xF2C6FA6672ull),X(0xF2CAF6A225ull),X(0xF2CEF24813ull),X(0xF2D2ED583Aull),
-	X(0xF2D6E7D299ull),X(0xF2DAE1B72Bull),X(0xF2DEDB05EFull),X(0xF2E2D3BEE3ull),X(0xF2E6CBE204ull),X(0xF2EAC36F4Full),X(0xF2EEBA66C3ull),X(0xF2F2B0C85Cull),
-	X(0xF2F6A69418ull),X(0xF2FA9BC9F5ull),X(0xF2FE9069F0ull),X(0xF302847407ull),X(0xF30677E838ull),X(0xF30A6AC67Full),X(0xF30E5D0EDBull),X(0xF3124EC149ull),
-	X(0xF3163FDDC7ull),X(0xF31A306452ull),X(0xF31E2054E8ull),X(0xF3220FAF87ull),X(0xF325FE742Bull),X(0xF329ECA2D3ull),X(0xF32DDA3B7Cull),X(0xF331C73E24ull),
-	X(0xF335B3AAC7ull),X(0xF3399F8165ull),X(0xF33D8AC1FAull),X(0xF341756C85ull),X(0xF3455F8102ull),X(0xF34948FF6Full),X(0xF34D31E7C9ull),X(0xF3511A3A10ull),
-	X(0xF35501F63Full),X(0xF358E91C54ull),X(0xF35CCFAC4Eull),X(0xF360B5A62Aull),X(0xF3649B09E4ull),X(0xF3687FD77Cull),X(0xF36C640EEEull),X(0xF37047B039ull),
-	X(0xF3742ABB59ull),X(0xF3780D304Cull),X(0xF37BEF0F11ull),X(0xF37FD057A4ull),X(0xF383B10A03ull),X(0xF38791262Bull),X(0xF38B70AC1Bull),X(0xF38F4F9BD1ull),
-	X(0xF3932DF548ull),X(0xF3970BB880ull),X(0xF39AE8E576ull),X(0xF39EC57C27ull),X(0xF3A2A17C91ull),X(0xF3A67CE6B2ull),X(0xF3AA57BA87ull),X(0xF3AE31F80Eull),
-	X(0xF3B20B9F44ull),X(0xF3B5E4B028ull),X(0xF3B9BD2AB6ull),X(0xF3BD950EEDull),X(0xF3C16C5CCAull),X(0xF3C543144Aull),X(0xF3C919356Cull),X(0xF3CCEEC02Dull),
-	X(0xF3D0C3B48Aull),X(0xF3D4981282ull),X(0xF3D86BDA11ull),X(0xF3DC3F0B36ull),X(0xF3E011A5EEull),X(0xF3E3E3AA37ull),X(0xF3E7B5180Eull),X(0xF3EB85EF71ull),
-	X(0xF3EF56305Eull),X(0xF3F325DAD2ull),X(0xF3F6F4EECBull),X(0xF3FAC36C47ull),X(0xF3FE915343ull),X(0xF4025EA3BDull),X(0xF4062B5DB3ull),X(0xF409F78122ull),
-	X(0xF40DC30E08ull),X(0xF4118E0462ull),X(0xF41558642Full),X(0xF419222D6Bull),X(0xF41CEB6015ull),X(0xF420B3FC2Bull),X(0xF4247C01A9ull),X(0xF42843708Eull),
-	X(0xF42C0A48D7ull),X(0xF42FD08A82ull),X(0xF43396358Cull),X(0xF4375B49F4ull),X(0xF43B1FC7B7ull),X(0xF43EE3AED2ull),X(0xF442A6FF44ull),X(0xF44669B909ull),
-	X(0xF44A2BDC20ull),X(0xF44DED6887ull),X(0xF451AE5E3Aull),X(0xF4556EBD38ull),X(0xF4592E857Full),X(0xF45CEDB70Bull),X(0xF460AC51DBull),X(0xF4646A55EDull),
-	X(0xF46827C33Eull),X(0xF46BE499CBull),X(0xF46FA0D994ull),X(0xF4735C8294ull),X(0xF4771794CAull),X(0xF47AD21034ull),X(0xF47E8BF4CFull),X(0xF482454299ull),
-	X(0xF485FDF990ull),X(0xF489B619B1ull),X(0xF48D6DA2FBull),X(0xF49124956Aull),X(0xF494DAF0FDull),X(0xF49890B5B1ull),X(0xF49C45E384ull),X(0xF49FFA7A73ull),
-	X(0xF4A3AE7A7Dull),X(0xF4A761E39Full),X(0xF4AB14B5D7ull),X(0xF4AEC6F123ull),X(0xF4B278957Full),X(0xF4B629A2EBull),X(0xF4B9DA1963ull),X(0xF4BD89F8E6ull),
-	X(0xF4C1394171ull),X(0xF4C4E7F302ull),X(0xF4C8960D96ull),X(0xF4CC43912Cull),X(0xF4CFF07DC1ull),X(0xF4D39CD353ull),X(0xF4D74891DFull),X(0xF4DAF3B963ull),
-	X(0xF4DE9E49DEull),X(0xF4E248434Cull),X(0xF4E5F1A5ABull),X(0xF4E99A70FAull),X(0xF4ED42A536ull),X(0xF4F0EA425Dull),X(0xF4F491486Cull),X(0xF4F837B761ull),
-	X(0xF4FBDD8F3Aull),X(0xF4FF82CFF5ull),X(0xF50327798Full),X(0xF506CB8C07ull),X(0xF50A6F0759ull),X(0xF50E11EB84ull),X(0xF511B43886ull),X(0xF51555EE5Cull),
-	X(0xF518F70D04ull),X(0xF51C97947Bull),X(0xF5203784C0ull),X(0xF523D6DDD1ull),X(0xF527759FAAull),X(0xF52B13CA4Aull),X(0xF52EB15DAFull),X(0xF5324E59D6ull),
-	X(0xF535EABEBEull),X(0xF539868C63ull),X(0xF53D21C2C4ull),X(0xF540BC61DEull),X(0xF5445669B0ull),X(0xF547EFDA36ull),X(0xF54B88B370ull),X(0xF54F20F559ull),
-	X(0xF552B89FF2ull),X(0xF5564FB336ull),X(0xF559E62F24ull),X(0xF55D7C13BAull),X(0xF5611160F6ull),X(0xF564A616D4ull),X(0xF5683A3554ull),X(0xF56BCDBC73ull),
-	X(0xF56F60AC2Eull),X(0xF572F30484ull),X(0xF57684C572ull),X(0xF57A15EEF6ull),X(0xF57DA6810Dull),X(0xF581367BB7ull),X(0xF584C5DEF0ull),X(0xF58854AAB6ull),
-	X(0xF58BE2DF07ull),X(0xF58F707BE1ull),X(0xF592FD8142ull),X(0xF59689EF27ull),X(0xF59A15C58Full),X(0xF59DA10477ull),X(0xF5A12BABDCull),X(0xF5A4B5BBBDull),
-	X(0xF5A83F3418ull),X(0xF5ABC814EAull),X(0xF5AF505E32ull),X(0xF5B2D80FECull),X(0xF5B65F2A17ull),X(0xF5B9E5ACB1ull),X(0xF5BD6B97B8ull),X(0xF5C0F0EB28ull),
-	X(0xF5C475A701ull),X(0xF5C7F9CB40ull),X(0xF5CB7D57E3ull),X(0xF5CF004CE7ull),X(0xF5D282AA4Aull),X(0xF5D604700Bull),X(0xF5D9859E28ull),X(0xF5DD06349Dull),
-	X(0xF5E0863369ull),X(0xF5E4059A89ull),X(0xF5E78469FCull),X(0xF5EB02A1BFull),X(0xF5EE8041D1ull),X(0xF5F1FD4A2Full),X(0xF5F579BAD6ull),X(0xF5F8F593C5ull),
-	X(0xF5FC70D4FAull),X(0xF5FFEB7E72ull),X(0xF60365902Cull),X(0xF606DF0A24ull),X(0xF60A57EC5Aull),X(0xF60DD036CBull),X(0xF61147E974ull),X(0xF614BF0454ull),
-	X(0xF618358768ull),X(0xF61BAB72AEull),X(0xF61F20C625ull),X(0xF6229581CAull),X(0xF62609A59Aull),X(0xF6297D3195ull),X(0xF62CF025B7ull),X(0xF6306281FEull),
-	X(0xF633D44669ull),X(0xF6374572F6ull),X(0xF63AB607A1ull),X(0xF63E260469ull),X(0xF64195694Dull),X(0xF645043649ull),X(0xF648726B5Cull),X(0xF64BE00883ull),
-	X(0xF64F4D0DBDull),X(0xF652B97B07ull),X(0xF65625505Full),X(0xF659908DC3ull),X(0xF65CFB3332ull),X(0xF6606540A8ull),X(0xF663CEB624ull),X(0xF6673793A3ull),
-	X(0xF66A9FD925ull),X(0xF66E0786A5ull),X(0xF6716E9C23ull),X(0xF674D5199Dull),X(0xF6783AFF0Full),X(0xF67BA04C79ull),X(0xF67F0501D7ull),X(0xF682691F29ull),
-	X(0xF685CCA46Bull),X(0xF6892F919Cull),X(0xF68C91E6BAull),X(0xF68FF3A3C2ull),X(0xF69354C8B2ull),X(0xF696B55589ull),X(0xF69A154A44ull),X(0xF69D74A6E2ull),
-	X(0xF6A0D36B5Full),X(0xF6A43197BAull),X(0xF6A78F2BF2ull),X(0xF6AAEC2803ull),X(0xF6AE488BECull),X(0xF6B1A457ABull),X(0xF6B4FF8B3Eull),X(0xF6B85A26A2ull),
-	X(0xF6BBB429D5ull),X(0xF6BF0D94D6ull),X(0xF6C26667A3ull),X(0xF6C5BEA239ull),X(0xF6C9164496ull),X(0xF6CC6D4EB8ull),X(0xF6CFC3C09Dull),X(0xF6D3199A44ull),
-	X(0xF6D66EDBA9ull),X(0xF6D9C384CCull),X(0xF6DD1795A9ull),X(0xF6E06B0E3Full),X(0xF6E3BDEE8Cull),X(0xF6E710368Eull),X(0xF6EA61E642ull),X(0xF6EDB2FDA8ull),
-	X(0xF6F1037CBBull),X(0xF6F453637Cull),X(0xF6F7A2B1E6ull),X(0xF6FAF167FAull),X(0xF6FE3F85B3ull),X(0xF7018D0B12ull),X(0xF704D9F812ull),X(0xF708264CB3ull),
-	X(0xF70B7208F2ull),X(0xF70EBD2CCEull),X(0xF71207B843ull),X(0xF71551AB51ull),X(0xF7189B05F5ull),X(0xF71BE3C82Dull),X(0xF71F2BF1F7ull),X(0xF722738352ull),
-	X(0xF725BA7C3Aull),X(0xF72900DCAFull),X(0xF72C46A4ADull),X(0xF72F8BD434ull),X(0xF732D06B40ull),X(0xF7361469D1ull),X(0xF73957CFE3ull),X(0xF73C9A9D76ull),
-	X(0xF73FDCD286ull),X(0xF7431E6F12ull),X(0xF7465F7319ull),X(0xF7499FDE97ull),X(0xF74CDFB18Bull),X(0xF7501EEBF3ull),X(0xF7535D8DCDull),X(0xF7569B9716ull),
-	X(0xF759D907CEull),X(0xF75D15DFF2ull),X(0xF760521F7Full),X(0xF7638DC674ull),X(0xF766C8D4D0ull),X(0xF76A034A8Full),X(0xF76D3D27B0ull),X(0xF770766C31ull),
-	X(0xF773AF1810ull),X(0xF776E72B4Bull),X(0xF77A1EA5E0ull),X(0xF77D5587CDull),X(0xF7808BD110ull),X(0xF783C181A7ull),X(0xF786F69990ull),X(0xF78A2B18C9ull),
-	X(0xF78D5EFF50ull),X(0xF790924D24ull),X(0xF793C50241ull),X(0xF796F71EA7ull),X(0xF79A28A253ull),X(0xF79D598D43ull),X(0xF7A089DF75ull),X(0xF7A3B998E8ull),
-	X(0xF7A6E8B999ull),X(0xF7AA174186ull),X(0xF7AD4530AEull),X(0xF7B072870Eull),X(0xF7B39F44A5ull),X(0xF7B6CB6970ull),X(0xF7B9F6F56Dull),X(0xF7BD21E89Cull),
-	X(0xF7C04C42F9ull),X(0xF7C3760483ull),X(0xF7C69F2D37ull),X(0xF7C9C7BD14ull),X(0xF7CCEFB418ull),X(0xF7D0171241ull),X(0xF7D33DD78Dull),X(0xF7D66403FAull),
-	X(0xF7D9899787ull),X(0xF7DCAE9230ull),X(0xF7DFD2F3F4ull),X(0xF7E2F6BCD2ull),X(0xF7E619ECC7ull),X(0xF7E93C83D1ull),X(0xF7EC5E81EFull),X(0xF7EF7FE71Full),
-	X(0xF7F2A0B35Dull),X(0xF7F5C0E6AAull),X(0xF7F8E08102ull),X(0xF7FBFF8265ull),X(0xF7FF1DEACFull),X(0xF8023BBA3Full),X(0xF80558F0B3ull),X(0xF808758E29ull),
-	X(0xF80B91929Full),X(0xF80EACFE14ull),X(0xF811C7D085ull),X(0xF814E209F0ull),X(0xF817FBAA54ull),X(0xF81B14B1AEull),X(0xF81E2D1FFEull),X(0xF82144F540ull),
-	X(0xF8245C3173ull),X(0xF82772D494ull),X(0xF82A88DEA3ull),X(0xF82D9E4F9Eull),X(0xF830B32781ull),X(0xF833C7664Cull),X(0xF836DB0BFCull),X(0xF839EE1890ull),
-	X(0xF83D008C05ull),X(0xF84012665Bull),X(0xF84323A78Eull),X(0xF846344F9Dull),X(0xF849445E86ull),X(0xF84C53D448ull),X(0xF84F62B0E0ull),X(0xF85270F44Cull),
-	X(0xF8557E9E8Bull),X(0xF8588BAF9Aull),X(0xF85B982778ull),X(0xF85EA40624ull),X(0xF861AF4B9Aull),X(0xF864B9F7D9ull),X(0xF867C40AE0ull),X(0xF86ACD84ACull),
-	X(0xF86DD6653Bull),X(0xF870DEAC8Dull),X(0xF873E65A9Eull),X(0xF876ED6F6Dull),X(0xF879F3EAF8ull),X(0xF87CF9CD3Dull),X(0xF87FFF163Aull),X(0xF88303C5EEull),
-	X(0xF88607DC57ull),X(0xF8890B5972ull),X(0xF88C0E3D3Eull),X(0xF88F1087B9ull),X(0xF8921238E2ull),X(0xF8951350B5ull),X(0xF89813CF32ull),X(0xF89B13B457ull),
-	X(0xF89E130021ull),X(0xF8A111B290ull),X(0xF8A40FCBA0ull),X(0xF8A70D4B51ull),X(0xF8AA0A31A0ull),X(0xF8AD067E8Bull),X(0xF8B0023211ull),X(0xF8B2FD4C30ull),
-	X(0xF8B5F7CCE6ull),X(0xF8B8F1B431ull),X(0xF8BBEB0210ull),X(0xF8BEE3B680ull),X(0xF8C1DBD180ull),X(0xF8C4D3530Dull),X(0xF8C7CA3B26ull),X(0xF8CAC089CAull),
-	X(0xF8CDB63EF6ull),X(0xF8D0AB5AA9ull),X(0xF8D39FDCE0ull),X(0xF8D693C59Aull),X(0xF8D98714D5ull),X(0xF8DC79CA8Full),X(0xF8DF6BE6C7ull),X(0xF8E25D697Aull),
-	X(0xF8E54E52A7ull),X(0xF8E83EA24Cull),X(0xF8EB2E5868ull),X(0xF8EE1D74F7ull),X(0xF8F10BF7F9ull),X(0xF8F3F9E16Cull),X(0xF8F6E7314Eull),X(0xF8F9D3E79Dull),
-	X(0xF8FCC00457ull),X(0xF8FFAB877Aull),X(0xF902967106ull),X(0xF90580C0F7ull),X(0xF9086A774Cull),X(0xF90B539404ull),X(0xF90E3C171Cull),X(0xF911240093ull),
-	X(0xF9140B5067ull),X(0xF916F20696ull),X(0xF919D8231Eull),X(0xF91CBDA5FEull),X(0xF91FA28F33ull),X(0xF92286DEBDull),X(0xF9256A9499ull),X(0xF9284DB0C5ull),
-	X(0xF92B303340ull),X(0xF92E121C07ull),X(0xF930F36B1Aull),X(0xF933D42076ull),X(0xF936B43C1Aull),X(0xF93993BE03ull),X(0xF93C72A630ull),X(0xF93F50F4A0ull),
-	X(0xF9422EA950ull),X(0xF9450BC43Eull),X(0xF947E8456Aull),X(0xF94AC42CD1ull),X(0xF94D9F7A71ull),X(0xF9507A2E48ull),X(0xF953544856ull),X(0xF9562DC897ull),
-	X(0xF95906AF0Bull),X(0xF95BDEFBB0ull),X(0xF95EB6AE83ull),X(0xF9618DC784ull),X(0xF9646446AFull),X(0xF9673A2C05ull),X(0xF96A0F7782ull),X(0xF96CE42925ull),
-	X(0xF96FB840EDull),X(0xF9728BBED7ull),X(0xF9755EA2E2ull),X(0xF97830ED0Cull),X(0xF97B029D53ull),X(0xF97DD3B3B6ull),X(0xF980A43033ull),X(0xF9837412C8ull),
-	X(0xF986435B73ull),X(0xF989120A34ull),X(0xF98BE01F07ull),X(0xF98EAD99EBull),X(0xF9917A7ADFull),X(0xF99446C1E0ull),X(0xF997126EEEull),X(0xF999DD8206ull),
-	X(0xF99CA7FB26ull),X(0xF99F71DA4Dull),X(0xF9A23B1F7Aull),X(0xF9A503CAAAull),X(0xF9A7CBDBDBull),X(0xF9AA93530Dull),X(0xF9AD5A303Dull),X(0xF9B0207369ull),
-	X(0xF9B2E61C91ull),X(0xF9B5AB2BB1ull),X(0xF9B86FA0C9ull),X(0xF9BB337BD6ull),X(0xF9BDF6BCD8ull),X(0xF9C0B963CCull),X(0xF9C37B70B0ull),X(0xF9C63CE384ull),
-	X(0xF9C8FDBC45ull),X(0xF9CBBDFAF1ull),X(0xF9CE7D9F87ull),X(0xF9D13CAA05ull),X(0xF9D3FB1A69ull),X(0xF9D6B8F0B3ull),X(0xF9D9762CDFull),X(0xF9DC32CEEDull),
-	X(0xF9DEEED6DAull),X(0xF9E1AA44A5ull),X(0xF9E465184Dull),X(0xF9E71F51CFull),X(0xF9E9D8F12Aull),X(0xF9EC91F65Dull),X(0xF9EF4A6165ull),X(0xF9F2023241ull),
-	X(0xF9F4B968EFull),X(0xF9F770056Dull),X(0xF9FA2607BBull),X(0xF9FCDB6FD5ull),X(0xF9FF903DBCull),X(0xFA0244716Cull),X(0xFA04F80AE4ull),X(0xFA07AB0A23ull),
-	X(0xFA0A5D6F26ull),X(0xFA0D0F39EDull),X(0xFA0FC06A75ull),X(0xFA127100BDull),X(0xFA1520FCC4ull),X(0xFA17D05E87ull),X(0xFA1A7F2605ull),X(0xFA1D2D533Cull),
-	X(0xFA1FDAE62Aull),X(0xFA2287DECFull),X(0xFA25343D28ull),X(0xFA27E00133ull),X(0xFA2A8B2AF0ull),X(0xFA2D35BA5Bull),X(0xFA2FDFAF75ull),X(0xFA32890A3Bull),
-	X(0xFA3531CAABull),X(0xFA37D9F0C3ull),X(0xFA3A817C83ull),X(0xFA3D286DE9ull),X(0xFA3FCEC4F2ull),X(0xFA4274819Dull),X(0xFA4519A3E9ull),X(0xFA47BE2BD4ull),
-	X(0xFA4A62195Dull),X(0xFA4D056C81ull),X(0xFA4FA8253Full),X(0xFA524A4395ull),X(0xFA54EBC783ull),X(0xFA578CB105ull),X(0xFA5A2D001Bull),X(0xFA5CCCB4C3ull),
-	X(0xFA5F6BCEFCull),X(0xFA620A4EC3ull),X(0xFA64A83417ull),X(0xFA67457EF7ull),X(0xFA69E22F61ull),X(0xFA6C7E4553ull),X(0xFA6F19C0CBull),X(0xFA71B4A1C9ull),
-	X(0xFA744EE84Aull),X(0xFA76E8944Dull),X(0xFA7981A5D0ull),X(0xFA7C1A1CD2ull),X(0xFA7EB1F950ull),X(0xFA81493B4Bull),X(0xFA83DFE2BFull),X(0xFA8675EFABull),
-	X(0xFA890B620Eull),X(0xFA8BA039E6ull),X(0xFA8E347731ull),X(0xFA90C819EFull),X(0xFA935B221Cull),X(0xFA95ED8FB8ull),X(0xFA987F62C2ull),X(0xFA9B109B37ull),
-	X(0xFA9DA13915ull),X(0xFAA0313C5Dull),X(0xFAA2C0A50Bull),X(0xFAA54F731Eull),X(0xFAA7DDA694ull),X(0xFAAA6B3F6Dull),X(0xFAACF83DA6ull),X(0xFAAF84A13Eull),
-	X(0xFAB2106A34ull),X(0xFAB49B9885ull),X(0xFAB7262C30ull),X(0xFAB9B02534ull),X(0xFABC39838Full),X(0xFABEC24740ull),X(0xFAC14A7044ull),X(0xFAC3D1FE9Bull),
-	X(0xFAC658F242ull),X(0xFAC8DF4B39ull),X(0xFACB65097Dull),X(0xFACDEA2D0Eull),X(0xFAD06EB5E9ull),X(0xFAD2F2A40Dull),X(0xFAD575F779ull),X(0xFAD7F8B02Aull),
-	X(0xFADA7ACE20ull),X(0xFADCFC5159ull),X(0xFADF7D39D3ull),X(0xFAE1FD878Cull),X(0xFAE47D3A84ull),X(0xFAE6FC52B8ull),X(0xFAE97AD028ull),X(0xFAEBF8B2D1ull),
-	X(0xFAEE75FAB2ull),X(0xFAF0F2A7CAull),X(0xFAF36EBA16ull),X(0xFAF5EA3196ull),X(0xFAF8650E48ull),X(0xFAFADF502Bull),X(0xFAFD58F73Cull),X(0xFAFFD2037Aull),
-	X(0xFB024A74E4ull),X(0xFB04C24B79ull),X(0xFB07398736ull),X(0xFB09B0281Aull),X(0xFB0C262E24ull),X(0xFB0E9B9952ull),X(0xFB111069A3ull),X(0xFB13849F15ull),
-	X(0xFB15F839A7ull),X(0xFB186B3957ull),X(0xFB1ADD9E23ull),X(0xFB1D4F680Bull),X(0xFB1FC0970Cull),X(0xFB22312B25ull),X(0xFB24A12455ull),X(0xFB2710829Aull),
-	X(0xFB297F45F2ull),X(0xFB2BED6E5Cull),X(0xFB2E5AFBD7ull),X(0xFB30C7EE61ull),X(0xFB333445F9ull),X(0xFB35A0029Dull),X(0xFB380B244Bull),X(0xFB3A75AB03ull),
-	X(0xFB3CDF96C2ull),X(0xFB3F48E787ull),X(0xFB41B19D51ull),X(0xFB4419B81Eull),X(0xFB468137ECull),X(0xFB48E81CBBull),X(0xFB4B4E6689ull),X(0xFB4DB41553ull),
-	X(0xFB5019291Aull),X(0xFB527DA1DAull),X(0xFB54E17F94ull),X(0xFB5744C245ull),X(0xFB59A769EBull),X(0xFB5C097686ull),X(0xFB5E6AE814ull),X(0xFB60CBBE94ull),
-	X(0xFB632BFA03ull),X(0xFB658B9A61ull),X(0xFB67EA9FACull),X(0xFB6A4909E2ull),X(0xFB6CA6D902ull),X(0xFB6F040D0Bull),X(0xFB7160A5FCull),X(0xFB73BCA3D2ull),
-	X(0xFB7618068Cull),X(0xFB7872CE29ull),X(0xFB7ACCFAA8ull),X(0xFB7D268C06ull),X(0xFB7F7F8243ull),X(0xFB81D7DD5Dull),X(0xFB842F9D53ull),X(0xFB8686C222ull),
-	X(0xFB88DD4BCBull),X(0xFB8B333A4Aull),X(0xFB8D888DA0ull),X(0xFB8FDD45C9ull),X(0xFB923162C6ull),X(0xFB9484E494ull),X(0xFB96D7CB32ull),X(0xFB992A169Full),
-	X(0xFB9B7BC6D9ull),X(0xFB9DCCDBDFull),X(0xFBA01D55AFull),X(0xFBA26D3448ull),X(0xFBA4BC77A9ull),X(0xFBA70B1FCFull),X(0xFBA9592CBAull),X(0xFBABA69E69ull),
-	X(0xFBADF374D9ull),X(0xFBB03FB009ull),X(0xFBB28B4FF9ull),X(0xFBB4D654A6ull),X(0xFBB720BE0Full),X(0xFBB96A8C33ull),X(0xFBBBB3BF10ull),X(0xFBBDFC56A5ull),
-	X(0xFBC04452F0ull),X(0xFBC28BB3F1ull),X(0xFBC4D279A5ull),X(0xFBC718A40Cull),X(0xFBC95E3323ull),X(0xFBCBA326EAull),X(0xFBCDE77F5Full),X(0xFBD02B3C80ull),
-	X(0xFBD26E5E4Dull),X(0xFBD4B0E4C3ull),X(0xFBD6F2CFE2ull),X(0xFBD9341FA9ull),X(0xFBDB74D415ull),X(0xFBDDB4ED25ull),X(0xFBDFF46AD8ull),X(0xFBE2334D2Cull),
-	X(0xFBE4719421ull),X(0xFBE6AF3FB5ull),X(0xFBE8EC4FE5ull),X(0xFBEB28C4B2ull),X(0xFBED649E1Aull),X(0xFBEF9FDC1Aull),X(0xFBF1DA7EB3ull),X(0xFBF41485E2ull),
-	X(0xFBF64DF1A6ull),X(0xFBF886C1FEull),X(0xFBFABEF6E8ull),X(0xFBFCF69063ull),X(0xFBFF2D8E6Eull),X(0xFC0163F107ull),X(0xFC0399B82Dull),X(0xFC05CEE3DFull),
-	X(0xFC0803741Bull),X(0xFC0A3768DFull),X(0xFC0C6AC22Bull),X(0xFC0E9D7FFDull),X(0xFC10CFA254ull),X(0xFC1301292Eull),X(0xFC1532148Aull),X(0xFC17626467ull),
-	X(0xFC199218C4ull),X(0xFC1BC1319Eull),X(0xFC1DEFAEF5ull),X(0xFC201D90C7ull),X(0xFC224AD713ull),X(0xFC247781D8ull),X(0xFC26A39114ull),X(0xFC28CF04C6ull),
-	X(0xFC2AF9DCECull),X(0xFC2D241986ull),X(0xFC2F4DBA91ull),X(0xFC3176C00Eull),X(0xFC339F29F9ull),X(0xFC35C6F852ull),X(0xFC37EE2B18ull),X(0xFC3A14C249ull),
-	X(0xFC3C3ABDE5ull),X(0xFC3E601DE8ull),X(0xFC4084E253ull),X(0xFC42A90B24ull),X(0xFC44CC985Aull),X(0xFC46EF89F3ull),X(0xFC4911DFEEull),X(0xFC4B339A49ull),
-	X(0xFC4D54B904ull),X(0xFC4F753C1Dull),X(0xFC51952393ull),X(0xFC53B46F64ull),X(0xFC55D31F8Full),X(0xFC57F13414ull),X(0xFC5A0EACEFull),X(0xFC5C2B8A21ull),
-	X(0xFC5E47CBA8ull),X(0xFC60637182ull),X(0xFC627E7BAFull),X(0xFC6498EA2Cull),X(0xFC66B2BCFAull),X(0xFC68CBF415ull),X(0xFC6AE48F7Eull),X(0xFC6CFC8F33ull),
-	X(0xFC6F13F332ull),X(0xFC712ABB7Bull),X(0xFC7340E80Bull),X(0xFC755678E2ull),X(0xFC776B6DFEull),X(0xFC797FC75Full),X(0xFC7B938502ull),X(0xFC7DA6A6E7ull),
-	X(0xFC7FB92D0Cull),X(0xFC81CB1770ull),X(0xFC83DC6612ull),X(0xFC85ED18F0ull),X(0xFC87FD3009ull),X(0xFC8A0CAB5Cull),X(0xFC8C1B8AE8ull),X(0xFC8E29CEABull),
-	X(0xFC903776A5ull),X(0xFC924482D2ull),X(0xFC9450F334ull),X(0xFC965CC7C8ull),X(0xFC9868008Cull),X(0xFC9A729D81ull),X(0xFC9C7C9EA4ull),X(0xFC9E8603F4ull),
-	X(0xFCA08ECD70ull),X(0xFCA296FB17ull),X(0xFCA49E8CE8ull),X(0xFCA6A582E0ull),X(0xFCA8ABDD00ull),X(0xFCAAB19B45ull),X(0xFCACB6BDAFull),X(0xFCAEBB443Cull),
-	X(0xFCB0BF2EEAull),X(0xFCB2C27DBAull),X(0xFCB4C530A9ull),X(0xFCB6C747B7ull),X(0xFCB8C8C2E1ull),X(0xFCBAC9A227ull),X(0xFCBCC9E588ull),X(0xFCBEC98D02ull),
-	X(0xFCC0C89894ull),X(0xFCC2C7083Dull),X(0xFCC4C4DBFBull),X(0xFCC6C213CEull),X(0xFCC8BEAFB4ull),X(0xFCCABAAFACull),X(0xFCCCB613B5ull),X(0xFCCEB0DBCDull),
-	X(0xFCD0AB07F3ull),X(0xFCD2A49826ull),X(0xFCD49D8C66ull),X(0xFCD695E4B0ull),X(0xFCD88DA103ull),X(0xFCDA84C15Eull),X(0xFCDC7B45C0ull),X(0xFCDE712E29ull),
-	X(0xFCE0667A95ull),X(0xFCE25B2B05ull),X(0xFCE44F3F77ull),X(0xFCE642B7EAull),X(0xFCE835945Dull),X(0xFCEA27D4CEull),X(0xFCEC19793Dull),X(0xFCEE0A81A8ull),
-	X(0xFCEFFAEE0Dull),X(0xFCF1EABE6Dull),X(0xFCF3D9F2C5ull),X(0xFCF5C88B14ull),X(0xFCF7B68759ull),X(0xFCF9A3E793ull),X(0xFCFB90ABC2ull),X(0xFCFD7CD3E2ull),
-	X(0xFCFF685FF4ull),X(0xFD01534FF6ull),X(0xFD033DA3E8ull),X(0xFD05275BC7ull),X(0xFD07107793ull),X(0xFD08F8F74Aull),X(0xFD0AE0DAEBull),X(0xFD0CC82276ull),
-	X(0xFD0EAECDE9ull),X(0xFD1094DD42ull),X(0xFD127A5081ull),X(0xFD145F27A5ull),X(0xFD164362ACull),X(0xFD18270194ull),X(0xFD1A0A045Eull),X(0xFD1BEC6B08ull),
-	X(0xFD1DCE3590ull),X(0xFD1FAF63F6ull),X(0xFD218FF638ull),X(0xFD236FEC55ull),X(0xFD254F464Cull),X(0xFD272E041Cull),X(0xFD290C25C3ull),X(0xFD2AE9AB42ull),
-	X(0xFD2CC69495ull),X(0xFD2EA2E1BDull),X(0xFD307E92B8ull),X(0xFD3259A784ull),X(0xFD34342022ull),X(0xFD360DFC8Full),X(0xFD37E73CCBull),X(0xFD39BFE0D4ull),
-	X(0xFD3B97E8A9ull),X(0xFD3D6F5449ull),X(0xFD3F4623B3ull),X(0xFD411C56E6ull),X(0xFD42F1EDE1ull),X(0xFD44C6E8A2ull),X(0xFD469B4729ull),X(0xFD486F0974ull),
-	X(0xFD4A422F82ull),X(0xFD4C14B952ull),X(0xFD4DE6A6E3ull),X(0xFD4FB7F834ull),X(0xFD5188AD44ull),X(0xFD5358C611ull),X(0xFD5528429Aull),X(0xFD56F722DFull),
-	X(0xFD58C566DEull),X(0xFD5A930E96ull),X(0xFD5C601A06ull),X(0xFD5E2C892Dull),X(0xFD5FF85C0Aull),X(0xFD61C3929Bull),X(0xFD638E2CE0ull),X(0xFD65582AD7ull),
-	X(0xFD67218C80ull),X(0xFD68EA51D9ull),X(0xFD6AB27AE1ull),X(0xFD6C7A0797ull),X(0xFD6E40F7FAull),X(0xFD70074C09ull),X(0xFD71CD03C2ull),X(0xFD73921F25ull),
-	X(0xFD75569E31ull),X(0xFD771A80E4ull),X(0xFD78DDC73Eull),X(0xFD7AA0713Cull),X(0xFD7C627EDFull),X(0xFD7E23F025ull),X(0xFD7FE4C50Eull),X(0xFD81A4FD97ull),
-	X(0xFD836499C0ull),X(0xFD85239987ull),X(0xFD86E1FCEDull),X(0xFD889FC3EFull),X(0xFD8A5CEE8Dull),X(0xFD8C197CC5ull),X(0xFD8DD56E96ull),X(0xFD8F90C400ull),
-	X(0xFD914B7D02ull),X(0xFD93059999ull),X(0xFD94BF19C6ull),X(0xFD9677FD86ull),X(0xFD983044DAull),X(0xFD99E7EFC0ull),X(0xFD9B9EFE36ull),X(0xFD9D55703Dull),
-	X(0xFD9F0B45D2ull),X(0xFDA0C07EF5ull),X(0xFDA2751BA5ull),X(0xFDA4291BE0ull),X(0xFDA5DC7FA6ull),X(0xFDA78F46F5ull),X(0xFDA94171CDull),X(0xFDAAF3002Cull),
-	X(0xFDACA3F212ull),X(0xFDAE54477Dull),X(0xFDB004006Cull),X(0xFDB1B31CDFull),X(0xFDB3619CD4ull),X(0xFDB50F804Aull),X(0xFDB6BCC740ull),X(0xFDB86971B5ull),
-	X(0xFDBA157FA8ull),X(0xFDBBC0F119ull),X(0xFDBD6BC605ull),X(0xFDBF15FE6Dull),X(0xFDC0BF9A4Eull),X(0xFDC26899A9ull),X(0xFDC410FC7Bull),X(0xFDC5B8C2C4ull),
-	X(0xFDC75FEC83ull),X(0xFDC90679B7ull),X(0xFDCAAC6A5Full),X(0xFDCC51BE79ull),X(0xFDCDF67606ull),X(0xFDCF9A9103ull),X(0xFDD13E0F70ull),X(0xFDD2E0F14Cull),
-	X(0xFDD4833695ull),X(0xFDD624DF4Bull),X(0xFDD7C5EB6Dull),X(0xFDD9665AFAull),X(0xFDDB062DF1ull),X(0xFDDCA56450ull),X(0xFDDE43FE17ull),X(0xFDDFE1FB44ull),
-	X(0xFDE17F5BD8ull),X(0xFDE31C1FD0ull),X(0xFDE4B8472Cull),X(0xFDE653D1EBull),X(0xFDE7EEC00Bull),X(0xFDE989118Cull),X(0xFDEB22C66Dull),X(0xFDECBBDEADull),
-	X(0xFDEE545A4Bull),X(0xFDEFEC3945ull),X(0xFDF1837B9Bull),X(0xFDF31A214Dull),X(0xFDF4B02A58ull),X(0xFDF64596BCull),X(0xFDF7DA6677ull),X(0xFDF96E998Aull),
-	X(0xFDFB022FF3ull),X(0xFDFC9529B1ull),X(0xFDFE2786C3ull),X(0xFDFFB94728ull),X(0xFE014A6ADFull),X(0xFE02DAF1E7ull),X(0xFE046ADC3Full),X(0xFE05FA29E6ull),
-	X(0xFE0788DADCull),X(0xFE0916EF1Full),X(0xFE0AA466AFull),X(0xFE0C314189ull),X(0xFE0DBD7FAEull),X(0xFE0F49211Dull),X(0xFE10D425D4ull),X(0xFE125E8DD3ull),
-	X(0xFE13E85918ull),X(0xFE157187A3ull),X(0xFE16FA1972ull),X(0xFE18820E86ull),X(0xFE1A0966DCull),X(0xFE1B902274ull),X(0xFE1D16414Dull),X(0xFE1E9BC366ull),
-	X(0xFE2020A8BDull),X(0xFE21A4F154ull),X(0xFE23289D27ull),X(0xFE24ABAC36ull),X(0xFE262E1E81ull),X(0xFE27AFF406ull),X(0xFE29312CC5ull),X(0xFE2AB1C8BCull),
-	X(0xFE2C31C7EBull),X(0xFE2DB12A50ull),X(0xFE2F2FEFEBull),X(0xFE30AE18BBull),X(0xFE322BA4BFull),X(0xFE33A893F6ull),X(0xFE3524E65Full),X(0xFE36A09BF9ull),
-	X(0xFE381BB4C3ull),X(0xFE399630BCull),X(0xFE3B100FE4ull),X(0xFE3C89523Aull),X(0xFE3E01F7BCull),X(0xFE3F7A006Aull),X(0xFE40F16C42ull),X(0xFE42683B45ull),
-	X(0xFE43DE6D70ull),X(0xFE455402C3ull),X(0xFE46C8FB3Eull),X(0xFE483D56DFull),X(0xFE49B115A5ull),X(0xFE4B243790ull),X(0xFE4C96BC9Eull),X(0xFE4E08A4CFull),
-	X(0xFE4F79F022ull),X(0xFE50EA9E95ull),X(0xFE525AB029ull),X(0xFE53CA24DCull),X(0xFE5538FCADull),X(0xFE56A7379Bull),X(0xFE5814D5A6ull),X(0xFE5981D6CCull),
-	X(0xFE5AEE3B0Dull),X(0xFE5C5A0268ull),X(0xFE5DC52CDCull),X(0xFE5F2FBA68ull),X(0xFE6099AB0Cull),X(0xFE6202FEC5ull),X(0xFE636BB594ull),X(0xFE64D3CF78ull),
-	X(0xFE663B4C6Full),X(0xFE67A22C7Aull),X(0xFE69086F96ull),X(0xFE6A6E15C3ull),X(0xFE6BD31F01ull),X(0xFE6D378B4Eull),X(0xFE6E9B5AAAull),X(0xFE6FFE8D13ull),
-	X(0xFE71612289ull),X(0xFE72C31B0Cull),X(0xFE74247699ull),X(0xFE75853530ull),X(0xFE76E556D2ull),X(0xFE7844DB7Bull),X(0xFE79A3C32Dull),X(0xFE7B020DE5ull),
-	X(0xFE7C5FBBA3ull),X(0xFE7DBCCC67ull),X(0xFE7F19402Full),X(0xFE807516FAull),X(0xFE81D050C8ull),X(0xFE832AED98ull),X(0xFE8484ED69ull),X(0xFE85DE503Aull),
-	X(0xFE8737160Bull),X(0xFE888F3EDAull),X(0xFE89E6CAA6ull),X(0xFE8B3DB970ull),X(0xFE8C940B36ull),X(0xFE8DE9BFF6ull),X(0xFE8F3ED7B2ull),X(0xFE90935266ull),
-	X(0xFE91E73014ull),X(0xFE933A70B9ull),X(0xFE948D1456ull),X(0xFE95DF1AE9ull),X(0xFE97308471ull),X(0xFE988150EEull),X(0xFE99D1805Full),X(0xFE9B2112C3ull),
-	X(0xFE9C700819ull),X(0xFE9DBE6061ull),X(0xFE9F0C1B99ull),X(0xFEA05939C1ull),X(0xFEA1A5BAD8ull),X(0xFEA2F19EDDull),X(0xFEA43CE5D0ull),X(0xFEA5878FAFull),
-	X(0xFEA6D19C7Aull),X(0xFEA81B0C30ull),X(0xFEA963DED1ull),X(0xFEAAAC145Bull),X(0xFEABF3ACCDull),X(0xFEAD3AA827ull),X(0xFEAE810669ull),X(0xFEAFC6C790ull),
-	X(0xFEB10BEB9Eull),X(0xFEB2507290ull),X(0xFEB3945C65ull),X(0xFEB4D7A91Eull),X(0xFEB61A58BAull),X(0xFEB75C6B37ull),X(0xFEB89DE094ull),X(0xFEB9DEB8D2ull),
-	X(0xFEBB1EF3EFull),X(0xFEBC5E91EBull),X(0xFEBD9D92C4ull),X(0xFEBEDBF67Aull),X(0xFEC019BD0Dull),X(0xFEC156E67Bull),X(0xFEC29372C3ull),X(0xFEC3CF61E6ull),
-	X(0xFEC50AB3E2ull),X(0xFEC64568B6ull),X(0xFEC77F8061ull),X(0xFEC8B8FAE4ull),X(0xFEC9F1D83Cull),X(0xFECB2A186Aull),X(0xFECC61BB6Dull),X(0xFECD98C143ull),
-	X(0xFECECF29EDull),X(0xFED004F569ull),X(0xFED13A23B6ull),X(0xFED26EB4D5ull),X(0xFED3A2A8C3ull),X(0xFED4D5FF81ull),X(0xFED608B90Eull),X(0xFED73AD568ull),
-	X(0xFED86C548Full),X(0xFED99D3684ull),X(0xFEDACD7B43ull),X(0xFEDBFD22CEull),X(0xFEDD2C2D23ull),X(0xFEDE5A9A41ull),X(0xFEDF886A28ull),X(0xFEE0B59CD7ull),
-	X(0xFEE1E2324Eull),X(0xFEE30E2A8Bull),X(0xFEE439858Eull),X(0xFEE5644356ull),X(0xFEE68E63E3ull),X(0xFEE7B7E733ull),X(0xFEE8E0CD46ull),X(0xFEEA09161Cull),
-	X(0xFEEB30C1B3ull),X(0xFEEC57D00Bull),X(0xFEED7E4123ull),X(0xFEEEA414FAull),X(0xFEEFC94B91ull),X(0xFEF0EDE4E5ull),X(0xFEF211E0F6ull),X(0xFEF3353FC5ull),
-	X(0xFEF458014Full),X(0xFEF57A2594ull),X(0xFEF69BAC94ull),X(0xFEF7BC964Dull),X(0xFEF8DCE2C0ull),X(0xFEF9FC91EBull),X(0xFEFB1BA3CEull),X(0xFEFC3A1868ull),
-	X(0xFEFD57EFB8ull),X(0xFEFE7529BEull),X(0xFEFF91C679ull),X(0xFF00ADC5E8ull),X(0xFF01C9280Aull),X(0xFF02E3ECE0ull),X(0xFF03FE1468ull),X(0xFF05179EA1ull),
-	X(0xFF06308B8Cull),X(0xFF0748DB26ull),X(0xFF08608D70ull),X(0xFF0977A269ull),X(0xFF0A8E1A10ull),X(0xFF0BA3F464ull),X(0xFF0CB93166ull),X(0xFF0DCDD113ull),
-	X(0xFF0EE1D36Cull),X(0xFF0FF53870ull),X(0xFF1108001Eull),X(0xFF121A2A76ull),X(0xFF132BB776ull),X(0xFF143CA71Full),X(0xFF154CF96Full),X(0xFF165CAE66ull),
-	X(0xFF176BC603ull),X(0xFF187A4046ull),X(0xFF19881D2Dull),X(0xFF1A955CB9ull),X(0xFF1BA1FEE9ull),X(0xFF1CAE03BBull),X(0xFF1DB96B30ull),X(0xFF1EC43547ull),
-	X(0xFF1FCE61FEull),X(0xFF20D7F156ull),X(0xFF21E0E34Eull),X(0xFF22E937E5ull),X(0xFF23F0EF1Aull),X(0xFF24F808EDull),X(0xFF25FE855Dull),X(0xFF2704646Aull),
-	X(0xFF2809A613ull),X(0xFF290E4A57ull),X(0xFF2A125136ull),X(0xFF2B15BAAFull),X(0xFF2C1886C2ull),X(0xFF2D1AB56Dull),X(0xFF2E1C46B0ull),X(0xFF2F1D3A8Bull),
-	X(0xFF301D90FDull),X(0xFF311D4A05ull),X(0xFF321C65A3ull),X(0xFF331AE3D6ull),X(0xFF3418C49Eull),X(0xFF351607F9ull),X(0xFF3612ADE8ull),X(0xFF370EB669ull),
-	X(0xFF380A217Dull),X(0xFF3904EF22ull),X(0xFF39FF1F57ull),X(0xFF3AF8B21Dull),X(0xFF3BF1A773ull),X(0xFF3CE9FF58ull),X(0xFF3DE1B9CBull),X(0xFF3ED8D6CBull),
-	X(0xFF3FCF565Aull),X(0xFF40C53874ull),X(0xFF41BA7D1Bull),X(0xFF42AF244Eull),X(0xFF43A32E0Bull),X(0xFF44969A52ull),X(0xFF45896924ull),X(0xFF467B9A7Eull),
-	X(0xFF476D2E61ull),X(0xFF485E24CCull),X(0xFF494E7DBEull),X(0xFF4A3E3937ull),X(0xFF4B2D5736ull),X(0xFF4C1BD7BBull),X(0xFF4D09BAC5ull),X(0xFF4DF70053ull),
-	X(0xFF4EE3A865ull),X(0xFF4FCFB2FBull),X(0xFF50BB2014ull),X(0xFF51A5EFAEull),X(0xFF529021CBull),X(0xFF5379B668ull),X(0xFF5462AD86ull),X(0xFF554B0724ull),
-	X(0xFF5632C341ull),X(0xFF5719E1DDull),X(0xFF580062F8ull),X(0xFF58E64690ull),X(0xFF59CB8CA5ull),X(0xFF5AB03537ull),X(0xFF5B944045ull),X(0xFF5C77ADCFull),
-	X(0xFF5D5A7DD3ull),X(0xFF5E3CB052ull),X(0xFF5F1E454Bull),X(0xFF5FFF3CBDull),X(0xFF60DF96A8ull),X(0xFF61BF530Bull),X(0xFF629E71E6ull),X(0xFF637CF338ull),
-	X(0xFF645AD701ull),X(0xFF65381D40ull),X(0xFF6614C5F5ull),X(0xFF66F0D11Eull),X(0xFF67CC3EBCull),X(0xFF68A70ECEull),X(0xFF69814154ull),X(0xFF6A5AD64Cull),
-	X(0xFF6B33CDB7ull),X(0xFF6C0C2793ull),X(0xFF6CE3E3E2ull),X(0xFF6DBB02A0ull),X(0xFF6E9183D0ull),X(0xFF6F67676Full),X(0xFF703CAD7Dull),X(0xFF711155FAull),
-	X(0xFF71E560E6ull),X(0xFF72B8CE3Full),X(0xFF738B9E05ull),X(0xFF745DD038ull),X(0xFF752F64D8ull),X(0xFF76005BE3ull),X(0xFF76D0B559ull),X(0xFF77A0713Aull),
-	X(0xFF786F8F85ull),X(0xFF793E103Aull),X(0xFF7A0BF359ull),X(0xFF7AD938E0ull),X(0xFF7BA5E0CFull),X(0xFF7C71EB26ull),X(0xFF7D3D57E4ull),X(0xFF7E082709ull),
-	X(0xFF7ED25894ull),X(0xFF7F9BEC85ull),X(0xFF8064E2DBull),X(0xFF812D3B96ull),X(0xFF81F4F6B6ull),X(0xFF82BC1439ull),X(0xFF83829420ull),X(0xFF84487669ull),
-	X(0xFF850DBB15ull),X(0xFF85D26223ull),X(0xFF86966B93ull),X(0xFF8759D763ull),X(0xFF881CA594ull),X(0xFF88DED625ull),X(0xFF89A06915ull),X(0xFF8A615E65ull),
-	X(0xFF8B21B613ull),X(0xFF8BE17020ull),X(0xFF8CA08C8Aull),X(0xFF8D5F0B51ull),X(0xFF8E1CEC76ull),X(0xFF8EDA2FF6ull),X(0xFF8F96D5D3ull),X(0xFF9052DE0Bull),
-	X(0xFF910E489Eull),X(0xFF91C9158Bull),X(0xFF928344D3ull),X(0xFF933CD674ull),X(0xFF93F5CA6Full),X(0xFF94AE20C2ull),X(0xFF9565D96Dull),X(0xFF961CF471ull),
-	X(0xFF96D371CBull),X(0xFF9789517Dull),X(0xFF983E9385ull),X(0xFF98F337E4ull),X(0xFF99A73E98ull),X(0xFF9A5AA7A1ull),X(0xFF9B0D72FFull),X(0xFF9BBFA0B2ull),
-	X(0xFF9C7130B8ull),X(0xFF9D222312ull),X(0xFF9DD277BFull),X(0xFF9E822EBEull),X(0xFF9F314810ull),X(0xFF9FDFC3B4ull),X(0xFFA08DA1A9ull),X(0xFFA13AE1EFull),
-	X(0xFFA1E78486ull),X(0xFFA293896Cull),X(0xFFA33EF0A3ull),X(0xFFA3E9BA29ull),X(0xFFA493E5FDull),X(0xFFA53D7421ull),X(0xFFA5E66492ull),X(0xFFA68EB751ull),
-	X(0xFFA7366C5Dull),X(0xFFA7DD83B6ull),X(0xFFA883FD5Cull),X(0xFFA929D94Eull),X(0xFFA9CF178Bull),X(0xFFAA73B813ull),X(0xFFAB17BAE7ull),X(0xFFABBB2005ull),
-	X(0xFFAC5DE76Dull),X(0xFFAD00111Full),X(0xFFADA19D1Aull),X(0xFFAE428B5Dull),X(0xFFAEE2DBEAull),X(0xFFAF828EBEull),X(0xFFB021A3DBull),X(0xFFB0C01B3Eull),
-	X(0xFFB15DF4E9ull),X(0xFFB1FB30DAull),X(0xFFB297CF12ull),X(0xFFB333CF8Full),X(0xFFB3CF3252ull),X(0xFFB469F75Aull),X(0xFFB5041EA7ull),X(0xFFB59DA838ull),
-	X(0xFFB636940Dull),X(0xFFB6CEE225ull),X(0xFFB7669281ull),X(0xFFB7FDA520ull),X(0xFFB8941A01ull),X(0xFFB929F124ull),X(0xFFB9BF2A8Aull),X(0xFFBA53C630ull),
-	X(0xFFBAE7C418ull),X(0xFFBB7B2440ull),X(0xFFBC0DE6A9ull),X(0xFFBCA00B52ull),X(0xFFBD31923Bull),X(0xFFBDC27B62ull),X(0xFFBE52C6C9ull),X(0xFFBEE2746Eull),
-	X(0xFFBF718452ull),X(0xFFBFFFF674ull),X(0xFFC08DCAD3ull),X(0xFFC11B016Full),X(0xFFC1A79A48ull),X(0xFFC233955Eull),X(0xFFC2BEF2B0ull),X(0xFFC349B23Eull),
-	X(0xFFC3D3D408ull),X(0xFFC45D580Cull),X(0xFFC4E63E4Cull),X(0xFFC56E86C6ull),X(0xFFC5F6317Bull),X(0xFFC67D3E69ull),X(0xFFC703AD91ull),X(0xFFC7897EF2ull),
-	X(0xFFC80EB28Cull),X(0xFFC893485Eull),X(0xFFC9174069ull),X(0xFFC99A9AACull),X(0xFFCA1D5727ull),X(0xFFCA9F75D9ull),X(0xFFCB20F6C2ull),X(0xFFCBA1D9E1ull),
-	X(0xFFCC221F37ull),X(0xFFCCA1C6C3ull),X(0xFFCD20D085ull),X(0xFFCD9F3C7Dull),X(0xFFCE1D0AA9ull),X(0xFFCE9A3B0Bull),X(0xFFCF16CDA1ull),X(0xFFCF92C26Bull),
-	X(0xFFD00E1969ull),X(0xFFD088D29Bull),X(0xFFD102EE01ull),X(0xFFD17C6B99ull),X(0xFFD1F54B64ull),X(0xFFD26D8D62ull),X(0xFFD2E53192ull),X(0xFFD35C37F4ull),
-	X(0xFFD3D2A087ull),X(0xFFD4486B4Cull),X(0xFFD4BD9842ull),X(0xFFD5322769ull),X(0xFFD5A618C0ull),X(0xFFD6196C47ull),X(0xFFD68C21FEull),X(0xFFD6FE39E5ull),
-	X(0xFFD76FB3FCull),X(0xFFD7E09041ull),X(0xFFD850CEB6ull),X(0xFFD8C06F59ull),X(0xFFD92F722Aull),X(0xFFD99DD729ull),X(0xFFDA0B9E57ull),X(0xFFDA78C7B1ull),
-	X(0xFFDAE55339ull),X(0xFFDB5140EEull),X(0xFFDBBC90CFull),X(0xFFDC2742DDull),X(0xFFDC915718ull),X(0xFFDCFACD7Eull),X(0xFFDD63A610ull),X(0xFFDDCBE0CDull),
-	X(0xFFDE337DB6ull),X(0xFFDE9A7CC9ull),X(0xFFDF00DE08ull),X(0xFFDF66A170ull),X(0xFFDFCBC703ull),X(0xFFE0304EC0ull),X(0xFFE09438A7ull),X(0xFFE0F784B7ull),
-	X(0xFFE15A32F0ull),X(0xFFE1BC4352ull),X(0xFFE21DB5DDull),X(0xFFE27E8A91ull),X(0xFFE2DEC16Dull),X(0xFFE33E5A71ull),X(0xFFE39D559Dull),X(0xFFE3FBB2F0ull),
-	X(0xFFE459726Bull),X(0xFFE4B6940Dull),X(0xFFE51317D6ull),X(0xFFE56EFDC5ull),X(0xFFE5CA45DBull),X(0xFFE624F018ull),X(0xFFE67EFC7Aull),X(0xFFE6D86B02ull),
-	X(0xFFE7313BB0ull),X(0xFFE7896E84ull),X(0xFFE7E1037Cull),X(0xFFE837FA99ull),X(0xFFE88E53DCull),X(0xFFE8E40F42ull),X(0xFFE9392CCEull),X(0xFFE98DAC7Dull),
-	X(0xFFE9E18E50ull),X(0xFFEA34D247ull),X(0xFFEA877862ull),X(0xFFEAD9809Full),X(0xFFEB2AEB00ull),X(0xFFEB7BB784ull),X(0xFFEBCBE62Bull),X(0xFFEC1B76F4ull),
-	X(0xFFEC6A69E0ull),X(0xFFECB8BEEEull),X(0xFFED06761Eull),X(0xFFED538F6Full),X(0xFFEDA00AE3ull),X(0xFFEDEBE877ull),X(0xFFEE37282Dull),X(0xFFEE81CA04ull),
-	X(0xFFEECBCDFCull),X(0xFFEF153415ull),X(0xFFEF5DFC4Eull),X(0xFFEFA626A7ull),X(0xFFEFEDB321ull),X(0xFFF034A1BBull),X(0xFFF07AF274ull),X(0xFFF0C0A54Dull),
-	X(0xFFF105BA46ull),X(0xFFF14A315Eull),X(0xFFF18E0A95ull),X(0xFFF1D145ECull),X(0xFFF213E361ull),X(0xFFF255E2F5ull),X(0xFFF29744A7ull),X(0xFFF2D80878ull),
-	X(0xFFF3182E66ull),X(0xFFF357B673ull),X(0xFFF396A09Eull),X(0xFFF3D4ECE7ull),X(0xFFF4129B4Dull),X(0xFFF44FABD1ull),X(0xFFF48C1E72ull),X(0xFFF4C7F330ull),
-	X(0xFFF5032A0Bull),X(0xFFF53DC303ull),X(0xFFF577BE18ull),X(0xFFF5B11B4Aull),X(0xFFF5E9DA97ull),X(0xFFF621FC02ull),X(0xFFF6597F88ull),X(0xFFF690652Aull),
-	X(0xFFF6C6ACE9ull),X(0xFFF6FC56C3ull),X(0xFFF73162B9ull),X(0xFFF765D0CAull),X(0xFFF799A0F7ull),X(0xFFF7CCD33Full),X(0xFFF7FF67A2ull),X(0xFFF8315E20ull),
-	X(0xFFF862B6B9ull),X(0xFFF893716Dull),X(0xFFF8C38E3Cull),X(0xFFF8F30D25ull),X(0xFFF921EE29ull),X(0xFFF9503147ull),X(0xFFF97DD67Full),X(0xFFF9AADDD1ull),
-	X(0xFFF9D7473Dull),X(0xFFFA0312C4ull),X(0xFFFA2E4064ull),X(0xFFFA58D01Dull),X(0xFFFA82C1F1ull),X(0xFFFAAC15DDull),X(0xFFFAD4CBE3ull),X(0xFFFAFCE403ull),
-	X(0xFFFB245E3Cull),X(0xFFFB4B3A8Dull),X(0xFFFB7178F8ull),X(0xFFFB97197Cull),X(0xFFFBBC1C18ull),X(0xFFFBE080CDull),X(0xFFFC04479Bull),X(0xFFFC277082ull),
-	X(0xFFFC49FB80ull),X(0xFFFC6BE898ull),X(0xFFFC8D37C7ull),X(0xFFFCADE90Full),X(0xFFFCCDFC6Full),X(0xFFFCED71E7ull),X(0xFFFD0C4977ull),X(0xFFFD2A831Full),
-	X(0xFFFD481EDFull),X(0xFFFD651CB6ull),X(0xFFFD817CA6ull),X(0xFFFD9D3EACull),X(0xFFFDB862CBull),X(0xFFFDD2E901ull),X(0xFFFDECD14Eull),X(0xFFFE061BB3ull),
-	X(0xFFFE1EC82Full),X(0xFFFE36D6C3ull),X(0xFFFE4E476Dull),X(0xFFFE651A2Full),X(0xFFFE7B4F08ull),X(0xFFFE90E5F8ull),X(0xFFFEA5DEFFull),X(0xFFFEBA3A1Cull),
-	X(0xFFFECDF751ull),X(0xFFFEE1169Dull),X(0xFFFEF397FFull),X(0xFFFF057B78ull),X(0xFFFF16C108ull),X(0xFFFF2768AEull),X(0xFFFF37726Bull),X(0xFFFF46DE3Full),
-	X(0xFFFF55AC29ull),X(0xFFFF63DC2Aull),X(0xFFFF716E41ull),X(0xFFFF7E626Eull),X(0xFFFF8AB8B2ull),X(0xFFFF96710Dull),X(0xFFFFA18B7Dull),X(0xFFFFAC0805ull),
-	X(0xFFFFB5E6A2ull),X(0xFFFFBF2756ull),X(0xFFFFC7CA1Full),X(0xFFFFCFCF00ull),X(0xFFFFD735F6ull),X(0xFFFFDDFF03ull),X(0xFFFFE42A25ull),X(0xFFFFE9B75Eull),
+#else
+# define FOURIER_SINTABLE_VALUES_4096(X)
+#endif
+
+#if FOURIER_SINTABLE_MAX_N >= 8192
+# define FOURIER_SINTABLE_VALUES_8192(X) \
+	X(0x0006487ED4ull),X(0x0012D97C7Aull),X(0x001F6A7A15ull),X(0x002BFB779Cull),X(0x00388C7507ull),X(0x00451D7250ull),X(0x0051AE6F6Full),X(0x005E3F6C5Aull), \
+	X(0x006AD0690Cull),X(0x007761657Cull),X(0x0083F261A2ull),X(0x0090835D77ull),X(0x009D1458F3ull),X(0x00A9A5540Eull),X(0x00B6364EC0ull),X(0x00C2C74902ull), \
+	X(0x00CF5842CBull),X(0x00DBE93C15ull),X(0x00E87A34D7ull),X(0x00F50B2D0Aull),X(0x01019C24A5ull),X(0x010E2D1BA2ull),X(0x011ABE11F8ull),X(0x01274F079Full), \
+	X(0x0133DFFC91ull),X(0x014070F0C4ull),X(0x014D01E432ull),X(0x015992D6D2ull),X(0x016623C89Dull),X(0x0172B4B98Cull),X(0x017F45A995ull),X(0x018BD698B2ull), \
+	X(0x01986786DBull),X(0x01A4F87409ull),X(0x01B1896032ull),X(0x01BE1A4B50ull),X(0x01CAAB355Bull),X(0x01D73C1E4Bull),X(0x01E3CD0618ull),X(0x01F05DECBBull), \
+	X(0x01FCEED22Bull),X(0x02097FB662ull),X(0x0216109957ull),X(0x0222A17B02ull),X(0x022F325B5Dull),X(0x023BC33A5Eull),X(0x02485417FFull),X(0x0254E4F437ull), \
+	X(0x026175CEFFull),X(0x026E06A84Full),X(0x027A978020ull),X(0x0287285669ull),X(0x0293B92B22ull),X(0x02A049FE45ull),X(0x02ACDACFC9ull),X(0x02B96B9FA7ull), \
+	X(0x02C5FC6DD6ull),X(0x02D28D3A50ull),X(0x02DF1E050Cull),X(0x02EBAECE02ull),X(0x02F83F952Bull),X(0x0304D05A7Full),X(0x0311611DF7ull),X(0x031DF1DF8Aull), \
+	X(0x032A829F31ull),X(0x0337135CE4ull),X(0x0343A4189Bull),X(0x035034D24Eull),X(0x035CC589F7ull),X(0x0369563F8Cull),X(0x0375E6F307ull),X(0x038277A45Full), \
+	X(0x038F08538Dull),X(0x039B990089ull),X(0x03A829AB4Cull),X(0x03B4BA53CDull),X(0x03C14AFA04ull),X(0x03CDDB9DEBull),X(0x03DA6C3F79ull),X(0x03E6FCDEA7ull), \
+	X(0x03F38D7B6Cull),X(0x04001E15C1ull),X(0x040CAEAD9Full),X(0x04193F42FDull),X(0x0425CFD5D4ull),X(0x043260661Cull),X(0x043EF0F3CDull),X(0x044B817EDFull), \
+	X(0x045812074Cull),X(0x0464A28D0Aull),X(0x0471331013ull),X(0x047DC3905Eull),X(0x048A540DE4ull),X(0x0496E4889Dull),X(0x04A3750082ull),X(0x04B0057589ull), \
+	X(0x04BC95E7ADull),X(0x04C92656E5ull),X(0x04D5B6C329ull),X(0x04E2472C71ull),X(0x04EED792B6ull),X(0x04FB67F5F0ull),X(0x0507F85618ull),X(0x051488B325ull), \
+	X(0x0521190D0Full),X(0x052DA963D0ull),X(0x053A39B75Full),X(0x0546CA07B5ull),X(0x05535A54C9ull),X(0x055FEA9E94ull),X(0x056C7AE50Full),X(0x05790B2831ull), \
+	X(0x05859B67F3ull),X(0x05922BA44Cull),X(0x059EBBDD37ull),X(0x05AB4C12A9ull),X(0x05B7DC449Dull),X(0x05C46C7309ull),X(0x05D0FC9DE7ull),X(0x05DD8CC52Eull), \
+	X(0x05EA1CE8D7ull),X(0x05F6AD08DAull),X(0x06033D252Full),X(0x060FCD3DCFull),X(0x061C5D52B1ull),X(0x0628ED63CFull),X(0x06357D7120ull),X(0x06420D7A9Cull), \
+	X(0x064E9D803Cull),X(0x065B2D81F9ull),X(0x0667BD7FC9ull),X(0x06744D79A6ull),X(0x0680DD6F88ull),X(0x068D6D6167ull),X(0x0699FD4F3Bull),X(0x06A68D38FCull), \
+	X(0x06B31D1EA3ull),X(0x06BFAD0029ull),X(0x06CC3CDD85ull),X(0x06D8CCB6AFull),X(0x06E55C8BA0ull),X(0x06F1EC5C50ull),X(0x06FE7C28B7ull),X(0x070B0BF0CEull), \
+	X(0x07179BB48Dull),X(0x07242B73EBull),X(0x0730BB2EE2ull),X(0x073D4AE56Aull),X(0x0749DA977Aull),X(0x07566A450Cull),X(0x0762F9EE16ull),X(0x076F899292ull), \
+	X(0x077C193278ull),X(0x0788A8CDC0ull),X(0x0795386463ull),X(0x07A1C7F658ull),X(0x07AE578398ull),X(0x07BAE70C1Aull),X(0x07C7768FD9ull),X(0x07D4060ECAull), \
+	X(0x07E09588E8ull),X(0x07ED24FE29ull),X(0x07F9B46E87ull),X(0x080643D9FAull),X(0x0812D34079ull),X(0x081F62A1FDull),X(0x082BF1FE7Full),X(0x08388155F6ull), \
+	X(0x084510A85Bull),X(0x08519FF5A7ull),X(0x085E2F3DD0ull),X(0x086ABE80D0ull),X(0x08774DBE9Full),X(0x0883DCF735ull),X(0x08906C2A8Bull),X(0x089CFB5898ull), \
+	X(0x08A98A8155ull),X(0x08B619A4BAull),X(0x08C2A8C2BFull),X(0x08CF37DB5Dull),X(0x08DBC6EE8Cull),X(0x08E855FC44ull),X(0x08F4E5047Dull),X(0x0901740730ull), \
+	X(0x090E030455ull),X(0x091A91FBE4ull),X(0x092720EDD6ull),X(0x0933AFDA22ull),X(0x09403EC0C1ull),X(0x094CCDA1ABull),X(0x09595C7CD8ull),X(0x0965EB5241ull), \
+	X(0x09727A21DEull),X(0x097F08EBA7ull),X(0x098B97AF95ull),X(0x0998266D9Full),X(0x09A4B525BEull),X(0x09B143D7EBull),X(0x09BDD2841Dull),X(0x09CA612A4Cull), \
+	X(0x09D6EFCA72ull),X(0x09E37E6485ull),X(0x09F00CF87Full),X(0x09FC9B8658ull),X(0x0A092A0E08ull),X(0x0A15B88F87ull),X(0x0A22470ACDull),X(0x0A2ED57FD3ull), \
+	X(0x0A3B63EE91ull),X(0x0A47F25700ull),X(0x0A5480B916ull),X(0x0A610F14CEull),X(0x0A6D9D6A1Eull),X(0x0A7A2BB900ull),X(0x0A86BA016Cull),X(0x0A93484359ull), \
+	X(0x0A9FD67EC0ull),X(0x0AAC64B399ull),X(0x0AB8F2E1DDull),X(0x0AC5810983ull),X(0x0AD20F2A85ull),X(0x0ADE9D44DAull),X(0x0AEB2B587Aull),X(0x0AF7B9655Full), \
+	X(0x0B04476B7Full),X(0x0B10D56AD4ull),X(0x0B1D636355ull),X(0x0B29F154FBull),X(0x0B367F3FBEull),X(0x0B430D2397ull),X(0x0B4F9B007Dull),X(0x0B5C28D668ull), \
+	X(0x0B68B6A552ull),X(0x0B75446D33ull),X(0x0B81D22E02ull),X(0x0B8E5FE7B8ull),X(0x0B9AED9A4Dull),X(0x0BA77B45B9ull),X(0x0BB408E9F5ull),X(0x0BC09686F9ull), \
+	X(0x0BCD241CBDull),X(0x0BD9B1AB39ull),X(0x0BE63F3266ull),X(0x0BF2CCB23Cull),X(0x0BFF5A2AB3ull),X(0x0C0BE79BC4ull),X(0x0C18750566ull),X(0x0C25026793ull), \
+	X(0x0C318FC241ull),X(0x0C3E1D156Aull),X(0x0C4AAA6106ull),X(0x0C5737A50Cull),X(0x0C63C4E176ull),X(0x0C7052163Cull),X(0x0C7CDF4355ull),X(0x0C896C68BAull), \
+	X(0x0C95F98663ull),X(0x0CA2869C49ull),X(0x0CAF13AA64ull),X(0x0CBBA0B0ACull),X(0x0CC82DAF19ull),X(0x0CD4BAA5A3ull),X(0x0CE1479444ull),X(0x0CEDD47AF2ull), \
+	X(0x0CFA6159A7ull),X(0x0D06EE305Aull),X(0x0D137AFF04ull),X(0x0D2007C59Eull),X(0x0D2C94841Full),X(0x0D39213A7Full),X(0x0D45ADE8B7ull),X(0x0D523A8EBFull), \
+	X(0x0D5EC72C90ull),X(0x0D6B53C222ull),X(0x0D77E04F6Cull),X(0x0D846CD467ull),X(0x0D90F9510Cull),X(0x0D9D85C553ull),X(0x0DAA123134ull),X(0x0DB69E94A6ull), \
+	X(0x0DC32AEFA4ull),X(0x0DCFB74224ull),X(0x0DDC438C1Full),X(0x0DE8CFCD8Dull),X(0x0DF55C0667ull),X(0x0E01E836A4ull),X(0x0E0E745E3Eull),X(0x0E1B007D2Cull), \
+	X(0x0E278C9366ull),X(0x0E3418A0E5ull),X(0x0E40A4A5A2ull),X(0x0E4D30A193ull),X(0x0E59BC94B3ull),X(0x0E66487EF8ull),X(0x0E72D4605Bull),X(0x0E7F6038D5ull), \
+	X(0x0E8BEC085Dull),X(0x0E9877CEECull),X(0x0EA5038C7Aull),X(0x0EB18F4100ull),X(0x0EBE1AEC75ull),X(0x0ECAA68ED3ull),X(0x0ED7322810ull),X(0x0EE3BDB826ull), \
+	X(0x0EF0493F0Dull),X(0x0EFCD4BCBCull),X(0x0F0960312Dull),X(0x0F15EB9C58ull),X(0x0F2276FE34ull),X(0x0F2F0256BAull),X(0x0F3B8DA5E3ull),X(0x0F4818EBA6ull), \
+	X(0x0F54A427FCull),X(0x0F612F5ADDull),X(0x0F6DBA8441ull),X(0x0F7A45A421ull),X(0x0F86D0BA75ull),X(0x0F935BC735ull),X(0x0F9FE6CA5Aull),X(0x0FAC71C3DBull), \
+	X(0x0FB8FCB3B1ull),X(0x0FC58799D4ull),X(0x0FD212763Cull),X(0x0FDE9D48E3ull),X(0x0FEB2811BFull),X(0x0FF7B2D0CAull),X(0x10043D85FBull),X(0x1010C8314Aull), \
+	X(0x101D52D2B1ull),X(0x1029DD6A27ull),X(0x103667F7A5ull),X(0x1042F27B23ull),X(0x104F7CF498ull),X(0x105C0763FEull),X(0x106891C94Dull),X(0x10751C247Cull), \
+	X(0x1081A67585ull),X(0x108E30BC5Full),X(0x109ABAF902ull),X(0x10A7452B68ull),X(0x10B3CF5388ull),X(0x10C059715Aull),X(0x10CCE384D7ull),X(0x10D96D8DF7ull), \
+	X(0x10E5F78CB2ull),X(0x10F2818101ull),X(0x10FF0B6ADBull),X(0x110B954A3Aull),X(0x11181F1F15ull),X(0x1124A8E964ull),X(0x113132A921ull),X(0x113DBC5E42ull), \
+	X(0x114A4608C1ull),X(0x1156CFA896ull),X(0x1163593DB8ull),X(0x116FE2C821ull),X(0x117C6C47C8ull),X(0x1188F5BCA6ull),X(0x11957F26B2ull),X(0x11A20885E6ull), \
+	X(0x11AE91DA3Aull),X(0x11BB1B23A5ull),X(0x11C7A46221ull),X(0x11D42D95A4ull),X(0x11E0B6BE29ull),X(0x11ED3FDBA6ull),X(0x11F9C8EE14ull),X(0x120651F56Cull), \
+	X(0x1212DAF1A5ull),X(0x121F63E2B8ull),X(0x122BECC89Eull),X(0x123875A34Eull),X(0x1244FE72C0ull),X(0x12518736EEull),X(0x125E0FEFCFull),X(0x126A989D5Bull), \
+	X(0x1277213F8Bull),X(0x1283A9D658ull),X(0x12903261B8ull),X(0x129CBAE1A5ull),X(0x12A9435618ull),X(0x12B5CBBF07ull),X(0x12C2541C6Bull),X(0x12CEDC6E3Eull), \
+	X(0x12DB64B476ull),X(0x12E7ECEF0Cull),X(0x12F4751DF9ull),X(0x1300FD4135ull),X(0x130D8558B8ull),X(0x131A0D647Aull),X(0x1326956474ull),X(0x13331D589Dull), \
+	X(0x133FA540EFull),X(0x134C2D1D61ull),X(0x1358B4EDEBull),X(0x13653CB287ull),X(0x1371C46B2Cull),X(0x137E4C17D2ull),X(0x138AD3B872ull),X(0x13975B4D04ull), \
+	X(0x13A3E2D580ull),X(0x13B06A51DFull),X(0x13BCF1C218ull),X(0x13C9792625ull),X(0x13D6007DFDull),X(0x13E287C999ull),X(0x13EF0F08F0ull),X(0x13FB963BFCull), \
+	X(0x14081D62B4ull),X(0x1414A47D11ull),X(0x14212B8B0Bull),X(0x142DB28C9Aull),X(0x143A3981B7ull),X(0x1446C06A5Aull),X(0x145347467Aull),X(0x145FCE1611ull), \
+	X(0x146C54D917ull),X(0x1478DB8F83ull),X(0x148562394Full),X(0x1491E8D672ull),X(0x149E6F66E5ull),X(0x14AAF5EAA0ull),X(0x14B77C619Bull),X(0x14C402CBCFull), \
+	X(0x14D0892933ull),X(0x14DD0F79C1ull),X(0x14E995BD70ull),X(0x14F61BF438ull),X(0x1502A21E13ull),X(0x150F283AF7ull),X(0x151BAE4ADEull),X(0x1528344DC0ull), \
+	X(0x1534BA4395ull),X(0x1541402C55ull),X(0x154DC607F9ull),X(0x155A4BD679ull),X(0x1566D197CCull),X(0x1573574BECull),X(0x157FDCF2D1ull),X(0x158C628C73ull), \
+	X(0x1598E818CAull),X(0x15A56D97CEull),X(0x15B1F30978ull),X(0x15BE786DC0ull),X(0x15CAFDC49Full),X(0x15D7830E0Cull),X(0x15E4084A00ull),X(0x15F08D7873ull), \
+	X(0x15FD12995Eull),X(0x160997ACB8ull),X(0x16161CB27Aull),X(0x1622A1AA9Dull),X(0x162F269518ull),X(0x163BAB71E4ull),X(0x16483040F9ull),X(0x1654B5024Full), \
+	X(0x166139B5DFull),X(0x166DBE5BA1ull),X(0x167A42F38Dull),X(0x1686C77D9Cull),X(0x16934BF9C5ull),X(0x169FD06802ull),X(0x16AC54C849ull),X(0x16B8D91A95ull), \
+	X(0x16C55D5EDCull),X(0x16D1E19517ull),X(0x16DE65BD3Full),X(0x16EAE9D74Bull),X(0x16F76DE335ull),X(0x1703F1E0F4ull),X(0x171075D080ull),X(0x171CF9B1D2ull), \
+	X(0x17297D84E2ull),X(0x17360149A9ull),X(0x174285001Eull),X(0x174F08A83Bull),X(0x175B8C41F6ull),X(0x17680FCD49ull),X(0x1774934A2Cull),X(0x178116B897ull), \
+	X(0x178D9A1882ull),X(0x179A1D69E6ull),X(0x17A6A0ACBBull),X(0x17B323E0F9ull),X(0x17BFA70698ull),X(0x17CC2A1D91ull),X(0x17D8AD25DDull),X(0x17E5301F72ull), \
+	X(0x17F1B30A4Bull),X(0x17FE35E65Eull),X(0x180AB8B3A4ull),X(0x18173B7216ull),X(0x1823BE21ABull),X(0x183040C25Dull),X(0x183CC35423ull),X(0x184945D6F5ull), \
+	X(0x1855C84ACCull),X(0x18624AAFA1ull),X(0x186ECD056Bull),X(0x187B4F4C22ull),X(0x1887D183C0ull),X(0x189453AC3Cull),X(0x18A0D5C58Full),X(0x18AD57CFB0ull), \
+	X(0x18B9D9CA98ull),X(0x18C65BB640ull),X(0x18D2DD92A0ull),X(0x18DF5F5FB0ull),X(0x18EBE11D68ull),X(0x18F862CBC0ull),X(0x1904E46AB1ull),X(0x191165FA34ull), \
+	X(0x191DE77A40ull),X(0x192A68EACEull),X(0x1936EA4BD5ull),X(0x19436B9D4Full),X(0x194FECDF34ull),X(0x195C6E117Bull),X(0x1968EF341Dull),X(0x1975704713ull), \
+	X(0x1981F14A55ull),X(0x198E723DDBull),X(0x199AF3219Dull),X(0x19A773F593ull),X(0x19B3F4B9B6ull),X(0x19C0756DFFull),X(0x19CCF61265ull),X(0x19D976A6E1ull), \
+	X(0x19E5F72B6Aull),X(0x19F2779FFAull),X(0x19FEF80489ull),X(0x1A0B78590Eull),X(0x1A17F89D83ull),X(0x1A2478D1DFull),X(0x1A30F8F61Bull),X(0x1A3D790A2Full), \
+	X(0x1A49F90E13ull),X(0x1A567901C0ull),X(0x1A62F8E52Eull),X(0x1A6F78B855ull),X(0x1A7BF87B2Dull),X(0x1A88782DAFull),X(0x1A94F7CFD3ull),X(0x1AA1776192ull), \
+	X(0x1AADF6E2E3ull),X(0x1ABA7653C0ull),X(0x1AC6F5B41Full),X(0x1AD37503FAull),X(0x1ADFF44349ull),X(0x1AEC737203ull),X(0x1AF8F29023ull),X(0x1B05719D9Full), \
+	X(0x1B11F09A6Full),X(0x1B1E6F868Eull),X(0x1B2AEE61F1ull),X(0x1B376D2C93ull),X(0x1B43EBE66Aull),X(0x1B506A8F71ull),X(0x1B5CE9279Dull),X(0x1B6967AEE9ull), \
+	X(0x1B75E6254Cull),X(0x1B82648ABFull),X(0x1B8EE2DF3Aull),X(0x1B9B6122B5ull),X(0x1BA7DF5528ull),X(0x1BB45D768Cull),X(0x1BC0DB86DAull),X(0x1BCD598608ull), \
+	X(0x1BD9D77410ull),X(0x1BE65550EBull),X(0x1BF2D31C8Full),X(0x1BFF50D6F6ull),X(0x1C0BCE8018ull),X(0x1C184C17EDull),X(0x1C24C99E6Dull),X(0x1C31471391ull), \
+	X(0x1C3DC47751ull),X(0x1C4A41C9A6ull),X(0x1C56BF0A87ull),X(0x1C633C39EDull),X(0x1C6FB957D0ull),X(0x1C7C366429ull),X(0x1C88B35EEFull),X(0x1C9530481Cull), \
+	X(0x1CA1AD1FA7ull),X(0x1CAE29E588ull),X(0x1CBAA699B9ull),X(0x1CC7233C31ull),X(0x1CD39FCCE8ull),X(0x1CE01C4BD8ull),X(0x1CEC98B8F7ull),X(0x1CF915143Full), \
+	X(0x1D05915DA8ull),X(0x1D120D952Aull),X(0x1D1E89BABDull),X(0x1D2B05CE5Aull),X(0x1D3781CFF9ull),X(0x1D43FDBF92ull),X(0x1D50799D1Eull),X(0x1D5CF56894ull), \
+	X(0x1D697121EEull),X(0x1D75ECC923ull),X(0x1D82685E2Cull),X(0x1D8EE3E101ull),X(0x1D9B5F519Aull),X(0x1DA7DAAFF0ull),X(0x1DB455FBFBull),X(0x1DC0D135B3ull), \
+	X(0x1DCD4C5D11ull),X(0x1DD9C7720Dull),X(0x1DE642749Full),X(0x1DF2BD64BFull),X(0x1DFF384266ull),X(0x1E0BB30D8Cull),X(0x1E182DC62Aull),X(0x1E24A86C37ull), \
+	X(0x1E3122FFACull),X(0x1E3D9D8082ull),X(0x1E4A17EEB0ull),X(0x1E56924A2Eull),X(0x1E630C92F7ull),X(0x1E6F86C900ull),X(0x1E7C00EC44ull),X(0x1E887AFCB9ull), \
+	X(0x1E94F4FA59ull),X(0x1EA16EE51Cull),X(0x1EADE8BCF9ull),X(0x1EBA6281EAull),X(0x1EC6DC33E7ull),X(0x1ED355D2E7ull),X(0x1EDFCF5EE4ull),X(0x1EEC48D7D5ull), \
+	X(0x1EF8C23DB3ull),X(0x1F053B9076ull),X(0x1F11B4D017ull),X(0x1F1E2DFC8Dull),X(0x1F2AA715D2ull),X(0x1F37201BDDull),X(0x1F43990EA6ull),X(0x1F5011EE26ull), \
+	X(0x1F5C8ABA56ull),X(0x1F6903732Eull),X(0x1F757C18A5ull),X(0x1F81F4AAB4ull),X(0x1F8E6D2954ull),X(0x1F9AE5947Dull),X(0x1FA75DEC27ull),X(0x1FB3D6304Aull), \
+	X(0x1FC04E60DFull),X(0x1FCCC67DDFull),X(0x1FD93E8740ull),X(0x1FE5B67CFCull),X(0x1FF22E5F0Bull),X(0x1FFEA62D66ull),X(0x200B1DE804ull),X(0x2017958EDEull), \
+	X(0x20240D21ECull),X(0x203084A127ull),X(0x203CFC0C86ull),X(0x2049736403ull),X(0x2055EAA795ull),X(0x206261D735ull),X(0x206ED8F2DBull),X(0x207B4FFA7Full), \
+	X(0x2087C6EE1Aull),X(0x20943DCDA4ull),X(0x20A0B49916ull),X(0x20AD2B5067ull),X(0x20B9A1F390ull),X(0x20C6188289ull),X(0x20D28EFD4Bull),X(0x20DF0563CDull), \
+	X(0x20EB7BB609ull),X(0x20F7F1F3F6ull),X(0x2104681D8Eull),X(0x2110DE32C7ull),X(0x211D54339Bull),X(0x2129CA2001ull),X(0x21363FF7F3ull),X(0x2142B5BB68ull), \
+	X(0x214F2B6A58ull),X(0x215BA104BDull),X(0x2168168A8Eull),X(0x21748BFBC4ull),X(0x2181015856ull),X(0x218D76A03Eull),X(0x2199EBD373ull),X(0x21A660F1EFull), \
+	X(0x21B2D5FBA8ull),X(0x21BF4AF098ull),X(0x21CBBFD0B7ull),X(0x21D8349BFEull),X(0x21E4A95263ull),X(0x21F11DF3E1ull),X(0x21FD92806Eull),X(0x220A06F804ull), \
+	X(0x22167B5A9Bull),X(0x2222EFA82Aull),X(0x222F63E0ACull),X(0x223BD80416ull),X(0x22484C1263ull),X(0x2254C00B8Bull),X(0x226133EF84ull),X(0x226DA7BE49ull), \
+	X(0x227A1B77D1ull),X(0x22868F1C15ull),X(0x229302AB0Dull),X(0x229F7624B1ull),X(0x22ABE988F9ull),X(0x22B85CD7DFull),X(0x22C4D01159ull),X(0x22D1433561ull), \
+	X(0x22DDB643EFull),X(0x22EA293CFCull),X(0x22F69C207Eull),X(0x23030EEE70ull),X(0x230F81A6C8ull),X(0x231BF44980ull),X(0x232866D690ull),X(0x2334D94DF0ull), \
+	X(0x23414BAF99ull),X(0x234DBDFB82ull),X(0x235A3031A4ull),X(0x2366A251F7ull),X(0x2373145C75ull),X(0x237F865114ull),X(0x238BF82FCEull),X(0x239869F89Aull), \
+	X(0x23A4DBAB71ull),X(0x23B14D484Cull),X(0x23BDBECF22ull),X(0x23CA303FEDull),X(0x23D6A19AA3ull),X(0x23E312DF3Eull),X(0x23EF840DB7ull),X(0x23FBF52604ull), \
+	X(0x240866281Full),X(0x2414D71400ull),X(0x242147E99Full),X(0x242DB8A8F5ull),X(0x243A2951FAull),X(0x244699E4A6ull),X(0x24530A60F1ull),X(0x245F7AC6D5ull), \
+	X(0x246BEB1649ull),X(0x24785B4F45ull),X(0x2484CB71C2ull),X(0x24913B7DB8ull),X(0x249DAB7320ull),X(0x24AA1B51F1ull),X(0x24B68B1A25ull),X(0x24C2FACBB3ull), \
+	X(0x24CF6A6694ull),X(0x24DBD9EAC1ull),X(0x24E8495830ull),X(0x24F4B8AEDCull),X(0x250127EEBCull),X(0x250D9717C8ull),X(0x251A0629F9ull),X(0x2526752547ull), \
+	X(0x2532E409ABull),X(0x253F52D71Cull),X(0x254BC18D94ull),X(0x2558302D0Aull),X(0x25649EB577ull),X(0x25710D26D3ull),X(0x257D7B8116ull),X(0x2589E9C439ull), \
+	X(0x259657F034ull),X(0x25A2C60500ull),X(0x25AF340295ull),X(0x25BBA1E8EAull),X(0x25C80FB7FAull),X(0x25D47D6FBBull),X(0x25E0EB1026ull),X(0x25ED589933ull), \
+	X(0x25F9C60ADBull),X(0x2606336517ull),X(0x2612A0A7DEull),X(0x261F0DD328ull),X(0x262B7AE6EFull),X(0x2637E7E32Aull),X(0x264454C7D2ull),X(0x2650C194E0ull), \
+	X(0x265D2E4A4Aull),X(0x26699AE80Bull),X(0x2676076E19ull),X(0x268273DC6Eull),X(0x268EE03302ull),X(0x269B4C71CDull),X(0x26A7B898C8ull),X(0x26B424A7EAull), \
+	X(0x26C0909F2Cull),X(0x26CCFC7E87ull),X(0x26D96845F3ull),X(0x26E5D3F568ull),X(0x26F23F8CDFull),X(0x26FEAB0C4Full),X(0x270B1673B1ull),X(0x271781C2FFull), \
+	X(0x2723ECFA2Eull),X(0x273058193Aull),X(0x273CC32018ull),X(0x27492E0EC3ull),X(0x275598E532ull),X(0x276203A35Dull),X(0x276E6E493Dull),X(0x277AD8D6CBull), \
+	X(0x2787434BFEull),X(0x2793ADA8CFull),X(0x27A017ED36ull),X(0x27AC82192Cull),X(0x27B8EC2CA9ull),X(0x27C55627A5ull),X(0x27D1C00A19ull),X(0x27DE29D3FDull), \
+	X(0x27EA938549ull),X(0x27F6FD1DF5ull),X(0x2803669DFBull),X(0x280FD00552ull),X(0x281C3953F3ull),X(0x2828A289D6ull),X(0x28350BA6F3ull),X(0x284174AB43ull), \
+	X(0x284DDD96BEull),X(0x285A46695Dull),X(0x2866AF2317ull),X(0x287317C3E6ull),X(0x287F804BC0ull),X(0x288BE8BAA0ull),X(0x289851107Dull),X(0x28A4B94D4Full), \
+	X(0x28B121710Full),X(0x28BD897BB6ull),X(0x28C9F16D3Aull),X(0x28D6594596ull),X(0x28E2C104C1ull),X(0x28EF28AAB4ull),X(0x28FB903766ull),X(0x2907F7AAD1ull), \
+	X(0x29145F04ECull),X(0x2920C645B1ull),X(0x292D2D6D16ull),X(0x2939947B16ull),X(0x2945FB6FA7ull),X(0x2952624AC3ull),X(0x295EC90C61ull),X(0x296B2FB47Bull), \
+	X(0x2977964308ull),X(0x2983FCB801ull),X(0x299063135Dull),X(0x299CC95517ull),X(0x29A92F7D25ull),X(0x29B5958B80ull),X(0x29C1FB8021ull),X(0x29CE615B00ull), \
+	X(0x29DAC71C15ull),X(0x29E72CC358ull),X(0x29F39250C3ull),X(0x29FFF7C44Dull),X(0x2A0C5D1DEEull),X(0x2A18C25DA0ull),X(0x2A25278359ull),X(0x2A318C8F14ull), \
+	X(0x2A3DF180C7ull),X(0x2A4A56586Cull),X(0x2A56BB15FBull),X(0x2A631FB96Cull),X(0x2A6F8442B7ull),X(0x2A7BE8B1D6ull),X(0x2A884D06BFull),X(0x2A94B1416Cull), \
+	X(0x2AA11561D5ull),X(0x2AAD7967F2ull),X(0x2AB9DD53BCull),X(0x2AC641252Aull),X(0x2AD2A4DC36ull),X(0x2ADF0878D8ull),X(0x2AEB6BFB08ull),X(0x2AF7CF62BEull), \
+	X(0x2B0432AFF3ull),X(0x2B1095E29Full),X(0x2B1CF8FABBull),X(0x2B295BF83Eull),X(0x2B35BEDB21ull),X(0x2B4221A35Eull),X(0x2B4E8450EBull),X(0x2B5AE6E3C1ull), \
+	X(0x2B67495BD9ull),X(0x2B73ABB92Bull),X(0x2B800DFBAFull),X(0x2B8C70235Eull),X(0x2B98D23031ull),X(0x2BA534221Eull),X(0x2BB195F91Full),X(0x2BBDF7B52Dull), \
+	X(0x2BCA59563Full),X(0x2BD6BADC4Eull),X(0x2BE31C4752ull),X(0x2BEF7D9744ull),X(0x2BFBDECC1Cull),X(0x2C083FE5D2ull),X(0x2C14A0E45Full),X(0x2C2101C7BBull), \
+	X(0x2C2D628FDFull),X(0x2C39C33CC2ull),X(0x2C4623CE5Dull),X(0x2C528444A9ull),X(0x2C5EE49F9Eull),X(0x2C6B44DF34ull),X(0x2C77A50364ull),X(0x2C84050C25ull), \
+	X(0x2C9064F971ull),X(0x2C9CC4CB40ull),X(0x2CA924818Aull),X(0x2CB5841C47ull),X(0x2CC1E39B71ull),X(0x2CCE42FEFEull),X(0x2CDAA246E8ull),X(0x2CE7017327ull), \
+	X(0x2CF36083B3ull),X(0x2CFFBF7885ull),X(0x2D0C1E5195ull),X(0x2D187D0EDBull),X(0x2D24DBB050ull),X(0x2D313A35ECull),X(0x2D3D989FA8ull),X(0x2D49F6ED7Cull), \
+	X(0x2D56551F60ull),X(0x2D62B3354Cull),X(0x2D6F112F3Aull),X(0x2D7B6F0D21ull),X(0x2D87CCCEF9ull),X(0x2D942A74BCull),X(0x2DA087FE61ull),X(0x2DACE56BE1ull), \
+	X(0x2DB942BD35ull),X(0x2DC59FF254ull),X(0x2DD1FD0B37ull),X(0x2DDE5A07D6ull),X(0x2DEAB6E82Aull),X(0x2DF713AC2Bull),X(0x2E037053D2ull),X(0x2E0FCCDF16ull), \
+	X(0x2E1C294DF1ull),X(0x2E2885A05Aull),X(0x2E34E1D64Aull),X(0x2E413DEFBAull),X(0x2E4D99ECA1ull),X(0x2E59F5CCF9ull),X(0x2E665190B8ull),X(0x2E72AD37D9ull), \
+	X(0x2E7F08C253ull),X(0x2E8B64301Full),X(0x2E97BF8134ull),X(0x2EA41AB58Cull),X(0x2EB075CD1Full),X(0x2EBCD0C7E5ull),X(0x2EC92BA5D6ull),X(0x2ED58666EBull), \
+	X(0x2EE1E10B1Dull),X(0x2EEE3B9263ull),X(0x2EFA95FCB6ull),X(0x2F06F04A0Eull),X(0x2F134A7A65ull),X(0x2F1FA48DB1ull),X(0x2F2BFE83ECull),X(0x2F38585D0Eull), \
+	X(0x2F44B2190Full),X(0x2F510BB7E8ull),X(0x2F5D653991ull),X(0x2F69BE9E03ull),X(0x2F7617E535ull),X(0x2F82710F20ull),X(0x2F8ECA1BBDull),X(0x2F9B230B04ull), \
+	X(0x2FA77BDCEEull),X(0x2FB3D49172ull),X(0x2FC02D2889ull),X(0x2FCC85A22Cull),X(0x2FD8DDFE52ull),X(0x2FE5363CF5ull),X(0x2FF18E5E0Dull),X(0x2FFDE66192ull), \
+	X(0x300A3E477Cull),X(0x3016960FC4ull),X(0x3022EDBA62ull),X(0x302F45474Eull),X(0x303B9CB682ull),X(0x3047F407F5ull),X(0x30544B3BA0ull),X(0x3060A2517Bull), \
+	X(0x306CF9497Full),X(0x30795023A3ull),X(0x3085A6DFE1ull),X(0x3091FD7E30ull),X(0x309E53FE8Aull),X(0x30AAAA60E6ull),X(0x30B700A53Dull),X(0x30C356CB87ull), \
+	X(0x30CFACD3BDull),X(0x30DC02BDD7ull),X(0x30E85889CDull),X(0x30F4AE3798ull),X(0x310103C730ull),X(0x310D59388Eull),X(0x3119AE8BAAull),X(0x312603C07Dull), \
+	X(0x313258D6FEull),X(0x313EADCF26ull),X(0x314B02A8EEull),X(0x315757644Dull),X(0x3163AC013Eull),X(0x3170007FB7ull),X(0x317C54DFB1ull),X(0x3188A92124ull), \
+	X(0x3194FD440Aull),X(0x31A1514859ull),X(0x31ADA52E0Cull),X(0x31B9F8F51Aull),X(0x31C64C9D7Bull),X(0x31D2A02728ull),X(0x31DEF39219ull),X(0x31EB46DE47ull), \
+	X(0x31F79A0BABull),X(0x3203ED1A3Bull),X(0x32104009F2ull),X(0x321C92DAC7ull),X(0x3228E58CB2ull),X(0x3235381FADull),X(0x32418A93AFull),X(0x324DDCE8B1ull), \
+	X(0x325A2F1EABull),X(0x3266813596ull),X(0x3272D32D6Bull),X(0x327F250620ull),X(0x328B76BFB0ull),X(0x3297C85A11ull),X(0x32A419D53Eull),X(0x32B06B312Dull), \
+	X(0x32BCBC6DD8ull),X(0x32C90D8B37ull),X(0x32D55E8942ull),X(0x32E1AF67F2ull),X(0x32EE00273Full),X(0x32FA50C722ull),X(0x3306A14792ull),X(0x3312F1A889ull), \
+	X(0x331F41E9FFull),X(0x332B920BEBull),X(0x3337E20E47ull),X(0x334431F10Bull),X(0x335081B430ull),X(0x335CD157ADull),X(0x336920DB7Bull),X(0x3375703F93ull), \
+	X(0x3381BF83EDull),X(0x338E0EA881ull),X(0x339A5DAD48ull),X(0x33A6AC923Aull),X(0x33B2FB5750ull),X(0x33BF49FC81ull),X(0x33CB9881C7ull),X(0x33D7E6E71Aull), \
+	X(0x33E4352C72ull),X(0x33F08351C8ull),X(0x33FCD15714ull),X(0x34091F3C4Eull),X(0x34156D016Full),X(0x3421BAA670ull),X(0x342E082B48ull),X(0x343A558FF0ull), \
+	X(0x3446A2D461ull),X(0x3452EFF892ull),X(0x345F3CFC7Dull),X(0x346B89E01Aull),X(0x3477D6A361ull),X(0x348423464Aull),X(0x34906FC8CFull),X(0x349CBC2AE6ull), \
+	X(0x34A9086C8Aull),X(0x34B5548DB2ull),X(0x34C1A08E56ull),X(0x34CDEC6E70ull),X(0x34DA382DF7ull),X(0x34E683CCE4ull),X(0x34F2CF4B2Full),X(0x34FF1AA8D0ull), \
+	X(0x350B65E5C1ull),X(0x3517B101FAull),X(0x3523FBFD72ull),X(0x353046D823ull),X(0x353C919205ull),X(0x3548DC2B10ull),X(0x355526A33Cull),X(0x356170FA83ull), \
+	X(0x356DBB30DCull),X(0x357A054640ull),X(0x35864F3AA7ull),X(0x3592990E0Aull),X(0x359EE2C061ull),X(0x35AB2C51A5ull),X(0x35B775C1CDull),X(0x35C3BF10D3ull), \
+	X(0x35D0083EAFull),X(0x35DC514B59ull),X(0x35E89A36CAull),X(0x35F4E300FAull),X(0x36012BA9E1ull),X(0x360D743179ull),X(0x3619BC97B8ull),X(0x362604DC99ull), \
+	X(0x36324D0013ull),X(0x363E95021Eull),X(0x364ADCE2B3ull),X(0x365724A1CBull),X(0x36636C3F5Eull),X(0x366FB3BB64ull),X(0x367BFB15D6ull),X(0x3688424EACull), \
+	X(0x36948965DFull),X(0x36A0D05B66ull),X(0x36AD172F3Cull),X(0x36B95DE157ull),X(0x36C5A471B0ull),X(0x36D1EAE040ull),X(0x36DE312D00ull),X(0x36EA7757E6ull), \
+	X(0x36F6BD60EDull),X(0x370303480Dull),X(0x370F490D3Dull),X(0x371B8EB077ull),X(0x3727D431B2ull),X(0x37341990E8ull),X(0x37405ECE10ull),X(0x374CA3E923ull), \
+	X(0x3758E8E21Aull),X(0x37652DB8ECull),X(0x3771726D93ull),X(0x377DB70007ull),X(0x3789FB7040ull),X(0x37963FBE36ull),X(0x37A283E9E3ull),X(0x37AEC7F33Eull), \
+	X(0x37BB0BDA40ull),X(0x37C74F9EE1ull),X(0x37D393411Aull),X(0x37DFD6C0E4ull),X(0x37EC1A1E36ull),X(0x37F85D5909ull),X(0x3804A07156ull),X(0x3810E36714ull), \
+	X(0x381D263A3Eull),X(0x382968EACAull),X(0x3835AB78B1ull),X(0x3841EDE3ECull),X(0x384E302C73ull),X(0x385A72523Full),X(0x3866B45548ull),X(0x3872F63586ull), \
+	X(0x387F37F2F2ull),X(0x388B798D85ull),X(0x3897BB0536ull),X(0x38A3FC59FFull),X(0x38B03D8BD7ull),X(0x38BC7E9AB7ull),X(0x38C8BF8698ull),X(0x38D5004F72ull), \
+	X(0x38E140F53Eull),X(0x38ED8177F3ull),X(0x38F9C1D78Bull),X(0x39060213FDull),X(0x3912422D43ull),X(0x391E822354ull),X(0x392AC1F62Aull),X(0x393701A5BBull), \
+	X(0x3943413202ull),X(0x394F809AF7ull),X(0x395BBFE091ull),X(0x3967FF02CAull),X(0x39743E0199ull),X(0x39807CDCF7ull),X(0x398CBB94DEull),X(0x3998FA2944ull), \
+	X(0x39A5389A23ull),X(0x39B176E773ull),X(0x39BDB5112Cull),X(0x39C9F31747ull),X(0x39D630F9BDull),X(0x39E26EB885ull),X(0x39EEAC5399ull),X(0x39FAE9CAF0ull), \
+	X(0x3A07271E84ull),X(0x3A13644E4Cull),X(0x3A1FA15A41ull),X(0x3A2BDE425Cull),X(0x3A381B0694ull),X(0x3A4457A6E3ull),X(0x3A50942341ull),X(0x3A5CD07BA6ull), \
+	X(0x3A690CB00Bull),X(0x3A7548C068ull),X(0x3A8184ACB6ull),X(0x3A8DC074EDull),X(0x3A99FC1905ull),X(0x3AA63798F7ull),X(0x3AB272F4BCull),X(0x3ABEAE2C4Cull), \
+	X(0x3ACAE93F9Full),X(0x3AD7242EAEull),X(0x3AE35EF972ull),X(0x3AEF999FE2ull),X(0x3AFBD421F7ull),X(0x3B080E7FAAull),X(0x3B1448B8F3ull),X(0x3B2082CDCBull), \
+	X(0x3B2CBCBE2Aull),X(0x3B38F68A08ull),X(0x3B4530315Eull),X(0x3B5169B425ull),X(0x3B5DA31254ull),X(0x3B69DC4BE5ull),X(0x3B761560D0ull),X(0x3B824E510Dull), \
+	X(0x3B8E871C94ull),X(0x3B9ABFC35Full),X(0x3BA6F84565ull),X(0x3BB330A2A0ull),X(0x3BBF68DB07ull),X(0x3BCBA0EE93ull),X(0x3BD7D8DD3Cull),X(0x3BE410A6FCull), \
+	X(0x3BF0484BCAull),X(0x3BFC7FCB9Full),X(0x3C08B72673ull),X(0x3C14EE5C3Full),X(0x3C21256CFBull),X(0x3C2D5C58A0ull),X(0x3C39931F26ull),X(0x3C45C9C086ull), \
+	X(0x3C52003CB8ull),X(0x3C5E3693B4ull),X(0x3C6A6CC574ull),X(0x3C76A2D1EFull),X(0x3C82D8B91Eull),X(0x3C8F0E7AFAull),X(0x3C9B44177Aull),X(0x3CA7798E98ull), \
+	X(0x3CB3AEE04Cull),X(0x3CBFE40C8Eull),X(0x3CCC191357ull),X(0x3CD84DF49Full),X(0x3CE482B05Full),X(0x3CF0B7468Full),X(0x3CFCEBB728ull),X(0x3D09200222ull), \
+	X(0x3D15542776ull),X(0x3D2188271Cull),X(0x3D2DBC010Cull),X(0x3D39EFB540ull),X(0x3D462343AFull),X(0x3D5256AC52ull),X(0x3D5E89EF21ull),X(0x3D6ABD0C16ull), \
+	X(0x3D76F00327ull),X(0x3D8322D44Full),X(0x3D8F557F85ull),X(0x3D9B8804C2ull),X(0x3DA7BA63FEull),X(0x3DB3EC9D33ull),X(0x3DC01EB057ull),X(0x3DCC509D64ull), \
+	X(0x3DD8826452ull),X(0x3DE4B4051Aull),X(0x3DF0E57FB5ull),X(0x3DFD16D41Aull),X(0x3E09480242ull),X(0x3E15790A25ull),X(0x3E21A9EBBDull),X(0x3E2DDAA702ull), \
+	X(0x3E3A0B3BEBull),X(0x3E463BAA72ull),X(0x3E526BF28Full),X(0x3E5E9C143Bull),X(0x3E6ACC0F6Dull),X(0x3E76FBE41Full),X(0x3E832B9249ull),X(0x3E8F5B19E4ull), \
+	X(0x3E9B8A7AE7ull),X(0x3EA7B9B54Cull),X(0x3EB3E8C90Aull),X(0x3EC017B61Bull),X(0x3ECC467C77ull),X(0x3ED8751C17ull),X(0x3EE4A394F2ull),X(0x3EF0D1E701ull), \
+	X(0x3EFD00123Dull),X(0x3F092E169Full),X(0x3F155BF41Eull),X(0x3F2189AAB3ull),X(0x3F2DB73A58ull),X(0x3F39E4A303ull),X(0x3F4611E4AEull),X(0x3F523EFF52ull), \
+	X(0x3F5E6BF2E6ull),X(0x3F6A98BF63ull),X(0x3F76C564C2ull),X(0x3F82F1E2FBull),X(0x3F8F1E3A07ull),X(0x3F9B4A69DEull),X(0x3FA7767279ull),X(0x3FB3A253D0ull), \
+	X(0x3FBFCE0DDBull),X(0x3FCBF9A094ull),X(0x3FD8250BF2ull),X(0x3FE4504FEEull),X(0x3FF07B6C81ull),X(0x3FFCA661A3ull),X(0x4008D12F4Dull),X(0x4014FBD576ull), \
+	X(0x4021265419ull),X(0x402D50AB2Cull),X(0x40397ADAA9ull),X(0x4045A4E288ull),X(0x4051CEC2C1ull),X(0x405DF87B4Eull),X(0x406A220C26ull),X(0x40764B7542ull), \
+	X(0x408274B69Bull),X(0x408E9DD029ull),X(0x409AC6C1E4ull),X(0x40A6EF8BC6ull),X(0x40B3182DC6ull),X(0x40BF40A7DDull),X(0x40CB68FA03ull),X(0x40D7912432ull), \
+	X(0x40E3B92661ull),X(0x40EFE10089ull),X(0x40FC08B2A3ull),X(0x4108303CA7ull),X(0x4114579E8Dull),X(0x41207ED84Full),X(0x412CA5E9E4ull),X(0x4138CCD345ull), \
+	X(0x4144F3946Aull),X(0x41511A2D4Dull),X(0x415D409DE5ull),X(0x416966E62Cull),X(0x41758D0619ull),X(0x4181B2FDA5ull),X(0x418DD8CCC9ull),X(0x4199FE737Dull), \
+	X(0x41A623F1B9ull),X(0x41B2494777ull),X(0x41BE6E74AEull),X(0x41CA937957ull),X(0x41D6B8556Bull),X(0x41E2DD08E2ull),X(0x41EF0193B5ull),X(0x41FB25F5DCull), \
+	X(0x42074A2F50ull),X(0x42136E4009ull),X(0x421F922800ull),X(0x422BB5E72Cull),X(0x4237D97D88ull),X(0x4243FCEB0Bull),X(0x4250202FAEull),X(0x425C434B68ull), \
+	X(0x4268663E34ull),X(0x4274890809ull),X(0x4280ABA8E0ull),X(0x428CCE20B1ull),X(0x4298F06F75ull),X(0x42A5129524ull),X(0x42B13491B7ull),X(0x42BD566527ull), \
+	X(0x42C9780F6Bull),X(0x42D599907Dull),X(0x42E1BAE855ull),X(0x42EDDC16EBull),X(0x42F9FD1C39ull),X(0x43061DF835ull),X(0x43123EAADAull),X(0x431E5F341Full), \
+	X(0x432A7F93FEull),X(0x43369FCA6Eull),X(0x4342BFD768ull),X(0x434EDFBAE4ull),X(0x435AFF74DCull),X(0x43671F0547ull),X(0x43733E6C1Full),X(0x437F5DA95Bull), \
+	X(0x438B7CBCF5ull),X(0x43979BA6E4ull),X(0x43A3BA6721ull),X(0x43AFD8FDA6ull),X(0x43BBF76A69ull),X(0x43C815AD65ull),X(0x43D433C690ull),X(0x43E051B5E5ull), \
+	X(0x43EC6F7B5Bull),X(0x43F88D16EBull),X(0x4404AA888Eull),X(0x4410C7D03Bull),X(0x441CE4EDECull),X(0x442901E199ull),X(0x44351EAB3Bull),X(0x44413B4AC9ull), \
+	X(0x444D57C03Eull),X(0x4459740B90ull),X(0x4465902CB9ull),X(0x4471AC23B2ull),X(0x447DC7F072ull),X(0x4489E392F3ull),X(0x4495FF0B2Cull),X(0x44A21A5916ull), \
+	X(0x44AE357CABull),X(0x44BA5075E2ull),X(0x44C66B44B4ull),X(0x44D285E919ull),X(0x44DEA0630Aull),X(0x44EABAB280ull),X(0x44F6D4D773ull),X(0x4502EED1DCull), \
+	X(0x450F08A1B2ull),X(0x451B2246F0ull),X(0x45273BC18Cull),X(0x4533551181ull),X(0x453F6E36C6ull),X(0x454B873153ull),X(0x4557A00122ull),X(0x4563B8A62Bull), \
+	X(0x456FD12066ull),X(0x457BE96FCCull),X(0x4588019456ull),X(0x4594198DFCull),X(0x45A0315CB6ull),X(0x45AC49007Dull),X(0x45B860794Bull),X(0x45C477C716ull), \
+	X(0x45D08EE9D8ull),X(0x45DCA5E18Aull),X(0x45E8BCAE23ull),X(0x45F4D34F9Dull),X(0x4600E9C5F0ull),X(0x460D001114ull),X(0x4619163102ull),X(0x46252C25B3ull), \
+	X(0x463141EF1Eull),X(0x463D578D3Eull),X(0x46496D000Aull),X(0x465582477Aull),X(0x4661976388ull),X(0x466DAC542Cull),X(0x4679C1195Eull),X(0x4685D5B317ull), \
+	X(0x4691EA214Full),X(0x469DFE63FFull),X(0x46AA127B20ull),X(0x46B62666ABull),X(0x46C23A2697ull),X(0x46CE4DBADDull),X(0x46DA612376ull),X(0x46E674605Aull), \
+	X(0x46F2877182ull),X(0x46FE9A56E6ull),X(0x470AAD1080ull),X(0x4716BF9E47ull),X(0x4722D20034ull),X(0x472EE43640ull),X(0x473AF64063ull),X(0x4747081E96ull), \
+	X(0x475319D0D1ull),X(0x475F2B570Dull),X(0x476B3CB142ull),X(0x47774DDF6Aull),X(0x47835EE17Cull),X(0x478F6FB771ull),X(0x479B806141ull),X(0x47A790DEE6ull), \
+	X(0x47B3A13058ull),X(0x47BFB1558Full),X(0x47CBC14E84ull),X(0x47D7D11B2Full),X(0x47E3E0BB89ull),X(0x47EFF02F8Bull),X(0x47FBFF772Dull),X(0x48080E9268ull), \
+	X(0x48141D8134ull),X(0x48202C4389ull),X(0x482C3AD962ull),X(0x48384942B5ull),X(0x4844577F7Bull),X(0x4850658FAEull),X(0x485C737345ull),X(0x4868812A39ull), \
+	X(0x48748EB483ull),X(0x48809C121Cull),X(0x488CA942FBull),X(0x4898B6471Aull),X(0x48A4C31E71ull),X(0x48B0CFC8F8ull),X(0x48BCDC46A9ull),X(0x48C8E8977Bull), \
+	X(0x48D4F4BB68ull),X(0x48E100B267ull),X(0x48ED0C7C72ull),X(0x48F9181981ull),X(0x490523898Cull),X(0x49112ECC8Cull),X(0x491D39E27Bull),X(0x492944CB4Full), \
+	X(0x49354F8702ull),X(0x49415A158Dull),X(0x494D6476E8ull),X(0x49596EAB0Bull),X(0x496578B1F0ull),X(0x4971828B8Eull),X(0x497D8C37DEull),X(0x498995B6D9ull), \
+	X(0x49959F0878ull),X(0x49A1A82CB3ull),X(0x49ADB12382ull),X(0x49B9B9ECDFull),X(0x49C5C288C1ull),X(0x49D1CAF721ull),X(0x49DDD337F9ull),X(0x49E9DB4B40ull), \
+	X(0x49F5E330EFull),X(0x4A01EAE8FEull),X(0x4A0DF27367ull),X(0x4A19F9D021ull),X(0x4A2600FF26ull),X(0x4A3208006Eull),X(0x4A3E0ED3F2ull),X(0x4A4A1579A9ull), \
+	X(0x4A561BF18Dull),X(0x4A62223B97ull),X(0x4A6E2857BEull),X(0x4A7A2E45FCull),X(0x4A86340648ull),X(0x4A9239989Dull),X(0x4A9E3EFCF1ull),X(0x4AAA44333Full), \
+	X(0x4AB6493B7Dull),X(0x4AC24E15A6ull),X(0x4ACE52C1B1ull),X(0x4ADA573F97ull),X(0x4AE65B8F51ull),X(0x4AF25FB0D8ull),X(0x4AFE63A423ull),X(0x4B0A67692Cull), \
+	X(0x4B166AFFEAull),X(0x4B226E6858ull),X(0x4B2E71A26Cull),X(0x4B3A74AE21ull),X(0x4B46778B6Dull),X(0x4B527A3A4Bull),X(0x4B5E7CBAB3ull),X(0x4B6A7F0C9Cull), \
+	X(0x4B76813001ull),X(0x4B828324D8ull),X(0x4B8E84EB1Cull),X(0x4B9A8682C4ull),X(0x4BA687EBCAull),X(0x4BB2892625ull),X(0x4BBE8A31CFull),X(0x4BCA8B0EBFull), \
+	X(0x4BD68BBCEFull),X(0x4BE28C3C57ull),X(0x4BEE8C8CF0ull),X(0x4BFA8CAEB2ull),X(0x4C068CA196ull),X(0x4C128C6595ull),X(0x4C1E8BFAA7ull),X(0x4C2A8B60C4ull), \
+	X(0x4C368A97E6ull),X(0x4C4289A005ull),X(0x4C4E887919ull),X(0x4C5A87231Bull),X(0x4C66859E05ull),X(0x4C7283E9CDull),X(0x4C7E82066Dull),X(0x4C8A7FF3DEull), \
+	X(0x4C967DB218ull),X(0x4CA27B4114ull),X(0x4CAE78A0CAull),X(0x4CBA75D133ull),X(0x4CC672D247ull),X(0x4CD26FA400ull),X(0x4CDE6C4655ull),X(0x4CEA68B940ull), \
+	X(0x4CF664FCB9ull),X(0x4D026110B8ull),X(0x4D0E5CF537ull),X(0x4D1A58AA2Dull),X(0x4D26542F94ull),X(0x4D324F8563ull),X(0x4D3E4AAB95ull),X(0x4D4A45A220ull), \
+	X(0x4D564068FFull),X(0x4D623B0028ull),X(0x4D6E356796ull),X(0x4D7A2F9F41ull),X(0x4D8629A721ull),X(0x4D92237F2Eull),X(0x4D9E1D2762ull),X(0x4DAA169FB6ull), \
+	X(0x4DB60FE821ull),X(0x4DC209009Cull),X(0x4DCE01E920ull),X(0x4DD9FAA1A6ull),X(0x4DE5F32A26ull),X(0x4DF1EB8299ull),X(0x4DFDE3AAF8ull),X(0x4E09DBA33Aull), \
+	X(0x4E15D36B59ull),X(0x4E21CB034Dull),X(0x4E2DC26B0Full),X(0x4E39B9A298ull),X(0x4E45B0A9E0ull),X(0x4E51A780DFull),X(0x4E5D9E278Full),X(0x4E69949DE8ull), \
+	X(0x4E758AE3E3ull),X(0x4E8180F977ull),X(0x4E8D76DE9Full),X(0x4E996C9352ull),X(0x4EA5621789ull),X(0x4EB1576B3Dull),X(0x4EBD4C8E66ull),X(0x4EC94180FDull), \
+	X(0x4ED53642FBull),X(0x4EE12AD458ull),X(0x4EED1F350Dull),X(0x4EF9136512ull),X(0x4F05076460ull),X(0x4F10FB32F1ull),X(0x4F1CEED0BBull),X(0x4F28E23DB8ull), \
+	X(0x4F34D579E1ull),X(0x4F40C8852Full),X(0x4F4CBB5F99ull),X(0x4F58AE0918ull),X(0x4F64A081A6ull),X(0x4F7092C93Aull),X(0x4F7C84DFCEull),X(0x4F8876C55Aull), \
+	X(0x4F946879D6ull),X(0x4FA059FD3Cull),X(0x4FAC4B4F84ull),X(0x4FB83C70A6ull),X(0x4FC42D609Bull),X(0x4FD01E1F5Cull),X(0x4FDC0EACE2ull),X(0x4FE7FF0925ull), \
+	X(0x4FF3EF341Dull),X(0x4FFFDF2DC4ull),X(0x500BCEF612ull),X(0x5017BE8CFFull),X(0x5023ADF285ull),X(0x502F9D269Bull),X(0x503B8C293Bull),X(0x50477AFA5Dull), \
+	X(0x50536999FBull),X(0x505F58080Bull),X(0x506B464488ull),X(0x5077344F69ull),X(0x50832228A8ull),X(0x508F0FD03Cull),X(0x509AFD4620ull),X(0x50A6EA8A4Aull), \
+	X(0x50B2D79CB5ull),X(0x50BEC47D58ull),X(0x50CAB12C2Dull),X(0x50D69DA92Bull),X(0x50E289F44Cull),X(0x50EE760D88ull),X(0x50FA61F4D8ull),X(0x51064DAA34ull), \
+	X(0x5112392D95ull),X(0x511E247EF4ull),X(0x512A0F9E4Aull),X(0x5135FA8B8Eull),X(0x5141E546BBull),X(0x514DCFCFC7ull),X(0x5159BA26ADull),X(0x5165A44B64ull), \
+	X(0x51718E3DE6ull),X(0x517D77FE2Aull),X(0x5189618C2Aull),X(0x51954AE7DFull),X(0x51A1341140ull),X(0x51AD1D0847ull),X(0x51B905CCECull),X(0x51C4EE5F28ull), \
+	X(0x51D0D6BEF3ull),X(0x51DCBEEC46ull),X(0x51E8A6E71Bull),X(0x51F48EAF69ull),X(0x5200764529ull),X(0x520C5DA853ull),X(0x521844D8E2ull),X(0x52242BD6CCull), \
+	X(0x523012A20Bull),X(0x523BF93A98ull),X(0x5247DFA06Aull),X(0x5253C5D37Cull),X(0x525FABD3C4ull),X(0x526B91A13Dull),X(0x5277773BDFull),X(0x52835CA3A2ull), \
+	X(0x528F41D87Full),X(0x529B26DA6Full),X(0x52A70BA96Aull),X(0x52B2F04569ull),X(0x52BED4AE65ull),X(0x52CAB8E456ull),X(0x52D69CE735ull),X(0x52E280B6FBull), \
+	X(0x52EE6453A0ull),X(0x52FA47BD1Dull),X(0x53062AF36Bull),X(0x53120DF683ull),X(0x531DF0C65Cull),X(0x5329D362F0ull),X(0x5335B5CC38ull),X(0x534198022Bull), \
+	X(0x534D7A04C3ull),X(0x53595BD3F9ull),X(0x53653D6FC4ull),X(0x53711ED81Full),X(0x537D000D01ull),X(0x5388E10E62ull),X(0x5394C1DC3Dull),X(0x53A0A27689ull), \
+	X(0x53AC82DD3Full),X(0x53B8631057ull),X(0x53C4430FCBull),X(0x53D022DB94ull),X(0x53DC0273A9ull),X(0x53E7E1D803ull),X(0x53F3C1089Cull),X(0x53FFA0056Bull), \
+	X(0x540B7ECE6Aull),X(0x54175D6391ull),X(0x54233BC4D9ull),X(0x542F19F23Bull),X(0x543AF7EBAEull),X(0x5446D5B12Dull),X(0x5452B342AFull),X(0x545E90A02Dull), \
+	X(0x546A6DC9A0ull),X(0x54764ABF01ull),X(0x5482278048ull),X(0x548E040D6Eull),X(0x5499E0666Cull),X(0x54A5BC8B3Aull),X(0x54B1987BD1ull),X(0x54BD74382Aull), \
+	X(0x54C94FC03Dull),X(0x54D52B1403ull),X(0x54E1063375ull),X(0x54ECE11E8Bull),X(0x54F8BBD53Full),X(0x5504965788ull),X(0x551070A560ull),X(0x551C4ABEBFull), \
+	X(0x552824A39Eull),X(0x5533FE53F6ull),X(0x553FD7CFBFull),X(0x554BB116F1ull),X(0x55578A2987ull),X(0x5563630778ull),X(0x556F3BB0BCull),X(0x557B14254Eull), \
+	X(0x5586EC6525ull),X(0x5592C4703Aull),X(0x559E9C4686ull),X(0x55AA73E801ull),X(0x55B64B54A5ull),X(0x55C2228C69ull),X(0x55CDF98F47ull),X(0x55D9D05D37ull), \
+	X(0x55E5A6F633ull),X(0x55F17D5A31ull),X(0x55FD53892Dull),X(0x560929831Dull),X(0x5614FF47FBull),X(0x5620D4D7C0ull),X(0x562CAA3264ull),X(0x56387F57DFull), \
+	X(0x564454482Cull),X(0x5650290341ull),X(0x565BFD8919ull),X(0x5667D1D9ABull),X(0x5673A5F4F1ull),X(0x567F79DAE2ull),X(0x568B4D8B79ull),X(0x56972106ADull), \
+	X(0x56A2F44C77ull),X(0x56AEC75CD0ull),X(0x56BA9A37B0ull),X(0x56C66CDD11ull),X(0x56D23F4CEBull),X(0x56DE118737ull),X(0x56E9E38BEDull),X(0x56F5B55B07ull), \
+	X(0x570186F47Cull),X(0x570D585846ull),X(0x571929865Dull),X(0x5724FA7EBAull),X(0x5730CB4155ull),X(0x573C9BCE29ull),X(0x57486C252Cull),X(0x57543C4658ull), \
+	X(0x57600C31A6ull),X(0x576BDBE70Eull),X(0x5777AB6688ull),X(0x57837AB00Full),X(0x578F49C39Aull),X(0x579B18A122ull),X(0x57A6E748A0ull),X(0x57B2B5BA0Dull), \
+	X(0x57BE83F560ull),X(0x57CA51FA94ull),X(0x57D61FC9A1ull),X(0x57E1ED627Full),X(0x57EDBAC527ull),X(0x57F987F192ull),X(0x580554E7B8ull),X(0x581121A793ull), \
+	X(0x581CEE311Bull),X(0x5828BA8448ull),X(0x583486A115ull),X(0x5840528778ull),X(0x584C1E376Bull),X(0x5857E9B0E7ull),X(0x5863B4F3E4ull),X(0x586F80005Bull), \
+	X(0x587B4AD645ull),X(0x588715759Bull),X(0x5892DFDE55ull),X(0x589EAA106Cull),X(0x58AA740BD9ull),X(0x58B63DD094ull),X(0x58C2075E96ull),X(0x58CDD0B5D8ull), \
+	X(0x58D999D653ull),X(0x58E562BFFFull),X(0x58F12B72D6ull),X(0x58FCF3EECFull),X(0x5908BC33E4ull),X(0x591484420Dull),X(0x59204C1943ull),X(0x592C13B97Eull), \
+	X(0x5937DB22B9ull),X(0x5943A254EAull),X(0x594F69500Cull),X(0x595B301416ull),X(0x5966F6A101ull),X(0x5972BCF6C7ull),X(0x597E831560ull),X(0x598A48FCC4ull), \
+	X(0x59960EACEDull),X(0x59A1D425D3ull),X(0x59AD99676Eull),X(0x59B95E71B9ull),X(0x59C52344AAull),X(0x59D0E7E03Cull),X(0x59DCAC4467ull),X(0x59E8707123ull), \
+	X(0x59F4346669ull),X(0x59FFF82433ull),X(0x5A0BBBAA78ull),X(0x5A177EF932ull),X(0x5A23421059ull),X(0x5A2F04EFE6ull),X(0x5A3AC797D1ull),X(0x5A468A0815ull), \
+	X(0x5A524C40A8ull),X(0x5A5E0E4185ull),X(0x5A69D00AA3ull),X(0x5A75919BFCull),X(0x5A8152F588ull),X(0x5A8D141740ull),X(0x5A98D5011Dull),X(0x5AA495B318ull), \
+	X(0x5AB0562D28ull),X(0x5ABC166F48ull),X(0x5AC7D6796Full),X(0x5AD3964B97ull),X(0x5ADF55E5B8ull),X(0x5AEB1547CBull),X(0x5AF6D471C9ull),X(0x5B029363AAull), \
+	X(0x5B0E521D68ull),X(0x5B1A109EFAull),X(0x5B25CEE85Bull),X(0x5B318CF982ull),X(0x5B3D4AD268ull),X(0x5B49087306ull),X(0x5B54C5DB55ull),X(0x5B60830B4Eull), \
+	X(0x5B6C4002E9ull),X(0x5B77FCC21Full),X(0x5B83B948E9ull),X(0x5B8F759740ull),X(0x5B9B31AD1Bull),X(0x5BA6ED8A75ull),X(0x5BB2A92F46ull),X(0x5BBE649B87ull), \
+	X(0x5BCA1FCF30ull),X(0x5BD5DACA3Aull),X(0x5BE1958C9Eull),X(0x5BED501655ull),X(0x5BF90A6757ull),X(0x5C04C47F9Dull),X(0x5C107E5F21ull),X(0x5C1C3805DAull), \
+	X(0x5C27F173C2ull),X(0x5C33AAA8D1ull),X(0x5C3F63A500ull),X(0x5C4B1C6848ull),X(0x5C56D4F2A2ull),X(0x5C628D4406ull),X(0x5C6E455C6Dull),X(0x5C79FD3BD0ull), \
+	X(0x5C85B4E228ull),X(0x5C916C4F6Dull),X(0x5C9D238398ull),X(0x5CA8DA7EA3ull),X(0x5CB4914085ull),X(0x5CC047C938ull),X(0x5CCBFE18B4ull),X(0x5CD7B42EF2ull), \
+	X(0x5CE36A0BEBull),X(0x5CEF1FAF98ull),X(0x5CFAD519F1ull),X(0x5D068A4AF0ull),X(0x5D123F428Cull),X(0x5D1DF400BFull),X(0x5D29A88582ull),X(0x5D355CD0CDull), \
+	X(0x5D4110E299ull),X(0x5D4CC4BAE0ull),X(0x5D58785998ull),X(0x5D642BBEBDull),X(0x5D6FDEEA45ull),X(0x5D7B91DC2Bull),X(0x5D87449466ull),X(0x5D92F712F0ull), \
+	X(0x5D9EA957C1ull),X(0x5DAA5B62D2ull),X(0x5DB60D341Dull),X(0x5DC1BECB99ull),X(0x5DCD70293Full),X(0x5DD9214D09ull),X(0x5DE4D236EFull),X(0x5DF082E6EAull), \
+	X(0x5DFC335CF3ull),X(0x5E07E39902ull),X(0x5E13939B10ull),X(0x5E1F436316ull),X(0x5E2AF2F10Eull),X(0x5E36A244EEull),X(0x5E42515EB1ull),X(0x5E4E003E50ull), \
+	X(0x5E59AEE3C2ull),X(0x5E655D4F01ull),X(0x5E710B8006ull),X(0x5E7CB976C9ull),X(0x5E88673344ull),X(0x5E9414B56Eull),X(0x5E9FC1FD41ull),X(0x5EAB6F0AB6ull), \
+	X(0x5EB71BDDC5ull),X(0x5EC2C87667ull),X(0x5ECE74D495ull),X(0x5EDA20F848ull),X(0x5EE5CCE178ull),X(0x5EF178901Full),X(0x5EFD240435ull),X(0x5F08CF3DB3ull), \
+	X(0x5F147A3C92ull),X(0x5F202500CAull),X(0x5F2BCF8A55ull),X(0x5F3779D92Aull),X(0x5F4323ED44ull),X(0x5F4ECDC69Bull),X(0x5F5A776527ull),X(0x5F6620C8E2ull), \
+	X(0x5F71C9F1C3ull),X(0x5F7D72DFC5ull),X(0x5F891B92E0ull),X(0x5F94C40B0Cull),X(0x5FA06C4843ull),X(0x5FAC144A7Dull),X(0x5FB7BC11B3ull),X(0x5FC3639DDEull), \
+	X(0x5FCF0AEEF6ull),X(0x5FDAB204F5ull),X(0x5FE658DFD3ull),X(0x5FF1FF7F8Aull),X(0x5FFDA5E411ull),X(0x60094C0D62ull),X(0x6014F1FB76ull),X(0x602097AE45ull), \
+	X(0x602C3D25C8ull),X(0x6037E261F8ull),X(0x60438762CEull),X(0x604F2C2843ull),X(0x605AD0B24Full),X(0x60667500EBull),X(0x6072191411ull),X(0x607DBCEBB8ull), \
+	X(0x60896087DAull),X(0x609503E870ull),X(0x60A0A70D72ull),X(0x60AC49F6D9ull),X(0x60B7ECA49Eull),X(0x60C38F16BAull),X(0x60CF314D26ull),X(0x60DAD347DAull), \
+	X(0x60E67506CFull),X(0x60F21689FFull),X(0x60FDB7D161ull),X(0x610958DCF0ull),X(0x6114F9ACA3ull),X(0x61209A4073ull),X(0x612C3A985Aull),X(0x6137DAB44Full), \
+	X(0x61437A944Dull),X(0x614F1A384Cull),X(0x615AB9A043ull),X(0x616658CC2Eull),X(0x6171F7BC03ull),X(0x617D966FBDull),X(0x618934E754ull),X(0x6194D322C0ull), \
+	X(0x61A07121FBull),X(0x61AC0EE4FDull),X(0x61B7AC6BC0ull),X(0x61C349B63Cull),X(0x61CEE6C469ull),X(0x61DA839641ull),X(0x61E6202BBDull),X(0x61F1BC84D6ull), \
+	X(0x61FD58A183ull),X(0x6208F481BFull),X(0x6214902581ull),X(0x62202B8CC4ull),X(0x622BC6B77Full),X(0x623761A5ABull),X(0x6242FC5742ull),X(0x624E96CC3Cull), \
+	X(0x625A310492ull),X(0x6265CB003Cull),X(0x627164BF35ull),X(0x627CFE4174ull),X(0x62889786F2ull),X(0x6294308FA8ull),X(0x629FC95B90ull),X(0x62AB61EAA1ull), \
+	X(0x62B6FA3CD5ull),X(0x62C2925225ull),X(0x62CE2A2A89ull),X(0x62D9C1C5FAull),X(0x62E5592472ull),X(0x62F0F045E9ull),X(0x62FC872A57ull),X(0x63081DD1B6ull), \
+	X(0x6313B43BFFull),X(0x631F4A692Aull),X(0x632AE05930ull),X(0x6336760C0Aull),X(0x63420B81B2ull),X(0x634DA0BA1Full),X(0x635935B54Bull),X(0x6364CA732Eull), \
+	X(0x63705EF3C2ull),X(0x637BF336FEull),X(0x6387873CDDull),X(0x63931B0557ull),X(0x639EAE9065ull),X(0x63AA41DDFFull),X(0x63B5D4EE1Full),X(0x63C167C0BEull), \
+	X(0x63CCFA55D3ull),X(0x63D88CAD59ull),X(0x63E41EC748ull),X(0x63EFB0A398ull),X(0x63FB424243ull),X(0x6406D3A342ull),X(0x641264C68Dull),X(0x641DF5AC1Dull), \
+	X(0x64298653ECull),X(0x643516BDF2ull),X(0x6440A6EA27ull),X(0x644C36D885ull),X(0x6457C68905ull),X(0x646355FBA0ull),X(0x646EE5304Dull),X(0x647A742707ull), \
+	X(0x648602DFC6ull),X(0x6491915A83ull),X(0x649D1F9737ull),X(0x64A8AD95DBull),X(0x64B43B5667ull),X(0x64BFC8D8D4ull),X(0x64CB561D1Cull),X(0x64D6E32337ull), \
+	X(0x64E26FEB1Eull),X(0x64EDFC74CBull),X(0x64F988C035ull),X(0x650514CD55ull),X(0x6510A09C26ull),X(0x651C2C2C9Eull),X(0x6527B77EB8ull),X(0x653342926Dull), \
+	X(0x653ECD67B4ull),X(0x654A57FE87ull),X(0x6555E256E0ull),X(0x65616C70B6ull),X(0x656CF64C02ull),X(0x65787FE8BEull),X(0x65840946E3ull),X(0x658F926669ull), \
+	X(0x659B1B4749ull),X(0x65A6A3E97Cull),X(0x65B22C4CFAull),X(0x65BDB471BEull),X(0x65C93C57C0ull),X(0x65D4C3FEF8ull),X(0x65E04B675Full),X(0x65EBD290EFull), \
+	X(0x65F7597BA0ull),X(0x6602E0276Bull),X(0x660E669449ull),X(0x6619ECC234ull),X(0x662572B123ull),X(0x6630F8610Full),X(0x663C7DD1F3ull),X(0x66480303C5ull), \
+	X(0x665387F681ull),X(0x665F0CAA1Dull),X(0x666A911E94ull),X(0x66761553DDull),X(0x66819949F3ull),X(0x668D1D00CEull),X(0x6698A07866ull),X(0x66A423B0B5ull), \
+	X(0x66AFA6A9B3ull),X(0x66BB29635Aull),X(0x66C6ABDDA3ull),X(0x66D22E1885ull),X(0x66DDB013FBull),X(0x66E931CFFDull),X(0x66F4B34C84ull),X(0x6700348988ull), \
+	X(0x670BB58703ull),X(0x67173644EFull),X(0x6722B6C342ull),X(0x672E3701F7ull),X(0x6739B70107ull),X(0x674536C069ull),X(0x6750B64018ull),X(0x675C35800Dull), \
+	X(0x6767B4803Full),X(0x67733340A8ull),X(0x677EB1C140ull),X(0x678A300202ull),X(0x6795AE02E5ull),X(0x67A12BC3E3ull),X(0x67ACA944F4ull),X(0x67B8268612ull), \
+	X(0x67C3A38735ull),X(0x67CF204856ull),X(0x67DA9CC96Eull),X(0x67E6190A77ull),X(0x67F1950B68ull),X(0x67FD10CC3Bull),X(0x68088C4CE9ull),X(0x6814078D6Bull), \
+	X(0x681F828DB9ull),X(0x682AFD4DCDull),X(0x683677CD9Full),X(0x6841F20D29ull),X(0x684D6C0C63ull),X(0x6858E5CB46ull),X(0x68645F49CBull),X(0x686FD887ECull), \
+	X(0x687B5185A0ull),X(0x6886CA42E1ull),X(0x689242BFA8ull),X(0x689DBAFBEEull),X(0x68A932F7ACull),X(0x68B4AAB2DAull),X(0x68C0222D72ull),X(0x68CB99676Cull), \
+	X(0x68D71060C1ull),X(0x68E287196Bull),X(0x68EDFD9162ull),X(0x68F973C89Full),X(0x6904E9BF1Cull),X(0x69105F74D0ull),X(0x691BD4E9B6ull),X(0x69274A1DC5ull), \
+	X(0x6932BF10F7ull),X(0x693E33C345ull),X(0x6949A834A7ull),X(0x69551C6518ull),X(0x696090548Eull),X(0x696C040305ull),X(0x6977777073ull),X(0x6982EA9CD3ull), \
+	X(0x698E5D881Eull),X(0x6999D0324Bull),X(0x69A5429B55ull),X(0x69B0B4C334ull),X(0x69BC26A9E1ull),X(0x69C7984F55ull),X(0x69D309B389ull),X(0x69DE7AD676ull), \
+	X(0x69E9EBB814ull),X(0x69F55C585Eull),X(0x6A00CCB74Bull),X(0x6A0C3CD4D5ull),X(0x6A17ACB0F4ull),X(0x6A231C4BA2ull),X(0x6A2E8BA4D8ull),X(0x6A39FABC8Dull), \
+	X(0x6A456992BDull),X(0x6A50D8275Eull),X(0x6A5C467A6Bull),X(0x6A67B48BDCull),X(0x6A73225BAAull),X(0x6A7E8FE9CFull),X(0x6A89FD3642ull),X(0x6A956A40FEull), \
+	X(0x6AA0D709FAull),X(0x6AAC439131ull),X(0x6AB7AFD69Aull),X(0x6AC31BDA2Full),X(0x6ACE879BE9ull),X(0x6AD9F31BC1ull),X(0x6AE55E59B0ull),X(0x6AF0C955AEull), \
+	X(0x6AFC340FB4ull),X(0x6B079E87BDull),X(0x6B1308BDC0ull),X(0x6B1E72B1B6ull),X(0x6B29DC6399ull),X(0x6B3545D361ull),X(0x6B40AF0107ull),X(0x6B4C17EC85ull), \
+	X(0x6B578095D4ull),X(0x6B62E8FCEBull),X(0x6B6E5121C5ull),X(0x6B79B9045Aull),X(0x6B8520A4A3ull),X(0x6B90880299ull),X(0x6B9BEF1E35ull),X(0x6BA755F771ull), \
+	X(0x6BB2BC8E44ull),X(0x6BBE22E2A8ull),X(0x6BC988F496ull),X(0x6BD4EEC408ull),X(0x6BE05450F5ull),X(0x6BEBB99B57ull),X(0x6BF71EA326ull),X(0x6C0283685Dull), \
+	X(0x6C0DE7EAF3ull),X(0x6C194C2AE2ull),X(0x6C24B02823ull),X(0x6C3013E2AFull),X(0x6C3B775A7Eull),X(0x6C46DA8F89ull),X(0x6C523D81CBull),X(0x6C5DA0313Bull), \
+	X(0x6C69029DD2ull),X(0x6C7464C78Bull),X(0x6C7FC6AE5Cull),X(0x6C8B285240ull),X(0x6C9689B330ull),X(0x6CA1EAD124ull),X(0x6CAD4BAC16ull),X(0x6CB8AC43FEull), \
+	X(0x6CC40C98D5ull),X(0x6CCF6CAA95ull),X(0x6CDACC7936ull),X(0x6CE62C04B2ull),X(0x6CF18B4D00ull),X(0x6CFCEA521Cull),X(0x6D084913FCull),X(0x6D13A7929Bull), \
+	X(0x6D1F05CDF1ull),X(0x6D2A63C5F7ull),X(0x6D35C17AA7ull),X(0x6D411EEBF9ull),X(0x6D4C7C19E6ull),X(0x6D57D90467ull),X(0x6D6335AB76ull),X(0x6D6E920F0Aull), \
+	X(0x6D79EE2F1Eull),X(0x6D854A0BABull),X(0x6D90A5A4A8ull),X(0x6D9C00FA0Full),X(0x6DA75C0BDAull),X(0x6DB2B6DA01ull),X(0x6DBE11647Dull),X(0x6DC96BAB47ull), \
+	X(0x6DD4C5AE59ull),X(0x6DE01F6DAAull),X(0x6DEB78E935ull),X(0x6DF6D220F2ull),X(0x6E022B14DAull),X(0x6E0D83C4E6ull),X(0x6E18DC310Full),X(0x6E2434594Full), \
+	X(0x6E2F8C3D9Eull),X(0x6E3AE3DDF4ull),X(0x6E463B3A4Dull),X(0x6E5192529Full),X(0x6E5CE926E4ull),X(0x6E683FB716ull),X(0x6E7396032Cull),X(0x6E7EEC0B21ull), \
+	X(0x6E8A41CEEDull),X(0x6E95974E8Aull),X(0x6EA0EC89EFull),X(0x6EAC418117ull),X(0x6EB79633FAull),X(0x6EC2EAA291ull),X(0x6ECE3ECCD6ull),X(0x6ED992B2C1ull), \
+	X(0x6EE4E6544Bull),X(0x6EF039B16Dull),X(0x6EFB8CCA21ull),X(0x6F06DF9E5Full),X(0x6F12322E21ull),X(0x6F1D84795Eull),X(0x6F28D68011ull),X(0x6F34284233ull), \
+	X(0x6F3F79BFBCull),X(0x6F4ACAF8A5ull),X(0x6F561BECE8ull),X(0x6F616C9C7Dull),X(0x6F6CBD075Eull),X(0x6F780D2D83ull),X(0x6F835D0EE6ull),X(0x6F8EACAB80ull), \
+	X(0x6F99FC0348ull),X(0x6FA54B163Aull),X(0x6FB099E44Dull),X(0x6FBBE86D7Bull),X(0x6FC736B1BCull),X(0x6FD284B10Bull),X(0x6FDDD26B5Eull),X(0x6FE91FE0B1ull), \
+	X(0x6FF46D10FBull),X(0x6FFFB9FC37ull),X(0x700B06A25Cull),X(0x7016530364ull),X(0x70219F1F48ull),X(0x702CEAF600ull),X(0x7038368787ull),X(0x704381D3D5ull), \
+	X(0x704ECCDAE2ull),X(0x705A179CA9ull),X(0x7065621922ull),X(0x7070AC5046ull),X(0x707BF6420Eull),X(0x70873FEE74ull),X(0x709289556Full),X(0x709DD276FAull), \
+	X(0x70A91B530Dull),X(0x70B463E9A2ull),X(0x70BFAC3AB1ull),X(0x70CAF44633ull),X(0x70D63C0C22ull),X(0x70E1838C77ull),X(0x70ECCAC72Aull),X(0x70F811BC34ull), \
+	X(0x7103586B90ull),X(0x710E9ED534ull),X(0x7119E4F91Cull),X(0x71252AD740ull),X(0x7130706F98ull),X(0x713BB5C21Eull),X(0x7146FACECBull),X(0x71523F9598ull), \
+	X(0x715D84167Eull),X(0x7168C85176ull),X(0x71740C4679ull),X(0x717F4FF581ull),X(0x718A935E85ull),X(0x7195D68180ull),X(0x71A1195E6Bull),X(0x71AC5BF53Dull), \
+	X(0x71B79E45F1ull),X(0x71C2E05080ull),X(0x71CE2214E2ull),X(0x71D9639311ull),X(0x71E4A4CB05ull),X(0x71EFE5BCB8ull),X(0x71FB266823ull),X(0x720666CD3Full), \
+	X(0x7211A6EC04ull),X(0x721CE6C46Dull),X(0x7228265671ull),X(0x723365A20Bull),X(0x723EA4A733ull),X(0x7249E365E1ull),X(0x725521DE11ull),X(0x7260600FB9ull), \
+	X(0x726B9DFAD4ull),X(0x7276DB9F5Bull),X(0x728218FD45ull),X(0x728D56148Eull),X(0x729892E52Dull),X(0x72A3CF6F1Cull),X(0x72AF0BB254ull),X(0x72BA47AECDull), \
+	X(0x72C5836482ull),X(0x72D0BED36Aull),X(0x72DBF9FB80ull),X(0x72E734DCBBull),X(0x72F26F7716ull),X(0x72FDA9CA8Aull),X(0x7308E3D70Eull),X(0x73141D9C9Dull), \
+	X(0x731F571B30ull),X(0x732A9052BFull),X(0x7335C94344ull),X(0x734101ECB7ull),X(0x734C3A4F13ull),X(0x7357726A4Full),X(0x7362AA3E65ull),X(0x736DE1CB4Full), \
+	X(0x7379191104ull),X(0x7384500F7Full),X(0x738F86C6B8ull),X(0x739ABD36A9ull),X(0x73A5F35F4Aull),X(0x73B1294094ull),X(0x73BC5EDA81ull),X(0x73C7942D0Aull), \
+	X(0x73D2C93828ull),X(0x73DDFDFBD3ull),X(0x73E9327806ull),X(0x73F466ACB9ull),X(0x73FF9A99E4ull),X(0x740ACE3F82ull),X(0x7416019D8Cull),X(0x742134B3FAull), \
+	X(0x742C6782C5ull),X(0x74379A09E7ull),X(0x7442CC4959ull),X(0x744DFE4114ull),X(0x74592FF110ull),X(0x7464615947ull),X(0x746F9279B3ull),X(0x747AC3524Cull), \
+	X(0x7485F3E30Bull),X(0x7491242BE9ull),X(0x749C542CE0ull),X(0x74A783E5E9ull),X(0x74B2B356FCull),X(0x74BDE28013ull),X(0x74C9116127ull),X(0x74D43FFA30ull), \
+	X(0x74DF6E4B29ull),X(0x74EA9C540Aull),X(0x74F5CA14CDull),X(0x7500F78D6Aull),X(0x750C24BDDAull),X(0x751751A617ull),X(0x75227E4619ull),X(0x752DAA9DDBull), \
+	X(0x7538D6AD54ull),X(0x754402747Full),X(0x754F2DF353ull),X(0x755A5929CBull),X(0x75658417DFull),X(0x7570AEBD89ull),X(0x757BD91AC1ull),X(0x7587032F81ull), \
+	X(0x75922CFBC2ull),X(0x759D567F7Dull),X(0x75A87FBAAAull),X(0x75B3A8AD44ull),X(0x75BED15744ull),X(0x75C9F9B8A1ull),X(0x75D521D156ull),X(0x75E049A15Cull), \
+	X(0x75EB7128ACull),X(0x75F698673Eull),X(0x7601BF5D0Cull),X(0x760CE60A10ull),X(0x76180C6E41ull),X(0x762332899Bull),X(0x762E585C14ull),X(0x76397DE5A7ull), \
+	X(0x7644A3264Dull),X(0x764FC81DFFull),X(0x765AECCCB5ull),X(0x766611326Aull),X(0x7671354F16ull),X(0x767C5922B2ull),X(0x76877CAD38ull),X(0x76929FEEA1ull), \
+	X(0x769DC2E6E5ull),X(0x76A8E595FEull),X(0x76B407FBE5ull),X(0x76BF2A1893ull),X(0x76CA4BEC02ull),X(0x76D56D762Aull),X(0x76E08EB704ull),X(0x76EBAFAE8Aull), \
+	X(0x76F6D05CB5ull),X(0x7701F0C17Eull),X(0x770D10DCDEull),X(0x771830AECEull),X(0x7723503747ull),X(0x772E6F7643ull),X(0x77398E6BBBull),X(0x7744AD17A7ull), \
+	X(0x774FCB7A01ull),X(0x775AE992C2ull),X(0x77660761E4ull),X(0x777124E75Full),X(0x777C42232Cull),X(0x77875F1545ull),X(0x77927BBDA3ull),X(0x779D981C3Eull), \
+	X(0x77A8B43111ull),X(0x77B3CFFC14ull),X(0x77BEEB7D40ull),X(0x77CA06B48Full),X(0x77D521A1F9ull),X(0x77E03C4578ull),X(0x77EB569F06ull),X(0x77F670AE9Aull), \
+	X(0x78018A742Eull),X(0x780CA3EFBCull),X(0x7817BD213Dull),X(0x7822D608A9ull),X(0x782DEEA5FAull),X(0x783906F929ull),X(0x78441F022Full),X(0x784F36C106ull), \
+	X(0x785A4E35A6ull),X(0x7865656009ull),X(0x78707C4028ull),X(0x787B92D5FBull),X(0x7886A9217Dull),X(0x7891BF22A6ull),X(0x789CD4D96Full),X(0x78A7EA45D2ull), \
+	X(0x78B2FF67C8ull),X(0x78BE143F4Aull),X(0x78C928CC51ull),X(0x78D43D0ED6ull),X(0x78DF5106D3ull),X(0x78EA64B440ull),X(0x78F5781717ull),X(0x79008B2F51ull), \
+	X(0x790B9DFCE7ull),X(0x7916B07FD2ull),X(0x7921C2B80Cull),X(0x792CD4A58Dull),X(0x7937E64850ull),X(0x7942F7A04Cull),X(0x794E08AD7Bull),X(0x7959196FD7ull), \
+	X(0x796429E758ull),X(0x796F3A13F7ull),X(0x797A49F5AFull),X(0x7985598C78ull),X(0x799068D84Aull),X(0x799B77D921ull),X(0x79A6868EF3ull),X(0x79B194F9BCull), \
+	X(0x79BCA31973ull),X(0x79C7B0EE12ull),X(0x79D2BE7793ull),X(0x79DDCBB5EEull),X(0x79E8D8A91Dull),X(0x79F3E55119ull),X(0x79FEF1ADDAull),X(0x7A09FDBF5Bull), \
+	X(0x7A15098594ull),X(0x7A2015007Full),X(0x7A2B203014ull),X(0x7A362B144Dull),X(0x7A4135AD24ull),X(0x7A4C3FFA91ull),X(0x7A5749FC8Dull),X(0x7A6253B312ull), \
+	X(0x7A6D5D1E19ull),X(0x7A78663D9Bull),X(0x7A836F1191ull),X(0x7A8E7799F4ull),X(0x7A997FD6BFull),X(0x7AA487C7E9ull),X(0x7AAF8F6D6Cull),X(0x7ABA96C741ull), \
+	X(0x7AC59DD562ull),X(0x7AD0A497C8ull),X(0x7ADBAB0E6Bull),X(0x7AE6B13945ull),X(0x7AF1B71850ull),X(0x7AFCBCAB84ull),X(0x7B07C1F2DBull),X(0x7B12C6EE4Dull), \
+	X(0x7B1DCB9DD5ull),X(0x7B28D0016Aull),X(0x7B33D41907ull),X(0x7B3ED7E4A5ull),X(0x7B49DB643Dull),X(0x7B54DE97C8ull),X(0x7B5FE17F3Full),X(0x7B6AE41A9Bull), \
+	X(0x7B75E669D6ull),X(0x7B80E86CE9ull),X(0x7B8BEA23CEull),X(0x7B96EB8E7Cull),X(0x7BA1ECACEEull),X(0x7BACED7F1Dull),X(0x7BB7EE0501ull),X(0x7BC2EE3E95ull), \
+	X(0x7BCDEE2BD2ull),X(0x7BD8EDCCAFull),X(0x7BE3ED2128ull),X(0x7BEEEC2935ull),X(0x7BF9EAE4CEull),X(0x7C04E953EFull),X(0x7C0FE7768Full),X(0x7C1AE54CA8ull), \
+	X(0x7C25E2D633ull),X(0x7C30E01329ull),X(0x7C3BDD0384ull),X(0x7C46D9A73Dull),X(0x7C51D5FE4Cull),X(0x7C5CD208ACull),X(0x7C67CDC656ull),X(0x7C72C93742ull), \
+	X(0x7C7DC45B6Aull),X(0x7C88BF32C7ull),X(0x7C93B9BD52ull),X(0x7C9EB3FB05ull),X(0x7CA9ADEBD9ull),X(0x7CB4A78FC7ull),X(0x7CBFA0E6C8ull),X(0x7CCA99F0D5ull), \
+	X(0x7CD592ADE9ull),X(0x7CE08B1DFBull),X(0x7CEB834106ull),X(0x7CF67B1701ull),X(0x7D01729FE8ull),X(0x7D0C69DBB2ull),X(0x7D1760CA5Aull),X(0x7D22576BD8ull), \
+	X(0x7D2D4DC026ull),X(0x7D3843C73Cull),X(0x7D43398115ull),X(0x7D4E2EEDA8ull),X(0x7D59240CF1ull),X(0x7D6418DEE7ull),X(0x7D6F0D6384ull),X(0x7D7A019AC2ull), \
+	X(0x7D84F58499ull),X(0x7D8FE92103ull),X(0x7D9ADC6FF9ull),X(0x7DA5CF7174ull),X(0x7DB0C2256Eull),X(0x7DBBB48BDFull),X(0x7DC6A6A4C1ull),X(0x7DD198700Eull), \
+	X(0x7DDC89EDBEull),X(0x7DE77B1DCBull),X(0x7DF26C002Eull),X(0x7DFD5C94E0ull),X(0x7E084CDBDBull),X(0x7E133CD517ull),X(0x7E1E2C808Full),X(0x7E291BDE3Bull), \
+	X(0x7E340AEE14ull),X(0x7E3EF9B014ull),X(0x7E49E82434ull),X(0x7E54D64A6Dull),X(0x7E5FC422B9ull),X(0x7E6AB1AD11ull),X(0x7E759EE96Eull),X(0x7E808BD7C9ull), \
+	X(0x7E8B78781Bull),X(0x7E9664CA5Full),X(0x7EA150CE8Cull),X(0x7EAC3C849Dull),X(0x7EB727EC8Bull),X(0x7EC213064Eull),X(0x7ECCFDD1E1ull),X(0x7ED7E84F3Cull), \
+	X(0x7EE2D27E59ull),X(0x7EEDBC5F31ull),X(0x7EF8A5F1BDull),X(0x7F038F35F6ull),X(0x7F0E782BD6ull),X(0x7F1960D357ull),X(0x7F24492C70ull),X(0x7F2F31371Dull), \
+	X(0x7F3A18F355ull),X(0x7F45006112ull),X(0x7F4FE7804Dull),X(0x7F5ACE5101ull),X(0x7F65B4D325ull),X(0x7F709B06B3ull),X(0x7F7B80EBA5ull),X(0x7F866681F4ull), \
+	X(0x7F914BC998ull),X(0x7F9C30C28Dull),X(0x7FA7156CC9ull),X(0x7FB1F9C848ull),X(0x7FBCDDD502ull),X(0x7FC7C192F0ull),X(0x7FD2A5020Cull),X(0x7FDD88224Full), \
+	X(0x7FE86AF3B2ull),X(0x7FF34D762Full),X(0x7FFE2FA9BFull),X(0x8009118E5Bull),X(0x8013F323FCull),X(0x801ED46A9Dull),X(0x8029B56235ull),X(0x8034960ABEull), \
+	X(0x803F766433ull),X(0x804A566E8Bull),X(0x80553629C0ull),X(0x80601595CCull),X(0x806AF4B2A7ull),X(0x8075D3804Cull),X(0x8080B1FEB3ull),X(0x808B902DD5ull), \
+	X(0x80966E0DADull),X(0x80A14B9E33ull),X(0x80AC28DF60ull),X(0x80B705D12Eull),X(0x80C1E27397ull),X(0x80CCBEC693ull),X(0x80D79ACA1Bull),X(0x80E2767E2Aull), \
+	X(0x80ED51E2B8ull),X(0x80F82CF7BFull),X(0x810307BD37ull),X(0x810DE2331Bull),X(0x8118BC5964ull),X(0x812396300Aull),X(0x812E6FB708ull),X(0x813948EE56ull), \
+	X(0x814421D5EDull),X(0x814EFA6DC8ull),X(0x8159D2B5E0ull),X(0x8164AAAE2Dull),X(0x816F8256A9ull),X(0x817A59AF4Eull),X(0x818530B814ull),X(0x81900770F5ull), \
+	X(0x819ADDD9EAull),X(0x81A5B3F2EDull),X(0x81B089BBF7ull),X(0x81BB5F3501ull),X(0x81C6345E05ull),X(0x81D10936FCull),X(0x81DBDDBFDFull),X(0x81E6B1F8A7ull), \
+	X(0x81F185E14Eull),X(0x81FC5979CDull),X(0x82072CC21Eull),X(0x8211FFBA3Aull),X(0x821CD2621Aull),X(0x8227A4B9B7ull),X(0x823276C10Bull),X(0x823D48780Full), \
+	X(0x824819DEBCull),X(0x8252EAF50Cull),X(0x825DBBBAF8ull),X(0x82688C307Aull),X(0x82735C558Bull),X(0x827E2C2A23ull),X(0x8288FBAE3Dull),X(0x8293CAE1D1ull), \
+	X(0x829E99C4DAull),X(0x82A9685750ull),X(0x82B436992Dull),X(0x82BF048A6Aull),X(0x82C9D22B00ull),X(0x82D49F7AE9ull),X(0x82DF6C7A1Eull),X(0x82EA392898ull), \
+	X(0x82F5058651ull),X(0x82FFD19342ull),X(0x830A9D4F65ull),X(0x831568BAB3ull),X(0x832033D524ull),X(0x832AFE9EB3ull),X(0x8335C91759ull),X(0x8340933F0Full), \
+	X(0x834B5D15CEull),X(0x8356269B90ull),X(0x8360EFD04Eull),X(0x836BB8B402ull),X(0x83768146A5ull),X(0x8381498830ull),X(0x838C11789Cull),X(0x8396D917E4ull), \
+	X(0x83A1A065FFull),X(0x83AC6762E9ull),X(0x83B72E0E99ull),X(0x83C1F46909ull),X(0x83CCBA7234ull),X(0x83D7802A11ull),X(0x83E245909Aull),X(0x83ED0AA5CAull), \
+	X(0x83F7CF6998ull),X(0x840293DBFFull),X(0x840D57FCF8ull),X(0x84181BCC7Cull),X(0x8422DF4A84ull),X(0x842DA2770Aull),X(0x8438655208ull),X(0x844327DB76ull), \
+	X(0x844DEA134Eull),X(0x8458ABF989ull),X(0x84636D8E21ull),X(0x846E2ED110ull),X(0x8478EFC24Dull),X(0x8483B061D4ull),X(0x848E70AF9Cull),X(0x849930ABA0ull), \
+	X(0x84A3F055D9ull),X(0x84AEAFAE40ull),X(0x84B96EB4CFull),X(0x84C42D697Full),X(0x84CEEBCC4Aull),X(0x84D9A9DD28ull),X(0x84E4679C13ull),X(0x84EF250904ull), \
+	X(0x84F9E223F6ull),X(0x85049EECE1ull),X(0x850F5B63BEull),X(0x851A178888ull),X(0x8524D35B37ull),X(0x852F8EDBC4ull),X(0x853A4A0A2Aull),X(0x854504E661ull), \
+	X(0x854FBF7063ull),X(0x855A79A82Aull),X(0x8565338DAEull),X(0x856FED20E9ull),X(0x857AA661D5ull),X(0x85855F506Aull),X(0x859017ECA3ull),X(0x859AD03678ull), \
+	X(0x85A5882DE4ull),X(0x85B03FD2DEull),X(0x85BAF72562ull),X(0x85C5AE2567ull),X(0x85D064D2E8ull),X(0x85DB1B2DDEull),X(0x85E5D13643ull),X(0x85F086EC0Full), \
+	X(0x85FB3C4F3Cull),X(0x8605F15FC4ull),X(0x8610A61D9Full),X(0x861B5A88C8ull),X(0x86260EA138ull),X(0x8630C266E7ull),X(0x863B75D9D1ull),X(0x864628F9EDull), \
+	X(0x8650DBC735ull),X(0x865B8E41A3ull),X(0x8666406930ull),X(0x8670F23DD6ull),X(0x867BA3BF8Dull),X(0x868654EE50ull),X(0x869105CA18ull),X(0x869BB652DDull), \
+	X(0x86A666889Bull),X(0x86B1166B49ull),X(0x86BBC5FAE1ull),X(0x86C675375Dull),X(0x86D12420B7ull),X(0x86DBD2B6E7ull),X(0x86E680F9E6ull),X(0x86F12EE9B0ull), \
+	X(0x86FBDC863Cull),X(0x870689CF84ull),X(0x871136C582ull),X(0x871BE3682Full),X(0x87268FB784ull),X(0x87313BB37Bull),X(0x873BE75C0Eull),X(0x874692B135ull), \
+	X(0x87513DB2EAull),X(0x875BE86127ull),X(0x876692BBE5ull),X(0x87713CC31Dull),X(0x877BE676C9ull),X(0x87868FD6E2ull),X(0x879138E362ull),X(0x879BE19C42ull), \
+	X(0x87A68A017Bull),X(0x87B1321308ull),X(0x87BBD9D0E1ull),X(0x87C6813AFFull),X(0x87D128515Dull),X(0x87DBCF13F3ull),X(0x87E67582BCull),X(0x87F11B9DAFull), \
+	X(0x87FBC164C8ull),X(0x880666D7FFull),X(0x88110BF74Eull),X(0x881BB0C2AFull),X(0x8826553A1Aull),X(0x8830F95D89ull),X(0x883B9D2CF5ull),X(0x884640A858ull), \
+	X(0x8850E3CFACull),X(0x885B86A2EAull),X(0x886629220Bull),X(0x8870CB4D09ull),X(0x887B6D23DDull),X(0x88860EA680ull),X(0x8890AFD4EDull),X(0x889B50AF1Cull), \
+	X(0x88A5F13507ull),X(0x88B09166A7ull),X(0x88BB3143F6ull),X(0x88C5D0CCEEull),X(0x88D0700187ull),X(0x88DB0EE1BBull),X(0x88E5AD6D84ull),X(0x88F04BA4DBull), \
+	X(0x88FAE987BAull),X(0x8905871619ull),X(0x8910244FF3ull),X(0x891AC13541ull),X(0x89255DC5FCull),X(0x892FFA021Eull),X(0x893A95E9A0ull),X(0x8945317C7Cull), \
+	X(0x894FCCBAABull),X(0x895A67A426ull),X(0x89650238E8ull),X(0x896F9C78E9ull),X(0x897A366423ull),X(0x8984CFFA90ull),X(0x898F693C28ull),X(0x899A0228E6ull), \
+	X(0x89A49AC0C2ull),X(0x89AF3303B7ull),X(0x89B9CAF1BEull),X(0x89C4628AD0ull),X(0x89CEF9CEE7ull),X(0x89D990BDFBull),X(0x89E4275808ull),X(0x89EEBD9D05ull), \
+	X(0x89F9538CEDull),X(0x8A03E927B9ull),X(0x8A0E7E6D63ull),X(0x8A19135DE3ull),X(0x8A23A7F934ull),X(0x8A2E3C3F4Full),X(0x8A38D0302Dull),X(0x8A4363CBC9ull), \
+	X(0x8A4DF7121Aull),X(0x8A588A031Bull),X(0x8A631C9EC6ull),X(0x8A6DAEE513ull),X(0x8A7840D5FDull),X(0x8A82D2717Cull),X(0x8A8D63B78Bull),X(0x8A97F4A822ull), \
+	X(0x8AA285433Cull),X(0x8AAD1588D1ull),X(0x8AB7A578DBull),X(0x8AC2351354ull),X(0x8ACCC45835ull),X(0x8AD7534778ull),X(0x8AE1E1E115ull),X(0x8AEC702508ull), \
+	X(0x8AF6FE1348ull),X(0x8B018BABD0ull),X(0x8B0C18EE99ull),X(0x8B16A5DB9Dull),X(0x8B213272D4ull),X(0x8B2BBEB439ull),X(0x8B364A9FC5ull),X(0x8B40D63572ull), \
+	X(0x8B4B617538ull),X(0x8B55EC5F12ull),X(0x8B6076F2FAull),X(0x8B6B0130E7ull),X(0x8B758B18D5ull),X(0x8B8014AABCull),X(0x8B8A9DE696ull),X(0x8B9526CC5Cull), \
+	X(0x8B9FAF5C09ull),X(0x8BAA379595ull),X(0x8BB4BF78FAull),X(0x8BBF470632ull),X(0x8BC9CE3D35ull),X(0x8BD4551DFEull),X(0x8BDEDBA886ull),X(0x8BE961DCC7ull), \
+	X(0x8BF3E7BABAull),X(0x8BFE6D4258ull),X(0x8C08F2739Bull),X(0x8C13774E7Dull),X(0x8C1DFBD2F7ull),X(0x8C28800103ull),X(0x8C3303D899ull),X(0x8C3D8759B4ull), \
+	X(0x8C480A844Eull),X(0x8C528D585Full),X(0x8C5D0FD5E1ull),X(0x8C6791FCCEull),X(0x8C7213CD1Full),X(0x8C7C9546CEull),X(0x8C871669D4ull),X(0x8C9197362Aull), \
+	X(0x8C9C17ABCCull),X(0x8CA697CAB0ull),X(0x8CB11792D3ull),X(0x8CBB97042Cull),X(0x8CC6161EB5ull),X(0x8CD094E268ull),X(0x8CDB134F3Full),X(0x8CE5916533ull), \
+	X(0x8CF00F243Dull),X(0x8CFA8C8C57ull),X(0x8D05099D7Bull),X(0x8D0F8657A1ull),X(0x8D1A02BAC5ull),X(0x8D247EC6DEull),X(0x8D2EFA7BE7ull),X(0x8D3975D9DAull), \
+	X(0x8D43F0E0AFull),X(0x8D4E6B9060ull),X(0x8D58E5E8E7ull),X(0x8D635FEA3Eull),X(0x8D6DD9945Dull),X(0x8D7852E73Full),X(0x8D82CBE2DCull),X(0x8D8D44872Full), \
+	X(0x8D97BCD432ull),X(0x8DA234C9DCull),X(0x8DACAC6829ull),X(0x8DB723AF12ull),X(0x8DC19A9E90ull),X(0x8DCC11369Cull),X(0x8DD6877731ull),X(0x8DE0FD6048ull), \
+	X(0x8DEB72F1DAull),X(0x8DF5E82BE1ull),X(0x8E005D0E56ull),X(0x8E0AD19934ull),X(0x8E1545CC73ull),X(0x8E1FB9A80Dull),X(0x8E2A2D2BFCull),X(0x8E34A05839ull), \
+	X(0x8E3F132CBEull),X(0x8E4985A984ull),X(0x8E53F7CE85ull),X(0x8E5E699BBBull),X(0x8E68DB111Full),X(0x8E734C2EAAull),X(0x8E7DBCF456ull),X(0x8E882D621Dull), \
+	X(0x8E929D77F9ull),X(0x8E9D0D35E2ull),X(0x8EA77C9BD2ull),X(0x8EB1EBA9C4ull),X(0x8EBC5A5FB0ull),X(0x8EC6C8BD90ull),X(0x8ED136C35Eull),X(0x8EDBA47113ull), \
+	X(0x8EE611C6A8ull),X(0x8EF07EC418ull),X(0x8EFAEB695Cull),X(0x8F0557B66Eull),X(0x8F0FC3AB46ull),X(0x8F1A2F47DFull),X(0x8F249A8C33ull),X(0x8F2F05783Aull), \
+	X(0x8F39700BEEull),X(0x8F43DA4749ull),X(0x8F4E442A45ull),X(0x8F58ADB4DBull),X(0x8F6316E704ull),X(0x8F6D7FC0BBull),X(0x8F77E841F9ull),X(0x8F82506AB7ull), \
+	X(0x8F8CB83AEEull),X(0x8F971FB29Aull),X(0x8FA186D1B2ull),X(0x8FABED9832ull),X(0x8FB6540611ull),X(0x8FC0BA1B4Bull),X(0x8FCB1FD7D7ull),X(0x8FD5853BB1ull), \
+	X(0x8FDFEA46D2ull),X(0x8FEA4EF933ull),X(0x8FF4B352CDull),X(0x8FFF17539Bull),X(0x90097AFB96ull),X(0x9013DE4AB8ull),X(0x901E4140FAull),X(0x9028A3DE55ull), \
+	X(0x90330622C4ull),X(0x903D680E40ull),X(0x9047C9A0C2ull),X(0x90522ADA45ull),X(0x905C8BBAC1ull),X(0x9066EC4231ull),X(0x90714C708Dull),X(0x907BAC45D0ull), \
+	X(0x90860BC1F4ull),X(0x90906AE4F1ull),X(0x909AC9AEC1ull),X(0x90A5281F5Eull),X(0x90AF8636C2ull),X(0x90B9E3F4E6ull),X(0x90C44159C4ull),X(0x90CE9E6555ull), \
+	X(0x90D8FB1793ull),X(0x90E3577078ull),X(0x90EDB36FFDull),X(0x90F80F161Bull),X(0x91026A62CEull),X(0x910CC5560Dull),X(0x91171FEFD3ull),X(0x91217A3019ull), \
+	X(0x912BD416D9ull),X(0x91362DA40Cull),X(0x914086D7ACull),X(0x914ADFB1B4ull),X(0x915538321Bull),X(0x915F9058DDull),X(0x9169E825F2ull),X(0x91743F9954ull), \
+	X(0x917E96B2FDull),X(0x9188ED72E7ull),X(0x919343D90Aull),X(0x919D99E561ull),X(0x91A7EF97E6ull),X(0x91B244F091ull),X(0x91BC99EF5Dull),X(0x91C6EE9444ull), \
+	X(0x91D142DF3Eull),X(0x91DB96D045ull),X(0x91E5EA6753ull),X(0x91F03DA463ull),X(0x91FA90876Cull),X(0x9204E3106Aull),X(0x920F353F55ull),X(0x9219871427ull), \
+	X(0x9223D88EDAull),X(0x922E29AF68ull),X(0x92387A75CAull),X(0x9242CAE1F9ull),X(0x924D1AF3F0ull),X(0x92576AABA8ull),X(0x9261BA091Bull),X(0x926C090C42ull), \
+	X(0x927657B517ull),X(0x9280A60393ull),X(0x928AF3F7B1ull),X(0x929541916Aull),X(0x929F8ED0B7ull),X(0x92A9DBB592ull),X(0x92B4283FF5ull),X(0x92BE746FDAull), \
+	X(0x92C8C0453Aull),X(0x92D30BC00Full),X(0x92DD56E052ull),X(0x92E7A1A5FDull),X(0x92F1EC1109ull),X(0x92FC362172ull),X(0x93067FD72Full),X(0x9310C9323Bull), \
+	X(0x931B12328Full),X(0x93255AD825ull),X(0x932FA322F7ull),X(0x9339EB12FEull),X(0x934432A834ull),X(0x934E79E293ull),X(0x9358C0C214ull),X(0x93630746B1ull), \
+	X(0x936D4D7064ull),X(0x9377933F26ull),X(0x9381D8B2F0ull),X(0x938C1DCBBEull),X(0x9396628987ull),X(0x93A0A6EC47ull),X(0x93AAEAF3F6ull),X(0x93B52EA08Eull), \
+	X(0x93BF71F20Aull),X(0x93C9B4E862ull),X(0x93D3F78390ull),X(0x93DE39C38Eull),X(0x93E87BA856ull),X(0x93F2BD31E1ull),X(0x93FCFE6029ull),X(0x94073F3328ull), \
+	X(0x94117FAAD7ull),X(0x941BBFC72Full),X(0x9425FF882Cull),X(0x94303EEDC6ull),X(0x943A7DF7F7ull),X(0x9444BCA6B8ull),X(0x944EFAFA05ull),X(0x945938F1D5ull), \
+	X(0x9463768E22ull),X(0x946DB3CEE8ull),X(0x9477F0B41Eull),X(0x94822D3DBFull),X(0x948C696BC5ull),X(0x9496A53E28ull),X(0x94A0E0B4E4ull),X(0x94AB1BCFF1ull), \
+	X(0x94B5568F4Aull),X(0x94BF90F2E7ull),X(0x94C9CAFAC3ull),X(0x94D404A6D7ull),X(0x94DE3DF71Dull),X(0x94E876EB8Full),X(0x94F2AF8426ull),X(0x94FCE7C0DDull), \
+	X(0x95071FA1ACull),X(0x951157268Dull),X(0x951B8E4F7Bull),X(0x9525C51C6Full),X(0x952FFB8D62ull),X(0x953A31A24Full),X(0x9544675B2Eull),X(0x954E9CB7FAull), \
+	X(0x9558D1B8ACull),X(0x9563065D3Full),X(0x956D3AA5ABull),X(0x95776E91EBull),X(0x9581A221F8ull),X(0x958BD555CCull),X(0x9596082D61ull),X(0x95A03AA8AFull), \
+	X(0x95AA6CC7B2ull),X(0x95B49E8A63ull),X(0x95BECFF0BBull),X(0x95C900FAB4ull),X(0x95D331A848ull),X(0x95DD61F971ull),X(0x95E791EE28ull),X(0x95F1C18667ull), \
+	X(0x95FBF0C227ull),X(0x96061FA163ull),X(0x96104E2415ull),X(0x961A7C4A35ull),X(0x9624AA13BEull),X(0x962ED780A9ull),X(0x96390490F0ull),X(0x964331448Dull), \
+	X(0x964D5D9B7Aull),X(0x96578995AFull),X(0x9661B53328ull),X(0x966BE073DEull),X(0x96760B57C9ull),X(0x968035DEE5ull),X(0x968A60092Bull),X(0x969489D694ull), \
+	X(0x969EB3471Bull),X(0x96A8DC5AB9ull),X(0x96B3051167ull),X(0x96BD2D6B20ull),X(0x96C75567DEull),X(0x96D17D0799ull),X(0x96DBA44A4Cull),X(0x96E5CB2FF0ull), \
+	X(0x96EFF1B880ull),X(0x96FA17E3F5ull),X(0x97043DB248ull),X(0x970E632374ull),X(0x9718883772ull),X(0x9722ACEE3Bull),X(0x972CD147CBull),X(0x9736F5441Aull), \
+	X(0x974118E322ull),X(0x974B3C24DCull),X(0x97555F0944ull),X(0x975F819052ull),X(0x9769A3BA00ull),X(0x9773C58647ull),X(0x977DE6F523ull),X(0x978808068Cull), \
+	X(0x979228BA7Cull),X(0x979C4910EDull),X(0x97A66909D8ull),X(0x97B088A538ull),X(0x97BAA7E306ull),X(0x97C4C6C33Cull),X(0x97CEE545D3ull),X(0x97D9036AC6ull), \
+	X(0x97E321320Eull),X(0x97ED3E9BA5ull),X(0x97F75BA785ull),X(0x98017855A7ull),X(0x980B94A606ull),X(0x9815B0989Aull),X(0x981FCC2D5Eull),X(0x9829E7644Cull), \
+	X(0x9834023D5Dull),X(0x983E1CB88Bull),X(0x984836D5D0ull),X(0x9852509525ull),X(0x985C69F685ull),X(0x986682F9E8ull),X(0x98709B9F4Aull),X(0x987AB3E6A3ull), \
+	X(0x9884CBCFEEull),X(0x988EE35B24ull),X(0x9898FA883Full),X(0x98A3115739ull),X(0x98AD27C80Bull),X(0x98B73DDAB0ull),X(0x98C1538F20ull),X(0x98CB68E557ull), \
+	X(0x98D57DDD4Dull),X(0x98DF9276FDull),X(0x98E9A6B260ull),X(0x98F3BA8F6Full),X(0x98FDCE0E26ull),X(0x9907E12E7Dull),X(0x9911F3F06Full),X(0x991C0653F4ull), \
+	X(0x9926185908ull),X(0x993029FFA3ull),X(0x993A3B47C0ull),X(0x99444C3158ull),X(0x994E5CBC65ull),X(0x99586CE8E1ull),X(0x99627CB6C6ull),X(0x996C8C260Dull), \
+	X(0x99769B36B0ull),X(0x9980A9E8AAull),X(0x998AB83BF3ull),X(0x9994C63086ull),X(0x999ED3C65Cull),X(0x99A8E0FD70ull),X(0x99B2EDD5BAull),X(0x99BCFA4F36ull), \
+	X(0x99C70669DCull),X(0x99D11225A6ull),X(0x99DB1D828Full),X(0x99E5288090ull),X(0x99EF331FA3ull),X(0x99F93D5FC1ull),X(0x9A034740E5ull),X(0x9A0D50C308ull), \
+	X(0x9A1759E624ull),X(0x9A2162AA33ull),X(0x9A2B6B0F2Full),X(0x9A35731511ull),X(0x9A3F7ABBD4ull),X(0x9A49820370ull),X(0x9A5388EBE1ull),X(0x9A5D8F751Full), \
+	X(0x9A67959F26ull),X(0x9A719B69EDull),X(0x9A7BA0D570ull),X(0x9A85A5E1A7ull),X(0x9A8FAA8E8Eull),X(0x9A99AEDC1Dull),X(0x9AA3B2CA4Full),X(0x9AADB6591Dull), \
+	X(0x9AB7B98881ull),X(0x9AC1BC5875ull),X(0x9ACBBEC8F3ull),X(0x9AD5C0D9F4ull),X(0x9ADFC28B73ull),X(0x9AE9C3DD69ull),X(0x9AF3C4CFD1ull),X(0x9AFDC562A3ull), \
+	X(0x9B07C595DAull),X(0x9B11C56970ull),X(0x9B1BC4DD5Eull),X(0x9B25C3F19Eull),X(0x9B2FC2A62Aull),X(0x9B39C0FAFCull),X(0x9B43BEF00Full),X(0x9B4DBC855Aull), \
+	X(0x9B57B9BAD9ull),X(0x9B61B69085ull),X(0x9B6BB30659ull),X(0x9B75AF1C4Dull),X(0x9B7FAAD25Cull),X(0x9B89A62880ull),X(0x9B93A11EB2ull),X(0x9B9D9BB4EDull), \
+	X(0x9BA795EB2Aull),X(0x9BB18FC162ull),X(0x9BBB893791ull),X(0x9BC5824DAFull),X(0x9BCF7B03B7ull),X(0x9BD97359A2ull),X(0x9BE36B4F6Bull),X(0x9BED62E50Aull), \
+	X(0x9BF75A1A7Bull),X(0x9C0150EFB6ull),X(0x9C0B4764B6ull),X(0x9C153D7975ull),X(0x9C1F332DECull),X(0x9C29288215ull),X(0x9C331D75EAull),X(0x9C3D120965ull), \
+	X(0x9C47063C80ull),X(0x9C50FA0F34ull),X(0x9C5AED817Cull),X(0x9C64E09352ull),X(0x9C6ED344AFull),X(0x9C78C5958Cull),X(0x9C82B785E5ull),X(0x9C8CA915B3ull), \
+	X(0x9C969A44EFull),X(0x9CA08B1394ull),X(0x9CAA7B819Bull),X(0x9CB46B8EFFull),X(0x9CBE5B3BB9ull),X(0x9CC84A87C2ull),X(0x9CD2397316ull),X(0x9CDC27FDAEull), \
+	X(0x9CE6162783ull),X(0x9CF003F090ull),X(0x9CF9F158CEull),X(0x9D03DE6037ull),X(0x9D0DCB06C6ull),X(0x9D17B74C74ull),X(0x9D21A3313Aull),X(0x9D2B8EB513ull), \
+	X(0x9D3579D7FAull),X(0x9D3F6499E6ull),X(0x9D494EFAD3ull),X(0x9D5338FABBull),X(0x9D5D229996ull),X(0x9D670BD760ull),X(0x9D70F4B412ull),X(0x9D7ADD2FA5ull), \
+	X(0x9D84C54A15ull),X(0x9D8EAD035Aull),X(0x9D98945B6Eull),X(0x9DA27B524Cull),X(0x9DAC61E7EEull),X(0x9DB6481C4Cull),X(0x9DC02DEF62ull),X(0x9DCA136129ull), \
+	X(0x9DD3F8719Aull),X(0x9DDDDD20B1ull),X(0x9DE7C16E66ull),X(0x9DF1A55AB3ull),X(0x9DFB88E593ull),X(0x9E056C0F00ull),X(0x9E0F4ED6F3ull),X(0x9E19313D66ull), \
+	X(0x9E23134253ull),X(0x9E2CF4E5B4ull),X(0x9E36D62783ull),X(0x9E40B707BAull),X(0x9E4A978653ull),X(0x9E5477A347ull),X(0x9E5E575E91ull),X(0x9E6836B82Aull), \
+	X(0x9E7215B00Dull),X(0x9E7BF44632ull),X(0x9E85D27A95ull),X(0x9E8FB04D30ull),X(0x9E998DBDFBull),X(0x9EA36ACCF1ull),X(0x9EAD477A0Cull),X(0x9EB723C545ull), \
+	X(0x9EC0FFAE97ull),X(0x9ECADB35FCull),X(0x9ED4B65B6Eull),X(0x9EDE911EE6ull),X(0x9EE86B805Eull),X(0x9EF2457FD0ull),X(0x9EFC1F1D37ull),X(0x9F05F8588Cull), \
+	X(0x9F0FD131C8ull),X(0x9F19A9A8E7ull),X(0x9F2381BDE2ull),X(0x9F2D5970B2ull),X(0x9F3730C152ull),X(0x9F4107AFBCull),X(0x9F4ADE3BEAull),X(0x9F54B465D5ull), \
+	X(0x9F5E8A2D78ull),X(0x9F685F92CBull),X(0x9F723495CBull),X(0x9F7C09366Full),X(0x9F85DD74B3ull),X(0x9F8FB15090ull),X(0x9F9984CA00ull),X(0x9FA357E0FDull), \
+	X(0x9FAD2A9581ull),X(0x9FB6FCE786ull),X(0x9FC0CED706ull),X(0x9FCAA063FBull),X(0x9FD4718E5Eull),X(0x9FDE42562Aull),X(0x9FE812BB59ull),X(0x9FF1E2BDE4ull), \
+	X(0x9FFBB25DC6ull),X(0xA005819AF8ull),X(0xA00F507574ull),X(0xA0191EED35ull),X(0xA022ED0235ull),X(0xA02CBAB46Cull),X(0xA0368803D6ull),X(0xA04054F06Cull), \
+	X(0xA04A217A28ull),X(0xA053EDA104ull),X(0xA05DB964FAull),X(0xA06784C605ull),X(0xA0714FC41Dull),X(0xA07B1A5F3Dull),X(0xA084E4975Full),X(0xA08EAE6C7Dull), \
+	X(0xA09877DE90ull),X(0xA0A240ED94ull),X(0xA0AC099981ull),X(0xA0B5D1E251ull),X(0xA0BF99C800ull),X(0xA0C9614A86ull),X(0xA0D32869DEull),X(0xA0DCEF2601ull), \
+	X(0xA0E6B57EEAull),X(0xA0F07B7492ull),X(0xA0FA4106F3ull),X(0xA104063609ull),X(0xA10DCB01CBull),X(0xA1178F6A35ull),X(0xA121536F40ull),X(0xA12B1710E7ull), \
+	X(0xA134DA4F23ull),X(0xA13E9D29EEull),X(0xA1485FA143ull),X(0xA15221B51Bull),X(0xA15BE36570ull),X(0xA165A4B23Cull),X(0xA16F659B7Aull),X(0xA179262122ull), \
+	X(0xA182E64330ull),X(0xA18CA6019Dull),X(0xA196655C63ull),X(0xA1A024537Cull),X(0xA1A9E2E6E3ull),X(0xA1B3A11690ull),X(0xA1BD5EE27Full),X(0xA1C71C4AA9ull), \
+	X(0xA1D0D94F07ull),X(0xA1DA95EF95ull),X(0xA1E4522C4Cull),X(0xA1EE0E0526ull),X(0xA1F7C97A1Dull),X(0xA201848B2Bull),X(0xA20B3F384Aull),X(0xA214F98174ull), \
+	X(0xA21EB366A3ull),X(0xA2286CE7D1ull),X(0xA2322604F9ull),X(0xA23BDEBE13ull),X(0xA24597131Aull),X(0xA24F4F0409ull),X(0xA2590690D8ull),X(0xA262BDB983ull), \
+	X(0xA26C747E03ull),X(0xA2762ADE51ull),X(0xA27FE0DA69ull),X(0xA289967244ull),X(0xA2934BA5DCull),X(0xA29D00752Bull),X(0xA2A6B4E02Cull),X(0xA2B068E6D7ull), \
+	X(0xA2BA1C8928ull),X(0xA2C3CFC717ull),X(0xA2CD82A0A0ull),X(0xA2D73515BDull),X(0xA2E0E72666ull),X(0xA2EA98D297ull),X(0xA2F44A1A49ull),X(0xA2FDFAFD76ull), \
+	X(0xA307AB7C19ull),X(0xA3115B962Bull),X(0xA31B0B4BA6ull),X(0xA324BA9C85ull),X(0xA32E6988C1ull),X(0xA338181054ull),X(0xA341C63339ull),X(0xA34B73F16Aull), \
+	X(0xA355214AE0ull),X(0xA35ECE3F95ull),X(0xA3687ACF85ull),X(0xA37226FAA8ull),X(0xA37BD2C0F8ull),X(0xA3857E2270ull),X(0xA38F291F0Aull),X(0xA398D3B6C0ull), \
+	X(0xA3A27DE98Bull),X(0xA3AC27B766ull),X(0xA3B5D1204Cull),X(0xA3BF7A2435ull),X(0xA3C922C31Cull),X(0xA3D2CAFCFBull),X(0xA3DC72D1CCull),X(0xA3E61A4189ull), \
+	X(0xA3EFC14C2Cull),X(0xA3F967F1B0ull),X(0xA4030E320Eull),X(0xA40CB40D40ull),X(0xA416598340ull),X(0xA41FFE9409ull),X(0xA429A33F94ull),X(0xA4334785DBull), \
+	X(0xA43CEB66DAull),X(0xA4468EE288ull),X(0xA45031F8E2ull),X(0xA459D4A9E0ull),X(0xA46376F57Cull),X(0xA46D18DBB2ull),X(0xA476BA5C7Aull),X(0xA4805B77D0ull), \
+	X(0xA489FC2DACull),X(0xA4939C7E09ull),X(0xA49D3C68E2ull),X(0xA4A6DBEE30ull),X(0xA4B07B0DECull),X(0xA4BA19C813ull),X(0xA4C3B81C9Cull),X(0xA4CD560B83ull), \
+	X(0xA4D6F394C2ull),X(0xA4E090B852ull),X(0xA4EA2D762Dull),X(0xA4F3C9CE4Full),X(0xA4FD65C0B0ull),X(0xA507014D4Bull),X(0xA5109C741Aull),X(0xA51A373517ull), \
+	X(0xA523D1903Cull),X(0xA52D6B8583ull),X(0xA5370514E6ull),X(0xA5409E3E60ull),X(0xA54A3701EAull),X(0xA553CF5F7Eull),X(0xA55D675717ull),X(0xA566FEE8AFull), \
+	X(0xA570961440ull),X(0xA57A2CD9C3ull),X(0xA583C33933ull),X(0xA58D59328Aull),X(0xA596EEC5C2ull),X(0xA5A083F2D5ull),X(0xA5AA18B9BEull),X(0xA5B3AD1A75ull), \
+	X(0xA5BD4114F7ull),X(0xA5C6D4A93Bull),X(0xA5D067D73Eull),X(0xA5D9FA9EF8ull),X(0xA5E38D0063ull),X(0xA5ED1EFB7Bull),X(0xA5F6B09039ull),X(0xA60041BE96ull), \
+	X(0xA609D2868Eull),X(0xA61362E81Aull),X(0xA61CF2E335ull),X(0xA6268277D8ull),X(0xA63011A5FEull),X(0xA639A06DA0ull),X(0xA6432ECEB9ull),X(0xA64CBCC943ull), \
+	X(0xA6564A5D38ull),X(0xA65FD78A92ull),X(0xA66964514Bull),X(0xA672F0B15Eull),X(0xA67C7CAAC4ull),X(0xA686083D77ull),X(0xA68F936972ull),X(0xA6991E2EAFull), \
+	X(0xA6A2A88D28ull),X(0xA6AC3284D7ull),X(0xA6B5BC15B6ull),X(0xA6BF453FBFull),X(0xA6C8CE02ECull),X(0xA6D2565F38ull),X(0xA6DBDE549Dull),X(0xA6E565E314ull), \
+	X(0xA6EEED0A98ull),X(0xA6F873CB23ull),X(0xA701FA24AFull),X(0xA70B801737ull),X(0xA71505A2B3ull),X(0xA71E8AC71Full),X(0xA7280F8475ull),X(0xA73193DAAEull), \
+	X(0xA73B17C9C6ull),X(0xA7449B51B5ull),X(0xA74E1E7276ull),X(0xA757A12C04ull),X(0xA761237E57ull),X(0xA76AA5696Cull),X(0xA77426ED3Bull),X(0xA77DA809BEull), \
+	X(0xA78728BEF1ull),X(0xA790A90CCDull),X(0xA79A28F34Cull),X(0xA7A3A87268ull),X(0xA7AD278A1Cull),X(0xA7B6A63A61ull),X(0xA7C0248332ull),X(0xA7C9A26489ull), \
+	X(0xA7D31FDE60ull),X(0xA7DC9CF0B1ull),X(0xA7E6199B76ull),X(0xA7EF95DEAAull),X(0xA7F911BA47ull),X(0xA8028D2E46ull),X(0xA80C083AA3ull),X(0xA81582DF56ull), \
+	X(0xA81EFD1C5Bull),X(0xA82876F1ABull),X(0xA831F05F40ull),X(0xA83B696515ull),X(0xA844E20324ull),X(0xA84E5A3968ull),X(0xA857D207D9ull),X(0xA861496E72ull), \
+	X(0xA86AC06D2Full),X(0xA874370407ull),X(0xA87DAD32F7ull),X(0xA88722F9F7ull),X(0xA890985903ull),X(0xA89A0D5014ull),X(0xA8A381DF25ull),X(0xA8ACF6062Full), \
+	X(0xA8B669C52Dull),X(0xA8BFDD1C19ull),X(0xA8C9500AEDull),X(0xA8D2C291A3ull),X(0xA8DC34B036ull),X(0xA8E5A6669Full),X(0xA8EF17B4DAull),X(0xA8F8889ADFull), \
+	X(0xA901F918AAull),X(0xA90B692E34ull),X(0xA914D8DB77ull),X(0xA91E48206Full),X(0xA927B6FD14ull),X(0xA931257161ull),X(0xA93A937D51ull),X(0xA9440120DDull), \
+	X(0xA94D6E5BFFull),X(0xA956DB2EB3ull),X(0xA9604798F1ull),X(0xA969B39AB5ull),X(0xA9731F33F8ull),X(0xA97C8A64B5ull),X(0xA985F52CE5ull),X(0xA98F5F8C84ull), \
+	X(0xA998C9838Aull),X(0xA9A23311F3ull),X(0xA9AB9C37B8ull),X(0xA9B504F4D5ull),X(0xA9BE6D4942ull),X(0xA9C7D534FAull),X(0xA9D13CB7F7ull),X(0xA9DAA3D234ull), \
+	X(0xA9E40A83ABull),X(0xA9ED70CC56ull),X(0xA9F6D6AC2Full),X(0xAA003C2330ull),X(0xAA09A13153ull),X(0xAA1305D694ull),X(0xAA1C6A12EBull),X(0xAA25CDE654ull), \
+	X(0xAA2F3150C7ull),X(0xAA38945241ull),X(0xAA41F6EABAull),X(0xAA4B591A2Dull),X(0xAA54BAE095ull),X(0xAA5E1C3DEAull),X(0xAA677D3229ull),X(0xAA70DDBD4Aull), \
+	X(0xAA7A3DDF48ull),X(0xAA839D981Eull),X(0xAA8CFCE7C5ull),X(0xAA965BCE38ull),X(0xAA9FBA4B70ull),X(0xAAA9185F69ull),X(0xAAB2760A1Cull),X(0xAABBD34B84ull), \
+	X(0xAAC530239Bull),X(0xAACE8C925Aull),X(0xAAD7E897BDull),X(0xAAE14433BEull),X(0xAAEA9F6656ull),X(0xAAF3FA2F80ull),X(0xAAFD548F36ull),X(0xAB06AE8573ull), \
+	X(0xAB10081230ull),X(0xAB19613569ull),X(0xAB22B9EF16ull),X(0xAB2C123F32ull),X(0xAB356A25B9ull),X(0xAB3EC1A2A3ull),X(0xAB4818B5EBull),X(0xAB516F5F8Bull), \
+	X(0xAB5AC59F7Eull),X(0xAB641B75BEull),X(0xAB6D70E244ull),X(0xAB76C5E50Cull),X(0xAB801A7E10ull),X(0xAB896EAD49ull),X(0xAB92C272B2ull),X(0xAB9C15CE45ull), \
+	X(0xABA568BFFDull),X(0xABAEBB47D4ull),X(0xABB80D65C4ull),X(0xABC15F19C6ull),X(0xABCAB063D7ull),X(0xABD40143EFull),X(0xABDD51BA09ull),X(0xABE6A1C61Full), \
+	X(0xABEFF1682Cull),X(0xABF940A029ull),X(0xAC028F6E12ull),X(0xAC0BDDD1E0ull),X(0xAC152BCB8Dull),X(0xAC1E795B14ull),X(0xAC27C6806Full),X(0xAC31133B99ull), \
+	X(0xAC3A5F8C8Bull),X(0xAC43AB7340ull),X(0xAC4CF6EFB2ull),X(0xAC564201DBull),X(0xAC5F8CA9B6ull),X(0xAC68D6E73Dull),X(0xAC7220BA6Aull),X(0xAC7B6A2337ull), \
+	X(0xAC84B321A0ull),X(0xAC8DFBB59Dull),X(0xAC9743DF2Aull),X(0xACA08B9E40ull),X(0xACA9D2F2D9ull),X(0xACB319DCF1ull),X(0xACBC605C82ull),X(0xACC5A67185ull), \
+	X(0xACCEEC1BF5ull),X(0xACD8315BCCull),X(0xACE1763104ull),X(0xACEABA9B99ull),X(0xACF3FE9B83ull),X(0xACFD4230BEull),X(0xAD06855B44ull),X(0xAD0FC81B0Eull), \
+	X(0xAD190A7017ull),X(0xAD224C5A5Aull),X(0xAD2B8DD9D1ull),X(0xAD34CEEE76ull),X(0xAD3E0F9843ull),X(0xAD474FD733ull),X(0xAD508FAB40ull),X(0xAD59CF1464ull), \
+	X(0xAD630E129Aull),X(0xAD6C4CA5DBull),X(0xAD758ACE23ull),X(0xAD7EC88B6Bull),X(0xAD8805DDADull),X(0xAD9142C4E5ull),X(0xAD9A7F410Cull),X(0xADA3BB521Dull), \
+	X(0xADACF6F812ull),X(0xADB63232E4ull),X(0xADBF6D0290ull),X(0xADC8A7670Eull),X(0xADD1E1605Aull),X(0xADDB1AEE6Dull),X(0xADE4541141ull),X(0xADED8CC8D2ull), \
+	X(0xADF6C51519ull),X(0xADFFFCF611ull),X(0xAE09346BB4ull),X(0xAE126B75FDull),X(0xAE1BA214E4ull),X(0xAE24D84866ull),X(0xAE2E0E107Dull),X(0xAE37436D21ull), \
+	X(0xAE40785E4Full),X(0xAE49ACE400ull),X(0xAE52E0FE2Full),X(0xAE5C14ACD5ull),X(0xAE6547EFEEull),X(0xAE6E7AC773ull),X(0xAE77AD335Full),X(0xAE80DF33ADull), \
+	X(0xAE8A10C856ull),X(0xAE9341F154ull),X(0xAE9C72AEA3ull),X(0xAEA5A3003Dull),X(0xAEAED2E61Bull),X(0xAEB8026038ull),X(0xAEC1316E8Full),X(0xAECA60111Aull), \
+	X(0xAED38E47D3ull),X(0xAEDCBC12B5ull),X(0xAEE5E971B9ull),X(0xAEEF1664DBull),X(0xAEF842EC14ull),X(0xAF016F075Full),X(0xAF0A9AB6B6ull),X(0xAF13C5FA14ull), \
+	X(0xAF1CF0D172ull),X(0xAF261B3CCCull),X(0xAF2F453C1Cull),X(0xAF386ECF5Bull),X(0xAF4197F685ull),X(0xAF4AC0B194ull),X(0xAF53E90081ull),X(0xAF5D10E348ull), \
+	X(0xAF663859E2ull),X(0xAF6F5F644Bull),X(0xAF7886027Cull),X(0xAF81AC3470ull),X(0xAF8AD1FA20ull),X(0xAF93F75389ull),X(0xAF9D1C40A3ull),X(0xAFA640C169ull), \
+	X(0xAFAF64D5D6ull),X(0xAFB8887DE4ull),X(0xAFC1ABB98Dull),X(0xAFCACE88CCull),X(0xAFD3F0EB9Bull),X(0xAFDD12E1F4ull),X(0xAFE6346BD1ull),X(0xAFEF55892Eull), \
+	X(0xAFF8763A05ull),X(0xB001967E4Full),X(0xB00AB65608ull),X(0xB013D5C129ull),X(0xB01CF4BFADull),X(0xB02613518Eull),X(0xB02F3176C7ull),X(0xB0384F2F52ull), \
+	X(0xB0416C7B2Aull),X(0xB04A895A48ull),X(0xB053A5CCA8ull),X(0xB05CC1D243ull),X(0xB065DD6B15ull),X(0xB06EF89716ull),X(0xB078135643ull),X(0xB0812DA894ull), \
+	X(0xB08A478E05ull),X(0xB093610690ull),X(0xB09C7A122Full),X(0xB0A592B0DDull),X(0xB0AEAAE294ull),X(0xB0B7C2A74Eull),X(0xB0C0D9FF06ull),X(0xB0C9F0E9B7ull), \
+	X(0xB0D307675Aull),X(0xB0DC1D77EAull),X(0xB0E5331B61ull),X(0xB0EE4851BBull),X(0xB0F75D1AF0ull),X(0xB1007176FCull),X(0xB1098565D9ull),X(0xB11298E782ull), \
+	X(0xB11BABFBF0ull),X(0xB124BEA31Full),X(0xB12DD0DD08ull),X(0xB136E2A9A6ull),X(0xB13FF408F4ull),X(0xB14904FAEBull),X(0xB152157F87ull),X(0xB15B2596C1ull), \
+	X(0xB164354094ull),X(0xB16D447CFBull),X(0xB176534BF0ull),X(0xB17F61AD6Dull),X(0xB1886FA16Dull),X(0xB1917D27EAull),X(0xB19A8A40DEull),X(0xB1A396EC44ull), \
+	X(0xB1ACA32A17ull),X(0xB1B5AEFA50ull),X(0xB1BEBA5CEBull),X(0xB1C7C551E1ull),X(0xB1D0CFD92Eull),X(0xB1D9D9F2CBull),X(0xB1E2E39EB2ull),X(0xB1EBECDCDFull), \
+	X(0xB1F4F5AD4Cull),X(0xB1FDFE0FF3ull),X(0xB2070604CFull),X(0xB2100D8BDAull),X(0xB21914A50Eull),X(0xB2221B5066ull),X(0xB22B218DDCull),X(0xB234275D6Bull), \
+	X(0xB23D2CBF0Dull),X(0xB24631B2BDull),X(0xB24F363875ull),X(0xB2583A5030ull),X(0xB2613DF9E7ull),X(0xB26A413596ull),X(0xB273440337ull),X(0xB27C4662C3ull), \
+	X(0xB285485437ull),X(0xB28E49D78Cull),X(0xB2974AECBCull),X(0xB2A04B93C3ull),X(0xB2A94BCC99ull),X(0xB2B24B973Bull),X(0xB2BB4AF3A2ull),X(0xB2C449E1CAull), \
+	X(0xB2CD4861ABull),X(0xB2D6467341ull),X(0xB2DF441686ull),X(0xB2E8414B75ull),X(0xB2F13E1208ull),X(0xB2FA3A6A3Aull),X(0xB303365404ull),X(0xB30C31CF62ull), \
+	X(0xB3152CDC4Eull),X(0xB31E277AC3ull),X(0xB32721AABAull),X(0xB3301B6C2Eull),X(0xB33914BF1Bull),X(0xB3420DA379ull),X(0xB34B061944ull),X(0xB353FE2077ull), \
+	X(0xB35CF5B90Bull),X(0xB365ECE2FBull),X(0xB36EE39E42ull),X(0xB377D9EADAull),X(0xB380CFC8BDull),X(0xB389C537E6ull),X(0xB392BA3850ull),X(0xB39BAEC9F5ull), \
+	X(0xB3A4A2ECCFull),X(0xB3AD96A0D9ull),X(0xB3B689E60Eull),X(0xB3BF7CBC67ull),X(0xB3C86F23E0ull),X(0xB3D1611C72ull),X(0xB3DA52A619ull),X(0xB3E343C0CEull), \
+	X(0xB3EC346C8Dull),X(0xB3F524A950ull),X(0xB3FE147711ull),X(0xB40703D5CAull),X(0xB40FF2C577ull),X(0xB418E14611ull),X(0xB421CF5794ull),X(0xB42ABCF9F9ull), \
+	X(0xB433AA2D3Cull),X(0xB43C96F156ull),X(0xB445834642ull),X(0xB44E6F2BFBull),X(0xB4575AA27Bull),X(0xB46045A9BDull),X(0xB4693041BBull),X(0xB4721A6A6Full), \
+	X(0xB47B0423D5ull),X(0xB483ED6DE6ull),X(0xB48CD6489Eull),X(0xB495BEB3F6ull),X(0xB49EA6AFEAull),X(0xB4A78E3C73ull),X(0xB4B075598Cull),X(0xB4B95C0730ull), \
+	X(0xB4C2424559ull),X(0xB4CB281402ull),X(0xB4D40D7325ull),X(0xB4DCF262BDull),X(0xB4E5D6E2C4ull),X(0xB4EEBAF335ull),X(0xB4F79E940Aull),X(0xB50081C53Eull), \
+	X(0xB5096486CBull),X(0xB51246D8ACull),X(0xB51B28BADBull),X(0xB5240A2D53ull),X(0xB52CEB300Full),X(0xB535CBC309ull),X(0xB53EABE63Bull),X(0xB5478B99A0ull), \
+	X(0xB5506ADD32ull),X(0xB55949B0EDull),X(0xB5622814CAull),X(0xB56B0608C4ull),X(0xB573E38CD6ull),X(0xB57CC0A0F9ull),X(0xB5859D452Aull),X(0xB58E797962ull), \
+	X(0xB597553D9Bull),X(0xB5A03091D1ull),X(0xB5A90B75FEull),X(0xB5B1E5EA1Bull),X(0xB5BABFEE25ull),X(0xB5C3998216ull),X(0xB5CC72A5E7ull),X(0xB5D54B5993ull), \
+	X(0xB5DE239D16ull),X(0xB5E6FB706Aull),X(0xB5EFD2D388ull),X(0xB5F8A9C66Cull),X(0xB601804911ull),X(0xB60A565B70ull),X(0xB6132BFD85ull),X(0xB61C012F49ull), \
+	X(0xB624D5F0B8ull),X(0xB62DAA41CCull),X(0xB6367E227Full),X(0xB63F5192CDull),X(0xB6482492AFull),X(0xB650F72220ull),X(0xB659C9411Cull),X(0xB6629AEF9Bull), \
+	X(0xB66B6C2D99ull),X(0xB6743CFB11ull),X(0xB67D0D57FDull),X(0xB685DD4458ull),X(0xB68EACC01Bull),X(0xB6977BCB42ull),X(0xB6A04A65C8ull),X(0xB6A9188FA6ull), \
+	X(0xB6B1E648D8ull),X(0xB6BAB39158ull),X(0xB6C3806920ull),X(0xB6CC4CD02Bull),X(0xB6D518C674ull),X(0xB6DDE44BF6ull),X(0xB6E6AF60AAull),X(0xB6EF7A048Cull), \
+	X(0xB6F8443795ull),X(0xB7010DF9C1ull),X(0xB709D74B0Bull),X(0xB712A02B6Cull),X(0xB71B689ADFull),X(0xB72430995Full),X(0xB72CF826E7ull),X(0xB735BF4371ull), \
+	X(0xB73E85EEF7ull),X(0xB7474C2975ull),X(0xB75011F2E4ull),X(0xB758D74B40ull),X(0xB7619C3283ull),X(0xB76A60A8A8ull),X(0xB77324ADA8ull),X(0xB77BE84180ull), \
+	X(0xB784AB6428ull),X(0xB78D6E159Dull),X(0xB7963055D8ull),X(0xB79EF224D5ull),X(0xB7A7B3828Dull),X(0xB7B0746EFCull),X(0xB7B934EA1Bull),X(0xB7C1F4F3E6ull), \
+	X(0xB7CAB48C57ull),X(0xB7D373B369ull),X(0xB7DC326917ull),X(0xB7E4F0AD5Aull),X(0xB7EDAE802Eull),X(0xB7F66BE18Dull),X(0xB7FF28D172ull),X(0xB807E54FD7ull), \
+	X(0xB810A15CB7ull),X(0xB8195CF80Dull),X(0xB8221821D3ull),X(0xB82AD2DA04ull),X(0xB8338D209Bull),X(0xB83C46F591ull),X(0xB8450058E3ull),X(0xB84DB94A89ull), \
+	X(0xB85671CA80ull),X(0xB85F29D8C1ull),X(0xB867E17547ull),X(0xB87098A00Dull),X(0xB8794F590Eull),X(0xB88205A043ull),X(0xB88ABB75A9ull),X(0xB89370D938ull), \
+	X(0xB89C25CAEDull),X(0xB8A4DA4AC1ull),X(0xB8AD8E58AFull),X(0xB8B641F4B2ull),X(0xB8BEF51EC4ull),X(0xB8C7A7D6E1ull),X(0xB8D05A1D02ull),X(0xB8D90BF123ull), \
+	X(0xB8E1BD533Eull),X(0xB8EA6E434Dull),X(0xB8F31EC14Cull),X(0xB8FBCECD34ull),X(0xB9047E6701ull),X(0xB90D2D8EAEull),X(0xB915DC4434ull),X(0xB91E8A878Eull), \
+	X(0xB9273858B8ull),X(0xB92FE5B7ACull),X(0xB93892A464ull),X(0xB9413F1EDBull),X(0xB949EB270Bull),X(0xB95296BCF1ull),X(0xB95B41E085ull),X(0xB963EC91C3ull), \
+	X(0xB96C96D0A5ull),X(0xB975409D26ull),X(0xB97DE9F741ull),X(0xB98692DEF0ull),X(0xB98F3B542Eull),X(0xB997E356F6ull),X(0xB9A08AE742ull),X(0xB9A932050Cull), \
+	X(0xB9B1D8B051ull),X(0xB9BA7EE90Aull),X(0xB9C324AF31ull),X(0xB9CBCA02C3ull),X(0xB9D46EE3B8ull),X(0xB9DD13520Dull),X(0xB9E5B74DBBull),X(0xB9EE5AD6BDull), \
+	X(0xB9F6FDED0Eull),X(0xB9FFA090A9ull),X(0xBA0842C189ull),X(0xBA10E47FA7ull),X(0xBA1985CAFFull),X(0xBA2226A38Bull),X(0xBA2AC70946ull),X(0xBA3366FC2Bull), \
+	X(0xBA3C067C34ull),X(0xBA44A5895Cull),X(0xBA4D44239Eull),X(0xBA55E24AF4ull),X(0xBA5E7FFF59ull),X(0xBA671D40C8ull),X(0xBA6FBA0F3Cull),X(0xBA78566AAFull), \
+	X(0xBA80F2531Bull),X(0xBA898DC87Cull),X(0xBA9228CACDull),X(0xBA9AC35A07ull),X(0xBAA35D7625ull),X(0xBAABF71F23ull),X(0xBAB49054FBull),X(0xBABD2917A8ull), \
+	X(0xBAC5C16724ull),X(0xBACE59436Aull),X(0xBAD6F0AC75ull),X(0xBADF87A240ull),X(0xBAE81E24C4ull),X(0xBAF0B433FEull),X(0xBAF949CFE7ull),X(0xBB01DEF87Aull), \
+	X(0xBB0A73ADB2ull),X(0xBB1307EF8Aull),X(0xBB1B9BBDFDull),X(0xBB242F1904ull),X(0xBB2CC2009Bull),X(0xBB355474BDull),X(0xBB3DE67564ull),X(0xBB4678028Bull), \
+	X(0xBB4F091C2Dull),X(0xBB5799C244ull),X(0xBB6029F4CBull),X(0xBB68B9B3BDull),X(0xBB7148FF15ull),X(0xBB79D7D6CDull),X(0xBB82663AE0ull),X(0xBB8AF42B48ull), \
+	X(0xBB9381A801ull),X(0xBB9C0EB105ull),X(0xBBA49B464Full),X(0xBBAD2767DAull),X(0xBBB5B315A0ull),X(0xBBBE3E4F9Cull),X(0xBBC6C915C9ull),X(0xBBCF536821ull), \
+	X(0xBBD7DD46A0ull),X(0xBBE066B13Full),X(0xBBE8EFA7FBull),X(0xBBF1782ACCull),X(0xBBFA0039AFull),X(0xBC0287D49Eull),X(0xBC0B0EFB94ull),X(0xBC1395AE8Bull), \
+	X(0xBC1C1BED7Eull),X(0xBC24A1B868ull),X(0xBC2D270F43ull),X(0xBC35ABF20Bull),X(0xBC3E3060BBull),X(0xBC46B45B4Cull),X(0xBC4F37E1B9ull),X(0xBC57BAF3FEull), \
+	X(0xBC603D9215ull),X(0xBC68BFBBF9ull),X(0xBC714171A5ull),X(0xBC79C2B313ull),X(0xBC8243803Eull),X(0xBC8AC3D921ull),X(0xBC9343BDB6ull),X(0xBC9BC32DF9ull), \
+	X(0xBCA44229E4ull),X(0xBCACC0B172ull),X(0xBCB53EC49Eull),X(0xBCBDBC6362ull),X(0xBCC6398DBAull),X(0xBCCEB6439Full),X(0xBCD732850Dull),X(0xBCDFAE51FEull), \
+	X(0xBCE829AA6Eull),X(0xBCF0A48E57ull),X(0xBCF91EFDB3ull),X(0xBD0198F87Eull),X(0xBD0A127EB3ull),X(0xBD128B904Bull),X(0xBD1B042D43ull),X(0xBD237C5594ull), \
+	X(0xBD2BF40939ull),X(0xBD346B482Eull),X(0xBD3CE2126Dull),X(0xBD455867F0ull),X(0xBD4DCE48B3ull),X(0xBD5643B4B0ull),X(0xBD5EB8ABE3ull),X(0xBD672D2E45ull), \
+	X(0xBD6FA13BD2ull),X(0xBD7814D484ull),X(0xBD8087F857ull),X(0xBD88FAA745ull),X(0xBD916CE148ull),X(0xBD99DEA65Cull),X(0xBDA24FF67Cull),X(0xBDAAC0D1A1ull), \
+	X(0xBDB33137C8ull),X(0xBDBBA128EBull),X(0xBDC410A504ull),X(0xBDCC7FAC0Eull),X(0xBDD4EE3E05ull),X(0xBDDD5C5AE2ull),X(0xBDE5CA02A2ull),X(0xBDEE37353Eull), \
+	X(0xBDF6A3F2B1ull),X(0xBDFF103AF6ull),X(0xBE077C0E09ull),X(0xBE0FE76BE3ull),X(0xBE18525480ull),X(0xBE20BCC7DAull),X(0xBE2926C5ECull),X(0xBE31904EB2ull), \
+	X(0xBE39F96225ull),X(0xBE42620041ull),X(0xBE4ACA2900ull),X(0xBE5331DC5Eull),X(0xBE5B991A55ull),X(0xBE63FFE2DFull),X(0xBE6C6635F9ull),X(0xBE74CC139Cull), \
+	X(0xBE7D317BC3ull),X(0xBE85966E69ull),X(0xBE8DFAEB8Aull),X(0xBE965EF31Full),X(0xBE9EC28524ull),X(0xBEA725A193ull),X(0xBEAF884868ull),X(0xBEB7EA799Dull), \
+	X(0xBEC04C352Cull),X(0xBEC8AD7B12ull),X(0xBED10E4B48ull),X(0xBED96EA5CAull),X(0xBEE1CE8A91ull),X(0xBEEA2DF99Aull),X(0xBEF28CF2DFull),X(0xBEFAEB765Bull), \
+	X(0xBF03498408ull),X(0xBF0BA71BE2ull),X(0xBF14043DE3ull),X(0xBF1C60EA06ull),X(0xBF24BD2047ull),X(0xBF2D18E09Full),X(0xBF35742B09ull),X(0xBF3DCEFF82ull), \
+	X(0xBF46295E02ull),X(0xBF4E834686ull),X(0xBF56DCB908ull),X(0xBF5F35B583ull),X(0xBF678E3BF1ull),X(0xBF6FE64C4Eull),X(0xBF783DE695ull),X(0xBF80950AC0ull), \
+	X(0xBF88EBB8CAull),X(0xBF9141F0AEull),X(0xBF9997B267ull),X(0xBFA1ECFDF0ull),X(0xBFAA41D343ull),X(0xBFB296325Cull),X(0xBFBAEA1B35ull),X(0xBFC33D8DC9ull), \
+	X(0xBFCB908A14ull),X(0xBFD3E3100Full),X(0xBFDC351FB6ull),X(0xBFE486B904ull),X(0xBFECD7DBF3ull),X(0xBFF528887Full),X(0xBFFD78BEA2ull),X(0xC005C87E57ull), \
+	X(0xC00E17C799ull),X(0xC016669A63ull),X(0xC01EB4F6B0ull),X(0xC02702DC7Aull),X(0xC02F504BBDull),X(0xC0379D4473ull),X(0xC03FE9C698ull),X(0xC04835D225ull), \
+	X(0xC050816717ull),X(0xC058CC8568ull),X(0xC061172D12ull),X(0xC069615E11ull),X(0xC071AB1860ull),X(0xC079F45BF9ull),X(0xC0823D28D8ull),X(0xC08A857EF6ull), \
+	X(0xC092CD5E50ull),X(0xC09B14C6E0ull),X(0xC0A35BB8A1ull),X(0xC0ABA2338Dull),X(0xC0B3E837A1ull),X(0xC0BC2DC4D6ull),X(0xC0C472DB27ull),X(0xC0CCB77A90ull), \
+	X(0xC0D4FBA30Bull),X(0xC0DD3F5493ull),X(0xC0E5828F24ull),X(0xC0EDC552B7ull),X(0xC0F6079F48ull),X(0xC0FE4974D2ull),X(0xC1068AD350ull),X(0xC10ECBBABDull), \
+	X(0xC1170C2B13ull),X(0xC11F4C244Dull),X(0xC1278BA667ull),X(0xC12FCAB15Bull),X(0xC138094524ull),X(0xC1404761BDull),X(0xC148850722ull),X(0xC150C2354Cull), \
+	X(0xC158FEEC37ull),X(0xC1613B2BDEull),X(0xC16976F43Bull),X(0xC171B2454Bull),X(0xC179ED1F06ull),X(0xC182278169ull),X(0xC18A616C6Full),X(0xC1929AE012ull), \
+	X(0xC19AD3DC4Dull),X(0xC1A30C611Bull),X(0xC1AB446E77ull),X(0xC1B37C045Dull),X(0xC1BBB322C6ull),X(0xC1C3E9C9AEull),X(0xC1CC1FF910ull),X(0xC1D455B0E7ull), \
+	X(0xC1DC8AF12Dull),X(0xC1E4BFB9DEull),X(0xC1ECF40AF5ull),X(0xC1F527E46Cull),X(0xC1FD5B463Eull),X(0xC2058E3067ull),X(0xC20DC0A2E1ull),X(0xC215F29DA8ull), \
+	X(0xC21E2420B5ull),X(0xC226552C05ull),X(0xC22E85BF92ull),X(0xC236B5DB57ull),X(0xC23EE57F4Full),X(0xC24714AB75ull),X(0xC24F435FC4ull),X(0xC257719C36ull), \
+	X(0xC25F9F60C8ull),X(0xC267CCAD73ull),X(0xC26FF98233ull),X(0xC27825DF03ull),X(0xC28051C3DDull),X(0xC2887D30BDull),X(0xC290A8259Dull),X(0xC298D2A279ull), \
+	X(0xC2A0FCA74Cull),X(0xC2A9263410ull),X(0xC2B14F48C0ull),X(0xC2B977E558ull),X(0xC2C1A009D1ull),X(0xC2C9C7B629ull),X(0xC2D1EEEA58ull),X(0xC2DA15A65Bull), \
+	X(0xC2E23BEA2Cull),X(0xC2EA61B5C7ull),X(0xC2F2870925ull),X(0xC2FAABE443ull),X(0xC302D0471Aull),X(0xC30AF431A7ull),X(0xC31317A3E4ull),X(0xC31B3A9DCCull), \
+	X(0xC3235D1F5Aull),X(0xC32B7F2889ull),X(0xC333A0B954ull),X(0xC33BC1D1B6ull),X(0xC343E271AAull),X(0xC34C02992Aull),X(0xC354224833ull),X(0xC35C417EBFull), \
+	X(0xC364603CC9ull),X(0xC36C7E824Bull),X(0xC3749C4F42ull),X(0xC37CB9A3A7ull),X(0xC384D67F77ull),X(0xC38CF2E2ABull),X(0xC3950ECD3Full),X(0xC39D2A3F2Eull), \
+	X(0xC3A5453873ull),X(0xC3AD5FB909ull),X(0xC3B579C0EBull),X(0xC3BD935013ull),X(0xC3C5AC667Eull),X(0xC3CDC50425ull),X(0xC3D5DD2904ull),X(0xC3DDF4D516ull), \
+	X(0xC3E60C0856ull),X(0xC3EE22C2BFull),X(0xC3F639044Cull),X(0xC3FE4ECCF8ull),X(0xC406641CBEull),X(0xC40E78F399ull),X(0xC4168D5184ull),X(0xC41EA1367Aull), \
+	X(0xC426B4A276ull),X(0xC42EC79573ull),X(0xC436DA0F6Cull),X(0xC43EEC105Cull),X(0xC446FD983Eull),X(0xC44F0EA70Dull),X(0xC4571F3CC5ull),X(0xC45F2F595Full), \
+	X(0xC4673EFCD8ull),X(0xC46F4E272Aull),X(0xC4775CD851ull),X(0xC47F6B1046ull),X(0xC48778CF06ull),X(0xC48F86148Cull),X(0xC49792E0D1ull),X(0xC49F9F33D3ull), \
+	X(0xC4A7AB0D8Aull),X(0xC4AFB66DF3ull),X(0xC4B7C15509ull),X(0xC4BFCBC2C6ull),X(0xC4C7D5B726ull),X(0xC4CFDF3223ull),X(0xC4D7E833B9ull),X(0xC4DFF0BBE3ull), \
+	X(0xC4E7F8CA9Cull),X(0xC4F0005FDFull),X(0xC4F8077BA6ull),X(0xC5000E1DEDull),X(0xC5081446AFull),X(0xC51019F5E8ull),X(0xC5181F2B91ull),X(0xC52023E7A7ull), \
+	X(0xC528282A23ull),X(0xC5302BF302ull),X(0xC5382F423Eull),X(0xC5403217D3ull),X(0xC5483473BBull),X(0xC5503655F1ull),X(0xC55837BE71ull),X(0xC56038AD36ull), \
+	X(0xC56839223Aull),X(0xC570391D79ull),X(0xC578389EEEull),X(0xC58037A693ull),X(0xC588363465ull),X(0xC59034485Dull),X(0xC59831E278ull),X(0xC5A02F02AFull), \
+	X(0xC5A82BA8FFull),X(0xC5B027D562ull),X(0xC5B82387D4ull),X(0xC5C01EC04Full),X(0xC5C8197ECEull),X(0xC5D013C34Dull),X(0xC5D80D8DC7ull),X(0xC5E006DE36ull), \
+	X(0xC5E7FFB496ull),X(0xC5EFF810E2ull),X(0xC5F7EFF315ull),X(0xC5FFE75B2Aull),X(0xC607DE491Dull),X(0xC60FD4BCE7ull),X(0xC617CAB685ull),X(0xC61FC035F1ull), \
+	X(0xC627B53B27ull),X(0xC62FA9C621ull),X(0xC6379DD6DBull),X(0xC63F916D50ull),X(0xC64784897Bull),X(0xC64F772B56ull),X(0xC6576952DEull),X(0xC65F5B000Dull), \
+	X(0xC6674C32DEull),X(0xC66F3CEB4Dull),X(0xC6772D2954ull),X(0xC67F1CECEFull),X(0xC6870C3618ull),X(0xC68EFB04CBull),X(0xC696E95903ull),X(0xC69ED732BBull), \
+	X(0xC6A6C491EEull),X(0xC6AEB17697ull),X(0xC6B69DE0B2ull),X(0xC6BE89D039ull),X(0xC6C6754528ull),X(0xC6CE603F79ull),X(0xC6D64ABF28ull),X(0xC6DE34C430ull), \
+	X(0xC6E61E4E8Dull),X(0xC6EE075E38ull),X(0xC6F5EFF32Dull),X(0xC6FDD80D68ull),X(0xC705BFACE3ull),X(0xC70DA6D19Aull),X(0xC7158D7B88ull),X(0xC71D73AAA8ull), \
+	X(0xC725595EF5ull),X(0xC72D3E9869ull),X(0xC735235701ull),X(0xC73D079AB8ull),X(0xC744EB6388ull),X(0xC74CCEB16Dull),X(0xC754B18461ull),X(0xC75C93DC61ull), \
+	X(0xC76475B966ull),X(0xC76C571B6Dull),X(0xC774380270ull),X(0xC77C186E6Aull),X(0xC783F85F58ull),X(0xC78BD7D533ull),X(0xC793B6CFF6ull),X(0xC79B954F9Eull), \
+	X(0xC7A3735425ull),X(0xC7AB50DD87ull),X(0xC7B32DEBBEull),X(0xC7BB0A7EC6ull),X(0xC7C2E69699ull),X(0xC7CAC23333ull),X(0xC7D29D5490ull),X(0xC7DA77FAAAull), \
+	X(0xC7E252257Cull),X(0xC7EA2BD502ull),X(0xC7F2050936ull),X(0xC7F9DDC215ull),X(0xC801B5FF98ull),X(0xC8098DC1BCull),X(0xC81165087Bull),X(0xC8193BD3D0ull), \
+	X(0xC8211223B8ull),X(0xC828E7F82Cull),X(0xC830BD5128ull),X(0xC838922EA7ull),X(0xC8406690A5ull),X(0xC8483A771Cull),X(0xC8500DE208ull),X(0xC857E0D164ull), \
+	X(0xC85FB3452Bull),X(0xC867853D58ull),X(0xC86F56B9E7ull),X(0xC87727BAD2ull),X(0xC87EF84015ull),X(0xC886C849ABull),X(0xC88E97D78Full),X(0xC89666E9BCull), \
+	X(0xC89E35802Eull),X(0xC8A6039ADFull),X(0xC8ADD139CCull),X(0xC8B59E5CEEull),X(0xC8BD6B0442ull),X(0xC8C5372FC2ull),X(0xC8CD02DF69ull),X(0xC8D4CE1334ull), \
+	X(0xC8DC98CB1Cull),X(0xC8E463071Eull),X(0xC8EC2CC734ull),X(0xC8F3F60B59ull),X(0xC8FBBED38Aull),X(0xC903871FC0ull),X(0xC90B4EEFF8ull),X(0xC91316442Cull), \
+	X(0xC91ADD1C57ull),X(0xC922A37875ull),X(0xC92A695882ull),X(0xC9322EBC77ull),X(0xC939F3A451ull),X(0xC941B8100Aull),X(0xC9497BFF9Full),X(0xC9513F7309ull), \
+	X(0xC959026A44ull),X(0xC960C4E54Cull),X(0xC96886E41Cull),X(0xC9704866AEull),X(0xC978096CFFull),X(0xC97FC9F709ull),X(0xC9878A04C7ull),X(0xC98F499636ull), \
+	X(0xC99708AB4Full),X(0xC99EC7440Eull),X(0xC9A685606Full),X(0xC9AE43006Cull),X(0xC9B6002401ull),X(0xC9BDBCCB2Aull),X(0xC9C578F5E0ull),X(0xC9CD34A420ull), \
+	X(0xC9D4EFD5E5ull),X(0xC9DCAA8B2Aull),X(0xC9E464C3EBull),X(0xC9EC1E8021ull),X(0xC9F3D7BFC9ull),X(0xC9FB9082DFull),X(0xCA0348C95Cull),X(0xCA0B00933Dull), \
+	X(0xCA12B7E07Dull),X(0xCA1A6EB116ull),X(0xCA22250505ull),X(0xCA29DADC44ull),X(0xCA319036CEull),X(0xCA3945149Full),X(0xCA40F975B3ull),X(0xCA48AD5A04ull), \
+	X(0xCA5060C18Dull),X(0xCA5813AC4Bull),X(0xCA5FC61A37ull),X(0xCA67780B4Eull),X(0xCA6F297F8Aull),X(0xCA76DA76E8ull),X(0xCA7E8AF161ull),X(0xCA863AEEF2ull), \
+	X(0xCA8DEA6F95ull),X(0xCA95997347ull),X(0xCA9D47FA01ull),X(0xCAA4F603C0ull),X(0xCAACA3907Full),X(0xCAB450A038ull),X(0xCABBFD32E8ull),X(0xCAC3A94889ull), \
+	X(0xCACB54E117ull),X(0xCAD2FFFC8Dull),X(0xCADAAA9AE6ull),X(0xCAE254BC1Eull),X(0xCAE9FE6030ull),X(0xCAF1A78717ull),X(0xCAF95030CEull),X(0xCB00F85D51ull), \
+	X(0xCB08A00C9Aull),X(0xCB10473EA6ull),X(0xCB17EDF370ull),X(0xCB1F942AF2ull),X(0xCB2739E528ull),X(0xCB2EDF220Eull),X(0xCB3683E19Eull),X(0xCB3E2823D4ull), \
+	X(0xCB45CBE8ABull),X(0xCB4D6F301Full),X(0xCB5511FA2Aull),X(0xCB5CB446C9ull),X(0xCB645615F5ull),X(0xCB6BF767ACull),X(0xCB73983BE7ull),X(0xCB7B3892A3ull), \
+	X(0xCB82D86BDAull),X(0xCB8A77C788ull),X(0xCB9216A5A8ull),X(0xCB99B50636ull),X(0xCBA152E92Cull),X(0xCBA8F04E86ull),X(0xCBB08D3640ull),X(0xCBB829A054ull), \
+	X(0xCBBFC58CBEull),X(0xCBC760FB79ull),X(0xCBCEFBEC81ull),X(0xCBD6965FD0ull),X(0xCBDE305563ull),X(0xCBE5C9CD35ull),X(0xCBED62C740ull),X(0xCBF4FB4380ull), \
+	X(0xCBFC9341F0ull),X(0xCC042AC28Dull),X(0xCC0BC1C550ull),X(0xCC13584A36ull),X(0xCC1AEE5139ull),X(0xCC2283DA56ull),X(0xCC2A18E586ull),X(0xCC31AD72C7ull), \
+	X(0xCC39418212ull),X(0xCC40D51364ull),X(0xCC486826B7ull),X(0xCC4FFABC07ull),X(0xCC578CD34Full),X(0xCC5F1E6C8Bull),X(0xCC66AF87B6ull),X(0xCC6E4024CCull), \
+	X(0xCC75D043C7ull),X(0xCC7D5FE4A2ull),X(0xCC84EF075Aull),X(0xCC8C7DABEAull),X(0xCC940BD24Dull),X(0xCC9B997A7Eull),X(0xCCA326A478ull),X(0xCCAAB35038ull), \
+	X(0xCCB23F7DB8ull),X(0xCCB9CB2CF3ull),X(0xCCC1565DE6ull),X(0xCCC8E1108Aull),X(0xCCD06B44DDull),X(0xCCD7F4FAD9ull),X(0xCCDF7E3279ull),X(0xCCE706EBB8ull), \
+	X(0xCCEE8F2693ull),X(0xCCF616E305ull),X(0xCCFD9E2108ull),X(0xCD0524E098ull),X(0xCD0CAB21B1ull),X(0xCD1430E44Dull),X(0xCD1BB62869ull),X(0xCD233AEE00ull), \
+	X(0xCD2ABF350Cull),X(0xCD3242FD8Aull),X(0xCD39C64775ull),X(0xCD414912C7ull),X(0xCD48CB5F7Dull),X(0xCD504D2D92ull),X(0xCD57CE7D01ull),X(0xCD5F4F4DC6ull), \
+	X(0xCD66CF9FDBull),X(0xCD6E4F733Dull),X(0xCD75CEC7E6ull),X(0xCD7D4D9DD3ull),X(0xCD84CBF4FDull),X(0xCD8C49CD62ull),X(0xCD93C726FCull),X(0xCD9B4401C6ull), \
+	X(0xCDA2C05DBCull),X(0xCDAA3C3ADAull),X(0xCDB1B7991Aull),X(0xCDB9327878ull),X(0xCDC0ACD8F0ull),X(0xCDC826BA7Cull),X(0xCDCFA01D19ull),X(0xCDD71900C1ull), \
+	X(0xCDDE916571ull),X(0xCDE6094B23ull),X(0xCDED80B1D2ull),X(0xCDF4F7997Bull),X(0xCDFC6E0219ull),X(0xCE03E3EBA6ull),X(0xCE0B59561Full),X(0xCE12CE417Eull), \
+	X(0xCE1A42ADC0ull),X(0xCE21B69ADFull),X(0xCE292A08D8ull),X(0xCE309CF7A4ull),X(0xCE380F6741ull),X(0xCE3F8157A9ull),X(0xCE46F2C8D7ull),X(0xCE4E63BAC7ull), \
+	X(0xCE55D42D75ull),X(0xCE5D4420DCull),X(0xCE64B394F7ull),X(0xCE6C2289C1ull),X(0xCE7390FF37ull),X(0xCE7AFEF553ull),X(0xCE826C6C11ull),X(0xCE89D9636Cull), \
+	X(0xCE9145DB60ull),X(0xCE98B1D3E9ull),X(0xCEA01D4D01ull),X(0xCEA78846A3ull),X(0xCEAEF2C0CDull),X(0xCEB65CBB78ull),X(0xCEBDC636A1ull),X(0xCEC52F3242ull), \
+	X(0xCECC97AE57ull),X(0xCED3FFAADCull),X(0xCEDB6727CCull),X(0xCEE2CE2522ull),X(0xCEEA34A2DBull),X(0xCEF19AA0F0ull),X(0xCEF9001F5Full),X(0xCF00651E21ull), \
+	X(0xCF07C99D33ull),X(0xCF0F2D9C91ull),X(0xCF16911C34ull),X(0xCF1DF41C1Aull),X(0xCF25569C3Dull),X(0xCF2CB89C99ull),X(0xCF341A1D29ull),X(0xCF3B7B1DE9ull), \
+	X(0xCF42DB9ED4ull),X(0xCF4A3B9FE6ull),X(0xCF519B211Aull),X(0xCF58FA226Bull),X(0xCF6058A3D6ull),X(0xCF67B6A554ull),X(0xCF6F1426E3ull),X(0xCF7671287Dull), \
+	X(0xCF7DCDAA1Eull),X(0xCF8529ABC1ull),X(0xCF8C852D62ull),X(0xCF93E02EFCull),X(0xCF9B3AB08Bull),X(0xCFA294B209ull),X(0xCFA9EE3374ull),X(0xCFB14734C5ull), \
+	X(0xCFB89FB5F9ull),X(0xCFBFF7B70Bull),X(0xCFC74F37F6ull),X(0xCFCEA638B7ull),X(0xCFD5FCB948ull),X(0xCFDD52B9A4ull),X(0xCFE4A839C8ull),X(0xCFEBFD39AFull), \
+	X(0xCFF351B954ull),X(0xCFFAA5B8B3ull),X(0xD001F937C7ull),X(0xD0094C368Cull),X(0xD0109EB4FDull),X(0xD017F0B315ull),X(0xD01F4230D1ull),X(0xD026932E2Cull), \
+	X(0xD02DE3AB21ull),X(0xD03533A7ABull),X(0xD03C8323C7ull),X(0xD043D21F6Full),X(0xD04B209A9Full),X(0xD0526E9553ull),X(0xD059BC0F86ull),X(0xD061090934ull), \
+	X(0xD068558258ull),X(0xD06FA17AEDull),X(0xD076ECF2EFull),X(0xD07E37EA5Aull),X(0xD08582612Aull),X(0xD08CCC5758ull),X(0xD09415CCE2ull),X(0xD09B5EC1C3ull), \
+	X(0xD0A2A735F5ull),X(0xD0A9EF2975ull),X(0xD0B1369C3Full),X(0xD0B87D8E4Dull),X(0xD0BFC3FF9Bull),X(0xD0C709F025ull),X(0xD0CE4F5FE6ull),X(0xD0D5944ED9ull), \
+	X(0xD0DCD8BCFBull),X(0xD0E41CAA47ull),X(0xD0EB6016B8ull),X(0xD0F2A30249ull),X(0xD0F9E56CF7ull),X(0xD1012756BDull),X(0xD10868BF96ull),X(0xD10FA9A77Eull), \
+	X(0xD116EA0E70ull),X(0xD11E29F468ull),X(0xD125695962ull),X(0xD12CA83D58ull),X(0xD133E6A048ull),X(0xD13B24822Bull),X(0xD14261E2FDull),X(0xD1499EC2BBull), \
+	X(0xD150DB215Full),X(0xD15816FEE6ull),X(0xD15F525B4Aull),X(0xD1668D3688ull),X(0xD16DC7909Aull),X(0xD17501697Dull),X(0xD17C3AC12Bull),X(0xD1837397A1ull), \
+	X(0xD18AABECDAull),X(0xD191E3C0D1ull),X(0xD1991B1383ull),X(0xD1A051E4EAull),X(0xD1A7883502ull),X(0xD1AEBE03C7ull),X(0xD1B5F35134ull),X(0xD1BD281D45ull), \
+	X(0xD1C45C67F5ull),X(0xD1CB903140ull),X(0xD1D2C37922ull),X(0xD1D9F63F96ull),X(0xD1E1288497ull),X(0xD1E85A4822ull),X(0xD1EF8B8A31ull),X(0xD1F6BC4AC0ull), \
+	X(0xD1FDEC89CBull),X(0xD2051C474Eull),X(0xD20C4B8344ull),X(0xD2137A3DA8ull),X(0xD21AA87676ull),X(0xD221D62DAAull),X(0xD229036340ull),X(0xD230301732ull), \
+	X(0xD2375C497Cull),X(0xD23E87FA1Bull),X(0xD245B32909ull),X(0xD24CDDD642ull),X(0xD2540801C2ull),X(0xD25B31AB84ull),X(0xD2625AD384ull),X(0xD2698379BEull), \
+	X(0xD270AB9E2Cull),X(0xD277D340CCull),X(0xD27EFA6197ull),X(0xD28621008Aull),X(0xD28D471DA1ull),X(0xD2946CB8D7ull),X(0xD29B91D227ull),X(0xD2A2B6698Dull), \
+	X(0xD2A9DA7F05ull),X(0xD2B0FE128Bull),X(0xD2B8212419ull),X(0xD2BF43B3ACull),X(0xD2C665C13Full),X(0xD2CD874CCEull),X(0xD2D4A85654ull),X(0xD2DBC8DDCDull), \
+	X(0xD2E2E8E335ull),X(0xD2EA086687ull),X(0xD2F12767BFull),X(0xD2F845E6D8ull),X(0xD2FF63E3CEull),X(0xD306815E9Cull),X(0xD30D9E573Full),X(0xD314BACDB1ull), \
+	X(0xD31BD6C1F0ull),X(0xD322F233F5ull),X(0xD32A0D23BCull),X(0xD331279142ull),X(0xD338417C82ull),X(0xD33F5AE578ull),X(0xD34673CC1Eull),X(0xD34D8C3071ull), \
+	X(0xD354A4126Dull),X(0xD35BBB720Dull),X(0xD362D24F4Cull),X(0xD369E8AA27ull),X(0xD370FE8298ull),X(0xD37813D89Cull),X(0xD37F28AC2Eull),X(0xD3863CFD4Aull), \
+	X(0xD38D50CBECull),X(0xD39464180Eull),X(0xD39B76E1ADull),X(0xD3A28928C4ull),X(0xD3A99AED50ull),X(0xD3B0AC2F4Bull),X(0xD3B7BCEEB1ull),X(0xD3BECD2B7Eull), \
+	X(0xD3C5DCE5ADull),X(0xD3CCEC1D3Bull),X(0xD3D3FAD223ull),X(0xD3DB09045Full),X(0xD3E216B3EEull),X(0xD3E923E0C8ull),X(0xD3F0308AECull),X(0xD3F73CB253ull), \
+	X(0xD3FE4856FAull),X(0xD4055378DCull),X(0xD40C5E17F6ull),X(0xD413683442ull),X(0xD41A71CDBCull),X(0xD4217AE460ull),X(0xD42883782Aull),X(0xD42F8B8916ull), \
+	X(0xD43693171Eull),X(0xD43D9A223Full),X(0xD444A0AA74ull),X(0xD44BA6AFB9ull),X(0xD452AC320Aull),X(0xD459B13162ull),X(0xD460B5ADBEull),X(0xD467B9A717ull), \
+	X(0xD46EBD1D6Bull),X(0xD475C010B5ull),X(0xD47CC280F1ull),X(0xD483C46E1Aull),X(0xD48AC5D82Cull),X(0xD491C6BF23ull),X(0xD498C722FAull),X(0xD49FC703AEull), \
+	X(0xD4A6C66139ull),X(0xD4ADC53B97ull),X(0xD4B4C392C5ull),X(0xD4BBC166BDull),X(0xD4C2BEB77Cull),X(0xD4C9BB84FDull),X(0xD4D0B7CF3Cull),X(0xD4D7B39634ull), \
+	X(0xD4DEAED9E2ull),X(0xD4E5A99A40ull),X(0xD4ECA3D74Cull),X(0xD4F39D90FFull),X(0xD4FA96C757ull),X(0xD5018F7A4Eull),X(0xD50887A9E1ull),X(0xD50F7F560Bull), \
+	X(0xD516767EC7ull),X(0xD51D6D2413ull),X(0xD5246345E8ull),X(0xD52B58E443ull),X(0xD5324DFF21ull),X(0xD53942967Bull),X(0xD54036AA4Eull),X(0xD5472A3A97ull), \
+	X(0xD54E1D474Full),X(0xD5550FD074ull),X(0xD55C01D601ull),X(0xD562F357F2ull),X(0xD569E45642ull),X(0xD570D4D0EDull),X(0xD577C4C7EEull),X(0xD57EB43B43ull), \
+	X(0xD585A32AE5ull),X(0xD58C9196D1ull),X(0xD5937F7F03ull),X(0xD59A6CE377ull),X(0xD5A159C428ull),X(0xD5A8462111ull),X(0xD5AF31FA2Full),X(0xD5B61D4F7Eull), \
+	X(0xD5BD0820F8ull),X(0xD5C3F26E9Aull),X(0xD5CADC3860ull),X(0xD5D1C57E45ull),X(0xD5D8AE4045ull),X(0xD5DF967E5Cull),X(0xD5E67E3885ull),X(0xD5ED656EBCull), \
+	X(0xD5F44C20FEull),X(0xD5FB324F45ull),X(0xD60217F98Dull),X(0xD608FD1FD3ull),X(0xD60FE1C211ull),X(0xD616C5E045ull),X(0xD61DA97A68ull),X(0xD6248C9078ull), \
+	X(0xD62B6F2270ull),X(0xD63251304Bull),X(0xD63932BA06ull),X(0xD64013BF9Cull),X(0xD646F4410Aull),X(0xD64DD43E49ull),X(0xD654B3B758ull),X(0xD65B92AC30ull), \
+	X(0xD662711CCEull),X(0xD6694F092Full),X(0xD6702C714Cull),X(0xD677095523ull),X(0xD67DE5B4AFull),X(0xD684C18FECull),X(0xD68B9CE6D6ull),X(0xD69277B967ull), \
+	X(0xD69952079Dull),X(0xD6A02BD173ull),X(0xD6A70516E5ull),X(0xD6ADDDD7EEull),X(0xD6B4B6148Aull),X(0xD6BB8DCCB5ull),X(0xD6C265006Bull),X(0xD6C93BAFA7ull), \
+	X(0xD6D011DA66ull),X(0xD6D6E780A3ull),X(0xD6DDBCA25Aull),X(0xD6E4913F87ull),X(0xD6EB655825ull),X(0xD6F238EC30ull),X(0xD6F90BFBA5ull),X(0xD6FFDE867Eull), \
+	X(0xD706B08CB8ull),X(0xD70D820E4Eull),X(0xD714530B3Dull),X(0xD71B23837Full),X(0xD721F37712ull),X(0xD728C2E5F0ull),X(0xD72F91D015ull),X(0xD73660357Eull), \
+	X(0xD73D2E1625ull),X(0xD743FB7208ull),X(0xD74AC84921ull),X(0xD751949B6Cull),X(0xD7586068E6ull),X(0xD75F2BB18Aull),X(0xD765F67554ull),X(0xD76CC0B43Full), \
+	X(0xD7738A6E48ull),X(0xD77A53A36Aull),X(0xD7811C53A1ull),X(0xD787E47EE9ull),X(0xD78EAC253Eull),X(0xD79573469Cull),X(0xD79C39E2FEull),X(0xD7A2FFFA60ull), \
+	X(0xD7A9C58CBEull),X(0xD7B08A9A13ull),X(0xD7B74F225Dull),X(0xD7BE132596ull),X(0xD7C4D6A3BAull),X(0xD7CB999CC6ull),X(0xD7D25C10B4ull),X(0xD7D91DFF81ull), \
+	X(0xD7DFDF6929ull),X(0xD7E6A04DA8ull),X(0xD7ED60ACF8ull),X(0xD7F4208717ull),X(0xD7FADFDC00ull),X(0xD8019EABAEull),X(0xD8085CF61Eull),X(0xD80F1ABB4Cull), \
+	X(0xD815D7FB33ull),X(0xD81C94B5CFull),X(0xD82350EB1Cull),X(0xD82A0C9B16ull),X(0xD830C7C5B9ull),X(0xD837826B01ull),X(0xD83E3C8AE8ull),X(0xD844F6256Cull), \
+	X(0xD84BAF3A88ull),X(0xD85267CA38ull),X(0xD8591FD478ull),X(0xD85FD75944ull),X(0xD8668E5897ull),X(0xD86D44D26Dull),X(0xD873FAC6C3ull),X(0xD87AB03594ull), \
+	X(0xD881651EDCull),X(0xD888198296ull),X(0xD88ECD60C0ull),X(0xD89580B953ull),X(0xD89C338C4Eull),X(0xD8A2E5D9AAull),X(0xD8A997A165ull),X(0xD8B048E37Aull), \
+	X(0xD8B6F99FE4ull),X(0xD8BDA9D6A1ull),X(0xD8C45987ABull),X(0xD8CB08B2FFull),X(0xD8D1B75898ull),X(0xD8D8657872ull),X(0xD8DF131289ull),X(0xD8E5C026DAull), \
+	X(0xD8EC6CB55Full),X(0xD8F318BE16ull),X(0xD8F9C440F9ull),X(0xD9006F3E04ull),X(0xD90719B534ull),X(0xD90DC3A685ull),X(0xD9146D11F1ull),X(0xD91B15F776ull), \
+	X(0xD921BE570Full),X(0xD9286630B7ull),X(0xD92F0D846Cull),X(0xD935B45228ull),X(0xD93C5A99E8ull),X(0xD943005BA7ull),X(0xD949A59762ull),X(0xD9504A4D14ull), \
+	X(0xD956EE7CB9ull),X(0xD95D92264Eull),X(0xD9643549CDull),X(0xD96AD7E733ull),X(0xD97179FE7Cull),X(0xD9781B8FA4ull),X(0xD97EBC9AA7ull),X(0xD9855D1F80ull), \
+	X(0xD98BFD1E2Bull),X(0xD9929C96A5ull),X(0xD9993B88E9ull),X(0xD99FD9F4F4ull),X(0xD9A677DAC0ull),X(0xD9AD153A4Bull),X(0xD9B3B2138Full),X(0xD9BA4E668Aull), \
+	X(0xD9C0EA3336ull),X(0xD9C7857990ull),X(0xD9CE203994ull),X(0xD9D4BA733Dull),X(0xD9DB542688ull),X(0xD9E1ED5370ull),X(0xD9E885F9F1ull),X(0xD9EF1E1A08ull), \
+	X(0xD9F5B5B3B0ull),X(0xD9FC4CC6E5ull),X(0xDA02E353A4ull),X(0xDA097959E7ull),X(0xDA100ED9ABull),X(0xDA16A3D2EDull),X(0xDA1D3845A7ull),X(0xDA23CC31D6ull), \
+	X(0xDA2A5F9775ull),X(0xDA30F27682ull),X(0xDA3784CEF7ull),X(0xDA3E16A0D0ull),X(0xDA44A7EC0Aull),X(0xDA4B38B0A1ull),X(0xDA51C8EE90ull),X(0xDA5858A5D3ull), \
+	X(0xDA5EE7D667ull),X(0xDA65768047ull),X(0xDA6C04A36Full),X(0xDA72923FDBull),X(0xDA791F5588ull),X(0xDA7FABE470ull),X(0xDA8637EC91ull),X(0xDA8CC36DE6ull), \
+	X(0xDA934E686Aull),X(0xDA99D8DC1Bull),X(0xDAA062C8F4ull),X(0xDAA6EC2EF0ull),X(0xDAAD750E0Cull),X(0xDAB3FD6645ull),X(0xDABA853794ull),X(0xDAC10C81F8ull), \
+	X(0xDAC793456Cull),X(0xDACE1981EBull),X(0xDAD49F3771ull),X(0xDADB2465FCull),X(0xDAE1A90D86ull),X(0xDAE82D2E0Cull),X(0xDAEEB0C789ull),X(0xDAF533D9FAull), \
+	X(0xDAFBB6655Bull),X(0xDB023869A7ull),X(0xDB08B9E6DAull),X(0xDB0F3ADCF1ull),X(0xDB15BB4BE8ull),X(0xDB1C3B33BAull),X(0xDB22BA9464ull),X(0xDB29396DE1ull), \
+	X(0xDB2FB7C02Dull),X(0xDB36358B45ull),X(0xDB3CB2CF25ull),X(0xDB432F8BC8ull),X(0xDB49ABC12Aull),X(0xDB50276F48ull),X(0xDB56A2961Eull),X(0xDB5D1D35A6ull), \
+	X(0xDB63974DDFull),X(0xDB6A10DEC2ull),X(0xDB7089E84Eull),X(0xDB77026A7Cull),X(0xDB7D7A654Bull),X(0xDB83F1D8B4ull),X(0xDB8A68C4B6ull),X(0xDB90DF294Aull), \
+	X(0xDB9755066Full),X(0xDB9DCA5C1Full),X(0xDBA43F2A56ull),X(0xDBAAB37111ull),X(0xDBB127304Cull),X(0xDBB79A6802ull),X(0xDBBE0D1830ull),X(0xDBC47F40D2ull), \
+	X(0xDBCAF0E1E3ull),X(0xDBD161FB60ull),X(0xDBD7D28D45ull),X(0xDBDE42978Dull),X(0xDBE4B21A36ull),X(0xDBEB21153Aull),X(0xDBF18F8896ull),X(0xDBF7FD7446ull), \
+	X(0xDBFE6AD846ull),X(0xDC04D7B492ull),X(0xDC0B440926ull),X(0xDC11AFD5FDull),X(0xDC181B1B15ull),X(0xDC1E85D86Aull),X(0xDC24F00DF6ull),X(0xDC2B59BBB6ull), \
+	X(0xDC31C2E1A7ull),X(0xDC382B7FC4ull),X(0xDC3E939609ull),X(0xDC44FB2473ull),X(0xDC4B622AFDull),X(0xDC51C8A9A4ull),X(0xDC582EA063ull),X(0xDC5E940F37ull), \
+	X(0xDC64F8F61Cull),X(0xDC6B5D550Dull),X(0xDC71C12C07ull),X(0xDC78247B06ull),X(0xDC7E874205ull),X(0xDC84E98102ull),X(0xDC8B4B37F8ull),X(0xDC91AC66E2ull), \
+	X(0xDC980D0DBEull),X(0xDC9E6D2C87ull),X(0xDCA4CCC339ull),X(0xDCAB2BD1D1ull),X(0xDCB18A584Aull),X(0xDCB7E856A1ull),X(0xDCBE45CCD1ull),X(0xDCC4A2BAD6ull), \
+	X(0xDCCAFF20AEull),X(0xDCD15AFE53ull),X(0xDCD7B653C2ull),X(0xDCDE1120F7ull),X(0xDCE46B65EEull),X(0xDCEAC522A3ull),X(0xDCF11E5712ull),X(0xDCF7770338ull), \
+	X(0xDCFDCF270Full),X(0xDD0426C296ull),X(0xDD0A7DD5C6ull),X(0xDD10D4609Eull),X(0xDD172A6318ull),X(0xDD1D7FDD31ull),X(0xDD23D4CEE5ull),X(0xDD2A29382Full), \
+	X(0xDD307D190Dull),X(0xDD36D0717Aull),X(0xDD3D234172ull),X(0xDD437588F2ull),X(0xDD49C747F5ull),X(0xDD50187E78ull),X(0xDD56692C76ull),X(0xDD5CB951ECull), \
+	X(0xDD6308EED6ull),X(0xDD69580330ull),X(0xDD6FA68EF6ull),X(0xDD75F49224ull),X(0xDD7C420CB7ull),X(0xDD828EFEAAull),X(0xDD88DB67F9ull),X(0xDD8F2748A1ull), \
+	X(0xDD9572A09Eull),X(0xDD9BBD6FECull),X(0xDDA207B687ull),X(0xDDA851746Bull),X(0xDDAE9AA995ull),X(0xDDB4E355FFull),X(0xDDBB2B79A7ull),X(0xDDC1731489ull), \
+	X(0xDDC7BA26A1ull),X(0xDDCE00AFEAull),X(0xDDD446B061ull),X(0xDDDA8C2803ull),X(0xDDE0D116CBull),X(0xDDE7157CB5ull),X(0xDDED5959BEull),X(0xDDF39CADE1ull), \
+	X(0xDDF9DF791Bull),X(0xDE0021BB68ull),X(0xDE066374C5ull),X(0xDE0CA4A52Cull),X(0xDE12E54C9Bull),X(0xDE19256B0Dull),X(0xDE1F65007Full),X(0xDE25A40CEDull), \
+	X(0xDE2BE29053ull),X(0xDE32208AADull),X(0xDE385DFBF7ull),X(0xDE3E9AE42Dull),X(0xDE44D7434Cull),X(0xDE4B131950ull),X(0xDE514E6635ull),X(0xDE578929F6ull), \
+	X(0xDE5DC36491ull),X(0xDE63FD1601ull),X(0xDE6A363E43ull),X(0xDE706EDD52ull),X(0xDE76A6F32Bull),X(0xDE7CDE7FCAull),X(0xDE8315832Bull),X(0xDE894BFD4Aull), \
+	X(0xDE8F81EE24ull),X(0xDE95B755B5ull),X(0xDE9BEC33F8ull),X(0xDEA22088EBull),X(0xDEA8545488ull),X(0xDEAE8796CDull),X(0xDEB4BA4FB5ull),X(0xDEBAEC7F3Dull), \
+	X(0xDEC11E2561ull),X(0xDEC74F421Dull),X(0xDECD7FD56Dull),X(0xDED3AFDF4Eull),X(0xDED9DF5FBBull),X(0xDEE00E56B1ull),X(0xDEE63CC42Cull),X(0xDEEC6AA828ull), \
+	X(0xDEF29802A1ull),X(0xDEF8C4D394ull),X(0xDEFEF11AFDull),X(0xDF051CD8D7ull),X(0xDF0B480D20ull),X(0xDF1172B7D3ull),X(0xDF179CD8ECull),X(0xDF1DC67068ull), \
+	X(0xDF23EF7E43ull),X(0xDF2A180279ull),X(0xDF303FFD07ull),X(0xDF36676DE7ull),X(0xDF3C8E5518ull),X(0xDF42B4B294ull),X(0xDF48DA8659ull),X(0xDF4EFFD062ull), \
+	X(0xDF552490ABull),X(0xDF5B48C731ull),X(0xDF616C73F0ull),X(0xDF678F96E4ull),X(0xDF6DB2300Aull),X(0xDF73D43F5Dull),X(0xDF79F5C4DAull),X(0xDF8016C07Dull), \
+	X(0xDF86373242ull),X(0xDF8C571A26ull),X(0xDF92767824ull),X(0xDF98954C39ull),X(0xDF9EB39661ull),X(0xDFA4D15699ull),X(0xDFAAEE8CDCull),X(0xDFB10B3928ull), \
+	X(0xDFB7275B77ull),X(0xDFBD42F3C6ull),X(0xDFC35E0212ull),X(0xDFC9788657ull),X(0xDFCF928090ull),X(0xDFD5ABF0BBull),X(0xDFDBC4D6D4ull),X(0xDFE1DD32D6ull), \
+	X(0xDFE7F504BEull),X(0xDFEE0C4C88ull),X(0xDFF4230A30ull),X(0xDFFA393DB3ull),X(0xE0004EE70Dull),X(0xE00664063Bull),X(0xE00C789B37ull),X(0xE0128CA5FFull), \
+	X(0xE018A02690ull),X(0xE01EB31CE4ull),X(0xE024C588F9ull),X(0xE02AD76ACAull),X(0xE030E8C254ull),X(0xE036F98F94ull),X(0xE03D09D284ull),X(0xE043198B23ull), \
+	X(0xE04928B96Bull),X(0xE04F375D5Aull),X(0xE0554576EBull),X(0xE05B53061Bull),X(0xE061600AE6ull),X(0xE0676C8548ull),X(0xE06D78753Eull),X(0xE07383DAC4ull), \
+	X(0xE0798EB5D5ull),X(0xE07F99066Full),X(0xE085A2CC8Eull),X(0xE08BAC082Dull),X(0xE091B4B94Aull),X(0xE097BCDFE0ull),X(0xE09DC47BECull),X(0xE0A3CB8D6Aull), \
+	X(0xE0A9D21456ull),X(0xE0AFD810ADull),X(0xE0B5DD826Bull),X(0xE0BBE2698Bull),X(0xE0C1E6C60Cull),X(0xE0C7EA97E8ull),X(0xE0CDEDDF1Cull),X(0xE0D3F09BA4ull), \
+	X(0xE0D9F2CD7Dull),X(0xE0DFF474A3ull),X(0xE0E5F59112ull),X(0xE0EBF622C6ull),X(0xE0F1F629BCull),X(0xE0F7F5A5F1ull),X(0xE0FDF49760ull),X(0xE103F2FE05ull), \
+	X(0xE109F0D9DDull),X(0xE10FEE2AE5ull),X(0xE115EAF118ull),X(0xE11BE72C74ull),X(0xE121E2DCF3ull),X(0xE127DE0293ull),X(0xE12DD89D50ull),X(0xE133D2AD26ull), \
+	X(0xE139CC3211ull),X(0xE13FC52C0Eull),X(0xE145BD9B19ull),X(0xE14BB57F2Full),X(0xE151ACD84Cull),X(0xE157A3A66Bull),X(0xE15D99E98Aull),X(0xE1638FA1A4ull), \
+	X(0xE16984CEB7ull),X(0xE16F7970BDull),X(0xE1756D87B5ull),X(0xE17B611399ull),X(0xE181541467ull),X(0xE187468A1Bull),X(0xE18D3874B0ull),X(0xE19329D424ull), \
+	X(0xE1991AA872ull),X(0xE19F0AF197ull),X(0xE1A4FAAF90ull),X(0xE1AAE9E258ull),X(0xE1B0D889EDull),X(0xE1B6C6A649ull),X(0xE1BCB4376Bull),X(0xE1C2A13D4Dull), \
+	X(0xE1C88DB7EDull),X(0xE1CE79A746ull),X(0xE1D4650B56ull),X(0xE1DA4FE418ull),X(0xE1E03A3188ull),X(0xE1E623F3A4ull),X(0xE1EC0D2A67ull),X(0xE1F1F5D5CEull), \
+	X(0xE1F7DDF5D5ull),X(0xE1FDC58A79ull),X(0xE203AC93B6ull),X(0xE209931188ull),X(0xE20F7903EBull),X(0xE2155E6ADDull),X(0xE21B434658ull),X(0xE22127965Bull), \
+	X(0xE2270B5AE0ull),X(0xE22CEE93E5ull),X(0xE232D14166ull),X(0xE238B3635Full),X(0xE23E94F9CCull),X(0xE2447604ABull),X(0xE24A5683F6ull),X(0xE2503677ACull), \
+	X(0xE25615DFC7ull),X(0xE25BF4BC45ull),X(0xE261D30D21ull),X(0xE267B0D259ull),X(0xE26D8E0BE8ull),X(0xE2736AB9CBull),X(0xE27946DBFFull),X(0xE27F22727Full), \
+	X(0xE284FD7D48ull),X(0xE28AD7FC57ull),X(0xE290B1EFA8ull),X(0xE2968B5737ull),X(0xE29C643300ull),X(0xE2A23C8301ull),X(0xE2A8144735ull),X(0xE2ADEB7F98ull), \
+	X(0xE2B3C22C28ull),X(0xE2B9984CE1ull),X(0xE2BF6DE1BFull),X(0xE2C542EABEull),X(0xE2CB1767DBull),X(0xE2D0EB5912ull),X(0xE2D6BEBE60ull),X(0xE2DC9197C1ull), \
+	X(0xE2E263E531ull),X(0xE2E835A6ADull),X(0xE2EE06DC32ull),X(0xE2F3D785BBull),X(0xE2F9A7A345ull),X(0xE2FF7734CDull),X(0xE305463A4Full),X(0xE30B14B3C7ull), \
+	X(0xE310E2A131ull),X(0xE316B0028Bull),X(0xE31C7CD7D1ull),X(0xE3224920FFull),X(0xE32814DE11ull),X(0xE32DE00F03ull),X(0xE333AAB3D4ull),X(0xE33974CC7Eull), \
+	X(0xE33F3E58FEull),X(0xE345075950ull),X(0xE34ACFCD72ull),X(0xE35097B55Full),X(0xE3565F1114ull),X(0xE35C25E08Eull),X(0xE361EC23C8ull),X(0xE367B1DABFull), \
+	X(0xE36D770570ull),X(0xE3733BA3D7ull),X(0xE378FFB5F0ull),X(0xE37EC33BB9ull),X(0xE38486352Dull),X(0xE38A48A248ull),X(0xE3900A8309ull),X(0xE395CBD769ull), \
+	X(0xE39B8C9F67ull),X(0xE3A14CDAFFull),X(0xE3A70C8A2Dull),X(0xE3ACCBACEDull),X(0xE3B28A433Cull),X(0xE3B8484D17ull),X(0xE3BE05CA79ull),X(0xE3C3C2BB61ull), \
+	X(0xE3C97F1FC8ull),X(0xE3CF3AF7AEull),X(0xE3D4F6430Dull),X(0xE3DAB101E2ull),X(0xE3E06B342Aull),X(0xE3E624D9E1ull),X(0xE3EBDDF303ull),X(0xE3F1967F8Eull), \
+	X(0xE3F74E7F7Dull),X(0xE3FD05F2CEull),X(0xE402BCD97Cull),X(0xE408733384ull),X(0xE40E2900E2ull),X(0xE413DE4193ull),X(0xE41992F594ull),X(0xE41F471CE1ull), \
+	X(0xE424FAB776ull),X(0xE42AADC550ull),X(0xE43060466Bull),X(0xE436123AC4ull),X(0xE43BC3A258ull),X(0xE441747D22ull),X(0xE44724CB1Full),X(0xE44CD48C4Dull), \
+	X(0xE45283C0A7ull),X(0xE458326829ull),X(0xE45DE082D1ull),X(0xE4638E109Aull),X(0xE4693B1182ull),X(0xE46EE78585ull),X(0xE474936C9Eull),X(0xE47A3EC6CCull), \
+	X(0xE47FE9940Aull),X(0xE48593D455ull),X(0xE48B3D87A8ull),X(0xE490E6AE02ull),X(0xE4968F475Eull),X(0xE49C3753B9ull),X(0xE4A1DED30Full),X(0xE4A785C55Dull), \
+	X(0xE4AD2C2AA0ull),X(0xE4B2D202D3ull),X(0xE4B8774DF3ull),X(0xE4BE1C0BFEull),X(0xE4C3C03CEFull),X(0xE4C963E0C3ull),X(0xE4CF06F776ull),X(0xE4D4A98105ull), \
+	X(0xE4DA4B7D6Dull),X(0xE4DFECECAAull),X(0xE4E58DCEB8ull),X(0xE4EB2E2394ull),X(0xE4F0CDEB3Bull),X(0xE4F66D25AAull),X(0xE4FC0BD2DCull),X(0xE501A9F2CEull), \
+	X(0xE50747857Cull),X(0xE50CE48AE5ull),X(0xE512810302ull),X(0xE5181CEDD3ull),X(0xE51DB84B52ull),X(0xE523531B7Cull),X(0xE528ED5E4Full),X(0xE52E8713C6ull), \
+	X(0xE534203BDEull),X(0xE539B8D694ull),X(0xE53F50E3E4ull),X(0xE544E863CBull),X(0xE54A7F5645ull),X(0xE55015BB4Eull),X(0xE555AB92E4ull),X(0xE55B40DD03ull), \
+	X(0xE560D599A8ull),X(0xE56669C8CFull),X(0xE56BFD6A74ull),X(0xE571907E94ull),X(0xE57723052Cull),X(0xE57CB4FE38ull),X(0xE5824669B5ull),X(0xE587D747A0ull), \
+	X(0xE58D6797F5ull),X(0xE592F75AB0ull),X(0xE598868FCEull),X(0xE59E15374Cull),X(0xE5A3A35126ull),X(0xE5A930DD59ull),X(0xE5AEBDDBE1ull),X(0xE5B44A4CBBull), \
+	X(0xE5B9D62FE4ull),X(0xE5BF618558ull),X(0xE5C4EC4D14ull),X(0xE5CA768714ull),X(0xE5D0003355ull),X(0xE5D58951D4ull),X(0xE5DB11E28Cull),X(0xE5E099E57Bull), \
+	X(0xE5E6215A9Dull),X(0xE5EBA841EFull),X(0xE5F12E9B6Eull),X(0xE5F6B46716ull),X(0xE5FC39A4E3ull),X(0xE601BE54D2ull),X(0xE6074276E0ull),X(0xE60CC60B09ull), \
+	X(0xE61249114Bull),X(0xE617CB89A1ull),X(0xE61D4D7408ull),X(0xE622CED07Dull),X(0xE6284F9EFCull),X(0xE62DCFDF83ull),X(0xE6334F920Dull),X(0xE638CEB697ull), \
+	X(0xE63E4D4D1Eull),X(0xE643CB559Eull),X(0xE64948D015ull),X(0xE64EC5BC7Eull),X(0xE654421AD6ull),X(0xE659BDEB1Aull),X(0xE65F392D47ull),X(0xE664B3E159ull), \
+	X(0xE66A2E074Cull),X(0xE66FA79F1Eull),X(0xE67520A8CBull),X(0xE67A992450ull),X(0xE6801111A8ull),X(0xE6858870D2ull),X(0xE68AFF41C9ull),X(0xE69075848Aull), \
+	X(0xE695EB3912ull),X(0xE69B605F5Dull),X(0xE6A0D4F769ull),X(0xE6A6490131ull),X(0xE6ABBC7CB2ull),X(0xE6B12F69E9ull),X(0xE6B6A1C8D3ull),X(0xE6BC13996Cull), \
+	X(0xE6C184DBB1ull),X(0xE6C6F58F9Eull),X(0xE6CC65B530ull),X(0xE6D1D54C65ull),X(0xE6D7445537ull),X(0xE6DCB2CFA5ull),X(0xE6E220BBAAull),X(0xE6E78E1944ull), \
+	X(0xE6ECFAE86Full),X(0xE6F2672927ull),X(0xE6F7D2DB6Aull),X(0xE6FD3DFF34ull),X(0xE702A89481ull),X(0xE708129B4Full),X(0xE70D7C139Aull),X(0xE712E4FD5Eull), \
+	X(0xE7184D5898ull),X(0xE71DB52546ull),X(0xE7231C6363ull),X(0xE7288312ECull),X(0xE72DE933DFull),X(0xE7334EC637ull),X(0xE738B3C9F1ull),X(0xE73E183F0Aull), \
+	X(0xE7437C257Full),X(0xE748DF7D4Dull),X(0xE74E42466Full),X(0xE753A480E3ull),X(0xE759062CA5ull),X(0xE75E6749B2ull),X(0xE763C7D807ull),X(0xE76927D7A0ull), \
+	X(0xE76E87487Bull),X(0xE773E62A93ull),X(0xE779447DE6ull),X(0xE77EA2426Full),X(0xE783FF782Dull),X(0xE7895C1F1Bull),X(0xE78EB83737ull),X(0xE79413C07Cull), \
+	X(0xE7996EBAE8ull),X(0xE79EC92677ull),X(0xE7A4230326ull),X(0xE7A97C50F2ull),X(0xE7AED50FD7ull),X(0xE7B42D3FD2ull),X(0xE7B984E0E0ull),X(0xE7BEDBF2FEull), \
+	X(0xE7C4327628ull),X(0xE7C9886A5Bull),X(0xE7CEDDCF93ull),X(0xE7D432A5CEull),X(0xE7D986ED08ull),X(0xE7DEDAA53Dull),X(0xE7E42DCE6Bull),X(0xE7E980688Eull), \
+	X(0xE7EED273A3ull),X(0xE7F423EFA7ull),X(0xE7F974DC96ull),X(0xE7FEC53A6Dull),X(0xE804150929ull),X(0xE8096448C7ull),X(0xE80EB2F942ull),X(0xE814011A99ull), \
+	X(0xE8194EACC7ull),X(0xE81E9BAFCAull),X(0xE823E8239Eull),X(0xE829340840ull),X(0xE82E7F5DACull),X(0xE833CA23E0ull),X(0xE839145AD8ull),X(0xE83E5E0290ull), \
+	X(0xE843A71B06ull),X(0xE848EFA437ull),X(0xE84E379E1Eull),X(0xE8537F08BAull),X(0xE858C5E406ull),X(0xE85E0C2FFFull),X(0xE86351ECA2ull),X(0xE8689719ECull), \
+	X(0xE86DDBB7D9ull),X(0xE8731FC667ull),X(0xE878634591ull),X(0xE87DA63556ull),X(0xE882E895B1ull),X(0xE8882A669Full),X(0xE88D6BA81Dull),X(0xE892AC5A28ull), \
+	X(0xE897EC7CBDull),X(0xE89D2C0FD8ull),X(0xE8A26B1376ull),X(0xE8A7A98794ull),X(0xE8ACE76C2Eull),X(0xE8B224C142ull),X(0xE8B76186CCull),X(0xE8BC9DBCC9ull), \
+	X(0xE8C1D96335ull),X(0xE8C7147A0Eull),X(0xE8CC4F0150ull),X(0xE8D188F8F9ull),X(0xE8D6C26104ull),X(0xE8DBFB396Eull),X(0xE8E1338235ull),X(0xE8E66B3B55ull), \
+	X(0xE8EBA264CBull),X(0xE8F0D8FE94ull),X(0xE8F60F08ACull),X(0xE8FB448310ull),X(0xE900796DBDull),X(0xE905ADC8B0ull),X(0xE90AE193E6ull),X(0xE91014CF5Bull), \
+	X(0xE915477B0Dull),X(0xE91A7996F7ull),X(0xE91FAB2317ull),X(0xE924DC1F6Aull),X(0xE92A0C8BECull),X(0xE92F3C689Aull),X(0xE9346BB571ull),X(0xE9399A726Eull), \
+	X(0xE93EC89F8Eull),X(0xE943F63CCDull),X(0xE949234A28ull),X(0xE94E4FC79Cull),X(0xE9537BB526ull),X(0xE958A712C3ull),X(0xE95DD1E06Full),X(0xE962FC1E27ull), \
+	X(0xE96825CBE9ull),X(0xE96D4EE9B0ull),X(0xE97277777Aull),X(0xE9779F7543ull),X(0xE97CC6E309ull),X(0xE981EDC0C8ull),X(0xE987140E7Dull),X(0xE98C39CC24ull), \
+	X(0xE9915EF9BBull),X(0xE99683973Full),X(0xE99BA7A4ACull),X(0xE9A0CB21FFull),X(0xE9A5EE0F35ull),X(0xE9AB106C4Bull),X(0xE9B032393Dull),X(0xE9B5537609ull), \
+	X(0xE9BA7422ABull),X(0xE9BF943F20ull),X(0xE9C4B3CB65ull),X(0xE9C9D2C777ull),X(0xE9CEF13353ull),X(0xE9D40F0EF4ull),X(0xE9D92C5A5Aull),X(0xE9DE49157Full), \
+	X(0xE9E3654061ull),X(0xE9E880DAFEull),X(0xE9ED9BE551ull),X(0xE9F2B65F57ull),X(0xE9F7D0490Eull),X(0xE9FCE9A272ull),X(0xEA02026B80ull),X(0xEA071AA436ull), \
+	X(0xEA0C324C8Full),X(0xEA11496488ull),X(0xEA165FEC1Full),X(0xEA1B75E351ull),X(0xEA208B4A1Aull),X(0xEA25A02077ull),X(0xEA2AB46665ull),X(0xEA2FC81BE1ull), \
+	X(0xEA34DB40E8ull),X(0xEA39EDD576ull),X(0xEA3EFFD988ull),X(0xEA44114D1Cull),X(0xEA4922302Full),X(0xEA4E3282BCull),X(0xEA534244C1ull),X(0xEA5851763Bull), \
+	X(0xEA5D601727ull),X(0xEA626E2782ull),X(0xEA677BA747ull),X(0xEA6C889676ull),X(0xEA7194F509ull),X(0xEA76A0C2FFull),X(0xEA7BAC0054ull),X(0xEA80B6AD04ull), \
+	X(0xEA85C0C90Eull),X(0xEA8ACA546Dull),X(0xEA8FD34F1Full),X(0xEA94DBB920ull),X(0xEA99E3926Dull),X(0xEA9EEADB04ull),X(0xEAA3F192E1ull),X(0xEAA8F7BA01ull), \
+	X(0xEAADFD5061ull),X(0xEAB30255FEull),X(0xEAB806CAD5ull),X(0xEABD0AAEE2ull),X(0xEAC20E0223ull),X(0xEAC710C495ull),X(0xEACC12F634ull),X(0xEAD11496FDull), \
+	X(0xEAD615A6EDull),X(0xEADB162602ull),X(0xEAE0161438ull),X(0xEAE515718Bull),X(0xEAEA143DFAull),X(0xEAEF127980ull),X(0xEAF410241Bull),X(0xEAF90D3DC8ull), \
+	X(0xEAFE09C683ull),X(0xEB0305BE4Aull),X(0xEB08012519ull),X(0xEB0CFBFAEEull),X(0xEB11F63FC4ull),X(0xEB16EFF39Aull),X(0xEB1BE9166Dull),X(0xEB20E1A838ull), \
+	X(0xEB25D9A8F9ull),X(0xEB2AD118ADull),X(0xEB2FC7F751ull),X(0xEB34BE44E2ull),X(0xEB39B4015Dull),X(0xEB3EA92CBEull),X(0xEB439DC703ull),X(0xEB4891D029ull), \
+	X(0xEB4D85482Cull),X(0xEB52782F09ull),X(0xEB576A84BEull),X(0xEB5C5C4948ull),X(0xEB614D7CA2ull),X(0xEB663E1ECBull),X(0xEB6B2E2FBFull),X(0xEB701DAF7Bull), \
+	X(0xEB750C9DFDull),X(0xEB79FAFB40ull),X(0xEB7EE8C743ull),X(0xEB83D60201ull),X(0xEB88C2AB79ull),X(0xEB8DAEC3A6ull),X(0xEB929A4A87ull),X(0xEB97854017ull), \
+	X(0xEB9C6FA454ull),X(0xEBA159773Bull),X(0xEBA642B8C8ull),X(0xEBAB2B68F9ull),X(0xEBB01387CBull),X(0xEBB4FB153Bull),X(0xEBB9E21145ull),X(0xEBBEC87BE7ull), \
+	X(0xEBC3AE551Eull),X(0xEBC8939CE6ull),X(0xEBCD78533Dull),X(0xEBD25C781Full),X(0xEBD7400B8Aull),X(0xEBDC230D7Aull),X(0xEBE1057DEDull),X(0xEBE5E75CDFull), \
+	X(0xEBEAC8AA4Eull),X(0xEBEFA96636ull),X(0xEBF4899094ull),X(0xEBF9692966ull),X(0xEBFE4830A9ull),X(0xEC0326A659ull),X(0xEC08048A73ull),X(0xEC0CE1DCF5ull), \
+	X(0xEC11BE9DDBull),X(0xEC169ACD23ull),X(0xEC1B766AC9ull),X(0xEC205176CBull),X(0xEC252BF125ull),X(0xEC2A05D9D4ull),X(0xEC2EDF30D6ull),X(0xEC33B7F627ull), \
+	X(0xEC389029C5ull),X(0xEC3D67CBACull),X(0xEC423EDBDAull),X(0xEC47155A4Bull),X(0xEC4BEB46FDull),X(0xEC50C0A1ECull),X(0xEC55956B16ull),X(0xEC5A69A278ull), \
+	X(0xEC5F3D480Eull),X(0xEC64105BD6ull),X(0xEC68E2DDCCull),X(0xEC6DB4CDEEull),X(0xEC72862C39ull),X(0xEC7756F8A9ull),X(0xEC7C27333Cull),X(0xEC80F6DBEFull), \
+	X(0xEC85C5F2BFull),X(0xEC8A9477A9ull),X(0xEC8F626AAAull),X(0xEC942FCBBEull),X(0xEC98FC9AE4ull),X(0xEC9DC8D817ull),X(0xECA2948356ull),X(0xECA75F9C9Cull), \
+	X(0xECAC2A23E8ull),X(0xECB0F41936ull),X(0xECB5BD7C83ull),X(0xECBA864DCCull),X(0xECBF4E8D0Full),X(0xECC4163A48ull),X(0xECC8DD5575ull),X(0xECCDA3DE92ull), \
+	X(0xECD269D59Cull),X(0xECD72F3A91ull),X(0xECDBF40D6Eull),X(0xECE0B84E2Full),X(0xECE57BFCD3ull),X(0xECEA3F1955ull),X(0xECEF01A3B2ull),X(0xECF3C39BE9ull), \
+	X(0xECF88501F6ull),X(0xECFD45D5D6ull),X(0xED02061786ull),X(0xED06C5C703ull),X(0xED0B84E44Bull),X(0xED10436F5Aull),X(0xED1501682Dull),X(0xED19BECEC2ull), \
+	X(0xED1E7BA315ull),X(0xED2337E524ull),X(0xED27F394ECull),X(0xED2CAEB26Aull),X(0xED31693D9Aull),X(0xED3623367Bull),X(0xED3ADC9D08ull),X(0xED3F957140ull), \
+	X(0xED444DB31Full),X(0xED490562A2ull),X(0xED4DBC7FC7ull),X(0xED52730A8Aull),X(0xED572902E9ull),X(0xED5BDE68E0ull),X(0xED60933C6Dull),X(0xED65477D8Eull), \
+	X(0xED69FB2C3Eull),X(0xED6EAE487Bull),X(0xED7360D242ull),X(0xED7812C991ull),X(0xED7CC42E64ull),X(0xED817500B9ull),X(0xED8625408Cull),X(0xED8AD4EDDBull), \
+	X(0xED8F8408A3ull),X(0xED943290E0ull),X(0xED98E08691ull),X(0xED9D8DE9B2ull),X(0xEDA23ABA40ull),X(0xEDA6E6F839ull),X(0xEDAB92A399ull),X(0xEDB03DBC5Dull), \
+	X(0xEDB4E84284ull),X(0xEDB9923609ull),X(0xEDBE3B96EAull),X(0xEDC2E46525ull),X(0xEDC78CA0B5ull),X(0xEDCC344999ull),X(0xEDD0DB5FCEull),X(0xEDD581E350ull), \
+	X(0xEDDA27D41Dull),X(0xEDDECD3232ull),X(0xEDE371FD8Bull),X(0xEDE8163627ull),X(0xEDECB9DC03ull),X(0xEDF15CEF1Aull),X(0xEDF5FF6F6Cull),X(0xEDFAA15CF4ull), \
+	X(0xEDFF42B7AFull),X(0xEE03E37F9Cull),X(0xEE0883B4B7ull),X(0xEE0D2356FEull),X(0xEE11C2666Cull),X(0xEE1660E301ull),X(0xEE1AFECCB8ull),X(0xEE1F9C238Full), \
+	X(0xEE2438E783ull),X(0xEE28D51891ull),X(0xEE2D70B6B6ull),X(0xEE320BC1F0ull),X(0xEE36A63A3Cull),X(0xEE3B401F97ull),X(0xEE3FD971FDull),X(0xEE4472316Dull), \
+	X(0xEE490A5DE3ull),X(0xEE4DA1F75Dull),X(0xEE5238FDD7ull),X(0xEE56CF714Full),X(0xEE5B6551C2ull),X(0xEE5FFA9F2Dull),X(0xEE648F598Eull),X(0xEE692380E1ull), \
+	X(0xEE6DB71524ull),X(0xEE724A1653ull),X(0xEE76DC846Dull),X(0xEE7B6E5F6Eull),X(0xEE7FFFA753ull),X(0xEE84905C1Aull),X(0xEE89207DC0ull),X(0xEE8DB00C42ull), \
+	X(0xEE923F079Cull),X(0xEE96CD6FCEull),X(0xEE9B5B44D2ull),X(0xEE9FE886A8ull),X(0xEEA475354Bull),X(0xEEA90150B9ull),X(0xEEAD8CD8F0ull),X(0xEEB217CDECull), \
+	X(0xEEB6A22FABull),X(0xEEBB2BFE2Aull),X(0xEEBFB53965ull),X(0xEEC43DE15Cull),X(0xEEC8C5F609ull),X(0xEECD4D776Cull),X(0xEED1D46580ull),X(0xEED65AC043ull), \
+	X(0xEEDAE087B3ull),X(0xEEDF65BBCCull),X(0xEEE3EA5C8Cull),X(0xEEE86E69F0ull),X(0xEEECF1E3F5ull),X(0xEEF174CA98ull),X(0xEEF5F71DD7ull),X(0xEEFA78DDAFull), \
+	X(0xEEFEFA0A1Dull),X(0xEF037AA31Eull),X(0xEF07FAA8B0ull),X(0xEF0C7A1ACFull),X(0xEF10F8F97Aull),X(0xEF157744ACull),X(0xEF19F4FC64ull),X(0xEF1E72209Full), \
+	X(0xEF22EEB159ull),X(0xEF276AAE90ull),X(0xEF2BE61842ull),X(0xEF3060EE6Bull),X(0xEF34DB3109ull),X(0xEF3954E01Aull),X(0xEF3DCDFB99ull),X(0xEF42468385ull), \
+	X(0xEF46BE77DBull),X(0xEF4B35D897ull),X(0xEF4FACA5B8ull),X(0xEF5422DF3Aull),X(0xEF5898851Cull),X(0xEF5D0D9759ull),X(0xEF618215EFull),X(0xEF65F600DCull), \
+	X(0xEF6A69581Cull),X(0xEF6EDC1BAEull),X(0xEF734E4B8Eull),X(0xEF77BFE7B9ull),X(0xEF7C30F02Dull),X(0xEF80A164E7ull),X(0xEF851145E4ull),X(0xEF89809322ull), \
+	X(0xEF8DEF4C9Eull),X(0xEF925D7255ull),X(0xEF96CB0444ull),X(0xEF9B380269ull),X(0xEF9FA46CC1ull),X(0xEFA4104348ull),X(0xEFA87B85FEull),X(0xEFACE634DEull), \
+	X(0xEFB1504FE5ull),X(0xEFB5B9D713ull),X(0xEFBA22CA62ull),X(0xEFBE8B29D2ull),X(0xEFC2F2F55Full),X(0xEFC75A2D06ull),X(0xEFCBC0D0C4ull),X(0xEFD026E098ull), \
+	X(0xEFD48C5C7Eull),X(0xEFD8F14473ull),X(0xEFDD559875ull),X(0xEFE1B95882ull),X(0xEFE61C8495ull),X(0xEFEA7F1CAEull),X(0xEFEEE120C8ull),X(0xEFF34290E2ull), \
+	X(0xEFF7A36CF8ull),X(0xEFFC03B508ull),X(0xF00063690Full),X(0xF004C2890Bull),X(0xF0092114F9ull),X(0xF00D7F0CD5ull),X(0xF011DC709Eull),X(0xF016394051ull), \
+	X(0xF01A957BEBull),X(0xF01EF12369ull),X(0xF0234C36C9ull),X(0xF027A6B607ull),X(0xF02C00A122ull),X(0xF03059F817ull),X(0xF034B2BAE2ull),X(0xF0390AE981ull), \
+	X(0xF03D6283F3ull),X(0xF041B98A33ull),X(0xF0460FFC3Full),X(0xF04A65DA14ull),X(0xF04EBB23B1ull),X(0xF0530FD911ull),X(0xF05763FA34ull),X(0xF05BB78714ull), \
+	X(0xF0600A7FB1ull),X(0xF0645CE408ull),X(0xF068AEB415ull),X(0xF06CFFEFD7ull),X(0xF07150974Aull),X(0xF075A0AA6Cull),X(0xF079F0293Aull),X(0xF07E3F13B1ull), \
+	X(0xF0828D69CFull),X(0xF086DB2B92ull),X(0xF08B2858F6ull),X(0xF08F74F1F9ull),X(0xF093C0F698ull),X(0xF0980C66D1ull),X(0xF09C5742A0ull),X(0xF0A0A18A04ull), \
+	X(0xF0A4EB3CFAull),X(0xF0A9345B7Eull),X(0xF0AD7CE58Full),X(0xF0B1C4DB2Aull),X(0xF0B60C3C4Bull),X(0xF0BA5308F1ull),X(0xF0BE994119ull),X(0xF0C2DEE4C0ull), \
+	X(0xF0C723F3E4ull),X(0xF0CB686E81ull),X(0xF0CFAC5496ull),X(0xF0D3EFA61Full),X(0xF0D832631Aull),X(0xF0DC748B85ull),X(0xF0E0B61F5Cull),X(0xF0E4F71E9Eull), \
+	X(0xF0E9378947ull),X(0xF0ED775F55ull),X(0xF0F1B6A0C5ull),X(0xF0F5F54D94ull),X(0xF0FA3365C1ull),X(0xF0FE70E948ull),X(0xF102ADD827ull),X(0xF106EA325Bull), \
+	X(0xF10B25F7E1ull),X(0xF10F6128B8ull),X(0xF1139BC4DBull),X(0xF117D5CC4Aull),X(0xF11C0F3F00ull),X(0xF120481CFCull),X(0xF12480663Bull),X(0xF128B81ABAull), \
+	X(0xF12CEF3A77ull),X(0xF13125C56Full),X(0xF1355BBBA0ull),X(0xF139911D06ull),X(0xF13DC5E9A0ull),X(0xF141FA216Aull),X(0xF1462DC463ull),X(0xF14A60D287ull), \
+	X(0xF14E934BD4ull),X(0xF152C53047ull),X(0xF156F67FDEull),X(0xF15B273A96ull),X(0xF15F57606Dull),X(0xF16386F160ull),X(0xF167B5ED6Cull),X(0xF16BE4548Full), \
+	X(0xF1701226C6ull),X(0xF1743F640Full),X(0xF1786C0C67ull),X(0xF17C981FCCull),X(0xF180C39E3Aull),X(0xF184EE87B0ull),X(0xF18918DC2Bull),X(0xF18D429BA7ull), \
+	X(0xF1916BC624ull),X(0xF195945B9Eull),X(0xF199BC5C12ull),X(0xF19DE3C77Eull),X(0xF1A20A9DE0ull),X(0xF1A630DF34ull),X(0xF1AA568B79ull),X(0xF1AE7BA2ABull), \
+	X(0xF1B2A024C9ull),X(0xF1B6C411CFull),X(0xF1BAE769BCull),X(0xF1BF0A2C8Cull),X(0xF1C32C5A3Cull),X(0xF1C74DF2CCull),X(0xF1CB6EF637ull),X(0xF1CF8F647Bull), \
+	X(0xF1D3AF3D96ull),X(0xF1D7CE8186ull),X(0xF1DBED3047ull),X(0xF1E00B49D7ull),X(0xF1E428CE34ull),X(0xF1E845BD5Bull),X(0xF1EC621749ull),X(0xF1F07DDBFDull), \
+	X(0xF1F4990B72ull),X(0xF1F8B3A5A8ull),X(0xF1FCCDAA9Bull),X(0xF200E71A4Aull),X(0xF204FFF4B0ull),X(0xF2091839CCull),X(0xF20D2FE99Cull),X(0xF21147041Cull), \
+	X(0xF2155D894Aull),X(0xF219737925ull),X(0xF21D88D3A8ull),X(0xF2219D98D2ull),X(0xF225B1C8A0ull),X(0xF229C56310ull),X(0xF22DD8681Full),X(0xF231EAD7CBull), \
+	X(0xF235FCB210ull),X(0xF23A0DF6EEull),X(0xF23E1EA660ull),X(0xF2422EC065ull),X(0xF2463E44FAull),X(0xF24A4D341Dull),X(0xF24E5B8DCAull),X(0xF252695200ull), \
+	X(0xF2567680BDull),X(0xF25A8319FCull),X(0xF25E8F1DBDull),X(0xF2629A8BFDull),X(0xF266A564B8ull),X(0xF26AAFA7EDull),X(0xF26EB95599ull),X(0xF272C26DBAull), \
+	X(0xF276CAF04Dull),X(0xF27AD2DD50ull),X(0xF27EDA34BFull),X(0xF282E0F699ull),X(0xF286E722DCull),X(0xF28AECB984ull),X(0xF28EF1BA8Full),X(0xF292F625FBull), \
+	X(0xF296F9FBC5ull),X(0xF29AFD3BEBull),X(0xF29EFFE66Aull),X(0xF2A301FB41ull),X(0xF2A7037A6Bull),X(0xF2AB0463E7ull),X(0xF2AF04B7B3ull),X(0xF2B30475CCull), \
+	X(0xF2B7039E2Full),X(0xF2BB0230DAull),X(0xF2BF002DCAull),X(0xF2C2FD94FEull),X(0xF2C6FA6672ull),X(0xF2CAF6A225ull),X(0xF2CEF24813ull),X(0xF2D2ED583Aull), \
+	X(0xF2D6E7D299ull),X(0xF2DAE1B72Bull),X(0xF2DEDB05EFull),X(0xF2E2D3BEE3ull),X(0xF2E6CBE204ull),X(0xF2EAC36F4Full),X(0xF2EEBA66C3ull),X(0xF2F2B0C85Cull), \
+	X(0xF2F6A69418ull),X(0xF2FA9BC9F5ull),X(0xF2FE9069F0ull),X(0xF302847407ull),X(0xF30677E838ull),X(0xF30A6AC67Full),X(0xF30E5D0EDBull),X(0xF3124EC149ull), \
+	X(0xF3163FDDC7ull),X(0xF31A306452ull),X(0xF31E2054E8ull),X(0xF3220FAF87ull),X(0xF325FE742Bull),X(0xF329ECA2D3ull),X(0xF32DDA3B7Cull),X(0xF331C73E24ull), \
+	X(0xF335B3AAC7ull),X(0xF3399F8165ull),X(0xF33D8AC1FAull),X(0xF341756C85ull),X(0xF3455F8102ull),X(0xF34948FF6Full),X(0xF34D31E7C9ull),X(0xF3511A3A10ull), \
+	X(0xF35501F63Full),X(0xF358E91C54ull),X(0xF35CCFAC4Eull),X(0xF360B5A62Aull),X(0xF3649B09E4ull),X(0xF3687FD77Cull),X(0xF36C640EEEull),X(0xF37047B039ull), \
+	X(0xF3742ABB59ull),X(0xF3780D304Cull),X(0xF37BEF0F11ull),X(0xF37FD057A4ull),X(0xF383B10A03ull),X(0xF38791262Bull),X(0xF38B70AC1Bull),X(0xF38F4F9BD1ull), \
+	X(0xF3932DF548ull),X(0xF3970BB880ull),X(0xF39AE8E576ull),X(0xF39EC57C27ull),X(0xF3A2A17C91ull),X(0xF3A67CE6B2ull),X(0xF3AA57BA87ull),X(0xF3AE31F80Eull), \
+	X(0xF3B20B9F44ull),X(0xF3B5E4B028ull),X(0xF3B9BD2AB6ull),X(0xF3BD950EEDull),X(0xF3C16C5CCAull),X(0xF3C543144Aull),X(0xF3C919356Cull),X(0xF3CCEEC02Dull), \
+	X(0xF3D0C3B48Aull),X(0xF3D4981282ull),X(0xF3D86BDA11ull),X(0xF3DC3F0B36ull),X(0xF3E011A5EEull),X(0xF3E3E3AA37ull),X(0xF3E7B5180Eull),X(0xF3EB85EF71ull), \
+	X(0xF3EF56305Eull),X(0xF3F325DAD2ull),X(0xF3F6F4EECBull),X(0xF3FAC36C47ull),X(0xF3FE915343ull),X(0xF4025EA3BDull),X(0xF4062B5DB3ull),X(0xF409F78122ull), \
+	X(0xF40DC30E08ull),X(0xF4118E0462ull),X(0xF41558642Full),X(0xF419222D6Bull),X(0xF41CEB6015ull),X(0xF420B3FC2Bull),X(0xF4247C01A9ull),X(0xF42843708Eull), \
+	X(0xF42C0A48D7ull),X(0xF42FD08A82ull),X(0xF43396358Cull),X(0xF4375B49F4ull),X(0xF43B1FC7B7ull),X(0xF43EE3AED2ull),X(0xF442A6FF44ull),X(0xF44669B909ull), \
+	X(0xF44A2BDC20ull),X(0xF44DED6887ull),X(0xF451AE5E3Aull),X(0xF4556EBD38ull),X(0xF4592E857Full),X(0xF45CEDB70Bull),X(0xF460AC51DBull),X(0xF4646A55EDull), \
+	X(0xF46827C33Eull),X(0xF46BE499CBull),X(0xF46FA0D994ull),X(0xF4735C8294ull),X(0xF4771794CAull),X(0xF47AD21034ull),X(0xF47E8BF4CFull),X(0xF482454299ull), \
+	X(0xF485FDF990ull),X(0xF489B619B1ull),X(0xF48D6DA2FBull),X(0xF49124956Aull),X(0xF494DAF0FDull),X(0xF49890B5B1ull),X(0xF49C45E384ull),X(0xF49FFA7A73ull), \
+	X(0xF4A3AE7A7Dull),X(0xF4A761E39Full),X(0xF4AB14B5D7ull),X(0xF4AEC6F123ull),X(0xF4B278957Full),X(0xF4B629A2EBull),X(0xF4B9DA1963ull),X(0xF4BD89F8E6ull), \
+	X(0xF4C1394171ull),X(0xF4C4E7F302ull),X(0xF4C8960D96ull),X(0xF4CC43912Cull),X(0xF4CFF07DC1ull),X(0xF4D39CD353ull),X(0xF4D74891DFull),X(0xF4DAF3B963ull), \
+	X(0xF4DE9E49DEull),X(0xF4E248434Cull),X(0xF4E5F1A5ABull),X(0xF4E99A70FAull),X(0xF4ED42A536ull),X(0xF4F0EA425Dull),X(0xF4F491486Cull),X(0xF4F837B761ull), \
+	X(0xF4FBDD8F3Aull),X(0xF4FF82CFF5ull),X(0xF50327798Full),X(0xF506CB8C07ull),X(0xF50A6F0759ull),X(0xF50E11EB84ull),X(0xF511B43886ull),X(0xF51555EE5Cull), \
+	X(0xF518F70D04ull),X(0xF51C97947Bull),X(0xF5203784C0ull),X(0xF523D6DDD1ull),X(0xF527759FAAull),X(0xF52B13CA4Aull),X(0xF52EB15DAFull),X(0xF5324E59D6ull), \
+	X(0xF535EABEBEull),X(0xF539868C63ull),X(0xF53D21C2C4ull),X(0xF540BC61DEull),X(0xF5445669B0ull),X(0xF547EFDA36ull),X(0xF54B88B370ull),X(0xF54F20F559ull), \
+	X(0xF552B89FF2ull),X(0xF5564FB336ull),X(0xF559E62F24ull),X(0xF55D7C13BAull),X(0xF5611160F6ull),X(0xF564A616D4ull),X(0xF5683A3554ull),X(0xF56BCDBC73ull), \
+	X(0xF56F60AC2Eull),X(0xF572F30484ull),X(0xF57684C572ull),X(0xF57A15EEF6ull),X(0xF57DA6810Dull),X(0xF581367BB7ull),X(0xF584C5DEF0ull),X(0xF58854AAB6ull), \
+	X(0xF58BE2DF07ull),X(0xF58F707BE1ull),X(0xF592FD8142ull),X(0xF59689EF27ull),X(0xF59A15C58Full),X(0xF59DA10477ull),X(0xF5A12BABDCull),X(0xF5A4B5BBBDull), \
+	X(0xF5A83F3418ull),X(0xF5ABC814EAull),X(0xF5AF505E32ull),X(0xF5B2D80FECull),X(0xF5B65F2A17ull),X(0xF5B9E5ACB1ull),X(0xF5BD6B97B8ull),X(0xF5C0F0EB28ull), \
+	X(0xF5C475A701ull),X(0xF5C7F9CB40ull),X(0xF5CB7D57E3ull),X(0xF5CF004CE7ull),X(0xF5D282AA4Aull),X(0xF5D604700Bull),X(0xF5D9859E28ull),X(0xF5DD06349Dull), \
+	X(0xF5E0863369ull),X(0xF5E4059A89ull),X(0xF5E78469FCull),X(0xF5EB02A1BFull),X(0xF5EE8041D1ull),X(0xF5F1FD4A2Full),X(0xF5F579BAD6ull),X(0xF5F8F593C5ull), \
+	X(0xF5FC70D4FAull),X(0xF5FFEB7E72ull),X(0xF60365902Cull),X(0xF606DF0A24ull),X(0xF60A57EC5Aull),X(0xF60DD036CBull),X(0xF61147E974ull),X(0xF614BF0454ull), \
+	X(0xF618358768ull),X(0xF61BAB72AEull),X(0xF61F20C625ull),X(0xF6229581CAull),X(0xF62609A59Aull),X(0xF6297D3195ull),X(0xF62CF025B7ull),X(0xF6306281FEull), \
+	X(0xF633D44669ull),X(0xF6374572F6ull),X(0xF63AB607A1ull),X(0xF63E260469ull),X(0xF64195694Dull),X(0xF645043649ull),X(0xF648726B5Cull),X(0xF64BE00883ull), \
+	X(0xF64F4D0DBDull),X(0xF652B97B07ull),X(0xF65625505Full),X(0xF659908DC3ull),X(0xF65CFB3332ull),X(0xF6606540A8ull),X(0xF663CEB624ull),X(0xF6673793A3ull), \
+	X(0xF66A9FD925ull),X(0xF66E0786A5ull),X(0xF6716E9C23ull),X(0xF674D5199Dull),X(0xF6783AFF0Full),X(0xF67BA04C79ull),X(0xF67F0501D7ull),X(0xF682691F29ull), \
+	X(0xF685CCA46Bull),X(0xF6892F919Cull),X(0xF68C91E6BAull),X(0xF68FF3A3C2ull),X(0xF69354C8B2ull),X(0xF696B55589ull),X(0xF69A154A44ull),X(0xF69D74A6E2ull), \
+	X(0xF6A0D36B5Full),X(0xF6A43197BAull),X(0xF6A78F2BF2ull),X(0xF6AAEC2803ull),X(0xF6AE488BECull),X(0xF6B1A457ABull),X(0xF6B4FF8B3Eull),X(0xF6B85A26A2ull), \
+	X(0xF6BBB429D5ull),X(0xF6BF0D94D6ull),X(0xF6C26667A3ull),X(0xF6C5BEA239ull),X(0xF6C9164496ull),X(0xF6CC6D4EB8ull),X(0xF6CFC3C09Dull),X(0xF6D3199A44ull), \
+	X(0xF6D66EDBA9ull),X(0xF6D9C384CCull),X(0xF6DD1795A9ull),X(0xF6E06B0E3Full),X(0xF6E3BDEE8Cull),X(0xF6E710368Eull),X(0xF6EA61E642ull),X(0xF6EDB2FDA8ull), \
+	X(0xF6F1037CBBull),X(0xF6F453637Cull),X(0xF6F7A2B1E6ull),X(0xF6FAF167FAull),X(0xF6FE3F85B3ull),X(0xF7018D0B12ull),X(0xF704D9F812ull),X(0xF708264CB3ull), \
+	X(0xF70B7208F2ull),X(0xF70EBD2CCEull),X(0xF71207B843ull),X(0xF71551AB51ull),X(0xF7189B05F5ull),X(0xF71BE3C82Dull),X(0xF71F2BF1F7ull),X(0xF722738352ull), \
+	X(0xF725BA7C3Aull),X(0xF72900DCAFull),X(0xF72C46A4ADull),X(0xF72F8BD434ull),X(0xF732D06B40ull),X(0xF7361469D1ull),X(0xF73957CFE3ull),X(0xF73C9A9D76ull), \
+	X(0xF73FDCD286ull),X(0xF7431E6F12ull),X(0xF7465F7319ull),X(0xF7499FDE97ull),X(0xF74CDFB18Bull),X(0xF7501EEBF3ull),X(0xF7535D8DCDull),X(0xF7569B9716ull), \
+	X(0xF759D907CEull),X(0xF75D15DFF2ull),X(0xF760521F7Full),X(0xF7638DC674ull),X(0xF766C8D4D0ull),X(0xF76A034A8Full),X(0xF76D3D27B0ull),X(0xF770766C31ull), \
+	X(0xF773AF1810ull),X(0xF776E72B4Bull),X(0xF77A1EA5E0ull),X(0xF77D5587CDull),X(0xF7808BD110ull),X(0xF783C181A7ull),X(0xF786F69990ull),X(0xF78A2B18C9ull), \
+	X(0xF78D5EFF50ull),X(0xF790924D24ull),X(0xF793C50241ull),X(0xF796F71EA7ull),X(0xF79A28A253ull),X(0xF79D598D43ull),X(0xF7A089DF75ull),X(0xF7A3B998E8ull), \
+	X(0xF7A6E8B999ull),X(0xF7AA174186ull),X(0xF7AD4530AEull),X(0xF7B072870Eull),X(0xF7B39F44A5ull),X(0xF7B6CB6970ull),X(0xF7B9F6F56Dull),X(0xF7BD21E89Cull), \
+	X(0xF7C04C42F9ull),X(0xF7C3760483ull),X(0xF7C69F2D37ull),X(0xF7C9C7BD14ull),X(0xF7CCEFB418ull),X(0xF7D0171241ull),X(0xF7D33DD78Dull),X(0xF7D66403FAull), \
+	X(0xF7D9899787ull),X(0xF7DCAE9230ull),X(0xF7DFD2F3F4ull),X(0xF7E2F6BCD2ull),X(0xF7E619ECC7ull),X(0xF7E93C83D1ull),X(0xF7EC5E81EFull),X(0xF7EF7FE71Full), \
+	X(0xF7F2A0B35Dull),X(0xF7F5C0E6AAull),X(0xF7F8E08102ull),X(0xF7FBFF8265ull),X(0xF7FF1DEACFull),X(0xF8023BBA3Full),X(0xF80558F0B3ull),X(0xF808758E29ull), \
+	X(0xF80B91929Full),X(0xF80EACFE14ull),X(0xF811C7D085ull),X(0xF814E209F0ull),X(0xF817FBAA54ull),X(0xF81B14B1AEull),X(0xF81E2D1FFEull),X(0xF82144F540ull), \
+	X(0xF8245C3173ull),X(0xF82772D494ull),X(0xF82A88DEA3ull),X(0xF82D9E4F9Eull),X(0xF830B32781ull),X(0xF833C7664Cull),X(0xF836DB0BFCull),X(0xF839EE1890ull), \
+	X(0xF83D008C05ull),X(0xF84012665Bull),X(0xF84323A78Eull),X(0xF846344F9Dull),X(0xF849445E86ull),X(0xF84C53D448ull),X(0xF84F62B0E0ull),X(0xF85270F44Cull), \
+	X(0xF8557E9E8Bull),X(0xF8588BAF9Aull),X(0xF85B982778ull),X(0xF85EA40624ull),X(0xF861AF4B9Aull),X(0xF864B9F7D9ull),X(0xF867C40AE0ull),X(0xF86ACD84ACull), \
+	X(0xF86DD6653Bull),X(0xF870DEAC8Dull),X(0xF873E65A9Eull),X(0xF876ED6F6Dull),X(0xF879F3EAF8ull),X(0xF87CF9CD3Dull),X(0xF87FFF163Aull),X(0xF88303C5EEull), \
+	X(0xF88607DC57ull),X(0xF8890B5972ull),X(0xF88C0E3D3Eull),X(0xF88F1087B9ull),X(0xF8921238E2ull),X(0xF8951350B5ull),X(0xF89813CF32ull),X(0xF89B13B457ull), \
+	X(0xF89E130021ull),X(0xF8A111B290ull),X(0xF8A40FCBA0ull),X(0xF8A70D4B51ull),X(0xF8AA0A31A0ull),X(0xF8AD067E8Bull),X(0xF8B0023211ull),X(0xF8B2FD4C30ull), \
+	X(0xF8B5F7CCE6ull),X(0xF8B8F1B431ull),X(0xF8BBEB0210ull),X(0xF8BEE3B680ull),X(0xF8C1DBD180ull),X(0xF8C4D3530Dull),X(0xF8C7CA3B26ull),X(0xF8CAC089CAull), \
+	X(0xF8CDB63EF6ull),X(0xF8D0AB5AA9ull),X(0xF8D39FDCE0ull),X(0xF8D693C59Aull),X(0xF8D98714D5ull),X(0xF8DC79CA8Full),X(0xF8DF6BE6C7ull),X(0xF8E25D697Aull), \
+	X(0xF8E54E52A7ull),X(0xF8E83EA24Cull),X(0xF8EB2E5868ull),X(0xF8EE1D74F7ull),X(0xF8F10BF7F9ull),X(0xF8F3F9E16Cull),X(0xF8F6E7314Eull),X(0xF8F9D3E79Dull), \
+	X(0xF8FCC00457ull),X(0xF8FFAB877Aull),X(0xF902967106ull),X(0xF90580C0F7ull),X(0xF9086A774Cull),X(0xF90B539404ull),X(0xF90E3C171Cull),X(0xF911240093ull), \
+	X(0xF9140B5067ull),X(0xF916F20696ull),X(0xF919D8231Eull),X(0xF91CBDA5FEull),X(0xF91FA28F33ull),X(0xF92286DEBDull),X(0xF9256A9499ull),X(0xF9284DB0C5ull), \
+	X(0xF92B303340ull),X(0xF92E121C07ull),X(0xF930F36B1Aull),X(0xF933D42076ull),X(0xF936B43C1Aull),X(0xF93993BE03ull),X(0xF93C72A630ull),X(0xF93F50F4A0ull), \
+	X(0xF9422EA950ull),X(0xF9450BC43Eull),X(0xF947E8456Aull),X(0xF94AC42CD1ull),X(0xF94D9F7A71ull),X(0xF9507A2E48ull),X(0xF953544856ull),X(0xF9562DC897ull), \
+	X(0xF95906AF0Bull),X(0xF95BDEFBB0ull),X(0xF95EB6AE83ull),X(0xF9618DC784ull),X(0xF9646446AFull),X(0xF9673A2C05ull),X(0xF96A0F7782ull),X(0xF96CE42925ull), \
+	X(0xF96FB840EDull),X(0xF9728BBED7ull),X(0xF9755EA2E2ull),X(0xF97830ED0Cull),X(0xF97B029D53ull),X(0xF97DD3B3B6ull),X(0xF980A43033ull),X(0xF9837412C8ull), \
+	X(0xF986435B73ull),X(0xF989120A34ull),X(0xF98BE01F07ull),X(0xF98EAD99EBull),X(0xF9917A7ADFull),X(0xF99446C1E0ull),X(0xF997126EEEull),X(0xF999DD8206ull), \
+	X(0xF99CA7FB26ull),X(0xF99F71DA4Dull),X(0xF9A23B1F7Aull),X(0xF9A503CAAAull),X(0xF9A7CBDBDBull),X(0xF9AA93530Dull),X(0xF9AD5A303Dull),X(0xF9B0207369ull), \
+	X(0xF9B2E61C91ull),X(0xF9B5AB2BB1ull),X(0xF9B86FA0C9ull),X(0xF9BB337BD6ull),X(0xF9BDF6BCD8ull),X(0xF9C0B963CCull),X(0xF9C37B70B0ull),X(0xF9C63CE384ull), \
+	X(0xF9C8FDBC45ull),X(0xF9CBBDFAF1ull),X(0xF9CE7D9F87ull),X(0xF9D13CAA05ull),X(0xF9D3FB1A69ull),X(0xF9D6B8F0B3ull),X(0xF9D9762CDFull),X(0xF9DC32CEEDull), \
+	X(0xF9DEEED6DAull),X(0xF9E1AA44A5ull),X(0xF9E465184Dull),X(0xF9E71F51CFull),X(0xF9E9D8F12Aull),X(0xF9EC91F65Dull),X(0xF9EF4A6165ull),X(0xF9F2023241ull), \
+	X(0xF9F4B968EFull),X(0xF9F770056Dull),X(0xF9FA2607BBull),X(0xF9FCDB6FD5ull),X(0xF9FF903DBCull),X(0xFA0244716Cull),X(0xFA04F80AE4ull),X(0xFA07AB0A23ull), \
+	X(0xFA0A5D6F26ull),X(0xFA0D0F39EDull),X(0xFA0FC06A75ull),X(0xFA127100BDull),X(0xFA1520FCC4ull),X(0xFA17D05E87ull),X(0xFA1A7F2605ull),X(0xFA1D2D533Cull), \
+	X(0xFA1FDAE62Aull),X(0xFA2287DECFull),X(0xFA25343D28ull),X(0xFA27E00133ull),X(0xFA2A8B2AF0ull),X(0xFA2D35BA5Bull),X(0xFA2FDFAF75ull),X(0xFA32890A3Bull), \
+	X(0xFA3531CAABull),X(0xFA37D9F0C3ull),X(0xFA3A817C83ull),X(0xFA3D286DE9ull),X(0xFA3FCEC4F2ull),X(0xFA4274819Dull),X(0xFA4519A3E9ull),X(0xFA47BE2BD4ull), \
+	X(0xFA4A62195Dull),X(0xFA4D056C81ull),X(0xFA4FA8253Full),X(0xFA524A4395ull),X(0xFA54EBC783ull),X(0xFA578CB105ull),X(0xFA5A2D001Bull),X(0xFA5CCCB4C3ull), \
+	X(0xFA5F6BCEFCull),X(0xFA620A4EC3ull),X(0xFA64A83417ull),X(0xFA67457EF7ull),X(0xFA69E22F61ull),X(0xFA6C7E4553ull),X(0xFA6F19C0CBull),X(0xFA71B4A1C9ull), \
+	X(0xFA744EE84Aull),X(0xFA76E8944Dull),X(0xFA7981A5D0ull),X(0xFA7C1A1CD2ull),X(0xFA7EB1F950ull),X(0xFA81493B4Bull),X(0xFA83DFE2BFull),X(0xFA8675EFABull), \
+	X(0xFA890B620Eull),X(0xFA8BA039E6ull),X(0xFA8E347731ull),X(0xFA90C819EFull),X(0xFA935B221Cull),X(0xFA95ED8FB8ull),X(0xFA987F62C2ull),X(0xFA9B109B37ull), \
+	X(0xFA9DA13915ull),X(0xFAA0313C5Dull),X(0xFAA2C0A50Bull),X(0xFAA54F731Eull),X(0xFAA7DDA694ull),X(0xFAAA6B3F6Dull),X(0xFAACF83DA6ull),X(0xFAAF84A13Eull), \
+	X(0xFAB2106A34ull),X(0xFAB49B9885ull),X(0xFAB7262C30ull),X(0xFAB9B02534ull),X(0xFABC39838Full),X(0xFABEC24740ull),X(0xFAC14A7044ull),X(0xFAC3D1FE9Bull), \
+	X(0xFAC658F242ull),X(0xFAC8DF4B39ull),X(0xFACB65097Dull),X(0xFACDEA2D0Eull),X(0xFAD06EB5E9ull),X(0xFAD2F2A40Dull),X(0xFAD575F779ull),X(0xFAD7F8B02Aull), \
+	X(0xFADA7ACE20ull),X(0xFADCFC5159ull),X(0xFADF7D39D3ull),X(0xFAE1FD878Cull),X(0xFAE47D3A84ull),X(0xFAE6FC52B8ull),X(0xFAE97AD028ull),X(0xFAEBF8B2D1ull), \
+	X(0xFAEE75FAB2ull),X(0xFAF0F2A7CAull),X(0xFAF36EBA16ull),X(0xFAF5EA3196ull),X(0xFAF8650E48ull),X(0xFAFADF502Bull),X(0xFAFD58F73Cull),X(0xFAFFD2037Aull), \
+	X(0xFB024A74E4ull),X(0xFB04C24B79ull),X(0xFB07398736ull),X(0xFB09B0281Aull),X(0xFB0C262E24ull),X(0xFB0E9B9952ull),X(0xFB111069A3ull),X(0xFB13849F15ull), \
+	X(0xFB15F839A7ull),X(0xFB186B3957ull),X(0xFB1ADD9E23ull),X(0xFB1D4F680Bull),X(0xFB1FC0970Cull),X(0xFB22312B25ull),X(0xFB24A12455ull),X(0xFB2710829Aull), \
+	X(0xFB297F45F2ull),X(0xFB2BED6E5Cull),X(0xFB2E5AFBD7ull),X(0xFB30C7EE61ull),X(0xFB333445F9ull),X(0xFB35A0029Dull),X(0xFB380B244Bull),X(0xFB3A75AB03ull), \
+	X(0xFB3CDF96C2ull),X(0xFB3F48E787ull),X(0xFB41B19D51ull),X(0xFB4419B81Eull),X(0xFB468137ECull),X(0xFB48E81CBBull),X(0xFB4B4E6689ull),X(0xFB4DB41553ull), \
+	X(0xFB5019291Aull),X(0xFB527DA1DAull),X(0xFB54E17F94ull),X(0xFB5744C245ull),X(0xFB59A769EBull),X(0xFB5C097686ull),X(0xFB5E6AE814ull),X(0xFB60CBBE94ull), \
+	X(0xFB632BFA03ull),X(0xFB658B9A61ull),X(0xFB67EA9FACull),X(0xFB6A4909E2ull),X(0xFB6CA6D902ull),X(0xFB6F040D0Bull),X(0xFB7160A5FCull),X(0xFB73BCA3D2ull), \
+	X(0xFB7618068Cull),X(0xFB7872CE29ull),X(0xFB7ACCFAA8ull),X(0xFB7D268C06ull),X(0xFB7F7F8243ull),X(0xFB81D7DD5Dull),X(0xFB842F9D53ull),X(0xFB8686C222ull), \
+	X(0xFB88DD4BCBull),X(0xFB8B333A4Aull),X(0xFB8D888DA0ull),X(0xFB8FDD45C9ull),X(0xFB923162C6ull),X(0xFB9484E494ull),X(0xFB96D7CB32ull),X(0xFB992A169Full), \
+	X(0xFB9B7BC6D9ull),X(0xFB9DCCDBDFull),X(0xFBA01D55AFull),X(0xFBA26D3448ull),X(0xFBA4BC77A9ull),X(0xFBA70B1FCFull),X(0xFBA9592CBAull),X(0xFBABA69E69ull), \
+	X(0xFBADF374D9ull),X(0xFBB03FB009ull),X(0xFBB28B4FF9ull),X(0xFBB4D654A6ull),X(0xFBB720BE0Full),X(0xFBB96A8C33ull),X(0xFBBBB3BF10ull),X(0xFBBDFC56A5ull), \
+	X(0xFBC04452F0ull),X(0xFBC28BB3F1ull),X(0xFBC4D279A5ull),X(0xFBC718A40Cull),X(0xFBC95E3323ull),X(0xFBCBA326EAull),X(0xFBCDE77F5Full),X(0xFBD02B3C80ull), \
+	X(0xFBD26E5E4Dull),X(0xFBD4B0E4C3ull),X(0xFBD6F2CFE2ull),X(0xFBD9341FA9ull),X(0xFBDB74D415ull),X(0xFBDDB4ED25ull),X(0xFBDFF46AD8ull),X(0xFBE2334D2Cull), \
+	X(0xFBE4719421ull),X(0xFBE6AF3FB5ull),X(0xFBE8EC4FE5ull),X(0xFBEB28C4B2ull),X(0xFBED649E1Aull),X(0xFBEF9FDC1Aull),X(0xFBF1DA7EB3ull),X(0xFBF41485E2ull), \
+	X(0xFBF64DF1A6ull),X(0xFBF886C1FEull),X(0xFBFABEF6E8ull),X(0xFBFCF69063ull),X(0xFBFF2D8E6Eull),X(0xFC0163F107ull),X(0xFC0399B82Dull),X(0xFC05CEE3DFull), \
+	X(0xFC0803741Bull),X(0xFC0A3768DFull),X(0xFC0C6AC22Bull),X(0xFC0E9D7FFDull),X(0xFC10CFA254ull),X(0xFC1301292Eull),X(0xFC1532148Aull),X(0xFC17626467ull), \
+	X(0xFC199218C4ull),X(0xFC1BC1319Eull),X(0xFC1DEFAEF5ull),X(0xFC201D90C7ull),X(0xFC224AD713ull),X(0xFC247781D8ull),X(0xFC26A39114ull),X(0xFC28CF04C6ull), \
+	X(0xFC2AF9DCECull),X(0xFC2D241986ull),X(0xFC2F4DBA91ull),X(0xFC3176C00Eull),X(0xFC339F29F9ull),X(0xFC35C6F852ull),X(0xFC37EE2B18ull),X(0xFC3A14C249ull), \
+	X(0xFC3C3ABDE5ull),X(0xFC3E601DE8ull),X(0xFC4084E253ull),X(0xFC42A90B24ull),X(0xFC44CC985Aull),X(0xFC46EF89F3ull),X(0xFC4911DFEEull),X(0xFC4B339A49ull), \
+	X(0xFC4D54B904ull),X(0xFC4F753C1Dull),X(0xFC51952393ull),X(0xFC53B46F64ull),X(0xFC55D31F8Full),X(0xFC57F13414ull),X(0xFC5A0EACEFull),X(0xFC5C2B8A21ull), \
+	X(0xFC5E47CBA8ull),X(0xFC60637182ull),X(0xFC627E7BAFull),X(0xFC6498EA2Cull),X(0xFC66B2BCFAull),X(0xFC68CBF415ull),X(0xFC6AE48F7Eull),X(0xFC6CFC8F33ull), \
+	X(0xFC6F13F332ull),X(0xFC712ABB7Bull),X(0xFC7340E80Bull),X(0xFC755678E2ull),X(0xFC776B6DFEull),X(0xFC797FC75Full),X(0xFC7B938502ull),X(0xFC7DA6A6E7ull), \
+	X(0xFC7FB92D0Cull),X(0xFC81CB1770ull),X(0xFC83DC6612ull),X(0xFC85ED18F0ull),X(0xFC87FD3009ull),X(0xFC8A0CAB5Cull),X(0xFC8C1B8AE8ull),X(0xFC8E29CEABull), \
+	X(0xFC903776A5ull),X(0xFC924482D2ull),X(0xFC9450F334ull),X(0xFC965CC7C8ull),X(0xFC9868008Cull),X(0xFC9A729D81ull),X(0xFC9C7C9EA4ull),X(0xFC9E8603F4ull), \
+	X(0xFCA08ECD70ull),X(0xFCA296FB17ull),X(0xFCA49E8CE8ull),X(0xFCA6A582E0ull),X(0xFCA8ABDD00ull),X(0xFCAAB19B45ull),X(0xFCACB6BDAFull),X(0xFCAEBB443Cull), \
+	X(0xFCB0BF2EEAull),X(0xFCB2C27DBAull),X(0xFCB4C530A9ull),X(0xFCB6C747B7ull),X(0xFCB8C8C2E1ull),X(0xFCBAC9A227ull),X(0xFCBCC9E588ull),X(0xFCBEC98D02ull), \
+	X(0xFCC0C89894ull),X(0xFCC2C7083Dull),X(0xFCC4C4DBFBull),X(0xFCC6C213CEull),X(0xFCC8BEAFB4ull),X(0xFCCABAAFACull),X(0xFCCCB613B5ull),X(0xFCCEB0DBCDull), \
+	X(0xFCD0AB07F3ull),X(0xFCD2A49826ull),X(0xFCD49D8C66ull),X(0xFCD695E4B0ull),X(0xFCD88DA103ull),X(0xFCDA84C15Eull),X(0xFCDC7B45C0ull),X(0xFCDE712E29ull), \
+	X(0xFCE0667A95ull),X(0xFCE25B2B05ull),X(0xFCE44F3F77ull),X(0xFCE642B7EAull),X(0xFCE835945Dull),X(0xFCEA27D4CEull),X(0xFCEC19793Dull),X(0xFCEE0A81A8ull), \
+	X(0xFCEFFAEE0Dull),X(0xFCF1EABE6Dull),X(0xFCF3D9F2C5ull),X(0xFCF5C88B14ull),X(0xFCF7B68759ull),X(0xFCF9A3E793ull),X(0xFCFB90ABC2ull),X(0xFCFD7CD3E2ull), \
+	X(0xFCFF685FF4ull),X(0xFD01534FF6ull),X(0xFD033DA3E8ull),X(0xFD05275BC7ull),X(0xFD07107793ull),X(0xFD08F8F74Aull),X(0xFD0AE0DAEBull),X(0xFD0CC82276ull), \
+	X(0xFD0EAECDE9ull),X(0xFD1094DD42ull),X(0xFD127A5081ull),X(0xFD145F27A5ull),X(0xFD164362ACull),X(0xFD18270194ull),X(0xFD1A0A045Eull),X(0xFD1BEC6B08ull), \
+	X(0xFD1DCE3590ull),X(0xFD1FAF63F6ull),X(0xFD218FF638ull),X(0xFD236FEC55ull),X(0xFD254F464Cull),X(0xFD272E041Cull),X(0xFD290C25C3ull),X(0xFD2AE9AB42ull), \
+	X(0xFD2CC69495ull),X(0xFD2EA2E1BDull),X(0xFD307E92B8ull),X(0xFD3259A784ull),X(0xFD34342022ull),X(0xFD360DFC8Full),X(0xFD37E73CCBull),X(0xFD39BFE0D4ull), \
+	X(0xFD3B97E8A9ull),X(0xFD3D6F5449ull),X(0xFD3F4623B3ull),X(0xFD411C56E6ull),X(0xFD42F1EDE1ull),X(0xFD44C6E8A2ull),X(0xFD469B4729ull),X(0xFD486F0974ull), \
+	X(0xFD4A422F82ull),X(0xFD4C14B952ull),X(0xFD4DE6A6E3ull),X(0xFD4FB7F834ull),X(0xFD5188AD44ull),X(0xFD5358C611ull),X(0xFD5528429Aull),X(0xFD56F722DFull), \
+	X(0xFD58C566DEull),X(0xFD5A930E96ull),X(0xFD5C601A06ull),X(0xFD5E2C892Dull),X(0xFD5FF85C0Aull),X(0xFD61C3929Bull),X(0xFD638E2CE0ull),X(0xFD65582AD7ull), \
+	X(0xFD67218C80ull),X(0xFD68EA51D9ull),X(0xFD6AB27AE1ull),X(0xFD6C7A0797ull),X(0xFD6E40F7FAull),X(0xFD70074C09ull),X(0xFD71CD03C2ull),X(0xFD73921F25ull), \
+	X(0xFD75569E31ull),X(0xFD771A80E4ull),X(0xFD78DDC73Eull),X(0xFD7AA0713Cull),X(0xFD7C627EDFull),X(0xFD7E23F025ull),X(0xFD7FE4C50Eull),X(0xFD81A4FD97ull), \
+	X(0xFD836499C0ull),X(0xFD85239987ull),X(0xFD86E1FCEDull),X(0xFD889FC3EFull),X(0xFD8A5CEE8Dull),X(0xFD8C197CC5ull),X(0xFD8DD56E96ull),X(0xFD8F90C400ull), \
+	X(0xFD914B7D02ull),X(0xFD93059999ull),X(0xFD94BF19C6ull),X(0xFD9677FD86ull),X(0xFD983044DAull),X(0xFD99E7EFC0ull),X(0xFD9B9EFE36ull),X(0xFD9D55703Dull), \
+	X(0xFD9F0B45D2ull),X(0xFDA0C07EF5ull),X(0xFDA2751BA5ull),X(0xFDA4291BE0ull),X(0xFDA5DC7FA6ull),X(0xFDA78F46F5ull),X(0xFDA94171CDull),X(0xFDAAF3002Cull), \
+	X(0xFDACA3F212ull),X(0xFDAE54477Dull),X(0xFDB004006Cull),X(0xFDB1B31CDFull),X(0xFDB3619CD4ull),X(0xFDB50F804Aull),X(0xFDB6BCC740ull),X(0xFDB86971B5ull), \
+	X(0xFDBA157FA8ull),X(0xFDBBC0F119ull),X(0xFDBD6BC605ull),X(0xFDBF15FE6Dull),X(0xFDC0BF9A4Eull),X(0xFDC26899A9ull),X(0xFDC410FC7Bull),X(0xFDC5B8C2C4ull), \
+	X(0xFDC75FEC83ull),X(0xFDC90679B7ull),X(0xFDCAAC6A5Full),X(0xFDCC51BE79ull),X(0xFDCDF67606ull),X(0xFDCF9A9103ull),X(0xFDD13E0F70ull),X(0xFDD2E0F14Cull), \
+	X(0xFDD4833695ull),X(0xFDD624DF4Bull),X(0xFDD7C5EB6Dull),X(0xFDD9665AFAull),X(0xFDDB062DF1ull),X(0xFDDCA56450ull),X(0xFDDE43FE17ull),X(0xFDDFE1FB44ull), \
+	X(0xFDE17F5BD8ull),X(0xFDE31C1FD0ull),X(0xFDE4B8472Cull),X(0xFDE653D1EBull),X(0xFDE7EEC00Bull),X(0xFDE989118Cull),X(0xFDEB22C66Dull),X(0xFDECBBDEADull), \
+	X(0xFDEE545A4Bull),X(0xFDEFEC3945ull),X(0xFDF1837B9Bull),X(0xFDF31A214Dull),X(0xFDF4B02A58ull),X(0xFDF64596BCull),X(0xFDF7DA6677ull),X(0xFDF96E998Aull), \
+	X(0xFDFB022FF3ull),X(0xFDFC9529B1ull),X(0xFDFE2786C3ull),X(0xFDFFB94728ull),X(0xFE014A6ADFull),X(0xFE02DAF1E7ull),X(0xFE046ADC3Full),X(0xFE05FA29E6ull), \
+	X(0xFE0788DADCull),X(0xFE0916EF1Full),X(0xFE0AA466AFull),X(0xFE0C314189ull),X(0xFE0DBD7FAEull),X(0xFE0F49211Dull),X(0xFE10D425D4ull),X(0xFE125E8DD3ull), \
+	X(0xFE13E85918ull),X(0xFE157187A3ull),X(0xFE16FA1972ull),X(0xFE18820E86ull),X(0xFE1A0966DCull),X(0xFE1B902274ull),X(0xFE1D16414Dull),X(0xFE1E9BC366ull), \
+	X(0xFE2020A8BDull),X(0xFE21A4F154ull),X(0xFE23289D27ull),X(0xFE24ABAC36ull),X(0xFE262E1E81ull),X(0xFE27AFF406ull),X(0xFE29312CC5ull),X(0xFE2AB1C8BCull), \
+	X(0xFE2C31C7EBull),X(0xFE2DB12A50ull),X(0xFE2F2FEFEBull),X(0xFE30AE18BBull),X(0xFE322BA4BFull),X(0xFE33A893F6ull),X(0xFE3524E65Full),X(0xFE36A09BF9ull), \
+	X(0xFE381BB4C3ull),X(0xFE399630BCull),X(0xFE3B100FE4ull),X(0xFE3C89523Aull),X(0xFE3E01F7BCull),X(0xFE3F7A006Aull),X(0xFE40F16C42ull),X(0xFE42683B45ull), \
+	X(0xFE43DE6D70ull),X(0xFE455402C3ull),X(0xFE46C8FB3Eull),X(0xFE483D56DFull),X(0xFE49B115A5ull),X(0xFE4B243790ull),X(0xFE4C96BC9Eull),X(0xFE4E08A4CFull), \
+	X(0xFE4F79F022ull),X(0xFE50EA9E95ull),X(0xFE525AB029ull),X(0xFE53CA24DCull),X(0xFE5538FCADull),X(0xFE56A7379Bull),X(0xFE5814D5A6ull),X(0xFE5981D6CCull), \
+	X(0xFE5AEE3B0Dull),X(0xFE5C5A0268ull),X(0xFE5DC52CDCull),X(0xFE5F2FBA68ull),X(0xFE6099AB0Cull),X(0xFE6202FEC5ull),X(0xFE636BB594ull),X(0xFE64D3CF78ull), \
+	X(0xFE663B4C6Full),X(0xFE67A22C7Aull),X(0xFE69086F96ull),X(0xFE6A6E15C3ull),X(0xFE6BD31F01ull),X(0xFE6D378B4Eull),X(0xFE6E9B5AAAull),X(0xFE6FFE8D13ull), \
+	X(0xFE71612289ull),X(0xFE72C31B0Cull),X(0xFE74247699ull),X(0xFE75853530ull),X(0xFE76E556D2ull),X(0xFE7844DB7Bull),X(0xFE79A3C32Dull),X(0xFE7B020DE5ull), \
+	X(0xFE7C5FBBA3ull),X(0xFE7DBCCC67ull),X(0xFE7F19402Full),X(0xFE807516FAull),X(0xFE81D050C8ull),X(0xFE832AED98ull),X(0xFE8484ED69ull),X(0xFE85DE503Aull), \
+	X(0xFE8737160Bull),X(0xFE888F3EDAull),X(0xFE89E6CAA6ull),X(0xFE8B3DB970ull),X(0xFE8C940B36ull),X(0xFE8DE9BFF6ull),X(0xFE8F3ED7B2ull),X(0xFE90935266ull), \
+	X(0xFE91E73014ull),X(0xFE933A70B9ull),X(0xFE948D1456ull),X(0xFE95DF1AE9ull),X(0xFE97308471ull),X(0xFE988150EEull),X(0xFE99D1805Full),X(0xFE9B2112C3ull), \
+	X(0xFE9C700819ull),X(0xFE9DBE6061ull),X(0xFE9F0C1B99ull),X(0xFEA05939C1ull),X(0xFEA1A5BAD8ull),X(0xFEA2F19EDDull),X(0xFEA43CE5D0ull),X(0xFEA5878FAFull), \
+	X(0xFEA6D19C7Aull),X(0xFEA81B0C30ull),X(0xFEA963DED1ull),X(0xFEAAAC145Bull),X(0xFEABF3ACCDull),X(0xFEAD3AA827ull),X(0xFEAE810669ull),X(0xFEAFC6C790ull), \
+	X(0xFEB10BEB9Eull),X(0xFEB2507290ull),X(0xFEB3945C65ull),X(0xFEB4D7A91Eull),X(0xFEB61A58BAull),X(0xFEB75C6B37ull),X(0xFEB89DE094ull),X(0xFEB9DEB8D2ull), \
+	X(0xFEBB1EF3EFull),X(0xFEBC5E91EBull),X(0xFEBD9D92C4ull),X(0xFEBEDBF67Aull),X(0xFEC019BD0Dull),X(0xFEC156E67Bull),X(0xFEC29372C3ull),X(0xFEC3CF61E6ull), \
+	X(0xFEC50AB3E2ull),X(0xFEC64568B6ull),X(0xFEC77F8061ull),X(0xFEC8B8FAE4ull),X(0xFEC9F1D83Cull),X(0xFECB2A186Aull),X(0xFECC61BB6Dull),X(0xFECD98C143ull), \
+	X(0xFECECF29EDull),X(0xFED004F569ull),X(0xFED13A23B6ull),X(0xFED26EB4D5ull),X(0xFED3A2A8C3ull),X(0xFED4D5FF81ull),X(0xFED608B90Eull),X(0xFED73AD568ull), \
+	X(0xFED86C548Full),X(0xFED99D3684ull),X(0xFEDACD7B43ull),X(0xFEDBFD22CEull),X(0xFEDD2C2D23ull),X(0xFEDE5A9A41ull),X(0xFEDF886A28ull),X(0xFEE0B59CD7ull), \
+	X(0xFEE1E2324Eull),X(0xFEE30E2A8Bull),X(0xFEE439858Eull),X(0xFEE5644356ull),X(0xFEE68E63E3ull),X(0xFEE7B7E733ull),X(0xFEE8E0CD46ull),X(0xFEEA09161Cull), \
+	X(0xFEEB30C1B3ull),X(0xFEEC57D00Bull),X(0xFEED7E4123ull),X(0xFEEEA414FAull),X(0xFEEFC94B91ull),X(0xFEF0EDE4E5ull),X(0xFEF211E0F6ull),X(0xFEF3353FC5ull), \
+	X(0xFEF458014Full),X(0xFEF57A2594ull),X(0xFEF69BAC94ull),X(0xFEF7BC964Dull),X(0xFEF8DCE2C0ull),X(0xFEF9FC91EBull),X(0xFEFB1BA3CEull),X(0xFEFC3A1868ull), \
+	X(0xFEFD57EFB8ull),X(0xFEFE7529BEull),X(0xFEFF91C679ull),X(0xFF00ADC5E8ull),X(0xFF01C9280Aull),X(0xFF02E3ECE0ull),X(0xFF03FE1468ull),X(0xFF05179EA1ull), \
+	X(0xFF06308B8Cull),X(0xFF0748DB26ull),X(0xFF08608D70ull),X(0xFF0977A269ull),X(0xFF0A8E1A10ull),X(0xFF0BA3F464ull),X(0xFF0CB93166ull),X(0xFF0DCDD113ull), \
+	X(0xFF0EE1D36Cull),X(0xFF0FF53870ull),X(0xFF1108001Eull),X(0xFF121A2A76ull),X(0xFF132BB776ull),X(0xFF143CA71Full),X(0xFF154CF96Full),X(0xFF165CAE66ull), \
+	X(0xFF176BC603ull),X(0xFF187A4046ull),X(0xFF19881D2Dull),X(0xFF1A955CB9ull),X(0xFF1BA1FEE9ull),X(0xFF1CAE03BBull),X(0xFF1DB96B30ull),X(0xFF1EC43547ull), \
+	X(0xFF1FCE61FEull),X(0xFF20D7F156ull),X(0xFF21E0E34Eull),X(0xFF22E937E5ull),X(0xFF23F0EF1Aull),X(0xFF24F808EDull),X(0xFF25FE855Dull),X(0xFF2704646Aull), \
+	X(0xFF2809A613ull),X(0xFF290E4A57ull),X(0xFF2A125136ull),X(0xFF2B15BAAFull),X(0xFF2C1886C2ull),X(0xFF2D1AB56Dull),X(0xFF2E1C46B0ull),X(0xFF2F1D3A8Bull), \
+	X(0xFF301D90FDull),X(0xFF311D4A05ull),X(0xFF321C65A3ull),X(0xFF331AE3D6ull),X(0xFF3418C49Eull),X(0xFF351607F9ull),X(0xFF3612ADE8ull),X(0xFF370EB669ull), \
+	X(0xFF380A217Dull),X(0xFF3904EF22ull),X(0xFF39FF1F57ull),X(0xFF3AF8B21Dull),X(0xFF3BF1A773ull),X(0xFF3CE9FF58ull),X(0xFF3DE1B9CBull),X(0xFF3ED8D6CBull), \
+	X(0xFF3FCF565Aull),X(0xFF40C53874ull),X(0xFF41BA7D1Bull),X(0xFF42AF244Eull),X(0xFF43A32E0Bull),X(0xFF44969A52ull),X(0xFF45896924ull),X(0xFF467B9A7Eull), \
+	X(0xFF476D2E61ull),X(0xFF485E24CCull),X(0xFF494E7DBEull),X(0xFF4A3E3937ull),X(0xFF4B2D5736ull),X(0xFF4C1BD7BBull),X(0xFF4D09BAC5ull),X(0xFF4DF70053ull), \
+	X(0xFF4EE3A865ull),X(0xFF4FCFB2FBull),X(0xFF50BB2014ull),X(0xFF51A5EFAEull),X(0xFF529021CBull),X(0xFF5379B668ull),X(0xFF5462AD86ull),X(0xFF554B0724ull), \
+	X(0xFF5632C341ull),X(0xFF5719E1DDull),X(0xFF580062F8ull),X(0xFF58E64690ull),X(0xFF59CB8CA5ull),X(0xFF5AB03537ull),X(0xFF5B944045ull),X(0xFF5C77ADCFull), \
+	X(0xFF5D5A7DD3ull),X(0xFF5E3CB052ull),X(0xFF5F1E454Bull),X(0xFF5FFF3CBDull),X(0xFF60DF96A8ull),X(0xFF61BF530Bull),X(0xFF629E71E6ull),X(0xFF637CF338ull), \
+	X(0xFF645AD701ull),X(0xFF65381D40ull),X(0xFF6614C5F5ull),X(0xFF66F0D11Eull),X(0xFF67CC3EBCull),X(0xFF68A70ECEull),X(0xFF69814154ull),X(0xFF6A5AD64Cull), \
+	X(0xFF6B33CDB7ull),X(0xFF6C0C2793ull),X(0xFF6CE3E3E2ull),X(0xFF6DBB02A0ull),X(0xFF6E9183D0ull),X(0xFF6F67676Full),X(0xFF703CAD7Dull),X(0xFF711155FAull), \
+	X(0xFF71E560E6ull),X(0xFF72B8CE3Full),X(0xFF738B9E05ull),X(0xFF745DD038ull),X(0xFF752F64D8ull),X(0xFF76005BE3ull),X(0xFF76D0B559ull),X(0xFF77A0713Aull), \
+	X(0xFF786F8F85ull),X(0xFF793E103Aull),X(0xFF7A0BF359ull),X(0xFF7AD938E0ull),X(0xFF7BA5E0CFull),X(0xFF7C71EB26ull),X(0xFF7D3D57E4ull),X(0xFF7E082709ull), \
+	X(0xFF7ED25894ull),X(0xFF7F9BEC85ull),X(0xFF8064E2DBull),X(0xFF812D3B96ull),X(0xFF81F4F6B6ull),X(0xFF82BC1439ull),X(0xFF83829420ull),X(0xFF84487669ull), \
+	X(0xFF850DBB15ull),X(0xFF85D26223ull),X(0xFF86966B93ull),X(0xFF8759D763ull),X(0xFF881CA594ull),X(0xFF88DED625ull),X(0xFF89A06915ull),X(0xFF8A615E65ull), \
+	X(0xFF8B21B613ull),X(0xFF8BE17020ull),X(0xFF8CA08C8Aull),X(0xFF8D5F0B51ull),X(0xFF8E1CEC76ull),X(0xFF8EDA2FF6ull),X(0xFF8F96D5D3ull),X(0xFF9052DE0Bull), \
+	X(0xFF910E489Eull),X(0xFF91C9158Bull),X(0xFF928344D3ull),X(0xFF933CD674ull),X(0xFF93F5CA6Full),X(0xFF94AE20C2ull),X(0xFF9565D96Dull),X(0xFF961CF471ull), \
+	X(0xFF96D371CBull),X(0xFF9789517Dull),X(0xFF983E9385ull),X(0xFF98F337E4ull),X(0xFF99A73E98ull),X(0xFF9A5AA7A1ull),X(0xFF9B0D72FFull),X(0xFF9BBFA0B2ull), \
+	X(0xFF9C7130B8ull),X(0xFF9D222312ull),X(0xFF9DD277BFull),X(0xFF9E822EBEull),X(0xFF9F314810ull),X(0xFF9FDFC3B4ull),X(0xFFA08DA1A9ull),X(0xFFA13AE1EFull), \
+	X(0xFFA1E78486ull),X(0xFFA293896Cull),X(0xFFA33EF0A3ull),X(0xFFA3E9BA29ull),X(0xFFA493E5FDull),X(0xFFA53D7421ull),X(0xFFA5E66492ull),X(0xFFA68EB751ull), \
+	X(0xFFA7366C5Dull),X(0xFFA7DD83B6ull),X(0xFFA883FD5Cull),X(0xFFA929D94Eull),X(0xFFA9CF178Bull),X(0xFFAA73B813ull),X(0xFFAB17BAE7ull),X(0xFFABBB2005ull), \
+	X(0xFFAC5DE76Dull),X(0xFFAD00111Full),X(0xFFADA19D1Aull),X(0xFFAE428B5Dull),X(0xFFAEE2DBEAull),X(0xFFAF828EBEull),X(0xFFB021A3DBull),X(0xFFB0C01B3Eull), \
+	X(0xFFB15DF4E9ull),X(0xFFB1FB30DAull),X(0xFFB297CF12ull),X(0xFFB333CF8Full),X(0xFFB3CF3252ull),X(0xFFB469F75Aull),X(0xFFB5041EA7ull),X(0xFFB59DA838ull), \
+	X(0xFFB636940Dull),X(0xFFB6CEE225ull),X(0xFFB7669281ull),X(0xFFB7FDA520ull),X(0xFFB8941A01ull),X(0xFFB929F124ull),X(0xFFB9BF2A8Aull),X(0xFFBA53C630ull), \
+	X(0xFFBAE7C418ull),X(0xFFBB7B2440ull),X(0xFFBC0DE6A9ull),X(0xFFBCA00B52ull),X(0xFFBD31923Bull),X(0xFFBDC27B62ull),X(0xFFBE52C6C9ull),X(0xFFBEE2746Eull), \
+	X(0xFFBF718452ull),X(0xFFBFFFF674ull),X(0xFFC08DCAD3ull),X(0xFFC11B016Full),X(0xFFC1A79A48ull),X(0xFFC233955Eull),X(0xFFC2BEF2B0ull),X(0xFFC349B23Eull), \
+	X(0xFFC3D3D408ull),X(0xFFC45D580Cull),X(0xFFC4E63E4Cull),X(0xFFC56E86C6ull),X(0xFFC5F6317Bull),X(0xFFC67D3E69ull),X(0xFFC703AD91ull),X(0xFFC7897EF2ull), \
+	X(0xFFC80EB28Cull),X(0xFFC893485Eull),X(0xFFC9174069ull),X(0xFFC99A9AACull),X(0xFFCA1D5727ull),X(0xFFCA9F75D9ull),X(0xFFCB20F6C2ull),X(0xFFCBA1D9E1ull), \
+	X(0xFFCC221F37ull),X(0xFFCCA1C6C3ull),X(0xFFCD20D085ull),X(0xFFCD9F3C7Dull),X(0xFFCE1D0AA9ull),X(0xFFCE9A3B0Bull),X(0xFFCF16CDA1ull),X(0xFFCF92C26Bull), \
+	X(0xFFD00E1969ull),X(0xFFD088D29Bull),X(0xFFD102EE01ull),X(0xFFD17C6B99ull),X(0xFFD1F54B64ull),X(0xFFD26D8D62ull),X(0xFFD2E53192ull),X(0xFFD35C37F4ull), \
+	X(0xFFD3D2A087ull),X(0xFFD4486B4Cull),X(0xFFD4BD9842ull),X(0xFFD5322769ull),X(0xFFD5A618C0ull),X(0xFFD6196C47ull),X(0xFFD68C21FEull),X(0xFFD6FE39E5ull), \
+	X(0xFFD76FB3FCull),X(0xFFD7E09041ull),X(0xFFD850CEB6ull),X(0xFFD8C06F59ull),X(0xFFD92F722Aull),X(0xFFD99DD729ull),X(0xFFDA0B9E57ull),X(0xFFDA78C7B1ull), \
+	X(0xFFDAE55339ull),X(0xFFDB5140EEull),X(0xFFDBBC90CFull),X(0xFFDC2742DDull),X(0xFFDC915718ull),X(0xFFDCFACD7Eull),X(0xFFDD63A610ull),X(0xFFDDCBE0CDull), \
+	X(0xFFDE337DB6ull),X(0xFFDE9A7CC9ull),X(0xFFDF00DE08ull),X(0xFFDF66A170ull),X(0xFFDFCBC703ull),X(0xFFE0304EC0ull),X(0xFFE09438A7ull),X(0xFFE0F784B7ull), \
+	X(0xFFE15A32F0ull),X(0xFFE1BC4352ull),X(0xFFE21DB5DDull),X(0xFFE27E8A91ull),X(0xFFE2DEC16Dull),X(0xFFE33E5A71ull),X(0xFFE39D559Dull),X(0xFFE3FBB2F0ull), \
+	X(0xFFE459726Bull),X(0xFFE4B6940Dull),X(0xFFE51317D6ull),X(0xFFE56EFDC5ull),X(0xFFE5CA45DBull),X(0xFFE624F018ull),X(0xFFE67EFC7Aull),X(0xFFE6D86B02ull), \
+	X(0xFFE7313BB0ull),X(0xFFE7896E84ull),X(0xFFE7E1037Cull),X(0xFFE837FA99ull),X(0xFFE88E53DCull),X(0xFFE8E40F42ull),X(0xFFE9392CCEull),X(0xFFE98DAC7Dull), \
+	X(0xFFE9E18E50ull),X(0xFFEA34D247ull),X(0xFFEA877862ull),X(0xFFEAD9809Full),X(0xFFEB2AEB00ull),X(0xFFEB7BB784ull),X(0xFFEBCBE62Bull),X(0xFFEC1B76F4ull), \
+	X(0xFFEC6A69E0ull),X(0xFFECB8BEEEull),X(0xFFED06761Eull),X(0xFFED538F6Full),X(0xFFEDA00AE3ull),X(0xFFEDEBE877ull),X(0xFFEE37282Dull),X(0xFFEE81CA04ull), \
+	X(0xFFEECBCDFCull),X(0xFFEF153415ull),X(0xFFEF5DFC4Eull),X(0xFFEFA626A7ull),X(0xFFEFEDB321ull),X(0xFFF034A1BBull),X(0xFFF07AF274ull),X(0xFFF0C0A54Dull), \
+	X(0xFFF105BA46ull),X(0xFFF14A315Eull),X(0xFFF18E0A95ull),X(0xFFF1D145ECull),X(0xFFF213E361ull),X(0xFFF255E2F5ull),X(0xFFF29744A7ull),X(0xFFF2D80878ull), \
+	X(0xFFF3182E66ull),X(0xFFF357B673ull),X(0xFFF396A09Eull),X(0xFFF3D4ECE7ull),X(0xFFF4129B4Dull),X(0xFFF44FABD1ull),X(0xFFF48C1E72ull),X(0xFFF4C7F330ull), \
+	X(0xFFF5032A0Bull),X(0xFFF53DC303ull),X(0xFFF577BE18ull),X(0xFFF5B11B4Aull),X(0xFFF5E9DA97ull),X(0xFFF621FC02ull),X(0xFFF6597F88ull),X(0xFFF690652Aull), \
+	X(0xFFF6C6ACE9ull),X(0xFFF6FC56C3ull),X(0xFFF73162B9ull),X(0xFFF765D0CAull),X(0xFFF799A0F7ull),X(0xFFF7CCD33Full),X(0xFFF7FF67A2ull),X(0xFFF8315E20ull), \
+	X(0xFFF862B6B9ull),X(0xFFF893716Dull),X(0xFFF8C38E3Cull),X(0xFFF8F30D25ull),X(0xFFF921EE29ull),X(0xFFF9503147ull),X(0xFFF97DD67Full),X(0xFFF9AADDD1ull), \
+	X(0xFFF9D7473Dull),X(0xFFFA0312C4ull),X(0xFFFA2E4064ull),X(0xFFFA58D01Dull),X(0xFFFA82C1F1ull),X(0xFFFAAC15DDull),X(0xFFFAD4CBE3ull),X(0xFFFAFCE403ull), \
+	X(0xFFFB245E3Cull),X(0xFFFB4B3A8Dull),X(0xFFFB7178F8ull),X(0xFFFB97197Cull),X(0xFFFBBC1C18ull),X(0xFFFBE080CDull),X(0xFFFC04479Bull),X(0xFFFC277082ull), \
+	X(0xFFFC49FB80ull),X(0xFFFC6BE898ull),X(0xFFFC8D37C7ull),X(0xFFFCADE90Full),X(0xFFFCCDFC6Full),X(0xFFFCED71E7ull),X(0xFFFD0C4977ull),X(0xFFFD2A831Full), \
+	X(0xFFFD481EDFull),X(0xFFFD651CB6ull),X(0xFFFD817CA6ull),X(0xFFFD9D3EACull),X(0xFFFDB862CBull),X(0xFFFDD2E901ull),X(0xFFFDECD14Eull),X(0xFFFE061BB3ull), \
+	X(0xFFFE1EC82Full),X(0xFFFE36D6C3ull),X(0xFFFE4E476Dull),X(0xFFFE651A2Full),X(0xFFFE7B4F08ull),X(0xFFFE90E5F8ull),X(0xFFFEA5DEFFull),X(0xFFFEBA3A1Cull), \
+	X(0xFFFECDF751ull),X(0xFFFEE1169Dull),X(0xFFFEF397FFull),X(0xFFFF057B78ull),X(0xFFFF16C108ull),X(0xFFFF2768AEull),X(0xFFFF37726Bull),X(0xFFFF46DE3Full), \
+	X(0xFFFF55AC29ull),X(0xFFFF63DC2Aull),X(0xFFFF716E41ull),X(0xFFFF7E626Eull),X(0xFFFF8AB8B2ull),X(0xFFFF96710Dull),X(0xFFFFA18B7Dull),X(0xFFFFAC0805ull), \
+	X(0xFFFFB5E6A2ull),X(0xFFFFBF2756ull),X(0xFFFFC7CA1Full),X(0xFFFFCFCF00ull),X(0xFFFFD735F6ull),X(0xFFFFDDFF03ull),X(0xFFFFE42A25ull),X(0xFFFFE9B75Eull), \
 	X(0xFFFFEEA6ADull),X(0xFFFFF2F812ull),X(0xFFFFF6AB8Eull),X(0xFFFFF9C11Full),X(0xFFFFFC38C7ull),X(0xFFFFFE1285ull),X(0xFFFFFF4E58ull),X(0xFFFFFFEC42ull),
+#else
+# define FOURIER_SINTABLE_VALUES_8192(X)
+#endif
+
+#define FOURIER_SINTABLE_VALUES(X) \
+	FOURIER_SINTABLE_VALUES_16(X) \
+	FOURIER_SINTABLE_VALUES_32(X) \
+	FOURIER_SINTABLE_VALUES_64(X) \
+	FOURIER_SINTABLE_VALUES_128(X) \
+	FOURIER_SINTABLE_VALUES_256(X) \
+	FOURIER_SINTABLE_VALUES_512(X) \
+	FOURIER_SINTABLE_VALUES_1024(X) \
+	FOURIER_SINTABLE_VALUES_2048(X) \
+	FOURIER_SINTABLE_VALUES_4096(X) \
+	FOURIER_SINTABLE_VALUES_8192(X)
+
+//! Float table
+#define X(x) ((x) * 0x1.0p-40f)
+const float Fourier_SinTable[] __attribute__((aligned(64))) = { //! Aligned for AVX-512
+	FOURIER_SINTABLE_VALUES(X)
+};
+#undef X
+
+//! .31 or .15 fixed-point table (rounded; never reaches 1.0)
+//! NOTE: Only needed by the fixed-point decoder.
+#if ULC_USE_FIXED_POINT
+#if FOURIER_SINTABLE_FIXED_BITS == 16
+# define X(x) (int16_t)(((x) < 0xFFFF000000ull) ? (((x) + 0x1000000ull) >> 25) : 0x7FFF)
+#else
+# define X(x) (int32_t)(((x) + 0x100ull) >> 9)
+#endif
+const Fourier_SinTableFixed_t Fourier_SinTableFixed[] = {
+	FOURIER_SINTABLE_VALUES(X)
 };
 #undef X
+#endif
 
 /**************************************/
 //! EOF
@@ -4,11 +4,94 @@
 //! Refer to the project README file for license terms.
 /**************************************/
 #pragma once
+/**************************************/
+#include <stdint.h>
+/**************************************/
+
+//! Transform kernels are built once per ISA level (see Makefile),
+//! with FOURIER_ISA defined to the level's name. Each build gets
+//! its symbols decorated with this name so that they can co-exist,
+//! and calls between kernels stay within the same ISA level.
+#if defined(FOURIER_ISA)
+# define FOURIER_ISA_NAME(Name)        FOURIER_ISA_NAME_(Name, FOURIER_ISA)
+# define FOURIER_ISA_NAME_(Name, Isa)  FOURIER_ISA_NAME__(Name, Isa)
+# define FOURIER_ISA_NAME__(Name, Isa) Name##_##Isa
+# define Fourier_DCT2      FOURIER_ISA_NAME(Fourier_DCT2)
+# define Fourier_DCT3      FOURIER_ISA_NAME(Fourier_DCT3)
+# define Fourier_DCT4      FOURIER_ISA_NAME(Fourier_DCT4)
+# define Fourier_DCT4T     FOURIER_ISA_NAME(Fourier_DCT4T)
+# define Fourier_DCT4TR    FOURIER_ISA_NAME(Fourier_DCT4TR)
+# define Fourier_MDCT      FOURIER_ISA_NAME(Fourier_MDCT)
+# define Fourier_MDCT_MDST FOURIER_ISA_NAME(Fourier_MDCT_MDST)
+# define Fourier_IMDCT     FOURIER_ISA_NAME(Fourier_IMDCT)
+# define Fourier_DCT4_Batch      FOURIER_ISA_NAME(Fourier_DCT4_Batch)
+# define Fourier_MDCT_Batch      FOURIER_ISA_NAME(Fourier_MDCT_Batch)
+# define Fourier_MDCT_MDST_Batch FOURIER_ISA_NAME(Fourier_MDCT_MDST_Batch)
+# define Fourier_IMDCT_Batch     FOURIER_ISA_NAME(Fourier_IMDCT_Batch)
+# define Fourier_DCT4_Head   FOURIER_ISA_NAME(Fourier_DCT4_Head)
+# define Fourier_DCT4T_Tail  FOURIER_ISA_NAME(Fourier_DCT4T_Tail)
+# define Fourier_DCT4TR_Tail FOURIER_ISA_NAME(Fourier_DCT4TR_Tail)
+# define Fourier_DCT4_Lanes  FOURIER_ISA_NAME(Fourier_DCT4_Lanes)
+# define Fourier_DCT4T_Lanes FOURIER_ISA_NAME(Fourier_DCT4T_Lanes)
+#endif
+
+//! Smallest DCT size to use 512-bit paths for (AVX-512 builds)
+//! Below this, the recursion is working on data that was just
+//! written by the previous stage, and the wider loads measured
+//! slower than staying with 256-bit vectors.
+#define FOURIER_AVX512_MIN_N 256
+
+//! Smallest DCT-IV size to fuse the outer stages for
+//! From this size on, Fourier_DCT4() merges its rotation stage
+//! with the first butterfly stage of both DCT-II halves, and the
+//! DCT-II interleaving with its own final butterflies, so that
+//! the full-size buffers are swept twice rather than four times.
+#define FOURIER_DCT4_FUSE_MIN_N 128
+
+//! Smallest MDCT/IMDCT size to fuse with the DCT-IV for
+//! From this size on, the MDCT windowing builds the output of
+//! the first DCT-IV butterfly stage directly, and the IMDCT
+//! un-windowing consumes the DCT-IV's final stage directly.
+//! NOTE: Must be >= FOURIER_DCT4_FUSE_MIN_N, and > 64 (so that
+//! the DCT-IV is not a codelet).
+#define FOURIER_MDCT_FUSE_MIN_N 128
+
+//! Largest size that batched transforms interleave
+//! Up to this size, the DCT-IV is a straight-line codelet whose
+//! vectorization is limited to what the compiler finds in it, so
+//! the batched transforms run it on several transforms at once,
+//! one per vector lane. Larger transforms vectorize along their
+//! own length, and are done one at a time.
+#define FOURIER_BATCH_MAX_N 64
+
 /**************************************/
 
+//! Largest size covered by the sine tables
+//! Builds that never transform anything larger (eg. decoders for
+//! a known BlockSize) can lower this to store only the sizes they
+//! need; the tables take 2*N-16 entries (see README for a report).
+//! Encoder and decoder states refuse any larger BlockSize.
+#ifndef FOURIER_SINTABLE_MAX_N
+# define FOURIER_SINTABLE_MAX_N 8192
+#endif
+
+//! Fixed-point sine table storage
+//! 32 == .31 fixed-point (int32_t)
+//! 16 == .15 fixed-point (int16_t), expanded to .31 on load
+//! The .15 table halves its size, at the cost of a much larger
+//! fixed-point decoder error (up to 4 LSB at 16bit; see ulcDecoder.h).
+#ifndef FOURIER_SINTABLE_FIXED_BITS
+# define FOURIER_SINTABLE_FIXED_BITS 32
+#endif
+#if FOURIER_SINTABLE_FIXED_BITS == 16
+typedef int16_t Fourier_SinTableFixed_t;
+#else
+typedef int32_t Fourier_SinTableFixed_t;
+#endif
+
 //! Sine table for DCT analysis
 //! Contains Table[Sin[(n+0.5)*(Pi/2)/N], {n,0,N-1}]
-//! for N={16,32,64,128,256,512,1024,2048,4096,8192}
+//! for N={16,32,64,...,FOURIER_SINTABLE_MAX_N}
 static inline __attribute__((always_inline)) const float *Fourier_SinTableN(int N) {
 	extern const float Fourier_SinTable[];
 
@@ -16,6 +99,18 @@ static inline __attribute__((always_inline)) const float *Fourier_SinTableN(int
 	return Fourier_SinTable + (N-16);
 }
 
+//! Sine table for fixed-point transforms
+//! Same as above, in .31 or .15 fixed-point
+static inline __attribute__((always_inline)) const Fourier_SinTableFixed_t *Fourier_SinTableFixedN(int N) {
+	extern const Fourier_SinTableFixed_t Fourier_SinTableFixed[];
+
+	//! NOTE: N must be > 8
+	return Fourier_SinTableFixed + (N-16);
+}
+static inline __attribute__((always_inline)) int32_t Fourier_SinTableFixedExpand(Fourier_SinTableFixed_t x) {
+	return (int32_t)x << (32 - FOURIER_SINTABLE_FIXED_BITS);
+}
+
 /**************************************/
 
 //! DCT-II/DCT-III/DCT-IV (scaled)
@@ -39,10 +134,13 @@ static inline __attribute__((always_inline)) const float *Fourier_SinTableN(int
 //!   better/worse round-off error, depending on the input.
 //!   Recommend using DCT4T() for converting time-domain signals
 //!   to the frequency domain, and DCT4() for the inverse.
-void Fourier_DCT2 (float *Buf, float *Tmp, int N);
-void Fourier_DCT3 (float *Buf, float *Tmp, int N);
-void Fourier_DCT4 (float *Buf, float *Tmp, int N);
-void Fourier_DCT4T(float *Buf, float *Tmp, int N);
+//!  -DCT4TR() is DCT4T() with its output in reverse order. With
+//!   every other input negated, this gives the DST-IV.
+void Fourier_DCT2  (float *Buf, float *Tmp, int N);
+void Fourier_DCT3  (float *Buf, float *Tmp, int N);
+void Fourier_DCT4  (float *Buf, float *Tmp, int N);
+void Fourier_DCT4T (float *Buf, float *Tmp, int N);
+void Fourier_DCT4TR(float *Buf, float *Tmp, int N);
 
 //! MDCT+MDST/IMDCT (based on DCT-IV; scaled)
 //! Arguments:
@@ -61,7 +159,8 @@ void Fourier_DCT4T(float *Buf, float *Tmp, int N);
 //! NOTE:
 //!  -N must be a power of two, and >= 16
 //!  -Overlap must be a multiple of 16
-//!  -BufOut must not be the same as BufIn
+//!  -BufOut can be the same as BufIn (in-place IMDCT).
+//!   Note that BufIn must then be writable.
 //!  -Sine window (modulated lapped transform) is
 //!   used with ModulationWindow == NULL. To use
 //!   custom windows, they must match the format of
@@ -74,10 +173,137 @@ void Fourier_DCT4T(float *Buf, float *Tmp, int N);
 //!   MDST coefficients are NOT phase inverted.
 //!  -BufIn can be the same as BufTmp. However, this
 //!   implies trashing of the buffer contents.
+//!  -Similarly, New can be the same as BufTmp. However,
+//!   large transforms are slower in either case, as this
+//!   prevents fusing the windowing with the DCT-IV (see
+//!   FOURIER_MDCT_FUSE_MIN_N).
 //!  -MDCT uses DCT4T(), IMDCT uses DCT4()
+//!  -MDCT() is MDCT_MDST() without the MDST output, and
+//!   costs roughly half as much.
+void Fourier_MDCT(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
 void Fourier_MDCT_MDST(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
 void Fourier_IMDCT(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
 
+//! Batched DCT-IV/MDCT+MDST/IMDCT
+//! Arguments:
+//!  As for the single transforms, plus:
+//!  nBatch:    Number of transforms
+//!  Stride:    Distance between the buffers of each transform
+//!  LapStride: Distance between the lapping buffers of each transform
+//! NOTE:
+//!  -Transform b uses Buf + b*Stride (and similarly for all
+//!   other buffers), except for the lapping buffers, which use
+//!   Lap + b*LapStride. Only a single BufTmp[N] is needed.
+//!  -The transforms are done in order, so LapStride == 0 chains
+//!   them (consecutive subblocks of one channel; New/BufIn then
+//!   advances by Stride == N for each subblock).
+//!  -The results are the same as for the single transforms.
+//!  -Fourier_DCT4_Batch() is in-place, with Tmp[N] as scratch.
+void Fourier_DCT4_Batch(float *Buf, float *Tmp, int N, int nBatch, int Stride);
+void Fourier_MDCT_Batch(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+void Fourier_MDCT_MDST_Batch(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+void Fourier_IMDCT_Batch(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+
+//! Partial DCT-IV stages, for fusing with MDCT/IMDCT
+//! NOTE:
+//!  -These are only available inside kernel builds, and
+//!   only valid for N >= FOURIER_MDCT_FUSE_MIN_N.
+//!  -DCT4_Head() is DCT4() of Src[] up to, but excluding, its
+//!   final interleaving stage. The four quarter-size outputs
+//!   are left in Tmp[], and Buf[] is trashed.
+//!  -DCT4T_Tail() is DCT4T() following its first butterfly
+//!   stage, whose output must be in Tmp[]. Output is to Buf[],
+//!   and Tmp[] is trashed. DCT4TR_Tail() is the same, with the
+//!   output in reverse order.
+#if defined(FOURIER_ISA)
+void Fourier_DCT4_Head(const float *Src, float *Buf, float *Tmp, int N);
+void Fourier_DCT4T_Tail (float *Buf, float *Tmp, int N);
+void Fourier_DCT4TR_Tail(float *Buf, float *Tmp, int N);
+#endif
+
+//! Lane-parallel DCT-IV/DCT-IV (transposed)
+//! NOTE:
+//!  -These are only available inside kernel builds, and only
+//!   for N <= FOURIER_BATCH_MAX_N, FOURIER_BATCH_LANES > 1.
+//!  -Each lane l transforms Src[l][0..N-1] into Dst[l][0..N-1],
+//!   for l < nLanes <= FOURIER_BATCH_LANES. Dst[l] can be the
+//!   same as Src[l].
+//!  -For DCT4T_Lanes(), the output of lane l is reversed (as
+//!   for DCT4TR()) when bit l of RevMask is set.
+#if defined(FOURIER_ISA)
+# if defined(__AVX__)
+#  define FOURIER_BATCH_LANES 8
+# elif defined(__SSE__)
+#  define FOURIER_BATCH_LANES 4
+# else
+#  define FOURIER_BATCH_LANES 1
+# endif
+void Fourier_DCT4_Lanes (float *const *Dst, const float *const *Src, int N, int nLanes);
+void Fourier_DCT4T_Lanes(float *const *Dst, const float *const *Src, int N, int nLanes, int RevMask);
+#endif
+
+/**************************************/
+
+//! Fixed-point DCT-IV/IMDCT
+//! These are integer-only versions of Fourier_DCT4() and
+//! Fourier_IMDCT() (with the same arguments and scaling), for
+//! the fixed-point decoder. As the transforms are linear, data
+//! can be in any fixed-point format, but windows (including any
+//! ModulationWindow) are in the format of Fourier_SinTableFixed[].
+//! NOTE:
+//!  -Each rotation is accumulated in 64 bits and rounded once,
+//!   so every output of a rotation stage has an error of at most
+//!   1/2 LSB.
+//!  -The data must have enough headroom for the DCT-IV, whose
+//!   output (and every intermediate value) is bounded by the L2
+//!   norm of its input times Sqrt[N]. For decoded audio, these
+//!   values are usually on the order of the peak sample level.
+//!  -For IMDCT_Fixed(), BufIn holds InShift more fractional bits
+//!   than BufOut and BufLap. These are kept through the DCT-IV,
+//!   whose rounding errors otherwise add up over its log2(N)
+//!   stages, and rounded off once in the output and lapping data.
+//!  -These are not built per ISA level, and are always scalar.
+void Fourier_DCT4_Fixed(int32_t *Buf, int32_t *Tmp, int N);
+void Fourier_IMDCT_Fixed(int32_t *BufOut, const int32_t *BufIn, int32_t *BufLap, int32_t *BufTmp, int N, int Overlap, const Fourier_SinTableFixed_t *ModulationWindow, int InShift);
+
+/**************************************/
+
+//! ISA levels (in increasing order of preference)
+#define FOURIER_ISA_LEVEL_Scalar 0
+#define FOURIER_ISA_LEVEL_SSE2   1
+#define FOURIER_ISA_LEVEL_AVX2   2 //! AVX2+FMA
+#define FOURIER_ISA_LEVEL_AVX512 3 //! AVX-512F
+#define FOURIER_ISA_LEVEL_COUNT  4
+
+//! Get the best ISA level that was built and that the running
+//! CPU supports. The result is cached, so this is cheap to call
+//! more than once.
+int Fourier_GetISALevel(void);
+
+//! Kernel dispatch table
+//! NOTE:
+//!  -Fourier_GetKernels() returns the kernels for the level
+//!   given by Fourier_GetISALevel().
+//!  -The plain Fourier_*() functions above (outside of kernel
+//!   builds) call through this table on every call, and so are
+//!   slightly slower than caching the table and using it directly.
+struct Fourier_Kernels_t {
+	const char *Name; //! ISA level name
+	void (*DCT2)  (float *Buf, float *Tmp, int N);
+	void (*DCT3)  (float *Buf, float *Tmp, int N);
+	void (*DCT4)  (float *Buf, float *Tmp, int N);
+	void (*DCT4T) (float *Buf, float *Tmp, int N);
+	void (*DCT4TR)(float *Buf, float *Tmp, int N);
+	void (*MDCT)(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
+	void (*MDCT_MDST)(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
+	void (*IMDCT)(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow);
+	void (*DCT4_Batch)(float *Buf, float *Tmp, int N, int nBatch, int Stride);
+	void (*MDCT_Batch)(float *MDCT, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+	void (*MDCT_MDST_Batch)(float *MDCT, float *MDST, const float *New, float *Lap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+	void (*IMDCT_Batch)(float *BufOut, const float *BufIn, float *BufLap, float *BufTmp, int N, int Overlap, const float *ModulationWindow, int nBatch, int Stride, int LapStride);
+};
+const struct Fourier_Kernels_t *Fourier_GetKernels(void);
+
 /**************************************/
 //! EOF
 /**************************************/
@@ -4,6 +4,49 @@
 //! Refer to the project README file for license terms.
 /**************************************/
 #pragma once
+/**************************************/
+#include <stdint.h>
+/**************************************/
+
+//! 0 == Floating-point decoder
+//! 1 == Fixed-point decoder (integer arithmetic only)
+//! NOTE: Usually selected from the Makefile (FIXED_POINT := 1).
+#ifndef ULC_USE_FIXED_POINT
+# define ULC_USE_FIXED_POINT 0
+#endif
+
+//! Decoded sample type
+//! Floating-point decoders output samples with a nominal range
+//! of [-1.0,+1.0]. Fixed-point decoders output samples in .23
+//! fixed-point (ie. a nominal range of [-2^23,+2^23]), which
+//! allows 24bit output, or 16bit output via (x + 80h) >> 8.
+//! Compared to the floating-point decoder, the fixed-point output
+//! has a peak error below 2^-18 of full scale (ie. 1/8 LSB at 16bit)
+//! and an RMS error below 2^-21, for all BlockSizes and down to
+//! near-silent blocks (see tests/ulcFixedPointTest.c). Blocks must
+//! not decode to more than about +/-2^4 (24dB over full scale) to
+//! avoid overflow, which only happens with corrupt or adversarial
+//! data.
+//! With a .15 sine table (FOURIER_SINTABLE_FIXED_BITS == 16), the
+//! error is instead dominated by that of the table, and so grows
+//! with the signal level: the peak error is below 2^-13 (ie. up to
+//! 4 LSB at 16bit, as reached by full-scale noise; music stays
+//! around 2 LSB), and the RMS error below 2^-15.5.
+//! NOTE: Custom ModulationWindow data must then also be given in
+//! the same format as Fourier_SinTableFixed[] (.31 or .15).
+#if ULC_USE_FIXED_POINT
+# define ULC_DECODER_FIXED_FRACBITS 23
+typedef int32_t ULC_DecoderSample_t;
+# if FOURIER_SINTABLE_FIXED_BITS == 16
+typedef int16_t ULC_DecoderWindow_t;
+# else
+typedef int32_t ULC_DecoderWindow_t;
+# endif
+#else
+typedef float ULC_DecoderSample_t;
+typedef float ULC_DecoderWindow_t;
+#endif
+
 /**************************************/
 
 //! Decoder state structure
@@ -24,21 +67,33 @@ struct ULC_DecoderState_t {
 	//! Global state (do not change after initialization)
 	int nChan;     //! Channels in encoding scheme
 	int BlockSize; //! Transform block size
-	const float *ModulationWindow;
+	const ULC_DecoderWindow_t *ModulationWindow;
 
 	//! Decoding state
 	//! Buffer memory layout:
 	//!  Data:
 	//!   char  _Padding[];
-	//!   float TransformBuffer[BlockSize]
-	//!   float TransformTemp  [BlockSize]
-	//!   float TransformInvLap[nChan * BlockSize/2]
-	//! BufferData contains the pointer returned by malloc()
+	//!   ULC_DecoderSample_t TransformTemp  [BlockSize]
+	//!   ULC_DecoderSample_t TransformInvLap[nChan * BlockSize/2]
+	//!   char  TransformLapZero[nChan]
+	//!  OutputBufferData:
+	//!   char  _Padding[];
+	//!   ULC_DecoderSample_t OutputBuffer[nChan * BlockSize]
+	//! BufferData and OutputBufferData contain the pointers returned
+	//! by malloc(). OutputBuffer is only allocated on first use by
+	//! ULC_DecoderRead() or ULC_DecoderState_Seek() (with DstData
+	//! == NULL), and is NULL until then.
 	int    LastSubBlockSize; //! Size of last [sub]block processed
+	int    OutputPos;        //! Read position in OutputBuffer (BlockSize = Empty)
+	int    StreamConsumed;   //! Bytes consumed from the last ULC_DecoderRead() source data
+	int    StreamError;      //! Set when the last ULC_DecoderRead() stopped on malformed data
+	const struct Fourier_Kernels_t *Kernels; //! Transform kernels (selected for the running CPU; floating-point only)
 	void  *BufferData;
-	float *TransformBuffer;
-	float *TransformTemp;
-	float *TransformInvLap;
+	void  *OutputBufferData;
+	ULC_DecoderSample_t *TransformTemp;
+	ULC_DecoderSample_t *TransformInvLap;
+	ULC_DecoderSample_t *OutputBuffer;
+	unsigned char *TransformLapZero; //! Per channel: Lapping buffer is all zeros (see Block_Decode())
 };
 
 /**************************************/
@@ -51,6 +106,12 @@ int ULC_DecoderState_Init(struct ULC_DecoderState_t *State);
 //! Destroy decoder state
 void ULC_DecoderState_Destroy(struct ULC_DecoderState_t *State);
 
+//! Reset decoder state
+//! This clears the lapping buffer, and should be used after
+//! any discontinuity in the stream (eg. after re-synchronizing
+//! to the stream following damaged data).
+void ULC_DecoderState_Reset(struct ULC_DecoderState_t *State);
+
 /**************************************/
 
 //! Decode block
@@ -63,7 +124,77 @@ void ULC_DecoderState_Destroy(struct ULC_DecoderState_t *State);
 //!   }
 //!  -SrcBuffer will only be accessed via bytes.
 //! Returns the number of bits read.
-int ULC_DecodeBlock(struct ULC_DecoderState_t *State, float *DstData, const void *SrcBuffer);
+int ULC_DecodeBlock(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, const void *SrcBuffer);
+
+//! Decode block (bounded)
+//! NOTE:
+//!  -Same as ULC_DecodeBlock(), but never reads past SrcBytes
+//!   bytes of SrcBuffer, making it safe for untrusted data.
+//!  -Output data is always fully written, even on failure.
+//!   Following a failure, ULC_DecoderState_Reset() should be
+//!   used before decoding any further blocks.
+//! Returns the number of bits read.
+//! On malformed or truncated data, returns a negative value.
+int ULC_DecodeBlockEx(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, const void *SrcBuffer, int SrcBytes);
+
+/**************************************/
+
+//! Block source accessor
+//! Must return a pointer to the start of block BlockIndex
+//! (or NULL if this block is unavailable).
+typedef const void *(*ULC_DecoderSourceFnc_t)(void *User, int BlockIndex);
+
+//! Seek to sample
+//! NOTE:
+//!  -The block preceding the one containing Sample is decoded
+//!   (with its output discarded) to prime the lapping buffer,
+//!   and then the block containing Sample is decoded to DstData
+//!   (in the same format as ULC_DecodeBlock()).
+//!  -DstData may be NULL, in which case the block is decoded to
+//!   the internal output buffer (allocating it if needed), and the
+//!   next ULC_DecoderRead() call will begin output at Sample.
+//!  -Sample is relative to the decoded stream (ie. block n
+//!   outputs samples n*BlockSize .. (n+1)*BlockSize-1), and so
+//!   includes the coding delay of the encoder.
+//!  -Decoding should continue from block Sample/BlockSize + 1.
+//! Returns the offset of Sample into each channel of DstData
+//! On failure, returns a negative value.
+int ULC_DecoderState_Seek(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, int Sample, ULC_DecoderSourceFnc_t SrcFnc, void *User);
+
+/**************************************/
+
+//! Stream source accessor
+//! Called whenever a new block is needed. nConsumed is the number
+//! of bytes consumed from the data returned by the last call (or 0
+//! if nothing was consumed). Must return a pointer to the next unread
+//! data, and store the number of bytes available there to SrcBytes.
+//! Returning NULL (or SrcBytes <= 0) signals end-of-stream.
+typedef const void *(*ULC_DecoderStreamFnc_t)(void *User, int nConsumed, int *SrcBytes);
+
+//! Read samples
+//! NOTE:
+//!  -Unlike ULC_DecodeBlock(), any number of samples may be read,
+//!   and output data will have its channels interleaved.
+//!   For example:
+//!   {
+//!    Chan0[0], Chan1[0], Chan0[1], Chan1[1], ...
+//!   }
+//!  -Blocks are decoded only as needed (using bounded decoding, as
+//!   with ULC_DecodeBlockEx()), and buffered internally until read.
+//!   The internal buffer is allocated on first use, and if this
+//!   fails, no further frames are read.
+//!  -For mono streams, whole blocks are decoded directly to Dst when
+//!   it is aligned to 64 bytes, avoiding the internal buffer.
+//!  -On malformed data, reading stops before the malformed block,
+//!   the decoder state is reset (see ULC_DecoderState_Reset()), and
+//!   StreamError is set. The malformed block is not consumed, so the
+//!   next call would request (and fail on) the same data again; the
+//!   caller must first advance its stream past the damaged data (eg.
+//!   to the next sync frame, with ULC_Sync_Find()).
+//! Returns the number of frames (samples per channel) read, which is
+//! less than nFrames on end-of-stream or malformed data (and these
+//! can be told apart by StreamError).
+int ULC_DecoderRead(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *Dst, int nFrames, ULC_DecoderStreamFnc_t SrcFnc, void *User);
 
 /**************************************/
 //! EOF
@@ -27,6 +27,18 @@
 //! Smallest possible coefficient amplitude
 #define ULC_COEF_EPS (0x1.0p-31f) //! 5+0xE+0xC = Maximum extended-precision quantizer
 
+//! Rate control modes for ULC_EncoderWrite()
+#define ULC_ENCODER_MODE_CBR 0
+#define ULC_ENCODER_MODE_ABR 1
+#define ULC_ENCODER_MODE_VBR 2
+
+//! Encoder analysis stages (computed on demand for each block)
+//!  NOISE: Noise spectrum analysis (for noise-fill and HF extension)
+//!  ORDER: Psychoacoustics and importance ordering of coefficients
+//!         (only needed when not all coefficients can be coded)
+#define ULC_ENCODER_ANALYSIS_NOISE 0x1
+#define ULC_ENCODER_ANALYSIS_ORDER 0x2
+
 /**************************************/
 
 //! Encoder state structure
@@ -42,6 +54,14 @@
 //!      ...
 //!      ModulationWindow[BlockSize],
 //!    }
+//!  -The streaming parameters are only used by ULC_EncoderWrite()
+//!   and ULC_EncoderFlush(), and may be changed between calls.
+//!  -The analysis options may be changed between blocks.
+//!   FastAnalysis skips the MDST during analysis and estimates
+//!   the power spectrum from neighbouring MDCT coefficients; this
+//!   roughly halves the transform cost, at the price of a less
+//!   accurate masking/noise analysis. It does not change the
+//!   format of the stream.
 struct ULC_EncoderState_t {
 	//! Global state (do not change after initialization)
 	int RateHz;     //! Playback rate (used for rate control)
@@ -49,30 +69,44 @@ struct ULC_EncoderState_t {
 	int BlockSize;  //! Transform block size
 	const float *ModulationWindow;
 
+	//! Streaming parameters
+	int   StreamMode;          //! Rate control mode (ULC_ENCODER_MODE_*)
+	float StreamRate;          //! RateKbps (CBR, ABR) or Quality (VBR)
+	float StreamAvgComplexity; //! AvgComplexity (ABR)
+
+	//! Analysis options
+	int FastAnalysis; //! Estimate power from MDCT alone (skips MDST)
+
 	//! Encoding state
 	//! Buffer memory layout:
 	//!   char  _Padding[];
 	//!   float SampleBuffer   [nChan*BlockSize]
+	//!   float InputBuffer    [nChan*BlockSize]
 	//!   float TransformBuffer[nChan*BlockSize]
-	//!   float TransformNoise [nChan*BlockSize] <- With ULC_USE_NOISE_CODING only
+	//!   float TransformNoise [nChan*BlockSize*3] <- With ULC_USE_NOISE_CODING only (noise analysis sums)
 	//!   float TransformFwdLap[nChan*BlockSize]
-	//!   float TransformTemp  [MAX(2,nChan)*BlockSize]
+	//!   float TransformTemp  [MAX(2,nChan)*BlockSize] <- MAX(4*BlockSize+16, ...) with ULC_USE_PSYCHOACOUSTICS
 	//!   int   TransformIndex [nChan*BlockSize]
-	//!   float TransientWindow[BlockSize/4]
+	//!   float TransientEnergy[ULC_MAX_BLOCK_DECIMATION_FACTOR*2]
 	//! BufferData contains the original pointer returned by malloc()
 	int    WindowCtrl;        //! Window control parameter (for last coded block)
 	int    NextWindowCtrl;    //! Window control parameter (for data in SampleBuffer)
 	float  BlockComplexity;   //! Coefficient distribution complexity (0 = Highly tonal, 1 = Highly noisy)
 	float  WindowCtrlTaps[2]; //! Sample taps for smoothing control
+	int    AnalysisStages;    //! Analysis stages computed for the last coded block (ULC_ENCODER_ANALYSIS_*)
+	int    nActiveChan;       //! Channels transformed for the last coded block (the rest are digitally silent)
+	int    InputPos;          //! Samples accumulated in InputBuffer by ULC_EncoderWrite()
+	const struct ULC_EncoderKernels_t *Kernels; //! Analysis/coding kernels (selected for the running CPU)
 	void  *BufferData;
 	float *SampleBuffer;
+	float *InputBuffer;
 	float *TransformBuffer;
 #if ULC_USE_NOISE_CODING
 	float *TransformNoise;
 #endif
 	float *TransformFwdLap;
 	float *TransformTemp;
-	float *TransientWindow;
+	float *TransientEnergy;
 	int   *TransformIndex;
 };
 
@@ -103,6 +137,8 @@ void ULC_EncoderState_Destroy(struct ULC_EncoderState_t *State);
 //!   128.01kbps, 127.0kbps will always be chosen).
 //!   The rate is matched via binary search, and so this encoding
 //!   mode (and ABR, which uses the same mechanism) is the slowest.
+//!   However, when all coefficients fit within the budget, the
+//!   search (and the analysis that it needs) is skipped.
 //!  -ABR mode tries to balance the number of coefficients in each
 //!   block based on their complexity. It will achieve an average
 //!   bitrate very close to the target, but may be slightly off due
@@ -135,6 +171,38 @@ const void *ULC_EncodeBlock_CBR(struct ULC_EncoderState_t *State, const float *S
 const void *ULC_EncodeBlock_ABR(struct ULC_EncoderState_t *State, const float *SrcData, int *Size, float RateKbps, float AvgComplexity);
 const void *ULC_EncodeBlock_VBR(struct ULC_EncoderState_t *State, const float *SrcData, int *Size, float Quality);
 
+/**************************************/
+
+//! Block output accessor
+//! Called for each block encoded by ULC_EncoderWrite() and
+//! ULC_EncoderFlush(), with the compressed data and its size
+//! in bits (as returned by ULC_EncodeBlock_*()).
+//! The data is only valid until the callback returns.
+typedef void (*ULC_EncoderOutputFnc_t)(void *User, const void *Data, int Size);
+
+//! Write samples
+//! NOTE:
+//!  -Unlike ULC_EncodeBlock_*(), any number of samples may be
+//!   written, and input data must have its channels interleaved.
+//!   For example:
+//!   {
+//!    Chan0[0], Chan1[0], Chan0[1], Chan1[1], ...
+//!   }
+//!  -Samples are accumulated internally, and each time a full block
+//!   is available, it is encoded using the streaming parameters and
+//!   passed to OutFnc.
+//! Returns the number of blocks output.
+int ULC_EncoderWrite(struct ULC_EncoderState_t *State, const float *Samples, int nFrames, ULC_EncoderOutputFnc_t OutFnc, void *User);
+
+//! Flush encoder
+//! Pads any partially-accumulated block with silence, and then
+//! encodes two further blocks of silence to drain the coding delay,
+//! so that every sample written can be decoded.
+//! NOTE: This ends the stream; to begin a new stream, the state
+//! must be re-initialized.
+//! Returns the number of blocks output.
+int ULC_EncoderFlush(struct ULC_EncoderState_t *State, ULC_EncoderOutputFnc_t OutFnc, void *User);
+
 /**************************************/
 //! EOF
 /**************************************/
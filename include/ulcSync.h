@@ -0,0 +1,59 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#pragma once
+/**************************************/
+#include <stdint.h>
+/**************************************/
+
+//! Sync frame header
+//! NOTE:
+//!  -Sync frames are an optional, byte-aligned framing layer that
+//!   is placed around a group of encoded blocks. This allows for
+//!   detecting damaged data and re-synchronizing to the stream
+//!   after such damage (see FormatSpecs.md for details).
+//!  -Header layout (all values are little-endian):
+//!    [00h] uint8_t  SyncWord[2]   ('U','S')
+//!    [02h] uint8_t  nBlocks       (1..255)
+//!    [03h] uint8_t  FrameBytes[3] (size of the block data that follows)
+//!    [06h] uint32_t BlockIndex    (index of the first block in the frame)
+//!    [0Ah] uint16_t FrameCRC      (CRC-16 of the block data)
+//!    [0Ch] uint16_t HeaderCRC     (CRC-16 of bytes 00h..0Bh)
+#define ULC_SYNC_HEADER_SIZE    14
+#define ULC_SYNC_MAX_BLOCKS    255
+#define ULC_SYNC_MAX_FRAMESIZE 0xFFFFFF
+struct ULC_SyncFrame_t {
+	int      nBlocks;
+	int      FrameBytes;
+	uint32_t BlockIndex;
+};
+
+/**************************************/
+
+//! Compute CRC-16 (CCITT; polynomial 1021h, initial value FFFFh)
+uint16_t ULC_Sync_CRC16(const void *Data, int nBytes);
+
+//! Write sync frame header
+//! FrameData[] must contain the FrameBytes bytes of block data that
+//! will follow this header. The header is written to Dst.
+//! Returns the number of bytes written (ULC_SYNC_HEADER_SIZE).
+int ULC_Sync_WriteHeader(void *Dst, const void *FrameData, const struct ULC_SyncFrame_t *Frame);
+
+//! Read sync frame header
+//! Returns a positive value if a valid header was found at Src.
+//! If SrcBytes is large enough to contain the full frame, its CRC
+//! is also checked, and a negative value is returned on mismatch.
+//! Returns 0 if no (valid) header exists at Src.
+int ULC_Sync_ReadHeader(const void *Src, int SrcBytes, struct ULC_SyncFrame_t *Frame);
+
+//! Search for the next sync frame header
+//! Returns the offset of the first valid header in Src (note that
+//! the frame data itself is not checked), or a negative value if
+//! no header was found.
+int ULC_Sync_Find(const void *Src, int SrcBytes);
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -18,14 +18,15 @@
 #define MIN_CHANS    1
 #define MAX_CHANS  255
 #define MIN_BANDS  256
-#define MAX_BANDS 8192
+#define MAX_BANDS FOURIER_SINTABLE_MAX_N //! Limited by the sine tables (8192 by default)
 
 /**************************************/
 
 //! Initialize decoder state
 int ULC_DecoderState_Init(struct ULC_DecoderState_t *State) {
 	//! Clear anything that is needed for EncoderState_Destroy()
-	State->BufferData  = NULL;
+	State->BufferData       = NULL;
+	State->OutputBufferData = NULL;
 
 	//! Verify parameters
 	int nChan     = State->nChan;
@@ -37,9 +38,9 @@ int ULC_DecoderState_Init(struct ULC_DecoderState_t *State) {
 	//! Get buffer offsets and allocation size
 	int AllocSize = 0;
 #define CREATE_BUFFER(Name, Sz) int Name##_Offs = AllocSize; AllocSize += Sz
-	CREATE_BUFFER(TransformBuffer, sizeof(float) * (       BlockSize   ));
-	CREATE_BUFFER(TransformTemp,   sizeof(float) * (       BlockSize   ));
-	CREATE_BUFFER(TransformInvLap, sizeof(float) * (nChan*(BlockSize/2)));
+	CREATE_BUFFER(TransformTemp,   sizeof(ULC_DecoderSample_t) * (       BlockSize   ));
+	CREATE_BUFFER(TransformInvLap, sizeof(ULC_DecoderSample_t) * (nChan*(BlockSize/2)));
+	CREATE_BUFFER(TransformLapZero, sizeof(char) * nChan);
 #undef CREATE_BUFFER
 
 	//! Allocate buffer space
@@ -47,13 +48,17 @@ int ULC_DecoderState_Init(struct ULC_DecoderState_t *State) {
 	if(!Buf) return -1;
 
 	//! Initialize state
-	int i;
 	Buf += (-(uintptr_t)Buf) & (BUFFER_ALIGNMENT-1);
-	State->LastSubBlockSize = 0;
-	State->TransformBuffer = (float*)(Buf + TransformBuffer_Offs);
-	State->TransformTemp   = (float*)(Buf + TransformTemp_Offs);
-	State->TransformInvLap = (float*)(Buf + TransformInvLap_Offs);
-	for(i=0;i<nChan*(BlockSize/2);i++) State->TransformInvLap[i] = 0.0f;
+	State->TransformTemp   = (ULC_DecoderSample_t*)(Buf + TransformTemp_Offs);
+	State->TransformInvLap = (ULC_DecoderSample_t*)(Buf + TransformInvLap_Offs);
+	State->OutputBuffer    = NULL;
+	State->TransformLapZero = (unsigned char*)(Buf + TransformLapZero_Offs);
+#if ULC_USE_FIXED_POINT
+	State->Kernels         = NULL;
+#else
+	State->Kernels         = Fourier_GetKernels();
+#endif
+	ULC_DecoderState_Reset(State);
 
 	//! Success
 	return 1;
@@ -61,10 +66,40 @@ int ULC_DecoderState_Init(struct ULC_DecoderState_t *State) {
 
 /**************************************/
 
+//! Reset decoder state
+void ULC_DecoderState_Reset(struct ULC_DecoderState_t *State) {
+	int i;
+	int nChan     = State->nChan;
+	int BlockSize = State->BlockSize;
+	State->LastSubBlockSize = 0;
+	State->OutputPos        = BlockSize;
+	State->StreamConsumed   = 0;
+	State->StreamError      = 0;
+	for(i=0;i<nChan*(BlockSize/2);i++) State->TransformInvLap[i] = 0;
+	for(i=0;i<nChan;i++) State->TransformLapZero[i] = 1;
+}
+
+/**************************************/
+
 //! Destroy decoder state
 void ULC_DecoderState_Destroy(struct ULC_DecoderState_t *State) {
 	//! Free buffer space
 	free(State->BufferData);
+	free(State->OutputBufferData);
+}
+
+/**************************************/
+
+//! Get output buffer, allocating it on first use
+//! Returns NULL on failure.
+static ULC_DecoderSample_t *GetOutputBuffer(struct ULC_DecoderState_t *State) {
+	if(!State->OutputBuffer) {
+		char *Buf = State->OutputBufferData = malloc(BUFFER_ALIGNMENT-1 + sizeof(ULC_DecoderSample_t)*State->nChan*State->BlockSize);
+		if(!Buf) return NULL;
+		Buf += (-(uintptr_t)Buf) & (BUFFER_ALIGNMENT-1);
+		State->OutputBuffer = (ULC_DecoderSample_t*)Buf;
+	}
+	return State->OutputBuffer;
 }
 
 /**************************************/
@@ -72,12 +107,36 @@ void ULC_DecoderState_Destroy(struct ULC_DecoderState_t *State) {
 //! Decode block
 #define ESCAPE_SEQUENCE_STOP           (-1)
 #define ESCAPE_SEQUENCE_STOP_NOISEFILL (-2)
+#define ESCAPE_SEQUENCE_UNALLOCATED    (-3)
+//! NOTE: Fixed-point decoders hold quantizers and random values in
+//! .31 fixed-point (so that even the smallest quantizer, 2^-31 at
+//! qi = 26, is exact), and coefficients in .27 fixed-point; ie. with
+//! BLOCK_DECODE_FIXED_COEF_EXTRABITS more fractional bits than the
+//! output samples. These are kept through the DCT-IV and rounded off
+//! by Fourier_IMDCT_Fixed(), at the cost of as many bits of headroom
+//! (see ulcDecoder.h). Coefficients that are each below an LSB can
+//! otherwise still add up to several LSBs of error in the output.
+#define BLOCK_DECODE_FIXED_COEF_EXTRABITS 4
+#define BLOCK_DECODE_FIXED_COEF_FRACBITS  (ULC_DECODER_FIXED_FRACBITS + BLOCK_DECODE_FIXED_COEF_EXTRABITS)
+#if ULC_USE_FIXED_POINT
+typedef int32_t Block_Decode_Quant_t;
+#else
+typedef float   Block_Decode_Quant_t;
+#endif
+#if ULC_USE_FIXED_POINT
+static inline int32_t Block_Decode_RandomCoef(void) {
+#else
 static inline float Block_Decode_RandomCoef(void) {
+#endif
 	static uint32_t Seed = 1234567;
 	Seed ^= Seed << 13; //! Xorshift
 	Seed ^= Seed >> 17;
 	Seed ^= Seed <<  5;
+#if ULC_USE_FIXED_POINT
+	return (int32_t)Seed;
+#else
 	return (int32_t)Seed * 0x1.0p-31f;
+#endif
 }
 static inline uint8_t Block_Decode_ReadNybble(const uint8_t **Src, int *Size) {
 	//! Fetch and shift nybble
@@ -89,26 +148,64 @@ static inline uint8_t Block_Decode_ReadNybble(const uint8_t **Src, int *Size) {
 static inline int Block_Decode_ReadQuantizer(const uint8_t **Src, int *Size) {
 	int           qi  = Block_Decode_ReadNybble(Src, Size); //! 8h,0h,0h..Dh:      Quantizer change
 	if(qi == 0xF) return ESCAPE_SEQUENCE_STOP_NOISEFILL;    //! 8h,0h,Fh,Zh,Yh,Xh: Noise fill (to end; exp-decay)
-	if(qi == 0xE) qi += Block_Decode_ReadNybble(Src, Size); //! 8h,0h,Eh,0h..Ch:   Quantizer change (extended precision)
-	if(qi == 0xE + 0xF) return ESCAPE_SEQUENCE_STOP;        //! 8h,0h,Eh,Fh:       Zeros fill (to end)
+	if(qi == 0xE) {
+		qi += Block_Decode_ReadNybble(Src, Size);           //! 8h,0h,Eh,0h..Ch:   Quantizer change (extended precision)
+		if(qi == 0xE + 0xF) return ESCAPE_SEQUENCE_STOP;    //! 8h,0h,Eh,Fh:       Zeros fill (to end)
+		if(qi >  0xE + 0xC) return ESCAPE_SEQUENCE_UNALLOCATED;
+	}
 	return qi;
 }
-static inline float Block_Decode_ExpandQuantizer(int qi) {
+static inline Block_Decode_Quant_t Block_Decode_ExpandQuantizer(int qi) {
+#if ULC_USE_FIXED_POINT
+	return (1u<<(31-5)) >> qi; //! 1 / (2^5 * 2^qi)
+#else
 	return 0x1.0p-31f * ((1u<<(31-5)) >> qi); //! 1 / (2^5 * 2^qi)
+#endif
+}
+static inline ULC_DecoderSample_t Block_Decode_Dequantize(int32_t v, Block_Decode_Quant_t Quant) {
+#if ULC_USE_FIXED_POINT
+	return ((int64_t)v*Quant + (1 << (31-BLOCK_DECODE_FIXED_COEF_FRACBITS-1))) >> (31-BLOCK_DECODE_FIXED_COEF_FRACBITS); //! |v| <= 49, so v*Quant needs 33 bits
+#else
+	return v * Quant;
+#endif
+}
+#if ULC_USE_FIXED_POINT
+static inline ULC_DecoderSample_t Block_Decode_NoiseCoef(Block_Decode_Quant_t p, int32_t r) {
+	return ((int64_t)p*r + (1ll << (31+31-BLOCK_DECODE_FIXED_COEF_FRACBITS-1))) >> (31+31-BLOCK_DECODE_FIXED_COEF_FRACBITS);
 }
-static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const uint8_t **Src, int *Size) {
+#else
+static inline ULC_DecoderSample_t Block_Decode_NoiseCoef(Block_Decode_Quant_t p, float r) {
+	return p * r;
+}
+#endif
+//! Returns a negative value on malformed data, and 1 when the
+//! subblock is silent (ie. starts with a Stop code)
+//! NOTE: We only allow as many quantizer changes as there have been
+//! coefficients decoded so far (the initial quantizer excluded), as
+//! these are the only sequences that read data without producing any
+//! coefficients. This limits the amount of data a subblock can read to
+//! BLOCK_DECODE_MAX_SUBBLOCK_BYTES(N) without any per-nybble checks:
+//!  Initial quantizer:     2 nybbles
+//!  Each coefficient:   <= 2 nybbles (8h,1h..Fh)
+//!  Quantizer changes:  <= 4 nybbles (8h,0h,Eh,0h..Ch), at most N of them
+//!  Stop sequence:      <= 6 nybbles (8h,0h,Fh,Zh,Yh,Xh)
+//! For a total of 6N+8 nybbles, plus the partially-read first byte.
+#define BLOCK_DECODE_MAX_SUBBLOCK_BYTES(N) (3*(N) + 5)
+static inline int Block_Decode_DecodeSubBlockCoefs(ULC_DecoderSample_t *CoefDst, int N, const uint8_t **Src, int *Size) {
 	int32_t n, v;
+	int nQuantChanges = 0, nCoefLeft = N;
 
 	//! Check first quantizer for Stop code
 	v = Block_Decode_ReadQuantizer(Src, Size);
 	if(v == ESCAPE_SEQUENCE_STOP) {
 		//! [8h,0h,]Eh,Fh: Stop
-		do *CoefDst++ = 0.0f; while(--N);
-		return;
+		do *CoefDst++ = 0; while(--N);
+		return 1;
 	}
+	if(v < 0) goto Malformed; //! Noise fill cannot start a subblock (no quantizer)
 
 	//! Unpack the [sub]block's coefficients
-	float Quant = Block_Decode_ExpandQuantizer(v);
+	Block_Decode_Quant_t Quant = Block_Decode_ExpandQuantizer(v);
 	for(;;) {
 		//! -7h..-1h, +1..+7h: Normal
 		v = Block_Decode_ReadNybble(Src, Size);
@@ -116,7 +213,7 @@ static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const
 			//! Store linearized, dequantized coefficient
 			v = (v^0x8) - 0x8; //! Sign extension
 			v = (v < 0) ? (-v*v) : (+v*v);
-			*CoefDst++ = v * Quant;
+			*CoefDst++ = Block_Decode_Dequantize(v, Quant);
 			if(--N == 0) break;
 			continue;
 		}
@@ -132,9 +229,9 @@ static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const
 			if(n > N) n = N; //! <- Clip on corrupt blocks
 			N -= n;
 			if(v) {
-				float p = v * Quant;
-				do *CoefDst++ = p * Block_Decode_RandomCoef(); while(--n);
-			} else do *CoefDst++ = 0.0f; while(--n);
+				Block_Decode_Quant_t p = v * Quant;
+				do *CoefDst++ = Block_Decode_NoiseCoef(p, Block_Decode_RandomCoef()); while(--n);
+			} else do *CoefDst++ = 0; while(--n);
 			if(N == 0) break;
 			continue;
 		}
@@ -145,7 +242,7 @@ static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const
 			n = v;
 			if(n > N) n = N; //! <- Clip on corrupt blocks
 			N -= n;
-			do *CoefDst++ = 0.0f; while(--n);
+			do *CoefDst++ = 0; while(--n);
 			if(N == 0) break;
 			continue;
 		}
@@ -154,6 +251,7 @@ static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const
 		//! 8h,0h,Eh,0h..Ch: Quantizer change (extended precision)
 		v = Block_Decode_ReadQuantizer(Src, Size);
 		if(v >= 0) {
+			if(++nQuantChanges > nCoefLeft - N) goto Malformed;
 			Quant = Block_Decode_ExpandQuantizer(v);
 			continue;
 		}
@@ -165,40 +263,73 @@ static inline void Block_Decode_DecodeSubBlockCoefs(float *CoefDst, int N, const
 			if(v&1) n = Block_Decode_ReadNybble(Src, Size) | (n<<4);
 			v = 1 + (v>>1);
 			n = n;
+#if ULC_USE_FIXED_POINT
+			//! The decaying quantizer is held with 16 extra bits of
+			//! precision, as slow decays would otherwise stall
+			int64_t p = (int64_t)(v * Quant) << 16;
+			int32_t r = 0x10000 - n*n;
+			do {
+				*CoefDst++ = Block_Decode_NoiseCoef((int32_t)(p >> 16), Block_Decode_RandomCoef());
+				p = (p*r + 0x8000) >> 16;
+			} while(--N);
+#else
 			float p = v * Quant;
 			float r = 1.0f + (n*n)*-0x1.0p-16f;
 			do {
 				*CoefDst++ = p * Block_Decode_RandomCoef();
 				p *= r;
 			} while(--N);
+#endif
 			break;
 		}
 
-		//! 8h,0h,Eh,Dh: Unused
-		//! 8h,0h,Eh,Eh: Unused
 		//! 8h,0h,Eh,Fh: Zeros fill (to end)
 		if(v == ESCAPE_SEQUENCE_STOP) {
-			do *CoefDst++ = 0.0f; while(--N);
+			do *CoefDst++ = 0; while(--N);
 			break;
 		}
+
+		//! 8h,0h,Eh,Dh: Unallocated
+		//! 8h,0h,Eh,Eh: Unallocated
+		goto Malformed;
 	}
+	return 0;
+
+	//! Malformed data: Clear the remaining coefficients and return an error
+Malformed:
+	do *CoefDst++ = 0; while(--N);
+	return -1;
 }
-int ULC_DecodeBlock(struct ULC_DecoderState_t *State, float *DstData, const void *_SrcBuffer) {
+//! NOTE: SrcEnd == NULL reads without bounds. Otherwise, any subblock
+//! that might read past SrcEnd is decoded from a zero-padded copy in
+//! TransformTemp (in a part that is unused during coefficient decoding),
+//! and Malformed is set if the block was malformed or over-ran.
+//! NOTE: When Preroll != 0, the output is discarded (and DstData is
+//! only used as scratch space); see ULC_DecoderState_Seek().
+static int Block_Decode(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, int Preroll, const void *_SrcBuffer, const uint8_t *SrcEnd, int *Malformed) {
 	//! Spill state to local variables to make things easier to read
 	//! PONDER: Hopefully the compiler realizes that State is const and
 	//!         doesn't just copy the whole thing out to the stack :/
 	int    n;
 	int    nChan           = State->nChan;
 	int    BlockSize       = State->BlockSize;
-	float *TransformBuffer = State->TransformBuffer;
-	float *TransformTemp   = State->TransformTemp;
-	float *TransformInvLap = State->TransformInvLap;
-	const float *ModulationWindow = State->ModulationWindow;
+	ULC_DecoderSample_t *TransformTemp   = State->TransformTemp;
+	ULC_DecoderSample_t *TransformInvLap = State->TransformInvLap;
+	const ULC_DecoderWindow_t *ModulationWindow = State->ModulationWindow;
+#if !ULC_USE_FIXED_POINT
+	const struct Fourier_Kernels_t *Kernels = State->Kernels;
+#endif
 	const uint8_t *SrcBuffer = _SrcBuffer;
 
 	//! Begin decoding
 	int Chan, Size = 0;
 	int LastSubBlockSize = 0; //! <- Shuts gcc up
+	int SideSilent = 0;
+	*Malformed = 0;
+	if(SrcEnd && SrcEnd - SrcBuffer < 1) {
+		*Malformed = 1;
+		return 0;
+	}
 	int WindowCtrl; {
 		//! Read window control information
 		WindowCtrl = Block_Decode_ReadNybble(&SrcBuffer, &Size);
@@ -210,73 +341,315 @@ int ULC_DecodeBlock(struct ULC_DecoderState_t *State, float *DstData, const void
 		LastSubBlockSize = State->LastSubBlockSize;
 
 		//! Process subblocks
-		float *Dst = DstData + Chan*BlockSize;
-		float *Src = TransformBuffer;
-		float *Lap = TransformInvLap;
+		//! The lapping buffer holds all samples that have been decoded
+		//! but not yet output, in reverse order, ending at sample LapEnd
+		//! of this block (ie. Lap[n] = Dst[LapEnd-1-n], n < LapEnd-OutPos).
+		//! The first values are the lapping half of the last IMDCT, and
+		//! the rest are finished samples (which IMDCT() passes through
+		//! unchanged in the non-overlapping part of its window).
+		//! Each subblock's IMDCT output starts half a subblock before
+		//! LapEnd, and whenever it ends inside this block, we decode
+		//! and inverse-transform directly in the output buffer; the
+		//! lapping buffer then only ever holds the last lapping half.
+		//! NOTE: When pre-rolling, we only need to update the lapping
+		//! buffer, and the output will be overwritten by the next block.
+		ULC_DecoderSample_t *Dst = DstData + Chan*BlockSize;
+		ULC_DecoderSample_t *Lap = TransformInvLap;
+		int OutPos = 0, LapEnd = BlockSize/2;
+		int LapZero = State->TransformLapZero[Chan], LastSilent = 0;
 		ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
 		do {
 			int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
-			Block_Decode_DecodeSubBlockCoefs(Src, SubBlockSize, &SrcBuffer, &Size);
+			int DecPos = LapEnd - SubBlockSize/2;
+			int Direct = (DecPos + SubBlockSize <= BlockSize);
+
+			//! When this subblock is larger than the last, its lapping
+			//! half reaches back into samples that were already output
+			//! (but that are finished), so fetch these back first.
+			//! Then output any finished samples before this subblock.
+			for(n=LapEnd-OutPos;n<SubBlockSize/2;n++) Lap[n] = Dst[LapEnd-1-n];
+			for(n=OutPos;n<DecPos && n<BlockSize;n++) Dst[n] = Lap[LapEnd-1-n];
 
 			//! Get+update overlap size and limit to that of the last subblock
+			//! NOTE: The encoder never codes overlaps below 16 samples,
+			//! which is also the smallest window in the sine tables.
 			int OverlapSize = SubBlockSize;
-			if(DecimationPattern&0x8)
+			if(DecimationPattern&0x8) {
 				OverlapSize >>= (WindowCtrl & 0x7);
+				if(OverlapSize < 16) OverlapSize = 16, *Malformed = 1;
+			}
 			if(OverlapSize > LastSubBlockSize)
 				OverlapSize = LastSubBlockSize;
 			LastSubBlockSize = SubBlockSize;
 
-			//! A single long block can be read straight into the output buffer
-			if(SubBlockSize == BlockSize) {
-				Fourier_IMDCT(Dst, Src, Lap, TransformTemp, SubBlockSize, OverlapSize, ModulationWindow);
+			//! Small subblocks that are followed by more of the same
+			//! size (and so with the same overlap), all of which end
+			//! inside this block, are decoded together and then batched
+			//! through the IMDCT (see Fourier_IMDCT_Batch()).
+			int nBatch = 1;
+			if(Direct && SubBlockSize <= FOURIER_BATCH_MAX_N && OverlapSize == SubBlockSize) {
+				while(((DecimationPattern >> 4*nBatch) & 0xF) == (DecimationPattern & 0x7) && DecPos + (nBatch+1)*SubBlockSize <= BlockSize) {
+					nBatch++;
+				}
+			}
+
+			//! Decode coefficients and get the IMDCT output buffer
+			//! NOTE: Single small IMDCTs can't be fused with their DCT-IV,
+			//! and so are done in place in TransformTemp to avoid a copy.
+			//! Large and batched IMDCTs are done in place in their output
+			//! buffer.
+			int Batch, Silent = 1;
+			ULC_DecoderSample_t *DecBuf = Direct ? (Dst + DecPos) : (TransformTemp + SubBlockSize);
+			ULC_DecoderSample_t *Coef   = (SubBlockSize < FOURIER_MDCT_FUSE_MIN_N && nBatch == 1) ? TransformTemp : DecBuf;
+			for(Batch=0;Batch<nBatch;Batch++) {
+				int Result;
+				ULC_DecoderSample_t *BatchCoef = Coef + Batch*SubBlockSize;
+				if(SrcEnd && SrcEnd - SrcBuffer < BLOCK_DECODE_MAX_SUBBLOCK_BYTES(SubBlockSize)) {
+					//! Near the end of the buffer: Decode from a padded copy.
+					//! Zero padding decodes as zeros runs, so the over-read
+					//! into the padding is small (and detected afterwards).
+					int nRem = SrcEnd - SrcBuffer;
+					uint8_t *Pad = (uint8_t*)((Coef == TransformTemp) ? (TransformTemp + 2*SubBlockSize) : TransformTemp);
+					const uint8_t *PadSrc = Pad;
+					for(n=0;n<nRem;n++) Pad[n] = SrcBuffer[n];
+					for(   ;n<BLOCK_DECODE_MAX_SUBBLOCK_BYTES(SubBlockSize);n++) Pad[n] = 0;
+					Result = Block_Decode_DecodeSubBlockCoefs(BatchCoef, SubBlockSize, &PadSrc, &Size);
+					SrcBuffer += PadSrc - Pad;
+					if(SrcBuffer > SrcEnd) {
+						//! Over-ran the buffer; all further reads come from padding
+						*Malformed = 1;
+						SrcBuffer  = SrcEnd;
+					}
+				} else Result = Block_Decode_DecodeSubBlockCoefs(BatchCoef, SubBlockSize, &SrcBuffer, &Size);
+				if(Result < 0) *Malformed = 1;
+				if(Result != 1) Silent = 0;
+			}
+			LastSilent = Silent;
+
+			//! Silent subblocks over a silent lapping buffer decode to
+			//! silence, and leave the lapping buffer silent, so skip the
+			//! IMDCT and just clear the output. Everything that was
+			//! output so far in this block is then also silent, so the
+			//! samples fetched back (and output) above were all zeros.
+			//! NOTE: Direct, unfused subblocks have already cleared their
+			//! output as part of decoding their coefficients.
+			if(Silent && LapZero) {
+				if(Preroll && SubBlockSize == BlockSize) break;
+				if(!Direct || Coef != DecBuf) {
+					int End = DecPos + nBatch*SubBlockSize;
+					if(End > BlockSize) End = BlockSize;
+					for(n=DecPos;n<End;n++) Dst[n] = 0;
+				}
+				DecimationPattern >>= 4*(nBatch-1);
+				LapEnd += nBatch*SubBlockSize;
+				OutPos  = Direct ? (DecPos + nBatch*SubBlockSize) : BlockSize;
+				continue;
+			}
+			LapZero = 0;
+
+			//! Pre-roll of a single long block: The output is discarded,
+			//! so we only need the lapping half of the IMDCT (see
+			//! Fourier_IMDCT())
+			if(Preroll && SubBlockSize == BlockSize) {
+#if ULC_USE_FIXED_POINT
+				Fourier_DCT4_Fixed(Coef, TransformTemp, SubBlockSize);
+				for(n=0;n<SubBlockSize/2;n++) {
+					Lap[n] = (Coef[n] + (1 << (BLOCK_DECODE_FIXED_COEF_EXTRABITS-1))) >> BLOCK_DECODE_FIXED_COEF_EXTRABITS;
+				}
+#else
+				Kernels->DCT4(Coef, TransformTemp, SubBlockSize);
+				for(n=0;n<SubBlockSize/2;n++) Lap[n] = Coef[n];
+#endif
 				break;
 			}
 
-			//! For small blocks, we store the decoded data to a scratch buffer
-			float *DecBuf = TransformTemp + SubBlockSize;
-			Fourier_IMDCT(DecBuf, Src, Lap, TransformTemp, SubBlockSize, OverlapSize, ModulationWindow);
-
-			//! Output samples from the lapping buffer, and cycle
-			//! the new samples through it for the next call
-			int nAvailable = (BlockSize - SubBlockSize) / 2;
-			      float *LapDst = Lap + BlockSize/2;
-			const float *LapSrc = LapDst;
-			if(SubBlockSize <= nAvailable) {
-				//! We have enough data in the lapping buffer
-				//! to output a full subblock directly from it,
-				//! so we do that and then shift any remaining
-				//! data before re-filling the buffer.
-				for(n=0;n<SubBlockSize;n++) *Dst++    = *--LapSrc;
-				for(   ;n<nAvailable  ;n++) *--LapDst = *--LapSrc;
-				for(n=0;n<SubBlockSize;n++) *--LapDst = *DecBuf++;
-			} else {
-				//! We only have enough data for a partial output
-				//! from the lapping buffer, so output what we can
-				//! and output the rest from the decoded buffer
-				//! before re-filling.
-				for(n=0;n<nAvailable;  n++) *Dst++    = *--LapSrc;
-				for(   ;n<SubBlockSize;n++) *Dst++    = *DecBuf++;
-				for(n=0;n<nAvailable;  n++) *--LapDst = *DecBuf++;
+			//! Inverse transform
+			//! NOTE: Fixed-point builds have no batched IMDCT, so just
+			//! chain the IMDCTs through the lapping buffer.
+#if ULC_USE_FIXED_POINT
+			for(Batch=0;Batch<nBatch;Batch++) {
+				Fourier_IMDCT_Fixed(DecBuf + Batch*SubBlockSize, Coef + Batch*SubBlockSize, Lap, TransformTemp, SubBlockSize, OverlapSize, ModulationWindow, BLOCK_DECODE_FIXED_COEF_EXTRABITS);
+			}
+			DecimationPattern >>= 4*(nBatch-1);
+#else
+			if(nBatch > 1) {
+				Kernels->IMDCT_Batch(DecBuf, Coef, Lap, TransformTemp, SubBlockSize, OverlapSize, ModulationWindow, nBatch, SubBlockSize, 0);
+				DecimationPattern >>= 4*(nBatch-1);
+			} else Kernels->IMDCT(DecBuf, Coef, Lap, TransformTemp, SubBlockSize, OverlapSize, ModulationWindow);
+#endif
+			LapEnd += nBatch*SubBlockSize;
+			if(Direct) {
+				OutPos = DecPos + nBatch*SubBlockSize;
+				continue;
+			}
+
+			//! The output runs past the end of this block, so output
+			//! what we can, and keep the rest in the lapping buffer,
+			//! behind the new lapping data. Finished samples that are
+			//! still waiting in the lapping buffer are shifted up to
+			//! make room (starting from the end, as they overlap).
+			for(n=(OutPos > BlockSize) ? OutPos : BlockSize;n<DecPos;n++) {
+				Lap[LapEnd-1-n] = Lap[LapEnd-1-n-SubBlockSize];
 			}
+			for(n=DecPos;n<BlockSize;n++) Dst[n] = DecBuf[n-DecPos];
+			for(n=(DecPos > BlockSize) ? DecPos : BlockSize;n<DecPos+SubBlockSize;n++) {
+				Lap[LapEnd-1-n] = DecBuf[n-DecPos];
+			}
+			OutPos = BlockSize;
 		} while(DecimationPattern >>= 4);
 
+		//! If the lapping buffer stayed silent, so did the output
+		//! (see M/S transform below)
+		if(Chan == 1) SideSilent = LapZero;
+
+		//! Once a channel falls silent, its lapping buffer becomes
+		//! silent too, after the last lapping tail has been output
+		if(!LapZero && LastSilent) {
+			LapZero = 1;
+			for(n=0;n<BlockSize/2;n++) if(Lap[n] != 0) {
+				LapZero = 0;
+				break;
+			}
+		}
+		State->TransformLapZero[Chan] = LapZero;
+
 		//! Move to next channel
 		TransformInvLap += BlockSize/2;
 	}
 
 	//! Undo M/S transform
 	//! NOTE: Not orthogonal; must be fully normalized on the encoder side.
-	if(nChan == 2) for(n=0;n<BlockSize;n++) {
-		float M = DstData[n];
-		float S = DstData[n + BlockSize];
-		DstData[n]             = M+S;
-		DstData[n + BlockSize] = M-S;
+	//! NOTE: Dual-mono data codes the S channel as silence (see
+	//! Block_Transform()), in which case L = R = M.
+	if(nChan == 2 && !Preroll) {
+		if(SideSilent) {
+			for(n=0;n<BlockSize;n++) DstData[n + BlockSize] = DstData[n];
+		} else for(n=0;n<BlockSize;n++) {
+			ULC_DecoderSample_t M = DstData[n];
+			ULC_DecoderSample_t S = DstData[n + BlockSize];
+			DstData[n]             = M+S;
+			DstData[n + BlockSize] = M-S;
+		}
 	}
 
 	//! Store the last [sub]block size, and return the number of bits read
 	State->LastSubBlockSize = LastSubBlockSize;
 	return Size;
 }
+int ULC_DecodeBlock(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, const void *SrcBuffer) {
+	int Malformed;
+	return Block_Decode(State, DstData, 0, SrcBuffer, NULL, &Malformed);
+}
+int ULC_DecodeBlockEx(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, const void *SrcBuffer, int SrcBytes) {
+	int Malformed;
+	if(SrcBytes < 0) return -1;
+	int Size = Block_Decode(State, DstData, 0, SrcBuffer, (const uint8_t*)SrcBuffer + SrcBytes, &Malformed);
+	return (Malformed || Size > 8*SrcBytes) ? -1 : Size;
+}
+
+/**************************************/
+
+//! Seek to sample
+int ULC_DecoderState_Seek(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *DstData, int Sample, ULC_DecoderSourceFnc_t SrcFnc, void *User) {
+	int Malformed;
+	int BlockSize = State->BlockSize;
+	if(Sample < 0) return -1;
+
+	//! Decoding to the output buffer?
+	int ToOutputBuffer = !DstData;
+	if(ToOutputBuffer) {
+		DstData = GetOutputBuffer(State);
+		if(!DstData) return -1;
+	}
+
+	//! Reset decoding state
+	//! NOTE: Any output that depends on lapping from blocks prior
+	//! to the pre-roll block is always output by the pre-roll block
+	//! itself (at most BlockSize/2 samples), so this is safe.
+	ULC_DecoderState_Reset(State);
+
+	//! Pre-roll the previous block to prime the lapping buffer
+	//! NOTE: This uses DstData as scratch space, as it will be
+	//! overwritten by the target block anyway.
+	int Block = Sample / BlockSize;
+	const void *Src;
+	if(Block > 0) {
+		Src = SrcFnc(User, Block-1);
+		if(!Src) return -1;
+		Block_Decode(State, DstData, 1, Src, NULL, &Malformed);
+	}
+
+	//! Decode the block containing the target sample
+	//! If decoding to the output buffer, the next ULC_DecoderRead()
+	//! call will then start at the target sample.
+	Src = SrcFnc(User, Block);
+	if(!Src) return -1;
+	if(ToOutputBuffer) State->OutputPos = Sample - Block*BlockSize;
+	Block_Decode(State, DstData, 0, Src, NULL, &Malformed);
+	return Sample - Block*BlockSize;
+}
+
+/**************************************/
+
+//! Read samples
+int ULC_DecoderRead(struct ULC_DecoderState_t *State, ULC_DecoderSample_t *Dst, int nFrames, ULC_DecoderStreamFnc_t SrcFnc, void *User) {
+	int n, Chan;
+	int nChan        = State->nChan;
+	int BlockSize    = State->BlockSize;
+	ULC_DecoderSample_t *OutBuf = State->OutputBuffer;
+	int    OutPos    = State->OutputPos;
+	int    nRem      = nFrames;
+	State->StreamError = 0;
+	while(nRem) {
+		//! Output buffer empty?
+		if(OutPos == BlockSize) {
+			//! For mono streams (where planar and interleaved data
+			//! are the same), decode directly to the output when
+			//! it's aligned and we need the whole block. Otherwise,
+			//! decode to the output buffer.
+			int DirectOutput = (nChan == 1 && nRem >= BlockSize && ((uintptr_t)Dst & (BUFFER_ALIGNMENT-1)) == 0);
+			if(!DirectOutput && !OutBuf) {
+				OutBuf = GetOutputBuffer(State);
+				if(!OutBuf) break;
+			}
+
+			//! Fetch the next block from the stream
+			int SrcBytes;
+			const void *Src = SrcFnc(User, State->StreamConsumed, &SrcBytes);
+			State->StreamConsumed = 0;
+			if(!Src || SrcBytes <= 0) break;
+
+			//! Decode the block
+			int Size = ULC_DecodeBlockEx(State, DirectOutput ? Dst : OutBuf, Src, SrcBytes);
+			if(Size < 0) {
+				//! Malformed: Reset, leaving the block unconsumed
+				ULC_DecoderState_Reset(State);
+				State->StreamError = 1;
+				break;
+			}
+			State->StreamConsumed = (Size + 7) / 8u;
+			if(DirectOutput) {
+				Dst  += BlockSize;
+				nRem -= BlockSize;
+				continue;
+			}
+			OutPos = 0;
+		}
+
+		//! Interleave from the output buffer
+		int nCopy = BlockSize - OutPos;
+		if(nCopy > nRem) nCopy = nRem;
+		for(Chan=0;Chan<nChan;Chan++) {
+			const ULC_DecoderSample_t *Src = OutBuf + Chan*BlockSize + OutPos;
+			for(n=0;n<nCopy;n++) Dst[n*nChan+Chan] = Src[n];
+		}
+		Dst    += nCopy*nChan;
+		OutPos += nCopy;
+		nRem   -= nCopy;
+	}
+	State->OutputPos = OutPos;
+	return nFrames - nRem;
+}
 
 /**************************************/
 //! EOF
@@ -11,18 +11,62 @@
 #include "ulcEncoder.h"
 #include "ulcHelper.h"
 /**************************************/
-#include "ulcEncoder_BlockTransform.h"
-#include "ulcEncoder_Encode.h"
-/**************************************/
 #define BUFFER_ALIGNMENT 64u //! Always align memory to 64-byte boundaries (preparation for AVX-512)
 /**************************************/
 
 #define MIN_CHANS    1
 #define MAX_CHANS  255
 #define MIN_BANDS  256 //! Limited by the transient detector's decimation
-#define MAX_BANDS 8192
+#define MAX_BANDS FOURIER_SINTABLE_MAX_N //! Limited by the sine tables (8192 by default)
 #define MIN_OVERLAP 16 //! Depends on SIMD routines; setting as 16 arbitrarily
 
+/**************************************/
+
+//! Encoder kernels (see ulcEncoder_Kernels.c)
+struct ULC_EncoderKernels_t {
+	int  (*Transform) (struct ULC_EncoderState_t *State, const float *Data);
+	void (*Analyze)   (struct ULC_EncoderState_t *State, int Stages);
+	int  (*EncodePass)(const struct ULC_EncoderState_t *State, void *DstBuffer, int nOutCoef);
+};
+#define DECLARE_KERNELS(Isa) \
+	int  ULC_EncoderKernel_Transform_##Isa (struct ULC_EncoderState_t *State, const float *Data); \
+	void ULC_EncoderKernel_Analyze_##Isa   (struct ULC_EncoderState_t *State, int Stages); \
+	int  ULC_EncoderKernel_EncodePass_##Isa(const struct ULC_EncoderState_t *State, void *DstBuffer, int nOutCoef); \
+	static const struct ULC_EncoderKernels_t ULC_EncoderKernels_##Isa = { \
+		.Transform  = ULC_EncoderKernel_Transform_##Isa, \
+		.Analyze    = ULC_EncoderKernel_Analyze_##Isa, \
+		.EncodePass = ULC_EncoderKernel_EncodePass_##Isa, \
+	}
+#if defined(FOURIER_HAVE_Scalar)
+DECLARE_KERNELS(Scalar);
+#endif
+#if defined(FOURIER_HAVE_SSE2)
+DECLARE_KERNELS(SSE2);
+#endif
+#if defined(FOURIER_HAVE_AVX2)
+DECLARE_KERNELS(AVX2);
+#endif
+#if defined(FOURIER_HAVE_AVX512)
+DECLARE_KERNELS(AVX512);
+#endif
+#undef DECLARE_KERNELS
+static const struct ULC_EncoderKernels_t *const ULC_EncoderKernels[FOURIER_ISA_LEVEL_COUNT] = {
+#if defined(FOURIER_HAVE_Scalar)
+	[FOURIER_ISA_LEVEL_Scalar] = &ULC_EncoderKernels_Scalar,
+#endif
+#if defined(FOURIER_HAVE_SSE2)
+	[FOURIER_ISA_LEVEL_SSE2]   = &ULC_EncoderKernels_SSE2,
+#endif
+#if defined(FOURIER_HAVE_AVX2)
+	[FOURIER_ISA_LEVEL_AVX2]   = &ULC_EncoderKernels_AVX2,
+#endif
+#if defined(FOURIER_HAVE_AVX512)
+	[FOURIER_ISA_LEVEL_AVX512] = &ULC_EncoderKernels_AVX512,
+#endif
+};
+
+/**************************************/
+
 //! Initialize encoder state
 int ULC_EncoderState_Init(struct ULC_EncoderState_t *State) {
 	//! Clear anything that is needed for EncoderState_Destroy()
@@ -37,18 +81,27 @@ int ULC_EncoderState_Init(struct ULC_EncoderState_t *State) {
 
 	//! Get buffer offsets and allocation size
 	//! NOTE: TransformTemp must be able to contain at least two
-	//! blocks' worth of data (MDCT+MDST coefficients for analysis).
+	//! blocks' worth of data (MDCT+MDST coefficients for analysis),
+	//! and psychoacoustics needs four blocks (plus one band) for its
+	//! window sums and amplitude buffer; this is padded to keep the
+	//! buffers that follow aligned.
+	int TransformTempSize = (nChan + (nChan < 2)) * BlockSize;
+#if ULC_USE_PSYCHOACOUSTICS
+	int PsychoTempSize = 4*BlockSize + BUFFER_ALIGNMENT/sizeof(float);
+	if(TransformTempSize < PsychoTempSize) TransformTempSize = PsychoTempSize;
+#endif
 	int AllocSize = 0;
 #define CREATE_BUFFER(Name, Sz) int Name##_Offs = AllocSize; AllocSize += Sz
 	CREATE_BUFFER(SampleBuffer,    sizeof(float) * (nChan*BlockSize   ));
+	CREATE_BUFFER(InputBuffer,     sizeof(float) * (nChan*BlockSize   ));
 	CREATE_BUFFER(TransformBuffer, sizeof(float) * (nChan*BlockSize   ));
 #if ULC_USE_NOISE_CODING
-	CREATE_BUFFER(TransformNoise,  sizeof(float) * (nChan*BlockSize   ));
+	CREATE_BUFFER(TransformNoise,  sizeof(float) * (nChan*BlockSize*3 )); //! struct Block_Transform_NoiseSums_t
 #endif
 	CREATE_BUFFER(TransformFwdLap, sizeof(float) * (nChan*BlockSize   ));
-	CREATE_BUFFER(TransformTemp,   sizeof(float) * ((nChan + (nChan < 2)) * BlockSize));
+	CREATE_BUFFER(TransformTemp,   sizeof(float) * (TransformTempSize ));
 	CREATE_BUFFER(TransformIndex,  sizeof(int)   * (nChan*BlockSize   ));
-	CREATE_BUFFER(TransientWindow, sizeof(float) * (      BlockSize/4 ));
+	CREATE_BUFFER(TransientEnergy, sizeof(float) * (ULC_MAX_BLOCK_DECIMATION_FACTOR*2));
 #undef CREATE_BUFFER
 
 	//! Allocate buffer space
@@ -58,20 +111,23 @@ int ULC_EncoderState_Init(struct ULC_EncoderState_t *State) {
 	//! Initialize pointers
 	Buf += (-(uintptr_t)Buf) & (BUFFER_ALIGNMENT-1);
 	State->SampleBuffer    = (float*)(Buf + SampleBuffer_Offs);
+	State->InputBuffer     = (float*)(Buf + InputBuffer_Offs);
 	State->TransformBuffer = (float*)(Buf + TransformBuffer_Offs);
 #if ULC_USE_NOISE_CODING
 	State->TransformNoise  = (float*)(Buf + TransformNoise_Offs);
 #endif
 	State->TransformFwdLap = (float*)(Buf + TransformFwdLap_Offs);
 	State->TransformTemp   = (float*)(Buf + TransformTemp_Offs);
-	State->TransientWindow = (float*)(Buf + TransientWindow_Offs);
+	State->TransientEnergy = (float*)(Buf + TransientEnergy_Offs);
 	State->TransformIndex  = (int  *)(Buf + TransformIndex_Offs);
+	State->Kernels         = ULC_EncoderKernels[Fourier_GetISALevel()];
 
 	//! Set initial state
 	int i;
 	State->NextWindowCtrl = 0x10; //! No decimation, full overlap
+	State->InputPos       = 0;
 	for(i=0;i<2;i++) State->WindowCtrlTaps[i] = 0.0f;
-	for(i=0;i<      BlockSize/4;i++) State->TransientWindow[i] = 0.0f;
+	for(i=0;i<ULC_MAX_BLOCK_DECIMATION_FACTOR*2;i++) State->TransientEnergy[i] = 0.0f;
 	for(i=0;i<nChan*BlockSize  ;i++) State->SampleBuffer   [i] = 0.0f;
 	for(i=0;i<nChan*BlockSize  ;i++) State->TransformFwdLap[i] = 0.0f;
 
@@ -95,11 +151,23 @@ int ULC_EncodeBlock_CBR_Core(struct ULC_EncoderState_t *State, void *DstBuffer,
 	int nOutCoef  = -1;
 	int BitBudget = (int)((State->BlockSize * RateKbps) * 1000.0f/State->RateHz); //! NOTE: Truncate
 
+	//! If every codeable coefficient might fit in the budget (each
+	//! coded coefficient takes at least one nybble), try that first;
+	//! the importance ordering is then never needed.
+	//! NOTE: With no codeable coefficients, nothing is analyzed at all.
+	if(MaxCoef == 0) return State->Kernels->EncodePass(State, DstBuffer, 0);
+	State->Kernels->Analyze(State, ULC_ENCODER_ANALYSIS_NOISE);
+	if(MaxCoef*4 <= BitBudget) {
+		Size = State->Kernels->EncodePass(State, DstBuffer, MaxCoef);
+		if(Size <= BitBudget) return Size;
+	}
+	State->Kernels->Analyze(State, ULC_ENCODER_ANALYSIS_ORDER);
+
 	//! Perform a binary search for the optimal nOutCoef
 	int Lo = 0, Hi = MaxCoef;
 	if(Lo < Hi) do {
 		nOutCoef = (Lo + Hi) / 2u;
-		Size = Block_Encode_EncodePass(State, DstBuffer, nOutCoef);
+		Size = State->Kernels->EncodePass(State, DstBuffer, nOutCoef);
 		     if(Size < BitBudget) Lo = nOutCoef;
 		else if(Size > BitBudget) Hi = nOutCoef-1;
 		else {
@@ -111,12 +179,12 @@ int ULC_EncodeBlock_CBR_Core(struct ULC_EncoderState_t *State, void *DstBuffer,
 
 	//! Avoid going over budget
 	int nOutCoefFinal = Lo;
-	if(nOutCoefFinal != nOutCoef) Size = Block_Encode_EncodePass(State, DstBuffer, nOutCoef = nOutCoefFinal);
+	if(nOutCoefFinal != nOutCoef) Size = State->Kernels->EncodePass(State, DstBuffer, nOutCoef = nOutCoefFinal);
 	return Size;
 }
 const void *ULC_EncodeBlock_CBR(struct ULC_EncoderState_t *State, const float *SrcData, int *Size, float RateKbps) {
 	void *Buf = (void*)State->TransformTemp;
-	int MaxCoef = Block_Transform(State, SrcData);
+	int MaxCoef = State->Kernels->Transform(State, SrcData);
 	int Sz = ULC_EncodeBlock_CBR_Core(State, Buf, RateKbps, MaxCoef);
 	if(Size) *Size = Sz;
 	return Buf;
@@ -129,7 +197,7 @@ const void *ULC_EncodeBlock_ABR(struct ULC_EncoderState_t *State, const float *S
 	//! NOTE: As below in VBR mode, I have no idea what the curve should
 	//! be; this was derived experimentally to closely match VBR output.
 	void *Buf = (void*)State->TransformTemp;
-	int MaxCoef = Block_Transform(State, SrcData);
+	int MaxCoef = State->Kernels->Transform(State, SrcData);
 	float TargetKbps = RateKbps * powf(State->BlockComplexity / AvgComplexity, 1.9f); //! Roughly Log[15]*Sqrt[1/2]
 	int Sz = ULC_EncodeBlock_CBR_Core(State, Buf, TargetKbps, MaxCoef);
 	if(Size) *Size = Sz;
@@ -144,7 +212,7 @@ const void *ULC_EncodeBlock_VBR(struct ULC_EncoderState_t *State, const float *S
 	//! dervied; I have no idea what relation it bears to actual encoding.
 	void *Buf = (void*)State->TransformTemp;
 	float TargetComplexity = 15.0f*logf(100.0f / Quality); //! Or: -15.0*Log[Quality/100], but using Log[x] with x>=1.0 should be more accurate
-	int MaxCoef  = Block_Transform(State, SrcData);
+	int MaxCoef  = State->Kernels->Transform(State, SrcData);
 	int nTargetCoef = MaxCoef; {
 		//! TargetComplexity == 0 which would result in a
 		//! divide-by-zero error. So instead we just leave
@@ -154,11 +222,86 @@ const void *ULC_EncodeBlock_VBR(struct ULC_EncoderState_t *State, const float *S
 			if(fTarget < MaxCoef) nTargetCoef = (int)fTarget;
 		}
 	}
-	int Sz = Block_Encode_EncodePass(State, Buf, nTargetCoef);
+	if(nTargetCoef > 0) {
+		int Stages = ULC_ENCODER_ANALYSIS_NOISE;
+		if(nTargetCoef < MaxCoef) Stages |= ULC_ENCODER_ANALYSIS_ORDER;
+		State->Kernels->Analyze(State, Stages);
+	}
+	int Sz = State->Kernels->EncodePass(State, Buf, nTargetCoef);
 	if(Size) *Size = Sz;
 	return Buf;
 }
 
+/**************************************/
+
+//! Encode the accumulated input block and pass it to the output
+static void Block_EncodeInput(struct ULC_EncoderState_t *State, ULC_EncoderOutputFnc_t OutFnc, void *User) {
+	//! NOTE: Block_Transform() swaps InputBuffer into SampleBuffer
+	//! rather than copying it, so InputBuffer is invalidated here.
+	int Size;
+	const void *Buf;
+	const float *Src = State->InputBuffer;
+	switch(State->StreamMode) {
+		default:
+		case ULC_ENCODER_MODE_CBR: Buf = ULC_EncodeBlock_CBR(State, Src, &Size, State->StreamRate); break;
+		case ULC_ENCODER_MODE_ABR: Buf = ULC_EncodeBlock_ABR(State, Src, &Size, State->StreamRate, State->StreamAvgComplexity); break;
+		case ULC_ENCODER_MODE_VBR: Buf = ULC_EncodeBlock_VBR(State, Src, &Size, State->StreamRate); break;
+	}
+	OutFnc(User, Buf, Size);
+}
+
+//! Write samples
+int ULC_EncoderWrite(struct ULC_EncoderState_t *State, const float *Samples, int nFrames, ULC_EncoderOutputFnc_t OutFnc, void *User) {
+	int n, Chan;
+	int nChan     = State->nChan;
+	int BlockSize = State->BlockSize;
+	int InPos     = State->InputPos;
+	int nBlocks   = 0;
+	while(nFrames) {
+		//! De-interleave into the input buffer
+		int nCopy = BlockSize - InPos;
+		if(nCopy > nFrames) nCopy = nFrames;
+		for(Chan=0;Chan<nChan;Chan++) {
+			float *Dst = State->InputBuffer + Chan*BlockSize + InPos;
+			for(n=0;n<nCopy;n++) Dst[n] = Samples[n*nChan+Chan];
+		}
+		Samples += nCopy*nChan;
+		InPos   += nCopy;
+		nFrames -= nCopy;
+
+		//! Encode once we have a full block
+		if(InPos == BlockSize) {
+			Block_EncodeInput(State, OutFnc, User);
+			InPos = 0;
+			nBlocks++;
+		}
+	}
+	State->InputPos = InPos;
+	return nBlocks;
+}
+
+//! Flush encoder
+int ULC_EncoderFlush(struct ULC_EncoderState_t *State, ULC_EncoderOutputFnc_t OutFnc, void *User) {
+	int n, Chan;
+	int nChan     = State->nChan;
+	int BlockSize = State->BlockSize;
+	int nBlocks   = 0;
+
+	//! Encode the partial block (if any), followed by two blocks
+	//! of silence: one for the coding delay, and one for the MDCT delay
+	int nRem = 2 + (State->InputPos != 0);
+	do {
+		for(Chan=0;Chan<nChan;Chan++) {
+			float *Dst = State->InputBuffer + Chan*BlockSize;
+			for(n=State->InputPos;n<BlockSize;n++) Dst[n] = 0.0f;
+		}
+		Block_EncodeInput(State, OutFnc, User);
+		State->InputPos = 0;
+		nBlocks++;
+	} while(--nRem);
+	return nBlocks;
+}
+
 /**************************************/
 //! EOF
 /**************************************/
@@ -10,6 +10,7 @@
 #include <stdint.h>
 /**************************************/
 #include "Fourier.h"
+#include "ulcEncoder_FastMath.h"
 #include "ulcEncoder_Psycho.h"
 #include "ulcEncoder_WindowControl.h"
 #include "ulcHelper.h"
@@ -82,6 +83,18 @@ static inline void Block_Transform_SortIndices(int *SortedIndices, const float *
 	//! Remap indices based on their sort order
 	for(n=0;n<N;n++) SortedIndices[Order[n]] = n;
 }
+//! Check for digital silence (all samples exactly zero)
+//! NOTE: Checked in chunks of 64 (N must be a multiple of this), so
+//! that each chunk can be vectorized while still exiting early.
+static inline int Block_Transform_IsDigitalSilence(const float *Buf, int N) {
+	int n, k;
+	for(n=0;n<N;n+=64) {
+		int Signal = 0;
+		for(k=0;k<64;k++) Signal |= (Buf[n+k] != 0.0f);
+		if(Signal) return 0;
+	}
+	return 1;
+}
 static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data) {
 	int nChan     = State->nChan;
 	int BlockSize = State->BlockSize;
@@ -91,7 +104,7 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 	int NextWindowCtrl = State->NextWindowCtrl = Block_Transform_GetWindowCtrl(
 		Data,
 		State->SampleBuffer,
-		State->TransientWindow,
+		State->TransientEnergy,
 		State->TransformTemp,
 		State->WindowCtrlTaps,
 		BlockSize,
@@ -103,9 +116,10 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 		if(Pattern&0x8) NextBlockOverlap >>= (NextWindowCtrl&0x7);
 	}
 
-	//! Transform channels and insert keys for each codeable coefficient
+	//! Transform channels and count the codeable coefficients
 	//! It's not /strictly/ required to calculate nNzCoef, but it can
-	//! speed things up in the rate-control step
+	//! speed things up in the rate-control step, and lets us skip the
+	//! importance ordering when every coefficient can be coded
 	int nNzCoef = 0; {
 		int n, Chan;
 		const float *ModulationWindow = State->ModulationWindow;
@@ -113,18 +127,8 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 		float *BufferMDCT    = State->TransformBuffer;
 		float *BufferIndex   = (float*)State->TransformIndex;
 		float *BufferFwdLap  = State->TransformFwdLap;
-#if ULC_USE_NOISE_CODING
-		float *BufferNoise   = State->TransformNoise;
-#endif
 		float *BufferTemp    = State->TransformTemp;
-		float *BufferMDST    = BufferIndex;                       //! NOTE: Aliasing of BufferIndex
-#if ULC_USE_PSYCHOACOUSTICS
-		float *MaskingNp     = BufferIndex + (nChan-1)*BlockSize; //! NOTE: Aliasing of BufferIndex in last channel
-		float *BufferAmp2    = BufferTemp + BlockSize;            //! NOTE: Using upper half of BufferTemp
-
-		//! Clear the amplitude buffer; we'll be accumulating all channels here
-		for(n=0;n<BlockSize;n++) BufferAmp2[n] = 0.0f;
-#endif
+		float *BufferMDST    = BufferIndex;                       //! NOTE: Aliasing of BufferIndex (see Block_Transform_Analyze())
 		//! Apply M/S transform to the data
 		//! NOTE: Fully normalized; not orthogonal.
 		if(nChan == 2) for(n=0;n<BlockSize;n++) {
@@ -134,9 +138,81 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 			BufferSamples[n + BlockSize] = (L-R) * 0.5f;
 		}
 
-		//! Transform the input data and get complexity measure (ABR, VBR modes)
-		float Complexity = 0.0f, ComplexityW = 0.0f;
-		for(Chan=0;Chan<nChan;Chan++) {
+		//! Input from ULC_EncoderWrite() is swapped into the sample
+		//! buffer after transforming, rather than copied
+		int SwapInput = (Data == State->InputBuffer);
+
+		//! If neither the samples nor the lapping data of a channel
+		//! contain any signal, then every coefficient is exactly zero,
+		//! as is the lapping data that would be left for the next block.
+		//! So trailing channels that are silent (such as the S channel
+		//! of dual-mono material) are left out of the transform and
+		//! analysis, and are coded as Stop codes (see EncodePass()).
+		//! If all channels are silent, we just cache the sample data.
+		//! NOTE: Near-silent blocks (all coefficients below the
+		//! codeable range) still need transforming for their lapping
+		//! data, but have no codeable coefficients, and so skip the
+		//! analysis and rate control (see ULC_EncodeBlock_*()).
+		int nActiveChan = nChan;
+		while(
+			nActiveChan > 0 &&
+			Block_Transform_IsDigitalSilence(BufferSamples + (nActiveChan-1)*BlockSize, BlockSize) &&
+			Block_Transform_IsDigitalSilence(BufferFwdLap  + (nActiveChan-1)*BlockSize, BlockSize)
+		) nActiveChan--;
+		State->nActiveChan = nActiveChan;
+		if(nActiveChan == 0) {
+			if(SwapInput) {
+				float *t = State->SampleBuffer;
+				State->SampleBuffer = State->InputBuffer;
+				State->InputBuffer  = t;
+			} else for(n=0;n<nChan*BlockSize;n++) BufferSamples[n] = Data[n];
+			State->BlockComplexity = 0.0f;
+			State->AnalysisStages  = 0;
+			return 0;
+		}
+
+		//! Transform the input data
+		//! All channels share the same subblock pattern, so each
+		//! subblock is transformed for all channels in one batch.
+		{
+			/*!   |            . | .____________|
+			      |            . |/.            |
+			      |            . | .            |
+			      |            . | .            |
+			      |____________./| .            |
+			      |            . | .            |
+			      <-    L    -><-M-><-    R    ->
+			      <-BlockSize/2->|<-BlockSize/2->
+			      <-         BlockSize         ->
+
+			    L_Size = (BlockSize - SubBlockSize)/2
+			    M_Size = SubBlockSize
+			    R_Size = (BlockSize - SubBlockSize)/2
+			    L_Offs = 0
+			    M_Offs = (BlockSize - SubBlockSize)/2
+			    R_Offs = (BlockSize + SubBlockSize)/2
+
+			    The L segment contains all 0s.
+			    The M segment contains our lapping data.
+			    The R segment contains data that we must transform.
+
+			    Each subblock is centred at SubBlockCentre, starting
+			    from the middle of the last block, and BufferFwdLap is
+			    aligned so that its midpoint falls on this centre; so
+			    when using Fourier_MDCT_MDST(), the M segment is the
+			    lapping buffer for this subblock, and its input starts
+			    at the R segment.
+			    Rather than cycling samples through the R segment, we
+			    read the input in place from BufferSamples[], and only
+			    fill the part of the R segment that a larger subblock
+			    (or the next block) will read as lapping data. Samples
+			    from before this block are still found in the lapping
+			    buffer, where the last block left them (at offset
+			    BlockSize + Position), as any lapping data written in
+			    this block always lies behind the samples we read.
+			!*/
+			int SubBlockCentre = -BlockSize/2;
+			int LastSubBlockSize = BlockSize; //! The R segment is complete at the start of a block
 			ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
 			do {
 				//! Get the size of this subblock and the overlap at the next
@@ -154,115 +230,189 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 					if(OverlapSize > SubBlockSize) OverlapSize = SubBlockSize;
 				}
 
-				//! Cycle data through the lapping buffer
-				float *SmpBuf = BufferTemp; {
-					float *SmpDst = SmpBuf;
-
-					/*!   |            . | .____________|
-					      |            . |/.            |
-					      |            . | .            |
-					      |            . | .            |
-					      |____________./| .            |
-					      |            . | .            |
-					      <-    L    -><-M-><-    R    ->
-					      <-BlockSize/2->|<-BlockSize/2->
-					      <-         BlockSize         ->
-
-					    L_Size = (BlockSize - SubBlockSize)/2
-					    M_Size = SubBlockSize
-					    R_Size = (BlockSize - SubBlockSize)/2
-					    L_Offs = 0
-					    M_Offs = (BlockSize - SubBlockSize)/2
-					    R_Offs = (BlockSize + SubBlockSize)/2
-
-					    The L segment contains all 0s.
-					    The M segment contains our lapping data.
-					    The R segment contains data that we must transform.
-
-					    Therefore:
-					    When using Fourier_MDCT_MDST(), we must align BufferFwdLap
-					    with the M segment, and cycle data through the R segment.
-					!*/
-
-					//! Do we have the full [sub]block in the R side of the lapping buffer?
-					int nAvailable = (BlockSize-SubBlockSize)/2;
-					      float *LapDst = BufferFwdLap + (BlockSize+SubBlockSize)/2;
-					const float *LapSrc = LapDst;
-					if(nAvailable < SubBlockSize) {
-						//! Don't have enough samples in lapping buffer
-						//! for the full block - stream new data in and
-						//! refill the lapping buffer
-						for(n=0;n<nAvailable;  n++) *SmpDst++ = *LapSrc++;
-						for(   ;n<SubBlockSize;n++) *SmpDst++ = *BufferSamples++;
-						for(n=0;n<nAvailable;  n++) *LapDst++ = *BufferSamples++;
-					} else {
-						//! We got a full [sub]block, and we might have data
-						//! remaining in the lapping buffer. This data must
-						//! now be shifted down and then the lapping buffer
-						//! refilled with new data
-						for(n=0;n<SubBlockSize;n++) *SmpDst++ = *LapSrc++;
-						for(   ;n<nAvailable;  n++) *LapDst++ = *LapSrc++;
-						for(n=0;n<SubBlockSize;n++) *LapDst++ = *BufferSamples++;
+				//! Get the input samples
+				//! NOTE: Samples from before this block are gathered into
+				//! BufferTemp[BlockSize/2 + Chan*BlockSize], as these
+				//! subblocks are at most BlockSize/2 in size and so don't
+				//! overlap BufferTemp[0..SubBlockSize-1], which the
+				//! transform uses as scratch while reading SmpBuf.
+				int SmpPos = SubBlockCentre + SubBlockSize/2;
+				float *SmpBuf    = (SmpPos < 0) ? (BufferTemp + BlockSize/2) : (BufferSamples + SmpPos);
+				float *BufferLap = BufferFwdLap + (BlockSize-SubBlockSize)/2;
+				for(Chan=0;Chan<nActiveChan;Chan++) {
+					const float *ChanSamples = BufferSamples + Chan*BlockSize;
+					const float *ChanFwdLap  = BufferFwdLap  + Chan*BlockSize;
+
+					//! Extend the lapping data past that of the last subblock
+					//! NOTE: This is outside the overlap, so is just raw samples.
+					float *ChanLap = BufferLap + Chan*BlockSize;
+					for(n=LastSubBlockSize/2;n<SubBlockSize/2;n++) {
+						int Pos = SubBlockCentre + n;
+						ChanLap[SubBlockSize/2 + n] = (Pos < 0) ? ChanFwdLap[BlockSize + Pos] : ChanSamples[Pos];
+					}
+					if(SmpPos < 0) {
+						float *ChanSmp = SmpBuf + Chan*BlockSize;
+						for(n=0;n<SubBlockSize && SmpPos+n < 0;n++) ChanSmp[n] = ChanFwdLap[BlockSize + SmpPos + n];
+						for(   ;n<SubBlockSize;n++)                 ChanSmp[n] = ChanSamples[SmpPos + n];
 					}
 				}
+				SubBlockCentre  += SubBlockSize;
+				LastSubBlockSize = SubBlockSize;
 
 				//! Perform the actual MDCT+MDST
-				Fourier_MDCT_MDST(
-					BufferMDCT,
-					BufferMDST,
-					SmpBuf,
-					BufferFwdLap + (BlockSize-SubBlockSize)/2,
-					BufferTemp,
-					SubBlockSize,
-					OverlapSize,
-					ModulationWindow
-				);
+				if(!State->FastAnalysis) {
+					Fourier_MDCT_MDST_Batch(
+						BufferMDCT,
+						BufferMDST,
+						SmpBuf,
+						BufferLap,
+						BufferTemp,
+						SubBlockSize,
+						OverlapSize,
+						ModulationWindow,
+						nActiveChan,
+						BlockSize,
+						BlockSize
+					);
+				} else {
+					Fourier_MDCT_Batch(
+						BufferMDCT,
+						SmpBuf,
+						BufferLap,
+						BufferTemp,
+						SubBlockSize,
+						OverlapSize,
+						ModulationWindow,
+						nActiveChan,
+						BlockSize,
+						BlockSize
+					);
+
+					//! Estimate the MDST from the MDCT
+					//! For a stationary signal, the MDST at bin k follows
+					//! the slope of the MDCT across its neighbours, so we
+					//! use (X[k+1] - X[k-1]) / Sqrt[2] (the scaling keeps
+					//! the expected power of noise unchanged), with zeros
+					//! past either edge of the spectrum.
+					const float sqrt1_2 = 0x1.6A09E6p-1f;
+					for(Chan=0;Chan<nActiveChan;Chan++) {
+						const float *ChanMDCT = BufferMDCT + Chan*BlockSize;
+						      float *ChanMDST = BufferMDST + Chan*BlockSize;
+						ChanMDST[0] = sqrt1_2 * ChanMDCT[1];
+						for(n=1;n<SubBlockSize-1;n++) {
+							ChanMDST[n] = sqrt1_2 * (ChanMDCT[n+1] - ChanMDCT[n-1]);
+						}
+						ChanMDST[n] = -sqrt1_2 * ChanMDCT[n-1];
+					}
+				}
+
+				//! Move to the next subblock
+				BufferMDCT += SubBlockSize;
+				BufferMDST += SubBlockSize;
+			} while(DecimationPattern);
+			BufferMDCT -= BlockSize; //! Rewind to start of buffer
+			BufferMDST -= BlockSize;
+
+			//! NOTE: Silent channels still cache their sample data, and
+			//! their lapping data stays silent as it was.
+			for(Chan=0;Chan<nChan;Chan++) {
+				//! Complete the R segment for the next block
+				for(n=LastSubBlockSize/2;n<BlockSize/2;n++) {
+					BufferFwdLap[BlockSize/2 + n] = BufferSamples[BlockSize/2 + n];
+				}
+
+				//! Cache the sample data for the next block
+				if(!SwapInput) for(n=0;n<BlockSize;n++) BufferSamples[n] = *Data++;
 
+				//! Move to the next channel
+				BufferSamples += BlockSize;
+				BufferFwdLap  += BlockSize;
+			}
+		}
+		if(SwapInput) {
+			float *t = State->SampleBuffer;
+			State->SampleBuffer = State->InputBuffer;
+			State->InputBuffer  = t;
+		}
+
+		//! Normalize spectra and get complexity measure (ABR, VBR modes)
+		//! Additionally, count the number of codeable coefficients.
+		//! NOTE: The vector paths accumulate the complexity in
+		//! each lane separately, and only sum across lanes at the
+		//! end; this re-associates the sums, but is otherwise the
+		//! same computation.
+		float Complexity = 0.0f, ComplexityW = 0.0f;
+#if defined(__AVX2__)
+		__m256 vComplexity = _mm256_setzero_ps(), vComplexityW = _mm256_setzero_ps();
+#elif defined(__SSE2__)
+		__m128 vComplexity = _mm_setzero_ps(), vComplexityW = _mm_setzero_ps();
+#endif
+		for(Chan=0;Chan<nActiveChan;Chan++) {
+			ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
+			do {
 				//! Normalize spectrum, and accumulate amplitude by
 				//! treating MDCT as Re and MDST as Im (akin to DFT).
 				//! Additionally, accumulate to block complexity
+				int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
 				float Norm = 2.0f / SubBlockSize;
+#if defined(__AVX2__)
+				for(n=0;n<SubBlockSize;n+=8) {
+					__m256 Re = _mm256_mul_ps(_mm256_loadu_ps(BufferMDCT + n), _mm256_set1_ps(Norm));
+					__m256 Im = _mm256_mul_ps(_mm256_loadu_ps(BufferMDST + n), _mm256_set1_ps(Norm));
+					__m256 Abs2 = _mm256_fmadd_ps(Re, Re, _mm256_mul_ps(Im, Im));
+					__m256 Nz   = _mm256_cmp_ps(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), Re), _mm256_set1_ps(0.5f*ULC_COEF_EPS), _CMP_GE_OQ);
+					_mm256_storeu_ps(BufferMDCT + n, Re);
+					_mm256_storeu_ps(BufferMDST + n, Im);
+					vComplexity  = _mm256_add_ps(vComplexity,  Abs2);
+					vComplexityW = _mm256_add_ps(vComplexityW, _mm256_sqrt_ps(Abs2));
+					nNzCoef += __builtin_popcount(_mm256_movemask_ps(Nz));
+				}
+#elif defined(__SSE2__)
+				for(n=0;n<SubBlockSize;n+=4) {
+					__m128 Re = _mm_mul_ps(_mm_loadu_ps(BufferMDCT + n), _mm_set1_ps(Norm));
+					__m128 Im = _mm_mul_ps(_mm_loadu_ps(BufferMDST + n), _mm_set1_ps(Norm));
+					__m128 Abs2 = _mm_add_ps(_mm_mul_ps(Re, Re), _mm_mul_ps(Im, Im));
+					__m128 Nz   = _mm_cmpge_ps(_mm_andnot_ps(_mm_set1_ps(-0.0f), Re), _mm_set1_ps(0.5f*ULC_COEF_EPS));
+					_mm_storeu_ps(BufferMDCT + n, Re);
+					_mm_storeu_ps(BufferMDST + n, Im);
+					vComplexity  = _mm_add_ps(vComplexity,  Abs2);
+					vComplexityW = _mm_add_ps(vComplexityW, _mm_sqrt_ps(Abs2));
+					nNzCoef += __builtin_popcount(_mm_movemask_ps(Nz));
+				}
+#else
 				for(n=0;n<SubBlockSize;n++) {
 					float Re = (BufferMDCT[n] *= Norm);
 					float Im = (BufferMDST[n] *= Norm);
 					float Abs2 = SQR(Re) + SQR(Im);
-#if ULC_USE_NOISE_CODING
-					BufferTemp[n] = Abs2;
-#endif
-#if ULC_USE_PSYCHOACOUSTICS
-					BufferAmp2[n] += Abs2;
-#endif
 					Complexity  += Abs2;
 					ComplexityW += sqrtf(Abs2);
+					nNzCoef += (ABS(Re) >= 0.5f*ULC_COEF_EPS);
 				}
-#if ULC_USE_NOISE_CODING
-				//! Compute noise spectrum
-				//! NOTE: BufferTemp[] (ie. Power[]) is trashed.
-				Block_Transform_CalculateNoiseLogSpectrum(BufferNoise, BufferTemp, SubBlockSize);
 #endif
 				//! Move to the next subblock
 				BufferMDCT  += SubBlockSize;
 				BufferMDST  += SubBlockSize;
-#if ULC_USE_PSYCHOACOUSTICS
-				BufferAmp2  += SubBlockSize;
-#endif
-#if ULC_USE_NOISE_CODING
-				BufferNoise += SubBlockSize;
-#endif
-			} while(DecimationPattern);
-
-			//! Cache the sample data for the next block
-			for(n=0;n<BlockSize;n++) BufferSamples[n-BlockSize] = *Data++;
-
-			//! Move to the next channel
-			BufferFwdLap += BlockSize;
-#if ULC_USE_PSYCHOACOUSTICS
-			BufferAmp2   -= BlockSize; //! <- Accumulated across all channels - rewind
-#endif
+			} while(DecimationPattern >>= 4);
 		}
-		BufferMDCT -= BlockSize*nChan; //! Rewind to start of buffer
-		BufferMDST -= BlockSize*nChan;
-
+		BufferMDCT -= BlockSize*nActiveChan; //! Rewind to start of buffer
+		BufferMDST -= BlockSize*nActiveChan;
+#if defined(__AVX2__) || defined(__SSE2__)
+		{
+# if defined(__AVX2__)
+			float Lanes[2][8];
+			_mm256_storeu_ps(Lanes[0], vComplexity);
+			_mm256_storeu_ps(Lanes[1], vComplexityW);
+# else
+			float Lanes[2][4];
+			_mm_storeu_ps(Lanes[0], vComplexity);
+			_mm_storeu_ps(Lanes[1], vComplexityW);
+# endif
+			for(n=0;n<(int)(sizeof(Lanes[0])/sizeof(float));n++) {
+				Complexity  += Lanes[0][n];
+				ComplexityW += Lanes[1][n];
+			}
+		}
+#endif
 		//! Finalize and store block complexity
 		if(Complexity) {
 			//! Based off the same principles of normalized entropy:
@@ -280,26 +430,139 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 			if(Complexity > 1.0f) Complexity = 1.0f;
 		}
 		State->BlockComplexity = Complexity;
+	}
+
+	//! Further analysis is performed on demand
+	State->AnalysisStages = 0;
+	return nNzCoef;
+}
+
+/**************************************/
+
+//! Perform analysis stages for the transformed block
+//! Stages that were already computed for this block are skipped.
+//! NOTE: The noise analysis reads the MDST, which the importance
+//! ordering overwrites (BufferIndex aliasing). So any noise analysis
+//! must be requested no later than the importance ordering.
+static void Block_Transform_Analyze(struct ULC_EncoderState_t *State, int Stages) {
+	int n, Chan;
+	int nChan      = State->nActiveChan; //! Silent channels are never coded, and so need no analysis
+	int BlockSize  = State->BlockSize;
+	int WindowCtrl = State->WindowCtrl;
+	Stages &= ~State->AnalysisStages;
+	if(!Stages) return;
+	const float *BufferMDCT  = State->TransformBuffer;
+	      float *BufferIndex = (float*)State->TransformIndex;
+	      float *BufferTemp  = State->TransformTemp;
+	const float *BufferMDST  = BufferIndex; //! NOTE: Aliasing of BufferIndex
+
+#if ULC_USE_NOISE_CODING
+	//! Compute noise spectrum of each subblock
+	if(Stages & ULC_ENCODER_ANALYSIS_NOISE) {
+		struct Block_Transform_NoiseSums_t *BufferNoise = (struct Block_Transform_NoiseSums_t*)State->TransformNoise;
+		for(Chan=0;Chan<nChan;Chan++) {
+			ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
+			do {
+				int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
+#if defined(__AVX2__)
+				for(n=0;n<SubBlockSize;n+=8) {
+					__m256 Re = _mm256_loadu_ps(BufferMDCT + n);
+					__m256 Im = _mm256_loadu_ps(BufferMDST + n);
+					_mm256_storeu_ps(BufferTemp + n, _mm256_fmadd_ps(Re, Re, _mm256_mul_ps(Im, Im)));
+				}
+#elif defined(__SSE2__)
+				for(n=0;n<SubBlockSize;n+=4) {
+					__m128 Re = _mm_loadu_ps(BufferMDCT + n);
+					__m128 Im = _mm_loadu_ps(BufferMDST + n);
+					_mm_storeu_ps(BufferTemp + n, _mm_add_ps(_mm_mul_ps(Re, Re), _mm_mul_ps(Im, Im)));
+				}
+#else
+				for(n=0;n<SubBlockSize;n++) BufferTemp[n] = SQR(BufferMDCT[n]) + SQR(BufferMDST[n]);
+#endif
+				//! NOTE: BufferTemp[] (ie. Power[]) is trashed.
+				Block_Transform_CalculateNoiseLogSpectrum(BufferNoise, BufferTemp, SubBlockSize);
+
+				//! Move to the next subblock
+				BufferMDCT  += SubBlockSize;
+				BufferMDST  += SubBlockSize;
+				BufferNoise += SubBlockSize;
+			} while(DecimationPattern >>= 4);
+		}
+		BufferMDCT -= BlockSize*nChan; //! Rewind to start of buffer
+		BufferMDST -= BlockSize*nChan;
+	}
+#endif
+	if(Stages & ULC_ENCODER_ANALYSIS_ORDER) {
 #if ULC_USE_PSYCHOACOUSTICS
 		//! Perform psychoacoustics analysis
-		//! NOTE: Trashes BufferAmp2[] (upper half of BufferTemp used for temporary data).
-		Block_Transform_CalculatePsychoacoustics(MaskingNp, BufferAmp2, (uint32_t*)BufferTemp, BlockSize, WindowCtrl);
+		//! NOTE: Uses BufferTemp[] below BufferAmp2[] for temporary data.
+		float *MaskingNp  = BufferIndex + (nChan-1)*BlockSize; //! NOTE: Aliasing of BufferIndex in last channel
+		float *BufferAmp2 = BufferTemp + 3*BlockSize + 4;      //! NOTE: Using top of BufferTemp (below it is psychoacoustics scratch)
+		for(n=0;n<BlockSize;n++) BufferAmp2[n] = 0.0f;
+		for(Chan=0;Chan<nChan;Chan++) {
+			//! Accumulate the amplitude of all channels
+#if defined(__AVX2__)
+			for(n=0;n<BlockSize;n+=8) {
+				__m256 Re = _mm256_loadu_ps(BufferMDCT + n);
+				__m256 Im = _mm256_loadu_ps(BufferMDST + n);
+				__m256 Abs2 = _mm256_fmadd_ps(Re, Re, _mm256_mul_ps(Im, Im));
+				_mm256_storeu_ps(BufferAmp2 + n, _mm256_add_ps(_mm256_loadu_ps(BufferAmp2 + n), Abs2));
+			}
+#elif defined(__SSE2__)
+			for(n=0;n<BlockSize;n+=4) {
+				__m128 Re = _mm_loadu_ps(BufferMDCT + n);
+				__m128 Im = _mm_loadu_ps(BufferMDST + n);
+				__m128 Abs2 = _mm_add_ps(_mm_mul_ps(Re, Re), _mm_mul_ps(Im, Im));
+				_mm_storeu_ps(BufferAmp2 + n, _mm_add_ps(_mm_loadu_ps(BufferAmp2 + n), Abs2));
+			}
+#else
+			for(n=0;n<BlockSize;n++) BufferAmp2[n] += SQR(BufferMDCT[n]) + SQR(BufferMDST[n]);
+#endif
+			BufferMDCT += BlockSize;
+			BufferMDST += BlockSize;
+		}
+		BufferMDCT -= BlockSize*nChan; //! Rewind to start of buffer
+		BufferMDST -= BlockSize*nChan;
+		Block_Transform_CalculatePsychoacoustics(MaskingNp, BufferAmp2, BufferTemp, BlockSize, WindowCtrl);
 #endif
 		//! Perform importance analysis for all coefficients
 		for(Chan=0;Chan<nChan;Chan++) {
 			//! Analyze each subblock separately
 			ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
 			do {
-				//! Store the sorting (importance) indices of a block's coefficients,
-				//! and update the number of codeable non-zero coefficients.
+				//! Store the sorting (importance) indices of a block's coefficients
+				//! NOTE: The vector paths compute the sort value of every
+				//! coefficient, and then select the unusable ones away.
 				int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
+#if defined(__AVX2__)
+				for(n=0;n<SubBlockSize;n+=8) {
+					__m256 Val   = _mm256_andnot_ps(_mm256_set1_ps(-0.0f), _mm256_loadu_ps(BufferMDCT + n));
+					__m256 Nz    = _mm256_cmp_ps(Val, _mm256_set1_ps(0.5f*ULC_COEF_EPS), _CMP_GE_OQ);
+					__m256 ValNp = _mm256_mul_ps(ULC_FastLog2_x8(Val), _mm256_set1_ps(0x1.62E430p-1f)); //! 0x1.62E430p-1 = Log[2] for change of base
+# if ULC_USE_PSYCHOACOUSTICS
+					ValNp = _mm256_add_ps(ValNp, _mm256_loadu_ps(MaskingNp + n));
+# endif
+					_mm256_storeu_ps(BufferIndex + n, _mm256_blendv_ps(_mm256_set1_ps(-0x1.0p126f), ValNp, Nz));
+				}
+#elif defined(__SSE2__)
+				for(n=0;n<SubBlockSize;n+=4) {
+					__m128 Val   = _mm_andnot_ps(_mm_set1_ps(-0.0f), _mm_loadu_ps(BufferMDCT + n));
+					__m128 Nz    = _mm_cmpge_ps(Val, _mm_set1_ps(0.5f*ULC_COEF_EPS));
+					__m128 ValNp = _mm_mul_ps(ULC_FastLog2_x4(Val), _mm_set1_ps(0x1.62E430p-1f)); //! 0x1.62E430p-1 = Log[2] for change of base
+# if ULC_USE_PSYCHOACOUSTICS
+					ValNp = _mm_add_ps(ValNp, _mm_loadu_ps(MaskingNp + n));
+# endif
+					ValNp = _mm_or_ps(_mm_and_ps(Nz, ValNp), _mm_andnot_ps(Nz, _mm_set1_ps(-0x1.0p126f)));
+					_mm_storeu_ps(BufferIndex + n, ValNp);
+				}
+#else
 				for(n=0;n<SubBlockSize;n++) {
 					//! Coefficient inside codeable range?
 					float Val = ABS(BufferMDCT[n]);
 					if(Val < 0.5f*ULC_COEF_EPS) {
 						BufferIndex[n] = -0x1.0p126f; //! Unusable coefficient; map to the end of the list
 					} else {
-						float ValNp = logf(Val);
+						float ValNp = ULC_FastLog2(Val) * 0x1.62E430p-1f; //! 0x1.62E430p-1 = Log[2] for change of base
 						float MaskedValNp = ValNp;
 #if ULC_USE_PSYCHOACOUSTICS
 						//! Apply psychoacoustic corrections to this band energy
@@ -307,9 +570,9 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 #endif
 						//! Store the sort value for this coefficient
 						BufferIndex[n] = MaskedValNp;
-						nNzCoef++;
 					}
 				}
+#endif
 
 				//! Move to the next subblock
 				BufferMDCT  += SubBlockSize;
@@ -323,15 +586,15 @@ static int Block_Transform(struct ULC_EncoderState_t *State, const float *Data)
 			MaskingNp -= BlockSize;
 #endif
 		}
-	}
 
-	//! Create the coefficient sorting indices
-	{
-		int *BufferTmp = (int*)State->TransformTemp;
-		int *BufferIdx = State->TransformIndex;
-		Block_Transform_SortIndices(BufferIdx, (float*)BufferIdx, BufferTmp, nChan * BlockSize);
+		//! Create the coefficient sorting indices
+		{
+			int *BufferTmp = (int*)State->TransformTemp;
+			int *BufferIdx = State->TransformIndex;
+			Block_Transform_SortIndices(BufferIdx, (float*)BufferIdx, BufferTmp, nChan * BlockSize);
+		}
 	}
-	return nNzCoef;
+	State->AnalysisStages |= Stages;
 }
 
 /**************************************/
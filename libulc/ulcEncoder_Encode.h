@@ -63,6 +63,14 @@ static inline int Block_Encode_BuildQuantizer(float Scale) {
 
 /**************************************/
 
+//! Check if a coefficient is left out of the coded set
+//! When the importance ordering was not computed (because all
+//! codeable coefficients are to be coded), CoefIdx is NULL and
+//! the set is just the coefficients that are codeable.
+ULC_FORCED_INLINE int Block_Encode_EncodePass_IsSkipped(const float *Coef, const int *CoefIdx, int Idx, int nOutCoef) {
+	return CoefIdx ? (CoefIdx[Idx] >= nOutCoef) : (ABS(Coef[Idx]) < 0.5f*ULC_COEF_EPS);
+}
+
 //! Encode a range of coefficients
 static inline int Block_Encode_EncodePass_WriteQuantizerZone(
 	int           CurIdx,
@@ -70,7 +78,7 @@ static inline int Block_Encode_EncodePass_WriteQuantizerZone(
 	float         Quant,
 	const float  *Coef,
 #if ULC_USE_NOISE_CODING
-	const float  *CoefNoise,
+	const struct Block_Transform_NoiseSums_t *CoefNoise,
 #endif
 	const int    *CoefIdx,
 	int           NextCodedIdx,
@@ -158,7 +166,7 @@ static inline int Block_Encode_EncodePass_WriteQuantizerZone(
 		NextCodedIdx++;
 
 		//! Move to the next coefficient
-		do CurIdx++; while(CurIdx < EndIdx && CoefIdx[CurIdx] >= nOutCoef);
+		do CurIdx++; while(CurIdx < EndIdx && Block_Encode_EncodePass_IsSkipped(Coef, CoefIdx, CurIdx, nOutCoef));
 	} while(CurIdx < EndIdx);
 	return NextCodedIdx;
 }
@@ -169,7 +177,7 @@ static inline void Block_Encode_EncodePass_WriteSubBlock(
 	int           SubBlockSize,
 	const float  *Coef,
 #if ULC_USE_NOISE_CODING
-	const float  *CoefNoise,
+	const struct Block_Transform_NoiseSums_t *CoefNoise,
 #endif
 	const int    *CoefIdx,
 	int           nOutCoef,
@@ -185,7 +193,7 @@ static inline void Block_Encode_EncodePass_WriteSubBlock(
 	float QuantWeight   = 0.0f;
 	do {
 		//! Seek the next coefficient
-		while(Idx < EndIdx && CoefIdx[Idx] >= nOutCoef) Idx++;
+		while(Idx < EndIdx && Block_Encode_EncodePass_IsSkipped(Coef, CoefIdx, Idx, nOutCoef)) Idx++;
 
 		//! Read coefficient and set the first quantizer's first coefficient index
 		//! NOTE: Set BandCoef=0.0 upon reaching the end. This causes the range
@@ -250,6 +258,7 @@ static inline void Block_Encode_EncodePass_WriteSubBlock(
 				CoefNoise,
 				NextCodedIdx,
 				n,
+				NextCodedIdx - (EndIdx-SubBlockSize),
 				(float)(1u << PrevQuant),
 				&NoiseQ,
 				&NoiseDecay
@@ -291,9 +300,9 @@ static inline int Block_Encode_EncodePass(const struct ULC_EncoderState_t *State
 	int Chan, nChan = State->nChan;
 	const float *Coef      = State->TransformBuffer;
 #if ULC_USE_NOISE_CODING
-	const float *CoefNoise = State->TransformNoise;
+	const struct Block_Transform_NoiseSums_t *CoefNoise = (const struct Block_Transform_NoiseSums_t*)State->TransformNoise;
 #endif
-	const int   *CoefIdx   = State->TransformIndex;
+	const int   *CoefIdx   = (State->AnalysisStages & ULC_ENCODER_ANALYSIS_ORDER) ? State->TransformIndex : NULL; //! NOTE: nOutCoef must cover all codeable coefficients when NULL
 	BitStream_t *DstBuffer = _DstBuffer;
 
 	//! Begin coding
@@ -307,6 +316,19 @@ static inline int Block_Encode_EncodePass(const struct ULC_EncoderState_t *State
 		ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
 		do {
 			int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
+			if(nOutCoef == 0 || Chan >= State->nActiveChan) {
+				//! Nothing to code: Write the stop code directly
+				//! NOTE: This is what Block_Encode_EncodePass_WriteSubBlock()
+				//! would write, but without reading the coefficients (which
+				//! are stale when the transform was skipped for silence).
+				//! The decoder recognizes channels that are coded this way
+				//! over silent lapping data, and skips their transform.
+				//! Eh,Fh: Stop (no lead sequence, as nothing was coded)
+				Block_Encode_WriteNybble(0xE, &DstBuffer, &Size);
+				Block_Encode_WriteNybble(0xF, &DstBuffer, &Size);
+				Idx += SubBlockSize;
+				continue;
+			}
 			Block_Encode_EncodePass_WriteSubBlock(
 				Idx,
 				SubBlockSize,
@@ -0,0 +1,155 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#pragma once
+/**************************************/
+#include <stdint.h>
+#if defined(__AVX__) || defined(__FMA__)
+# include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+/**************************************/
+#include "ulcHelper.h"
+/**************************************/
+
+//! Fast approximations for the encoder analysis loops
+//! These replace libm calls that would otherwise be made once
+//! per coefficient. Each function has scalar and vector forms
+//! (x4 = SSE2, x8 = AVX2) that evaluate the same approximation,
+//! differing only in FMA contraction.
+//! Measured against double-precision log2()/exp2(), over all
+//! normal inputs (and all of [-125,127] for FastExp2()), the
+//! worst case (without FMA; ie. Scalar and SSE2 builds) is:
+//!  ULC_FastLog2(): Absolute error < 1.6e-7 for |Log2[x]| < 1,
+//!                  relative error < 1.3e-7 elsewhere
+//!  ULC_FastExp2(): Relative error < 9.8e-8
+//! With FMA contraction (AVX2 and above), these tighten to
+//! 1.4e-7, 1.2e-7 and 7.4e-8, respectively. tests/ulcFastMathTest.c
+//! checks the worst-case bounds for the build's own forms.
+//! This is within about 1ulp of libm, which is far below the
+//! resolution of any decision the analysis makes from them.
+//! NOTE: Square roots aren't approximated, as SQRTPS is already
+//! correctly rounded and runs at a throughput comparable to that
+//! of an RSQRTPS+Newton step, which would only add error.
+
+/**************************************/
+
+//! Log2[x]
+//! The input is split as x = m * 2^e, with m in [Sqrt[1/2], Sqrt[2]),
+//! and Log2[m] is evaluated with the atanh series
+//!  Log2[m] = 2/Log[2] * (t + t^3/3 + t^5/5 + t^7/7 + ...), t = (m-1)/(m+1)
+//! truncated at t^7 (as |t| < 0.172, the next term is < 4.2e-8).
+//! NOTE: x must be a positive normal number; zero, subnormals,
+//! infinities and NaN give undefined results (but never trap).
+#define ULC_FASTLOG2_SQRTHALF 0x3F3504F3 //! Bit pattern of Sqrt[1/2]
+#define ULC_FASTLOG2_C1 0x1.715476p1f    //! 2/Log[2]
+#define ULC_FASTLOG2_C3 0x1.EC709Ep-1f   //! 2/Log[2] / 3
+#define ULC_FASTLOG2_C5 0x1.2776C6p-1f   //! 2/Log[2] / 5
+#define ULC_FASTLOG2_C7 0x1.A61762p-2f   //! 2/Log[2] / 7
+ULC_FORCED_INLINE float ULC_FastLog2(float x) {
+	union { float f; uint32_t u; } v = { .f = x };
+	uint32_t u = v.u - ULC_FASTLOG2_SQRTHALF;
+	float e = (float)((int32_t)u >> 23);
+	v.u = (u & 0x007FFFFFu) + ULC_FASTLOG2_SQRTHALF;
+	float t  = (v.f - 1.0f) / (v.f + 1.0f);
+	float t2 = t*t;
+	float p  = ULC_FASTLOG2_C7;
+	p = p*t2 + ULC_FASTLOG2_C5;
+	p = p*t2 + ULC_FASTLOG2_C3;
+	p = p*t2 + ULC_FASTLOG2_C1;
+	return e + t*p;
+}
+#if defined(__SSE2__)
+ULC_FORCED_INLINE __m128 ULC_FastLog2_x4(__m128 x) {
+	__m128i u = _mm_sub_epi32(_mm_castps_si128(x), _mm_set1_epi32(ULC_FASTLOG2_SQRTHALF));
+	__m128  e = _mm_cvtepi32_ps(_mm_srai_epi32(u, 23));
+	__m128  m = _mm_castsi128_ps(_mm_add_epi32(_mm_and_si128(u, _mm_set1_epi32(0x007FFFFF)), _mm_set1_epi32(ULC_FASTLOG2_SQRTHALF)));
+	__m128  t  = _mm_div_ps(_mm_sub_ps(m, _mm_set1_ps(1.0f)), _mm_add_ps(m, _mm_set1_ps(1.0f)));
+	__m128  t2 = _mm_mul_ps(t, t);
+	__m128  p  = _mm_set1_ps(ULC_FASTLOG2_C7);
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(ULC_FASTLOG2_C5));
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(ULC_FASTLOG2_C3));
+	p = _mm_add_ps(_mm_mul_ps(p, t2), _mm_set1_ps(ULC_FASTLOG2_C1));
+	return _mm_add_ps(e, _mm_mul_ps(t, p));
+}
+#endif
+#if defined(__AVX2__)
+ULC_FORCED_INLINE __m256 ULC_FastLog2_x8(__m256 x) {
+	__m256i u = _mm256_sub_epi32(_mm256_castps_si256(x), _mm256_set1_epi32(ULC_FASTLOG2_SQRTHALF));
+	__m256  e = _mm256_cvtepi32_ps(_mm256_srai_epi32(u, 23));
+	__m256  m = _mm256_castsi256_ps(_mm256_add_epi32(_mm256_and_si256(u, _mm256_set1_epi32(0x007FFFFF)), _mm256_set1_epi32(ULC_FASTLOG2_SQRTHALF)));
+	__m256  t  = _mm256_div_ps(_mm256_sub_ps(m, _mm256_set1_ps(1.0f)), _mm256_add_ps(m, _mm256_set1_ps(1.0f)));
+	__m256  t2 = _mm256_mul_ps(t, t);
+	__m256  p  = _mm256_set1_ps(ULC_FASTLOG2_C7);
+	p = _mm256_fmadd_ps(p, t2, _mm256_set1_ps(ULC_FASTLOG2_C5));
+	p = _mm256_fmadd_ps(p, t2, _mm256_set1_ps(ULC_FASTLOG2_C3));
+	p = _mm256_fmadd_ps(p, t2, _mm256_set1_ps(ULC_FASTLOG2_C1));
+	return _mm256_fmadd_ps(t, p, e);
+}
+#endif
+
+/**************************************/
+
+//! 2^x
+//! The input is split as x = i + f, with i = Round[x] and f in
+//! [-1/2, 1/2], and 2^f is evaluated with its Taylor series
+//! truncated at f^7 (the next term is < 5.1e-9). 2^i is then
+//! applied by adding i to the exponent field.
+//! NOTE: x is clamped to [-125, 127], so that the result is
+//! always a normal number.
+#define ULC_FASTEXP2_ROUND 0x1.8p23f //! Adding and subtracting this rounds to integer
+ULC_FORCED_INLINE float ULC_FastExp2(float x) {
+	if(x < -125.0f) x = -125.0f;
+	if(x >  127.0f) x =  127.0f;
+	float i = (x + ULC_FASTEXP2_ROUND) - ULC_FASTEXP2_ROUND;
+	float f = x - i;
+	float p = 0x1.FFCBFCp-17f; //! Log[2]^7 / 7!
+	p = p*f + 0x1.430912p-13f; //! Log[2]^6 / 6!
+	p = p*f + 0x1.5D87FEp-10f; //! Log[2]^5 / 5!
+	p = p*f + 0x1.3B2AB6p-7f;  //! Log[2]^4 / 4!
+	p = p*f + 0x1.C6B08Ep-5f;  //! Log[2]^3 / 3!
+	p = p*f + 0x1.EBFBE0p-3f;  //! Log[2]^2 / 2!
+	p = p*f + 0x1.62E430p-1f;  //! Log[2]
+	p = p*f + 1.0f;
+	union { float f; uint32_t u; } v = { .f = p };
+	v.u += (uint32_t)(int32_t)i << 23;
+	return v.f;
+}
+
+/**************************************/
+
+//! Ceil[x], converted to .32fxp with saturation
+//! NOTE: x must be non-negative. Values >= 2^32 saturate to
+//! 0xFFFFFFFF, matching the scalar code this replaces.
+#if defined(__SSE2__)
+ULC_FORCED_INLINE __m128i ULC_CeilToU32_x4(__m128 x) {
+	//! Conversion is signed, so bias the upper half of the range
+	//! down by 2^31, and restore the top bit afterwards. Values
+	//! in that range are integers, so the ceiling has no effect.
+	__m128  Hi = _mm_cmpge_ps(x, _mm_set1_ps(0x1.0p31f));
+	__m128  Ov = _mm_cmpge_ps(x, _mm_set1_ps(0x1.0p32f));
+	__m128  y  = _mm_sub_ps(x, _mm_and_ps(Hi, _mm_set1_ps(0x1.0p31f)));
+	__m128i i  = _mm_cvttps_epi32(y);
+	i = _mm_sub_epi32(i, _mm_castps_si128(_mm_cmplt_ps(_mm_cvtepi32_ps(i), y))); //! Truncated, so round up
+	i = _mm_or_si128(i, _mm_castps_si128(_mm_and_ps(Hi, _mm_castsi128_ps(_mm_set1_epi32(0x80000000)))));
+	return _mm_or_si128(i, _mm_castps_si128(Ov));
+}
+#endif
+#if defined(__AVX2__)
+ULC_FORCED_INLINE __m256i ULC_CeilToU32_x8(__m256 x) {
+	__m256  Hi = _mm256_cmp_ps(x, _mm256_set1_ps(0x1.0p31f), _CMP_GE_OQ);
+	__m256  Ov = _mm256_cmp_ps(x, _mm256_set1_ps(0x1.0p32f), _CMP_GE_OQ);
+	__m256  y  = _mm256_ceil_ps(_mm256_sub_ps(x, _mm256_and_ps(Hi, _mm256_set1_ps(0x1.0p31f))));
+	__m256i i  = _mm256_cvttps_epi32(y);
+	i = _mm256_or_si256(i, _mm256_and_si256(_mm256_castps_si256(Hi), _mm256_set1_epi32(0x80000000)));
+	return _mm256_or_si256(i, _mm256_castps_si256(Ov));
+}
+#endif
+
+/**************************************/
+//! EOF
+/**************************************/
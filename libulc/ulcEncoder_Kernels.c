@@ -0,0 +1,29 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#include "Fourier.h"
+#include "ulcEncoder.h"
+/**************************************/
+#include "ulcEncoder_BlockTransform.h"
+#include "ulcEncoder_Encode.h"
+/**************************************/
+
+//! Encoder kernels
+//! NOTE: This file is built once per ISA level (like the Fourier
+//! kernels), and the encoder selects one set at initialization.
+//! Transforms called from here resolve to the same ISA level.
+int FOURIER_ISA_NAME(ULC_EncoderKernel_Transform)(struct ULC_EncoderState_t *State, const float *Data) {
+	return Block_Transform(State, Data);
+}
+void FOURIER_ISA_NAME(ULC_EncoderKernel_Analyze)(struct ULC_EncoderState_t *State, int Stages) {
+	Block_Transform_Analyze(State, Stages);
+}
+int FOURIER_ISA_NAME(ULC_EncoderKernel_EncodePass)(const struct ULC_EncoderState_t *State, void *DstBuffer, int nOutCoef) {
+	return Block_Encode_EncodePass(State, DstBuffer, nOutCoef);
+}
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -7,6 +7,7 @@
 /**************************************/
 #include <math.h>
 /**************************************/
+#include "ulcEncoder_FastMath.h"
 #include "ulcHelper.h"
 /**************************************/
 
@@ -21,30 +22,50 @@
 
 /**************************************/
 
-//! Compute noise spectrum (logarithmic output)
-static inline void Block_Transform_CalculateNoiseLogSpectrum(float *LogNoise, float *Power, int N) {
+//! Noise analysis sums for each coefficient
+//! The noise-fill and HF extension fits only ever need sums of the
+//! logarithmic noise spectrum, so rather than storing the spectrum
+//! itself, we store its suffix sums to the end of the subblock:
+//!  Sum   = Sum[LogNoise[n+k]]
+//!  SumW  = Sum[LogNoise[n+k] * w^k]
+//!  SumWX = Sum[LogNoise[n+k] * w^k * k]
+//! (w = 0.99, the weight decay of the HF extension fit), so that any
+//! run of coefficients can then be analyzed in constant time.
+#define ULC_NOISE_WEIGHT_DECAY 0.99f
+struct Block_Transform_NoiseSums_t {
+	float Sum, SumW, SumWX;
+};
+
+//! Compute the smoothed noise spectrum into NoiseSums[].Sum
+static inline void Block_Transform_CalculateNoiseLogSpectrum_Smooth(struct Block_Transform_NoiseSums_t *NoiseSums, float *Power, float LogNorm, int N) {
 	int n;
-	float v;
-
-	//! Find the subblock's normalization factor
-	float LogNorm = 0.0f;
-	for(n=0;n<N;n++) if((v = Power[n]) > LogNorm) LogNorm = v;
-	if(LogNorm == 0.0f) {
-		//! Empty spectrum - fill with -100.0Np data just in case
-		for(n=0;n<N;n++) LogNoise[n] = -100.0f;
-		return;
-	}
 
 	//! Normalize the logarithmic energy and convert to fixed-point
 	//! NOTE: Strictly speaking, we could normalize by 1/LogNorm here.
 	//! However, normalizing to 2^32 should reduce subnormal collapse.
+	//! NOTE: As in psychoacoustics, the fixed-point logarithm is
+	//! Log[v]*0x1.715476p27 == Log2[v]*2^27.
 	LogNorm = 0x1.0p32f / LogNorm;
 	uint32_t *LogPower = (uint32_t*)Power;
+#if defined(__AVX2__)
+	for(n=0;n<N;n+=8) {
+		__m256 x = _mm256_mul_ps(_mm256_loadu_ps(Power + n), _mm256_set1_ps(LogNorm));
+		x = _mm256_and_ps(ULC_FastLog2_x8(x), _mm256_cmp_ps(x, _mm256_set1_ps(1.0f), _CMP_GT_OQ));
+		_mm256_storeu_si256((__m256i*)(LogPower + n), ULC_CeilToU32_x8(_mm256_mul_ps(x, _mm256_set1_ps(0x1.0p27f))));
+	}
+#elif defined(__SSE2__)
+	for(n=0;n<N;n+=4) {
+		__m128 x = _mm_mul_ps(_mm_loadu_ps(Power + n), _mm_set1_ps(LogNorm));
+		x = _mm_and_ps(ULC_FastLog2_x4(x), _mm_cmpgt_ps(x, _mm_set1_ps(1.0f)));
+		_mm_storeu_si128((__m128i*)(LogPower + n), ULC_CeilToU32_x4(_mm_mul_ps(x, _mm_set1_ps(0x1.0p27f))));
+	}
+#else
 	for(n=0;n<N;n++) {
-		v = Power[n] * LogNorm;
-		v = (v > 1.0f) ? ceilf(logf(v) * 0x1.715476p27f) : 0.0f;
+		float v = Power[n] * LogNorm;
+		v = (v > 1.0f) ? ceilf(ULC_FastLog2(v) * 0x1.0p27f) : 0.0f;
 		LogPower[n] = (v >= 0x1.0p32f) ? 0xFFFFFFFFu : (uint32_t)v;
 	}
+#endif
 	LogNorm = -0.5f*logf(LogNorm); //! Scale by 1/2 to convert Power to Amplitude
 
 	//! Thoroughly smooth/flatten out the spectrum for noise analysis.
@@ -79,20 +100,46 @@ static inline void Block_Transform_CalculateNoiseLogSpectrum(float *LogNoise, fl
 		}
 
 		//! Store the geometric mean for this band
-		LogNoise[n] = (Sum / BandLen)*0x1.62E430p-29f + LogNorm; //! 0x1.62E430p-29 = 1/LogScale / 2 (/2 to convert Power to Amplitude)
+		NoiseSums[n].Sum = (Sum / BandLen)*0x1.62E430p-29f + LogNorm; //! 0x1.62E430p-29 = 1/LogScale / 2 (/2 to convert Power to Amplitude)
+	}
+}
+
+//! Compute noise spectrum (logarithmic output, as suffix sums)
+static inline void Block_Transform_CalculateNoiseLogSpectrum(struct Block_Transform_NoiseSums_t *NoiseSums, float *Power, int N) {
+	int n;
+	float v;
+
+	//! Find the subblock's normalization factor
+	float LogNorm = 0.0f;
+	for(n=0;n<N;n++) if((v = Power[n]) > LogNorm) LogNorm = v;
+	if(LogNorm == 0.0f) {
+		//! Empty spectrum - fill with -100.0Np data just in case
+		for(n=0;n<N;n++) NoiseSums[n].Sum = -100.0f;
+	} else Block_Transform_CalculateNoiseLogSpectrum_Smooth(NoiseSums, Power, LogNorm, N);
+
+	//! Accumulate the suffix sums (in place of the spectrum)
+	float Sum = 0.0f, SumW = 0.0f, SumWX = 0.0f;
+	for(n=N-1;n>=0;n--) {
+		v = NoiseSums[n].Sum;
+		SumWX = ULC_NOISE_WEIGHT_DECAY*(SumWX + SumW);
+		SumW  = ULC_NOISE_WEIGHT_DECAY*SumW + v;
+		Sum  += v;
+		NoiseSums[n].Sum   = Sum;
+		NoiseSums[n].SumW  = SumW;
+		NoiseSums[n].SumWX = SumWX;
 	}
 }
 
 /**************************************/
 
 //! Get the quantized noise amplitude for encoding
-static int Block_Encode_EncodePass_GetNoiseQ(const float *LogCoef, int Band, int N, float q) {
+//! NOTE: Noise runs always end before a coded coefficient, so
+//! NoiseSums[Band+N] is always within the same subblock.
+static int Block_Encode_EncodePass_GetNoiseQ(const struct Block_Transform_NoiseSums_t *NoiseSums, int Band, int N, float q) {
 	//! Analyze for the noise amplitude (geometric mean over N coefficients)
 	float Amplitude; {
-		int n;
-		Amplitude = 0.0f;
-		for(n=0;n<N;n++) Amplitude += LogCoef[Band+n];
-		Amplitude = expf(Amplitude/N);
+		Amplitude = NoiseSums[Band].Sum - NoiseSums[Band+N].Sum;
+		Amplitude = ULC_FastExp2(Amplitude/N * 0x1.715476p0f);
 	}
 
 	//! Quantize the noise amplitude into final code
@@ -102,46 +149,51 @@ static int Block_Encode_EncodePass_GetNoiseQ(const float *LogCoef, int Band, int
 }
 
 //! Compute quantized HF extension parameters for encoding
-static void Block_Encode_EncodePass_GetHFExtParams(const float *LogCoef, int Band, int N, float q, int *_NoiseQ, int *_NoiseDecay) {
+//! NOTE: The tail always runs to the end of the subblock, and
+//! nLead is the number of coefficients in the subblock before it.
+static void Block_Encode_EncodePass_GetHFExtParams(const struct Block_Transform_NoiseSums_t *NoiseSums, int Band, int N, int nLead, float q, int *_NoiseQ, int *_NoiseDecay) {
 	//! Solve for least-squares (in the log domain, for exponential fitting)
 	float Amplitude, Decay; {
 		//! NOTE: The analysis is the same as in normal noise-fill,
 		//! but with a decaying weight parameter. This appears to
 		//! be necessary to avoid overfitting to -inf dB, but is
 		//! still not perfect.
-		//! NOTE: We always have at least 16 coefficients before
-		//! Band, so we use these to regularize the fit.
-		int n;
-		float SumX  = 0.0f;
-		float SumX2 = 0.0f;
-		float SumXY = 0.0f;
-		float SumY  = 0.0f;
-		float SumW  = 0.0f;
-		float w = 1.0f;
-		for(n=-16;n<N;n++) {
-			float x = (float)n;
-			float yLog = LogCoef[Band+n];
-			SumX  += w*x;
-			SumX2 += w*x*x;
-			SumXY += w*x*yLog;
-			SumY  += w  *yLog;
-			SumW  += w;
-			w *= 0.99f;
-		}
+		//! NOTE: We use up to 16 coefficients before Band (x < 0)
+		//! to regularize the fit.
+		//! NOTE: The weighted sums of the data are read from the
+		//! suffix sums (see Block_Transform_NoiseSums_t), and the
+		//! sums of the weights (and of x and x^2) over the M terms
+		//! are evaluated in closed form:
+		//!  Sum[w^k]     = (1 - w^M) / (1-w)
+		//!  Sum[w^k k]   = (w - M w^M + (M-1) w^(M+1)) / (1-w)^2
+		//!  Sum[w^k k^2] = (w + w^2 - M^2 w^M + (2M^2-2M-1) w^(M+1) - (M-1)^2 w^(M+2)) / (1-w)^3
+		//! and then shifted to x = k - Lead. This is done in double
+		//! precision, as Sum[w^k k^2] has some heavy cancellation.
+		int    Lead = (nLead < 16) ? nLead : 16;
+		int    M    = N + Lead;
+		double w    = (double)ULC_NOISE_WEIGHT_DECAY, wM = pow(w, M), d = 1.0 - w;
+		double S0   = (1.0 - wM) / d;
+		double S1   = (w - M*wM + (M-1)*wM*w) / (d*d);
+		double S2   = (w + w*w - (double)M*M*wM + (2.0*M*M-2.0*M-1.0)*wM*w - (double)(M-1)*(M-1)*wM*w*w) / (d*d*d);
+		double SumW  = S0;
+		double SumX  = S1 - Lead*S0;
+		double SumX2 = S2 - 2.0*Lead*S1 + (double)Lead*Lead*S0;
+		double SumY  = NoiseSums[Band-Lead].SumW;
+		double SumXY = NoiseSums[Band-Lead].SumWX - Lead*SumY;
 
 		//! Solve for amplitude and decay
-		float Det = SumW*SumX2 - SQR(SumX);
-		if(Det == 0.0f) {
+		double Det = SumW*SumX2 - SQR(SumX);
+		if(Det == 0.0) {
 			//! Play it safe and disable HF extension
 			*_NoiseQ = *_NoiseDecay = 0;
 			return;
 		}
-		Amplitude = (SumX2*SumY  - SumX*SumXY) / Det;
-		Decay     = (SumW *SumXY - SumX*SumY ) / Det;
+		Amplitude = (float)((SumX2*SumY  - SumX*SumXY) / Det);
+		Decay     = (float)((SumW *SumXY - SumX*SumY ) / Det);
 
 		//! Convert to linear units
-		Amplitude = expf(Amplitude);
-		Decay     = expf(Decay);
+		Amplitude = ULC_FastExp2(Amplitude * 0x1.715476p0f); //! 0x1.715476p0 = 1/Log[2] for change of base
+		Decay     = ULC_FastExp2(Decay     * 0x1.715476p0f);
 	}
 
 	//! Quantize amplitude and decay
@@ -9,42 +9,104 @@
 #include <stdint.h>
 /**************************************/
 #include "ulcEncoder.h"
+#include "ulcEncoder_FastMath.h"
 #include "ulcHelper.h"
 /**************************************/
 
-static inline void Block_Transform_CalculatePsychoacoustics(float *MaskingNp, const float *BufferAmp2, uint32_t *BufferTemp, int BlockSize, uint32_t WindowCtrl) {
+//! Masking window sums
+//! NOTE: These are suffix sums (ie. the sums from each bin to the end
+//! of the subblock); see Block_Transform_CalculatePsychoacoustics().
+struct Block_Transform_MaskingSums_t {
+	uint64_t Sum;  //! Sum of Energy*EnergyNp >> SumShift
+	uint64_t SumW; //! Sum of Energy
+};
+
+//! Compute masking levels
+//! NOTE: BufferTemp must hold 4*(BlockSize+1) words, and must not
+//! overlap BufferAmp2[] (which is left intact).
+static inline void Block_Transform_CalculatePsychoacoustics(float *MaskingNp, const float *BufferAmp2, void *BufferTemp, int BlockSize, uint32_t WindowCtrl) {
 	int n;
-	float v;
 
 	//! Compute masking levels for each [sub-]block
-	uint32_t *Energy   = (uint32_t*)(BufferTemp);
-	uint32_t *EnergyNp = (uint32_t*)(BufferTemp + BlockSize);
+	//! NOTE: Energy[] holds {Energy,EnergyNp} pairs, which are then
+	//! expanded in-place into the window sums (see below).
+	uint32_t *Energy = (uint32_t*)BufferTemp;
+	struct Block_Transform_MaskingSums_t *Sums = (struct Block_Transform_MaskingSums_t*)BufferTemp;
 	ULC_SubBlockDecimationPattern_t DecimationPattern = ULC_SubBlockDecimationPattern(WindowCtrl);
 	do {
 		int SubBlockSize = BlockSize >> (DecimationPattern&0x7);
 
 		//! Find the subblock's normalization factor
 		float LogNorm = 0.0f;
-		for(n=0;n<SubBlockSize;n++) if((v = BufferAmp2[n]) > LogNorm) LogNorm = v;
+#if defined(__AVX__)
+		{
+			__m256 Max = _mm256_setzero_ps();
+			for(n=0;n<SubBlockSize;n+=8) Max = _mm256_max_ps(Max, _mm256_loadu_ps(BufferAmp2 + n));
+			__m128 t = _mm_max_ps(_mm256_castps256_ps128(Max), _mm256_extractf128_ps(Max, 1));
+			t = _mm_max_ps(t, _mm_movehl_ps(t, t));
+			t = _mm_max_ss(t, _mm_shuffle_ps(t, t, 0x55));
+			LogNorm = _mm_cvtss_f32(t);
+		}
+#elif defined(__SSE__)
+		{
+			__m128 t = _mm_setzero_ps();
+			for(n=0;n<SubBlockSize;n+=4) t = _mm_max_ps(t, _mm_loadu_ps(BufferAmp2 + n));
+			t = _mm_max_ps(t, _mm_movehl_ps(t, t));
+			t = _mm_max_ss(t, _mm_shuffle_ps(t, t, 0x55));
+			LogNorm = _mm_cvtss_f32(t);
+		}
+#else
+		for(n=0;n<SubBlockSize;n++) {
+			float v = BufferAmp2[n];
+			if(v > LogNorm) LogNorm = v;
+		}
+#endif
 		if(LogNorm != 0.0f) {
 			//! Normalize the energy and convert to fixed-point
 			//! NOTE: We re-scale the logarithm by (2^32)/Log[2^32], which
 			//! we term LogScale (0x1.715476p27).
 			//! NOTE: Because we normalized the coefficients here, we must
-			//! undo the normalization upon storing to EnergyNp[]. This adds
+			//! undo the normalization upon storing to MaskingNp[]. This adds
 			//! a small amount of extra work, but should improve precision.
-			//! Note the scaling; this is to match the scaling of EnergyNp[].
+			//! Note the scaling; this is to match the scaling of EnergyNp.
+			//! NOTE: LogScale*Log[p] == Log2[p]*2^27.
 			LogNorm = 0x1.0p32f / LogNorm;
-				for(n=0;n<SubBlockSize;n++) {
-					float p   = BufferAmp2[n] * LogNorm;
-					float pNp = (p > 1.0f) ? logf(p) : 0.0f;
-					p   = ceilf(sqrtf(p) * 0x1.0p16f); //! Re-normalize to .32fxp
-					pNp = ceilf(pNp*0x1.715476p27f);
-					uint32_t ip   = (p   >= 0x1.0p32f) ? 0xFFFFFFFFu : (uint32_t)p;
-					uint32_t ipNp = (pNp >= 0x1.0p32f) ? 0xFFFFFFFFu : (uint32_t)pNp;
-					Energy  [n] = ip;
-					EnergyNp[n] = ipNp;
-				}
+#if defined(__AVX2__)
+			for(n=0;n<SubBlockSize;n+=8) {
+				__m256 p   = _mm256_mul_ps(_mm256_loadu_ps(BufferAmp2 + n), _mm256_set1_ps(LogNorm));
+				__m256 pNp = _mm256_and_ps(ULC_FastLog2_x8(p), _mm256_cmp_ps(p, _mm256_set1_ps(1.0f), _CMP_GT_OQ));
+				p   = _mm256_mul_ps(_mm256_sqrt_ps(p), _mm256_set1_ps(0x1.0p16f)); //! Re-normalize to .32fxp
+				pNp = _mm256_mul_ps(pNp, _mm256_set1_ps(0x1.0p27f));
+				__m256i e   = ULC_CeilToU32_x8(p);
+				__m256i eNp = ULC_CeilToU32_x8(pNp);
+				__m256i Lo  = _mm256_unpacklo_epi32(e, eNp);
+				__m256i Hi  = _mm256_unpackhi_epi32(e, eNp);
+				_mm256_storeu_si256((__m256i*)(Energy + 2*n+0), _mm256_permute2x128_si256(Lo, Hi, 0x20));
+				_mm256_storeu_si256((__m256i*)(Energy + 2*n+8), _mm256_permute2x128_si256(Lo, Hi, 0x31));
+			}
+#elif defined(__SSE2__)
+			for(n=0;n<SubBlockSize;n+=4) {
+				__m128 p   = _mm_mul_ps(_mm_loadu_ps(BufferAmp2 + n), _mm_set1_ps(LogNorm));
+				__m128 pNp = _mm_and_ps(ULC_FastLog2_x4(p), _mm_cmpgt_ps(p, _mm_set1_ps(1.0f)));
+				p   = _mm_mul_ps(_mm_sqrt_ps(p), _mm_set1_ps(0x1.0p16f)); //! Re-normalize to .32fxp
+				pNp = _mm_mul_ps(pNp, _mm_set1_ps(0x1.0p27f));
+				__m128i e   = ULC_CeilToU32_x4(p);
+				__m128i eNp = ULC_CeilToU32_x4(pNp);
+				_mm_storeu_si128((__m128i*)(Energy + 2*n+0), _mm_unpacklo_epi32(e, eNp));
+				_mm_storeu_si128((__m128i*)(Energy + 2*n+4), _mm_unpackhi_epi32(e, eNp));
+			}
+#else
+			for(n=0;n<SubBlockSize;n++) {
+				float p   = BufferAmp2[n] * LogNorm;
+				float pNp = (p > 1.0f) ? ULC_FastLog2(p) : 0.0f;
+				p   = ceilf(sqrtf(p) * 0x1.0p16f); //! Re-normalize to .32fxp
+				pNp = ceilf(pNp*0x1.0p27f);
+				uint32_t ip   = (p   >= 0x1.0p32f) ? 0xFFFFFFFFu : (uint32_t)p;
+				uint32_t ipNp = (pNp >= 0x1.0p32f) ? 0xFFFFFFFFu : (uint32_t)pNp;
+				Energy[2*n+0] = ip;
+				Energy[2*n+1] = ipNp;
+			}
+#endif
 			LogNorm = logf(LogNorm)*0x1.555555p-2f; //! Log[LogNorm]/3
 
 			//! Compute expected level of each band's critical bandwidth
@@ -59,51 +121,95 @@ static inline void Block_Transform_CalculatePsychoacoustics(float *MaskingNp, co
 			//! Setting SubBlockSize=1 gives us the normalized bandwidth:
 			//!  MaxBandwidth = 1 - LoRangeScale/HiRangeScale
 			int SumShift = 31-__builtin_clz(SubBlockSize) - 2; //! Log2[SubBlockSize * MaxBandwidth]
-			int BandBeg = 0, BandEnd = 0;
-			uint64_t Sum = 0ull, SumW = 0ull;
-			for(n=0;n<SubBlockSize;n++) {
-				//! Re-focus analysis window
-				const int RangeScaleFxp = 3;
-				{
-					int Old, New;
-					const int LoRangeScale = 6; //! Beg = 0.75*Band
-					const int HiRangeScale = 9; //! End = 1.125*Band
-
-					//! Remove samples that went out of focus
-					//! NOTE: We skip /at most/ one sample, so don't loop.
-					Old = BandBeg >> RangeScaleFxp, BandBeg += LoRangeScale;
-					New = BandBeg >> RangeScaleFxp;
-					if(Old < New) {
-						SumW -= Energy[Old];
-						Sum  -= Energy[Old] * (uint64_t)EnergyNp[Old] >> SumShift;
-					}
 
-					//! Add samples that came into focus
-					//! NOTE: We usually skip /at least/ one sample, but when we
-					//! reach the end of the buffer (ie. x=xMax), we stop adding
-					//! samples, so we can't go straight into a do-while loop.
-					Old = BandEnd >> RangeScaleFxp, BandEnd += HiRangeScale;
-					New = BandEnd >> RangeScaleFxp; if(New > SubBlockSize) New = SubBlockSize;
-					if(Old < New) do {
-						SumW += Energy[Old];
-						Sum  += Energy[Old] * (uint64_t)EnergyNp[Old] >> SumShift;
-					} while(++Old < New);
+			//! Accumulate the window sums
+			//! Rather than sliding a window across the bands (which
+			//! makes every band depend on the last), we accumulate
+			//! suffix sums once, so that the sum over any window is
+			//! the difference of the sums at its edges. Summing in
+			//! reverse lets us expand each pair into its sums in-place,
+			//! as Sums[n] never overlaps the pairs that are still unread.
+			//! NOTE: The sums may wrap around, but only their differences
+			//! are used, and these are exact so long as each window's sum
+			//! fits in 64 bits (as was already required by the window).
+			{
+				uint64_t Sum = 0ull, SumW = 0ull;
+				Sums[SubBlockSize].Sum  = 0ull;
+				Sums[SubBlockSize].SumW = 0ull;
+				for(n=SubBlockSize-1;n>=0;n--) {
+					uint32_t e   = Energy[2*n+0];
+					uint32_t eNp = Energy[2*n+1];
+					SumW += e;
+					Sum  += e * (uint64_t)eNp >> SumShift;
+					Sums[n].Sum  = Sum;
+					Sums[n].SumW = SumW;
 				}
+			}
+
+			//! Store the expected value for each band.
+			//! This is essentially a contraharmonic mean in the log domain
+			//! The overall idea is to implement this equation:
+			//!  ImportanceLevel = CoefRe * CoefRe^2 / BandAbs^2
+			//! Since we're working in the log domain, and the values
+			//! are scale-invariant (only used for comparing):
+			//!  LogImportanceLevel = Log[CoefRe^3] - Log[BandAbs^2]
+			//!                     = Log[CoefRe] - Log[BandAbs^2]/3
+			//! NOTE: Ideally, we would shift up as Sum<<SumShift prior
+			//! to dividing, but Sum is already full-width 64bit and
+			//! cannot shift up without a larger integer type.
+			//! NOTE: The window for band n spans [Beg,End), where:
+			//!  Beg = (n+1)*0.75  (LoRangeScale = 6, RangeScaleFxp = 3)
+			//!  End = (n+1)*1.125 (HiRangeScale = 9, RangeScaleFxp = 3)
+			//! with End clipped to the end of the subblock.
+			//! NOTE: Every band is independent, and the quotient is taken
+			//! in double precision; together, this lets the divisions
+			//! be vectorized, rather than serializing on a 64-bit integer
+			//! divide. Both operands convert to double exactly, save for
+			//! Sum (>= 2^53), which is rounded once.
+#if defined(__AVX2__)
+			{
+				const long long *SumsBase = (const long long*)Sums;
+				__m128i Band = _mm_setr_epi32(1, 2, 3, 4); //! n+1
+				for(n=0;n<SubBlockSize;n+=4) {
+					//! Beg = (n+1)*6 >> 3, End = (n+1)*9 >> 3
+					//! NOTE: Indices are doubled, as each Sums[] entry
+					//! holds two 64-bit values.
+					__m128i Beg = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(Band, 2), _mm_slli_epi32(Band, 1)), 3);
+					__m128i End = _mm_srli_epi32(_mm_add_epi32(_mm_slli_epi32(Band, 3), Band), 3);
+					End  = _mm_min_epi32(End, _mm_set1_epi32(SubBlockSize));
+					Beg  = _mm_slli_epi32(Beg, 1);
+					End  = _mm_slli_epi32(End, 1);
+					Band = _mm_add_epi32(Band, _mm_set1_epi32(4));
+					__m256i Sum  = _mm256_sub_epi64(_mm256_i32gather_epi64(SumsBase+0, Beg, 8), _mm256_i32gather_epi64(SumsBase+0, End, 8));
+					__m256i SumW = _mm256_sub_epi64(_mm256_i32gather_epi64(SumsBase+1, Beg, 8), _mm256_i32gather_epi64(SumsBase+1, End, 8));
+
+					//! w = (uint32_t)(SumW >> SumShift), avoiding division by 0
+					__m256i w = _mm256_and_si256(_mm256_srl_epi64(SumW, _mm_cvtsi32_si128(SumShift)), _mm256_set1_epi64x(0xFFFFFFFF));
+					w = _mm256_sub_epi64(w, _mm256_cmpeq_epi64(w, _mm256_setzero_si256()));
 
-				//! Store the expected value for this band.
-				//! This is essentially a contraharmonic mean in the log domain
-				//! The overall idea is to implement this equation:
-				//!  ImportanceLevel = CoefRe * CoefRe^2 / BandAbs^2
-				//! Since we're working in the log domain, and the values
-				//! are scale-invariant (only used for comparing):
-				//!  LogImportanceLevel = Log[CoefRe^3] - Log[BandAbs^2]
-				//!                     = Log[CoefRe] - Log[BandAbs^2]/3
-				//! NOTE: Ideally, we would shift up as Sum<<SumShift prior
-				//! to dividing, but Sum is already full-width 64bit and
-				//! cannot shift up without a larger integer type.
+					//! Convert to double by inserting the 32-bit halves into the
+					//! mantissas of 2^52 (Lo, w) and 2^84 (Hi), and removing these
+					__m256d wd = _mm256_sub_pd(_mm256_castsi256_pd(_mm256_or_si256(w, _mm256_set1_epi64x(0x4330000000000000ll))), _mm256_set1_pd(0x1.0p52));
+					__m256d Hi = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(Sum, 32), _mm256_set1_epi64x(0x4530000000000000ll)));
+					__m256d Lo = _mm256_castsi256_pd(_mm256_blend_epi32(Sum, _mm256_set1_epi64x(0x4330000000000000ll), 0xAA));
+					__m256d Sd = _mm256_add_pd(_mm256_sub_pd(Hi, _mm256_set1_pd(0x1.0p84 + 0x1.0p52)), Lo);
+					__m128  q  = _mm256_cvtpd_ps(_mm256_div_pd(Sd, wd));
+					_mm_storeu_ps(MaskingNp + n, _mm_fmadd_ps(q, _mm_set1_ps(-0x1.D93040p-30f), _mm_set1_ps(LogNorm))); //! 0x1.D93040p-30 = 1/LogScale / 3
+				}
+			}
+#else
+			for(n=0;n<SubBlockSize;n++) {
+				const int RangeScaleFxp = 3;
+				const int LoRangeScale  = 6;
+				const int HiRangeScale  = 9;
+				int Beg = ((n+1)*LoRangeScale) >> RangeScaleFxp;
+				int End = ((n+1)*HiRangeScale) >> RangeScaleFxp; if(End > SubBlockSize) End = SubBlockSize;
+				uint64_t Sum  = Sums[Beg].Sum  - Sums[End].Sum;
+				uint64_t SumW = Sums[Beg].SumW - Sums[End].SumW;
 				uint32_t w = SumW >> SumShift; w += (w == 0); //! Avoid division by 0
-				MaskingNp[n] = (Sum/w)*-0x1.D93040p-30f + LogNorm; //! 0x1.D93040p-30 = 1/LogScale / 3
+				MaskingNp[n] = (float)((double)Sum / w)*-0x1.D93040p-30f + LogNorm; //! 0x1.D93040p-30 = 1/LogScale / 3
 			}
+#endif
 		}
 
 		//! Move to next subblock
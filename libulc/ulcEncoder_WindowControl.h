@@ -6,6 +6,12 @@
 #pragma once
 /**************************************/
 #include <math.h>
+#if defined(__AVX__)
+# include <immintrin.h>
+#endif
+#if defined(__SSE__)
+# include <xmmintrin.h>
+#endif
 /**************************************/
 #include "ulcEncoder.h"
 #include "ulcHelper.h"
@@ -19,7 +25,7 @@
 //! same time, we also need to /make/ the transient sit within a
 //! transition region to take advantage of this, and so we combine
 //! the overlap scaling and window-switching strategies.
-//! NOTE: StepBuffer must be at least BlockSize/2 in size.
+//! NOTE: StepBuffer must be at least BlockSize/4 in size.
 //! NOTE: Bit codes for transient region coding, and their window sizes:
 //!  First nybble:
 //!   0xxx: No decimation. xxx = Overlap scaling
@@ -47,19 +53,24 @@
 struct Block_Transform_GetWindowCtrl_TransientFiltering_Sum_t {
 	float Sum, SumW;
 };
+//! Number of energy segments per block (LL/L/M/R segments of the
+//! largest subblock, each subdivided for the smallest subblock)
+//! NOTE: The first half of the segments cover the last block, and
+//! are cached in TransientEnergy[] rather than being recomputed.
+#define ULC_TRANSIENT_SEGMENTS (4*ULC_MAX_BLOCK_DECIMATION_FACTOR)
+
 static inline void Block_Transform_GetWindowCtrl_TransientFiltering(
 	const float *Data,
 	const float *LastBlockData,
-	      float *TransientWindow,
+	      float *TransientEnergy,
+	      float *SegmentEnergy,
 	      float *StepBuffer,
 	      float *SmoothingTaps,
 	int BlockSize,
 	int nChan
 ) {
 	int n, Chan;
-
-	//! Restore old block's filtered data
-	for(n=0;n<BlockSize/4;n++) StepBuffer[n] = TransientWindow[n];
+	int N = BlockSize/4;
 
 	//! Perform a bandpass filter to isolate the energy that is
 	//! important to transient detection. Generally, LF energy
@@ -77,38 +88,93 @@ static inline void Block_Transform_GetWindowCtrl_TransientFiltering(
 	//! and also reduce jitter a little.
 	//! NOTE: BPFILT() accepts z^-1,1,z^1 for flexibility if we
 	//! ever need to change the filter formula.
-	//! NOTE: The operations have been arranged to minimize
-	//! register usage on platforms where this will matter.
-	for(n=0;n<BlockSize/4;n++) StepBuffer[n+BlockSize/4] = 0.0f;
-	for(Chan=0;Chan<nChan;Chan++) {
+	//! NOTE: The first and last outputs are special cases (the
+	//! first needs the last sample of the last block, and the last
+	//! has no z^1), so these are handled separately. Every other
+	//! output sums the four squared differences D[k] = x[k-1]-x[k+1]
+	//! for k = 4n..4n+3, which are vectorized across outputs by
+	//! transposing the differences of consecutive samples.
+	//! NOTE: All channels are accumulated to each output before
+	//! moving on, in the same order as summing channel by channel.
 #define BPFILT(zM1, z0, z1) ((zM1) - (z1))
-		float *Dst = StepBuffer + BlockSize/4;
+	StepBuffer[0] = StepBuffer[N-1] = 0.0f;
+	for(Chan=0;Chan<nChan;Chan++) {
 		const float *SrcOld = LastBlockData + Chan*BlockSize + BlockSize-1;
 		const float *SrcNew = Data          + Chan*BlockSize;
-		{
-			*Dst += SQR(BPFILT(SrcOld[ 0], SrcNew[0], SrcNew[1]));
-			*Dst += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
-			*Dst += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
-			*Dst += SQR(BPFILT(SrcNew[ 2], SrcNew[3], SrcNew[4]));
-			Dst++, SrcNew += 4;
+		StepBuffer[0] += SQR(BPFILT(SrcOld[ 0], SrcNew[0], SrcNew[1]));
+		StepBuffer[0] += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
+		StepBuffer[0] += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
+		StepBuffer[0] += SQR(BPFILT(SrcNew[ 2], SrcNew[3], SrcNew[4]));
+		SrcNew += 4*(N-1);
+		StepBuffer[N-1] += SQR(BPFILT(SrcNew[-1], SrcNew[0], SrcNew[1]));
+		StepBuffer[N-1] += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
+		StepBuffer[N-1] += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
+		//StepBuffer[N-1] += 0.0f; //! z^1 unavailable
+	}
+	n = 1;
+#if defined(__AVX__)
+	for(;n+8<=N-1;n+=8) {
+		__m256 Acc = _mm256_setzero_ps();
+		for(Chan=0;Chan<nChan;Chan++) {
+			//! Lanes 0..3 hold outputs n..n+3, and lanes 4..7 hold n+4..n+7
+			const float *Src = Data + Chan*BlockSize + 4*n;
+			__m256 D0 = _mm256_sub_ps(_mm256_loadu2_m128(Src+16+ 0-1, Src+ 0-1), _mm256_loadu2_m128(Src+16+ 0+1, Src+ 0+1));
+			__m256 D1 = _mm256_sub_ps(_mm256_loadu2_m128(Src+16+ 4-1, Src+ 4-1), _mm256_loadu2_m128(Src+16+ 4+1, Src+ 4+1));
+			__m256 D2 = _mm256_sub_ps(_mm256_loadu2_m128(Src+16+ 8-1, Src+ 8-1), _mm256_loadu2_m128(Src+16+ 8+1, Src+ 8+1));
+			__m256 D3 = _mm256_sub_ps(_mm256_loadu2_m128(Src+16+12-1, Src+12-1), _mm256_loadu2_m128(Src+16+12+1, Src+12+1));
+			__m256 t0 = _mm256_unpacklo_ps(D0, D1);
+			__m256 t1 = _mm256_unpackhi_ps(D0, D1);
+			__m256 t2 = _mm256_unpacklo_ps(D2, D3);
+			__m256 t3 = _mm256_unpackhi_ps(D2, D3);
+			D0 = _mm256_shuffle_ps(t0, t2, 0x44); //! D[4n+0] = z^-1 - z^1 @ 4n+0
+			D1 = _mm256_shuffle_ps(t0, t2, 0xEE); //! D[4n+1] = z^-1 - z^1 @ 4n+1
+			D2 = _mm256_shuffle_ps(t1, t3, 0x44); //! D[4n+2] = z^-1 - z^1 @ 4n+2
+			D3 = _mm256_shuffle_ps(t1, t3, 0xEE); //! D[4n+3] = z^-1 - z^1 @ 4n+3
+# if defined(__FMA__)
+			Acc = _mm256_fmadd_ps(D0, D0, Acc);
+			Acc = _mm256_fmadd_ps(D2, D2, Acc);
+			Acc = _mm256_fmadd_ps(D1, D1, Acc);
+			Acc = _mm256_fmadd_ps(D3, D3, Acc);
+# else
+			Acc = _mm256_add_ps(Acc, _mm256_mul_ps(D0, D0));
+			Acc = _mm256_add_ps(Acc, _mm256_mul_ps(D2, D2));
+			Acc = _mm256_add_ps(Acc, _mm256_mul_ps(D1, D1));
+			Acc = _mm256_add_ps(Acc, _mm256_mul_ps(D3, D3));
+# endif
 		}
-		for(n=1;n<BlockSize/4-1;n++) {
-			*Dst += SQR(BPFILT(SrcNew[-1], SrcNew[0], SrcNew[1]));
-			*Dst += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
-			*Dst += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
-			*Dst += SQR(BPFILT(SrcNew[ 2], SrcNew[3], SrcNew[4]));
-			Dst++, SrcNew += 4;
+		_mm256_storeu_ps(StepBuffer + n, Acc);
+	}
+#elif defined(__SSE__)
+	for(;n+4<=N-1;n+=4) {
+		__m128 Acc = _mm_setzero_ps();
+		for(Chan=0;Chan<nChan;Chan++) {
+			const float *Src = Data + Chan*BlockSize + 4*n;
+			__m128 D0 = _mm_sub_ps(_mm_loadu_ps(Src+ 0-1), _mm_loadu_ps(Src+ 0+1));
+			__m128 D1 = _mm_sub_ps(_mm_loadu_ps(Src+ 4-1), _mm_loadu_ps(Src+ 4+1));
+			__m128 D2 = _mm_sub_ps(_mm_loadu_ps(Src+ 8-1), _mm_loadu_ps(Src+ 8+1));
+			__m128 D3 = _mm_sub_ps(_mm_loadu_ps(Src+12-1), _mm_loadu_ps(Src+12+1));
+			_MM_TRANSPOSE4_PS(D0, D1, D2, D3);
+			Acc = _mm_add_ps(Acc, _mm_mul_ps(D0, D0));
+			Acc = _mm_add_ps(Acc, _mm_mul_ps(D2, D2));
+			Acc = _mm_add_ps(Acc, _mm_mul_ps(D1, D1));
+			Acc = _mm_add_ps(Acc, _mm_mul_ps(D3, D3));
 		}
-		{
-			*Dst += SQR(BPFILT(SrcNew[-1], SrcNew[0], SrcNew[1]));
-			*Dst += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
-			*Dst += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
-			//*Dst += 0.0f; //! z^1 unavailable
-			Dst++, SrcNew += 4;
+		_mm_storeu_ps(StepBuffer + n, Acc);
+	}
+#endif
+	for(;n<N-1;n++) {
+		float Acc = 0.0f;
+		for(Chan=0;Chan<nChan;Chan++) {
+			const float *SrcNew = Data + Chan*BlockSize + 4*n;
+			Acc += SQR(BPFILT(SrcNew[-1], SrcNew[0], SrcNew[1]));
+			Acc += SQR(BPFILT(SrcNew[ 1], SrcNew[2], SrcNew[3]));
+			Acc += SQR(BPFILT(SrcNew[ 0], SrcNew[1], SrcNew[2]));
+			Acc += SQR(BPFILT(SrcNew[ 2], SrcNew[3], SrcNew[4]));
 		}
-#undef BPFILT
+		StepBuffer[n] = Acc;
 	}
-	StepBuffer[BlockSize/2-1] *= 4/3.0f; //! z^1 @ N=BlockSize/4-1 was unavailable, so use the average
+#undef BPFILT
+	StepBuffer[N-1] *= 4/3.0f; //! z^1 @ N=BlockSize/4-1 was unavailable, so use the average
 
 	//! Apply a lowpass filter to the energy signal, and then
 	//! apply DC removal.
@@ -118,44 +184,127 @@ static inline void Block_Transform_GetWindowCtrl_TransientFiltering(
 	//!  then apply another filter to remove DC content, as this
 	//!  causes biasing of the signal analysis.
 	//! NOTE: It's important to keep the smoothing taps accurate,
-	//! so we save it across blocks and buffer the filtered data.
+	//! so we save it across blocks.
 	//! NOTE: We perform the filtering in a companded domain,
 	//! as this emphasizes the transient structure far better.
 	//! NOTE: Slightly refactored to remove a multiplication.
+	//! NOTE: The output is squared once more here, as the segment
+	//! energies below sum the squared output.
+	//! NOTE: The vector paths evaluate the (recursive) filters as a
+	//! blocked scan: Within a vector, the response to its inputs is
+	//! accumulated in Log2[Lanes] shift-and-add steps, and the taps
+	//! carried in from the last vector are added in with the decay
+	//! raised to the power of each lane's position.
 	{
-		float v, *Buf = StepBuffer + BlockSize/4;
 		float LPTap = SmoothingTaps[0], LPDecay = 240/256.0f, OneMinusLPDecay = 1.0f - LPDecay;
 		float DCTap = SmoothingTaps[1], DCDecay = 252/256.0f, OneMinusDCDecay = 1.0f - DCDecay;
 		float DCGain = OneMinusDCDecay / OneMinusLPDecay;
-		for(n=0;n<BlockSize/4;n++) {
-			v = sqrtf(sqrtf(*Buf));
+#if defined(__AVX2__)
+		//! Decay^k for the scan steps, and Decay^Lane for the carried taps
+		__m256 LPDecay1 = _mm256_set1_ps(LPDecay), LPDecay2 = _mm256_mul_ps(LPDecay1, LPDecay1), LPDecay4 = _mm256_mul_ps(LPDecay2, LPDecay2);
+		__m256 DCDecay1 = _mm256_set1_ps(DCDecay), DCDecay2 = _mm256_mul_ps(DCDecay1, DCDecay1), DCDecay4 = _mm256_mul_ps(DCDecay2, DCDecay2);
+		__m256 LPDecayLane, DCDecayLane; {
+			float LPd[8], DCd[8];
+			LPd[0] = DCd[0] = 1.0f;
+			for(n=1;n<8;n++) LPd[n] = LPd[n-1]*LPDecay, DCd[n] = DCd[n-1]*DCDecay;
+			LPDecayLane = _mm256_loadu_ps(LPd);
+			DCDecayLane = _mm256_loadu_ps(DCd);
+		}
+		__m256 vLPTap = _mm256_set1_ps(LPTap);
+		__m256 vDCTap = _mm256_set1_ps(DCTap);
+		const __m256i Shift1 = _mm256_setr_epi32(0,0,1,2,3,4,5,6);
+		const __m256i Shift2 = _mm256_setr_epi32(0,0,0,1,2,3,4,5);
+		const __m256i Lane7  = _mm256_set1_epi32(7);
+		for(n=0;n<N;n+=8) {
+			__m256 v  = _mm256_sqrt_ps(_mm256_sqrt_ps(_mm256_loadu_ps(StepBuffer + n)));
+			__m256 LP = v;
+			__m256 DC = _mm256_mul_ps(v, _mm256_set1_ps(DCGain));
+			LP = _mm256_add_ps(LP, _mm256_mul_ps(LPDecay1, _mm256_blend_ps(_mm256_permutevar8x32_ps(LP, Shift1), _mm256_setzero_ps(), 0x01)));
+			DC = _mm256_add_ps(DC, _mm256_mul_ps(DCDecay1, _mm256_blend_ps(_mm256_permutevar8x32_ps(DC, Shift1), _mm256_setzero_ps(), 0x01)));
+			LP = _mm256_add_ps(LP, _mm256_mul_ps(LPDecay2, _mm256_blend_ps(_mm256_permutevar8x32_ps(LP, Shift2), _mm256_setzero_ps(), 0x03)));
+			DC = _mm256_add_ps(DC, _mm256_mul_ps(DCDecay2, _mm256_blend_ps(_mm256_permutevar8x32_ps(DC, Shift2), _mm256_setzero_ps(), 0x03)));
+			LP = _mm256_add_ps(LP, _mm256_mul_ps(LPDecay4, _mm256_permute2f128_ps(LP, LP, 0x08)));
+			DC = _mm256_add_ps(DC, _mm256_mul_ps(DCDecay4, _mm256_permute2f128_ps(DC, DC, 0x08)));
+			LP = _mm256_add_ps(LP, _mm256_mul_ps(LPDecayLane, vLPTap));
+			DC = _mm256_add_ps(DC, _mm256_mul_ps(DCDecayLane, vDCTap));
+			v = _mm256_sub_ps(LP, DC);
+			v = _mm256_mul_ps(v, v);
+			_mm256_storeu_ps(StepBuffer + n, _mm256_mul_ps(v, v));
+			vLPTap = _mm256_mul_ps(LPDecay1, _mm256_permutevar8x32_ps(LP, Lane7));
+			vDCTap = _mm256_mul_ps(DCDecay1, _mm256_permutevar8x32_ps(DC, Lane7));
+		}
+		LPTap = _mm256_cvtss_f32(vLPTap);
+		DCTap = _mm256_cvtss_f32(vDCTap);
+#elif defined(__SSE__)
+		__m128 LPDecay1 = _mm_set1_ps(LPDecay), LPDecay2 = _mm_mul_ps(LPDecay1, LPDecay1);
+		__m128 DCDecay1 = _mm_set1_ps(DCDecay), DCDecay2 = _mm_mul_ps(DCDecay1, DCDecay1);
+		__m128 LPDecayLane = _mm_setr_ps(1.0f, LPDecay, LPDecay*LPDecay, LPDecay*LPDecay*LPDecay);
+		__m128 DCDecayLane = _mm_setr_ps(1.0f, DCDecay, DCDecay*DCDecay, DCDecay*DCDecay*DCDecay);
+		__m128 vLPTap = _mm_set1_ps(LPTap);
+		__m128 vDCTap = _mm_set1_ps(DCTap);
+		for(n=0;n<N;n+=4) {
+			__m128 v  = _mm_sqrt_ps(_mm_sqrt_ps(_mm_loadu_ps(StepBuffer + n)));
+			__m128 LP = v;
+			__m128 DC = _mm_mul_ps(v, _mm_set1_ps(DCGain));
+			LP = _mm_add_ps(LP, _mm_mul_ps(LPDecay1, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(LP), 4))));
+			DC = _mm_add_ps(DC, _mm_mul_ps(DCDecay1, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(DC), 4))));
+			LP = _mm_add_ps(LP, _mm_mul_ps(LPDecay2, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(LP), 8))));
+			DC = _mm_add_ps(DC, _mm_mul_ps(DCDecay2, _mm_castsi128_ps(_mm_slli_si128(_mm_castps_si128(DC), 8))));
+			LP = _mm_add_ps(LP, _mm_mul_ps(LPDecayLane, vLPTap));
+			DC = _mm_add_ps(DC, _mm_mul_ps(DCDecayLane, vDCTap));
+			v = _mm_sub_ps(LP, DC);
+			v = _mm_mul_ps(v, v);
+			_mm_storeu_ps(StepBuffer + n, _mm_mul_ps(v, v));
+			vLPTap = _mm_mul_ps(LPDecay1, _mm_shuffle_ps(LP, LP, 0xFF));
+			vDCTap = _mm_mul_ps(DCDecay1, _mm_shuffle_ps(DC, DC, 0xFF));
+		}
+		LPTap = _mm_cvtss_f32(vLPTap);
+		DCTap = _mm_cvtss_f32(vDCTap);
+#else
+		float v;
+		for(n=0;n<N;n++) {
+			v = sqrtf(sqrtf(StepBuffer[n]));
 			LPTap += v;
 			DCTap += v * DCGain;
-			*Buf++ = SQR(LPTap - DCTap);
+			v = SQR(LPTap - DCTap);
+			StepBuffer[n] = SQR(v);
 			LPTap *= LPDecay;
 			DCTap *= DCDecay;
 		}
+#endif
 		SmoothingTaps[0] = LPTap;
 		SmoothingTaps[1] = DCTap;
 	}
 
-	//! Save new block's filtered data
-	for(n=0;n<BlockSize/4;n++) TransientWindow[n] = StepBuffer[BlockSize/4+n];
-
 	//! Accumulate energy segments
-	int AnalysisIntervalMask = BlockSize/(ULC_MAX_BLOCK_DECIMATION_FACTOR*8) - 1; //! Break up into LL/L/M/R (*4), BlockSize*2 / MAX_DECIMATION*N_SEGMENTS
-	float *Dst = StepBuffer, Tmp = 0.0f;
-	for(n=0;n<BlockSize/2;n++) {
-		//! Because everything would be summed up in the search loop
-		//! of Block_Transform_GetWindowCtrl(), we sum as much as we
-		//! can here to reuse as many computations as possible.
-		float v = *StepBuffer++;
-		Tmp += SQR(v);
+	//! Because everything would be summed up in the search loop
+	//! of Block_Transform_GetWindowCtrl(), we sum as much as we
+	//! can here to reuse as many computations as possible.
+	//! NOTE: Segments are at least 4 samples long (BlockSize >= 256).
+	{
+		int SegmentSize = N / (ULC_TRANSIENT_SEGMENTS/2);
+		float *Dst = SegmentEnergy + ULC_TRANSIENT_SEGMENTS/2;
+		for(n=0;n<ULC_TRANSIENT_SEGMENTS/2;n++) {
+			int k;
+			const float *Src = StepBuffer + n*SegmentSize;
+#if defined(__SSE__)
+			__m128 Sum = _mm_loadu_ps(Src);
+			for(k=4;k<SegmentSize;k+=4) Sum = _mm_add_ps(Sum, _mm_loadu_ps(Src + k));
+			Sum = _mm_add_ps(Sum, _mm_movehl_ps(Sum, Sum));
+			Sum = _mm_add_ss(Sum, _mm_shuffle_ps(Sum, Sum, 0x55));
+			Dst[n] = _mm_cvtss_f32(Sum);
+#else
+			float Sum = 0.0f;
+			for(k=0;k<SegmentSize;k++) Sum += Src[k];
+			Dst[n] = Sum;
+#endif
+		}
 
-		//! Wrapping around to next segment?
-		//! This awkward construct is used to avoid overwriting
-		//! the data we're reading in for the summation.
-		if(((n+1) & AnalysisIntervalMask) == 0) *Dst++ = Tmp, Tmp = 0.0f;
+		//! Restore the last block's segments, and save this block's
+		for(n=0;n<ULC_TRANSIENT_SEGMENTS/2;n++) {
+			SegmentEnergy[n] = TransientEnergy[n];
+			TransientEnergy[n] = Dst[n];
+		}
 	}
 }
 static inline float Block_Transform_GetWindowCtrl_Log2DecimationRatio(float Ratio2, int Log2SubBlockSize) {
@@ -168,7 +317,7 @@ static inline float Block_Transform_GetWindowCtrl_Log2DecimationRatio(float Rati
 static inline int Block_Transform_GetWindowCtrl(
 	const float *Data,
 	const float *LastBlockData,
-	      float *TransientWindow,
+	      float *TransientEnergy,
 	      float *StepBuffer,
 	      float *SmoothingTaps,
 	int BlockSize,
@@ -177,15 +326,35 @@ static inline int Block_Transform_GetWindowCtrl(
 	int n;
 
 	//! Perform filtering to obtain pre-echo analysis
-	Block_Transform_GetWindowCtrl_TransientFiltering(Data, LastBlockData, TransientWindow, StepBuffer, SmoothingTaps, BlockSize, nChan);
+	float SegmentEnergy[ULC_TRANSIENT_SEGMENTS];
+	Block_Transform_GetWindowCtrl_TransientFiltering(Data, LastBlockData, TransientEnergy, SegmentEnergy, StepBuffer, SmoothingTaps, BlockSize, nChan);
+
+	//! Sum the segments for each level of the search below
+	//! Level k holds ULC_TRANSIENT_SEGMENTS>>k sums of 2^k segments
+	//! each; since the analysis windows at each level are always
+	//! aligned to their size, every window is a single entry.
+	float LevelEnergy[2*ULC_TRANSIENT_SEGMENTS], *Level[ULC_MAX_BLOCK_DECIMATION_FACTOR]; {
+		int k;
+		float *Dst = LevelEnergy;
+		for(n=0;n<ULC_TRANSIENT_SEGMENTS;n++) Dst[n] = SegmentEnergy[n];
+		for(k=0;(1<<k)<=ULC_MAX_BLOCK_DECIMATION_FACTOR;k++) {
+			int nSum = ULC_TRANSIENT_SEGMENTS >> k;
+			Level[k] = Dst;
+			if(k < 31-__builtin_clz(ULC_MAX_BLOCK_DECIMATION_FACTOR)) {
+				for(n=0;n<nSum/2;n++) Dst[nSum+n] = Dst[2*n] + Dst[2*n+1];
+			}
+			Dst += nSum;
+		}
+	}
 
 	//! Begin binary search for transient segment until it stops
 	//! on the R side, at which point the largest ratio is stored
 	float DecimationRatio;
 	int Decimation  = 0b0001;
 	int AnalysisLen = ULC_MAX_BLOCK_DECIMATION_FACTOR;
+	int AnalysisPos = AnalysisLen; //! MDCT transition region begins -BlockSize/2 samples from the new block (ie. L segment, in LL/L/M/R notation)
 	int Log2SubBlockSize = 31 - __builtin_clz(BlockSize);
-	for(StepBuffer += AnalysisLen;;) { //! MDCT transition region begins -BlockSize/2 samples from the new block (ie. L segment, in LL/L/M/R notation)
+	for(;;) {
 		//! Find the peak ratio within each segment (L/M/R)
 		enum { POS_L, POS_M, POS_R};
 		float Ratio;
@@ -193,16 +362,11 @@ static inline int Block_Transform_GetWindowCtrl(
 			//! Get the energy of each segment (LL/L/M/R)
 			//! NOTE: Do not use FLT_MIN as the bias, as we need
 			//! some room for the ratio to grow into upon division.
-			float LL = 0x1.0p-64f;
-			float L  = 0x1.0p-64f;
-			float M  = 0x1.0p-64f;
-			float R  = 0x1.0p-64f;
-			for(n=0;n<AnalysisLen;n++) {
-				LL += StepBuffer[-1*AnalysisLen + n];
-				L  += StepBuffer[ 0*AnalysisLen + n];
-				M  += StepBuffer[+1*AnalysisLen + n];
-				R  += StepBuffer[+2*AnalysisLen + n];
-			}
+			const float *Energy = Level[__builtin_ctz(AnalysisLen)] + AnalysisPos/AnalysisLen;
+			float LL = 0x1.0p-64f + Energy[-1];
+			float L  = 0x1.0p-64f + Energy[ 0];
+			float M  = 0x1.0p-64f + Energy[+1];
+			float R  = 0x1.0p-64f + Energy[+2];
 
 			//! Get the ratios between the segments
 			float RatioL = L / LL;
@@ -233,7 +397,7 @@ static inline int Block_Transform_GetWindowCtrl(
 				Decimation  = (Decimation<<1) | 0;
 			else
 				Decimation  = (Decimation<<1) | 1,
-				StepBuffer += AnalysisLen;
+				AnalysisPos += AnalysisLen;
 			AnalysisLen /= 2;
 			Log2SubBlockSize--;
 			continue;
@@ -0,0 +1,100 @@
+/**************************************/
+//! ulc-codec: Ultra-Low-Complexity Audio Codec
+//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+//! Refer to the project README file for license terms.
+/**************************************/
+#include <stdint.h>
+/**************************************/
+#include "ulcSync.h"
+/**************************************/
+
+#define SYNC_WORD0 'U'
+#define SYNC_WORD1 'S'
+
+/**************************************/
+
+//! Compute CRC-16
+//! NOTE: Nybble-wise table to keep memory usage low.
+uint16_t ULC_Sync_CRC16(const void *_Data, int nBytes) {
+	static const uint16_t Table[16] = {
+		0x0000, 0x1021, 0x2042, 0x3063, 0x4084, 0x50A5, 0x60C6, 0x70E7,
+		0x8108, 0x9129, 0xA14A, 0xB16B, 0xC18C, 0xD1AD, 0xE1CE, 0xF1EF,
+	};
+	const uint8_t *Data = _Data;
+	uint16_t Crc = 0xFFFF;
+	while(nBytes--) {
+		uint8_t x = *Data++;
+		Crc = (Crc << 4) ^ Table[(Crc >> 12) ^ (x >> 4)];
+		Crc = (Crc << 4) ^ Table[(Crc >> 12) ^ (x & 0xF)];
+	}
+	return Crc;
+}
+
+/**************************************/
+
+//! Write sync frame header
+int ULC_Sync_WriteHeader(void *_Dst, const void *FrameData, const struct ULC_SyncFrame_t *Frame) {
+	uint8_t *Dst = _Dst;
+	uint16_t FrameCRC = ULC_Sync_CRC16(FrameData, Frame->FrameBytes);
+	Dst[0x0] = SYNC_WORD0;
+	Dst[0x1] = SYNC_WORD1;
+	Dst[0x2] = Frame->nBlocks;
+	Dst[0x3] = Frame->FrameBytes;
+	Dst[0x4] = Frame->FrameBytes >> 8;
+	Dst[0x5] = Frame->FrameBytes >> 16;
+	Dst[0x6] = Frame->BlockIndex;
+	Dst[0x7] = Frame->BlockIndex >> 8;
+	Dst[0x8] = Frame->BlockIndex >> 16;
+	Dst[0x9] = Frame->BlockIndex >> 24;
+	Dst[0xA] = FrameCRC;
+	Dst[0xB] = FrameCRC >> 8;
+	uint16_t HeaderCRC = ULC_Sync_CRC16(Dst, 0xC);
+	Dst[0xC] = HeaderCRC;
+	Dst[0xD] = HeaderCRC >> 8;
+	return ULC_SYNC_HEADER_SIZE;
+}
+
+/**************************************/
+
+//! Read sync frame header
+int ULC_Sync_ReadHeader(const void *_Src, int SrcBytes, struct ULC_SyncFrame_t *Frame) {
+	const uint8_t *Src = _Src;
+
+	//! Check sync word and header integrity
+	if(SrcBytes < ULC_SYNC_HEADER_SIZE) return 0;
+	if(Src[0x0] != SYNC_WORD0 || Src[0x1] != SYNC_WORD1) return 0;
+	if(ULC_Sync_CRC16(Src, 0xC) != (Src[0xC] | Src[0xD]<<8)) return 0;
+	if(Src[0x2] == 0) return 0;
+
+	//! Unpack header
+	Frame->nBlocks    = Src[0x2];
+	Frame->FrameBytes = Src[0x3] | Src[0x4]<<8 | Src[0x5]<<16;
+	Frame->BlockIndex = Src[0x6] | Src[0x7]<<8 | Src[0x8]<<16 | (uint32_t)Src[0x9]<<24;
+
+	//! Check frame integrity if we have all of the data
+	if(SrcBytes - ULC_SYNC_HEADER_SIZE >= Frame->FrameBytes) {
+		uint16_t FrameCRC = Src[0xA] | Src[0xB]<<8;
+		if(ULC_Sync_CRC16(Src + ULC_SYNC_HEADER_SIZE, Frame->FrameBytes) != FrameCRC) return -1;
+	}
+	return 1;
+}
+
+/**************************************/
+
+//! Search for the next sync frame header
+int ULC_Sync_Find(const void *_Src, int SrcBytes) {
+	const uint8_t *Src = _Src;
+	struct ULC_SyncFrame_t Frame;
+
+	//! Only check the header here; the frame data might not
+	//! be available yet, so the caller must verify it
+	int Offs;
+	for(Offs=0;Offs<=SrcBytes-ULC_SYNC_HEADER_SIZE;Offs++) {
+		if(Src[Offs] == SYNC_WORD0 && ULC_Sync_ReadHeader(Src + Offs, ULC_SYNC_HEADER_SIZE, &Frame) > 0) return Offs;
+	}
+	return -1;
+}
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -0,0 +1,199 @@
+/**************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+/**************************************/
+#include "ulcDecoder.h"
+#include "ulcEncoder.h"
+/**************************************/
+#define BUFFER_ALIGNMENT 64u
+/**************************************/
+
+//! Test stream parameters
+#define TEST_RATE_HZ    44100
+#define TEST_RATE_KBPS  128.0f
+#define TEST_BLOCKSIZE  2048
+#define TEST_NBLOCKS    24
+#define TEST_DAMAGED    9    //! Index of the damaged block
+
+//! A block whose first subblock starts with an unallocated quantizer
+//! escape (WindowCtrl = 0h, Quantizer = Eh,Dh), which the decoder
+//! always rejects as malformed
+static const uint8_t DamagedBlock[] = {0xE0, 0xDD};
+
+/**************************************/
+
+//! Encoded stream
+//! Blocks are stored byte-aligned, with Offs[n] the offset of block n
+struct Stream_t {
+	uint8_t *Data;
+	int      Size;
+	int      Capacity;
+	int      nBlocks;
+	int      Offs[TEST_NBLOCKS+3+1];
+	int      Pos; //! Read position (advanced by nConsumed)
+};
+
+static void StreamOutput(void *User, const void *Data, int Size) {
+	struct Stream_t *Stream = User;
+	Size = (Size + 7) / 8u;
+	if(Stream->Size + Size > Stream->Capacity) {
+		int NewCap = Stream->Capacity ? 2*Stream->Capacity : 64*1024;
+		while(NewCap < Stream->Size + Size) NewCap *= 2;
+		Stream->Data     = realloc(Stream->Data, NewCap);
+		Stream->Capacity = NewCap;
+		if(!Stream->Data) abort();
+	}
+	if(Stream->nBlocks == TEST_NBLOCKS+3) abort();
+	Stream->Offs[Stream->nBlocks++] = Stream->Size;
+	memcpy(Stream->Data + Stream->Size, Data, Size);
+	Stream->Size += Size;
+	Stream->Offs[Stream->nBlocks] = Stream->Size;
+}
+
+static const void *StreamSource(void *User, int nConsumed, int *SrcBytes) {
+	struct Stream_t *Stream = User;
+	Stream->Pos += nConsumed;
+	*SrcBytes = Stream->Size - Stream->Pos;
+	return Stream->Data + Stream->Pos;
+}
+
+/**************************************/
+
+//! Encode a test signal (a few tones over a noise floor)
+static int EncodeStream(struct Stream_t *Stream, int nChan) {
+	int n, Chan;
+	struct ULC_EncoderState_t Encoder = {
+		.RateHz     = TEST_RATE_HZ,
+		.nChan      = nChan,
+		.BlockSize  = TEST_BLOCKSIZE,
+		.ModulationWindow = NULL,
+		.StreamMode = ULC_ENCODER_MODE_CBR,
+		.StreamRate = TEST_RATE_KBPS,
+	};
+	if(ULC_EncoderState_Init(&Encoder) < 0) return 0;
+
+	int nFrames = TEST_NBLOCKS*TEST_BLOCKSIZE;
+	float *Samples = malloc(sizeof(float) * nChan*nFrames);
+	if(!Samples) {
+		ULC_EncoderState_Destroy(&Encoder);
+		return 0;
+	}
+	uint32_t Seed = 1;
+	for(n=0;n<nFrames;n++) for(Chan=0;Chan<nChan;Chan++) {
+		Seed ^= Seed << 13;
+		Seed ^= Seed >> 17;
+		Seed ^= Seed <<  5;
+		float t = n * (1.0f / TEST_RATE_HZ);
+		Samples[n*nChan+Chan] =
+			0.25f  * sinf(6.2831853f * (440.0f + 110.0f*Chan) * t) +
+			0.125f * sinf(6.2831853f * 3520.0f * t) +
+			0.01f  * ((int32_t)Seed * 0x1.0p-31f);
+	}
+	memset(Stream, 0, sizeof(*Stream));
+	ULC_EncoderWrite(&Encoder, Samples, nFrames, StreamOutput, Stream);
+	ULC_EncoderFlush(&Encoder, StreamOutput, Stream);
+	ULC_EncoderState_Destroy(&Encoder);
+	free(Samples);
+	return Stream->Data != NULL;
+}
+
+/**************************************/
+
+//! Read the whole stream through ULC_DecoderRead() in uneven chunks
+//! Returns the number of frames read before stopping.
+static int ReadStream(struct ULC_DecoderState_t *Decoder, struct Stream_t *Stream, ULC_DecoderSample_t *Dst) {
+	//! Whole, aligned blocks take the direct-output path on mono streams
+	static const int Chunks[] = {TEST_BLOCKSIZE, 1000, 3*TEST_BLOCKSIZE, 1, 5000};
+	int n, nRead = 0;
+	for(n=0;;n++) {
+		int nWant = Chunks[n % (sizeof(Chunks)/sizeof(Chunks[0]))];
+		int nGot  = ULC_DecoderRead(Decoder, Dst + nRead*Decoder->nChan, nWant, StreamSource, Stream);
+		nRead += nGot;
+		if(nGot < nWant) break;
+	}
+	return nRead;
+}
+
+//! Run tests for a given number of channels
+//! Returns the number of failures.
+static int RunTests(int nChan) {
+	int nFail = 0;
+#define CHECK(Cond) do { if(!(Cond)) { printf("FAIL (nChan=%d): %s\n", nChan, #Cond); nFail++; } } while(0)
+
+	//! Encode stream and create decoder
+	struct Stream_t Stream;
+	if(!EncodeStream(&Stream, nChan)) {
+		printf("FAIL (nChan=%d): Unable to encode test stream\n", nChan);
+		return 1;
+	}
+	int nBlocks = Stream.nBlocks;
+	struct ULC_DecoderState_t Decoder = {
+		.nChan     = nChan,
+		.BlockSize = TEST_BLOCKSIZE,
+		.ModulationWindow = NULL,
+	};
+	char *_Dst = malloc(sizeof(ULC_DecoderSample_t) * nChan*nBlocks*TEST_BLOCKSIZE + BUFFER_ALIGNMENT-1);
+	if(!_Dst || ULC_DecoderState_Init(&Decoder) < 0) {
+		printf("FAIL (nChan=%d): Unable to create decoder\n", nChan);
+		free(_Dst);
+		free(Stream.Data);
+		return 1;
+	}
+	ULC_DecoderSample_t *Dst = (ULC_DecoderSample_t*)(_Dst + (-(uintptr_t)_Dst % BUFFER_ALIGNMENT));
+	int nRead;
+
+	//! Undamaged stream: Every block is read, and ends without error
+	nRead = ReadStream(&Decoder, &Stream, Dst);
+	CHECK(nRead == nBlocks*TEST_BLOCKSIZE);
+	CHECK(Decoder.StreamError == 0);
+	CHECK(Stream.Pos == Stream.Size);
+
+	//! Damaged stream: Reading stops before the damaged block, which
+	//! is left unconsumed (and is refused again if not skipped)
+	ULC_DecoderState_Reset(&Decoder);
+	Stream.Pos = 0;
+	memcpy(Stream.Data + Stream.Offs[TEST_DAMAGED], DamagedBlock, sizeof(DamagedBlock));
+	nRead = ReadStream(&Decoder, &Stream, Dst);
+	CHECK(nRead == TEST_DAMAGED*TEST_BLOCKSIZE);
+	CHECK(Decoder.StreamError == 1);
+	CHECK(Stream.Pos == Stream.Offs[TEST_DAMAGED]);
+	CHECK(ULC_DecoderRead(&Decoder, Dst, 1, StreamSource, &Stream) == 0);
+	CHECK(Decoder.StreamError == 1);
+	CHECK(Stream.Pos == Stream.Offs[TEST_DAMAGED]);
+
+	//! Skipping the damaged block resumes decoding with a cleared
+	//! lapping buffer, through to the end of the stream
+	Stream.Pos = Stream.Offs[TEST_DAMAGED+1];
+	nRead = ReadStream(&Decoder, &Stream, Dst);
+	CHECK(nRead == (nBlocks-TEST_DAMAGED-1)*TEST_BLOCKSIZE);
+	CHECK(Decoder.StreamError == 0);
+	CHECK(Stream.Pos == Stream.Size);
+	{
+		int n;
+		for(n=0;n<nChan*nRead;n++) if(!(fabs((double)Dst[n]) < 0x1.0p32)) break;
+		CHECK(n == nChan*nRead);
+	}
+
+	//! Clean up
+	ULC_DecoderState_Destroy(&Decoder);
+	free(_Dst);
+	free(Stream.Data);
+#undef CHECK
+	return nFail;
+}
+
+/**************************************/
+
+int main(void) {
+	int nFail = RunTests(1) + RunTests(2);
+	printf("ulcDecoderReadTest: %s\n", nFail ? "FAILED" : "OK");
+	return nFail ? 1 : 0;
+}
+
+/**************************************/
+//! EOF
+/**************************************/
@@ -0,0 +1,117 @@
+/**************************************/
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+/**************************************/
+#include "../libulc/ulcEncoder_FastMath.h"
+/**************************************/
+
+//! Documented error bounds (see ulcEncoder_FastMath.h)
+#define FASTLOG2_MAX_ABSERR 1.6e-7 //! For |Log2[x]| < 1
+#define FASTLOG2_MAX_RELERR 1.3e-7 //! Elsewhere
+#define FASTEXP2_MAX_RELERR 9.8e-8
+
+/**************************************/
+
+//! Error accumulator for one form of a function
+struct Error_t {
+	const char *Name;
+	double MaxAbs, MaxRel;
+	float  MaxAbsArg, MaxRelArg;
+};
+
+//! Log2[x] is checked against Log2[m] + e (x = m * 2^e), with
+//! Log2[m] taken from libm in double precision for each mantissa.
+//! The reduction matches that of ULC_FastLog2() (see there).
+static double *Log2Mantissa;
+static double RefLog2(float x) {
+	union { float f; uint32_t u; } v = { .f = x };
+	uint32_t u = v.u - ULC_FASTLOG2_SQRTHALF;
+	return ((int32_t)u >> 23) + Log2Mantissa[u & 0x007FFFFFu];
+}
+static void ErrorLog2(struct Error_t *Err, float x, float y) {
+	double Ref = RefLog2(x);
+	double d   = fabs(y - Ref);
+	if(fabs(Ref) < 1.0) {
+		if(d > Err->MaxAbs) Err->MaxAbs = d, Err->MaxAbsArg = x;
+	} else {
+		d /= fabs(Ref);
+		if(d > Err->MaxRel) Err->MaxRel = d, Err->MaxRelArg = x;
+	}
+}
+
+static void ErrorExp2(struct Error_t *Err, float x, float y) {
+	double Ref = exp2((double)x);
+	double d   = fabs(y - Ref) / Ref;
+	if(d > Err->MaxRel) Err->MaxRel = d, Err->MaxRelArg = x;
+}
+
+/**************************************/
+
+int main(void) {
+	int nFail = 0;
+	uint32_t u;
+	union { float f; uint32_t u; } v;
+
+	//! Build Log2[m] table for m in [Sqrt[1/2], Sqrt[2])
+	Log2Mantissa = malloc(sizeof(double) * 0x00800000u);
+	if(!Log2Mantissa) {
+		printf("ulcFastMathTest: Out of memory\n");
+		return 1;
+	}
+	for(u=0;u<0x00800000u;u++) {
+		v.u = u + ULC_FASTLOG2_SQRTHALF;
+		Log2Mantissa[u] = log2((double)v.f);
+	}
+
+	//! ULC_FastLog2(): All positive normal numbers
+	struct Error_t Log2   = { .Name = "ULC_FastLog2"    };
+	struct Error_t Log2x4 = { .Name = "ULC_FastLog2_x4" };
+	for(u=0x00800000u;u<0x7F800000u;u+=4) {
+		int n;
+		float x[4], y[4];
+		for(n=0;n<4;n++) v.u = u+n, x[n] = v.f;
+		for(n=0;n<4;n++) ErrorLog2(&Log2, x[n], ULC_FastLog2(x[n]));
+#if defined(__SSE2__)
+		_mm_storeu_ps(y, ULC_FastLog2_x4(_mm_loadu_ps(x)));
+		for(n=0;n<4;n++) ErrorLog2(&Log2x4, x[n], y[n]);
+#else
+		(void)y;
+#endif
+	}
+	free(Log2Mantissa);
+
+	//! ULC_FastExp2(): x = i + f is split exactly, and 2^i is applied
+	//! exactly, so the relative error only depends on f in [-1/2,1/2];
+	//! check all such f with |f| >= 2^-30 (below this, 2^f rounds to
+	//! 1.0 with an error < 1e-9, which the polynomial also returns).
+	struct Error_t Exp2 = { .Name = "ULC_FastExp2" };
+	for(u=0x30800000u;u<=0x3F000000u;u++) {
+		v.u = u;
+		ErrorExp2(&Exp2, v.f, ULC_FastExp2(v.f));
+		v.u = u | 0x80000000u;
+		ErrorExp2(&Exp2, v.f, ULC_FastExp2(v.f));
+	}
+
+	//! Check against the documented bounds
+#define CHECK(Err, Val, Bound) do { \
+		int Fail = !((Err).Val <= (Bound)); \
+		printf("%s %-15s %s error %.3e (at %a; bound %.1e)\n", Fail ? "FAIL:" : "     ", (Err).Name, #Val + 3, (Err).Val, (Err).Val##Arg, Bound); \
+		nFail += Fail; \
+	} while(0)
+	CHECK(Log2, MaxAbs, FASTLOG2_MAX_ABSERR);
+	CHECK(Log2, MaxRel, FASTLOG2_MAX_RELERR);
+#if defined(__SSE2__)
+	CHECK(Log2x4, MaxAbs, FASTLOG2_MAX_ABSERR);
+	CHECK(Log2x4, MaxRel, FASTLOG2_MAX_RELERR);
+#endif
+	CHECK(Exp2, MaxRel, FASTEXP2_MAX_RELERR);
+#undef CHECK
+	printf("ulcFastMathTest: %s\n", nFail ? "FAILED" : "OK");
+	return nFail ? 1 : 0;
+}
+
+/**************************************/
+//! EOF
+/**************************************/
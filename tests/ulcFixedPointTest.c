@@ -0,0 +1,187 @@
+/**************************************/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+/**************************************/
+#include "Fourier.h"
+#include "ulcDecoder.h"
+/**************************************/
+#define BUFFER_ALIGNMENT 64u
+/**************************************/
+
+//! Only meaningful for fixed-point decoders (make FIXED_POINT=1),
+//! whose output is checked against the floating-point IMDCT of the
+//! same coefficients, using the error bounds given in ulcDecoder.h
+#if ULC_USE_FIXED_POINT
+
+//! Documented error bounds (relative to full scale)
+#if FOURIER_SINTABLE_FIXED_BITS == 16
+# define TEST_MAX_PEAKERR 0x1.0p-13
+# define TEST_MAX_RMSERR  0x1.6A09E6p-16 //! 2^-15.5
+#else
+# define TEST_MAX_PEAKERR 0x1.0p-18
+# define TEST_MAX_RMSERR  0x1.0p-21
+#endif
+
+//! Test stream parameters
+#define TEST_NBLOCKS 12
+
+/**************************************/
+
+//! Random numbers (xorshift)
+static uint32_t Rand(void) {
+	static uint32_t Seed = 1;
+	Seed ^= Seed << 13;
+	Seed ^= Seed >> 17;
+	Seed ^= Seed <<  5;
+	return Seed;
+}
+
+//! Nybble writer
+//! Nybbles are stored low first, as read by the decoder.
+struct Writer_t {
+	uint8_t *Data;
+	int      nNybbles;
+};
+static void WriteNybble(struct Writer_t *Writer, int x) {
+	if(Writer->nNybbles%2u == 0) Writer->Data[Writer->nNybbles/2] = x;
+	else                         Writer->Data[Writer->nNybbles/2] |= x << 4;
+	Writer->nNybbles++;
+}
+static void WriteQuantizer(struct Writer_t *Writer, int qi) {
+	if(qi < 0xE) WriteNybble(Writer, qi);
+	else WriteNybble(Writer, 0xE), WriteNybble(Writer, qi - 0xE);
+}
+
+/**************************************/
+
+//! Build a mono block holding a single long subblock
+//! The quantizer falls from qi towards the top of the spectrum
+//! (down to the smallest quantizer, qi = 26), with runs of zeros
+//! in between. The coefficients are stored to Coef[] as floats,
+//! which hold them exactly.
+static void BuildBlock(uint8_t *Dst, float *Coef, int N, int qi) {
+	int n, v;
+	struct Writer_t Writer = {.Data = Dst, .nNybbles = 0};
+
+	//! Window control (a single long subblock), initial quantizer
+	WriteNybble(&Writer, 0x0);
+	WriteQuantizer(&Writer, qi);
+	for(n=0;n<N;) {
+		//! Quantizer change every 1/16th of the block
+		if(n && n%(N/16) == 0) {
+			qi += Rand() % 3;
+			if(qi > 0xE + 0xC) qi = 0xE + 0xC;
+			WriteNybble(&Writer, 0x8);
+			WriteNybble(&Writer, 0x0);
+			WriteQuantizer(&Writer, qi);
+		}
+
+		//! 8h,1h..Fh: Zeros fill (1 .. 15 coefficients)
+		if(Rand() % 4u == 0) {
+			v = 1 + Rand() % 15u;
+			if(v > N/16 - n%(N/16)) v = N/16 - n%(N/16);
+			WriteNybble(&Writer, 0x8);
+			WriteNybble(&Writer, v);
+			while(v--) Coef[n++] = 0.0f;
+			continue;
+		}
+
+		//! -7h..-1h, +1..+7h: Normal
+		do v = (int)(Rand() % 15u) - 7; while(v == 0);
+		WriteNybble(&Writer, v & 0xF);
+		Coef[n++] = ((v < 0) ? (-v*v) : (+v*v)) * ldexpf(1.0f, -5-qi);
+	}
+}
+
+/**************************************/
+
+//! Run tests for a given block size
+//! Returns the number of failures.
+static int RunTests(int BlockSize) {
+	int n, Block, nFail = 0;
+
+	//! Create decoder and buffers
+	struct ULC_DecoderState_t Decoder = {
+		.nChan     = 1,
+		.BlockSize = BlockSize,
+		.ModulationWindow = NULL,
+	};
+	const struct Fourier_Kernels_t *Kernels = Fourier_GetKernels();
+	uint8_t *Src  = malloc(BlockSize + 64);
+	char    *_Buf = malloc(sizeof(ULC_DecoderSample_t)*BlockSize + sizeof(float)*(BlockSize*3 + BlockSize/2) + BUFFER_ALIGNMENT-1);
+	if(!Src || !_Buf || ULC_DecoderState_Init(&Decoder) < 0) {
+		printf("FAIL (BlockSize=%d): Unable to create decoder\n", BlockSize);
+		free(Src);
+		free(_Buf);
+		return 1;
+	}
+	char *Buf = _Buf + (-(uintptr_t)_Buf % BUFFER_ALIGNMENT);
+	ULC_DecoderSample_t *Dst = (ULC_DecoderSample_t*)Buf;
+	float *Coef = (float*)(Dst  + BlockSize);
+	float *Out  = Coef + BlockSize;
+	float *Tmp  = Out  + BlockSize;
+	float *Lap  = Tmp  + BlockSize;
+	for(n=0;n<BlockSize/2;n++) Lap[n] = 0.0f;
+
+	//! Decode blocks of decreasing level, down to near-silence,
+	//! and compare against the floating-point IMDCT
+	double PeakErr = 0.0, SumErr2 = 0.0;
+	for(Block=0;Block<TEST_NBLOCKS;Block++) {
+		int qi = 5 + 2*Block;
+		if(qi > 0xE + 0xC) qi = 0xE + 0xC;
+		BuildBlock(Src, Coef, BlockSize, qi);
+		ULC_DecodeBlock(&Decoder, Dst, Src);
+
+		//! As in the decoder, the first block after a reset has no
+		//! overlap with the (empty) lapping buffer
+		Kernels->IMDCT(Out, Coef, Lap, Tmp, BlockSize, Block ? BlockSize : 0, NULL);
+		for(n=0;n<BlockSize;n++) {
+			double d = fabs(Dst[n] * 0x1.0p-23 - Out[n]);
+			if(d > PeakErr) PeakErr = d;
+			SumErr2 += d*d;
+		}
+	}
+	double RMSErr = sqrt(SumErr2 / (TEST_NBLOCKS*BlockSize));
+	if(!(PeakErr < TEST_MAX_PEAKERR)) {
+		printf("FAIL (BlockSize=%d): Peak error 2^%.2f\n", BlockSize, log2(PeakErr));
+		nFail++;
+	}
+	if(!(RMSErr < TEST_MAX_RMSERR)) {
+		printf("FAIL (BlockSize=%d): RMS error 2^%.2f\n", BlockSize, log2(RMSErr));
+		nFail++;
+	}
+
+	//! Clean up
+	ULC_DecoderState_Destroy(&Decoder);
+	free(_Buf);
+	free(Src);
+	return nFail;
+}
+
+/**************************************/
+
+int main(void) {
+	int BlockSize, nFail = 0;
+	for(BlockSize=256;BlockSize<=FOURIER_SINTABLE_MAX_N;BlockSize*=2) nFail += RunTests(BlockSize);
+	printf("ulcFixedPointTest: %s\n", nFail ? "FAILED" : "OK");
+	return nFail ? 1 : 0;
+}
+
+/**************************************/
+#else
+/**************************************/
+
+int main(void) {
+	printf("ulcFixedPointTest: OK (skipped; fixed-point decoder not built)\n");
+	return 0;
+}
+
+/**************************************/
+#endif
+/**************************************/
+//! EOF
+/**************************************/
@@ -0,0 +1,34 @@
+#!/bin/sh
+#----------------------------#
+# Sync frame test
+# Usage: ulcSyncFrameTest.sh EncodeTool DecodeTool
+#
+# Encodes noise at a high rate with the largest sync interval, so
+# that each sync frame (about 1.4MiB) is larger than the decoding
+# tool's initial cache, and checks that this decodes without any
+# re-synchronization, and identically to the same stream without
+# sync frames.
+#----------------------------#
+
+ENCODETOOL=$1
+DECODETOOL=$2
+TMPDIR=$(mktemp -d) || exit 1
+trap 'rm -rf "$TMPDIR"' EXIT
+
+fail() {
+	echo "FAIL: $1"
+	echo "ulcSyncFrameTest: FAILED"
+	exit 1
+}
+
+# 34 seconds of stereo noise
+head -c 6000000 /dev/urandom > "$TMPDIR/in.raw" || fail "Unable to create input"
+
+"$ENCODETOOL" "$TMPDIR/in.raw" "$TMPDIR/nosync.ulc" 44100 320 -nc:2 -blocksize:8192          > /dev/null || fail "Encoding without sync frames"
+"$ENCODETOOL" "$TMPDIR/in.raw" "$TMPDIR/sync.ulc"   44100 320 -nc:2 -blocksize:8192 -sync:255 > /dev/null || fail "Encoding with sync frames"
+"$DECODETOOL" "$TMPDIR/nosync.ulc" "$TMPDIR/nosync.raw" > "$TMPDIR/nosync.log" || fail "Decoding without sync frames"
+"$DECODETOOL" "$TMPDIR/sync.ulc"   "$TMPDIR/sync.raw"   > "$TMPDIR/sync.log"   || fail "Decoding with sync frames"
+
+grep -q "WARNING" "$TMPDIR/sync.log" && fail "Re-synchronized on an undamaged stream"
+cmp -s "$TMPDIR/nosync.raw" "$TMPDIR/sync.raw" || fail "Output differs with sync frames"
+echo "ulcSyncFrameTest: OK"
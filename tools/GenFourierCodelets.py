@@ -0,0 +1,307 @@
+#!/usr/bin/env python3
+#**************************************#
+#! ulc-codec: Ultra-Low-Complexity Audio Codec
+#! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)
+#! Refer to the project README file for license terms.
+#**************************************#
+
+#! Fourier codelet generator
+#! Usage: GenFourierCodelets.py [fourier/Fourier_SinTable.c] > fourier/Fourier_Codelets.h
+#! Creates straight-line DCT2/DCT3/DCT4/DCT4T kernels for the
+#! sizes in CODELET_SIZES by tracing the same recursion as the
+#! Fourier_DCT*() routines (down to their hand-written N=8
+#! kernels), so that every codelet performs exactly the same
+#! operations as the recursive code it replaces. Trigonometric
+#! constants are read from Fourier_SinTable.c so that they match
+#! the table bit-for-bit.
+#! The DCT-IV codelets are also emitted in a lane-parallel form
+#! (operating on Fourier_Lanes_t vectors, one transform per lane)
+#! for the batched transforms in Fourier_Batch.c.
+
+import re
+import struct
+import sys
+
+CODELET_SIZES = (16, 32, 64)
+
+#**************************************#
+
+#! Round a value to single precision
+def F32(x):
+	return struct.unpack('f', struct.pack('f', x))[0]
+
+#! Format a single-precision literal
+def Lit(x):
+	if x in (0.5, 2.0): return '%.1ff' % x
+	m, e = float.hex(x).split('p')
+	m = m.upper().replace('0X', '0x').rstrip('0').rstrip('.')
+	return '%sp%df' % (m, int(e))
+
+#! Read Fourier_SinTable[]
+def ReadSinTable(Path):
+	Src = open(Path).read()
+	return [F32(float(int(v, 16))) * 2.0**-40 for v in re.findall(r'X\(0x([0-9A-Fa-f]+)ull\)', Src)]
+
+#**************************************#
+
+#! Straight-line code emitter
+#! Every value is a C expression (an input, or a temporary that
+#! holds the result of one operation).
+class Emitter:
+	def __init__(self, Type):
+		self.Lines = []
+		self.nTemps = 0
+		self.Type = Type
+	def Op(self, Expr):
+		Name = 't%d' % self.nTemps
+		self.nTemps += 1
+		self.Lines.append('\t%s %s = %s;' % (self.Type, Name, Expr))
+		return Name
+	def Add(self, a, b): return self.Op('%s + %s' % (a, b))
+	def Sub(self, a, b): return self.Op('%s - %s' % (a, b))
+	def Mul(self, a, c): return self.Op('%s * %s' % (a, Lit(c)))
+	def Rot(self, c0, a, c1, b, Sign):
+		#! c0*a + c1*b (Sign=+1) or c0*a - c1*b (Sign=-1)
+		return self.Op('%s*%s %s %s*%s' % (Lit(c0), a, '+' if Sign > 0 else '-', Lit(c1), b))
+	def NegRot(self, c0, a, c1, b):
+		#! -c0*a + c1*b
+		return self.Op('-%s*%s + %s*%s' % (Lit(c0), a, Lit(c1), b))
+
+#**************************************#
+
+SQRT1_2 = F32(float.fromhex('0x1.6A09E6p-1'))
+C1_3 = F32(float.fromhex('0x1.D906BDp-1')); S1_3 = F32(float.fromhex('0x1.87DE2Ap-2'))
+C1_4 = F32(float.fromhex('0x1.F6297Dp-1')); S1_4 = F32(float.fromhex('0x1.8F8B84p-3'))
+C3_4 = F32(float.fromhex('0x1.A9B663p-1')); S3_4 = F32(float.fromhex('0x1.1C73B4p-1'))
+C6_4 = F32(float.fromhex('0x1.87DE2Ap-2')); S6_4 = F32(float.fromhex('0x1.D906BDp-1'))
+C1_5 = F32(float.fromhex('0x1.FD88DAp-1')); S1_5 = F32(float.fromhex('0x1.917A6Cp-4'))
+C3_5 = F32(float.fromhex('0x1.E9F415p-1')); S3_5 = F32(float.fromhex('0x1.294063p-2'))
+C5_5 = F32(float.fromhex('0x1.C38B2Fp-1')); S5_5 = F32(float.fromhex('0x1.E2B5D4p-2'))
+C7_5 = F32(float.fromhex('0x1.8BC807p-1')); S7_5 = F32(float.fromhex('0x1.44CF32p-1'))
+
+#! N=8 kernels (transcribed from DCT2_8(), DCT3_8(), DCT4_8(), DCT4T_8())
+def DCT2_8(E, x):
+	s07 = E.Add(x[0], x[7]); d07 = E.Sub(x[0], x[7])
+	s16 = E.Add(x[1], x[6]); d16 = E.Sub(x[1], x[6])
+	s25 = E.Add(x[2], x[5]); d25 = E.Sub(x[2], x[5])
+	s34 = E.Add(x[3], x[4]); d34 = E.Sub(x[3], x[4])
+	ss07s34 = E.Add(s07, s34); ds07s34 = E.Sub(s07, s34)
+	ss16s25 = E.Add(s16, s25); ds16s25 = E.Sub(s16, s25)
+	d34d07x = E.Rot(C3_4, d34, S3_4, d07, +1); d34d07y = E.NegRot(S3_4, d34, C3_4, d07)
+	d25d16x = E.Rot(C1_4, d25, S1_4, d16, +1); d25d16y = E.NegRot(S1_4, d25, C1_4, d16)
+	a0 = E.Add(ss07s34, ss16s25); b0 = E.Sub(ss07s34, ss16s25)
+	c0 = E.Rot(C6_4, ds16s25, S6_4, ds07s34, +1); d0 = E.NegRot(S6_4, ds16s25, C6_4, ds07s34)
+	a1 = E.Add(d34d07y, d25d16x); c1 = E.Sub(d34d07y, d25d16x)
+	d1 = E.Add(d34d07x, d25d16y); b1 = E.Sub(d34d07x, d25d16y)
+	y = [None]*8
+	y[0] = a0
+	y[4] = E.Mul(b0, SQRT1_2)
+	y[2] = c0
+	y[6] = d0
+	y[1] = E.Mul(E.Add(a1, d1), SQRT1_2)
+	y[5] = b1
+	y[3] = c1
+	y[7] = E.Mul(E.Sub(a1, d1), SQRT1_2)
+	return y
+def DCT3_8(E, x):
+	a0 = x[0]
+	b0 = E.Mul(x[4], SQRT1_2)
+	c0 = x[2]
+	d0 = x[6]
+	a1 = E.Mul(E.Add(x[1], x[7]), SQRT1_2)
+	d1 = E.Mul(E.Sub(x[1], x[7]), SQRT1_2)
+	b1 = x[5]
+	c1 = x[3]
+	h = E.Mul(a0, 0.5)
+	ss07s34 = E.Add(h, b0); ss16s25 = E.Sub(h, b0)
+	ds16s25 = E.Rot(C6_4, c0, S6_4, d0, -1); ds07s34 = E.Rot(S6_4, c0, C6_4, d0, +1)
+	d34d07y = E.Add(a1, c1); d25d16x = E.Sub(a1, c1)
+	d34d07x = E.Add(d1, b1); d25d16y = E.Sub(d1, b1)
+	s07 = E.Add(ss07s34, ds07s34); s34 = E.Sub(ss07s34, ds07s34)
+	s16 = E.Add(ss16s25, ds16s25); s25 = E.Sub(ss16s25, ds16s25)
+	d34 = E.Rot(C3_4, d34d07x, S3_4, d34d07y, -1); d07 = E.Rot(S3_4, d34d07x, C3_4, d34d07y, +1)
+	d25 = E.Rot(C1_4, d25d16x, S1_4, d25d16y, -1); d16 = E.Rot(S1_4, d25d16x, C1_4, d25d16y, +1)
+	y = [None]*8
+	y[0] = E.Add(s07, d07); y[7] = E.Sub(s07, d07)
+	y[1] = E.Add(s16, d16); y[6] = E.Sub(s16, d16)
+	y[2] = E.Add(s25, d25); y[5] = E.Sub(s25, d25)
+	y[3] = E.Add(s34, d34); y[4] = E.Sub(s34, d34)
+	return y
+def DCT4_8(E, x):
+	ax = E.Rot(C1_5, x[0], S1_5, x[7], +1); ay = E.Rot(S1_5, x[0], C1_5, x[7], -1)
+	bx = E.Rot(C3_5, x[1], S3_5, x[6], +1); by = E.NegRot(S3_5, x[1], C3_5, x[6])
+	cx = E.Rot(C5_5, x[2], S5_5, x[5], +1); cy = E.Rot(S5_5, x[2], C5_5, x[5], -1)
+	dx = E.Rot(C7_5, x[3], S7_5, x[4], +1); dy = E.NegRot(S7_5, x[3], C7_5, x[4])
+	saxdx = E.Add(ax, dx); daxdx = E.Sub(ax, dx)
+	sbxcx = E.Add(bx, cx); dbxcx = E.Sub(bx, cx)
+	sdyay = E.Add(dy, ay); ddyay = E.Sub(dy, ay)
+	scyby = E.Add(cy, by); dcyby = E.Sub(cy, by)
+	sx = E.Add(saxdx, sbxcx); sy = E.Sub(saxdx, sbxcx)
+	tx = E.Rot(C1_3, daxdx, S1_3, dbxcx, +1); ty = E.Rot(S1_3, daxdx, C1_3, dbxcx, -1)
+	ux = E.Add(sdyay, scyby); uy = E.Sub(sdyay, scyby)
+	vx = E.Rot(C1_3, ddyay, S1_3, dcyby, +1); vy = E.Rot(S1_3, ddyay, C1_3, dcyby, -1)
+	y = [None]*8
+	y[0] = sx
+	y[1] = E.Sub(tx, vy)
+	y[2] = E.Add(tx, vy)
+	y[3] = E.Mul(E.Add(sy, uy), SQRT1_2)
+	y[4] = E.Mul(E.Sub(sy, uy), SQRT1_2)
+	y[5] = E.Sub(ty, vx)
+	y[6] = E.Add(ty, vx)
+	y[7] = ux
+	return y
+def DCT4T_8(E, x):
+	sx = x[0]
+	tx = E.Add(x[2], x[1]); vy = E.Sub(x[2], x[1])
+	sy = E.Mul(E.Add(x[3], x[4]), SQRT1_2); uy = E.Mul(E.Sub(x[3], x[4]), SQRT1_2)
+	ty = E.Add(x[6], x[5]); vx = E.Sub(x[6], x[5])
+	ux = x[7]
+	saxdx = E.Add(sx, sy); sbxcx = E.Sub(sx, sy)
+	daxdx = E.Rot(C1_3, tx, S1_3, ty, +1); dbxcx = E.Rot(S1_3, tx, C1_3, ty, -1)
+	sdyay = E.Add(ux, uy); scyby = E.Sub(ux, uy)
+	ddyay = E.Rot(C1_3, vx, S1_3, vy, +1); dcyby = E.Rot(S1_3, vx, C1_3, vy, -1)
+	ax = E.Add(saxdx, daxdx); dx = E.Sub(saxdx, daxdx)
+	bx = E.Add(sbxcx, dbxcx); cx = E.Sub(sbxcx, dbxcx)
+	dy = E.Add(sdyay, ddyay); ay = E.Sub(sdyay, ddyay)
+	cy = E.Add(scyby, dcyby); by = E.Sub(scyby, dcyby)
+	y = [None]*8
+	y[0] = E.Rot(C1_5, ax, S1_5, ay, +1); y[7] = E.Rot(S1_5, ax, C1_5, ay, -1)
+	y[1] = E.Rot(C3_5, bx, S3_5, by, -1); y[6] = E.Rot(S3_5, bx, C3_5, by, +1)
+	y[2] = E.Rot(C5_5, cx, S5_5, cy, +1); y[5] = E.Rot(S5_5, cx, C5_5, cy, -1)
+	y[3] = E.Rot(C7_5, dx, S7_5, dy, -1); y[4] = E.Rot(S7_5, dx, C7_5, dy, +1)
+	return y
+
+#**************************************#
+
+#! Recursive steps (transcribed from the scalar paths of Fourier_DCT*())
+def SinTableN(N):
+	return SinTable[N-16:N-16+N]
+def DCT2(E, x):
+	N = len(x)
+	if N == 8: return DCT2_8(E, x)
+	Lo = [E.Add(x[n], x[N-1-n]) for n in range(N//2)]
+	Hi = [E.Sub(x[n], x[N-1-n]) for n in range(N//2)]
+	Lo = DCT2(E, Lo)
+	Hi = DCT4(E, Hi)
+	y = []
+	for n in range(N//2): y += [Lo[n], Hi[n]]
+	return y
+def DCT3(E, x):
+	N = len(x)
+	if N == 8: return DCT3_8(E, x)
+	Lo = DCT3 (E, x[0::2])
+	Hi = DCT4T(E, x[1::2])
+	y = [None]*N
+	for n in range(N//2):
+		y[n]     = E.Add(Lo[n], Hi[n])
+		y[N-1-n] = E.Sub(Lo[n], Hi[n])
+	return y
+def DCT4(E, x):
+	N = len(x)
+	if N == 8: return DCT4_8(E, x)
+	Win = SinTableN(N)
+	Lo = [None]*(N//2)
+	Hi = [None]*(N//2)
+	for n in range(N//2):
+		a, b = x[n], x[N-1-n]
+		c, s = Win[N-1-n], Win[n]
+		Lo[n] = E.Rot(c, a, s, b, +1)
+		Hi[n] = E.Rot(s, a, c, b, -1) if n%2 == 0 else E.NegRot(s, a, c, b)
+	Lo = DCT2(E, Lo)
+	Hi = DCT2(E, Hi)
+	y = [Lo[0]]
+	for n in range(N//2-1):
+		a, b = Lo[1+n], Hi[N//2-1-n]
+		y += [E.Add(a, b), E.Sub(a, b)]
+	y += [Hi[0]]
+	return y
+def DCT4T(E, x):
+	N = len(x)
+	if N == 8: return DCT4T_8(E, x)
+	Win = SinTableN(N)
+	Lo = [None]*(N//2)
+	Hi = [None]*(N//2)
+	Lo[0] = E.Mul(x[0], 2.0)
+	for n in range(N//2-1):
+		a, b = x[1+2*n], x[2+2*n]
+		Lo[1+n]      = E.Add(a, b)
+		Hi[N//2-1-n] = E.Sub(a, b)
+	Hi[0] = E.Mul(x[N-1], 2.0)
+	Lo = DCT3(E, Lo)
+	Hi = DCT3(E, Hi)
+	y = [None]*N
+	for n in range(N//2):
+		a, b = Lo[n], Hi[n]
+		c, s = Win[N-1-n], Win[n]
+		if n%2 == 0:
+			y[n]     = E.Rot(c, a, s, b, +1)
+			y[N-1-n] = E.Rot(s, a, c, b, -1)
+		else:
+			y[n]     = E.Rot(c, a, s, b, -1)
+			y[N-1-n] = E.Rot(s, a, c, b, +1)
+	return y
+
+#**************************************#
+
+def EmitCodelet(Name, Fnc, N, Type):
+	E = Emitter(Type)
+	x = ['x[%d]' % n for n in range(N)]
+	y = Fnc(E, x)
+	Out = []
+	Out.append('FOURIER_CODELET void %s_%d(%s *x) {' % (Name, N, Type))
+	Out += E.Lines
+	Out += ['\tx[%d] = %s;' % (n, v) for n, v in enumerate(y)]
+	Out.append('}')
+	return Out
+
+SinTable = ReadSinTable(sys.argv[1] if len(sys.argv) > 1 else 'fourier/Fourier_SinTable.c')
+
+print('/**************************************/')
+print('//! ulc-codec: Ultra-Low-Complexity Audio Codec')
+print('//! Copyright (C) 2021, Ruben Nunez (Aikku; aik AT aol DOT com DOT au)')
+print('//! Refer to the project README file for license terms.')
+print('/**************************************/')
+print('#pragma once')
+print('/**************************************/')
+print()
+print('//! Auto-generated by tools/GenFourierCodelets.py; do not modify')
+print('//! Straight-line DCT kernels for N={%s}.' % ','.join(str(N) for N in CODELET_SIZES))
+print('//! Each transform file defines FOURIER_CODELETS_<Type> before')
+print('//! including this file to get only its own codelets.')
+print('//! The _LANES variants operate on one transform per vector lane,')
+print('//! and need Fourier_Lanes_t to be defined by the includer.')
+print('//! NOTE: Built for AVX-512, GCC spreads the temporaries over')
+print('//! xmm16..31 (EVEX encodings) and merges the outputs into')
+print('//! unaligned 512-bit stores, which ran 20-40% slower than the')
+print('//! AVX2 build. So the AVX-512 kernels compile the codelets as')
+print('//! AVX2 code, kept out of line so that it isn\'t inlined back.')
+print('#if defined(__AVX512F__)')
+print('# define FOURIER_CODELET static __attribute__((noinline, target("no-avx512f")))')
+print('#else')
+print('# define FOURIER_CODELET static')
+print('#endif')
+for Name, Fnc, Type in (
+	('DCT2',        DCT2,  'float'),
+	('DCT3',        DCT3,  'float'),
+	('DCT4',        DCT4,  'float'),
+	('DCT4T',       DCT4T, 'float'),
+	('DCT4_Lanes',  DCT4,  'Fourier_Lanes_t'),
+	('DCT4T_Lanes', DCT4T, 'Fourier_Lanes_t'),
+):
+	Desc = Name.replace('_Lanes', '').replace('DCT4T', 'DCT-IV (transposed)').replace('DCT2', 'DCT-II').replace('DCT3', 'DCT-III').replace('DCT4', 'DCT-IV')
+	if Type != 'float': Desc += ', lane-parallel'
+	print()
+	print('/**************************************/')
+	print('#if defined(FOURIER_CODELETS_%s)' % Name.upper())
+	print('/**************************************/')
+	for N in CODELET_SIZES:
+		print()
+		print('//! %s (N=%d)' % (Desc, N))
+		print('\n'.join(EmitCodelet(Name, Fnc, N, Type)))
+	print()
+	print('/**************************************/')
+	print('#endif')
+print()
+print('/**************************************/')
+print('//! EOF')
+print('/**************************************/')
@@ -8,6 +8,7 @@
 #include <time.h>
 /**************************************/
 #include "ulcDecoder.h"
+#include "ulcSync.h"
 /**************************************/
 #define BUFFER_ALIGNMENT 64u //! __mm256
 /**************************************/
@@ -16,11 +17,16 @@
 
 /**************************************/
 
-//! Clip to 16bit range
-static inline float Clip16(float x) {
-	if(x < -0x8000) return -0x8000;
-	if(x > +0x7FFF) return +0x7FFF;
-	return x;
+//! Convert decoded sample to 16bit, with clipping
+static inline int16_t ToPCM16(ULC_DecoderSample_t x) {
+#if ULC_USE_FIXED_POINT
+	int32_t y = (x + (1 << (ULC_DECODER_FIXED_FRACBITS-15-1))) >> (ULC_DECODER_FIXED_FRACBITS-15);
+#else
+	float y = lrintf(32768.0f * x);
+#endif
+	if(y < -0x8000) return -0x8000;
+	if(y > +0x7FFF) return +0x7FFF;
+	return (int16_t)y;
 }
 
 /**************************************/
@@ -35,26 +41,32 @@ struct FileHeader_t {
 	uint16_t nChan;        //! [10h] Channels in stream
 	uint16_t RateKbps;     //! [12h] Nominal coding rate
 	uint32_t StreamOffs;   //! [14h] Offset of data stream
+	uint16_t SyncInterval; //! [18h] Blocks per sync frame (0 = No sync frames)
+	uint16_t Reserved;     //! [1Ah] Reserved (0)
 };
+#define FILEHEADER_BASE_SIZE 0x18 //! Older files end the header here
 
 //! Decoding state
 #define MAX_BLOCK_SIZE 8192
 #define MAX_CHANS         4
-static const int CacheSize = 512*1024;
+#define CACHE_SIZE (512*1024) //! Initial size; grown to fit larger sync frames
 struct DecodeState_t {
 	//! These need to be cleared to NULL
 	FILE *FileIn;
 	FILE *FileOut;
 	char *AllocBuffer;
+	uint8_t *CacheBuffer;
 
-	float   *BlockBuffer;
+	ULC_DecoderSample_t *BlockBuffer;
 	int16_t *BlockOutput;
-	uint8_t *CacheBuffer;
 	uint8_t *CacheNext;
+	uint8_t *CacheEnd;
+	int      CacheSize;
 };
 
 //! Clean up decode state and exit
 static void StateCleanupExit(const struct DecodeState_t *State, int ExitCode) {
+	free(State->CacheBuffer);
 	free(State->AllocBuffer);
 	fclose(State->FileOut);
 	fclose(State->FileIn);
@@ -64,39 +76,95 @@ static void StateCleanupExit(const struct DecodeState_t *State, int ExitCode) {
 //! Initialize state
 static void StateInit(struct DecodeState_t *State, const struct FileHeader_t *Header) {
 	//! Allocate memory
-	int BlockBuffer_Size = sizeof(float)   * Header->nChan*Header->BlockSize;
+	int BlockBuffer_Size = sizeof(ULC_DecoderSample_t) * Header->nChan*Header->BlockSize;
 	int BlockOutput_Size = sizeof(int16_t) * Header->nChan*Header->BlockSize;
-	int CacheBuffer_Size = CacheSize;
 	int BlockBuffer_Offs = 0;
 	int BlockOutput_Offs = BlockBuffer_Offs + BlockBuffer_Size;
-	int CacheBuffer_Offs = BlockOutput_Offs + BlockOutput_Size;
-	int AllocSize = CacheBuffer_Offs + CacheBuffer_Size;
+	int AllocSize = BlockOutput_Offs + BlockOutput_Size;
 	char *Buf = State->AllocBuffer = malloc(BUFFER_ALIGNMENT-1 + AllocSize);
-	if(!Buf) {
+	State->CacheBuffer = malloc(CACHE_SIZE);
+	if(!Buf || !State->CacheBuffer) {
 		printf("ERROR: Out of memory.\n");
 		StateCleanupExit(State, -1);
 	}
 
 	//! Set pointers
 	Buf += -(uintptr_t)Buf % BUFFER_ALIGNMENT;
-	State->BlockBuffer = (float   *)(Buf + BlockBuffer_Offs);
+	State->BlockBuffer = (ULC_DecoderSample_t *)(Buf + BlockBuffer_Offs);
 	State->BlockOutput = (int16_t *)(Buf + BlockOutput_Offs);
-	State->CacheBuffer = (uint8_t *)(Buf + CacheBuffer_Offs);
 	State->CacheNext   = State->CacheBuffer;
+	State->CacheSize   = CACHE_SIZE;
 
 	//! Seek to start of stream and fill cache
 	fseek(State->FileIn, Header->StreamOffs, SEEK_SET);
-	fread(State->CacheNext, sizeof(uint8_t), CacheSize, State->FileIn);
+	State->CacheEnd = State->CacheNext + fread(State->CacheNext, sizeof(uint8_t), CACHE_SIZE, State->FileIn);
+}
+
+//! Refill cache
+//! The cache is grown as needed to hold at least MinSize bytes.
+//! Returns the number of bytes that were added.
+static int StateCacheFill(struct DecodeState_t *State, int MinSize) {
+	int Rem = State->CacheEnd - State->CacheNext;
+	memmove(State->CacheBuffer, State->CacheNext, Rem);
+	if(MinSize > State->CacheSize) {
+		int NewSize = State->CacheSize;
+		while(NewSize < MinSize) NewSize *= 2;
+		uint8_t *NewBuffer = realloc(State->CacheBuffer, NewSize);
+		if(!NewBuffer) {
+			printf("\nERROR: Out of memory.\n");
+			StateCleanupExit(State, -1);
+		}
+		State->CacheBuffer = NewBuffer;
+		State->CacheSize   = NewSize;
+	}
+	int nRead = fread(State->CacheBuffer + Rem, sizeof(uint8_t), State->CacheSize-Rem, State->FileIn);
+	State->CacheNext = State->CacheBuffer;
+	State->CacheEnd  = State->CacheBuffer + Rem + nRead;
+	return nRead;
 }
 
 //! Advance cached data
 static void StateCacheAdvance(struct DecodeState_t *State, int nBytes, int MinSize) {
 	State->CacheNext += nBytes;
-	int Rem = State->CacheBuffer + CacheSize - State->CacheNext;
-	if(Rem < MinSize) {
-		memcpy(State->CacheBuffer, State->CacheNext, Rem);
-		fread(State->CacheBuffer + Rem, sizeof(uint8_t), CacheSize-Rem, State->FileIn);
-		State->CacheNext = State->CacheBuffer;
+	if(State->CacheEnd - State->CacheNext < MinSize) StateCacheFill(State, MinSize);
+}
+
+//! Synchronize to the next sync frame
+//! Returns the index of the block at which decoding resumes (ie.
+//! the first block of the next intact frame), and stores the
+//! number of blocks in that frame to nBlocks.
+//! If no further intact frames exist, returns 0xFFFFFFFF.
+static uint32_t StateSyncFrame(struct DecodeState_t *State, uint32_t Blk, int MinSize, int *nBlocks) {
+	for(;;) {
+		//! Intact frame (at or past the block we are expecting)?
+		struct ULC_SyncFrame_t Frame;
+		int Avail  = State->CacheEnd - State->CacheNext;
+		int Status = ULC_Sync_ReadHeader(State->CacheNext, Avail, &Frame);
+		if(Status != 0) {
+			//! Make sure that the whole frame is cached (growing the
+			//! cache if needed), so that its CRC can be checked
+			int FrameEnd = ULC_SYNC_HEADER_SIZE + Frame.FrameBytes;
+			if(FrameEnd > Avail && StateCacheFill(State, FrameEnd)) continue;
+			if(Status > 0 && FrameEnd <= Avail && Frame.BlockIndex >= Blk) {
+				StateCacheAdvance(State, ULC_SYNC_HEADER_SIZE, MinSize);
+				*nBlocks = Frame.nBlocks;
+				return Frame.BlockIndex;
+			}
+
+			//! The header is intact, so we know where the next
+			//! frame should be; skip straight to it if possible
+			if(FrameEnd <= Avail) {
+				StateCacheAdvance(State, FrameEnd, MinSize);
+				continue;
+			}
+		}
+
+		//! Scan for the next header
+		if(Avail <= ULC_SYNC_HEADER_SIZE) return 0xFFFFFFFFu;
+		int Offs = ULC_Sync_Find(State->CacheNext + 1, Avail - 1);
+		if(Offs < 0) Offs = Avail - ULC_SYNC_HEADER_SIZE; //! Keep the tail, as a header might straddle the cache boundary
+		else         Offs = Offs + 1;
+		StateCacheAdvance(State, Offs, MinSize);
 	}
 }
 
@@ -118,6 +186,7 @@ int main(int argc, const char *argv[]) {
 		.FileIn      = NULL,
 		.FileOut     = NULL,
 		.AllocBuffer = NULL,
+		.CacheBuffer = NULL,
 	};
 
 	//! Open input file
@@ -136,6 +205,10 @@ int main(int argc, const char *argv[]) {
 
 	//! Read header
 	struct FileHeader_t Header; fread(&Header, sizeof(Header), 1, State.FileIn);
+	if(Header.StreamOffs <= FILEHEADER_BASE_SIZE) {
+		Header.SyncInterval = 0;
+		Header.Reserved     = 0;
+	}
 	if(Header.Magic != HEADER_MAGIC) {
 		printf("ERROR: Invalid file.\n");
 		StateCleanupExit(&State, -1);
@@ -161,11 +234,14 @@ int main(int argc, const char *argv[]) {
 		int      n, Chan;
 		int      nChan       = Header.nChan;
 		int      BlockSize   = Header.BlockSize;
-		float   *BlockBuffer = State.BlockBuffer;
+		ULC_DecoderSample_t *BlockBuffer = State.BlockBuffer;
 		int16_t *BlockOutput = State.BlockOutput;
 		uint32_t Blk, nBlk = Header.nBlocks;
 		size_t BlkLastUpdate = 0;
 		clock_t LastUpdateTime = clock() - DISPLAY_UPDATE_RATE;
+		int nDamagedFrames = 0;
+		int FrameBlocksRem = 0;
+		int CacheMinSize   = Header.MaxBlockSize;
 		for(Blk=0;Blk<nBlk;Blk++) {
 			//! Show progress
 			//! NOTE: Take difference and use unsigned comparison to
@@ -183,18 +259,47 @@ int main(int argc, const char *argv[]) {
 				BlkLastUpdate   = Blk;
 			}
 
+			//! Check for sync frames, and re-synchronize if needed
+			//! Any blocks that were lost are replaced with silence.
+			if(Header.SyncInterval && FrameBlocksRem == 0) {
+				uint32_t Resume = StateSyncFrame(&State, Blk, CacheMinSize, &FrameBlocksRem);
+				if(Resume != Blk) {
+					nDamagedFrames++;
+					ULC_DecoderState_Reset(&Decoder);
+					memset(BlockOutput, 0, sizeof(int16_t) * nChan*BlockSize);
+					for(;Blk<Resume && Blk<nBlk;Blk++) fwrite(BlockOutput, nChan*sizeof(int16_t), BlockSize, State.FileOut);
+					if(Blk >= nBlk) break;
+				}
+			}
+
 			//! Decode block
-			int Size = ULC_DecodeBlock(&Decoder, BlockBuffer, State.CacheNext);
-			StateCacheAdvance(&State, (Size + 7) / 8u, Header.MaxBlockSize);
+			//! On malformed data, we re-synchronize to the next sync frame
+			//! if possible (outputting silence for this block), or stop.
+			int Size = ULC_DecodeBlockEx(&Decoder, BlockBuffer, State.CacheNext, State.CacheEnd - State.CacheNext);
+			if(Size < 0) {
+				if(!Header.SyncInterval) {
+					printf("\e[2K\rERROR: Malformed block (%u).\n", Blk);
+					break;
+				}
+				ULC_DecoderState_Reset(&Decoder);
+				for(n=0;n<nChan*BlockSize;n++) BlockBuffer[n] = 0;
+				StateCacheAdvance(&State, 1, CacheMinSize);
+				FrameBlocksRem = 0;
+			} else {
+				StateCacheAdvance(&State, (Size + 7) / 8u, CacheMinSize);
+				FrameBlocksRem--;
+			}
 
 			//! Interleave to output buffer
 			for(Chan=0;Chan<nChan;Chan++) for(n=0;n<BlockSize;n++) {
-				BlockOutput[n*nChan+Chan] = (int16_t)Clip16(lrintf(32768.0f * BlockBuffer[Chan*BlockSize+n]));
+				BlockOutput[n*nChan+Chan] = ToPCM16(BlockBuffer[Chan*BlockSize+n]);
 			}
 
 			//! Write to file
 			fwrite(BlockOutput, nChan*sizeof(int16_t), BlockSize, State.FileOut);
 		}
+		if(nDamagedFrames) printf("\e[2K\rWARNING: Re-synchronized after %d damaged sync frames.\n", nDamagedFrames);
+		ULC_DecoderState_Destroy(&Decoder);
 	} else printf("ERROR: Unable to initialize decoder.\n");
 
 	//! Done
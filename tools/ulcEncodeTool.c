@@ -7,6 +7,7 @@
 #include <time.h>
 /**************************************/
 #include "ulcEncoder.h"
+#include "ulcSync.h"
 /**************************************/
 #define BUFFER_ALIGNMENT 64u //! __mm256
 /**************************************/
@@ -21,6 +22,71 @@
 //! hopefully avoids excessive system calls
 #define CACHE_SIZE (512 * 1024)
 static uint8_t CacheMem[CACHE_SIZE];
+static int     CacheIdx = 0;
+
+//! Write data through the cache
+static void CacheWrite(const void *_Data, int Size, FILE *OutFile) {
+	const uint8_t *Data = _Data;
+	while(Size) {
+		//! Copy up to the limits of the cache area
+		int n = CACHE_SIZE - CacheIdx; //! =CacheRem
+		if(Size < n) n = Size;
+		Size -= n;
+
+		memcpy(CacheMem+CacheIdx, Data, n);
+		Data += n;
+		CacheIdx += n;
+		if(CacheIdx == CACHE_SIZE) {
+			//! Flush to file
+			fwrite(CacheMem, sizeof(uint8_t), CacheIdx, OutFile);
+			CacheIdx = 0;
+		}
+	}
+}
+
+/**************************************/
+
+//! Sync frame buffer
+//! Blocks are collected here until the frame is complete,
+//! at which point the header and the data are written out.
+static uint8_t *FrameMem      = NULL;
+static int      FrameMemSize  = 0;
+static int      FrameBytes    = 0;
+static int      FrameBlocks   = 0;
+static uint32_t FrameBlockIdx = 0;
+
+//! Append block to sync frame
+static int FrameAppend(const void *Data, int Size) {
+	if(FrameBytes + Size > FrameMemSize) {
+		int NewSize = (FrameMemSize ? FrameMemSize : 64*1024);
+		while(NewSize < FrameBytes + Size) NewSize *= 2;
+		uint8_t *NewMem = realloc(FrameMem, NewSize);
+		if(!NewMem) return 0;
+		FrameMem     = NewMem;
+		FrameMemSize = NewSize;
+	}
+	memcpy(FrameMem + FrameBytes, Data, Size);
+	FrameBytes += Size;
+	FrameBlocks++;
+	return 1;
+}
+
+//! Flush sync frame
+static void FrameFlush(FILE *OutFile) {
+	if(!FrameBlocks) return;
+	uint8_t Header[ULC_SYNC_HEADER_SIZE];
+	struct ULC_SyncFrame_t Frame = {
+		.nBlocks    = FrameBlocks,
+		.FrameBytes = FrameBytes,
+		.BlockIndex = FrameBlockIdx,
+	};
+	ULC_Sync_WriteHeader(Header, FrameMem, &Frame);
+	CacheWrite(Header,   ULC_SYNC_HEADER_SIZE, OutFile);
+	CacheWrite(FrameMem, FrameBytes,           OutFile);
+	FrameBlockIdx += FrameBlocks;
+	FrameBytes  = 0;
+	FrameBlocks = 0;
+}
 
 /**************************************/
 
@@ -34,6 +100,8 @@ int main(int argc, const char *argv[]) {
 			"Options:\n"
 			" -nc:1           - Set number of channels.\n"
 			" -blocksize:2048 - Set number of coefficients per block (must be a power of 2).\n"
+			" -sync:0         - Insert sync frames every N blocks (0 = None).\n"
+			" -fast           - Use faster (less accurate) spectral analysis.\n"
 			"Multi-channel data must be interleaved (packed).\n"
 			"Passing AvgComplexity uses ABR mode.\n"
 			"Passing negative RateKbps (-Quality) uses VBR mode.\n"
@@ -44,6 +112,8 @@ int main(int argc, const char *argv[]) {
 	//! Parse parameters
 	int BlockSize = 2048;
 	int nChan     = 1;
+	int SyncInterval = 0;
+	int FastAnalysis = 0;
 	int RateHz    = atoi(argv[3]);
 	float RateKbps, AvgComplexity = 0.0f; sscanf(argv[4], "%f,%f", &RateKbps, &AvgComplexity);
 	{
@@ -61,6 +131,14 @@ int main(int argc, const char *argv[]) {
 				else printf("WARNING: Ignoring invalid parameter to block size (%d)\n", x);
 			}
 
+			else if(!memcmp(argv[n], "-sync:", 6)) {
+				int x = atoi(argv[n] + 6);
+				if(x >= 0 && x <= ULC_SYNC_MAX_BLOCKS) SyncInterval = x;
+				else printf("WARNING: Ignoring invalid parameter to sync interval (%d)\n", x);
+			}
+
+			else if(!strcmp(argv[n], "-fast")) FastAnalysis = 1;
+
 			else printf("WARNING: Ignoring unknown argument (%s)\n", argv[n]);
 		}
 	}
@@ -133,6 +211,8 @@ int main(int argc, const char *argv[]) {
 		uint16_t nChan;        //! [10h] Channels in stream
 		uint16_t RateKbps;     //! [12h] Nominal coding rate
 		uint32_t StreamOffs;   //! [14h] Offset of data stream
+		uint16_t SyncInterval; //! [18h] Blocks per sync frame (0 = No sync frames)
+		uint16_t Reserved;     //! [1Ah] Reserved (0)
 	} FileHeader = {
 		.Magic      = HEADER_MAGIC,
 		.BlockSize  = BlockSize,
@@ -140,6 +220,7 @@ int main(int argc, const char *argv[]) {
 		.RateHz     = RateHz,
 		.nChan      = nChan,
 		.RateKbps   = (uint16_t)RateKbps,
+		.SyncInterval = SyncInterval,
 	};
 	size_t FileHeaderOffs = ftell(OutFile);
 	fseek(OutFile, +sizeof(FileHeader), SEEK_CUR);
@@ -150,6 +231,7 @@ int main(int argc, const char *argv[]) {
 		.nChan      = nChan,
 		.BlockSize  = BlockSize,
 		.ModulationWindow = NULL,
+		.FastAnalysis     = FastAnalysis,
 	};
 	if(ULC_EncoderState_Init(&Encoder) > 0) {
 		const clock_t DISPLAY_UPDATE_RATE = CLOCKS_PER_SEC/2; //! Update every 0.5 seconds
@@ -159,7 +241,6 @@ int main(int argc, const char *argv[]) {
 
 		//! Process blocks
 		int n, Chan;
-		int CacheIdx = 0;
 		size_t Blk, nBlk = FileHeader.nBlocks;
 		uint64_t TotalSize = 0;
 		double ActualAvgComplexity = 0.0;
@@ -196,27 +277,21 @@ int main(int argc, const char *argv[]) {
 			TotalSize += Size;
 			ActualAvgComplexity += Encoder.BlockComplexity;
 
-			//! Copy what we can into the cache
+			//! Copy what we can into the cache (or the sync frame)
 			Size = (Size+7) / 8u;
 			if((size_t)Size > FileHeader.MaxBlockSize) FileHeader.MaxBlockSize = Size;
-			while(Size) {
-				//! Copy up to the limits of the cache area
-				int n = CACHE_SIZE - CacheIdx; //! =CacheRem
-				if(Size < n) n = Size;
-				Size -= n;
-
-				memcpy(CacheMem+CacheIdx, EncData, n);
-				EncData += n;
-				CacheIdx += n;
-				if(CacheIdx == CACHE_SIZE) {
-					//! Flush to file
-					fwrite(CacheMem, sizeof(uint8_t), CacheIdx, OutFile);
-					CacheIdx = 0;
+			if(SyncInterval) {
+				if(FrameBytes + Size > ULC_SYNC_MAX_FRAMESIZE) FrameFlush(OutFile);
+				if(!FrameAppend(EncData, Size)) {
+					printf("\nERROR: Out of memory.\n");
+					break;
 				}
-			}
+				if(FrameBlocks == SyncInterval) FrameFlush(OutFile);
+			} else CacheWrite(EncData, Size, OutFile);
 		}
 
-		//! Flush cache
+		//! Flush sync frame and cache
+		FrameFlush(OutFile);
 		fwrite(CacheMem, sizeof(uint8_t), CacheIdx, OutFile);
 
 		//! Show statistics
@@ -246,6 +321,7 @@ int main(int argc, const char *argv[]) {
 	//! Clean up
 	fclose(OutFile);
 	fclose(InFile);
+	free(FrameMem);
 	free(_BlockBuffer);
 	free(BlockFetch);
 	return 0;